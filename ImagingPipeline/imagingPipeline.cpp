@@ -29,6 +29,7 @@
 #include "gls_linalg.hpp"
 
 #include "CameraCalibration.hpp"
+#include "pipelineDaemon.hpp"
 
 static const char* TAG = "RawPipeline Test";
 
@@ -142,7 +143,7 @@ gls::image<gls::rgb_pixel>::unique_ptr demosaicPlainFile(RawConverter* rawConver
         }
     }};
 
-    return RawConverter::convertToRGBImage(*rawConverter->runPipeline(*inputImage, &demosaicParameters, /*calibrateFromImage=*/ true));
+    return rawConverter->convertToRGBImage(*rawConverter->runPipeline(*inputImage, &demosaicParameters, /*calibrateFromImage=*/ true));
 }
 
 void processKodakSet(gls::OpenCLContext* glsContext, const std::filesystem::path& input_path) {
@@ -152,6 +153,9 @@ void processKodakSet(gls::OpenCLContext* glsContext, const std::filesystem::path
               std::back_inserter(directory_listing));
     std::sort(directory_listing.begin(), directory_listing.end());
 
+    // Each converter reuses the textures released by the previous one
+    const auto texturePool = TexturePool::shared(glsContext);
+
     for (const auto& input_path : directory_listing) {
         RawConverter rawConverter(glsContext);
 
@@ -256,6 +260,15 @@ void demosaicDirectory(RawConverter* rawConverter, std::filesystem::path input_p
 int main(int argc, const char* argv[]) {
     printf("RawPipeline Test!\n");
 
+    // Server mode: context, compiled programs, calibration tables and texture pools stay warm across jobs
+    if (argc > 1 && std::string(argv[1]) == "--daemon") {
+        gls::OpenCLContext glsContext("");
+        RawConverter rawConverter(&glsContext);
+
+        pipeline_daemon::runDaemon(&rawConverter, argc > 2 ? argv[2] : pipeline_daemon::defaultSocketPath());
+        return 0;
+    }
+
     if (argc > 1) {
         gls::OpenCLContext glsContext("");
         RawConverter rawConverter(&glsContext);
@@ -0,0 +1,123 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sys/un.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "pipelineDaemon.hpp"
+
+using namespace pipeline_daemon;
+
+// Local client for imagingPipeline --daemon: sends all the files as jobs on one connection and prints the
+// daemon's per-job timings as they complete.
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--socket path] [--camera profile] [--format png|jpeg] [--priority n] files...\n"
+            "       %s [--socket path] --stop\n",
+            program, program);
+}
+
+int main(int argc, const char* argv[]) {
+    std::string socketPath = defaultSocketPath();
+    JobRequest job = {.priority = 0, .camera = "sonya6400", .format = "png"};
+    bool stopDaemon = false;
+    std::vector<std::string> inputFiles;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string argument = argv[i];
+        if (argument == "--stop") {
+            stopDaemon = true;
+        } else if (argument.starts_with("--") && i + 1 < argc) {
+            const std::string value = argv[++i];
+            if (argument == "--socket") {
+                socketPath = value;
+            } else if (argument == "--camera") {
+                job.camera = value;
+            } else if (argument == "--format") {
+                job.format = value;
+            } else if (argument == "--priority") {
+                job.priority = std::atoi(value.c_str());
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (argument.starts_with("--")) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            inputFiles.push_back(std::filesystem::absolute(argument).string());
+        }
+    }
+    if (inputFiles.empty() && !stopDaemon) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, (sockaddr*)&address, sizeof(address)) < 0) {
+        fprintf(stderr, "Can't connect to %s: %s\n", socketPath.c_str(), std::strerror(errno));
+        return 1;
+    }
+
+    if (stopDaemon) {
+        writeString(fd, std::string(kStopCommand) + "\n");
+        ::close(fd);
+        return 0;
+    }
+
+    for (const auto& inputFile : inputFiles) {
+        job.inputPath = inputFile;
+        if (!writeString(fd, formatRequest(job))) {
+            fprintf(stderr, "Connection lost\n");
+            return 1;
+        }
+    }
+    ::shutdown(fd, SHUT_WR);
+
+    int failures = 0;
+    int replies = 0;
+    LineReader reader(fd);
+    std::string line;
+    while (reader.readLine(&line)) {
+        const auto reply = parseReply(line);
+        if (!reply) {
+            fprintf(stderr, "Malformed reply: %s\n", line.c_str());
+            failures++;
+        } else if (!reply->success) {
+            fprintf(stderr, "%s: %s\n", reply->inputPath.c_str(), reply->outputPath.c_str());
+            failures++;
+        } else {
+            printf("%s -> %s (queue: %dms, process: %dms, write: %dms)\n", reply->inputPath.c_str(),
+                   reply->outputPath.c_str(), reply->queueTimeMs, reply->processTimeMs, reply->writeTimeMs);
+        }
+        replies++;
+    }
+    ::close(fd);
+
+    if (replies < inputFiles.size()) {
+        fprintf(stderr, "Connection closed with %d jobs unanswered\n", (int)inputFiles.size() - replies);
+        return 1;
+    }
+    return failures > 0 ? 1 : 0;
+}
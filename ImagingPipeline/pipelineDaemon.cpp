@@ -0,0 +1,416 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipelineDaemon.hpp"
+
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "CameraCalibration.hpp"
+#include "gls_logging.h"
+#include "raw_converter.hpp"
+
+static const char* TAG = "RawPipeline Daemon";
+
+namespace pipeline_daemon {
+
+using clock = std::chrono::steady_clock;
+
+typedef std::function<gls::image<gls::rgb_pixel>::unique_ptr(RawConverter*, const std::filesystem::path&)>
+    CameraProfile;
+
+static const std::map<std::string, CameraProfile> cameraProfiles = {
+    {"sonya6400", demosaicSonya6400DNG}, {"canoneosrp", demosaicCanonEOSRPDNG}, {"leicaq2", demosaicLeicaQ2DNG},
+    {"imx571", demosaicIMX571DNG},       {"ricohgriii", demosaicRicohGRIII2DNG}, {"iphone11", demosaiciPhone11},
+};
+
+static int elapsedMs(clock::time_point start, clock::time_point end) {
+    return (int)std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// The directory of the socket, created private if missing. An existing one must belong to us and be closed to others.
+static bool prepareSocketDirectory(const std::filesystem::path& directory) {
+    if (directory.empty()) {
+        return true;
+    }
+    if (::mkdir(directory.c_str(), 0700) < 0 && errno != EEXIST) {
+        LOG_ERROR(TAG) << "Can't create " << directory << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    struct stat status;
+    if (::lstat(directory.c_str(), &status) < 0 || !S_ISDIR(status.st_mode)) {
+        LOG_ERROR(TAG) << "Not a directory: " << directory << std::endl;
+        return false;
+    }
+    // Shared directories like /tmp are fine as long as only their owners can remove the entries
+    if (status.st_uid != ::geteuid() && status.st_uid != 0) {
+        LOG_ERROR(TAG) << "Directory " << directory << " belongs to another user" << std::endl;
+        return false;
+    }
+    if ((status.st_mode & (S_IWGRP | S_IWOTH)) != 0 && (status.st_mode & S_ISVTX) == 0) {
+        LOG_ERROR(TAG) << "Directory " << directory << " is writable by other users" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Only processes of our own user may submit jobs
+static bool peerIsOwner(int fd) {
+#if defined(__linux__)
+    ucred credentials;
+    socklen_t length = sizeof(credentials);
+    if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) < 0) {
+        return false;
+    }
+    return credentials.uid == ::geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    if (::getpeereid(fd, &uid, &gid) < 0) {
+        return false;
+    }
+    return uid == ::geteuid();
+#endif
+}
+
+// Closed once the client is done sending and all of its jobs have been answered. Replies are queued and sent by the
+// connection's writer thread, a client slow to read its replies never stalls the job thread
+struct Connection {
+    const int fd;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::string> replies;
+    int pendingJobs = 0;
+    bool readerDone = false;
+
+    Connection(int fd) : fd(fd) {}
+    ~Connection() { ::close(fd); }
+
+    void reply(const JobReply& reply) {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            replies.push_back(formatReply(reply));
+        }
+        condition.notify_one();
+    }
+
+    void jobQueued() {
+        std::lock_guard<std::mutex> guard(mutex);
+        pendingJobs++;
+    }
+
+    void jobAnswered(const JobReply& reply) {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            pendingJobs--;
+            replies.push_back(formatReply(reply));
+        }
+        condition.notify_one();
+    }
+
+    void readerFinished() {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            readerDone = true;
+        }
+        condition.notify_one();
+    }
+
+    // Runs on the writer thread until the last reply is out
+    void writeReplies() {
+        bool clientGone = false;
+        for (;;) {
+            std::string data;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return !replies.empty() || (readerDone && pendingJobs == 0); });
+                if (replies.empty()) {
+                    return;
+                }
+                data = std::move(replies.front());
+                replies.pop_front();
+            }
+            // The replies of a client that went away are dropped
+            clientGone = clientGone || !writeString(fd, data);
+        }
+    }
+};
+
+struct QueuedJob {
+    JobRequest request;
+    uint64_t sequence;
+    clock::time_point enqueueTime;
+    std::shared_ptr<Connection> connection;
+
+    // Highest priority first, FIFO within the same priority
+    bool operator<(const QueuedJob& other) const {
+        return request.priority != other.request.priority ? request.priority < other.request.priority
+                                                           : sequence > other.sequence;
+    }
+};
+
+// The reader and writer threads serving a connection, joined once both are finished
+struct ConnectionThread {
+    std::weak_ptr<Connection> connection;
+    std::thread thread;
+    std::thread writer;
+    std::atomic<int> finishedThreads = 0;
+};
+
+class Daemon {
+    RawConverter* rawConverter;
+    int listenFd = -1;
+
+    std::list<ConnectionThread> connectionThreads;  // Only touched by the accept loop
+
+    std::priority_queue<QueuedJob> jobs;
+    uint64_t sequence = 0;
+    bool stop = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    JobReply process(const JobRequest& request, clock::time_point enqueueTime) {
+        JobReply reply = {request.inputPath, false};
+
+        const auto profile = cameraProfiles.find(request.camera);
+        if (profile == cameraProfiles.end()) {
+            reply.outputPath = "unknown camera profile: " + request.camera;
+            return reply;
+        }
+        if (request.format != "png" && request.format != "jpeg") {
+            reply.outputPath = "unknown output format: " + request.format;
+            return reply;
+        }
+
+        // The camera profiles expect a readable raw file
+        const auto inputPath = std::filesystem::path(request.inputPath);
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(inputPath, error)) {
+            reply.outputPath = "not a regular file: " + request.inputPath;
+            return reply;
+        }
+
+        const auto outputPath = (inputPath.parent_path() / inputPath.stem()).string() +
+                                (request.format == "png" ? "_rgb.png" : "_rgb.jpg");
+        try {
+            const auto t_start = clock::now();
+            const auto rgbImage = profile->second(rawConverter, inputPath);
+            const auto t_processed = clock::now();
+            if (request.format == "png") {
+                rgbImage->write_png_file(outputPath, /*skip_alpha=*/true);
+            } else {
+                rgbImage->write_jpeg_file(outputPath, 95);
+            }
+            const auto t_written = clock::now();
+
+            reply.success = true;
+            reply.outputPath = outputPath;
+            reply.queueTimeMs = elapsedMs(enqueueTime, t_start);
+            reply.processTimeMs = elapsedMs(t_start, t_processed);
+            reply.writeTimeMs = elapsedMs(t_processed, t_written);
+        } catch (const std::exception& e) {
+            reply.outputPath = e.what();
+        }
+        return reply;
+    }
+
+    // All the jobs run on the one RawConverter, in priority order
+    void processJobs() {
+        for (;;) {
+            QueuedJob job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return stop || !jobs.empty(); });
+                if (jobs.empty()) {
+                    return;
+                }
+                job = jobs.top();
+                jobs.pop();
+            }
+
+            const auto reply = process(job.request, job.enqueueTime);
+
+            LOG_INFO(TAG) << "Job " << reply.inputPath << (reply.success ? " -> " : " failed: ") << reply.outputPath
+                          << ", queue: " << reply.queueTimeMs << "ms, process: " << reply.processTimeMs
+                          << "ms, write: " << reply.writeTimeMs << "ms" << std::endl;
+
+            job.connection->jobAnswered(reply);
+        }
+    }
+
+    void serveConnection(std::shared_ptr<Connection> connection) {
+        LineReader reader(connection->fd);
+        std::string line;
+        while (reader.readLine(&line)) {
+            if (line == kStopCommand) {
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    stop = true;
+                }
+                condition.notify_all();
+                // Unblock accept()
+                ::shutdown(listenFd, SHUT_RDWR);
+                break;
+            }
+
+            const auto request = parseRequest(line);
+            if (!request) {
+                connection->reply({line, false, "malformed request"});
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (stop) {
+                    connection->reply({request->inputPath, false, "daemon stopping"});
+                    continue;
+                }
+                connection->jobQueued();
+                jobs.push({*request, sequence++, clock::now(), connection});
+            }
+            condition.notify_all();
+        }
+    }
+
+    // Join the threads of the connections already closed
+    void reapConnectionThreads() {
+        for (auto it = connectionThreads.begin(); it != connectionThreads.end();) {
+            if (it->finishedThreads == 2) {
+                it->thread.join();
+                it->writer.join();
+                it = connectionThreads.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+
+   public:
+    Daemon(RawConverter* rawConverter) : rawConverter(rawConverter) {}
+
+    void run(const std::string& socketPath) {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            LOG_ERROR(TAG) << "Socket path too long: " << socketPath << std::endl;
+            return;
+        }
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+        if (!prepareSocketDirectory(std::filesystem::path(socketPath).parent_path())) {
+            return;
+        }
+
+        // Only replace the socket of a previous run, never anything else living at that path
+        struct stat status;
+        if (::lstat(socketPath.c_str(), &status) == 0) {
+            if (!S_ISSOCK(status.st_mode) || status.st_uid != ::geteuid()) {
+                LOG_ERROR(TAG) << "Not our socket, not replacing it: " << socketPath << std::endl;
+                return;
+            }
+            if (::unlink(socketPath.c_str()) < 0) {
+                LOG_ERROR(TAG) << "Can't remove " << socketPath << ": " << std::strerror(errno) << std::endl;
+                return;
+            }
+        }
+
+        // Clients can't connect before listen(), by then the socket is restricted to our user
+        listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0 || ::bind(listenFd, (sockaddr*)&address, sizeof(address)) < 0 ||
+            ::chmod(socketPath.c_str(), 0600) < 0 || ::listen(listenFd, 16) < 0) {
+            LOG_ERROR(TAG) << "Can't listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+            if (listenFd >= 0) {
+                ::close(listenFd);
+            }
+            return;
+        }
+
+        LOG_INFO(TAG) << "Listening on " << socketPath << std::endl;
+
+        std::thread processor([this] { processJobs(); });
+
+        for (;;) {
+            const int fd = ::accept(listenFd, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            reapConnectionThreads();
+
+            if (!peerIsOwner(fd)) {
+                LOG_ERROR(TAG) << "Refusing a connection from another user" << std::endl;
+                ::close(fd);
+                continue;
+            }
+
+            const auto connection = std::make_shared<Connection>(fd);
+            auto& connectionThread = connectionThreads.emplace_back();
+            connectionThread.connection = connection;
+            connectionThread.thread = std::thread([this, connection, &connectionThread] {
+                serveConnection(connection);
+                connection->readerFinished();
+                connectionThread.finishedThreads++;
+            });
+            connectionThread.writer = std::thread([connection, &connectionThread] {
+                connection->writeReplies();
+                connectionThread.finishedThreads++;
+            });
+        }
+
+        // Complete the queued jobs
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            stop = true;
+        }
+        condition.notify_all();
+        processor.join();
+
+        // Unblock the clients still connected, their new jobs are refused
+        for (const auto& connectionThread : connectionThreads) {
+            if (const auto liveConnection = connectionThread.connection.lock()) {
+                ::shutdown(liveConnection->fd, SHUT_RD);
+            }
+        }
+        for (auto& connectionThread : connectionThreads) {
+            connectionThread.thread.join();
+            connectionThread.writer.join();
+        }
+
+        ::close(listenFd);
+        ::unlink(socketPath.c_str());
+        LOG_INFO(TAG) << "Stopped" << std::endl;
+    }
+};
+
+void runDaemon(RawConverter* rawConverter, const std::string& socketPath) {
+    Daemon daemon(rawConverter);
+    daemon.run(socketPath);
+}
+
+}  // namespace pipeline_daemon
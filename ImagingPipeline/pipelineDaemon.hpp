@@ -0,0 +1,168 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef pipelineDaemon_hpp
+#define pipelineDaemon_hpp
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Job protocol of the imagingPipeline daemon, over a Unix domain stream socket.
+//
+// Each request is a line of tab separated fields: priority, camera profile, output format, input path.
+// Each job is answered with a line: input path, "OK" or "ERROR", then the output path and the queue, process
+// and write times in milliseconds, or the error message. Jobs are answered in completion order, higher priority
+// first. A client may send any number of jobs on one connection, the daemon closes it once all of them have been
+// answered and the client has shut down its writing side. The single line "STOP" terminates the daemon.
+//
+// Only processes running as the daemon's user are served: the socket is created in a private directory with 0600
+// permissions, and the credentials of each peer are checked on accept.
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+class RawConverter;
+
+namespace pipeline_daemon {
+
+static const char* kStopCommand = "STOP";
+
+// In the user's runtime directory, or in a per user directory of /tmp created by the daemon with 0700 permissions
+inline std::string defaultSocketPath() {
+    const char* runtimeDirectory = std::getenv("XDG_RUNTIME_DIR");
+    if (runtimeDirectory != nullptr && runtimeDirectory[0] != 0) {
+        return std::string(runtimeDirectory) + "/imagingPipeline.sock";
+    }
+    return "/tmp/imagingPipeline-" + std::to_string(::geteuid()) + "/imagingPipeline.sock";
+}
+
+struct JobRequest {
+    int priority = 0;
+    std::string camera;
+    std::string format;  // "png" or "jpeg"
+    std::string inputPath;
+};
+
+struct JobReply {
+    std::string inputPath;
+    bool success;
+    std::string outputPath;  // Error message if !success
+    int queueTimeMs = 0;
+    int processTimeMs = 0;
+    int writeTimeMs = 0;
+};
+
+inline std::vector<std::string> splitFields(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, '\t')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+inline std::string formatRequest(const JobRequest& request) {
+    return std::to_string(request.priority) + "\t" + request.camera + "\t" + request.format + "\t" +
+           request.inputPath + "\n";
+}
+
+inline std::optional<JobRequest> parseRequest(const std::string& line) {
+    const auto fields = splitFields(line);
+    if (fields.size() != 4) {
+        return std::nullopt;
+    }
+    try {
+        return JobRequest{std::stoi(fields[0]), fields[1], fields[2], fields[3]};
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+inline std::string formatReply(const JobReply& reply) {
+    if (!reply.success) {
+        return reply.inputPath + "\tERROR\t" + reply.outputPath + "\n";
+    }
+    return reply.inputPath + "\tOK\t" + reply.outputPath + "\t" + std::to_string(reply.queueTimeMs) + "\t" +
+           std::to_string(reply.processTimeMs) + "\t" + std::to_string(reply.writeTimeMs) + "\n";
+}
+
+inline std::optional<JobReply> parseReply(const std::string& line) {
+    const auto fields = splitFields(line);
+    if (fields.size() == 3 && fields[1] == "ERROR") {
+        return JobReply{fields[0], false, fields[2]};
+    }
+    if (fields.size() != 6 || fields[1] != "OK") {
+        return std::nullopt;
+    }
+    try {
+        return JobReply{fields[0], true, fields[2], std::stoi(fields[3]), std::stoi(fields[4]), std::stoi(fields[5])};
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// Buffered line reader on a socket
+class LineReader {
+    int fd;
+    std::string buffer;
+
+   public:
+    LineReader(int fd) : fd(fd) {}
+
+    // False at end of stream
+    bool readLine(std::string* line) {
+        for (;;) {
+            const auto newline = buffer.find('\n');
+            if (newline != std::string::npos) {
+                *line = buffer.substr(0, newline);
+                buffer.erase(0, newline + 1);
+                return true;
+            }
+            char data[4096];
+            const auto count = ::read(fd, data, sizeof(data));
+            if (count <= 0) {
+                return false;
+            }
+            buffer.append(data, count);
+        }
+    }
+};
+
+inline bool writeString(int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        const auto count = ::send(fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+        if (count <= 0) {
+            return false;
+        }
+        written += count;
+    }
+    return true;
+}
+
+// Serve jobs on socketPath until a STOP request, keeping rawConverter's context, programs and textures warm
+void runDaemon(RawConverter* rawConverter, const std::string& socketPath);
+
+}  // namespace pipeline_daemon
+
+#endif /* pipelineDaemon_hpp */
@@ -0,0 +1,75 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef command_queue_hpp
+#define command_queue_hpp
+
+#include <cassert>
+
+#include "gls_cl_image.hpp"
+
+// The kernel wrappers enqueue their work on the calling thread's current command queue: the queue of the
+// innermost CommandQueueScope, or the default queue. Each RawConverter and SURF instance runs in a scope of
+// its own in-order queue, so independent pipelines in different threads execute concurrently on the device.
+
+inline thread_local cl::CommandQueue* currentCommandQueuePtr = nullptr;
+
+inline cl::CommandQueue currentCommandQueue() {
+    return currentCommandQueuePtr ? *currentCommandQueuePtr : cl::CommandQueue::getDefault();
+}
+
+// Leaving the outermost scope of a queue waits for its work, results are then visible to any other queue,
+// including the default queue used by gls::cl_image_2d's map and copy operations
+class CommandQueueScope {
+    cl::CommandQueue* const queue;
+    cl::CommandQueue* const previous;
+
+   public:
+    CommandQueueScope(cl::CommandQueue* queue) : queue(queue), previous(currentCommandQueuePtr) {
+        currentCommandQueuePtr = queue;
+    }
+
+    ~CommandQueueScope() {
+        currentCommandQueuePtr = previous;
+        if (previous != queue) {
+            queue->finish();
+        }
+    }
+
+    CommandQueueScope(const CommandQueueScope&) = delete;
+    CommandQueueScope& operator=(const CommandQueueScope&) = delete;
+};
+
+// Same as gls::OpenCLContext::buildEnqueueArgs, on the current command queue
+inline cl::EnqueueArgs buildEnqueueArgs(size_t width, size_t height) {
+    auto queue = currentCommandQueue();
+    return cl::EnqueueArgs(queue, cl::NDRange(width, height));
+}
+
+inline cl::EnqueueArgs buildEnqueueArgs(const cl::NDRange& global, const cl::NDRange& local) {
+    auto queue = currentCommandQueue();
+    return cl::EnqueueArgs(queue, global, local);
+}
+
+// Blocking upload of a host image, same as gls::cl_image_2d::copyPixelsFrom on the given queue
+template <typename T>
+void copyPixelsFrom(cl::CommandQueue* queue, const gls::image<T>& source, gls::cl_image_2d<T>* destination) {
+    assert(source.width == destination->width && source.height == destination->height);
+    queue->enqueueWriteImage(destination->getImage2D(), CL_TRUE, {0, 0, 0},
+                             {(size_t)source.width, (size_t)source.height, 1}, source.stride * sizeof(T), 0,
+                             source.pixels().data());
+}
+
+#endif /* command_queue_hpp */
@@ -17,6 +17,7 @@
 #define demosaic_hpp
 
 #include <iomanip>
+#include <span>
 
 #include "gls_image.hpp"
 #include "gls_linalg.hpp"
@@ -26,6 +27,22 @@ enum BayerPattern { grbg = 0, gbrg = 1, rggb = 2, bggr = 3 };
 
 static const char* BayerPatternName[4] = {"GRBG", "GBRG", "RGGB", "BGGR"};
 
+// Bit-packed 10/12/14-bit raw data, unpacked on the device. Samples are stored in raster order,
+// each row starts at a byte boundary (as in DNG packed strips) and is rowStride bytes long. The samples form a
+// contiguous bitstream: MIPI CSI-2 RAW10/12, which groups the LSBs of several samples in a separate byte, is not
+// supported.
+typedef struct PackedRawImage {
+    int width;
+    int height;
+    int bitsPerSample;
+    int rowStride;
+    bool msbFirst = true;  // DNG packing order, false for little-endian bit packing
+    std::span<const uint8_t> data;
+
+    // Bytes per row with no padding besides the final partial byte
+    static int packedRowStride(int width, int bitsPerSample) { return (width * bitsPerSample + 7) / 8; }
+} PackedRawImage;
+
 typedef struct DenoiseParameters {
     float luma = 1.0;
     float chroma = 1.0;
@@ -33,6 +50,8 @@ typedef struct DenoiseParameters {
     float gradientBoost = 0.0;
     float gradientThreshold = 1.0;
     float sharpening = 1.0;
+
+    bool operator==(const DenoiseParameters&) const = default;
 } DenoiseParameters;
 
 typedef struct RGBConversionParameters {
@@ -42,6 +61,8 @@ typedef struct RGBConversionParameters {
     float exposureBias = 0;
     float blacks = 0;
     int localToneMapping = 0;
+
+    bool operator==(const RGBConversionParameters&) const = default;
 } RGBConversionParameters;
 
 typedef std::pair<gls::Vector<4>, gls::Vector<4>> RawNLF;
@@ -81,13 +102,35 @@ void dumpNoiseModel(const std::array<CalibrationEntry, N>& calibration_files,
     std::cout << "}};" << std::endl;
 }
 
+// Make sure this struct is in sync with the declaration in demosaic.cl
 typedef struct LTMParameters {
     float eps = 0.01;
     float shadows = 0.8;
     float highlights = 1.05;
     float detail[3] = {1.1, 1.2, 1.3};
+    int maskScale = 1;  // LTM mask resolution divider: 1, 2 or 4
+    // Box radius of the guided filter, radius != 2 uses summed area tables, whose boxes are clipped at the image edges
+    // where the radius 2 kernels replicate the edge pixels
+    int guidedFilterRadius = 2;
+
+    bool operator==(const LTMParameters&) const = default;
 } LTMParameters;
 
+// Processing cost and quality tradeoffs, the defaults are the full quality pipeline
+typedef struct ProcessingParameters {
+    int pyramidLevels = 5;        // Denoised pyramid levels, the coarser ones are passed through
+    int maxDenoiseRadius = 4;     // Denoise window radius when gradientBoost > 0: 4 (9x9) or 2 (5x5)
+    bool despeckle = true;        // Raw (high noise images) and YCbCr despeckling
+    bool adaptiveLevels = false;  // Don't denoise the pyramid levels whose predicted noise is below visibility
+    int bilateralGridLevels = 0;  // Finest pyramid levels whose chroma is further denoised with a bilateral grid
+
+    bool operator==(const ProcessingParameters&) const = default;
+} ProcessingParameters;
+
+enum ProcessingTier { DraftTier = 0, StandardTier = 1, MaxTier = 2 };
+
+static const char* ProcessingTierName[3] = {"draft", "standard", "max"};
+
 typedef struct DemosaicParameters {
     // Basic Debayering Parameters
     BayerPattern bayerPattern;
@@ -108,8 +151,14 @@ typedef struct DemosaicParameters {
 
     // Local Tone Mapping Parameters
     LTMParameters ltmParameters;
+
+    // Processing tier, see applyProcessingTier()
+    ProcessingParameters processingParameters;
 } DemosaicParameters;
 
+// Set the pyramid depth, denoise radius, despeckling and LTM mask resolution of a named tier
+void applyProcessingTier(ProcessingTier tier, DemosaicParameters* demosaicParameters);
+
 // clang-format off
 
 const gls::point bayerOffsets[4][4] = {
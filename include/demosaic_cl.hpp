@@ -27,6 +27,11 @@ void scaleRawData(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::lu
                   gls::cl_image_2d<gls::luma_pixel_float>* scaledRawImage, BayerPattern bayerPattern,
                   gls::Vector<4> scaleMul, float blackLevel);
 
+// Unpack and scale bit-packed raw data
+void scaleRawData(gls::OpenCLContext* glsContext, const cl::Buffer& packedRawBuffer, const PackedRawImage& packedRaw,
+                  gls::cl_image_2d<gls::luma_pixel_float>* scaledRawImage, BayerPattern bayerPattern,
+                  gls::Vector<4> scaleMul, float blackLevel);
+
 void rawImageGradient(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
                       gls::cl_image_2d<gls::luma_alpha_pixel_float>* gradientImage);
 
@@ -58,10 +63,23 @@ void malvar(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pix
 void fasteDebayer(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, BayerPattern bayerPattern);
 
+// Half resolution RGB and green images from the average of each Bayer quad
+void binBayerQuads(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
+                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage,
+                   gls::cl_image_2d<gls::luma_pixel_float>* greenImage, BayerPattern bayerPattern);
+
 template <typename T>
 void resampleImage(gls::OpenCLContext* glsContext, const std::string& kernelName, const gls::cl_image_2d<T>& inputImage,
                    gls::cl_image_2d<T>* outputImage);
 
+// Two pyramid levels of the image and its gradient in one dispatch, as downsampleImageXYZ and downsampleImageXY
+void downsampleImagePyramid2(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
+                             const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage,
+                             gls::cl_image_2d<gls::rgba_pixel_float>* outputImage1,
+                             gls::cl_image_2d<gls::luma_alpha_pixel_float>* outputGradient1,
+                             gls::cl_image_2d<gls::rgba_pixel_float>* outputImage2,
+                             gls::cl_image_2d<gls::luma_alpha_pixel_float>* outputGradient2);
+
 template <typename T>
 void subtractNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<T>& inputImageDenoised0,
                         const gls::cl_image_2d<T>& inputImage1, const gls::cl_image_2d<T>& inputImageDenoised1,
@@ -76,13 +94,27 @@ void subtractNoiseFusedImage(gls::OpenCLContext* glsContext, const gls::cl_image
 void transformImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& linearImage,
                     gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, const gls::Matrix<3, 3>& transform);
 
+// Bake tone curve and black level adjustment in a 1D LUT, see convertTosRGBToneCurveLut
+void bakeToneCurveLut(gls::OpenCLContext* glsContext, const RGBConversionParameters& rgbConversionParameters,
+                      gls::cl_image_2d<gls::luma_pixel_float>* toneCurveLut);
+
+// ltmGuideImage is the input of a reduced resolution LTM mask, used for joint bilateral upsampling.
+// It can be null if the mask is computed at the output resolution.
+// inputTransform converts linearImage to camera RGB, e.g. from the denoised YCbCr in place of a transformImage pass.
 void convertTosRGB(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& linearImage,
                    const gls::cl_image_2d<gls::luma_pixel_float>& ltmMaskImage,
-                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, const DemosaicParameters& demosaicParameters);
+                   const gls::cl_image_2d<gls::rgba_pixel_float>* ltmGuideImage,
+                   const gls::cl_image_2d<gls::luma_pixel_float>& toneCurveLut,
+                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, const DemosaicParameters& demosaicParameters,
+                   const gls::Matrix<3, 3>& inputTransform = gls::Matrix<3, 3>::identity());
 
 void convertToGrayscale(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& linearImage,
                         gls::cl_image_2d<float>* grayscaleImage, const DemosaicParameters& demosaicParameters);
 
+// Quantize to interleaved 8-bit (bitsPerChannel == 8) or 16-bit RGB into outputBuffer, stride is in pixels
+void packRGBImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& rgbImage,
+                  int bitsPerChannel, bool dither, int stride, cl::Buffer* outputBuffer);
+
 void despeckleImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                     const gls::Vector<3>& var_a, const gls::Vector<3>& var_b,
                     gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
@@ -90,19 +122,37 @@ void despeckleImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
 void denoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                   const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage, const gls::Vector<3>& var_a,
                   const gls::Vector<3>& var_b, const gls::Vector<3> thresholdMultipliers, float chromaBoost,
-                  float gradientBoost, float gradientThreshold, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
+                  float gradientBoost, float gradientThreshold, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage,
+                  int maxRadius = 4);
 
 void denoiseImageGuided(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                         const gls::Vector<3>& var_a, const gls::Vector<3>& var_b,
                         gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
 
+// Size of the grid images of bilateralGridChromaDenoise for an image of the given size
+gls::size bilateralGridImageSize(int width, int height);
+
+// Chroma denoising with a bilateral grid over space and luma, the cost doesn't depend on the filter support. The grid
+// images are scratch textures, at least bilateralGridImageSize of the input image. The grid chroma is blended with the
+// input's where their difference is within the chroma noise of chromaNlf (var_a, var_b).
+void bilateralGridChromaDenoise(gls::OpenCLContext* glsContext,
+                                const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* gridImage,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* blurredGridImage,
+                                const gls::Vector<2>& chromaNlf,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
+
 // Arrays order is LF, MF, HF
+// rowSumImage and sumImage are scratch textures for the summed area tables, used when
+// ltmParameters.guidedFilterRadius != 2, they must be one pixel wider and taller than the largest guide image
 void localToneMappingMask(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                           const std::array<const gls::cl_image_2d<gls::rgba_pixel_float>*, 3>& guideImage,
                           const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abImage,
                           const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abMeanImage,
                           const LTMParameters& ltmParameters, const gls::Matrix<3, 3>& ycbcr_srgb,
-                          const gls::Vector<2>& nlf, gls::cl_image_2d<gls::luma_pixel_float>* outputImage);
+                          const gls::Vector<2>& nlf, gls::cl_image_2d<gls::luma_pixel_float>* outputImage,
+                          gls::cl_image_2d<gls::rgba_pixel_float>* rowSumImage = nullptr,
+                          gls::cl_image_2d<gls::rgba_pixel_float>* sumImage = nullptr);
 
 void denoiseLumaImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                       const DenoiseParameters& denoiseParameters, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
@@ -119,6 +169,11 @@ void denoiseRawRGBAImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<
 void despeckleRawRGBAImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                            const gls::Vector<4> rawVariance, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
 
+// despeckleRawRGBAImage on the Bayer mosaic in a single pass, outputImage can't be rawImage
+void despeckleRawImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
+                       const gls::Vector<4> rawVariance, BayerPattern bayerPattern,
+                       gls::cl_image_2d<gls::luma_pixel_float>* outputImage);
+
 void gaussianBlurImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                        float radius, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
 
@@ -129,10 +184,12 @@ void gaussianBlurSobelImage(gls::OpenCLContext* glsContext, const gls::cl_image_
 
 void blueNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                     const gls::cl_image_2d<gls::luma_pixel_16>& blueNoiseImage, gls::Vector<2> lumaVariance,
-                    gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
+                    gls::cl_image_2d<gls::rgba_pixel_float>* outputImage, const gls::point& origin = {0, 0});
 
+// The output is transformed by transform, e.g. to YCbCr in place of a transformImage pass
 void blendHighlightsImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
-                          float clip, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage);
+                          float clip, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage,
+                          const gls::Matrix<3, 3>& transform = gls::Matrix<3, 3>::identity());
 
 YCbCrNLF MeasureYCbCrNLF(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                          const gls::cl_image_2d<gls::luma_alpha_pixel_float>& sobelImage, float exposure_multiplier);
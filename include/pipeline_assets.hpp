@@ -0,0 +1,33 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef pipeline_assets_hpp
+#define pipeline_assets_hpp
+
+#include <cstdint>
+#include <memory>
+
+#include "gls_cl_image.hpp"
+#include "texture_planner.hpp"
+
+// Blue noise tile for the high ISO grain texture, embedded in the library (Assets/HDR_L_0b.png)
+static const constexpr int kBlueNoiseTileSize = 256;
+extern const uint16_t kBlueNoiseTile[kBlueNoiseTileSize * kBlueNoiseTileSize];
+
+// Device copy of the blue noise tile, uploaded once per texture pool and shared by all its users
+std::shared_ptr<const gls::cl_image_2d<gls::luma_pixel_16>> blueNoiseTexture(gls::OpenCLContext* glsContext,
+                                                                             TexturePool* texturePool);
+
+#endif /* pipeline_assets_hpp */
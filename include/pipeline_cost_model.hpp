@@ -0,0 +1,52 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef pipeline_cost_model_hpp
+#define pipeline_cost_model_hpp
+
+#include <array>
+
+#include "demosaic.hpp"
+
+// Per-stage cost model of runPipeline for the time budget mode. Each stage's cost is linear in its workload: the
+// megapixels it processes, scaled by the pyramid depth, the denoise window and the bilateral grid levels for the
+// pyramid and by the mask resolution for LTM. The coefficients are measured on the running device.
+class PipelineCostModel {
+   public:
+    enum Stage { Demosaic = 0, RawDespeckle, Despeckle, PyramidDenoise, LocalToneMapping, PostProcess, kStages };
+
+    static const char* stageName(Stage stage);
+
+    // Workload of stage for an image of the given size
+    static float workload(Stage stage, int width, int height, const DemosaicParameters& demosaicParameters);
+
+    // Add a measured stage time to the model
+    void record(Stage stage, float milliseconds, float workload);
+
+    // The stages run by every image have been measured
+    bool calibrated() const;
+
+    float predict(int width, int height, bool highNoise, const DemosaicParameters& demosaicParameters) const;
+
+    // Set the pyramid depth, denoise radius, despeckling and LTM mask resolution of the highest quality configuration
+    // predicted to complete within budgetMs, or of the cheapest one if none does. Nothing is changed until
+    // calibrated(). The other processing parameters are left to the caller.
+    void plan(float budgetMs, int width, int height, bool highNoise, DemosaicParameters* demosaicParameters) const;
+
+   private:
+    std::array<float, kStages> msPerWorkload = {};  // Zero until measured
+};
+
+#endif /* pipeline_cost_model_hpp */
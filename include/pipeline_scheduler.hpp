@@ -0,0 +1,98 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef pipeline_scheduler_hpp
+#define pipeline_scheduler_hpp
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "raw_converter.hpp"
+
+// Distributes whole images across OpenCL devices. Each worker owns a RawConverter on one context, with the
+// programs compiled for that context's device. Given the measured throughput of each device, the queued jobs are
+// list scheduled across the workers, each to the worker that would complete it first. An idle worker takes the next
+// job if that schedule gives it any of the queued jobs: slower devices share a long queue, and they leave the tail of
+// a batch to a faster device that is about to become available.
+class PipelineScheduler {
+    using clock = std::chrono::steady_clock;
+
+    struct Job {
+        size_t pixels;
+        std::function<void(RawConverter*)> task;
+    };
+
+    struct Worker {
+        int index;
+        gls::OpenCLContext* glsContext;
+        std::unique_ptr<RawConverter> rawConverter;
+        std::string deviceName;
+        double throughput = 0;  // Pixels per millisecond, zero until the first job completes
+        bool busy = false;
+        clock::time_point busyUntil;  // Expected completion of the current job
+        int completedJobs = 0;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::deque<Job> jobs;
+    int runningJobs = 0;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::condition_variable idleCondition;
+    bool stop = false;
+
+    clock::time_point expectedCompletion(const Worker& worker, size_t pixels, clock::time_point now) const;
+    bool shouldTake(const Worker& worker) const;
+    void run(Worker* worker);
+    void enqueueJob(Job&& job);
+
+   public:
+    // One worker per context. Listing a context more than once runs several pipelines concurrently on its device.
+    PipelineScheduler(const std::vector<gls::OpenCLContext*>& glsContexts);
+
+    // Completes all enqueued jobs
+    ~PipelineScheduler();
+
+    // All the devices of all the OpenCL platforms
+    static std::vector<cl::Device> devices();
+
+    // Run task on one of the workers' RawConverter, pixels is the size of the job for the throughput model
+    template <class F>
+    decltype(auto) enqueue(size_t pixels, F&& f) {
+        using return_type = decltype(f(std::declval<RawConverter*>()));
+
+        auto task = std::make_shared<std::packaged_task<return_type(RawConverter*)>>(std::forward<F>(f));
+        std::future<return_type> result = task->get_future();
+        enqueueJob({pixels, [task](RawConverter* rawConverter) { (*task)(rawConverter); }});
+        return result;
+    }
+
+    // Wait for all enqueued jobs to complete
+    void wait();
+
+    void logStatistics();
+};
+
+#endif /* pipeline_scheduler_hpp */
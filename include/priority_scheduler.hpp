@@ -0,0 +1,81 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef priority_scheduler_hpp
+#define priority_scheduler_hpp
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "raw_converter.hpp"
+
+// Job scheduler with priority classes on one device. Each class has its own worker thread and RawConverter, so
+// a preview never queues behind a full render. Lower priority jobs are preempted at the stage boundaries of
+// runPipeline: while higher priority jobs are pending they stop enqueuing work until those complete.
+class PriorityScheduler {
+   public:
+    enum JobClass {
+        Preview = 0,  // Low latency, e.g.: runFastPipeline
+        Render = 1,   // Full quality runPipeline
+    };
+    static const constexpr int kJobClasses = 2;
+
+   private:
+    struct Lane {
+        std::unique_ptr<RawConverter> rawConverter;
+        std::deque<std::function<void(RawConverter*)>> jobs;
+        int pendingJobs = 0;  // Queued or running
+        std::thread thread;
+    };
+
+    std::array<Lane, kJobClasses> lanes;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stop = false;
+
+    bool higherPriorityPending(int jobClass) const;
+    void yield(int jobClass);
+    void run(int jobClass);
+    void enqueueJob(JobClass jobClass, std::function<void(RawConverter*)>&& job);
+
+   public:
+    PriorityScheduler(gls::OpenCLContext* glsContext);
+
+    // Completes all enqueued jobs
+    ~PriorityScheduler();
+
+    // Run f on the RawConverter of the jobClass lane, in FIFO order within the class
+    template <class F>
+    decltype(auto) enqueue(JobClass jobClass, F&& f) {
+        using return_type = decltype(f(std::declval<RawConverter*>()));
+
+        auto task = std::make_shared<std::packaged_task<return_type(RawConverter*)>>(std::forward<F>(f));
+        std::future<return_type> result = task->get_future();
+        enqueueJob(jobClass, [task](RawConverter* rawConverter) { (*task)(rawConverter); });
+        return result;
+    }
+
+    // Wait for all enqueued jobs to complete
+    void wait();
+};
+
+#endif /* priority_scheduler_hpp */
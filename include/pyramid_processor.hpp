@@ -16,8 +16,11 @@
 #ifndef pyramidal_denoise_h
 #define pyramidal_denoise_h
 
+#include <functional>
+
 #include "demosaic.hpp"
 #include "demosaic_cl.hpp"
+#include "texture_planner.hpp"
 
 template <size_t levels>
 struct PyramidProcessor {
@@ -25,22 +28,35 @@ struct PyramidProcessor {
     int fusedFrames;
 
     typedef gls::cl_image_2d<gls::rgba_pixel_float> imageType;
-    std::array<imageType::unique_ptr, levels - 1> imagePyramid;
-    std::array<gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr, levels - 1> gradientPyramid;
-    std::array<imageType::unique_ptr, levels> subtractedImagePyramid;
-    std::array<imageType::unique_ptr, levels> denoisedImagePyramid;
+    // Work pyramids, aliased with other textures by the TexturePlanner
+    std::array<std::shared_ptr<imageType>, levels - 1> imagePyramid;
+    std::array<std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>>, levels - 1> gradientPyramid;
+    std::array<std::shared_ptr<imageType>, levels> subtractedImagePyramid;
+    std::array<std::shared_ptr<imageType>, levels> denoisedImagePyramid;
     std::array<imageType::unique_ptr, levels> fusionImagePyramidA;
     std::array<imageType::unique_ptr, levels> fusionImagePyramidB;
     std::array<imageType::unique_ptr, levels> fusionReferenceImagePyramid;
     std::array<gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr, levels> fusionReferenceGradientPyramid;
     std::array<imageType::unique_ptr, levels>* fusionBuffer[2];
+    std::array<imageType::unique_ptr, 2> bilateralGrid;  // Allocated on first use, for the first level's grid
+
+    // Invoked after the denoising of each pyramid level, from the coarsest one, including the levels passed through
+    // undenoised. See RawConverter::setStageBoundaryHook and RawConverter::runProgressivePipeline
+    std::function<void(int level)> levelDenoised;
+
+    PyramidProcessor(gls::OpenCLContext* glsContext, int width, int height, TexturePlanner* texturePlanner);
 
-    PyramidProcessor(gls::OpenCLContext* glsContext, int width, int height);
+    // The texture planner's pipeline must describe the work pyramids, named as the members
+    void allocateTextures(gls::OpenCLContext* glsContext, TexturePlanner* texturePlanner);
 
+    // Only the first processingParameters.pyramidLevels levels are denoised, the coarser ones are passed through.
+    // With processingParameters.adaptiveLevels the levels whose noise model predicts invisible noise are only
+    // reconstructed, and the trailing ones are passed through as well. The chroma of the first
+    // processingParameters.bilateralGridLevels levels is denoised again with a bilateral grid.
     imageType* denoise(gls::OpenCLContext* glsContext, std::array<DenoiseParameters, levels>* denoiseParameters,
                        const imageType& image, const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage,
                        std::array<YCbCrNLF, levels>* nlfParameters, float exposure_multiplier,
-                       bool calibrateFromImage = false);
+                       bool calibrateFromImage = false, const ProcessingParameters& processingParameters = {});
 
     void fuseFrame(gls::OpenCLContext* glsContext, std::array<DenoiseParameters, levels>* denoiseParameters,
                    const imageType& image, const gls::Matrix<3, 3>& homography,
@@ -16,107 +16,334 @@
 #ifndef raw_converter_hpp
 #define raw_converter_hpp
 
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <span>
+
+#include "command_queue.hpp"
 #include "gls_cl_image.hpp"
+#include "pipeline_cost_model.hpp"
 #include "pyramid_processor.hpp"
+#include "texture_planner.hpp"
 
 class LocalToneMapping {
-    gls::cl_image_2d<gls::luma_pixel_float>::unique_ptr ltmMaskImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr lfAbGfImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr lfAbGfMeanImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr mfAbGfImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr mfAbGfMeanImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr hfAbGfImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr hfAbGfMeanImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_float>> ltmMaskImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> lfAbGfImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> lfAbGfMeanImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> mfAbGfImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> mfAbGfMeanImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> hfAbGfImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> hfAbGfMeanImage;
+
+    // Summed area tables scratch textures, only allocated for guidedFilterRadius != 2
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> rowSumImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> sumImage;
+
+    // Input of a reduced resolution mask, guide for its upsampling
+    const gls::cl_image_2d<gls::rgba_pixel_float>* ltmMaskGuideImage = nullptr;
 
    public:
     LocalToneMapping(gls::OpenCLContext* glsContext) {
         auto clContext = glsContext->clContext();
 
         // Placeholder, only allocated if LTM is used
-        ltmMaskImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, 1, 1);
+        ltmMaskImage = std::make_shared<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, 1, 1);
     }
 
-    void allocateTextures(gls::OpenCLContext* glsContext, int width, int height) {
-        auto clContext = glsContext->clContext();
+    // Pyramid level matching the LTM mask resolution
+    static int maskLevel(const LTMParameters& ltmParameters) {
+        return ltmParameters.maskScale >= 4 ? 2 : ltmParameters.maskScale >= 2 ? 1 : 0;
+    }
+
+    // Textures sizes and lifetimes are described in RawConverter::describePipeline
+    void allocateTextures(gls::OpenCLContext* glsContext, TexturePlanner* texturePlanner,
+                          const LTMParameters& ltmParameters) {
+        ltmMaskImage = texturePlanner->texture<gls::luma_pixel_float>(glsContext, "ltmMaskImage");
+        lfAbGfImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "lfAbGfImage");
+        lfAbGfMeanImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "lfAbGfMeanImage");
+        mfAbGfImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "mfAbGfImage");
+        mfAbGfMeanImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "mfAbGfMeanImage");
+        hfAbGfImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "hfAbGfImage");
+        hfAbGfMeanImage = texturePlanner->texture<gls::luma_alpha_pixel_float>(glsContext, "hfAbGfMeanImage");
 
-        if (ltmMaskImage->width != width || ltmMaskImage->height != height) {
-            ltmMaskImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, width, height);
-            lfAbGfImage =
-                std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width / 16, height / 16);
-            lfAbGfMeanImage =
-                std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width / 16, height / 16);
-            mfAbGfImage =
-                std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width / 4, height / 4);
-            mfAbGfMeanImage =
-                std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width / 4, height / 4);
-            hfAbGfImage = std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width, height);
-            hfAbGfMeanImage = std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width, height);
+        if (ltmParameters.guidedFilterRadius != 2) {
+            rowSumImage = texturePlanner->texture<gls::rgba_pixel_float>(glsContext, "rowSumImage");
+            sumImage = texturePlanner->texture<gls::rgba_pixel_float>(glsContext, "sumImage");
+        } else {
+            rowSumImage = nullptr;
+            sumImage = nullptr;
         }
     }
 
-    void createMask(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& image,
-                    const std::array<const gls::cl_image_2d<gls::rgba_pixel_float>*, 3>& guideImage,
+    // The mask is computed at the resolution of denoisedImagePyramid[maskLevel()]
+    void createMask(gls::OpenCLContext* glsContext,
+                    const std::array<std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>>, 5>& denoisedImagePyramid,
                     const NoiseModel<5>& noiseModel, const DemosaicParameters& demosaicParameters) {
+        const int level = maskLevel(demosaicParameters.ltmParameters);
+
+        const std::array<const gls::cl_image_2d<gls::rgba_pixel_float>*, 3>& guideImage = {
+            denoisedImagePyramid[4].get(), denoisedImagePyramid[std::max(level, 2)].get(),
+            denoisedImagePyramid[level].get()};
         const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abImage = {
             lfAbGfImage.get(), mfAbGfImage.get(), hfAbGfImage.get()};
         const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abMeanImage = {
             lfAbGfMeanImage.get(), mfAbGfMeanImage.get(), hfAbGfMeanImage.get()};
 
-        gls::Vector<2> nlf = {noiseModel.pyramidNlf[0].first[0], noiseModel.pyramidNlf[0].second[0]};
+        const auto& image = *denoisedImagePyramid[level];
+        gls::Vector<2> nlf = {noiseModel.pyramidNlf[level].first[0], noiseModel.pyramidNlf[level].second[0]};
         localToneMappingMask(glsContext, image, guideImage, abImage, abMeanImage, demosaicParameters.ltmParameters,
-                             ycbcr_srgb, nlf, ltmMaskImage.get());
+                             ycbcr_srgb, nlf, ltmMaskImage.get(), rowSumImage.get(), sumImage.get());
+
+        ltmMaskGuideImage = level > 0 ? &image : nullptr;
     }
 
     const gls::cl_image_2d<gls::luma_pixel_float>& getMask() { return *ltmMaskImage; }
+
+    const gls::cl_image_2d<gls::rgba_pixel_float>* getMaskGuide() { return ltmMaskGuideImage; }
 };
 
 class RawConverter {
     gls::OpenCLContext* _glsContext;
 
+    // All the work of this instance goes to its own in-order queue, concurrent RawConverters don't serialize
+    cl::CommandQueue commandQueue;
+
     // TODO: this should probably be camera specific
     static const constexpr float kHighNoiseVariance = 2.5e-04;
 
+    // Device textures and buffers are recycled across sizes and RawConverter instances
+    std::shared_ptr<TexturePool> texturePool;
+
+    // Work textures are aliased by lifetime, see describePipeline
+    TexturePlanner texturePlanner;
+    std::array<int, 6> texturePlanKey = {0, 0, 0, 0, 0, 0};  // width, height, LTM, LTM mask level, LTM SAT, incremental
+
+    // Incremental rendering, see rerender()
+    bool incrementalRendering = false;
+    std::optional<DemosaicParameters> renderedParameters;  // Of the resident result, if any
+
     // RawConverter base work textures
-    gls::cl_image_2d<gls::luma_pixel_16>::unique_ptr clRawImage;
-    gls::cl_image_2d<gls::luma_pixel_float>::unique_ptr clScaledRawImage;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clRawSobelImage;
-    gls::cl_image_2d<gls::luma_alpha_pixel_float>::unique_ptr clRawGradientImage;
-    gls::cl_image_2d<gls::luma_pixel_float>::unique_ptr clGreenImage;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clLinearRGBImageA;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clLinearRGBImageB;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clsRGBImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_16>> clRawImage;
+    std::shared_ptr<cl::Buffer> clPackedRawBuffer;
+    uint8_t* mappedPackedRawData = nullptr;
+    std::shared_ptr<cl::Buffer> clOutputBuffer;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_float>> clScaledRawImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clRawSobelImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_alpha_pixel_float>> clRawGradientImage;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_float>> clGreenImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clLinearRGBImageA;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clLinearRGBImageB;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clsRGBImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clYCbCrImage;  // Demosaiced, for incremental rendering
+    gls::cl_image_2d<gls::rgba_pixel_float>* clDenoisedResult = nullptr;    // Of the last denoise(), for rerender()
 
     std::unique_ptr<PyramidProcessor<5>> pyramidProcessor;
 
     std::unique_ptr<LocalToneMapping> localToneMapping;
 
+    // Tone curve LUT, only rebaked when the tone curve parameters change
+    static const constexpr int kToneCurveLutSize = 1024;
+    gls::cl_image_2d<gls::luma_pixel_float>::unique_ptr clToneCurveLut;
+    std::array<float, 2> toneCurveLutParameters = {0, 0};  // toneCurveSlope, blacks
+
     // RawConverter HighNoise textures
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr rgbaRawImage;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr denoisedRgbaRawImage;
-    gls::cl_image_2d<gls::luma_pixel_16>::unique_ptr clBlueNoise;
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_float>> clDespeckledRawImage;
+    std::shared_ptr<const gls::cl_image_2d<gls::luma_pixel_16>> clBlueNoise;
+    gls::point blueNoiseOrigin = {0, 0};  // Position of the processed image in the frame, nonzero for ROI crops
 
     // Fast (half resolution) RawConverter textures
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clFastLinearRGBImage;
-    gls::cl_image_2d<gls::rgba_pixel_float>::unique_ptr clsFastRGBImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clFastLinearRGBImage;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clsFastRGBImage;
 
-    void allocateTextures(gls::OpenCLContext* glsContext, int width, int height);
-    void allocateHighNoiseTextures(gls::OpenCLContext* glsContext, int width, int height);
+    // Binned RawConverter textures, the rest of the binned pipeline is planned at half resolution
+    std::shared_ptr<gls::cl_image_2d<gls::luma_pixel_float>> clBinnedGreenImage;
+
+    // Region of interest output, the rest of the ROI pipeline is planned at the size of the region and its halo
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clsROIImage;
+
+    // Progressive rendering of the current runProgressivePipeline, pyramid levels 1..kProgressiveLevels are rendered
+    static const constexpr int kProgressiveLevels = 2;
+    std::function<void(int level, const gls::cl_image_2d<gls::rgba_pixel_float>& image)> progressiveCallback;
+    const DemosaicParameters* progressiveParameters = nullptr;
+    std::shared_ptr<gls::cl_image_2d<gls::rgba_pixel_float>> clsProgressiveRGBImage;
+
+    void renderProgressiveLevel(int level);
+
+    void allocateTextures(gls::OpenCLContext* glsContext, int width, int height,
+                          const DemosaicParameters& demosaicParameters);
     void allocateFastDemosaicTextures(gls::OpenCLContext* glsContext, int width, int height);
+    void allocateBinnedRawTextures(gls::OpenCLContext* glsContext, int width, int height);
+
+    const gls::cl_image_2d<gls::luma_pixel_float>& toneCurveLut(const RGBConversionParameters& rgbConversionParameters);
+
+    // Raw data decoded directly into clRawImage
+    struct DeviceRawImage {
+        int width;
+        int height;
+    };
+
+    // Upload the raw data and scale it into clScaledRawImage
+    void uploadRawImage(const gls::image<gls::luma_pixel_16>& rawImage, const DemosaicParameters& demosaicParameters);
+    void uploadRawImage(const PackedRawImage& rawImage, const DemosaicParameters& demosaicParameters);
+    void uploadRawImage(const DeviceRawImage& rawImage, const DemosaicParameters& demosaicParameters);
+
+    void allocatePackedRawBuffer(size_t size);
+
+    void allocateOutputBuffer(size_t size);
+
+    // Blend the highlights of clLinearRGBImageA, with toYCbCr the output is converted to YCbCr for denoising
+    gls::cl_image_2d<gls::rgba_pixel_float>* blendHighlights(const DemosaicParameters* demosaicParameters,
+                                                             bool toYCbCr);
+
+    template <typename RawImage>
+    gls::cl_image_2d<gls::rgba_pixel_float>* demosaicImage(const RawImage& rawImage,
+                                                           DemosaicParameters* demosaicParameters,
+                                                           bool calibrateFromImage, bool toYCbCr = false);
+
+    // Half resolution counterpart of demosaicImage, averages the Bayer quads
+    template <typename RawImage>
+    gls::cl_image_2d<gls::rgba_pixel_float>* binImage(const RawImage& rawImage, DemosaicParameters* demosaicParameters,
+                                                      bool toYCbCr = false);
+
+    // Yield point of runPipeline, between demosaicing, the denoising pyramid levels and post processing
+    std::function<void()> stageBoundaryHook;
+
+    void stageBoundary() {
+        if (stageBoundaryHook) {
+            // The host enqueues much faster than the device runs, only the completed stage's work can be in flight
+            // when the hook lets other work on the device
+            commandQueue.finish();
+
+            // Time spent waiting in the hook is not charged to the stages
+            const auto waitStart = std::chrono::high_resolution_clock::now();
+            stageBoundaryHook();
+            stageStart += std::chrono::high_resolution_clock::now() - waitStart;
+        }
+    }
+
+    // Time budget mode, stage times of the current runPipeline are accumulated for the cost model
+    float timeBudgetMs = 0;
+    bool timingStages = false;  // The current runPipeline is in time budget mode
+    PipelineCostModel costModel;
+    std::array<float, PipelineCostModel::kStages> stageTimes = {};
+    std::chrono::high_resolution_clock::time_point stageStart;
+
+    // Charge the time since the previous mark to stage
+    void markStage(PipelineCostModel::Stage stage);
+
+    template <typename RawImage>
+    gls::cl_image_2d<gls::rgba_pixel_float>* runPipelineImpl(const RawImage& rawImage,
+                                                             DemosaicParameters* demosaicParameters,
+                                                             bool calibrateFromImage, bool binned = false);
+
+    template <typename RawImage>
+    gls::cl_image_2d<gls::rgba_pixel_float>* runBinnedPipelineImpl(const RawImage& rawImage,
+                                                                   DemosaicParameters* demosaicParameters,
+                                                                   bool calibrateFromImage);
 
    public:
-    RawConverter(gls::OpenCLContext* glsContext) : _glsContext(glsContext) {
+    RawConverter(gls::OpenCLContext* glsContext)
+        : _glsContext(glsContext),
+          commandQueue(glsContext->clContext()),
+          texturePool(TexturePool::shared(glsContext)),
+          texturePlanner(texturePool) {
         localToneMapping = std::make_unique<LocalToneMapping>(_glsContext);
     }
 
     gls::OpenCLContext* getContext() const { return _glsContext; }
 
+    // Kernels enqueued by the caller within a CommandQueueScope of this queue are ordered with the pipeline's work
+    cl::CommandQueue* getCommandQueue() { return &commandQueue; }
+
+    // Called on the pipeline's thread at each stage boundary of runPipeline, the hook may block to let higher
+    // priority work use the device. The converter's queue is finished before each call, so work that starts while
+    // the hook waits or while the next stage is enqueued only competes with at most one stage of the pipeline.
+    void setStageBoundaryHook(std::function<void()> hook) { stageBoundaryHook = std::move(hook); }
+
+    // Time budget in milliseconds for runPipeline, 0 disables. Each run picks the highest quality processing
+    // parameters and LTM mask resolution the cost model predicts within budget, overriding the ones in
+    // DemosaicParameters, and its stage timings calibrate the model. The first runs use the caller's parameters.
+    void setTimeBudget(float milliseconds) { timeBudgetMs = milliseconds; }
+
+    const PipelineCostModel& getCostModel() const { return costModel; }
+
+    // Pipeline graph: the stages in execution order and the lifetime of each work texture
+    static void describePipeline(TexturePlanner* texturePlanner, int width, int height, bool highNoise,
+                                 const LTMParameters* ltmParameters, bool fusion, bool incremental = false);
+
+    // Log unaliased, theoretical and achieved peak texture memory for the normal, high noise, LTM and fusion modes
+    static void logTextureMemory(int width, int height, const LTMParameters& ltmParameters);
+
+    gls::cl_image_2d<gls::rgba_pixel_float>* runPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                         DemosaicParameters* demosaicParameters,
+                                                         bool calibrateFromImage = false);
+
+    // Keep the textures needed to rerender() denoising and LTM changes resident across calls: the demosaiced YCbCr
+    // image and the LTM guide levels of the denoising pyramid, which are otherwise aliased with other work textures
+    void setIncrementalRendering(bool enabled) { incrementalRendering = enabled; }
+
+    // Re-render the result of the last runPipeline for new parameters, only rerunning the stages invalidated by the
+    // parameters that changed: denoise() and what follows for the denoise parameters, pyramid NLF and processing
+    // parameters, the LTM mask and postProcess for LTMParameters, postProcess for RGBConversionParameters.
+    // Returns nullptr if runPipeline is needed instead: there is no resident result, the demosaicing parameters
+    // changed, the LTM mask resolution changed, or the stages to rerun need textures that are not resident.
+    gls::cl_image_2d<gls::rgba_pixel_float>* rerender(const DemosaicParameters& demosaicParameters);
+
+    // Only renders the region roi of the output image, processing roi and the halo of raw pixels it depends on.
+    // There is no calibrateFromImage: the statistics of a region are biased, the noise model and white balance
+    // should come from the full image. runPipeline with calibrateFromImage writes the measured noise model back
+    // into demosaicParameters, which can be kept for all the regions of the same image.
     gls::cl_image_2d<gls::rgba_pixel_float>* runPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                         const gls::rectangle& roi,
+                                                         DemosaicParameters* demosaicParameters);
+
+    // Raw pixels around a region it depends on, from the footprint of each stage of the pipeline
+    static int roiHalo(const DemosaicParameters& demosaicParameters);
+
+    // runPipeline calling back with renders of increasing resolution: pyramid levels 2 and 1 (quarter and half
+    // resolution) as soon as they are denoised, or copied when adaptiveLevels passes them through, then the full
+    // resolution result (level 0), which is also returned.
+    // The previews are post processed views of the denoising pyramid, they only add their own post processing to the
+    // full pipeline's work, without LTM, whose mask needs the finer levels. Previews are complete when the callback
+    // runs and are only valid during it: the next level recycles the texture, copy the image to keep it.
+    gls::cl_image_2d<gls::rgba_pixel_float>* runProgressivePipeline(
+        const gls::image<gls::luma_pixel_16>& rawImage, DemosaicParameters* demosaicParameters,
+        bool calibrateFromImage,
+        const std::function<void(int level, const gls::cl_image_2d<gls::rgba_pixel_float>& image)>& callback);
+
+    // Bit-packed 10/12/14-bit raw input, unpacked on the device
+    gls::cl_image_2d<gls::rgba_pixel_float>* runPipeline(const PackedRawImage& rawImage,
                                                          DemosaicParameters* demosaicParameters,
                                                          bool calibrateFromImage = false);
 
+    // Zero-copy raw input: decodeRawImage writes the raw data straight into the mapped device raw image
+    gls::cl_image_2d<gls::rgba_pixel_float>* runPipeline(
+        int width, int height, const std::function<void(gls::image<gls::luma_pixel_16>*)>& decodeRawImage,
+        DemosaicParameters* demosaicParameters, bool calibrateFromImage = false);
+
+    // Full quality pipeline at half resolution: the Bayer quads are binned into RGB pixels, then denoise, LTM and
+    // postProcess run on the binned image with the binned image's noise model. demosaicParameters->noiseModel keeps
+    // the full resolution model, calibrateFromImage only measures the pyramid NLF of the binned image.
+    gls::cl_image_2d<gls::rgba_pixel_float>* runBinnedPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                               DemosaicParameters* demosaicParameters,
+                                                               bool calibrateFromImage = false);
+
+    gls::cl_image_2d<gls::rgba_pixel_float>* runBinnedPipeline(const PackedRawImage& rawImage,
+                                                               DemosaicParameters* demosaicParameters,
+                                                               bool calibrateFromImage = false);
+
+    // Zero-copy packed raw input: decode into the returned host visible buffer and pass it
+    // back as PackedRawImage::data to runPipeline, the buffer is unmapped by the pipeline, or by the next call if the
+    // data never reached it
+    std::span<uint8_t> mapPackedRawBuffer(size_t size);
+
     gls::cl_image_2d<gls::rgba_pixel_float>* demosaic(const gls::image<gls::luma_pixel_16>& rawImage,
                                                       DemosaicParameters* demosaicParameters, bool calibrateFromImage);
 
+    gls::cl_image_2d<gls::rgba_pixel_float>* demosaic(const PackedRawImage& rawImage,
+                                                      DemosaicParameters* demosaicParameters, bool calibrateFromImage);
+
     gls::cl_image_2d<gls::rgba_pixel_float>* denoise(const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                                                      DemosaicParameters* demosaicParameters, bool calibrateFromImage);
 
@@ -125,15 +352,18 @@ class RawConverter {
 
     gls::cl_image_2d<gls::rgba_pixel_float>* getFusedImage();
 
+    // With ycbcrInput the input is the denoised YCbCr image, converted back to camera RGB on the fly
     gls::cl_image_2d<gls::rgba_pixel_float>* postProcess(const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
-                                                         const DemosaicParameters& demosaicParameters);
+                                                         const DemosaicParameters& demosaicParameters,
+                                                         bool ycbcrInput = false);
 
     gls::cl_image_2d<gls::rgba_pixel_float>* runFastPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
                                                              const DemosaicParameters& demosaicParameters);
 
+    // Quantization and packing happen on the device, only the packed pixels are read back
     template <typename T = gls::rgb_pixel>
-    static typename gls::image<T>::unique_ptr convertToRGBImage(
-        const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage);
+    typename gls::image<T>::unique_ptr convertToRGBImage(const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage,
+                                                         bool dither = false);
 };
 
 #endif /* raw_converter_hpp */
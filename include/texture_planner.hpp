@@ -0,0 +1,310 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef texture_planner_hpp
+#define texture_planner_hpp
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+#include "gls_cl_image.hpp"
+
+// Device images and buffers recycling. Released objects are kept, keyed by pixel format and size, and handed out
+// again to the next request of the same kind, so switching between image sizes stops allocating once each size
+// has been seen. Buffers are bucketed by power of two sizes. Images are only reused at their exact size, kernels
+// rely on get_image_dim() for edge handling. The least recently released objects are freed beyond the capacity.
+class TexturePool : public std::enable_shared_from_this<TexturePool> {
+    struct Entry {
+        std::type_index type;
+        int width, height;
+        cl_mem_flags flags;
+        size_t size;
+        std::unique_ptr<void, void (*)(void*)> object;
+    };
+
+    // Default capacity as a fraction of the device memory
+    static const constexpr int kCapacityDivisor = 4;
+
+    const cl_context context;  // Of the pooled objects
+    std::mutex mutex;
+    std::list<Entry> freeList;  // Most recently released first
+    size_t freeSize = 0;
+    size_t capacity;
+    std::map<std::string, std::shared_ptr<void>> assets;
+
+    template <typename T>
+    T* acquire(const std::type_index& type, int width, int height, cl_mem_flags flags, size_t size) {
+        std::lock_guard<std::mutex> guard(mutex);
+        for (auto it = freeList.begin(); it != freeList.end(); it++) {
+            if (it->type == type && it->width == width && it->height == height && it->flags == flags &&
+                it->size == size) {
+                T* object = static_cast<T*>(it->object.release());
+                freeSize -= size;
+                freeList.erase(it);
+                return object;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    void release(T* object, const std::type_index& type, int width, int height, cl_mem_flags flags, size_t size) {
+        std::lock_guard<std::mutex> guard(mutex);
+        freeList.push_front({type, width, height, flags, size, {object, [](void* p) { delete static_cast<T*>(p); }}});
+        freeSize += size;
+        evict(capacity);
+    }
+
+    // Free the least recently released objects to fit within maxFreeSize, mutex must be held
+    void evict(size_t maxFreeSize) {
+        while (freeSize > maxFreeSize && !freeList.empty()) {
+            freeSize -= freeList.back().size;
+            freeList.pop_back();
+        }
+    }
+
+    template <typename T>
+    std::shared_ptr<T> recycled(T* object, const std::type_index& type, int width, int height, cl_mem_flags flags,
+                                size_t size) {
+        return std::shared_ptr<T>(object, [pool = weak_from_this(), type, width, height, flags, size](T* p) {
+            if (auto texturePool = pool.lock()) {
+                texturePool->release(p, type, width, height, flags, size);
+            } else {
+                delete p;
+            }
+        });
+    }
+
+   public:
+    TexturePool(gls::OpenCLContext* glsContext) : context(glsContext->clContext()()) {
+        const auto devices = glsContext->clContext().getInfo<CL_CONTEXT_DEVICES>();
+        const auto memorySize = devices.empty() ? 0 : devices[0].getInfo<CL_DEVICE_GLOBAL_MEM_SIZE>();
+        capacity = memorySize / kCapacityDivisor;
+    }
+
+    // One pool per OpenCL context, shared by all of its RawConverter instances. The pool lives as long as its users,
+    // which can't outlive the context: keep a reference next to the context to retain the released objects between
+    // users. The registry only holds weak references, entries of destroyed pools are dropped.
+    static std::shared_ptr<TexturePool> shared(gls::OpenCLContext* glsContext) {
+        static std::mutex poolsMutex;
+        static std::map<gls::OpenCLContext*, std::weak_ptr<TexturePool>> pools;
+
+        std::lock_guard<std::mutex> guard(poolsMutex);
+        std::erase_if(pools, [](const auto& entry) { return entry.second.expired(); });
+
+        auto pool = pools[glsContext].lock();
+        // A context created at the address of a destroyed one doesn't get the objects of the stale pool
+        if (!pool || pool->context != glsContext->clContext()()) {
+            pool = std::make_shared<TexturePool>(glsContext);
+            pools[glsContext] = pool;
+        }
+        return pool;
+    }
+
+    template <typename T>
+    std::shared_ptr<gls::cl_image_2d<T>> image(gls::OpenCLContext* glsContext, int width, int height) {
+        const auto type = std::type_index(typeid(gls::cl_image_2d<T>));
+        const size_t size = sizeof(T) * width * height;
+
+        auto image = acquire<gls::cl_image_2d<T>>(type, width, height, 0, size);
+        if (!image) {
+            image = new gls::cl_image_2d<T>(glsContext->clContext(), width, height);
+        }
+        return recycled(image, type, width, height, 0, size);
+    }
+
+    std::shared_ptr<cl::Buffer> buffer(gls::OpenCLContext* glsContext, cl_mem_flags flags, size_t size) {
+        const auto type = std::type_index(typeid(cl::Buffer));
+        size_t bucketSize = 4096;
+        while (bucketSize < size) {
+            bucketSize *= 2;
+        }
+
+        auto buffer = acquire<cl::Buffer>(type, 0, 0, flags, bucketSize);
+        if (!buffer) {
+            buffer = new cl::Buffer(glsContext->clContext(), flags, bucketSize);
+        }
+        return recycled(buffer, type, 0, 0, flags, bucketSize);
+    }
+
+    // Read-only device data shared by the users of the pool, e.g.: lookup tables and textures uploaded once. The
+    // asset is created on first request and lives as long as the pool.
+    template <typename T>
+    std::shared_ptr<const T> asset(const std::string& name, const std::function<std::shared_ptr<T>()>& create) {
+        std::lock_guard<std::mutex> guard(mutex);
+        auto& asset = assets[name];
+        if (!asset) {
+            asset = create();
+        }
+        return std::static_pointer_cast<const T>(asset);
+    }
+
+    // Upper bound for the memory held by released objects, a quarter of the device memory by default
+    void setCapacity(size_t maxFreeSize) {
+        std::lock_guard<std::mutex> guard(mutex);
+        capacity = maxFreeSize;
+        evict(capacity);
+    }
+
+    // Free all released objects
+    void trim() {
+        std::lock_guard<std::mutex> guard(mutex);
+        evict(0);
+    }
+};
+
+// Lifetime based texture allocation. The pipeline is described as an ordered list of stages, and each texture
+// by the first and the last stage using it. Textures of the same pixel format and size whose lifetimes don't
+// overlap are aliased to the same device allocation.
+class TexturePlanner {
+    struct Texture {
+        std::string name;
+        std::type_index format;
+        size_t pixelSize;
+        int width, height;
+        int firstStage, lastStage;
+        int slot;
+
+        size_t size() const { return pixelSize * width * height; }
+    };
+
+    struct Slot {
+        int texture;    // First texture assigned to the slot, defines format and size
+        int lastStage;  // Last stage using the slot
+        std::shared_ptr<void> image;
+    };
+
+    std::vector<std::string> stages;
+    std::vector<Texture> textures;
+    std::vector<Slot> slots;
+    std::map<std::string, int> textureIndex;
+    std::shared_ptr<TexturePool> texturePool;
+
+    int stageIndex(const std::string& stage) const {
+        const auto it = std::find(stages.begin(), stages.end(), stage);
+        assert(it != stages.end());
+        return (int)(it - stages.begin());
+    }
+
+   public:
+    // Slot textures are taken from texturePool if provided
+    TexturePlanner(std::shared_ptr<TexturePool> texturePool = nullptr) : texturePool(texturePool) {}
+
+    static std::string name(const std::string& base, int index) { return base + "[" + std::to_string(index) + "]"; }
+
+    void addStage(const std::string& stage) { stages.push_back(stage); }
+
+    // The lifetime spans from firstStage to lastStage inclusive
+    template <typename T>
+    void addTexture(const std::string& name, int width, int height, const std::string& firstStage,
+                    const std::string& lastStage) {
+        assert(textureIndex.find(name) == textureIndex.end());
+        textureIndex[name] = (int)textures.size();
+        textures.push_back({name, std::type_index(typeid(T)), sizeof(T), width, height, stageIndex(firstStage),
+                            stageIndex(lastStage), -1});
+    }
+
+    // Live for the whole pipeline, e.g.: textures handed across API calls
+    template <typename T>
+    void addPersistentTexture(const std::string& name, int width, int height) {
+        addTexture<T>(name, width, height, stages.front(), stages.back());
+    }
+
+    // Greedy interval coloring in order of first use, optimal for each format and size class
+    void plan() {
+        std::vector<int> order(textures.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [this](int a, int b) { return textures[a].firstStage < textures[b].firstStage; });
+
+        slots.clear();
+        for (int t : order) {
+            auto& texture = textures[t];
+            texture.slot = -1;
+            for (size_t s = 0; s < slots.size(); s++) {
+                const auto& slotTexture = textures[slots[s].texture];
+                if (slots[s].lastStage < texture.firstStage && slotTexture.format == texture.format &&
+                    slotTexture.width == texture.width && slotTexture.height == texture.height) {
+                    texture.slot = (int)s;
+                    slots[s].lastStage = texture.lastStage;
+                    break;
+                }
+            }
+            if (texture.slot < 0) {
+                texture.slot = (int)slots.size();
+                slots.push_back({t, texture.lastStage, nullptr});
+            }
+        }
+    }
+
+    // The device texture backing name, allocated on first request and shared by all the textures of its slot
+    template <typename T>
+    std::shared_ptr<gls::cl_image_2d<T>> texture(gls::OpenCLContext* glsContext, const std::string& name) {
+        const auto& entry = textures[textureIndex.at(name)];
+        assert(entry.format == std::type_index(typeid(T)) && entry.slot >= 0);
+
+        auto& slot = slots[entry.slot];
+        if (!slot.image && texturePool) {
+            slot.image = texturePool->image<T>(glsContext, entry.width, entry.height);
+        } else if (!slot.image) {
+            slot.image = std::make_shared<gls::cl_image_2d<T>>(glsContext->clContext(), entry.width, entry.height);
+        }
+        return std::static_pointer_cast<gls::cl_image_2d<T>>(slot.image);
+    }
+
+    // Memory without any aliasing
+    size_t unaliasedSize() const {
+        size_t size = 0;
+        for (const auto& texture : textures) {
+            size += texture.size();
+        }
+        return size;
+    }
+
+    // Largest working set of any stage, a lower bound for any aliasing scheme
+    size_t theoreticalPeak() const {
+        size_t peak = 0;
+        for (size_t s = 0; s < stages.size(); s++) {
+            size_t size = 0;
+            for (const auto& texture : textures) {
+                if ((size_t)texture.firstStage <= s && s <= (size_t)texture.lastStage) {
+                    size += texture.size();
+                }
+            }
+            peak = std::max(peak, size);
+        }
+        return peak;
+    }
+
+    // Memory of the planned allocations
+    size_t achievedPeak() const {
+        size_t size = 0;
+        for (const auto& slot : slots) {
+            size += textures[slot.texture].size();
+        }
+        return size;
+    }
+};
+
+#endif /* texture_planner_hpp */
@@ -138,7 +138,7 @@ gls::image<gls::rgb_pixel>::unique_ptr demosaicPlainFile(RawConverter* rawConver
         }
     }};
 
-    return RawConverter::convertToRGBImage(*rawConverter->runPipeline(*inputImage, &demosaicParameters, /*calibrateFromImage=*/ true));
+    return rawConverter->convertToRGBImage(*rawConverter->runPipeline(*inputImage, &demosaicParameters, /*calibrateFromImage=*/ true));
 }
 
 void processKodakSet(gls::OpenCLContext* glsContext, const std::filesystem::path& input_path) {
@@ -148,6 +148,9 @@ void processKodakSet(gls::OpenCLContext* glsContext, const std::filesystem::path
               std::back_inserter(directory_listing));
     std::sort(directory_listing.begin(), directory_listing.end());
 
+    // Each converter reuses the textures released by the previous one
+    const auto texturePool = TexturePool::shared(glsContext);
+
     for (const auto& input_path : directory_listing) {
         RawConverter rawConverter(glsContext);
 
@@ -151,12 +151,9 @@ int main(int argc, const char * argv[]) {
         const auto cl_result_image = rawConverter.getFusedImage();
         const auto denoisedImage = rawConverter.denoise(*cl_result_image, demosaicParameters.get(), /*calibrateFromImage=*/ true);
 
-        // Convert result back to camera RGB
-        const auto normalized_ycbcr_to_cam = inverse(cam_to_ycbcr) * demosaicParameters->exposure_multiplier;
-        transformImage(&glsContext, *denoisedImage, denoisedImage, normalized_ycbcr_to_cam);
-
-        const auto sRGBImage = rawConverter.postProcess(*denoisedImage, *demosaicParameters);
-        const auto result_image = RawConverter::convertToRGBImage(*sRGBImage);
+        // The result is converted back to camera RGB by postProcess
+        const auto sRGBImage = rawConverter.postProcess(*denoisedImage, *demosaicParameters, /*ycbcrInput=*/ true);
+        const auto result_image = rawConverter.convertToRGBImage(*sRGBImage);
 
         result_image->write_png_file(reference_image_path.parent_path() / "fused_NTB.png");
     }
@@ -46,7 +46,7 @@ gls::image<gls::rgb_pixel>::unique_ptr CameraCalibration<levels>::calibrate(RawC
     demosaicParameters->noiseLevel = denoiseParameters.first;
     demosaicParameters->denoiseParameters = denoiseParameters.second;
 
-    return RawConverter::convertToRGBImage(
+    return rawConverter->convertToRGBImage(
         *rawConverter->runPipeline(*inputImage, demosaicParameters, /*calibrateFromImage=*/true));
 }
 
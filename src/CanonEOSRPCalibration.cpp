@@ -186,7 +186,7 @@ gls::image<gls::rgb_pixel>::unique_ptr demosaicCanonEOSRPDNG(RawConverter* rawCo
     CanonEOSRPCalibration calibration;
     auto demosaicParameters = calibration.getDemosaicParameters(*inputImage, &dng_metadata, &exif_metadata);
 
-    return RawConverter::convertToRGBImage(
+    return rawConverter->convertToRGBImage(
         *rawConverter->runPipeline(*inputImage, demosaicParameters.get(), /*calibrateFromImage=*/true));
 }
 // --- NLFData ---
@@ -212,7 +212,7 @@ gls::image<gls::rgb_pixel>::unique_ptr demosaicIMX571DNG(RawConverter* rawConver
                                                             demosaicedImage->width, demosaicedImage->height * 1.2);
     clRescaleImage(rawConverter->getContext(), *demosaicedImage, &unsquishedImage);
 
-    return RawConverter::convertToRGBImage(unsquishedImage);
+    return rawConverter->convertToRGBImage(unsquishedImage);
 }
 
 // --- NLFData ---
@@ -40,6 +40,14 @@ enum BayerPattern {
 
 enum { raw_red = 0, raw_green = 1, raw_blue = 2, raw_green2 = 3 };
 
+typedef struct {
+    float3 m[3];
+} Matrix3x3;
+
+float3 applyTransform(float3 value, Matrix3x3 *transform) {
+    return (float3) (dot(transform->m[0], value), dot(transform->m[1], value), dot(transform->m[2], value));
+}
+
 constant const int2 bayerOffsets[4][4] = {
     { {1, 0}, {0, 0}, {0, 1}, {1, 1} }, // grbg
     { {0, 1}, {0, 0}, {1, 0}, {1, 1} }, // gbrg
@@ -152,6 +160,44 @@ kernel void scaleRawData(read_only image2d_t rawImage, write_only image2d_t scal
     }
 }
 
+// Extract a bitsPerSample wide sample from a bit-packed raw buffer, samples never straddle more than three bytes
+uint unpackRawSample(global const uchar* packedRawData, int rowStride, int bitsPerSample, int msbFirst, int2 coords) {
+    const int bitOffset = coords.x * bitsPerSample;
+    global const uchar* p = packedRawData + coords.y * rowStride + bitOffset / 8;
+    const int shift = bitOffset % 8;
+    const int bytes = (shift + bitsPerSample + 7) / 8;
+    const uint mask = (1 << bitsPerSample) - 1;
+
+    uint bits = 0;
+    if (msbFirst) {
+        // DNG style contiguous bitstream, the first sample starts at the most significant bit. MIPI CSI-2 RAW10/12,
+        // with the MSBs in whole bytes followed by a byte of packed LSBs, is a different layout.
+        for (int i = 0; i < bytes; i++) {
+            bits = (bits << 8) | p[i];
+        }
+        return (bits >> (8 * bytes - shift - bitsPerSample)) & mask;
+    } else {
+        for (int i = 0; i < bytes; i++) {
+            bits |= ((uint) p[i]) << (8 * i);
+        }
+        return (bits >> shift) & mask;
+    }
+}
+
+// Same as scaleRawData, unpacking 10/12/14-bit samples on the fly. Work on one Quad (2x2) at a time.
+kernel void scaleRawDataPacked(global const uchar* packedRawData, int rowStride, int bitsPerSample, int msbFirst,
+                               write_only image2d_t scaledRawImage, int bayerPattern, float4 vScaleMul, float blackLevel) {
+    float *scaleMul = (float *) &vScaleMul;
+    const int2 imageCoordinates = (int2) (2 * get_global_id(0), 2 * get_global_id(1));
+    for (int c = 0; c < 4; c++) {
+        int2 o = bayerOffsets[bayerPattern][c];
+        const int2 coords = imageCoordinates + (int2) (o.x, o.y);
+        // Normalize as a 16-bit unorm texture read, like scaleRawData
+        const float value = unpackRawSample(packedRawData, rowStride, bitsPerSample, msbFirst, coords) / 65535.0;
+        write_imagef(scaledRawImage, coords, max(scaleMul[c] * (value - blackLevel), 0.0f));
+    }
+}
+
 float2 sobel(read_only image2d_t inputImage, int x, int y) {
     float2 value = 0;
     for (int j = -1; j <= 1; j++) {
@@ -649,6 +695,27 @@ kernel void fastDebayer(read_only image2d_t rawImage, write_only image2d_t rgbIm
     write_imagef(rgbImage, imageCoordinates, (float4)(red, (green + green2) / 2, blue, 0.0));
 }
 
+// Half resolution RGB from the average of each Bayer quad, the averaged green is also the binned gradient source
+kernel void binBayerQuads(read_only image2d_t rawImage, write_only image2d_t rgbImage,
+                          write_only image2d_t greenImage, int bayerPattern) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    const int2 r = bayerOffsets[bayerPattern][raw_red];
+    const int2 g = bayerOffsets[bayerPattern][raw_green];
+    const int2 b = bayerOffsets[bayerPattern][raw_blue];
+    const int2 g2 = bayerOffsets[bayerPattern][raw_green2];
+
+    float red    = read_imagef(rawImage, 2 * imageCoordinates + r).x;
+    float green  = read_imagef(rawImage, 2 * imageCoordinates + g).x;
+    float blue   = read_imagef(rawImage, 2 * imageCoordinates + b).x;
+    float green2 = read_imagef(rawImage, 2 * imageCoordinates + g2).x;
+
+    float greenAverage = (green + green2) / 2;
+
+    write_imagef(rgbImage, imageCoordinates, (float4)(red, greenAverage, blue, 0.0));
+    write_imagef(greenImage, imageCoordinates, greenAverage);
+}
+
 #define M_SQRT3_F 1.7320508f
 
 constant float3 trans[3] = {
@@ -662,7 +729,9 @@ constant float3 itrans[3] = {
     { 1,              0,  1   },
 };
 
-kernel void blendHighlightsImage(read_only image2d_t inputImage, float clip, write_only image2d_t outputImage) {
+// The output is transformed by transform, the identity or the conversion to YCbCr for denoising
+kernel void blendHighlightsImage(read_only image2d_t inputImage, float clip, Matrix3x3 transform,
+                                 write_only image2d_t outputImage) {
     const int2 imageCoordinates = (int2)(get_global_id(0), get_global_id(1));
 
     float3 pixel = read_imagef(inputImage, imageCoordinates).xyz;
@@ -692,7 +761,7 @@ kernel void blendHighlightsImage(read_only image2d_t inputImage, float clip, wri
     pixel *= lens_shading;
 #endif
 
-    write_imagef(outputImage, imageCoordinates, (float4)(pixel, 0.0));
+    write_imagef(outputImage, imageCoordinates, (float4)(applyTransform(pixel, &transform), 0.0));
 }
 
 /// ---- Median Filter 3x3 ----
@@ -921,6 +990,71 @@ kernel void despeckleRawRGBAImage(read_only image2d_t inputImage, float4 rawVari
     write_imageh(denoisedImage, imageCoordinates, despeckledPixel);
 }
 
+#define DESPECKLE_TILE 16
+#define DESPECKLE_APRON_TILE (DESPECKLE_TILE + 2)
+
+// despeckleRawRGBAImage directly on the Bayer mosaic, without the RGBA round trip. Each work-item despeckles a Bayer
+// quad from the same colour pixels of the neighbouring quads, the work-group's quads and a one quad apron are staged
+// in local memory. The mosaic can't be despeckled in place, the apron of a work-group is another's tile.
+kernel void despeckleRawImage(read_only image2d_t rawImage, float4 rawVariance, int bayerPattern,
+                              write_only image2d_t despeckledRawImage) {
+    local half4 quads[DESPECKLE_APRON_TILE][DESPECKLE_APRON_TILE];
+
+    const int2 r = bayerOffsets[bayerPattern][raw_red];
+    const int2 g = bayerOffsets[bayerPattern][raw_green];
+    const int2 b = bayerOffsets[bayerPattern][raw_blue];
+    const int2 g2 = bayerOffsets[bayerPattern][raw_green2];
+
+    const int2 tileOrigin = (int2) (get_group_id(0), get_group_id(1)) * DESPECKLE_TILE;
+    const int2 localCoordinates = (int2) (get_local_id(0), get_local_id(1));
+    const int2 quadsSize = get_image_dim(rawImage) / 2;
+
+    for (int i = localCoordinates.y * DESPECKLE_TILE + localCoordinates.x;
+         i < DESPECKLE_APRON_TILE * DESPECKLE_APRON_TILE; i += DESPECKLE_TILE * DESPECKLE_TILE) {
+        const int2 t = (int2) (i % DESPECKLE_APRON_TILE, i / DESPECKLE_APRON_TILE);
+        const int2 q = 2 * clamp(tileOrigin + t - 1, 0, quadsSize - 1);
+        quads[t.y][t.x] = (half4) (read_imageh(rawImage, q + r).x, read_imageh(rawImage, q + g).x,
+                                   read_imageh(rawImage, q + b).x, read_imageh(rawImage, q + g2).x);
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int2 quad = tileOrigin + localCoordinates;
+    if (any(quad >= quadsSize)) {
+        return;
+    }
+
+    // Same as despeckle_3x3x4
+    half4 sample = quads[localCoordinates.y + 1][localCoordinates.x + 1];
+    half4 firstMax = 0, secondMax = 0;
+    half4 firstMin = (half) HALF_MAX, secondMin = (half) HALF_MAX;
+
+    for (int x = 0; x <= 2; x++) {
+        for (int y = 0; y <= 2; y++) {
+            half4 v = quads[localCoordinates.y + y][localCoordinates.x + x];
+
+            secondMax = v >= firstMax ? firstMax : max(v, secondMax);
+            firstMax = max(v, firstMax);
+
+            secondMin = v <= firstMin ? firstMin : min(v, secondMin);
+            firstMin = min(v, firstMin);
+        }
+    }
+
+    half4 sigma = sqrt(convert_half4(rawVariance) * sample);
+    half4 minVal = mix(secondMin, firstMin, smoothstep(2 * sigma, 8 * sigma, secondMin - firstMin));
+    half4 maxVal = mix(secondMax, firstMax, smoothstep(sigma, 4 * sigma, firstMax - secondMax));
+    float4 despeckledQuad = convert_float4(clamp(sample, minVal, maxVal));
+
+    write_imagef(despeckledRawImage, 2 * quad + r, despeckledQuad.x);
+    write_imagef(despeckledRawImage, 2 * quad + g, despeckledQuad.y);
+    write_imagef(despeckledRawImage, 2 * quad + b, despeckledQuad.z);
+    write_imagef(despeckledRawImage, 2 * quad + g2, despeckledQuad.w);
+}
+
+#undef DESPECKLE_APRON_TILE
+#undef DESPECKLE_TILE
+
 /*
  * 5 x 5 Fast Median Filter Implementation for Chroma Antialiasing
  */
@@ -1090,10 +1224,6 @@ kernel void falseColorsRemovalImage(read_only image2d_t inputImage, write_only i
 
 /// ---- Image Denoising ----
 
-typedef struct {
-    float3 m[3];
-} Matrix3x3;
-
 kernel void transformImage(read_only image2d_t inputImage, write_only image2d_t outputImage, Matrix3x3 transform) {
     const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
     float3 inputValue = read_imagef(inputImage, imageCoordinates).xyz;
@@ -1109,7 +1239,7 @@ half tunnel(half x, half y, half angle, half sigma) {
 kernel void denoiseImage(read_only image2d_t inputImage,
                          read_only image2d_t gradientImage,
                          float3 var_a, float3 var_b, float3 thresholdMultipliers,
-                         float chromaBoost, float gradientBoost, float gradientThreshold,
+                         float chromaBoost, float gradientBoost, float gradientThreshold, int radius,
                          write_only image2d_t denoisedImage) {
     const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
 
@@ -1123,7 +1253,7 @@ kernel void denoiseImage(read_only image2d_t inputImage,
     half magnitude = length(gradient);
     half edge = smoothstep(4, 16, gradientThreshold * magnitude / sigma.x);
 
-    const int size = gradientBoost > 0 ? 4 : 2;
+    const int size = radius;
 
     half3 filtered_pixel = 0;
     half3 kernel_norm = 0;
@@ -1152,6 +1282,108 @@ kernel void denoiseImage(read_only image2d_t inputImage,
     write_imageh(denoisedImage, imageCoordinates, (half4) (denoisedPixel, magnitude));
 }
 
+// Bilateral grid over space and luma for chroma denoising. Each of the GRID_BINS luma bins is a gridSize slice of the
+// grid image, the slices are laid out GRID_BIN_COLUMNS per row. The grid cells hold (Cb, Cr, weight) sums.
+#define GRID_BINS 8
+#define GRID_BIN_COLUMNS 4
+
+int2 gridBinOrigin(int bin, int2 gridSize) {
+    return (int2) (bin % GRID_BIN_COLUMNS, bin / GRID_BIN_COLUMNS) * gridSize;
+}
+
+// Bins are spaced evenly in the square root of the luma, linear luma would crowd the shadows into the first bin
+float gridLumaPosition(float luma) {
+    return sqrt(clamp(luma, 0.0f, 1.0f)) * (GRID_BINS - 1);
+}
+
+// Gather splat, each work-item accumulates one cellSize x cellSize block of pixels into the luma bins of its cell,
+// without atomics. Samples are split between the two nearest bins.
+kernel void splatBilateralGrid(read_only image2d_t inputImage, int cellSize, int2 gridSize,
+                               write_only image2d_t gridImage) {
+    const int2 cell = (int2) (get_global_id(0), get_global_id(1));
+    const int2 imageSize = get_image_dim(inputImage);
+
+    float3 bins[GRID_BINS];
+    for (int b = 0; b < GRID_BINS; b++) {
+        bins[b] = 0;
+    }
+
+    for (int y = 0; y < cellSize; y++) {
+        for (int x = 0; x < cellSize; x++) {
+            const int2 p = cell * cellSize + (int2) (x, y);
+            if (any(p >= imageSize)) {
+                continue;
+            }
+            const float3 pixel = read_imagef(inputImage, p).xyz;
+            const float z = gridLumaPosition(pixel.x);
+            const int z0 = min((int) z, GRID_BINS - 2);
+            const float f = z - z0;
+            bins[z0] += (1 - f) * (float3) (pixel.yz, 1);
+            bins[z0 + 1] += f * (float3) (pixel.yz, 1);
+        }
+    }
+
+    for (int b = 0; b < GRID_BINS; b++) {
+        write_imagef(gridImage, gridBinOrigin(b, gridSize) + cell, (float4) (bins[b], 0));
+    }
+}
+
+// [1 2 1] blur of the grid along x (axis 0), y (axis 1) or luma (axis 2), zero padded: the weights keep track of the
+// cells outside the grid
+kernel void blurBilateralGrid(read_only image2d_t gridImage, int2 gridSize, int axis,
+                              write_only image2d_t blurredGridImage) {
+    const int2 p = (int2) (get_global_id(0), get_global_id(1));
+    const int bin = (p.y / gridSize.y) * GRID_BIN_COLUMNS + p.x / gridSize.x;
+    const int2 cell = p % gridSize;
+
+    const int position = axis == 0 ? cell.x : axis == 1 ? cell.y : bin;
+    const int extent = axis == 0 ? gridSize.x : axis == 1 ? gridSize.y : GRID_BINS;
+    const int2 previous = axis == 2 ? gridBinOrigin(bin - 1, gridSize) + cell : p - (int2) (axis == 0, axis == 1);
+    const int2 next = axis == 2 ? gridBinOrigin(bin + 1, gridSize) + cell : p + (int2) (axis == 0, axis == 1);
+
+    float4 sum = 2 * read_imagef(gridImage, p);
+    if (position > 0) {
+        sum += read_imagef(gridImage, previous);
+    }
+    if (position < extent - 1) {
+        sum += read_imagef(gridImage, next);
+    }
+    write_imagef(blurredGridImage, p, sum / 4);
+}
+
+// Trilinear interpolation of the chroma from the grid, the luma and the alpha channel are passed through. The grid
+// chroma is blended with the input's by a range weight on their difference relative to the chroma threshold of the
+// level (chromaNlf), so low noise levels are barely changed and chroma edges at equal luma are kept.
+kernel void sliceBilateralGrid(read_only image2d_t inputImage, read_only image2d_t gridImage, int cellSize,
+                               int2 gridSize, float2 chromaNlf, write_only image2d_t outputImage,
+                               sampler_t linear_sampler) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+    const float4 input = read_imagef(inputImage, imageCoordinates);
+
+    // Unnormalized coordinates in the bin slices, kept within the slice
+    const float2 gridPosition =
+        clamp((convert_float2(imageCoordinates) + 0.5f) / cellSize, 0.5f, convert_float2(gridSize) - 0.5f);
+
+    const float z = gridLumaPosition(input.x);
+    const int z0 = min((int) z, GRID_BINS - 2);
+    const float3 grid0 =
+        read_imagef(gridImage, linear_sampler, convert_float2(gridBinOrigin(z0, gridSize)) + gridPosition).xyz;
+    const float3 grid1 =
+        read_imagef(gridImage, linear_sampler, convert_float2(gridBinOrigin(z0 + 1, gridSize)) + gridPosition).xyz;
+    const float3 grid = mix(grid0, grid1, z - z0);
+
+    const float2 gridChroma = grid.z > 0 ? grid.xy / grid.z : input.yz;
+
+    const float chromaVariance = chromaNlf.x + chromaNlf.y * input.x;
+    const float2 difference = gridChroma - input.yz;
+    const float weight = chromaVariance > 0 ? exp(-dot(difference, difference) / (2 * chromaVariance)) : 0;
+
+    write_imagef(outputImage, imageCoordinates, (float4) (input.x, mix(input.yz, gridChroma, weight), input.w));
+}
+
+#undef GRID_BIN_COLUMNS
+#undef GRID_BINS
+
 typedef struct transform {
     float matrix[3][3];
 } transform;
@@ -1322,10 +1554,71 @@ kernel void downsampleImageXY(read_only image2d_t inputImage, write_only image2d
     write_imagef(outputImage, output_pos, (float4) (0.25 * outputPixel, 0, 0));
 }
 
-float3 applyTransform(float3 value, Matrix3x3 *transform) {
-    return (float3) (dot(transform->m[0], value), dot(transform->m[1], value), dot(transform->m[2], value));
+#define PYRAMID_TILE 16
+#define PYRAMID_APRON_TILE (PYRAMID_TILE + 2)
+
+// Two rounds of downsampleImageXYZ and downsampleImageXY in one dispatch, for image sizes divisible by 4. Each
+// work-group computes a PYRAMID_TILE tile of the first level, with a one pixel apron, into local memory, the second
+// level's tile is computed from there. The linear sampler reads of the downsampling kernels average a 4x4 box.
+kernel void downsampleImagePyramid2(read_only image2d_t inputImage, read_only image2d_t gradientImage,
+                                    write_only image2d_t outputImage1, write_only image2d_t outputGradient1,
+                                    write_only image2d_t outputImage2, write_only image2d_t outputGradient2) {
+    local float3 image1[PYRAMID_APRON_TILE][PYRAMID_APRON_TILE];
+    local float2 gradient1[PYRAMID_APRON_TILE][PYRAMID_APRON_TILE];
+
+    const int2 tileOrigin = (int2) (get_group_id(0), get_group_id(1)) * PYRAMID_TILE;
+    const int2 localCoordinates = (int2) (get_local_id(0), get_local_id(1));
+    const int2 inputSize = get_image_dim(inputImage);
+    const int2 size1 = get_image_dim(outputImage1);
+    const int2 size2 = get_image_dim(outputImage2);
+
+    // First level, the apron is clamped to the edges like the linear sampler
+    for (int i = localCoordinates.y * PYRAMID_TILE + localCoordinates.x; i < PYRAMID_APRON_TILE * PYRAMID_APRON_TILE;
+         i += PYRAMID_TILE * PYRAMID_TILE) {
+        const int2 t = (int2) (i % PYRAMID_APRON_TILE, i / PYRAMID_APRON_TILE);
+        const int2 p = clamp(tileOrigin + t - 1, 0, size1 - 1);
+
+        float3 pixel = 0;
+        float2 gradient = 0;
+        for (int y = -1; y <= 2; y++) {
+            for (int x = -1; x <= 2; x++) {
+                const int2 q = clamp(2 * p + (int2) (x, y), 0, inputSize - 1);
+                pixel += read_imagef(inputImage, q).xyz;
+                gradient += read_imagef(gradientImage, q).xy;
+            }
+        }
+        image1[t.y][t.x] = pixel / 16;
+        gradient1[t.y][t.x] = gradient / 16;
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int2 p1 = tileOrigin + localCoordinates;
+    if (all(p1 < size1)) {
+        write_imagef(outputImage1, p1, (float4) (image1[localCoordinates.y + 1][localCoordinates.x + 1], 0));
+        write_imagef(outputGradient1, p1, (float4) (gradient1[localCoordinates.y + 1][localCoordinates.x + 1], 0, 0));
+    }
+
+    // Second level from the first one in local memory
+    const int2 p2 = tileOrigin / 2 + localCoordinates;
+    if (all(localCoordinates < PYRAMID_TILE / 2) && all(p2 < size2)) {
+        float3 pixel = 0;
+        float2 gradient = 0;
+        for (int y = -1; y <= 2; y++) {
+            for (int x = -1; x <= 2; x++) {
+                const int2 t = 2 * localCoordinates + (int2) (x, y) + 1;
+                pixel += image1[t.y][t.x];
+                gradient += gradient1[t.y][t.x];
+            }
+        }
+        write_imagef(outputImage2, p2, (float4) (pixel / 16, 0));
+        write_imagef(outputGradient2, p2, (float4) (gradient / 16, 0, 0));
+    }
 }
 
+#undef PYRAMID_APRON_TILE
+#undef PYRAMID_TILE
+
 kernel void subtractNoiseImage(read_only image2d_t inputImage, read_only image2d_t inputImage1,
                                read_only image2d_t inputImageDenoised1, read_only image2d_t gradientImage,
                                float luma_weight, float sharpening, float2 nlf,
@@ -1517,6 +1810,166 @@ kernel void BoxFilterGFImage(read_only image2d_t inputImage, write_only image2d_
     write_imagef(outputImage, imageCoordinates, (float4)(meanAB, 0, 0));
 }
 
+/// ---- Summed Area Tables ----
+
+// Box means for the guided filter in constant time for any radius. The integral images hold two
+// statistics as float-float (hi, lo) pairs: (hi0, hi1, lo0, lo1), this avoids the precision loss of
+// float prefix sums on large images. As in SURF.cl the tables have an extra leading row and column of zeros.
+
+// Float-float addition (Knuth's TwoSum) of two pairs of accumulators
+float4 ffAdd(float4 a, float4 b) {
+    const float2 s = a.xy + b.xy;
+    const float2 bb = s - a.xy;
+    const float2 e = (a.xy - (s - bb)) + (b.xy - bb) + a.zw + b.zw;
+    const float2 hi = s + e;
+    return (float4) (hi, e - (hi - s));
+}
+
+// Work-efficient (Blelloch) scan of the tables, each work group scans a tile of SAT_SCAN_TILE entries of a row or
+// a column, then the offsets of the preceding tiles are added. Keep in sync with kSATScanGroupSize in demosaic_cl.cpp.
+#define SAT_SCAN_GROUP_SIZE 128
+#define SAT_SCAN_TILE (2 * SAT_SCAN_GROUP_SIZE)
+
+// Inclusive scan of the work group's tile in local memory, two entries per work item
+void tileInclusiveScan(local float4* tile, float4 value0, float4 value1) {
+    const int lid = get_local_id(0);
+
+    tile[lid] = value0;
+    tile[lid + SAT_SCAN_GROUP_SIZE] = value1;
+
+    // Up-sweep: partial sums in a balanced tree
+    int offset = 1;
+    for (int d = SAT_SCAN_TILE >> 1; d > 0; d >>= 1) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lid < d) {
+            const int ai = offset * (2 * lid + 1) - 1;
+            const int bi = offset * (2 * lid + 2) - 1;
+            tile[bi] = ffAdd(tile[bi], tile[ai]);
+        }
+        offset *= 2;
+    }
+
+    // Down-sweep: exclusive prefix sums from the root
+    if (lid == 0) {
+        tile[SAT_SCAN_TILE - 1] = 0;
+    }
+    for (int d = 1; d < SAT_SCAN_TILE; d *= 2) {
+        offset >>= 1;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lid < d) {
+            const int ai = offset * (2 * lid + 1) - 1;
+            const int bi = offset * (2 * lid + 2) - 1;
+            const float4 t = tile[ai];
+            tile[ai] = tile[bi];
+            tile[bi] = ffAdd(tile[bi], t);
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    tile[lid] = ffAdd(tile[lid], value0);
+    tile[lid + SAT_SCAN_GROUP_SIZE] = ffAdd(tile[lid + SAT_SCAN_GROUP_SIZE], value1);
+    barrier(CLK_LOCAL_MEM_FENCE);
+}
+
+// Statistics of a pixel of the input image. If guideStatistics is set they are (I, I^2) of the guide image luma,
+// otherwise the (a, b) coefficients of the guided filter.
+float4 integralInput(read_only image2d_t inputImage, int guideStatistics, int x, int y) {
+    // Use Signed Offset Pixel Representation to improve Integral Image precision
+    const float2 input = read_imagef(inputImage, (int2) (x, y)).xy - 0.5;
+    return (float4) (guideStatistics ? (float2) (input.x, input.x * input.x) : input, 0, 0);
+}
+
+// Tile prefix sums along the rows, entry x of a row sums the input pixels before x
+kernel void integralRowsImage(read_only image2d_t inputImage, int guideStatistics, write_only image2d_t rowSumImage) {
+    const int tileStart = get_group_id(0) * SAT_SCAN_TILE;
+    const int x0 = tileStart + get_local_id(0);
+    const int x1 = x0 + SAT_SCAN_GROUP_SIZE;
+    const int y = get_global_id(1);
+    const int width = get_image_width(inputImage);
+
+    local float4 tile[SAT_SCAN_TILE];
+    tileInclusiveScan(tile, 0 < x0 && x0 <= width ? integralInput(inputImage, guideStatistics, x0 - 1, y) : (float4) 0,
+                      x1 <= width ? integralInput(inputImage, guideStatistics, x1 - 1, y) : (float4) 0);
+
+    if (x0 <= width) {
+        write_imagef(rowSumImage, (int2) (x0, y), tile[x0 - tileStart]);
+    }
+    if (x1 <= width) {
+        write_imagef(rowSumImage, (int2) (x1, y), tile[x1 - tileStart]);
+    }
+}
+
+// Tile prefix sums along the columns of the row sums, entry y of a column sums the rows before y
+kernel void integralColumnsImage(read_only image2d_t rowSumImage, int height, write_only image2d_t sumImage) {
+    const int tileStart = get_group_id(0) * SAT_SCAN_TILE;
+    const int y0 = tileStart + get_local_id(0);
+    const int y1 = y0 + SAT_SCAN_GROUP_SIZE;
+    const int x = get_global_id(1);
+
+    local float4 tile[SAT_SCAN_TILE];
+    tileInclusiveScan(tile, 0 < y0 && y0 <= height ? read_imagef(rowSumImage, (int2) (x, y0 - 1)) : (float4) 0,
+                      y1 <= height ? read_imagef(rowSumImage, (int2) (x, y1 - 1)) : (float4) 0);
+
+    if (y0 <= height) {
+        write_imagef(sumImage, (int2) (x, y0), tile[y0 - tileStart]);
+    }
+    if (y1 <= height) {
+        write_imagef(sumImage, (int2) (x, y1), tile[y1 - tileStart]);
+    }
+}
+
+// Add the totals of the preceding tiles to the tile prefix sums, along the rows or along the columns
+kernel void integralTileOffsetsImage(read_only image2d_t tileSumImage, int columns, write_only image2d_t sumImage) {
+    // Coordinates along and across the scan direction
+    const int i = get_global_id(0);
+    const int j = get_global_id(1);
+    const int2 imageCoordinates = columns ? (int2) (j, i) : (int2) (i, j);
+
+    float4 accum = read_imagef(tileSumImage, imageCoordinates);
+    for (int tileEnd = SAT_SCAN_TILE - 1; tileEnd < i; tileEnd += SAT_SCAN_TILE) {
+        accum = ffAdd(accum, read_imagef(tileSumImage, columns ? (int2) (j, tileEnd) : (int2) (tileEnd, j)));
+    }
+    write_imagef(sumImage, imageCoordinates, accum);
+}
+
+// Box mean of the integral image statistics, the box is clipped at the image boundaries and the mean taken over the
+// pixels inside. Unlike the radius 2 kernels, which replicate the edge pixels through the clamping sampler, the
+// border pixels aren't weighted more than the others, the two only differ within radius of the image edges.
+float2 boxMeanSAT(read_only image2d_t sumImage, int2 imageCoordinates, int radius, int2 imageDim) {
+    const int2 p0 = max(imageCoordinates - radius, 0);
+    const int2 p1 = min(imageCoordinates + radius + 1, imageDim);
+
+    const float4 s00 = read_imagef(sumImage, p0);
+    const float4 s10 = read_imagef(sumImage, (int2) (p1.x, p0.y));
+    const float4 s01 = read_imagef(sumImage, (int2) (p0.x, p1.y));
+    const float4 s11 = read_imagef(sumImage, p1);
+
+    const float2 sum = ((s11.xy - s01.xy) - (s10.xy - s00.xy)) + ((s11.zw - s01.zw) - (s10.zw - s00.zw));
+    return sum / (float) ((p1.x - p0.x) * (p1.y - p0.y));
+}
+
+kernel void GuidedFilterABImageSAT(read_only image2d_t sumImage, write_only image2d_t abImage, float eps, int radius) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    // Statistics of the offset guide (I - 0.5), the variance is invariant to the offset
+    const float2 moments = boxMeanSAT(sumImage, imageCoordinates, radius, get_image_dim(abImage));
+    float mean = moments.x + 0.5;
+    float var = max(moments.y - moments.x * moments.x, 0);
+
+    float a = var / (var + eps);
+    float b = mean * (1 - a);
+
+    write_imagef(abImage, imageCoordinates, (float4)(a, b, 0, 0));
+}
+
+kernel void BoxFilterGFImageSAT(read_only image2d_t sumImage, write_only image2d_t outputImage, int radius) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    float2 meanAB = boxMeanSAT(sumImage, imageCoordinates, radius, get_image_dim(outputImage)) + 0.5;
+
+    write_imagef(outputImage, imageCoordinates, (float4)(meanAB, 0, 0));
+}
+
 float computeLtmMultiplier(float3 input, float2 gfAb, float eps, float shadows,
                            float highlights, float detail, Matrix3x3 *ycbcr_srgb) {
     // YCbCr -> RGB version of the input pixel, for highlights compression, ensure definite positiveness
@@ -1536,11 +1989,14 @@ float computeLtmMultiplier(float3 input, float2 gfAb, float eps, float shadows,
     return pow(illuminance, gamma) * pow(reflectance, detail) / input.x;
 }
 
+// Make sure this struct is in sync with the declaration in demosaic.hpp
 typedef struct LTMParameters {
     float eps;
     float shadows;
     float highlights;
     float detail[3];
+    int maskScale;
+    int guidedFilterRadius;
 } LTMParameters;
 
 kernel void localToneMappingMaskImage(read_only image2d_t inputImage,
@@ -1980,14 +2436,16 @@ float blueNoiseGenerator(read_only image2d_t blueNoiseImage, int2 imageCoordinat
 }
 
 
+// origin is the position of the image in the full frame, crops of it get the grain of the full render
 kernel void blueNoiseImage(read_only image2d_t inputImage,
                            read_only image2d_t blueNoiseImage,
                            float2 lumaVariance,
+                           int2 origin,
                            write_only image2d_t outputImage,
                            sampler_t linear_sampler) {
     const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
 
-    float blueNoise = blueNoiseGenerator(blueNoiseImage, imageCoordinates, linear_sampler);
+    float blueNoise = blueNoiseGenerator(blueNoiseImage, imageCoordinates + origin, linear_sampler);
 
     float3 pixel = read_imagef(inputImage, imageCoordinates).xyz;
 
@@ -2121,48 +2579,156 @@ typedef struct RGBConversionParameters {
     int localToneMapping;
 } RGBConversionParameters;
 
-kernel void convertTosRGB(read_only image2d_t linearImage, read_only image2d_t ltmMaskImage, write_only image2d_t rgbImage,
-                          Matrix3x3 transform, RGBConversionParameters parameters) {
-    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+// Joint bilateral upsampling of a reduced resolution LTM mask, the range weights come
+// from the luma of the mask's own input image (ltmGuideImage) against the full resolution luma
+float upsampleLtmMask(read_only image2d_t ltmMaskImage, read_only image2d_t ltmGuideImage,
+                      int2 imageCoordinates, float2 maskScale, float luma) {
+    const int2 maskDim = get_image_dim(ltmMaskImage);
+    const float2 pos = (convert_float2(imageCoordinates) + 0.5) * maskScale - 0.5;
+    const float2 base = floor(pos);
+    const float2 f = pos - base;
+
+    // Range differences are measured in perceptual (square root) space
+    const float sigma = 0.05;
+    const float sqrtLuma = sqrt(max(luma, 0));
+
+    float mask = 0;
+    float weight = 0;
+    for (int y = 0; y <= 1; y++) {
+        for (int x = 0; x <= 1; x++) {
+            const int2 coords = clamp(convert_int2(base) + (int2) (x, y), (int2) 0, maskDim - 1);
+            const float guideLuma = read_imagef(ltmGuideImage, coords).x;
+            const float diff = sqrt(max(guideLuma, 0)) - sqrtLuma;
+
+            const float spatialWeight = (x ? f.x : 1 - f.x) * (y ? f.y : 1 - f.y);
+            const float rangeWeight = max(exp(-diff * diff / (2 * sigma * sigma)), 1e-3);
+
+            mask += spatialWeight * rangeWeight * read_imagef(ltmMaskImage, coords).x;
+            weight += spatialWeight * rangeWeight;
+        }
+    }
+    return mask / weight;
+}
 
-    float3 pixel_value = read_imagef(linearImage, imageCoordinates).xyz;
+float ltmMaskValue(read_only image2d_t ltmMaskImage, read_only image2d_t ltmGuideImage,
+                   int2 imageCoordinates, int2 outputDim, float luma) {
+    const int2 maskDim = get_image_dim(ltmMaskImage);
+    if (maskDim.x == outputDim.x && maskDim.y == outputDim.y) {
+        return read_imagef(ltmMaskImage, imageCoordinates).x;
+    }
+    const float2 maskScale = convert_float2(maskDim) / convert_float2(outputDim);
+    return upsampleLtmMask(ltmMaskImage, ltmGuideImage, imageCoordinates, maskScale, luma);
+}
 
+// Color grading and local tone mapping, everything in convertTosRGBToneCurveLut that comes before the tone curve
+float3 gradeLinearPixel(float3 pixel_value, float ltmBoost, const Matrix3x3* transform,
+                        const RGBConversionParameters* parameters) {
     // Exposure Bias
-    pixel_value *= parameters.exposureBias != 0 ? powr(2.0, parameters.exposureBias) : 1;
+    pixel_value *= parameters->exposureBias != 0 ? powr(2.0, parameters->exposureBias) : 1;
 
     // Saturation
-    pixel_value = parameters.saturation != 1.0 ? saturationBoost(pixel_value, parameters.saturation) : pixel_value;
+    pixel_value = parameters->saturation != 1.0 ? saturationBoost(pixel_value, parameters->saturation) : pixel_value;
 
     // Contrast
-    pixel_value = parameters.contrast != 1.0 ? contrastBoost(pixel_value, parameters.contrast) : pixel_value;
+    pixel_value = parameters->contrast != 1.0 ? contrastBoost(pixel_value, parameters->contrast) : pixel_value;
 
     // Conversion to target color space, ensure definite positiveness
-    float3 rgb = max((float3) (dot(transform.m[0], pixel_value),
-                               dot(transform.m[1], pixel_value),
-                               dot(transform.m[2], pixel_value)), 0);
+    float3 rgb = max((float3) (dot(transform->m[0], pixel_value),
+                               dot(transform->m[1], pixel_value),
+                               dot(transform->m[2], pixel_value)), 0);
 
     // Local Tone Mapping
-    if (parameters.localToneMapping) {
-        float ltmBoost = read_imagef(ltmMaskImage, imageCoordinates).x;
-
-        if (ltmBoost > 1) {
-            // Modified Naik and Murthy’s method for preserving hue/saturation under luminance changes
-            const float luma = 0.2126 * rgb.x + 0.7152 * rgb.y + 0.0722 * rgb.z; // BT.709-2 (sRGB) luma primaries
-            rgb = mix(rgb * ltmBoost, luma < 1 ? 1 - (1.0 - rgb) * (1 - ltmBoost * luma) / (1 - luma) : rgb, min(2 * pow(luma, 0.5), 1));
-        } else if (ltmBoost < 1) {
-            rgb *= ltmBoost;
-        }
+    if (ltmBoost > 1) {
+        // Modified Naik and Murthy’s method for preserving hue/saturation under luminance changes
+        const float luma = 0.2126 * rgb.x + 0.7152 * rgb.y + 0.0722 * rgb.z; // BT.709-2 (sRGB) luma primaries
+        rgb = mix(rgb * ltmBoost, luma < 1 ? 1 - (1.0 - rgb) * (1 - ltmBoost * luma) / (1 - luma) : rgb, min(2 * pow(luma, 0.5), 1));
+    } else if (ltmBoost < 1) {
+        rgb *= ltmBoost;
     }
+    return rgb;
+}
+
+/// ---- Tone Curve LUT ----
+
+// The LUT is indexed by t = sqrt(0.95 * x), the argument of the sigmoid in toneCurve,
+// which spreads the entries over the shadows. Values with t > 1 map to white anyway.
+
+kernel void bakeToneCurveLut(write_only image2d_t toneCurveLut, RGBConversionParameters parameters) {
+    const int x = get_global_id(0);
+    const float t = x / (float) (get_image_width(toneCurveLut) - 1);
 
-    // Tone Curve
-    rgb = toneCurve(max(rgb, 0), parameters.toneCurveSlope);
+    float value = toneCurve(t * t / 0.95, parameters.toneCurveSlope);
 
     // Black Level Adjustment
     if (parameters.blacks > 0) {
-        rgb = (rgb - parameters.blacks) / (1 - parameters.blacks);
+        value = (value - parameters.blacks) / (1 - parameters.blacks);
     }
 
-    write_imagef(rgbImage, imageCoordinates, (float4) (clamp(rgb, 0.0, 1.0), 0.0));
+    write_imagef(toneCurveLut, (int2) (x, 0), clamp(value, 0.0, 1.0));
+}
+
+float3 sampleToneCurveLut(float3 x, read_only image2d_t toneCurveLut, sampler_t linear_sampler) {
+    const float lutSize = get_image_width(toneCurveLut);
+    const float3 t = min(sqrt(0.95 * max(x, 0)), 1);
+    const float3 u = (t * (lutSize - 1) + 0.5) / lutSize;
+
+    return (float3) (read_imagef(toneCurveLut, linear_sampler, (float2) (u.x, 0.5)).x,
+                     read_imagef(toneCurveLut, linear_sampler, (float2) (u.y, 0.5)).x,
+                     read_imagef(toneCurveLut, linear_sampler, (float2) (u.z, 0.5)).x);
+}
+
+// inputTransform converts linearImage to camera RGB, the identity or the conversion from the denoised YCbCr
+kernel void convertTosRGBToneCurveLut(read_only image2d_t linearImage, read_only image2d_t ltmMaskImage,
+                                      read_only image2d_t ltmGuideImage, read_only image2d_t toneCurveLut,
+                                      write_only image2d_t rgbImage, Matrix3x3 inputTransform, Matrix3x3 transform,
+                                      float3 lumaTransform, RGBConversionParameters parameters,
+                                      sampler_t linear_sampler) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    float3 pixel_value = applyTransform(read_imagef(linearImage, imageCoordinates).xyz, &inputTransform);
+
+    float ltmBoost = parameters.localToneMapping
+                        ? ltmMaskValue(ltmMaskImage, ltmGuideImage, imageCoordinates, get_image_dim(rgbImage),
+                                       dot(lumaTransform, pixel_value))
+                        : 1;
+
+    float3 rgb = gradeLinearPixel(pixel_value, ltmBoost, &transform, &parameters);
+
+    // Tone Curve and Black Level Adjustment, baked in the LUT
+    rgb = sampleToneCurveLut(rgb, toneCurveLut, linear_sampler);
+
+    write_imagef(rgbImage, imageCoordinates, (float4) (rgb, 0.0));
+}
+
+/// ---- Output Packing ----
+
+// 4x4 Bayer ordered dithering thresholds, in [-0.5, 0.5)
+constant float ditherMatrix4x4[4][4] = {
+    { -0.46875,  0.03125, -0.34375,  0.15625 },
+    {  0.28125, -0.21875,  0.40625, -0.09375 },
+    { -0.28125,  0.21875, -0.40625,  0.09375 },
+    {  0.46875, -0.03125,  0.34375, -0.15625 },
+};
+
+float3 quantize(float3 value, float maxValue, int dither, int2 imageCoordinates) {
+    const float threshold = dither ? ditherMatrix4x4[imageCoordinates.y & 3][imageCoordinates.x & 3] : 0;
+    return clamp(floor(value * maxValue + 0.5 + threshold), 0, maxValue);
+}
+
+// Interleaved 8-bit RGB, stride is in pixels
+kernel void packRGB8Image(read_only image2d_t rgbImage, int dither, int stride, global uchar* output) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    const float3 value = quantize(read_imagef(rgbImage, imageCoordinates).xyz, 255, dither, imageCoordinates);
+    vstore3(convert_uchar3(value), imageCoordinates.x, output + 3 * imageCoordinates.y * stride);
+}
+
+// Interleaved 16-bit RGB, stride is in pixels
+kernel void packRGB16Image(read_only image2d_t rgbImage, int dither, int stride, global ushort* output) {
+    const int2 imageCoordinates = (int2) (get_global_id(0), get_global_id(1));
+
+    const float3 value = quantize(read_imagef(rgbImage, imageCoordinates).xyz, 65535, dither, imageCoordinates);
+    vstore3(convert_ushort3(value), imageCoordinates.x, output + 3 * imageCoordinates.y * stride);
 }
 
 kernel void convertToGrayscale(read_only image2d_t linearImage, write_only image2d_t grayscaleImage, float3 transform) {
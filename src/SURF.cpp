@@ -21,6 +21,7 @@
 
 #include "SURF.hpp"
 #include "ThreadPool.hpp"
+#include "command_queue.hpp"
 #include "feature2d.hpp"
 #include "gls_cl_image.hpp"
 #include "gls_logging.h"
@@ -774,6 +775,7 @@ void SURFFind(const gls::image<float>& sum, const std::vector<gls::image<float>:
 class SURF_OpenCL : public SURF {
    private:
     gls::OpenCLContext* _glsContext;
+    cl::CommandQueue _commandQueue;
 
     const int _width;
     const int _height;
@@ -828,6 +830,7 @@ class SURF_OpenCL : public SURF {
 
     void detect(const std::array<gls::cl_image_2d<float>::unique_ptr, 4>& integralSum,
                 std::vector<KeyPoint>* keypoints) override {
+        CommandQueueScope commandQueueScope(&_commandQueue);
         fastHessianDetector(integralSum, keypoints, _nOctaves, _nOctaveLayers, _hessianThreshold);
     }
 
@@ -852,6 +855,7 @@ std::unique_ptr<SURF> SURF::makeInstance(gls::OpenCLContext* glsContext, int wid
 SURF_OpenCL::SURF_OpenCL(gls::OpenCLContext* glsContext, int width, int height, int max_features, int nOctaves,
                          int nOctaveLayers, float hessianThreshold)
     : _glsContext(glsContext),
+      _commandQueue(glsContext->clContext()),
       _width(width),
       _height(height),
       _max_features(max_features),
@@ -886,6 +890,8 @@ SURF_OpenCL::SURF_OpenCL(gls::OpenCLContext* glsContext, int width, int height,
 
 void SURF_OpenCL::integral(const gls::image<float>& img,
                            const std::array<gls::cl_image_2d<float>::unique_ptr, 4>& sum) {
+    CommandQueueScope commandQueueScope(&_commandQueue);
+
     static const int tileSize = 8;
 
     gls::size tmpSize(((_height + tileSize - 1) / tileSize) * tileSize,
@@ -897,7 +903,8 @@ void SURF_OpenCL::integral(const gls::image<float>& img,
         _integralInputImage =
             std::make_unique<gls::cl_image_buffer_2d<float>>(_glsContext->clContext(), img.width, img.height);
     }
-    _integralInputImage->copyPixelsFrom(img);
+    // Upload on the queue of the integral kernels, the default queue isn't ordered with it
+    copyPixelsFrom(&_commandQueue, img, _integralInputImage.get());
 
     // Load the shader source
     const auto program = _glsContext->loadProgram("SURF");
@@ -909,7 +916,7 @@ void SURF_OpenCL::integral(const gls::image<float>& img,
                                                >(program, "integral_sum_cols_image");
 
     // Schedule the kernel on the GPU
-    integral_sum_cols(cl::EnqueueArgs(cl::NDRange(_width), cl::NDRange(tileSize)), _integralInputImage->getImage2D(),
+    integral_sum_cols(buildEnqueueArgs(cl::NDRange(_width), cl::NDRange(tileSize)), _integralInputImage->getImage2D(),
                       _integralTmpBuffer, tmpSize.width);
 
     // Bind the kernel parameters
@@ -922,7 +929,7 @@ void SURF_OpenCL::integral(const gls::image<float>& img,
                                                >(program, "integral_sum_rows_image");
 
     // Schedule the kernel on the GPU
-    integral_sum_rows(cl::EnqueueArgs(cl::NDRange(_height), cl::NDRange(tileSize)), _integralTmpBuffer, tmpSize.width,
+    integral_sum_rows(buildEnqueueArgs(cl::NDRange(_height), cl::NDRange(tileSize)), _integralTmpBuffer, tmpSize.width,
                       sum[0]->getImage2D(), sum[1]->getImage2D(), sum[2]->getImage2D(), sum[3]->getImage2D());
 }
 
@@ -947,16 +954,16 @@ void SURF_OpenCL::calcDetAndTrace(const gls::cl_image_2d<float>& sumImage, gls::
     if (_surfHFDataBuffer.get() == 0) {
         _surfHFDataBuffer = cl::Buffer(CL_MEM_READ_ONLY, sizeof(clSurfHF));
     }
-    cl::enqueueWriteBuffer(_surfHFDataBuffer, false, 0, sizeof(clSurfHF), &surfHFData);
+    currentCommandQueue().enqueueWriteBuffer(_surfHFDataBuffer, false, 0, sizeof(clSurfHF), &surfHFData);
 
     const auto& margin_crop = haarPattern.margin_crop;
 
     // Schedule the kernel on the GPU
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(margin_crop.width, margin_crop.height),
+        buildEnqueueArgs(margin_crop.width, margin_crop.height),
 #else
-        cl::EnqueueArgs(cl::NDRange(margin_crop.width, margin_crop.height), cl::NDRange(32, 32)),
+        buildEnqueueArgs(cl::NDRange(margin_crop.width, margin_crop.height), cl::NDRange(32, 32)),
 #endif
         sumImage.getImage2D(), detImage->getImage2D(), traceImage->getImage2D(), sampleStep,
         {haarPattern.Dx[0].w, haarPattern.Dxy[0].w}, {margin_crop.x, margin_crop.y}, _surfHFDataBuffer);
@@ -987,14 +994,14 @@ void SURF_OpenCL::calcDetAndTrace(const gls::cl_image_2d<float>& sumImage,
     if (_surfHFDataBuffer.get() == 0) {
         _surfHFDataBuffer = cl::Buffer(CL_MEM_READ_ONLY, sizeof(surfHFData));
     }
-    cl::enqueueWriteBuffer(_surfHFDataBuffer, false, 0, sizeof(surfHFData), &surfHFData);
+    currentCommandQueue().enqueueWriteBuffer(_surfHFDataBuffer, false, 0, sizeof(surfHFData), &surfHFData);
 
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(haarPattern[0].margin_crop.width, haarPattern[0].margin_crop.height),
+        buildEnqueueArgs(haarPattern[0].margin_crop.width, haarPattern[0].margin_crop.height),
 #else
-        cl::EnqueueArgs(cl::NDRange(haarPattern[0].margin_crop.width, haarPattern[0].margin_crop.height),
-                        cl::NDRange(32, 32)),
+        buildEnqueueArgs(cl::NDRange(haarPattern[0].margin_crop.width, haarPattern[0].margin_crop.height),
+                         cl::NDRange(32, 32)),
 #endif
         sumImage.getImage2D(), detImage[0]->getImage2D(), detImage[1]->getImage2D(), detImage[2]->getImage2D(),
         detImage[3]->getImage2D(), traceImage[0]->getImage2D(), traceImage[1]->getImage2D(),
@@ -1116,9 +1123,9 @@ void SURF_OpenCL::findMaximaInLayer(const std::array<const gls::cl_image_2d<floa
     // Schedule the kernel on the GPU
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(layer_width - 2 * margin, layer_height - 2 * margin),
+        buildEnqueueArgs(layer_width - 2 * margin, layer_height - 2 * margin),
 #else
-        cl::EnqueueArgs(cl::NDRange(layer_width - 2 * margin, layer_height - 2 * margin), cl::NDRange(32, 32)),
+        buildEnqueueArgs(cl::NDRange(layer_width - 2 * margin, layer_height - 2 * margin), cl::NDRange(32, 32)),
 #endif
         dets[0]->getImage2D(), dets[1]->getImage2D(), dets[2]->getImage2D(), traceImage.getImage2D(),
         {sizes[0], sizes[1], sizes[2]}, _keyPointsBuffer, margin, octave, hessianThreshold, sampleStep);
@@ -1144,7 +1151,7 @@ void SURF_OpenCL::Find(const std::vector<gls::cl_image_2d<float>::unique_ptr>& d
     }
 
     // Collect results
-    const auto keyPointMaxima = (KeyPointMaxima*)cl::enqueueMapBuffer(
+    const auto keyPointMaxima = (KeyPointMaxima*)currentCommandQueue().enqueueMapBuffer(
         _keyPointsBuffer, true, CL_MAP_READ | CL_MAP_WRITE, 0, sizeof(KeyPointMaxima));
 
     LOG_INFO(TAG) << "keyPointMaxima: " << keyPointMaxima->count << std::endl;
@@ -1155,7 +1162,7 @@ void SURF_OpenCL::Find(const std::vector<gls::cl_image_2d<float>::unique_ptr>& d
     // Reset count
     keyPointMaxima->count = 0;
 
-    cl::enqueueUnmapMemObject(_keyPointsBuffer, (void*)keyPointMaxima);
+    currentCommandQueue().enqueueUnmapMemObject(_keyPointsBuffer, (void*)keyPointMaxima);
 }
 
 struct KeypointGreater {
@@ -1321,6 +1328,8 @@ static void mergeKeypoints(const std::vector<std::unique_ptr<std::vector<KeyPoin
 
 void SURF_OpenCL::detectAndCompute(const gls::image<float>& img, std::vector<KeyPoint>* keypoints,
                                    gls::image<float>::unique_ptr* descriptors, gls::size sections) {
+    CommandQueueScope commandQueueScope(&_commandQueue);
+
     std::vector<gls::rectangle> tiles(sections.width * sections.height);
 
     const int tile_width = img.width / sections.width;
@@ -1368,6 +1377,8 @@ void SURF_OpenCL::detectAndCompute(const gls::image<float>& img, std::vector<Key
 
         auto t_start_descriptor = std::chrono::high_resolution_clock::now();
 
+        // The map goes through the default queue, the integral must be complete on _commandQueue
+        _commandQueue.finish();
         const auto integralSumCpu = sum[0]->mapImage(CL_MAP_READ);
 
         // we call SURFInvoker in any case, even if we do not need descriptors,
@@ -1433,9 +1444,9 @@ template <typename T>
 cl::Buffer bufferFromImage(const gls::image<T>& source) {
     int bufferSize = source.stride * source.height * sizeof(float);
     auto buffer = cl::Buffer(CL_MEM_READ_WRITE, bufferSize);
-    const auto bufferPtr = (float*)cl::enqueueMapBuffer(buffer, true, CL_MAP_WRITE, 0, bufferSize);
+    const auto bufferPtr = (float*)currentCommandQueue().enqueueMapBuffer(buffer, true, CL_MAP_WRITE, 0, bufferSize);
     memcpy(bufferPtr, source.pixels().data(), bufferSize);
-    cl::enqueueUnmapMemObject(buffer, (void*)bufferPtr);
+    currentCommandQueue().enqueueUnmapMemObject(buffer, (void*)bufferPtr);
     return buffer;
 }
 
@@ -1455,6 +1466,8 @@ struct refineMatch {
 
 std::vector<DMatch> SURF_OpenCL::matchKeyPoints(const gls::image<float>& descriptor1,
                                                 const gls::image<float>& descriptor2) {
+    CommandQueueScope commandQueueScope(&_commandQueue);
+
     auto descriptor1Buffer = bufferFromImage(descriptor1);
     auto descriptor2Buffer = bufferFromImage(descriptor2);
 
@@ -1473,18 +1486,18 @@ std::vector<DMatch> SURF_OpenCL::matchKeyPoints(const gls::image<float>& descrip
                                     >(program, "matchKeyPoints");
 
     int groups = 24;
-    kernel(cl::EnqueueArgs(cl::NDRange(descriptor1.height, groups), cl::NDRange(1, groups)), descriptor1Buffer,
+    kernel(buildEnqueueArgs(cl::NDRange(descriptor1.height, groups), cl::NDRange(1, groups)), descriptor1Buffer,
            descriptor1.stride, descriptor2Buffer, descriptor2.stride, descriptor2.height, matchesBuffer);
 
     // Collect results
-    const auto matches =
-        (DMatch*)cl::enqueueMapBuffer(matchesBuffer, true, CL_MAP_READ, 0, sizeof(DMatch) * descriptor1.height);
+    const auto matches = (DMatch*)currentCommandQueue().enqueueMapBuffer(matchesBuffer, true, CL_MAP_READ, 0,
+                                                                         sizeof(DMatch) * descriptor1.height);
 
     // Build result vector
     std::span<DMatch> newElements(matches, descriptor1.height);
     std::vector<DMatch> matchedPoints(begin(newElements), end(newElements));
 
-    cl::enqueueUnmapMemObject(matchesBuffer, (void*)matches);
+    currentCommandQueue().enqueueUnmapMemObject(matchesBuffer, (void*)matches);
 
     std::sort(matchedPoints.begin(), matchedPoints.end(), refineMatch());  // feature point sorting
 
@@ -1556,9 +1569,9 @@ void clRegisterAndFuse(gls::OpenCLContext* cLContext, const gls::cl_image_2d<gls
 
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(inputImage0.width, inputImage0.height),
+        buildEnqueueArgs(inputImage0.width, inputImage0.height),
 #else
-        cl::EnqueueArgs(cl::NDRange(inputImage0.width, inputImage0.height), cl::NDRange(32, 32)),
+        buildEnqueueArgs(cl::NDRange(inputImage0.width, inputImage0.height), cl::NDRange(32, 32)),
 #endif
         inputImage0.getImage2D(), inputImage1.getImage2D(), outputImage->getImage2D(), homography, linear_sampler);
 }
@@ -1580,9 +1593,9 @@ void clRegisterImage(gls::OpenCLContext* cLContext, const gls::cl_image_2d<T>& i
 
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(inputImage.width, inputImage.height),
+        buildEnqueueArgs(inputImage.width, inputImage.height),
 #else
-        cl::EnqueueArgs(cl::NDRange(inputImage.width, inputImage.height), cl::NDRange(32, 32)),
+        buildEnqueueArgs(cl::NDRange(inputImage.width, inputImage.height), cl::NDRange(32, 32)),
 #endif
         inputImage.getImage2D(), outputImage->getImage2D(), homography, linear_sampler);
 }
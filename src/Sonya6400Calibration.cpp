@@ -203,7 +203,7 @@ typename gls::image<T>::unique_ptr demosaicSonya6400RawImage(RawConverter* rawCo
     //    demosaicedImage->width, demosaicedImage->height * 1.2); clRescaleImage(rawConverter->getContext(),
     //    *demosaicedImage, &unsquishedImage);
 
-    return RawConverter::convertToRGBImage<T>(*demosaicedImage);
+    return rawConverter->convertToRGBImage<T>(*demosaicedImage);
 }
 
 template typename gls::image<gls::rgb_pixel>::unique_ptr demosaicSonya6400RawImage<gls::rgb_pixel>(
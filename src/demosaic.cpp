@@ -32,7 +32,7 @@ gls::image<gls::rgb_pixel>::unique_ptr runPipeline(const gls::image<gls::luma_pi
 
     auto clsRGBImage = rawConverter->runPipeline(rawImage, demosaicParameters, calibrateFromImage);
 
-    auto rgbImage = RawConverter::convertToRGBImage(*clsRGBImage);
+    auto rgbImage = rawConverter->convertToRGBImage(*clsRGBImage);
 
     auto t_end = std::chrono::high_resolution_clock::now();
     double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
@@ -53,7 +53,7 @@ gls::image<gls::rgb_pixel>::unique_ptr runFastPipeline(const gls::image<gls::lum
 
     auto clsRGBImage = rawConverter->runFastPipeline(rawImage, demosaicParameters);
 
-    auto rgbImage = RawConverter::convertToRGBImage(*clsRGBImage);
+    auto rgbImage = rawConverter->convertToRGBImage(*clsRGBImage);
 
     auto t_end = std::chrono::high_resolution_clock::now();
     double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
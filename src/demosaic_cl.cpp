@@ -19,6 +19,7 @@
 #include <iomanip>
 
 #include "RTL/RTL.hpp"
+#include "command_queue.hpp"
 #include "demosaic.hpp"
 #include "gls_cl.hpp"
 #include "gls_cl_image.hpp"
@@ -48,11 +49,38 @@ void scaleRawData(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::lu
                                     >(program, "scaleRawData");
 
     // Work on one Quad (2x2) at a time
-    kernel(gls::OpenCLContext::buildEnqueueArgs(scaledRawImage->width / 2, scaledRawImage->height / 2),
+    kernel(buildEnqueueArgs(scaledRawImage->width / 2, scaledRawImage->height / 2),
            rawImage.getImage2D(), scaledRawImage->getImage2D(), bayerPattern,
            {scaleMul[0], scaleMul[1], scaleMul[2], scaleMul[3]}, blackLevel);
 }
 
+void scaleRawData(gls::OpenCLContext* glsContext, const cl::Buffer& packedRawBuffer, const PackedRawImage& packedRaw,
+                  gls::cl_image_2d<gls::luma_pixel_float>* scaledRawImage, BayerPattern bayerPattern,
+                  gls::Vector<4> scaleMul, float blackLevel) {
+    assert(packedRaw.width == scaledRawImage->width && packedRaw.height == scaledRawImage->height);
+    assert(packedRaw.bitsPerSample >= 8 && packedRaw.bitsPerSample <= 16);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Buffer,   // packedRawData
+                                    int,          // rowStride
+                                    int,          // bitsPerSample
+                                    int,          // msbFirst
+                                    cl::Image2D,  // scaledRawImage
+                                    int,          // bayerPattern
+                                    cl_float4,    // scaleMul
+                                    float         // blackLevel
+                                    >(program, "scaleRawDataPacked");
+
+    // Work on one Quad (2x2) at a time
+    kernel(buildEnqueueArgs(scaledRawImage->width / 2, scaledRawImage->height / 2),
+           packedRawBuffer, packedRaw.rowStride, packedRaw.bitsPerSample, packedRaw.msbFirst,
+           scaledRawImage->getImage2D(), bayerPattern, {scaleMul[0], scaleMul[1], scaleMul[2], scaleMul[3]},
+           blackLevel);
+}
+
 void rawImageGradient(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
                       gls::cl_image_2d<gls::luma_alpha_pixel_float>* gradientImage) {
     // Load the shader source
@@ -64,7 +92,7 @@ void rawImageGradient(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls
                                     >(program, "rawImageGradient");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(gradientImage->width, gradientImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(gradientImage->width, gradientImage->height), rawImage.getImage2D(),
            gradientImage->getImage2D());
 }
 
@@ -79,7 +107,7 @@ void rawImageSobel(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::l
                                     >(program, "rawImageSobel");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(gradientImage->width, gradientImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(gradientImage->width, gradientImage->height), rawImage.getImage2D(),
            gradientImage->getImage2D());
 }
 
@@ -99,7 +127,7 @@ void interpolateGreen(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls
                                     >(program, "interpolateGreen");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(greenImage->width, greenImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(greenImage->width, greenImage->height), rawImage.getImage2D(),
            gradientImage.getImage2D(), greenImage->getImage2D(), bayerPattern, {greenVariance[0], greenVariance[1]});
 }
 
@@ -122,7 +150,7 @@ void interpolateRedBlue(gls::OpenCLContext* glsContext, const gls::cl_image_2d<g
                                     >(program, "interpolateRedBlue");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImage->width / 2, rgbImage->height / 2), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbImage->width / 2, rgbImage->height / 2), rawImage.getImage2D(),
            greenImage.getImage2D(), gradientImage.getImage2D(), rgbImage->getImage2D(), bayerPattern,
            {redVariance[0], redVariance[1]}, {blueVariance[0], blueVariance[1]});
 }
@@ -145,7 +173,7 @@ void interpolateRedBlueAtGreen(gls::OpenCLContext* glsContext,
                                     >(program, "interpolateRedBlueAtGreen");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImageOut->width / 2, rgbImageOut->height / 2),
+    kernel(buildEnqueueArgs(rgbImageOut->width / 2, rgbImageOut->height / 2),
            rgbImageIn.getImage2D(), gradientImage.getImage2D(), rgbImageOut->getImage2D(), bayerPattern,
            {redVariance[0], redVariance[1]}, {blueVariance[0], blueVariance[1]});
 }
@@ -168,7 +196,7 @@ void malvar(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pix
                                     >(program, "malvar");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImage->width, rgbImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbImage->width, rgbImage->height), rawImage.getImage2D(),
            gradientImage.getImage2D(), rgbImage->getImage2D(), bayerPattern, {redVariance[0], redVariance[1]},
            {greenVariance[0], greenVariance[1]}, {blueVariance[0], blueVariance[1]});
 }
@@ -187,10 +215,31 @@ void fasteDebayer(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::lu
                                     >(program, "fastDebayer");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImage->width, rgbImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbImage->width, rgbImage->height), rawImage.getImage2D(),
            rgbImage->getImage2D(), bayerPattern);
 }
 
+void binBayerQuads(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
+                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage,
+                   gls::cl_image_2d<gls::luma_pixel_float>* greenImage, BayerPattern bayerPattern) {
+    assert(rawImage.width == 2 * rgbImage->width && rawImage.height == 2 * rgbImage->height);
+    assert(greenImage->width == rgbImage->width && greenImage->height == rgbImage->height);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Image2D,  // rawImage
+                                    cl::Image2D,  // rgbImage
+                                    cl::Image2D,  // greenImage
+                                    int           // bayerPattern
+                                    >(program, "binBayerQuads");
+
+    // Schedule the kernel on the GPU
+    kernel(buildEnqueueArgs(rgbImage->width, rgbImage->height), rawImage.getImage2D(),
+           rgbImage->getImage2D(), greenImage->getImage2D(), bayerPattern);
+}
+
 void YCbCrNoiseStatistics(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                           const gls::cl_image_2d<gls::luma_alpha_pixel_float>& sobelImage,
                           gls::cl_image_2d<gls::rgba_pixel_float>* statsImage) {
@@ -204,7 +253,7 @@ void YCbCrNoiseStatistics(gls::OpenCLContext* glsContext, const gls::cl_image_2d
                                     >(program, "YCbCrNoiseStatistics");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(statsImage->width, statsImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(statsImage->width, statsImage->height), inputImage.getImage2D(),
            sobelImage.getImage2D(), statsImage->getImage2D());
 }
 
@@ -230,7 +279,7 @@ void rawNoiseStatistics(gls::OpenCLContext* glsContext, const gls::cl_image_2d<g
                                     >(program, "rawNoiseStatistics");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(meanImage->width, meanImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(meanImage->width, meanImage->height), rawImage.getImage2D(),
            bayerPattern, sobelImage.getImage2D(), meanImage->getImage2D(), varImage->getImage2D(),
            kurtImage->getImage2D());
 }
@@ -247,7 +296,7 @@ void applyKernel(gls::OpenCLContext* glsContext, const std::string& kernelName,
                                     >(program, kernelName);
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            outputImage->getImage2D());
 }
 
@@ -281,7 +330,7 @@ void resampleImage(gls::OpenCLContext* glsContext, const std::string& kernelName
                                     cl::Sampler>(program, kernelName);
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            outputImage->getImage2D(), linear_sampler);
 }
 
@@ -293,6 +342,38 @@ template void resampleImage(gls::OpenCLContext* glsContext, const std::string& k
                             const gls::cl_image_2d<gls::luma_alpha_pixel_float>& inputImage,
                             gls::cl_image_2d<gls::luma_alpha_pixel_float>* outputImage);
 
+void downsampleImagePyramid2(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
+                             const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage,
+                             gls::cl_image_2d<gls::rgba_pixel_float>* outputImage1,
+                             gls::cl_image_2d<gls::luma_alpha_pixel_float>* outputGradient1,
+                             gls::cl_image_2d<gls::rgba_pixel_float>* outputImage2,
+                             gls::cl_image_2d<gls::luma_alpha_pixel_float>* outputGradient2) {
+    assert(inputImage.width == 2 * outputImage1->width && inputImage.height == 2 * outputImage1->height);
+    assert(outputImage1->width == 2 * outputImage2->width && outputImage1->height == 2 * outputImage2->height);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Image2D,  // inputImage
+                                    cl::Image2D,  // gradientImage
+                                    cl::Image2D,  // outputImage1
+                                    cl::Image2D,  // outputGradient1
+                                    cl::Image2D,  // outputImage2
+                                    cl::Image2D   // outputGradient2
+                                    >(program, "downsampleImagePyramid2");
+
+    // One work-group per 16x16 tile of the first level, see PYRAMID_TILE
+    const int tileSize = 16;
+    const size_t width = (outputImage1->width + tileSize - 1) / tileSize * tileSize;
+    const size_t height = (outputImage1->height + tileSize - 1) / tileSize * tileSize;
+
+    // Schedule the kernel on the GPU
+    kernel(buildEnqueueArgs(cl::NDRange(width, height), cl::NDRange(tileSize, tileSize)), inputImage.getImage2D(),
+           gradientImage.getImage2D(), outputImage1->getImage2D(), outputGradient1->getImage2D(),
+           outputImage2->getImage2D(), outputGradient2->getImage2D());
+}
+
 template <typename T>
 void subtractNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<T>& inputImage,
                         const gls::cl_image_2d<T>& inputImage1, const gls::cl_image_2d<T>& inputImageDenoised1,
@@ -316,7 +397,7 @@ void subtractNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<T
                                     >(program, "subtractNoiseImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            inputImage1.getImage2D(), inputImageDenoised1.getImage2D(), gradientImage.getImage2D(), luma_weight,
            sharpening, {nlf[0], nlf[1]}, outputImage->getImage2D(), linear_sampler);
 }
@@ -347,35 +428,71 @@ void transformImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
                                     >(program, "transformImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImage->width, rgbImage->height), linearImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbImage->width, rgbImage->height), linearImage.getImage2D(),
            rgbImage->getImage2D(), clTransform);
 }
 
+void bakeToneCurveLut(gls::OpenCLContext* glsContext, const RGBConversionParameters& rgbConversionParameters,
+                      gls::cl_image_2d<gls::luma_pixel_float>* toneCurveLut) {
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Image2D,             // toneCurveLut
+                                    RGBConversionParameters  // rgbConversionParameters
+                                    >(program, "bakeToneCurveLut");
+
+    // Schedule the kernel on the GPU
+    kernel(buildEnqueueArgs(toneCurveLut->width, 1), toneCurveLut->getImage2D(),
+           rgbConversionParameters);
+}
+
 void convertTosRGB(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& linearImage,
                    const gls::cl_image_2d<gls::luma_pixel_float>& ltmMaskImage,
-                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, const DemosaicParameters& demosaicParameters) {
+                   const gls::cl_image_2d<gls::rgba_pixel_float>* ltmGuideImage,
+                   const gls::cl_image_2d<gls::luma_pixel_float>& toneCurveLut,
+                   gls::cl_image_2d<gls::rgba_pixel_float>* rgbImage, const DemosaicParameters& demosaicParameters,
+                   const gls::Matrix<3, 3>& inputTransform) {
     // Load the shader source
     const auto program = glsContext->loadProgram("demosaic");
 
+    const auto linear_sampler = cl::Sampler(glsContext->clContext(), true, CL_ADDRESS_CLAMP_TO_EDGE, CL_FILTER_LINEAR);
+
     const auto& transform = demosaicParameters.rgb_cam;
 
     struct Matrix3x3 {
         cl_float3 m[3];
     } clTransform = {{{transform[0][0], transform[0][1], transform[0][2]},
                       {transform[1][0], transform[1][1], transform[1][2]},
-                      {transform[2][0], transform[2][1], transform[2][2]}}};
+                      {transform[2][0], transform[2][1], transform[2][2]}}},
+      clInputTransform = {{{inputTransform[0][0], inputTransform[0][1], inputTransform[0][2]},
+                           {inputTransform[1][0], inputTransform[1][1], inputTransform[1][2]},
+                           {inputTransform[2][0], inputTransform[2][1], inputTransform[2][2]}}};
+
+    // Luma of the (exposure normalized) input image, the range guide for reduced resolution LTM masks
+    const auto cam_to_ycbcr = cam_ycbcr(demosaicParameters.rgb_cam);
+    const float lumaScale = 1 / demosaicParameters.exposure_multiplier;
+    const cl_float3 lumaTransform = {cam_to_ycbcr[0][0] * lumaScale, cam_to_ycbcr[0][1] * lumaScale,
+                                     cam_to_ycbcr[0][2] * lumaScale};
 
     // Bind the kernel parameters
-    auto kernel = cl::KernelFunctor<cl::Image2D,             // linearImage
-                                    cl::Image2D,             // ltmMaskImage
-                                    cl::Image2D,             // rgbImage
-                                    Matrix3x3,               // transform
-                                    RGBConversionParameters  // demosaicParameters
-                                    >(program, "convertTosRGB");
+    auto kernel = cl::KernelFunctor<cl::Image2D,              // linearImage
+                                    cl::Image2D,              // ltmMaskImage
+                                    cl::Image2D,              // ltmGuideImage
+                                    cl::Image2D,              // toneCurveLut
+                                    cl::Image2D,              // rgbImage
+                                    Matrix3x3,                // inputTransform
+                                    Matrix3x3,                // transform
+                                    cl_float3,                // lumaTransform
+                                    RGBConversionParameters,  // demosaicParameters
+                                    cl::Sampler               // linear_sampler
+                                    >(program, "convertTosRGBToneCurveLut");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbImage->width, rgbImage->height), linearImage.getImage2D(),
-           ltmMaskImage.getImage2D(), rgbImage->getImage2D(), clTransform, demosaicParameters.rgbConversionParameters);
+    kernel(buildEnqueueArgs(rgbImage->width, rgbImage->height), linearImage.getImage2D(),
+           ltmMaskImage.getImage2D(), ltmGuideImage ? ltmGuideImage->getImage2D() : linearImage.getImage2D(),
+           toneCurveLut.getImage2D(), rgbImage->getImage2D(), clInputTransform, clTransform, lumaTransform,
+           demosaicParameters.rgbConversionParameters, linear_sampler);
 }
 
 void convertToGrayscale(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& linearImage,
@@ -392,10 +509,29 @@ void convertToGrayscale(gls::OpenCLContext* glsContext, const gls::cl_image_2d<g
                                     >(program, "convertToGrayscale");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(grayscaleImage->width, grayscaleImage->height),
+    kernel(buildEnqueueArgs(grayscaleImage->width, grayscaleImage->height),
            linearImage.getImage2D(), grayscaleImage->getImage2D(), {transform[0][0], transform[0][1], transform[0][2]});
 }
 
+void packRGBImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& rgbImage,
+                  int bitsPerChannel, bool dither, int stride, cl::Buffer* outputBuffer) {
+    assert(bitsPerChannel == 8 || bitsPerChannel == 16);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Image2D,  // rgbImage
+                                    int,          // dither
+                                    int,          // stride
+                                    cl::Buffer    // output
+                                    >(program, bitsPerChannel == 8 ? "packRGB8Image" : "packRGB16Image");
+
+    // Schedule the kernel on the GPU
+    kernel(buildEnqueueArgs(rgbImage.width, rgbImage.height), rgbImage.getImage2D(), dither,
+           stride, *outputBuffer);
+}
+
 void despeckleImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                     const gls::Vector<3>& var_a, const gls::Vector<3>& var_b,
                     gls::cl_image_2d<gls::rgba_pixel_float>* outputImage) {
@@ -413,7 +549,7 @@ void despeckleImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
     cl_float3 cl_var_b = {var_b[0], var_b[1], var_b[2]};
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            cl_var_a, cl_var_b, outputImage->getImage2D());
 }
 
@@ -423,7 +559,8 @@ void despeckleImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
 void denoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                   const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage, const gls::Vector<3>& var_a,
                   const gls::Vector<3>& var_b, const gls::Vector<3> thresholdMultipliers, float chromaBoost,
-                  float gradientBoost, float gradientThreshold, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage) {
+                  float gradientBoost, float gradientThreshold, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage,
+                  int maxRadius) {
     // Load the shader source
     const auto program = glsContext->loadProgram("demosaic");
 
@@ -436,17 +573,21 @@ void denoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rg
                                     float,        // chromaBoost
                                     float,        // gradientBoost
                                     float,        // gradientThreshold
+                                    int,          // radius
                                     cl::Image2D   // outputImage
                                     >(program, "denoiseImage");
 
     cl_float3 cl_var_a = {var_a[0], var_a[1], var_a[2]};
     cl_float3 cl_var_b = {var_b[0], var_b[1], var_b[2]};
 
+    // The wide window is only used for gradient boosted denoising
+    const int radius = gradientBoost > 0 ? std::min(maxRadius, 4) : 2;
+
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            gradientImage.getImage2D(), cl_var_a, cl_var_b,
            {thresholdMultipliers[0], thresholdMultipliers[1], thresholdMultipliers[2]}, chromaBoost, gradientBoost,
-           gradientThreshold, outputImage->getImage2D());
+           gradientThreshold, radius, outputImage->getImage2D());
 }
 
 void denoiseImageGuided(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
@@ -466,20 +607,103 @@ void denoiseImageGuided(gls::OpenCLContext* glsContext, const gls::cl_image_2d<g
     cl_float3 cl_var_b = {var_b[0], var_b[1], var_b[2]};
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            cl_var_a, cl_var_b, outputImage->getImage2D());
 }
 
+// Bilateral grid cell size in pixels and luma bins, the bins are laid out kBilateralGridBinColumns per row of the grid
+// images. See GRID_BINS and GRID_BIN_COLUMNS in demosaic.cl.
+static const constexpr int kBilateralGridCell = 16;
+static const constexpr int kBilateralGridBins = 8;
+static const constexpr int kBilateralGridBinColumns = 4;
+
+static gls::size bilateralGridSize(int width, int height) {
+    return gls::size((width + kBilateralGridCell - 1) / kBilateralGridCell,
+                     (height + kBilateralGridCell - 1) / kBilateralGridCell);
+}
+
+gls::size bilateralGridImageSize(int width, int height) {
+    const auto gridSize = bilateralGridSize(width, height);
+    return gls::size(gridSize.width * kBilateralGridBinColumns,
+                     gridSize.height * (kBilateralGridBins / kBilateralGridBinColumns));
+}
+
+void bilateralGridChromaDenoise(gls::OpenCLContext* glsContext,
+                                const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* gridImage,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* blurredGridImage,
+                                const gls::Vector<2>& chromaNlf,
+                                gls::cl_image_2d<gls::rgba_pixel_float>* outputImage) {
+    const auto gridSize = bilateralGridSize(inputImage.width, inputImage.height);
+    const auto gridImageSize = bilateralGridImageSize(inputImage.width, inputImage.height);
+    assert(gridImage->width >= gridImageSize.width && gridImage->height >= gridImageSize.height);
+    assert(blurredGridImage->width >= gridImageSize.width && blurredGridImage->height >= gridImageSize.height);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    const cl_int2 cl_gridSize = {gridSize.width, gridSize.height};
+
+    // Splat the chroma into the grid
+    auto splatKernel = cl::KernelFunctor<cl::Image2D,  // inputImage
+                                         int,          // cellSize
+                                         cl_int2,      // gridSize
+                                         cl::Image2D   // gridImage
+                                         >(program, "splatBilateralGrid");
+
+    splatKernel(buildEnqueueArgs(gridSize.width, gridSize.height), inputImage.getImage2D(), kBilateralGridCell,
+                cl_gridSize, gridImage->getImage2D());
+
+    // Blur the grid along x, y and luma
+    auto blurKernel = cl::KernelFunctor<cl::Image2D,  // gridImage
+                                        cl_int2,      // gridSize
+                                        int,          // axis
+                                        cl::Image2D   // blurredGridImage
+                                        >(program, "blurBilateralGrid");
+
+    for (int axis = 0; axis < 3; axis++) {
+        const auto input = axis == 1 ? blurredGridImage : gridImage;
+        const auto output = axis == 1 ? gridImage : blurredGridImage;
+        blurKernel(buildEnqueueArgs(gridImageSize.width, gridImageSize.height), input->getImage2D(), cl_gridSize,
+                   axis, output->getImage2D());
+    }
+
+    // Slice the chroma back at the pixel positions, from unnormalized grid coordinates
+    const auto linear_sampler = cl::Sampler(glsContext->clContext(), false, CL_ADDRESS_CLAMP_TO_EDGE, CL_FILTER_LINEAR);
+
+    auto sliceKernel = cl::KernelFunctor<cl::Image2D,  // inputImage
+                                         cl::Image2D,  // gridImage
+                                         int,          // cellSize
+                                         cl_int2,      // gridSize
+                                         cl_float2,    // chromaNlf
+                                         cl::Image2D,  // outputImage
+                                         cl::Sampler   // linear_sampler
+                                         >(program, "sliceBilateralGrid");
+
+    sliceKernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+                blurredGridImage->getImage2D(), kBilateralGridCell, cl_gridSize, {chromaNlf[0], chromaNlf[1]},
+                outputImage->getImage2D(), linear_sampler);
+}
+
+// Work group size of the summed area table scans, same as SAT_SCAN_GROUP_SIZE in demosaic.cl
+static const constexpr int kSATScanGroupSize = 128;
+
 // Arrays order is LF, MF, HF
 void localToneMappingMask(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                           const std::array<const gls::cl_image_2d<gls::rgba_pixel_float>*, 3>& guideImage,
                           const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abImage,
                           const std::array<const gls::cl_image_2d<gls::luma_alpha_pixel_float>*, 3>& abMeanImage,
                           const LTMParameters& ltmParameters, const gls::Matrix<3, 3>& ycbcr_srgb,
-                          const gls::Vector<2>& nlf, gls::cl_image_2d<gls::luma_pixel_float>* outputImage) {
+                          const gls::Vector<2>& nlf, gls::cl_image_2d<gls::luma_pixel_float>* outputImage,
+                          gls::cl_image_2d<gls::rgba_pixel_float>* rowSumImage,
+                          gls::cl_image_2d<gls::rgba_pixel_float>* sumImage) {
+    const bool useSAT = ltmParameters.guidedFilterRadius != 2;
+
     for (int i = 0; i < 3; i++) {
         assert(guideImage[i]->width == abImage[i]->width && guideImage[i]->height == abImage[i]->height);
         assert(guideImage[i]->width == abMeanImage[i]->width && guideImage[i]->height == abMeanImage[i]->height);
+        assert(!useSAT || (sumImage->width > guideImage[i]->width && sumImage->height > guideImage[i]->height));
+        assert(!useSAT || (rowSumImage->width >= sumImage->width && rowSumImage->height >= sumImage->height));
     }
 
     // Load the shader source
@@ -516,18 +740,77 @@ void localToneMappingMask(gls::OpenCLContext* glsContext, const gls::cl_image_2d
                                        cl::Sampler     // linear_sampler
                                        >(program, "localToneMappingMaskImage");
 
+    // Summed area table versions of the guided filter kernels, cost independent of the radius
+    auto integralRowsKernel = cl::KernelFunctor<cl::Image2D,  // inputImage
+                                                int,          // guideStatistics
+                                                cl::Image2D   // rowSumImage
+                                                >(program, "integralRowsImage");
+
+    auto integralColumnsKernel = cl::KernelFunctor<cl::Image2D,  // rowSumImage
+                                                   int,          // height
+                                                   cl::Image2D   // sumImage
+                                                   >(program, "integralColumnsImage");
+
+    auto integralTileOffsetsKernel = cl::KernelFunctor<cl::Image2D,  // tileSumImage
+                                                       int,          // columns
+                                                       cl::Image2D   // sumImage
+                                                       >(program, "integralTileOffsetsImage");
+
+    auto gfSATKernel = cl::KernelFunctor<cl::Image2D,  // sumImage
+                                         cl::Image2D,  // abImage
+                                         float,        // eps
+                                         int           // radius
+                                         >(program, "GuidedFilterABImageSAT");
+
+    auto gfMeanSATKernel = cl::KernelFunctor<cl::Image2D,  // sumImage
+                                             cl::Image2D,  // outputImage
+                                             int           // radius
+                                             >(program, "BoxFilterGFImageSAT");
+
+    // Each work group scans a tile of 2 * kSATScanGroupSize table entries, the tile scans and the tile offsets ping
+    // pong between rowSumImage and sumImage, leaving the table in sumImage
+    const auto integralImage = [&](const cl::Image2D& inputImage, int width, int height, bool guideStatistics) {
+        const auto scanGroups = [](int entries) {
+            return (entries + 2 * kSATScanGroupSize - 1) / (2 * kSATScanGroupSize);
+        };
+
+        integralRowsKernel(buildEnqueueArgs(cl::NDRange(scanGroups(width + 1) * kSATScanGroupSize, height),
+                                            cl::NDRange(kSATScanGroupSize, 1)),
+                           inputImage, guideStatistics, rowSumImage->getImage2D());
+        integralTileOffsetsKernel(buildEnqueueArgs(width + 1, height), rowSumImage->getImage2D(), /*columns=*/false,
+                                  sumImage->getImage2D());
+
+        integralColumnsKernel(buildEnqueueArgs(cl::NDRange(scanGroups(height + 1) * kSATScanGroupSize, width + 1),
+                                               cl::NDRange(kSATScanGroupSize, 1)),
+                              sumImage->getImage2D(), height, rowSumImage->getImage2D());
+        integralTileOffsetsKernel(buildEnqueueArgs(height + 1, width + 1), rowSumImage->getImage2D(), /*columns=*/true,
+                                  sumImage->getImage2D());
+    };
+
     // Schedule the kernel on the GPU
     for (int i = 0; i < 3; i++) {
         if (i == 0 || ltmParameters.detail[i] != 1) {
-            gfKernel(gls::OpenCLContext::buildEnqueueArgs(guideImage[i]->width, guideImage[i]->height),
-                     guideImage[i]->getImage2D(), abImage[i]->getImage2D(), ltmParameters.eps, linear_sampler);
+            if (useSAT) {
+                const int radius = ltmParameters.guidedFilterRadius;
 
-            gfMeanKernel(gls::OpenCLContext::buildEnqueueArgs(abImage[i]->width, abImage[i]->height),
-                         abImage[i]->getImage2D(), abMeanImage[i]->getImage2D(), linear_sampler);
+                integralImage(guideImage[i]->getImage2D(), guideImage[i]->width, guideImage[i]->height, true);
+                gfSATKernel(buildEnqueueArgs(abImage[i]->width, abImage[i]->height),
+                            sumImage->getImage2D(), abImage[i]->getImage2D(), ltmParameters.eps, radius);
+
+                integralImage(abImage[i]->getImage2D(), abImage[i]->width, abImage[i]->height, false);
+                gfMeanSATKernel(buildEnqueueArgs(abMeanImage[i]->width, abMeanImage[i]->height),
+                                sumImage->getImage2D(), abMeanImage[i]->getImage2D(), radius);
+            } else {
+                gfKernel(buildEnqueueArgs(guideImage[i]->width, guideImage[i]->height),
+                         guideImage[i]->getImage2D(), abImage[i]->getImage2D(), ltmParameters.eps, linear_sampler);
+
+                gfMeanKernel(buildEnqueueArgs(abImage[i]->width, abImage[i]->height),
+                             abImage[i]->getImage2D(), abMeanImage[i]->getImage2D(), linear_sampler);
+            }
         }
     }
 
-    ltmKernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    ltmKernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
               abMeanImage[0]->getImage2D(), abMeanImage[1]->getImage2D(), abMeanImage[2]->getImage2D(),
               outputImage->getImage2D(), ltmParameters, cl_ycbcr_srgb, {nlf[0], nlf[1]}, linear_sampler);
 }
@@ -546,7 +829,7 @@ void bayerToRawRGBA(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
                                     >(program, "bayerToRawRGBA");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbaImage->width, rgbaImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbaImage->width, rgbaImage->height), rawImage.getImage2D(),
            rgbaImage->getImage2D(), bayerPattern);
 }
 
@@ -564,7 +847,7 @@ void rawRGBAToBayer(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
                                     >(program, "rawRGBAToBayer");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(rgbaImage.width, rgbaImage.height), rgbaImage.getImage2D(),
+    kernel(buildEnqueueArgs(rgbaImage.width, rgbaImage.height), rgbaImage.getImage2D(),
            rawImage->getImage2D(), bayerPattern);
 }
 
@@ -580,7 +863,7 @@ void denoiseRawRGBAImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<
                                     >(program, "denoiseRawRGBAImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            {rawVariance[0], rawVariance[1], rawVariance[2], rawVariance[3]}, outputImage->getImage2D());
 }
 
@@ -596,10 +879,35 @@ void despeckleRawRGBAImage(gls::OpenCLContext* glsContext, const gls::cl_image_2
                                     >(program, "despeckleRawRGBAImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            {rawVariance[0], rawVariance[1], rawVariance[2], rawVariance[3]}, outputImage->getImage2D());
 }
 
+void despeckleRawImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::luma_pixel_float>& rawImage,
+                       const gls::Vector<4> rawVariance, BayerPattern bayerPattern,
+                       gls::cl_image_2d<gls::luma_pixel_float>* outputImage) {
+    assert(rawImage.width == outputImage->width && rawImage.height == outputImage->height);
+
+    // Load the shader source
+    const auto program = glsContext->loadProgram("demosaic");
+
+    // Bind the kernel parameters
+    auto kernel = cl::KernelFunctor<cl::Image2D,  // rawImage
+                                    cl_float4,    // rawVariance
+                                    int,          // bayerPattern
+                                    cl::Image2D   // despeckledRawImage
+                                    >(program, "despeckleRawImage");
+
+    // One work-group per 16x16 tile of Bayer quads, see DESPECKLE_TILE
+    const int tileSize = 16;
+    const size_t width = (rawImage.width / 2 + tileSize - 1) / tileSize * tileSize;
+    const size_t height = (rawImage.height / 2 + tileSize - 1) / tileSize * tileSize;
+
+    // Schedule the kernel on the GPU
+    kernel(buildEnqueueArgs(cl::NDRange(width, height), cl::NDRange(tileSize, tileSize)), rawImage.getImage2D(),
+           {rawVariance[0], rawVariance[1], rawVariance[2], rawVariance[3]}, bayerPattern, outputImage->getImage2D());
+}
+
 std::vector<std::array<float, 3>> gaussianKernelBilinearWeights(float radius) {
     int kernelSize = (int)(ceil(2 * radius));
     if ((kernelSize % 2) == 0) {
@@ -659,7 +967,7 @@ void gaussianBlurSobelImage(gls::OpenCLContext* glsContext, const gls::cl_image_
                                     >(program, "sampledConvolutionSobel");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), rawImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), rawImage.getImage2D(),
            sobelImage.getImage2D(), (int)weightsOut1.size(), weightsBuffer1, (int)weightsOut2.size(), weightsBuffer2,
            cl_float2{rawNoiseModel[0], rawNoiseModel[1]}, outputImage->getImage2D(), linear_sampler);
 }
@@ -678,7 +986,7 @@ void gaussianBlurImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gl
                                         >(program, "gaussianBlurImage");
 
         // Schedule the kernel on the GPU
-        kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+        kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
                radius, outputImage->getImage2D());
     } else {
         auto weightsOut = gaussianKernelBilinearWeights(radius);
@@ -697,14 +1005,14 @@ void gaussianBlurImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gl
                                         >(program, "sampledConvolutionImage");
 
         // Schedule the kernel on the GPU
-        kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+        kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
                (int)weightsOut.size(), weightsBuffer, outputImage->getImage2D(), linear_sampler);
     }
 }
 
 void blueNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                     const gls::cl_image_2d<gls::luma_pixel_16>& blueNoiseImage, gls::Vector<2> lumaVariance,
-                    gls::cl_image_2d<gls::rgba_pixel_float>* outputImage) {
+                    gls::cl_image_2d<gls::rgba_pixel_float>* outputImage, const gls::point& origin) {
     // Load the shader source
     const auto program = glsContext->loadProgram("demosaic");
 
@@ -712,6 +1020,7 @@ void blueNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
     auto kernel = cl::KernelFunctor<cl::Image2D,  // inputImage
                                     cl::Image2D,  // blueNoiseImage
                                     cl_float2,    // lumaVariance
+                                    cl_int2,      // origin
                                     cl::Image2D,  // outputImage
                                     cl::Sampler   // linear_sampler
                                     >(program, "blueNoiseImage");
@@ -719,23 +1028,32 @@ void blueNoiseImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::
     const auto linear_sampler = cl::Sampler(glsContext->clContext(), true, CL_ADDRESS_REPEAT, CL_FILTER_LINEAR);
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
-           blueNoiseImage.getImage2D(), {lumaVariance[0], lumaVariance[1]}, outputImage->getImage2D(), linear_sampler);
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+           blueNoiseImage.getImage2D(), {lumaVariance[0], lumaVariance[1]}, {origin.x, origin.y},
+           outputImage->getImage2D(), linear_sampler);
 }
 
 void blendHighlightsImage(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
-                          float clip, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage) {
+                          float clip, gls::cl_image_2d<gls::rgba_pixel_float>* outputImage,
+                          const gls::Matrix<3, 3>& transform) {
     // Load the shader source
     const auto program = glsContext->loadProgram("demosaic");
 
+    struct Matrix3x3 {
+        cl_float3 m[3];
+    } clTransform = {{{transform[0][0], transform[0][1], transform[0][2]},
+                      {transform[1][0], transform[1][1], transform[1][2]},
+                      {transform[2][0], transform[2][1], transform[2][2]}}};
+
     // Bind the kernel parameters
     auto kernel = cl::KernelFunctor<cl::Image2D,  // inputImage
                                     float,        // clip
+                                    Matrix3x3,    // transform
                                     cl::Image2D   // outputImage
                                     >(program, "blendHighlightsImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(), clip,
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(), clip, clTransform,
            outputImage->getImage2D());
 }
 
@@ -744,7 +1062,10 @@ YCbCrNLF MeasureYCbCrNLF(gls::OpenCLContext* glsContext, const gls::cl_image_2d<
     gls::cl_image_2d<gls::rgba_pixel_float> noiseStats(glsContext->clContext(), inputImage.width, inputImage.height);
     YCbCrNoiseStatistics(glsContext, inputImage, sobelImage, &noiseStats);
     // applyKernel(glsContext, "noiseStatistics_old", inputImage, &noiseStats);
-    const auto noiseStatsCpu = noiseStats.mapImage();
+
+    // mapImage goes through the default queue, wait for the statistics kernel
+    currentCommandQueue().finish();
+    const auto noiseStatsCpu = noiseStats.mapImage(CL_MAP_READ);
 
     using double3 = gls::DVector<3>;
 
@@ -954,9 +1275,11 @@ RawNLF MeasureRawNLF(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls:
 
     rawNoiseStatistics(glsContext, rawImage, bayerPattern, sobelImage, &meanImage, &varImage, &kurtImage);
 
-    const auto meanImageCpu = meanImage.mapImage();
-    const auto varImageCpu = varImage.mapImage();
-    const auto kurtImageCpu = kurtImage.mapImage();
+    // mapImage goes through the default queue, wait for the statistics kernel
+    currentCommandQueue().finish();
+    const auto meanImageCpu = meanImage.mapImage(CL_MAP_READ);
+    const auto varImageCpu = varImage.mapImage(CL_MAP_READ);
+    const auto kurtImageCpu = kurtImage.mapImage(CL_MAP_READ);
 
     //    static int count = 0;
     //    dumpNoiseImage(meanImageCpu, 1, 0, "mean9x9-" + std::to_string(count));
@@ -1137,7 +1460,7 @@ void clFuseFrames(gls::OpenCLContext* glsContext, const gls::cl_image_2d<gls::rg
     const auto linear_sampler = cl::Sampler(glsContext->clContext(), true, CL_ADDRESS_CLAMP_TO_EDGE, CL_FILTER_LINEAR);
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(newFusedImage->width, newFusedImage->height),
+    kernel(buildEnqueueArgs(newFusedImage->width, newFusedImage->height),
            referenceImage.getImage2D(), gradientImage.getImage2D(), inputImage.getImage2D(),
            previousFusedImage.getImage2D(), homography, linear_sampler, cl_var_a, cl_var_b, fusedFrames,
            newFusedImage->getImage2D());
@@ -1161,7 +1484,7 @@ void subtractNoiseFusedImage(gls::OpenCLContext* glsContext, const gls::cl_image
                                     >(program, "subtractNoiseFusedImage");
 
     // Schedule the kernel on the GPU
-    kernel(gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
+    kernel(buildEnqueueArgs(outputImage->width, outputImage->height), inputImage.getImage2D(),
            inputImage1.getImage2D(), inputImageDenoised1.getImage2D(), outputImage->getImage2D(), linear_sampler);
 }
 
@@ -1187,7 +1510,7 @@ void clRescaleImage(gls::OpenCLContext* cLContext, const gls::cl_image_2d<T>& in
 
     kernel(
 #if __APPLE__
-        gls::OpenCLContext::buildEnqueueArgs(outputImage->width, outputImage->height),
+        buildEnqueueArgs(outputImage->width, outputImage->height),
 #else
         cl::EnqueueArgs(cl::NDRange(outputImage->width, outputImage->height), cl::NDRange(32, 32)),
 #endif
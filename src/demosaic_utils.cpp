@@ -668,6 +668,34 @@ gls::Matrix<3, 3> cam_ycbcr(const gls::Matrix<3, 3>& rgb_cam) {
     // clang-format on
 }
 
+// The tiers only trade the pyramid depth, window and despeckling, the kernel choices and the bilateral grid are kept
+static void setTierProcessingParameters(int pyramidLevels, int maxDenoiseRadius, bool despeckle,
+                                        ProcessingParameters* processingParameters) {
+    processingParameters->pyramidLevels = pyramidLevels;
+    processingParameters->maxDenoiseRadius = maxDenoiseRadius;
+    processingParameters->despeckle = despeckle;
+}
+
+void applyProcessingTier(ProcessingTier tier, DemosaicParameters* demosaicParameters) {
+    switch (tier) {
+        case DraftTier:
+            setTierProcessingParameters(/*pyramidLevels=*/3, /*maxDenoiseRadius=*/2, /*despeckle=*/false,
+                                        &demosaicParameters->processingParameters);
+            demosaicParameters->ltmParameters.maskScale = 4;
+            break;
+        case StandardTier:
+            setTierProcessingParameters(/*pyramidLevels=*/4, /*maxDenoiseRadius=*/2, /*despeckle=*/true,
+                                        &demosaicParameters->processingParameters);
+            demosaicParameters->ltmParameters.maskScale = 2;
+            break;
+        case MaxTier:
+            setTierProcessingParameters(/*pyramidLevels=*/5, /*maxDenoiseRadius=*/4, /*despeckle=*/true,
+                                        &demosaicParameters->processingParameters);
+            demosaicParameters->ltmParameters.maskScale = 1;
+            break;
+    }
+}
+
 struct WhiteBalanceStats {
     gls::Vector<3> wbGain;
     float diffAverage;
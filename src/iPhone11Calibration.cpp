@@ -183,7 +183,7 @@ gls::image<gls::rgb_pixel>::unique_ptr demosaiciPhone11(RawConverter* rawConvert
     iPhone11Calibration calibration;
     auto demosaicParameters = calibration.getDemosaicParameters(*inputImage, &dng_metadata, &exif_metadata);
 
-    return RawConverter::convertToRGBImage(
+    return rawConverter->convertToRGBImage(
         *rawConverter->runPipeline(*inputImage, demosaicParameters.get(), /*calibrateFromImage=*/true));
 }
 // --- NLFData ---
@@ -0,0 +1,4131 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include "pipeline_assets.hpp"
+
+std::shared_ptr<const gls::cl_image_2d<gls::luma_pixel_16>> blueNoiseTexture(gls::OpenCLContext* glsContext,
+                                                                             TexturePool* texturePool) {
+    return texturePool->asset<gls::cl_image_2d<gls::luma_pixel_16>>("blueNoiseTile", [glsContext]() {
+        gls::image<gls::luma_pixel_16> blueNoise(kBlueNoiseTileSize, kBlueNoiseTileSize);
+        for (int y = 0; y < kBlueNoiseTileSize; y++) {
+            for (int x = 0; x < kBlueNoiseTileSize; x++) {
+                blueNoise[y][x].luma = kBlueNoiseTile[y * kBlueNoiseTileSize + x];
+            }
+        }
+        return std::make_shared<gls::cl_image_2d<gls::luma_pixel_16>>(glsContext->clContext(), blueNoise);
+    });
+}
+
+// Generated from Assets/HDR_L_0b.png, 16-bit grayscale pixels in row order
+const uint16_t kBlueNoiseTile[kBlueNoiseTileSize * kBlueNoiseTileSize] = {
+    0x5aa8, 0x6450, 0x8645, 0x384e, 0xdd2f, 0xb327, 0x4198, 0xeaad, 0xaf1f, 0x428c, 0xb40f, 0x5852, 0xcfd5, 0x7bc2, 0x5128, 0xe0b9,
+    0xc297, 0xa0bf, 0x8429, 0xd42b, 0x2264, 0x93f7, 0x4d9e, 0x88bf, 0xe68d, 0x1be0, 0x42be, 0x9e37, 0xa5c3, 0x557a, 0xc241, 0x4180,
+    0xcf89, 0xec7b, 0xb15b, 0x296c, 0x98b7, 0xd673, 0x8e83, 0x95cd, 0x72a0, 0x5cda, 0x4f7c, 0x3448, 0xc2cb, 0x6274, 0x6ca2, 0x2212,
+    0xa28b, 0x5ae4, 0xb873, 0x8f89, 0x2ea6, 0x766e, 0x3ade, 0xc95d, 0x9683, 0x7b4c, 0x33dc, 0xc38f, 0x5608, 0xeb73, 0x3ea2, 0x0e92,
+    0x7312, 0xb10b, 0xcb4b, 0x62a2, 0xb96f, 0x6d60, 0x2dd0, 0xa14d, 0x5ece, 0x94eb, 0xdfd3, 0x6746, 0x169c, 0x56a6, 0xe4a5, 0x6d1c,
+    0x4104, 0x709c, 0x9da5, 0x1f7c, 0x6dfa, 0xa23d, 0x2d20, 0x742e, 0xbeb3, 0x81e7, 0x5018, 0xd51b, 0x1bc8, 0x7010, 0x2b2c, 0x7af2,
+    0x2472, 0xd997, 0x7758, 0x383e, 0xa1af, 0x72f2, 0xc815, 0xe261, 0x76ac, 0x2a6e, 0x8783, 0x1ee8, 0x7c38, 0xe6c9, 0x9ebd, 0x30c8,
+    0xbabd, 0x9569, 0xaaf5, 0xba39, 0x2c32, 0x9bbd, 0xbfd7, 0x53d2, 0xe157, 0xc9d7, 0xd7b9, 0xa7e5, 0xb3af, 0xd771, 0x11d4, 0x3a66,
+    0x7306, 0x93fd, 0x4dcc, 0x2c1e, 0xbf37, 0x7bc6, 0xea27, 0x26cc, 0xbdd1, 0xb00d, 0x7ad8, 0x9dcf, 0xe831, 0x8c95, 0xd98b, 0x3e54,
+    0xb51d, 0xda05, 0x540a, 0xc10b, 0x7cbe, 0x1d30, 0x768c, 0xc589, 0x9fff, 0x626a, 0x59dc, 0xd91f, 0x7d46, 0xd039, 0x82c3, 0x941d,
+    0x761c, 0xea99, 0x80b9, 0xcc6d, 0x6f36, 0x298c, 0xb433, 0x1c54, 0xcbd7, 0xa4c7, 0xdd03, 0x67b2, 0x70e0, 0x3982, 0x7d42, 0xc86f,
+    0x9225, 0x42f4, 0xd3df, 0x20bc, 0x5668, 0x87fb, 0x3830, 0x1884, 0x47fe, 0x3a12, 0xb22d, 0x4f44, 0xd5d7, 0x1c66, 0xae8f, 0x760a,
+    0x9c27, 0x1374, 0x6300, 0x248c, 0xd5b9, 0x36f0, 0x7cbe, 0x44da, 0x799c, 0xe9bb, 0x2ca8, 0x7c2a, 0x575e, 0x34d8, 0xb7a3, 0x918f,
+    0x68f0, 0x4044, 0x27b8, 0x980d, 0xe881, 0xd069, 0x5bf2, 0xb737, 0x3af6, 0xeb33, 0x6814, 0xd1ab, 0xad11, 0xe2b5, 0x6472, 0x3314,
+    0x96ff, 0x7902, 0x8e47, 0xb92b, 0x3c42, 0x96d7, 0x744e, 0x2932, 0xdf75, 0x1ce2, 0xcbaf, 0x6caa, 0xaf11, 0xca29, 0xe0fb, 0x6382,
+    0x35e0, 0x12cc, 0x70ec, 0xbf6d, 0x9c95, 0x6084, 0x251c, 0x43dc, 0x368c, 0x4f22, 0x81d1, 0x9569, 0x3bf6, 0xd53f, 0x33cc, 0x8ff3,
+    0xb797, 0x4aaa, 0xe709, 0x9f19, 0x23f6, 0x6472, 0x9b6f, 0x735c, 0x7e9a, 0x2378, 0x9967, 0x1a70, 0xd82b, 0xad59, 0x9067, 0x6b7a,
+    0x3f76, 0xa5a1, 0x2b14, 0x6abe, 0xa05f, 0xe515, 0xc865, 0x5c8c, 0xb5ad, 0x927f, 0x7e86, 0xd045, 0x1820, 0x6534, 0xe50d, 0x4cca,
+    0x8933, 0x6a66, 0x6192, 0xb821, 0x44a6, 0x6c2e, 0xe861, 0xac3d, 0x41c6, 0xc255, 0xa071, 0x8117, 0x2512, 0xaf27, 0x8de7, 0x3170,
+    0x49f4, 0x1c32, 0x70e8, 0x4a46, 0xd5ed, 0xb4a5, 0x48dc, 0x23c0, 0x9d73, 0x64c0, 0xe4af, 0xb733, 0x9057, 0x6d7c, 0xaa1d, 0xbe6d,
+    0x8355, 0x3262, 0x4012, 0xe1fd, 0x9969, 0x44b8, 0xd551, 0x894f, 0xc2cf, 0x2890, 0x4310, 0xd049, 0x46a8, 0x7cae, 0xc2c7, 0xa08f,
+    0x292e, 0x3898, 0xe359, 0x5774, 0xb461, 0x8a87, 0xcd59, 0x666a, 0xe357, 0x254c, 0x419a, 0x8f33, 0xb427, 0x9fd5, 0x553c, 0xbeab,
+    0xa6b3, 0x943b, 0xbd21, 0x2b64, 0x56a4, 0x97ed, 0x4328, 0x624e, 0x3bd0, 0xa0c7, 0xe329, 0xba31, 0x427c, 0x2a48, 0xaac9, 0x70d8,
+    0x4cfa, 0x172c, 0x3aa2, 0xd9ad, 0x4720, 0x7016, 0xc9fd, 0x39c2, 0x267a, 0x7416, 0x3e9a, 0x87e7, 0x2f82, 0x7268, 0x983d, 0xd925,
+    0x2cba, 0xcbdb, 0x7360, 0x9d93, 0x49b0, 0x5ba6, 0xa211, 0x31c4, 0x90df, 0xd449, 0x51b0, 0x352a, 0x1ec6, 0x5542, 0xa157, 0x26d6,
+    0xc833, 0x218c, 0x658c, 0x986b, 0x3932, 0x5730, 0xdb3d, 0x4f2a, 0x2cfe, 0x818d, 0xb4d9, 0x398a, 0xa4b9, 0x5ec2, 0x14d2, 0xc635,
+    0xb195, 0x371a, 0x1c64, 0xaa35, 0x3d6a, 0xcfcf, 0x8bb5, 0x6894, 0x3a8e, 0x5050, 0x4776, 0xb2cd, 0xd0a1, 0xd941, 0x2d00, 0x5692,
+    0x22be, 0xb4c5, 0xa0a1, 0x77cc, 0xdbd5, 0xbd45, 0x6738, 0xb429, 0x7ff8, 0xc5e9, 0x278e, 0x983f, 0x81db, 0x6036, 0xeb63, 0xc407,
+    0x5fd6, 0xdb75, 0xbbe7, 0x51d4, 0xa247, 0x6e30, 0x23ee, 0xc87f, 0x9161, 0xab67, 0xb2c3, 0x4710, 0xbb41, 0xab99, 0xccd3, 0x28e8,
+    0x5454, 0x8b63, 0xc413, 0x1b82, 0x4064, 0x356e, 0x7376, 0xda87, 0x4812, 0x73ba, 0xaa47, 0x3ad0, 0x6da0, 0x4500, 0x8d79, 0xac5d,
+    0x3462, 0xcc1f, 0x1dc4, 0x4f6a, 0x2674, 0xcd4b, 0xaa21, 0xb863, 0x59bc, 0x8c89, 0xb31d, 0x5b60, 0x1d0e, 0x2fe0, 0x734a, 0xb7d3,
+    0xe32d, 0x965b, 0xa98d, 0x3dfc, 0x585e, 0xda0b, 0xb495, 0x9121, 0x6ab2, 0x34a0, 0xdee1, 0xb79b, 0x6338, 0xc3e5, 0x8023, 0xa8b3,
+    0x265e, 0xc955, 0x7cd2, 0x581a, 0xc1e7, 0x4d72, 0xb2b9, 0x1e7a, 0xc67f, 0x8ee1, 0xe64d, 0x3d80, 0x6806, 0xb389, 0x2460, 0x4258,
+    0xc4d9, 0x5ab6, 0xe3fd, 0xc485, 0x3eb8, 0x5d64, 0x1cfc, 0x6faa, 0x389e, 0xd5c5, 0x5fae, 0xc2b9, 0x72be, 0xaa75, 0x2e0a, 0x7388,
+    0xa661, 0x2f3a, 0xd53b, 0x3e04, 0x747c, 0x9d17, 0x575c, 0x19b8, 0x6a76, 0xd98f, 0x2a3c, 0x7f92, 0xe709, 0x4602, 0x9e8d, 0xdb29,
+    0xc57b, 0xc753, 0x6fe4, 0xa279, 0x9de9, 0xc4df, 0x7424, 0xd943, 0xb6b5, 0x446a, 0xd14f, 0x89ef, 0x3412, 0x281c, 0xd75d, 0x5a36,
+    0x95bb, 0xd229, 0x8907, 0x6be8, 0x1afe, 0x7fc4, 0x56c2, 0xa8b5, 0x223e, 0x69e6, 0x8949, 0xb38f, 0x34da, 0xc613, 0x3ce8, 0x869b,
+    0xd4cd, 0xbea9, 0x8181, 0x1c76, 0xc8cf, 0x3ed2, 0x4940, 0x178e, 0xabbd, 0x9dd7, 0xc80f, 0x6c78, 0xeba9, 0x3e5c, 0x4aec, 0xce97,
+    0x1d7a, 0x5e6e, 0x4fe2, 0xdcd5, 0x8843, 0xcbed, 0x2bf8, 0x8d15, 0xd2c1, 0x747a, 0x5360, 0x6ae6, 0xd611, 0x8ceb, 0x5dc0, 0xc8d7,
+    0xdf8b, 0x620c, 0x767e, 0xc427, 0x5d74, 0x8a3b, 0x8c17, 0x9d0f, 0x6332, 0x957b, 0x1c40, 0x5bac, 0xe18d, 0xc535, 0x8867, 0x675e,
+    0xb40d, 0x3bea, 0x8463, 0x1fea, 0xd187, 0xb173, 0x84bf, 0x65cc, 0x1588, 0x42ca, 0x8641, 0xbefb, 0xcedb, 0x6a44, 0x4b1a, 0x78d8,
+    0xea97, 0x5bc6, 0x4356, 0xac6f, 0xcf63, 0x8b9b, 0xbdd7, 0x689e, 0x966d, 0xd0cb, 0x92a5, 0x2476, 0xbf09, 0x9741, 0x46f4, 0xdf85,
+    0x57d4, 0x5912, 0x999f, 0x90c5, 0x4bc6, 0x5a40, 0x9cc1, 0xeccd, 0xc137, 0x7e5c, 0xa44f, 0x1b5a, 0x9259, 0x5cf6, 0xa7ab, 0x4b50,
+    0xe455, 0x88c3, 0x62c0, 0x49cc, 0x365a, 0x1c8c, 0xa7d5, 0xe8c5, 0x9585, 0x5c98, 0x6e44, 0xbfdd, 0x3b86, 0x2e2e, 0x8c57, 0x49fa,
+    0x2e0a, 0x7dc6, 0x957f, 0x3ee0, 0xc4dd, 0xedef, 0xa6fb, 0x6402, 0x3286, 0x52a4, 0x6f0c, 0xd141, 0x1b24, 0x70f8, 0x5208, 0xe1c7,
+    0xa1f5, 0xdc05, 0xb737, 0x5b88, 0x8675, 0xb89d, 0x6574, 0xa879, 0x1980, 0x8b63, 0x5eea, 0xd2eb, 0x2928, 0x94a1, 0xbf97, 0x5974,
+    0xe2a7, 0x6584, 0xa281, 0x8769, 0xdd3b, 0x68c8, 0x2e98, 0x6ff6, 0x81db, 0x46ce, 0x31e8, 0xe611, 0x8a91, 0x49b6, 0x9509, 0x28ae,
+    0x56b2, 0x831f, 0xd45b, 0x210a, 0x8985, 0xdfff, 0x1902, 0x9d37, 0xcf5d, 0xaaf5, 0x1fec, 0x4cd6, 0x267c, 0x70c0, 0xdb5b, 0x1d46,
+    0x4a0c, 0x8e23, 0xa8ff, 0x2e0a, 0xd5f9, 0x8d35, 0x396c, 0xd2fb, 0x522c, 0x5b6c, 0xc523, 0x71b4, 0x819d, 0x2d24, 0xe7d1, 0x8b93,
+    0x7c42, 0x1614, 0x8c87, 0x73f8, 0x2b94, 0x85ed, 0xac61, 0xc1c9, 0x65e4, 0xa84d, 0x25ca, 0x4328, 0x8867, 0x3b98, 0xceed, 0xa01b,
+    0xb7e7, 0x1cf6, 0x7c94, 0x993f, 0xd3af, 0x2b78, 0xc349, 0x336c, 0x9051, 0xb509, 0x4bf4, 0xc9c1, 0xb1cd, 0x5ea2, 0x560c, 0x77f6,
+    0x8619, 0x4320, 0xe0cb, 0x582a, 0x1606, 0x31e0, 0x83ff, 0x5c2e, 0x2dd2, 0x6880, 0x1fc2, 0x9d49, 0x5570, 0x7c74, 0xbca3, 0x4192,
+    0x1b30, 0x6332, 0x515e, 0xa515, 0xc14f, 0xd087, 0x38c4, 0x6558, 0xb7b5, 0xe321, 0x577a, 0x7330, 0xa76d, 0x967f, 0x1f08, 0x5b14,
+    0x52ca, 0xae9b, 0x8ebd, 0x6014, 0x9e35, 0xe281, 0xbb9d, 0x882f, 0x5efa, 0x7e06, 0x347a, 0x26d0, 0xbfc5, 0x7f86, 0x98a7, 0x7578,
+    0xe109, 0xa145, 0x3ade, 0xae49, 0x1f40, 0x7d5c, 0xe7c9, 0x547c, 0xb989, 0x7e4e, 0x1168, 0x9d01, 0xacd5, 0x7610, 0x3686, 0x2556,
+    0xa2b7, 0x8cf3, 0x98cb, 0x32c4, 0xa673, 0x2008, 0xe557, 0x36e4, 0xb2a5, 0xe1a7, 0xcdb5, 0x8087, 0x5224, 0x3120, 0xa21b, 0x4a68,
+    0xcaef, 0x5e12, 0xecfd, 0x90dd, 0x6834, 0x235c, 0x4e38, 0xc9d7, 0xe48f, 0xb5db, 0x62d6, 0x2b6e, 0xb2ab, 0x947d, 0xb7cd, 0x2ef8,
+    0xa0dd, 0x8cb9, 0xb96d, 0x73d8, 0x2cd6, 0x46aa, 0xe3d7, 0x1e4e, 0xa53d, 0x48dc, 0xda85, 0x5260, 0x6f48, 0x7efe, 0x3646, 0xaa4b,
+    0x8771, 0x2688, 0xcaeb, 0xe38d, 0xb63f, 0x163c, 0xa781, 0x48ae, 0x2e24, 0x8ad5, 0xe65b, 0x678a, 0x341a, 0x876f, 0xcfb3, 0xa197,
+    0x7170, 0x3684, 0xa3fb, 0xc963, 0x920f, 0x7dc0, 0xcda1, 0x4aa6, 0x22e6, 0x3448, 0xdf6f, 0xadbf, 0x737a, 0xcf91, 0xbbb3, 0x954f,
+    0x22ca, 0xa7f1, 0xd35d, 0x6080, 0x27b8, 0x7d76, 0x4dce, 0xb825, 0xcca7, 0x9989, 0x2308, 0xe205, 0x8705, 0x9279, 0x4214, 0x7e58,
+    0x2ad4, 0x397a, 0x7296, 0x5400, 0xe407, 0xa47b, 0x2a60, 0x9149, 0xbbd5, 0x2a72, 0xc6c7, 0x8e1d, 0xb491, 0x5ee6, 0x1748, 0x7f12,
+    0x6cb8, 0x3ad6, 0xbcc9, 0xc9d5, 0x5002, 0x86e5, 0x1a52, 0xc5cb, 0xa503, 0xd60b, 0x78be, 0xac6d, 0xcced, 0x81b5, 0xd635, 0xa1e3,
+    0x4060, 0x33ae, 0xc773, 0x64ee, 0x79a6, 0x4aa4, 0x3232, 0x6544, 0xd60d, 0x7cca, 0x876b, 0xce17, 0x99f3, 0x3e6e, 0x5d3a, 0x9bb1,
+    0xc425, 0x6734, 0x4070, 0x90c9, 0x7f88, 0x5cb8, 0x8571, 0xa9b1, 0x6a02, 0x2c28, 0xa2ab, 0x355e, 0xae29, 0x5372, 0xd109, 0x61e6,
+    0xa965, 0xb77f, 0x4ef4, 0xb8bf, 0x9d8d, 0xd521, 0x4c04, 0x975b, 0x25ea, 0xe737, 0x5316, 0xba99, 0xe00d, 0x90a9, 0x5704, 0x3dd6,
+    0x6370, 0xc389, 0x49d6, 0xb001, 0x8899, 0x6082, 0xb98d, 0x83d3, 0xe15d, 0x6562, 0x9029, 0x3714, 0x6a86, 0x29a4, 0xd9dd, 0x17c0,
+    0xac6d, 0x932f, 0x31be, 0x8659, 0xb389, 0x6800, 0xe3ed, 0xa8fd, 0x9475, 0x4fb0, 0xc89b, 0x6abc, 0x221a, 0xc403, 0xe6f9, 0x72de,
+    0xa051, 0xb4ad, 0xdf27, 0x24bc, 0x75a6, 0xa41f, 0xe5b3, 0x92db, 0x440e, 0xa319, 0xbf2b, 0x19de, 0xd5a9, 0x6f98, 0xe5bd, 0xb859,
+    0x7072, 0xcb6d, 0x4856, 0x2d88, 0x5232, 0x758c, 0x6b26, 0x3346, 0xc07b, 0xdf35, 0x76f2, 0xa201, 0x5cdc, 0x2246, 0xbf6f, 0x2f5e,
+    0x42e4, 0x7e0e, 0xc9d7, 0x7066, 0xb4af, 0x63ea, 0xa717, 0x224c, 0xc391, 0x32f4, 0x46b4, 0xcaff, 0x2d5e, 0x51a4, 0xe71b, 0xb3b1,
+    0x481a, 0xc87d, 0x5ba6, 0xdc2f, 0x814f, 0x3f9a, 0xd22b, 0x561c, 0x69de, 0x4d3c, 0xaaa1, 0xb8a5, 0x673c, 0x4406, 0xaf91, 0x2ca2,
+    0x784e, 0x9d63, 0xae17, 0x351e, 0xbba7, 0x7ab0, 0xd6a9, 0x9eed, 0x57ac, 0x70e0, 0xa423, 0x7fdc, 0xdaa7, 0x3b98, 0x7596, 0x53b8,
+    0xc00d, 0x3c60, 0xd555, 0x1e22, 0xc053, 0x679a, 0x9e09, 0x3260, 0x5eca, 0x71da, 0x1cc2, 0x9963, 0xce85, 0xe71b, 0x20b8, 0x6ad4,
+    0xd013, 0x76e6, 0x484e, 0x68a2, 0x35bc, 0x7aa0, 0xcdcd, 0x67c8, 0xa8c9, 0x26ee, 0xd183, 0x504e, 0xb7f5, 0x7c3e, 0x24de, 0xb51b,
+    0x568e, 0xca81, 0x1c14, 0xe3f3, 0x6b4e, 0x2f6c, 0x5850, 0x7430, 0xae0b, 0xc609, 0x906d, 0x5038, 0x1322, 0x592c, 0xc3ff, 0x70d2,
+    0xdcf5, 0x54ba, 0x3032, 0x88cf, 0xacdd, 0x990f, 0x11d4, 0x3c96, 0xdb81, 0x7e00, 0x4578, 0x6780, 0x31a0, 0x5fde, 0xb95b, 0xc3c7,
+    0x6888, 0xacd9, 0xc045, 0x8d8f, 0x2d9a, 0xca3d, 0x49d0, 0xdaed, 0x8391, 0x43c4, 0xa1bf, 0x6434, 0x507a, 0xdfa7, 0xab89, 0xc9e3,
+    0x4a7a, 0x8f7b, 0x34aa, 0x730a, 0x9b1d, 0xb209, 0x607a, 0xd29f, 0x3d80, 0x2756, 0xb9d1, 0x5cea, 0x3dc4, 0xad81, 0x2466, 0xc791,
+    0x6850, 0xaea5, 0xeac3, 0x2c0c, 0xa1e5, 0xb915, 0xc095, 0x817b, 0x2764, 0x57d4, 0x4294, 0xa833, 0xf0e9, 0x8313, 0xb209, 0xdfb9,
+    0x7a2a, 0x1b4e, 0xdbff, 0x5672, 0xbc05, 0x2338, 0xe5d5, 0x495a, 0xb1c3, 0x9441, 0xdee1, 0x4e42, 0xc609, 0x8f41, 0x7168, 0x3170,
+    0xd6ed, 0x3002, 0x5ab0, 0xdbcf, 0x37d0, 0x79a8, 0x5934, 0xbffb, 0x3c66, 0x8b83, 0x7ed0, 0xa789, 0x62a8, 0x1d84, 0x7fde, 0xcb81,
+    0x8ea5, 0xe64b, 0x54b0, 0x6b84, 0x1520, 0xd9bb, 0x5026, 0x97df, 0x43cc, 0x13f0, 0x5abc, 0xbf3b, 0x8ce9, 0xce01, 0xac25, 0x5788,
+    0x45c8, 0x6ce6, 0xd0f9, 0x51b8, 0x78f6, 0xccb7, 0x44ce, 0x29d6, 0xbe57, 0x8c71, 0xecb1, 0xb287, 0x9817, 0x4150, 0x8c3d, 0x2e46,
+    0xc67d, 0x3d36, 0x7dba, 0x3ffc, 0x58d6, 0x29a6, 0x50dc, 0x6fc8, 0x23dc, 0x7efe, 0x61ae, 0x3508, 0x8215, 0x4ef8, 0x462c, 0x8da1,
+    0x22ca, 0x1bb4, 0xe02b, 0xb3a9, 0xc1b9, 0x2714, 0xa3cd, 0xd1ad, 0x4126, 0x50c0, 0xb33b, 0x5166, 0x8f13, 0xdd85, 0x6f06, 0xaea9,
+    0x8ce5, 0x5688, 0x96c9, 0x2e92, 0x4908, 0x9b63, 0x4336, 0x6bbc, 0x9a3b, 0x63bc, 0xe5c5, 0x8d11, 0x6fa0, 0xbfa5, 0x9bcd, 0x7f64,
+    0x658a, 0x1b5c, 0xb179, 0x3ca8, 0x983b, 0x6626, 0xba21, 0x85d9, 0x18c2, 0x8b81, 0x3608, 0x27fa, 0x89bf, 0xcf61, 0x9c95, 0xd9ff,
+    0x2102, 0x6a1c, 0x4044, 0x4972, 0xd409, 0x8ae1, 0x3d3e, 0xa8e1, 0x2b5e, 0x21f2, 0xcd77, 0x456a, 0x5cc0, 0x1822, 0xe0a1, 0xaa4d,
+    0x6d8e, 0x7a3a, 0x4f3a, 0x9ee9, 0x5be6, 0x8a7b, 0x85df, 0xc435, 0xdd2d, 0xbce9, 0x8499, 0x47c4, 0x31f8, 0xb111, 0x8be1, 0xb867,
+    0x3838, 0x9e3d, 0xb2bf, 0x5868, 0xe39d, 0x96df, 0x3d4c, 0x7330, 0x5d2c, 0x9855, 0x8897, 0x5c44, 0x4094, 0xe337, 0x6494, 0x3e76,
+    0x8685, 0x81d7, 0x5912, 0xaf4f, 0x49d6, 0xd899, 0xbbed, 0x9f99, 0x700a, 0x7de8, 0x443a, 0xd253, 0xa2c7, 0x8669, 0x266a, 0x3d9e,
+    0x878b, 0xbc95, 0x707e, 0xca1d, 0x52da, 0xdc9f, 0x761c, 0x682c, 0x8981, 0x2e7e, 0xad21, 0xc2bd, 0xcb4f, 0xa6df, 0xdd73, 0x2e18,
+    0x8c39, 0xd1e5, 0x1922, 0x3ac6, 0xa42d, 0x7c0e, 0x3182, 0x60d2, 0xae73, 0xe59d, 0x724a, 0x2d1a, 0x8ccd, 0x3d56, 0x716c, 0x2d1e,
+    0xb191, 0x8ed5, 0xcc3f, 0x1c7a, 0x4cf0, 0x3b44, 0xe823, 0x7f9a, 0x66fc, 0x9417, 0x4dd8, 0x1590, 0x8da9, 0x69ea, 0x4fca, 0xe129,
+    0x8ced, 0x70d4, 0x50fc, 0x5c28, 0x9279, 0xcf4d, 0x71ca, 0x5632, 0xa501, 0xdaf1, 0x387a, 0x62e0, 0xbebd, 0x1ee4, 0x30f2, 0x630c,
+    0x46c2, 0xcc0b, 0xa4c1, 0x3276, 0xb3ef, 0x4458, 0xa23d, 0xc46d, 0x56b4, 0x1cb0, 0x7c30, 0xcd9d, 0x5a84, 0x19ce, 0x9b1b, 0x3db4,
+    0xb6ad, 0x813f, 0x8f8b, 0x6da2, 0x22d8, 0xab85, 0xdfbf, 0x1cfa, 0x6d6c, 0xa24d, 0xc7a5, 0x218e, 0x4b64, 0xde43, 0xb525, 0x6d38,
+    0x21b4, 0x30a4, 0x96df, 0xcf3f, 0x3d78, 0xa535, 0x2e70, 0x71a2, 0xbd45, 0xadfb, 0xd9e9, 0x7db8, 0x39be, 0x4b40, 0xb9af, 0x9145,
+    0xc833, 0x3424, 0xabfb, 0xc1a5, 0x2170, 0x9d1b, 0x6aa6, 0xd531, 0x7a0c, 0x3a1e, 0x544a, 0x3718, 0xd615, 0x4ffe, 0xa29b, 0x6e22,
+    0x5dcc, 0xb6a7, 0x9727, 0xd245, 0xbcff, 0x8b29, 0xc4f3, 0xb127, 0xd567, 0x3732, 0xe08f, 0xb24f, 0xbc0d, 0x2c2e, 0x9d01, 0xc171,
+    0x7f32, 0x9d5d, 0x8ad1, 0x5fca, 0xde19, 0x7a2c, 0x4be2, 0x9789, 0x8655, 0x1338, 0xa03d, 0xd1eb, 0x3930, 0x78c6, 0xa0d7, 0x597a,
+    0xd343, 0x2a1e, 0xae1b, 0xe1df, 0x8c6b, 0xd5fd, 0xbea5, 0x348a, 0xd737, 0xaa6b, 0xba7f, 0x40e0, 0xa5ab, 0x20cc, 0x59c2, 0x34d2,
+    0xd7b1, 0x9217, 0x70ce, 0x60f4, 0xd3a7, 0x22c6, 0x5208, 0xa0d5, 0xc7f7, 0xd831, 0x7b3a, 0xe5dd, 0xa3cd, 0x18ee, 0x6ee8, 0xc0f7,
+    0x5cba, 0xca89, 0x7f9c, 0x19a2, 0xdfc1, 0x5e70, 0x1d82, 0xc27b, 0x7ede, 0xda39, 0x97cf, 0x34ac, 0xc53b, 0x9acf, 0x8c55, 0x2fde,
+    0xcc6f, 0x2358, 0x7078, 0xebbf, 0xbf83, 0x3eaa, 0xb043, 0x2662, 0x6ea2, 0x5558, 0xa4dd, 0xc5d1, 0x60b6, 0x767a, 0x3cbe, 0x5eca,
+    0xe1d3, 0x4248, 0x89e9, 0x1f76, 0xc613, 0xa4c3, 0x299a, 0xb85d, 0xe52d, 0x3e42, 0xc38b, 0x96db, 0x1cc0, 0xa445, 0xb447, 0xd6cf,
+    0x2f4c, 0xc7ab, 0x9cd1, 0x2a6e, 0x84fb, 0x9855, 0x1dca, 0x3ade, 0xe3af, 0x252c, 0x5990, 0x3318, 0xbe7b, 0xe709, 0x6860, 0x9039,
+    0xda15, 0x9dd3, 0x18f8, 0x5760, 0xbb75, 0x3234, 0xa5bb, 0xb109, 0x6138, 0xe265, 0x9abd, 0x77fc, 0x3b18, 0x4efe, 0x1cce, 0x694a,
+    0x57dc, 0x5016, 0x7a10, 0x650a, 0xdcef, 0xb473, 0x6fd8, 0x9209, 0x1cc2, 0x544e, 0x3a80, 0xcadf, 0xbb19, 0xd619, 0x6562, 0x9c97,
+    0xe735, 0x56f4, 0x6ca0, 0xd717, 0xae21, 0x71c4, 0x8af9, 0x2a14, 0xafe3, 0xbba9, 0x8415, 0xe203, 0xd6af, 0x4474, 0x2af6, 0x7f3c,
+    0x396c, 0x189a, 0xb901, 0xd7c9, 0x3132, 0x1b56, 0x3f14, 0xe14f, 0x370c, 0x9699, 0xb2f9, 0x1a9a, 0x7168, 0x5356, 0xa751, 0x9159,
+    0xbe91, 0x769e, 0x59b8, 0x89cd, 0xde51, 0x62bc, 0x7058, 0x2d3e, 0x7b2c, 0xba5b, 0x8e21, 0x2984, 0x67e0, 0xab77, 0xe2f5, 0x7724,
+    0xc16f, 0x492c, 0x1e04, 0xca4b, 0xbacd, 0x8a71, 0x626e, 0x937d, 0xd6cb, 0x5dcc, 0x3a46, 0x6808, 0xbd3d, 0x3908, 0x9f69, 0x4404,
+    0xbb8d, 0xabbf, 0x656e, 0xb6d9, 0x7eac, 0x9253, 0xc707, 0x6650, 0x8765, 0xd0ab, 0x25b2, 0x8fe9, 0xaed7, 0x28ba, 0x7312, 0x2380,
+    0xdaff, 0x6626, 0x80f1, 0xe139, 0x392e, 0x8d93, 0x5028, 0xb3dd, 0x18c2, 0x9e49, 0x6f46, 0xb615, 0x86a5, 0x603a, 0x1d2e, 0xe309,
+    0x859b, 0x287e, 0x4dbc, 0x6ce6, 0xe087, 0x3a80, 0x11f8, 0x67de, 0xbfd3, 0x7964, 0x4cce, 0x91c5, 0xca15, 0x6e24, 0xe0e7, 0x3d12,
+    0xc76f, 0x513e, 0x6452, 0x3d3e, 0x9be9, 0x1eb8, 0xbee7, 0x6b0a, 0xe431, 0x6b96, 0x7ef8, 0x2678, 0xc143, 0x88a3, 0x3cf4, 0xc5d5,
+    0x2558, 0xb4f3, 0x7b46, 0x3a9c, 0x619c, 0x19bc, 0x5a16, 0x7c18, 0x4e5e, 0x605c, 0x2994, 0x75b0, 0x5db2, 0xcf4b, 0xa685, 0xbb85,
+    0x5194, 0xa951, 0x2d80, 0xc137, 0x8be7, 0xaca1, 0xd95f, 0x4036, 0x6456, 0x2d54, 0x58c6, 0x54b6, 0xc133, 0x3e80, 0x5374, 0x8451,
+    0x2fb0, 0xe8df, 0xba37, 0xa439, 0x9861, 0x707e, 0x4508, 0xa273, 0x67ca, 0x537a, 0xb99f, 0x6b0c, 0xb80d, 0x4f6c, 0x78ac, 0xc517,
+    0x48c6, 0x9385, 0xabcf, 0x6686, 0x74ac, 0x2d7c, 0xdf3b, 0x4d32, 0x9441, 0x385c, 0x2194, 0xd48f, 0x951b, 0xd6e5, 0x1db4, 0x9845,
+    0x87d1, 0xbf83, 0x5516, 0x6eca, 0x841d, 0x6192, 0xce83, 0x4fe2, 0x8feb, 0x678e, 0x2f24, 0xb793, 0xd53f, 0x5940, 0x7d88, 0x4a66,
+    0x9421, 0x6eee, 0x3ea8, 0xbfed, 0x75ee, 0x6544, 0xcba1, 0x4c90, 0x97f1, 0xcc63, 0xb71b, 0x92bd, 0x74a6, 0x3dc0, 0xa40f, 0x21b8,
+    0x5b34, 0x3768, 0xa339, 0x41e2, 0x8e6f, 0x6046, 0xcef9, 0x3a6a, 0xc3c1, 0x4734, 0x1540, 0x5a94, 0x8d7b, 0xdcad, 0x839f, 0xb493,
+    0x9edd, 0xe879, 0xc021, 0x8d95, 0x54d4, 0x1eb0, 0xc779, 0x869d, 0xb8fb, 0xd4d9, 0x8e11, 0xa9a9, 0x1ec0, 0x80a7, 0x4e00, 0x39fe,
+    0xbe19, 0x24ee, 0x792a, 0x42fc, 0xba57, 0xcc0b, 0x20f6, 0x4972, 0xdc15, 0x587c, 0x3138, 0x7a0c, 0xa36b, 0xb07f, 0xc01f, 0x9f59,
+    0xaaad, 0xc813, 0x9e19, 0x84bf, 0x57a4, 0xabbb, 0x7b1e, 0xa269, 0xbf7b, 0x6d96, 0x8795, 0xcceb, 0x9585, 0xdf1b, 0xcd23, 0x224c,
+    0xf07f, 0xaf61, 0x2012, 0x7ca4, 0xc7bf, 0x18e0, 0x93f9, 0xcdf1, 0x3a7c, 0x63e0, 0xe25f, 0x4556, 0xbadb, 0x816f, 0x4ea6, 0x2576,
+    0x6848, 0xe529, 0xa441, 0x80c1, 0x53e4, 0x400e, 0x307e, 0xacdf, 0x3102, 0xb7cd, 0xd275, 0x9d89, 0x8625, 0x74ba, 0xd9ed, 0x56dc,
+    0x8231, 0xde99, 0x3586, 0x20e0, 0xd289, 0x6138, 0xe503, 0x3a84, 0x2732, 0x50f4, 0x3efa, 0x625c, 0xea41, 0x6f8e, 0xd313, 0x81fd,
+    0x5a2a, 0x99e7, 0x16a2, 0x59a8, 0x7146, 0xad7d, 0x3214, 0xc3fd, 0x62dc, 0xdd01, 0x2d08, 0x4790, 0x8f51, 0xd413, 0xbc2d, 0x4558,
+    0x9aef, 0xd783, 0xa973, 0x1c48, 0xa601, 0x7ece, 0x5416, 0x9489, 0x4684, 0x9ccf, 0x1c7c, 0x5eca, 0x4568, 0x212c, 0xa6d9, 0x5400,
+    0x66aa, 0xaf4f, 0x3600, 0xcf83, 0x9361, 0x6e9e, 0x3ca8, 0xa7fb, 0x3238, 0xc00d, 0xd0c7, 0x41a2, 0x57d8, 0xb79d, 0x2ce4, 0x6e68,
+    0x93f5, 0x66e4, 0xcc37, 0x53e6, 0x94bf, 0xa521, 0xe3cf, 0xb879, 0x89e1, 0x2164, 0xc2d1, 0x9f27, 0xdffb, 0x48d6, 0x8bc5, 0x70b4,
+    0x4094, 0xca5d, 0x5362, 0xa1a3, 0x444c, 0x77b0, 0x2984, 0x8e33, 0xc269, 0x80fb, 0xb699, 0x923b, 0x6a38, 0xdf59, 0xb037, 0xa6bf,
+    0x4448, 0x9187, 0x3a9e, 0x5166, 0x3048, 0xb933, 0x84f1, 0xe7df, 0xb2f7, 0x3aca, 0x8605, 0x21e8, 0xe96f, 0x5ebe, 0x3522, 0xa283,
+    0x5da2, 0xb8e5, 0x3cea, 0xc753, 0x2168, 0x652c, 0xa8ed, 0x8629, 0xcea5, 0xecd3, 0x6a40, 0x7a1e, 0x2a18, 0x5636, 0xb0f1, 0xcf83,
+    0x6c90, 0x2a1c, 0xd7eb, 0xadab, 0x466e, 0x3578, 0x9771, 0x1a08, 0xdcd1, 0xa9ff, 0x3fa6, 0x782c, 0x8d63, 0x25dc, 0x6bfa, 0x31f0,
+    0xb7a5, 0xd5cf, 0x5094, 0xe475, 0x392c, 0xaa8d, 0x8951, 0x2c9e, 0xa539, 0x7a9a, 0x5c0a, 0x462e, 0xcf99, 0x78ec, 0x59ca, 0xc5ed,
+    0xb8d7, 0x8cc3, 0xece3, 0xd107, 0x758c, 0x7b5a, 0x21a6, 0x4a62, 0x89b5, 0x9a9b, 0x7418, 0xcf51, 0x32c2, 0xb6d3, 0x474c, 0xc681,
+    0x3d40, 0x1eb0, 0x351a, 0xcc41, 0x9dbb, 0x430e, 0xe3df, 0x348c, 0x45d8, 0x6d2c, 0x9a17, 0x5928, 0x46fa, 0xc261, 0x9115, 0x17f4,
+    0x74a6, 0x9069, 0xa5c5, 0x2c64, 0x5c98, 0x8a73, 0x92a9, 0xc385, 0xa577, 0x3eba, 0xc859, 0x89c5, 0x2288, 0x5c38, 0x7258, 0xe431,
+    0x60e2, 0x265e, 0x4346, 0x6ddc, 0xbd0f, 0xe175, 0x8c85, 0x6176, 0x1ad8, 0x4466, 0xae33, 0x3bba, 0x5c30, 0x4b5a, 0x84d1, 0x30b4,
+    0x55a0, 0x99cb, 0x46a4, 0x3f84, 0xa795, 0x4f4e, 0xe495, 0xac07, 0xacdd, 0x5276, 0x9847, 0xa47d, 0xcab1, 0x2240, 0x8eb3, 0xd0ab,
+    0x9f6f, 0x57dc, 0x390c, 0x6cfe, 0xe329, 0xd091, 0xa1d1, 0x7b92, 0x8049, 0x497e, 0x447a, 0xa873, 0x2b42, 0x5298, 0xb0cb, 0x1658,
+    0x9015, 0x5392, 0x85bf, 0x6c2a, 0x471a, 0x9b09, 0x1fde, 0xab7f, 0xcccf, 0x9da7, 0xba5b, 0x81bb, 0xa481, 0xbbcf, 0x452e, 0x377a,
+    0xc17f, 0xb225, 0x482e, 0x9873, 0xbbb9, 0xde5b, 0x7832, 0x4fde, 0x87db, 0x9d11, 0xccbb, 0xa70f, 0x23d4, 0x75c8, 0x31f8, 0xa9b3,
+    0x4a5a, 0x646e, 0x7b50, 0x2e52, 0xbf6d, 0x677e, 0xd231, 0xeebf, 0xb5f3, 0x72f8, 0xca69, 0x9abd, 0xd829, 0x84b3, 0x787c, 0xd88f,
+    0x8d2b, 0x2784, 0xe44b, 0xad5b, 0x5436, 0xbc39, 0xde4f, 0x5062, 0x5582, 0xa5c3, 0x7452, 0x943f, 0x6476, 0xa2bd, 0xe9b1, 0x8f0b,
+    0x45cc, 0x7fea, 0x31fe, 0xae6f, 0xc6bb, 0x23ca, 0x6c3e, 0x45f2, 0xa07d, 0xd9db, 0x6208, 0x366e, 0x6a5a, 0x28a8, 0xaedd, 0x257a,
+    0xe5cb, 0x8141, 0x1fba, 0xdce7, 0x36da, 0xd0db, 0x6f22, 0x5744, 0xe70d, 0x478e, 0xa80f, 0x25e6, 0x1c74, 0x7bba, 0x3aa8, 0xc7af,
+    0x1eea, 0xd285, 0x7a28, 0x64a0, 0xd663, 0xcc0d, 0x32da, 0x1dae, 0xc4d3, 0x2dea, 0xd5b1, 0xa1ed, 0x96eb, 0x288a, 0xcb67, 0x7cb2,
+    0xdf27, 0x82b1, 0x2560, 0xa1c5, 0xd321, 0x963d, 0x4630, 0x5af0, 0x182a, 0x9f69, 0xb055, 0x4442, 0xbf67, 0xa055, 0x34de, 0x4df4,
+    0xa7e3, 0x5e00, 0x9915, 0x1fc0, 0xdf99, 0xcc5d, 0x6770, 0x7d6a, 0xbf53, 0x5a9a, 0x2260, 0xcc85, 0x5612, 0xb82d, 0xf03f, 0xc803,
+    0x8819, 0x62a4, 0x1db4, 0x7206, 0xa1f7, 0x4978, 0xde11, 0xbda7, 0x72c2, 0x358c, 0xd5ad, 0x1c54, 0xa433, 0x2d10, 0xda01, 0x4b4a,
+    0x7256, 0x63c8, 0x2776, 0x4fac, 0xb60f, 0xb1b5, 0xe1d3, 0x985f, 0xbd4b, 0x2e3e, 0xdb69, 0xaeb1, 0x6712, 0x7aaa, 0x2536, 0x61ba,
+    0xa6ad, 0x7774, 0x8f21, 0x7032, 0x2b6c, 0x56d2, 0x9667, 0xa1a7, 0x268a, 0xd6b1, 0x7c10, 0x23e8, 0xdfd1, 0x76a4, 0xd9c5, 0xb777,
+    0xd2d5, 0x4ef6, 0xead1, 0xc62d, 0x507e, 0xdef7, 0x3450, 0x7552, 0x5ee6, 0x1c14, 0xe755, 0x6796, 0x4ace, 0xd463, 0x1f72, 0x3468,
+    0x4d74, 0x7c4a, 0xe271, 0x9e83, 0x2376, 0x4788, 0x3be0, 0xc8c3, 0xa2b7, 0x5e02, 0xe291, 0x2e1a, 0xbdeb, 0xa49f, 0x67c6, 0x7a0a,
+    0x18a8, 0xccf5, 0xbdbb, 0xdbbb, 0x7980, 0x2fa0, 0x5c22, 0x3e28, 0x73d6, 0xd12d, 0x3092, 0x6ce6, 0x3eba, 0x5d62, 0xad43, 0x3746,
+    0xc4e7, 0x86a1, 0xb365, 0x2aa6, 0x994f, 0x22ae, 0x6480, 0xc6b7, 0xe477, 0x1e3c, 0x8ae3, 0x685c, 0xdd2b, 0xcc37, 0x3f88, 0x68d6,
+    0xc43f, 0xa569, 0xd933, 0xb439, 0x2d88, 0xbdf1, 0x5e1c, 0x9043, 0x77d0, 0x6d7a, 0xe1c7, 0x2fcc, 0x11e2, 0x5a1e, 0x900f, 0xac15,
+    0x7914, 0x31b2, 0xe91d, 0xccb3, 0x27cc, 0x61c0, 0x204e, 0xe2db, 0xbd05, 0x3fc6, 0x64ea, 0x6280, 0xe1c3, 0x9f7b, 0x567e, 0x733e,
+    0x8bdd, 0xc807, 0xe67b, 0x4504, 0x9657, 0x74ae, 0x2e2c, 0x1e52, 0x8367, 0x35de, 0x50c2, 0x2a0e, 0xb8ad, 0x5a26, 0x1134, 0x3a84,
+    0xb1db, 0x9789, 0x7f8c, 0x439e, 0x20fe, 0x65f6, 0x7cc6, 0xa31f, 0x878b, 0x213c, 0x37b4, 0xd90b, 0xb1cf, 0x1ab4, 0x7c7c, 0x5796,
+    0xc01d, 0xe321, 0xa02f, 0x4dfe, 0x7864, 0x33d0, 0x6282, 0xc933, 0x2fb0, 0x7c9a, 0xbdfd, 0x906d, 0xbc89, 0x805f, 0xd45b, 0x5b60,
+    0x9d0f, 0x690c, 0xb513, 0x8ead, 0x5f28, 0xb85f, 0xbd11, 0x1c46, 0x9e0b, 0x359a, 0xcdcf, 0x7b1c, 0xc849, 0xbb71, 0x8db3, 0x6864,
+    0x684c, 0xa147, 0xb28b, 0x1f7e, 0x4a1a, 0xa2ad, 0x50ce, 0x8ad9, 0x6530, 0x738e, 0x5b2a, 0x4616, 0x830d, 0xb969, 0x4698, 0xa6f7,
+    0x1a6a, 0x65d4, 0x4698, 0x868f, 0x583e, 0xb667, 0xdb19, 0xbeb3, 0x73d0, 0x31fa, 0x5c26, 0x8693, 0xe1b3, 0x752a, 0x790a, 0xd8eb,
+    0x8fa3, 0x2df2, 0xb905, 0x59a2, 0x7b62, 0xa4df, 0x2f12, 0x9129, 0x4434, 0x7320, 0xa08f, 0xe661, 0x7f3a, 0x3cc4, 0xa6c1, 0x4222,
+    0x17d6, 0xaa9f, 0x95cf, 0x7f70, 0xce3f, 0x1880, 0x55ac, 0x672e, 0xc585, 0x26fa, 0x9c43, 0x8c03, 0xc145, 0x66dc, 0x9597, 0x9b77,
+    0x2f7a, 0xc339, 0x81af, 0x95ad, 0x1f82, 0x3616, 0x4a2a, 0x761e, 0x656c, 0xaddb, 0x3ebc, 0x4dd4, 0xbef5, 0x9dd3, 0xda95, 0x8ee5,
+    0xd43d, 0xba65, 0x5202, 0xe2e7, 0xad7f, 0x8071, 0xd0cd, 0x78ba, 0xbc7b, 0x4828, 0xb021, 0x379a, 0xa23d, 0x8711, 0x2d58, 0x5ad6,
+    0xa6eb, 0x3214, 0x8ddf, 0x6b68, 0x1698, 0xa77d, 0x3d24, 0xd439, 0x7f98, 0x930d, 0xabf5, 0x3a5a, 0xb69b, 0xa33b, 0xc291, 0x8ac1,
+    0xb9a1, 0xd049, 0x96df, 0x33bc, 0xc01b, 0x6b0e, 0xb421, 0x2dc0, 0x82c1, 0xd2cd, 0x80b5, 0x91e5, 0x233a, 0xb57d, 0x319a, 0xda77,
+    0x85a5, 0x62be, 0x2b58, 0x6eb2, 0x90ff, 0xb87f, 0x84eb, 0x24c4, 0xbbc5, 0x1d20, 0x79f4, 0x5a78, 0xe61f, 0xbcf7, 0x7a16, 0x423e,
+    0x6764, 0x195a, 0xd4a7, 0x5dd8, 0xc485, 0x8ae7, 0x4818, 0x38f4, 0x5eba, 0xa6db, 0xd719, 0x7d46, 0x20f2, 0x9c55, 0x8f1b, 0xe9f9,
+    0x3328, 0x1ae8, 0x5af8, 0xcd2d, 0x94b7, 0x850b, 0x4ca2, 0xd72b, 0x4054, 0x207a, 0xc271, 0x4de8, 0x7b68, 0xc835, 0x2bce, 0xdbc3,
+    0x6350, 0x6428, 0x86a1, 0x5292, 0x3cf0, 0x8903, 0xa38b, 0x59d4, 0x3554, 0x7052, 0x26ca, 0xb17d, 0x8ccd, 0x41f8, 0xd523, 0xbb7b,
+    0x1c40, 0x2cd8, 0x89db, 0xace9, 0x5022, 0xce87, 0xa677, 0x4702, 0x5fde, 0xdd05, 0xc677, 0x80d1, 0xea93, 0xa2cb, 0xba1f, 0x4a24,
+    0xce93, 0x6fa8, 0x58b2, 0xc305, 0x8de5, 0xc611, 0x1e5a, 0xcf13, 0x4b76, 0xdd55, 0x837b, 0x31f8, 0xc309, 0x4a48, 0xd103, 0xa9c7,
+    0x32f0, 0x1536, 0x6baa, 0xd3d3, 0x8db7, 0xe7a9, 0xc0f3, 0x99fb, 0x4f12, 0xade1, 0x487a, 0x217c, 0xda75, 0x52ba, 0x9c71, 0x3822,
+    0xc127, 0x48e0, 0xa1e5, 0x2a96, 0x4a38, 0x9b5f, 0x3f06, 0x783e, 0x8f75, 0x6724, 0x4e18, 0xde57, 0x89fd, 0x536e, 0x4898, 0xe2e3,
+    0x2a04, 0x54c6, 0xc2d9, 0x89af, 0xe2cd, 0x7d10, 0x7094, 0xd3cd, 0x9ceb, 0xc54f, 0xa47f, 0x3912, 0xcd45, 0x5f50, 0x843b, 0x541a,
+    0x91ef, 0xdb03, 0xc4a9, 0xabbf, 0x73e8, 0x313e, 0x1ff2, 0x5106, 0xca61, 0x9161, 0xd2b9, 0x4d6a, 0x290c, 0x8eb1, 0x5c58, 0x1b78,
+    0xbb5f, 0x43b8, 0x81c5, 0xd1cd, 0x8a39, 0x4ba2, 0xb473, 0xeb11, 0xc495, 0x331e, 0xb283, 0x6a4a, 0x14f2, 0x558e, 0x9d95, 0x75a6,
+    0x5596, 0xc087, 0xe137, 0x3c62, 0xb899, 0x9703, 0x8a13, 0x3cb0, 0x9a75, 0xb02b, 0x528c, 0xe259, 0x43f4, 0x54ce, 0xbdb9, 0xd6e3,
+    0x16be, 0xa56f, 0x570e, 0xd9d5, 0x6810, 0x9c65, 0xcb27, 0xd6bf, 0x3184, 0x5890, 0x814b, 0x8af7, 0x13c6, 0x338e, 0x567a, 0x69ae,
+    0x1822, 0x56be, 0x3d90, 0x853b, 0x1bca, 0xb757, 0x3d28, 0x96cb, 0x60c4, 0x7a36, 0x99cb, 0xca3b, 0x55be, 0xa79b, 0x43a0, 0x790c,
+    0x6698, 0x210a, 0xb223, 0x79b2, 0x9dc3, 0xbb61, 0x57f4, 0xadef, 0x2568, 0xbf7b, 0x568c, 0x6f38, 0xce6f, 0x7e9c, 0x470c, 0x9ed5,
+    0x6a32, 0x1c04, 0xa86d, 0x573a, 0x8d81, 0x789e, 0xebd3, 0x9793, 0x3fb6, 0x37b0, 0xbcb9, 0x630a, 0x7a4a, 0xe3e1, 0x4df6, 0xb301,
+    0x38a6, 0x9fc9, 0x85c9, 0xe08d, 0x237c, 0xc76b, 0xd9fb, 0x9dc5, 0x927b, 0xb42f, 0xd19d, 0xa8cf, 0x9277, 0x1f4c, 0x4f2c, 0xdf21,
+    0xab8f, 0x94af, 0x7624, 0x41b6, 0xaa9b, 0x7fde, 0xd981, 0xb90d, 0x9337, 0x7114, 0x3490, 0xbcfd, 0x4640, 0x6b9e, 0x62d4, 0xae29,
+    0x8161, 0x3eec, 0x76bc, 0x6840, 0x3b6c, 0xdfd3, 0x33b4, 0xbe6d, 0xa437, 0x5ec8, 0x896f, 0xb4e1, 0xd89d, 0x730a, 0x80c9, 0x518a,
+    0xc1bf, 0x1d66, 0x8d7d, 0xb091, 0xd141, 0x7904, 0xc579, 0x9cd1, 0xb2ab, 0xd533, 0x9223, 0x51ca, 0xc4c5, 0x22cc, 0x6348, 0x88a5,
+    0xa3f7, 0xca1b, 0x5d58, 0x6ce8, 0x167a, 0xe37d, 0x8677, 0xb85d, 0x98df, 0x7e72, 0xa803, 0x38d4, 0x6506, 0x31ae, 0x9453, 0x631a,
+    0xd86b, 0x337a, 0x177c, 0xdffd, 0xb549, 0x3e16, 0x9409, 0x702e, 0xb8c7, 0x7e16, 0xb71b, 0x50b4, 0x6ee4, 0x8087, 0x2942, 0x7164,
+    0x5cd4, 0x9439, 0xbb07, 0x54f0, 0x1f48, 0x9f01, 0x4574, 0x7f16, 0x181c, 0xe5cb, 0x8b77, 0x5f16, 0xae23, 0x6ad6, 0x190a, 0x822b,
+    0x5728, 0xd837, 0x7594, 0xcda7, 0x85af, 0xe181, 0x26ae, 0xc789, 0xdb95, 0xab29, 0x18de, 0x9687, 0x3864, 0x2c48, 0xaa5f, 0xc4db,
+    0x7d34, 0xd449, 0x4064, 0x5dec, 0x90bb, 0x347a, 0xac85, 0x279e, 0x434e, 0xde6b, 0x1bac, 0x6e12, 0xdf41, 0x2f94, 0xb2cb, 0xa307,
+    0xcb59, 0x3656, 0x59b0, 0x1d0c, 0xe911, 0x9005, 0x5d68, 0x83c9, 0xab9b, 0x2950, 0x7314, 0xab2f, 0xbfe9, 0x418a, 0xd151, 0xa185,
+    0x5b18, 0xe8c1, 0xa21d, 0x3af8, 0x2388, 0x6774, 0x56ac, 0x1d8e, 0x5fb6, 0x4b60, 0xd25d, 0x959d, 0xb9cb, 0x38ae, 0xdf5d, 0x6df2,
+    0xc7fb, 0x324a, 0x47ae, 0x5886, 0x6828, 0x26ee, 0xe52f, 0x3766, 0xcf87, 0x7e5e, 0x6124, 0x769a, 0xac6f, 0x21dc, 0x7ae0, 0x522e,
+    0x6c22, 0xb4f7, 0x4388, 0xe0bf, 0x303e, 0x5cf4, 0x889f, 0x1ae6, 0xa1fd, 0x9d33, 0xed5b, 0xd821, 0x7266, 0xc071, 0xe6e5, 0xb2a7,
+    0x30ee, 0x9aeb, 0xc997, 0xda71, 0x616a, 0x9af7, 0x4bda, 0x2df2, 0xe215, 0x1d36, 0xba1d, 0x64a0, 0x6f7c, 0x22be, 0xe4fd, 0xa19d,
+    0xcd33, 0xdd87, 0x580e, 0x4448, 0xd411, 0x2d58, 0x8b43, 0x705c, 0x429c, 0xe053, 0x9bd3, 0x167a, 0x298c, 0x5a54, 0x8b6f, 0x268c,
+    0xd52d, 0x741e, 0x4af0, 0x3e12, 0xd0ad, 0x27a6, 0x51b4, 0xabf5, 0x6b80, 0xb31b, 0x8cff, 0x5164, 0x3cde, 0x9719, 0x6aba, 0xc97f,
+    0x70bc, 0xc1e5, 0x42a6, 0x5866, 0x9c97, 0x38ac, 0x4892, 0x7914, 0x5462, 0x67d8, 0x2f96, 0x4780, 0x6f38, 0xd1ab, 0x8839, 0x9ed3,
+    0x2670, 0xc703, 0x5470, 0xe415, 0x33e2, 0x4b6a, 0x1cd4, 0x820f, 0x2706, 0xc8ed, 0x525a, 0xa5db, 0xad7d, 0x2eae, 0xd6e3, 0x4f7e,
+    0xbca3, 0xa42b, 0xdf59, 0xb3e3, 0x1854, 0x9189, 0x6838, 0x9b6d, 0x25f4, 0xde8b, 0x3c46, 0x96d9, 0x2cf8, 0x9f1d, 0x4384, 0xb3eb,
+    0xa41d, 0xd1fb, 0x3f26, 0xbb91, 0x3388, 0x57d0, 0x22e6, 0x416e, 0x7fda, 0x1aea, 0xde39, 0x3b08, 0x9b87, 0xabcd, 0x3530, 0xe4a9,
+    0x4c1a, 0x3dda, 0x9cdb, 0xd40b, 0x2880, 0x8b01, 0x3db0, 0x64f2, 0x21cc, 0xc823, 0x8f4f, 0x162c, 0x4b6e, 0x7c9e, 0xc5a5, 0x2496,
+    0x8977, 0xa379, 0x4d26, 0x991d, 0x727c, 0x2c00, 0xad49, 0x4b38, 0x24ea, 0x5c04, 0xa413, 0x9677, 0xe503, 0x45e4, 0x9815, 0xbdd9,
+    0xdd5f, 0x854b, 0xc54b, 0x3e1a, 0x721c, 0xa877, 0x2d38, 0xd3c1, 0x6a84, 0x432c, 0xbffd, 0x3576, 0xc893, 0x47fa, 0xdf13, 0xc3a9,
+    0x2e08, 0x7a2e, 0x1818, 0xb5cb, 0x376c, 0x5e56, 0xa083, 0x61c2, 0x2f36, 0x54b4, 0xb533, 0x6586, 0x7078, 0xcd67, 0xa7f3, 0x6722,
+    0x1826, 0x9691, 0x36de, 0xa20b, 0x253a, 0xc433, 0x567e, 0xa067, 0x818b, 0x3588, 0x896b, 0xb12d, 0x98f1, 0x6448, 0x234c, 0x6e50,
+    0x3c58, 0xa6b3, 0x7bda, 0x3f0e, 0xceb7, 0xa341, 0x42da, 0xd98d, 0xa05f, 0x44e2, 0xdf49, 0x210e, 0x6414, 0x8267, 0xb35f, 0x24e6,
+    0x71fc, 0x92f5, 0x68b8, 0xb58d, 0xcf7d, 0xafdd, 0xdf6f, 0x9815, 0x8c73, 0x9ff7, 0x2222, 0x70fc, 0x4a00, 0xa889, 0xd54d, 0x2626,
+    0x9321, 0x9fe7, 0x8167, 0xdb1f, 0xc73b, 0x75b0, 0xb367, 0xa0fd, 0x58c6, 0x15aa, 0xbc03, 0x35ee, 0xd4df, 0x9149, 0x3ee8, 0xe45b,
+    0x6530, 0xc96d, 0x8e45, 0x7e22, 0xb989, 0xb0b9, 0xcfbd, 0x4ec4, 0x78cc, 0x415e, 0x2524, 0xa9f9, 0x5dc0, 0xa221, 0x432e, 0x957b,
+    0xd38d, 0x7d54, 0xa481, 0x2582, 0x4510, 0xce29, 0x89eb, 0xd197, 0x761a, 0xa1cf, 0x4928, 0x2ff2, 0xd19d, 0xba75, 0x94ad, 0x2816,
+    0x4de4, 0x8f6b, 0x2eb4, 0xbedd, 0x86ab, 0x5faa, 0xede1, 0xcdbb, 0x315c, 0x5d18, 0x8ceb, 0xd425, 0x703c, 0xed2d, 0xaf33, 0x32dc,
+    0x5726, 0xc311, 0xe4fd, 0x978f, 0xa663, 0xb9d3, 0x645c, 0xd6af, 0x1ae4, 0xc645, 0x26e6, 0xd7c7, 0xaded, 0xc915, 0x14fe, 0x59fa,
+    0x30f4, 0xd659, 0x25a4, 0xb113, 0x7682, 0x5fd8, 0x2b94, 0xd97b, 0x4724, 0xe4f5, 0x24de, 0xc5ed, 0x9787, 0x308e, 0xc1db, 0x62ac,
+    0x33cc, 0x5ac8, 0xb4c5, 0x87eb, 0xa153, 0x69ae, 0xd1e9, 0xa63d, 0x43ba, 0xe8c3, 0x66ea, 0x8bd9, 0x4008, 0x7982, 0xc7f7, 0x1632,
+    0x6db6, 0x87d9, 0x2a7e, 0x4e0a, 0xa529, 0xd7db, 0x55b8, 0x79a2, 0xc8b5, 0x4cd4, 0x715c, 0xc989, 0x4b7a, 0x662e, 0xe211, 0x7516,
+    0x1f2c, 0x56e4, 0x66c0, 0x7b1c, 0x9443, 0xbcdb, 0xdf33, 0x70c2, 0xc8a3, 0x5e30, 0xaae1, 0x6af8, 0x7a88, 0xddcb, 0x542a, 0x98cf,
+    0x7324, 0xbdd3, 0x623a, 0x85c7, 0xae8f, 0x5c76, 0xc409, 0xdac3, 0x2c2e, 0x470c, 0x5bee, 0xaeef, 0xe179, 0xd319, 0xaa7d, 0x5608,
+    0xb695, 0xe7d1, 0x6dd2, 0xc97d, 0x484a, 0x60dc, 0xebfd, 0x89b7, 0xdb1f, 0xc909, 0x316e, 0x16e8, 0x8269, 0xb94f, 0x668a, 0xc941,
+    0x231a, 0x41e0, 0x32ca, 0x95d1, 0xcc4d, 0x68f4, 0xb491, 0x6374, 0x9649, 0xaf19, 0x7e22, 0x8687, 0x5c74, 0x9201, 0x6940, 0xb2e3,
+    0x983f, 0xa683, 0x4664, 0x695a, 0x906d, 0xd019, 0x7894, 0x49da, 0x911f, 0x8283, 0xec29, 0xc6ff, 0x8e89, 0x26d0, 0xd9e9, 0x49ca,
+    0x8989, 0xbced, 0xe943, 0x792a, 0xbbe1, 0x709a, 0xdae9, 0x6132, 0xc32f, 0x6292, 0xd1cd, 0x54d2, 0x40ac, 0xca6b, 0xe4af, 0x4bd8,
+    0x645c, 0xdefd, 0x9c59, 0x53b6, 0xbab7, 0x6e86, 0xc711, 0x1fec, 0xb117, 0x7666, 0x5d74, 0x8c41, 0xa3f5, 0xe14b, 0x48b0, 0x8703,
+    0xd6cd, 0x30e6, 0x455c, 0x1c36, 0x814f, 0x417e, 0x7652, 0x3586, 0xcb47, 0x8467, 0x5004, 0xe239, 0xba65, 0x5d7a, 0x82a9, 0x49a8,
+    0xb859, 0x6f9c, 0x1636, 0x4292, 0x9465, 0x2bf8, 0x4788, 0x751c, 0xdb6b, 0x8b15, 0x49d0, 0xa67b, 0x6ef6, 0x51ce, 0xc133, 0xa333,
+    0x23a6, 0x314a, 0x5552, 0x16ca, 0x4792, 0x7176, 0x3566, 0x8e87, 0xc293, 0xc2d9, 0x682c, 0x4b28, 0x2fd2, 0x82bf, 0x18d8, 0x7b12,
+    0x4a5c, 0x650c, 0x3aa6, 0x89a3, 0x7014, 0xb0ff, 0x2f82, 0x4864, 0xb1f3, 0x78ce, 0x9aa1, 0xd82f, 0x5e2e, 0x806d, 0x3748, 0xb6d9,
+    0x7a92, 0xa683, 0x6c94, 0xa645, 0x4384, 0x1992, 0x9821, 0x7e40, 0xad99, 0x3ed4, 0xc565, 0xa759, 0x4c2c, 0xbea5, 0x6522, 0xc8c1,
+    0x99cb, 0x855f, 0x2d4a, 0x675a, 0x1f04, 0x76d8, 0x3e14, 0x8e23, 0x589e, 0x80e1, 0x47f4, 0x6914, 0xb8d5, 0x304a, 0x7e82, 0xf145,
+    0x95a5, 0x81e5, 0x5972, 0xd6e7, 0x9e5f, 0xcf4d, 0x7e42, 0xb3a3, 0xbda7, 0xa6a1, 0x853f, 0xb3bd, 0x5f70, 0x3bba, 0xb1fd, 0x7b3c,
+    0xdfc3, 0x94e1, 0x6998, 0x2034, 0xce9b, 0xbee9, 0x7574, 0x4c1c, 0xb85b, 0x7b30, 0x1b5c, 0xce2f, 0xd9a7, 0x5e24, 0x989d, 0x3186,
+    0xcd7d, 0x6716, 0xc5a9, 0x38a8, 0x82c9, 0xc1ed, 0x429e, 0x2948, 0x92e7, 0x6934, 0x9ee1, 0x84c3, 0x1b1c, 0xc0a3, 0x94a3, 0x2f40,
+    0x8181, 0xb727, 0xe2a1, 0x27c8, 0x4b0c, 0xd44f, 0x3e94, 0x88bf, 0x2e16, 0x4fe2, 0xc203, 0x4146, 0x1d08, 0xc51f, 0x5e7a, 0xb0fd,
+    0x1c68, 0x8889, 0x2f2a, 0xdbe3, 0x4b8c, 0x9a17, 0x7062, 0xaf69, 0x7d40, 0xea97, 0xbc5b, 0x7484, 0x8729, 0x297a, 0x43d2, 0x6d1e,
+    0x1dcc, 0x4084, 0x77ce, 0x3132, 0x988d, 0xbe8f, 0x7fe2, 0x2582, 0x930f, 0x69a8, 0x43ba, 0xcca3, 0xac05, 0x311a, 0x4774, 0x39a0,
+    0x8c39, 0x6b28, 0xaef1, 0xea47, 0x1d9a, 0x4c3e, 0x88b3, 0xc4f5, 0x30d4, 0x4b7e, 0xce39, 0x22ea, 0xb5a5, 0x281a, 0x72f0, 0x3ace,
+    0xcfb7, 0x628e, 0xe899, 0xc3ed, 0x9b3d, 0x2d32, 0xb545, 0xe13d, 0xc205, 0x3902, 0x203e, 0x4840, 0xa36d, 0x767e, 0x5e94, 0x3982,
+    0xc8d7, 0x63e4, 0x5526, 0x442c, 0x7ca8, 0x8bcd, 0x3940, 0x9725, 0x762a, 0x1b08, 0xa535, 0x79dc, 0x20c6, 0xa9e3, 0x85e5, 0x8b61,
+    0xbce5, 0x3144, 0xcc5d, 0x22c8, 0x7fee, 0x2b90, 0x4c8e, 0x563a, 0x7220, 0x366a, 0xb6dd, 0xcfed, 0x2806, 0x4e5a, 0x3400, 0x9bdd,
+    0x64f2, 0xc599, 0xb52d, 0xe12f, 0x98e3, 0x63ee, 0xba87, 0x2670, 0xb40f, 0xd9bf, 0x3c30, 0x2e4c, 0x99a9, 0x7a0e, 0x19e4, 0x3de0,
+    0xea35, 0x652c, 0xd001, 0xa99b, 0x8af3, 0xd59b, 0x5fde, 0xb521, 0x418e, 0xb9bd, 0x9dd3, 0xe27f, 0x8701, 0x1916, 0xcf25, 0x7d4e,
+    0xa7b9, 0x8e65, 0xd841, 0xa193, 0x9889, 0xe7c3, 0x2452, 0x683e, 0xdcef, 0x355e, 0x8741, 0xdd69, 0xbde3, 0xcd1b, 0x5c6e, 0xbe9d,
+    0x2b24, 0xcd25, 0xece7, 0xb9f3, 0x5746, 0xe0bd, 0x7d8c, 0xc533, 0x5b5e, 0x20a4, 0x87d9, 0x4382, 0x9b41, 0x6ffa, 0x5dbe, 0x4cc8,
+    0xd123, 0x1a98, 0xcd3f, 0xe19f, 0x3af8, 0xaf73, 0x5680, 0xa0c7, 0x2640, 0x8c97, 0x7fb4, 0x25ce, 0x3ba6, 0x869f, 0x212e, 0x762e,
+    0x427c, 0xad8f, 0x5efe, 0xcb99, 0xa67b, 0x553e, 0xdca1, 0x368a, 0xbebb, 0x9fff, 0xe5f7, 0x362a, 0x7678, 0x9a9f, 0x42f6, 0xb429,
+    0xc86b, 0xa63b, 0x1d04, 0x89f5, 0x4168, 0xb6ef, 0x1edc, 0x8a29, 0x25de, 0x6fd4, 0x4e2a, 0x790a, 0xd81f, 0x8907, 0x1f16, 0xa4fb,
+    0x4f70, 0xc201, 0x2d5c, 0x94e9, 0x4416, 0x3690, 0x8a35, 0x2cc8, 0x9ecd, 0x5bdc, 0x9021, 0x4a8a, 0x250a, 0xa457, 0xc021, 0x6f46,
+    0x44a0, 0xaecb, 0xebb7, 0x9a3f, 0x6c3c, 0x2862, 0xdc4d, 0xb0c9, 0xc32b, 0xd409, 0x3494, 0xb555, 0x435a, 0xd7b1, 0x7008, 0x4682,
+    0xd415, 0xc53b, 0x4962, 0x9ae5, 0x877d, 0x5838, 0x7772, 0xa98d, 0xb61d, 0x99cb, 0xd615, 0x3344, 0x8a77, 0xa193, 0x25d8, 0x4728,
+    0xce7b, 0xb3bd, 0x508a, 0xc8f5, 0x92cf, 0x3558, 0x1104, 0x87f9, 0x52ca, 0x93f1, 0x214e, 0x9e6f, 0x3702, 0x5f32, 0xe497, 0x9d5d,
+    0x9321, 0xbdf3, 0xb123, 0xd953, 0x20b8, 0xc38b, 0x58f0, 0x3804, 0xb0a1, 0xa2ed, 0x741e, 0x5724, 0x932d, 0xde71, 0x795c, 0xa97f,
+    0xde5b, 0x8365, 0x5b9a, 0xa6e5, 0x7914, 0xd699, 0x3c32, 0xa6d1, 0xdcbb, 0x7e86, 0x63c4, 0x9bcf, 0xe9ab, 0x8667, 0xcf85, 0x4928,
+    0x2150, 0x6a3e, 0x7f08, 0x2524, 0x5028, 0x382c, 0x86c5, 0x19c4, 0x6c08, 0x9d4d, 0x7294, 0xcd5f, 0x518c, 0x3396, 0xbc0b, 0xb14f,
+    0x74e2, 0x2a12, 0xa477, 0xd10d, 0x1952, 0xab53, 0x286c, 0xd8e7, 0xbb1b, 0x47c2, 0xec51, 0xc25f, 0x3840, 0xd947, 0x58c2, 0x1512,
+    0xaf97, 0x6c48, 0x4edc, 0x9d63, 0x7d70, 0xadc5, 0xe371, 0x8c13, 0xca21, 0xd611, 0x43ae, 0x9433, 0x6b20, 0x79c6, 0xc043, 0xc031,
+    0x6700, 0x3dec, 0x7cfe, 0x58a2, 0x3288, 0xcecd, 0x94b9, 0x4936, 0x553c, 0x71a6, 0xc11b, 0x863f, 0x6ba6, 0xd68d, 0xa6ef, 0xc6e5,
+    0x9c09, 0x2e42, 0xb957, 0x4f64, 0x3bcc, 0xc383, 0x2470, 0x8e47, 0x78e4, 0x21c0, 0x53d6, 0x29c8, 0xade3, 0x3e4a, 0x8d53, 0x46c2,
+    0x6668, 0xded3, 0xc36d, 0x4308, 0x6388, 0xc89b, 0x89b5, 0xaab7, 0x5bcc, 0x9851, 0x1cb8, 0x757c, 0x95ef, 0x6968, 0xdff5, 0xa6f9,
+    0xad6b, 0x6396, 0x8045, 0x3ea2, 0x158a, 0x95d1, 0x25d2, 0x8f99, 0x3b24, 0xe167, 0xd325, 0xa8f7, 0x2a14, 0xc19b, 0xe72f, 0xb1c3,
+    0x88fb, 0x3944, 0x7e94, 0x5c7e, 0x9093, 0xd0d7, 0x7c6c, 0x45d2, 0xd6ad, 0x61f2, 0xe527, 0x6612, 0xaf45, 0xa93b, 0xcbf3, 0x73a2,
+    0xddf5, 0x1892, 0x8c43, 0xd847, 0x3abc, 0xc801, 0x91f7, 0xaa6d, 0x72d0, 0x436a, 0xa995, 0x8c2b, 0x5c7e, 0xd56b, 0x5620, 0x61d0,
+    0x4852, 0x3a9e, 0x699a, 0xde97, 0x2ec8, 0x5284, 0xdf9f, 0x5e84, 0x4a06, 0xce03, 0x37a8, 0x17b6, 0xdde1, 0x6e5a, 0x4e4a, 0xd427,
+    0x83c5, 0x368e, 0xaedd, 0xdf57, 0x5cd6, 0x8123, 0xe25f, 0xb52b, 0xd98d, 0x3a08, 0xc0bb, 0xb40d, 0x61aa, 0x84f5, 0xe31b, 0x569c,
+    0x8c5f, 0x7734, 0x2f4a, 0x45f2, 0x5d24, 0xb011, 0x65c4, 0x8421, 0x4ab8, 0x18c8, 0x595c, 0xe7ab, 0x76da, 0xa0c3, 0xa80f, 0x2cde,
+    0x98e3, 0x5df8, 0x6c42, 0x1fa0, 0xc9ef, 0x9e5f, 0xc099, 0x2058, 0x3c5c, 0x66b4, 0x8473, 0xaf07, 0xe6cf, 0x71fa, 0x7d0a, 0xdea5,
+    0x75d2, 0xa179, 0x661c, 0x1fa0, 0x7738, 0xe029, 0x5e0c, 0xd28f, 0xb613, 0x3d40, 0x5d7a, 0xdcb7, 0x82f3, 0xbffd, 0xb7c5, 0x4ce6,
+    0xd0f5, 0x3a0c, 0x5ac2, 0x4e46, 0x8509, 0x6e62, 0xd301, 0xa451, 0x2364, 0xe4ab, 0xc6b5, 0x20e8, 0xb9dd, 0x6cac, 0x4624, 0xc725,
+    0xb3ef, 0x2cae, 0x3b86, 0xbafb, 0x2808, 0x6d38, 0x8a45, 0x3e54, 0x211c, 0x681c, 0xa8d3, 0x31d8, 0x4666, 0x6d80, 0xaad3, 0x8cfd,
+    0xc37d, 0xa5a3, 0x370c, 0xa965, 0xe1dd, 0x7f60, 0xca1f, 0x59e8, 0xab51, 0xda49, 0x2b7e, 0xb2cd, 0x6ac4, 0xdc99, 0x9903, 0xda03,
+    0x2056, 0x95eb, 0x8a7f, 0xdecd, 0x5f14, 0x9c67, 0x6ae2, 0x45ce, 0x7d6a, 0x29ce, 0x94ed, 0x5f2e, 0x6ece, 0xbbe3, 0x95ad, 0x3d3c,
+    0xcee9, 0x85cd, 0x367a, 0xe4c7, 0xc1e1, 0x3c7e, 0x965f, 0x2090, 0x9b63, 0x553a, 0x7602, 0x1d92, 0xda83, 0xaa9f, 0x30a2, 0xd409,
+    0x1baa, 0x8e15, 0xa4d3, 0xc1e5, 0x6f08, 0x252c, 0xa403, 0xe9fd, 0x18aa, 0x90d9, 0xaaf5, 0x2624, 0xc8cb, 0x37ce, 0x4784, 0x68f0,
+    0x8043, 0x2160, 0x75be, 0x5c80, 0xdd95, 0x7394, 0x9e33, 0x49c4, 0xd965, 0xcddf, 0x6810, 0x4908, 0x7b66, 0xd93f, 0x60e4, 0xb4f1,
+    0x2180, 0x4c26, 0x2c60, 0x7b20, 0xae15, 0x2304, 0xcfa7, 0x4972, 0x37bc, 0x8521, 0xc7eb, 0x511a, 0x3a9e, 0x1e1a, 0x3636, 0x709c,
+    0x4300, 0x9171, 0x2dac, 0xa41b, 0xbe9f, 0x68d4, 0x6dec, 0xbc51, 0xa2db, 0x548a, 0x66b2, 0x4c80, 0x7860, 0x1a84, 0x8f43, 0x2bbc,
+    0x552c, 0x98f9, 0xbb55, 0x26e2, 0x6f3c, 0xe791, 0x2f56, 0x69d2, 0xcfdf, 0x8e89, 0xbbd1, 0x169e, 0x552e, 0xe06d, 0x317c, 0x45ae,
+    0xadad, 0x4da0, 0x99a1, 0x4874, 0x6a9a, 0x5a8c, 0x9e05, 0x194a, 0x6500, 0xce93, 0x2b6e, 0xbf97, 0x1cfc, 0xb6c1, 0xde89, 0x2686,
+    0x906b, 0xcfdb, 0x5ca0, 0xb5f1, 0x941b, 0x7c9a, 0xa66b, 0x700e, 0xd709, 0xc169, 0xa7c7, 0x9499, 0x384a, 0xb64f, 0x9897, 0x2ba4,
+    0x786c, 0x614c, 0xb8ed, 0x7004, 0x9211, 0xc5bf, 0x1bd2, 0x4fc0, 0x6f6e, 0x7b82, 0x3182, 0xdf6f, 0x7118, 0x3aa4, 0x1e6e, 0xc8d7,
+    0x64a0, 0x1a94, 0xb88d, 0x8a2b, 0xe0c9, 0xa0f9, 0x31aa, 0x7426, 0x3d38, 0x96d3, 0xa923, 0x88f5, 0x37d4, 0x5112, 0x17b0, 0xdaed,
+    0x9199, 0x31bc, 0xac23, 0xd777, 0x6f06, 0x2e86, 0x5c52, 0xe50f, 0x78ba, 0xd4b5, 0x250e, 0x5324, 0x4238, 0xc46d, 0x5486, 0x9bb7,
+    0x33ec, 0x2652, 0xe43b, 0x8671, 0xa7bd, 0xc3d1, 0x44ae, 0x2c06, 0xc43d, 0x73ec, 0x2f5c, 0xc81d, 0x533e, 0x281e, 0x6d70, 0x11b6,
+    0x64dc, 0x7ddc, 0xcbd5, 0x7106, 0x9c33, 0x2fea, 0x42de, 0x79aa, 0x5f98, 0x4b2c, 0x839f, 0x3d3c, 0xd2a5, 0x2a14, 0x8e1b, 0x55ee,
+    0x1d9a, 0xdda9, 0x74a2, 0x4e48, 0xb39d, 0xcbbf, 0x5a72, 0x76ac, 0xbb6b, 0xcae1, 0x92b3, 0x4fda, 0xbd67, 0xd8b7, 0x2ba4, 0x3b8e,
+    0x652c, 0xdf53, 0x9685, 0x49d8, 0xcf8f, 0x68da, 0xa2cb, 0x32a8, 0x4c8c, 0x7cb4, 0x59a8, 0x99bd, 0x7d20, 0x17d0, 0x3db8, 0x6e98,
+    0x4c8a, 0xc377, 0x3ea4, 0x32ee, 0xb853, 0x54b4, 0xd225, 0xcb8d, 0xa865, 0x5a1a, 0xaaef, 0x1f58, 0x83bd, 0x4fde, 0x2e9e, 0x6672,
+    0xdfb1, 0x5e78, 0xb001, 0x4a40, 0x5f86, 0x568c, 0xcbf1, 0x65c2, 0x3164, 0xa8ef, 0x614e, 0xc3eb, 0x515e, 0x8dfb, 0x5962, 0x82a9,
+    0x4afc, 0xcb6f, 0x2bf0, 0x44a8, 0xb7f9, 0x8187, 0x65da, 0xd377, 0x7008, 0x44c2, 0x8289, 0x4e7a, 0xe99f, 0x74d2, 0xb9b3, 0x5402,
+    0xb755, 0xdea3, 0xa133, 0x8db3, 0x2226, 0x7970, 0xb44f, 0x518a, 0x38c6, 0xa1c1, 0x83ff, 0xec73, 0xaa4b, 0xc299, 0x31b6, 0x9d09,
+    0xe68f, 0x75c4, 0x9c3b, 0x6a56, 0x3672, 0x4d0a, 0x789c, 0x9539, 0xc535, 0xe747, 0x699e, 0xaf8b, 0xac51, 0xd8ef, 0x8f03, 0xaac3,
+    0x19f6, 0xdcab, 0x79c2, 0xd2b7, 0x57ae, 0xe05d, 0xaf29, 0x4d78, 0xd1e9, 0x298e, 0x75b0, 0xb79f, 0xdac1, 0x5e04, 0x9cb7, 0x78d2,
+    0xe437, 0x6734, 0xab37, 0x4a40, 0x1b84, 0xafe1, 0x5e54, 0x9a45, 0x2492, 0x45c2, 0x36cc, 0x6fb8, 0x98bb, 0xc81f, 0x5bc0, 0x8cd9,
+    0xc94d, 0x630c, 0x7d92, 0xbacb, 0x23d2, 0x6960, 0xdec9, 0x42aa, 0xb3fd, 0x5be6, 0x7aa2, 0x5098, 0x8d73, 0x39d6, 0x797e, 0x9e8f,
+    0x8033, 0xedfb, 0x9adb, 0x1c28, 0x687c, 0xc39b, 0x3d8c, 0x82ed, 0x33c4, 0x7ffe, 0x665a, 0xc631, 0x8043, 0x42b2, 0x5a54, 0xc5b9,
+    0xe7ff, 0x9ecf, 0x190c, 0x4426, 0x3e24, 0xa57f, 0x205c, 0x75c8, 0xcc9b, 0x49f0, 0x98ef, 0x572e, 0x940f, 0xc1e7, 0x2cfe, 0xa579,
+    0xb367, 0xd8b7, 0x9aeb, 0x3e4c, 0xc8c3, 0x1d74, 0x9007, 0xed8d, 0xc4c7, 0xd321, 0x6af4, 0x2838, 0xc69d, 0xbe77, 0x7e7c, 0x6b3c,
+    0xce97, 0x4b0e, 0x7ec6, 0x44b6, 0xb67d, 0x8c0f, 0x49a8, 0x8091, 0xa309, 0x39cc, 0xb86d, 0x7b5a, 0x8a01, 0x2216, 0xaef9, 0xc2af,
+    0x8683, 0x5628, 0x4d2a, 0xb7f3, 0x39fa, 0x8b25, 0x6d52, 0x9a17, 0x826b, 0xe273, 0x8d1f, 0x4ca8, 0x9081, 0xac3d, 0xdd17, 0x8fa5,
+    0x9c87, 0x32fc, 0xb793, 0x21ea, 0xd9e5, 0xb105, 0x949d, 0xbf0f, 0xde77, 0x2f4e, 0x9707, 0xaa77, 0x6702, 0x9f8d, 0x3884, 0x7f62,
+    0x5fea, 0x9645, 0xc9ff, 0x990f, 0x7c4c, 0x391c, 0xa8e3, 0xe5a3, 0x9895, 0x2d22, 0xd91f, 0x78e0, 0x1c1c, 0x9063, 0x58f2, 0xb3bd,
+    0x7ab8, 0x1974, 0xb5e9, 0x71b6, 0x596e, 0x1808, 0x96a3, 0xd33d, 0xb815, 0x4456, 0xe1db, 0xcea9, 0x377c, 0xb38d, 0xa411, 0xd8e1,
+    0x7bb4, 0x664e, 0xb57b, 0x6a92, 0x9139, 0x7b5e, 0x270a, 0x5e44, 0x8abb, 0xe033, 0x43e6, 0xd30d, 0xcf7d, 0xabf7, 0xe399, 0x7ccc,
+    0xa5c3, 0x1bbe, 0x92cd, 0xcc53, 0x18f8, 0xa0f5, 0x8377, 0x497e, 0xe4c3, 0xc657, 0x658c, 0x90cb, 0xaaff, 0x3f26, 0xdce5, 0x6b8e,
+    0xace7, 0x7cca, 0xe207, 0x6e66, 0xd957, 0x37c2, 0x4ec0, 0xba01, 0x3976, 0xd5f7, 0xbb9b, 0x5f5a, 0x9b87, 0x1c26, 0x908d, 0x2a38,
+    0xcd57, 0x3ca4, 0x4652, 0xc157, 0xc72f, 0x328e, 0xdbbd, 0x78f8, 0xc075, 0xb5dd, 0x29e0, 0x9145, 0x4f0c, 0x19b2, 0x69a8, 0x8243,
+    0xb0b1, 0x3edc, 0xd12b, 0xac49, 0xe5f9, 0x9027, 0xa56f, 0x2cde, 0x6546, 0x23f6, 0x8b23, 0x332c, 0xbdb7, 0x84ad, 0x6aa0, 0xcc4b,
+    0x518a, 0xbdab, 0x371e, 0x69c4, 0x8577, 0x2020, 0x3b02, 0x74a0, 0x8a21, 0x1b24, 0xbcc3, 0x99e1, 0x34ea, 0xca65, 0x4cf0, 0xc4d3,
+    0x3a4c, 0x1f2e, 0xd0d1, 0xd9e9, 0x8cd1, 0xc27d, 0x3e6e, 0xbd77, 0x8185, 0xa9bf, 0xc965, 0xb0b1, 0x7b5a, 0x40ce, 0x7fb0, 0x2060,
+    0xdad5, 0x3686, 0x2dd4, 0xebc3, 0xab93, 0x9577, 0xc405, 0x2c36, 0x8e45, 0xa3fd, 0xe5ef, 0xc139, 0x719c, 0x84c1, 0xcc45, 0x1f3c,
+    0x2f9a, 0xb899, 0x42a8, 0x828b, 0xcfc1, 0x4da4, 0xacf3, 0x2358, 0xbcf7, 0x47be, 0x4ebc, 0x28b4, 0xe623, 0xaf8d, 0x6bb0, 0x910d,
+    0x38ca, 0x55aa, 0xd1af, 0x8cfb, 0xb53f, 0xebfb, 0x697a, 0xaa29, 0x982f, 0xbe07, 0x17d6, 0x7c74, 0xd597, 0x9ecd, 0x5c7e, 0x881b,
+    0x43b4, 0x715c, 0x4f38, 0x7588, 0x6876, 0x462c, 0xb553, 0x591c, 0x2668, 0x4a4e, 0x7d00, 0xd7d7, 0x6796, 0x496e, 0xa553, 0x3c46,
+    0xb0ed, 0x2634, 0xe873, 0x92e9, 0x200e, 0xb33b, 0xd463, 0x28d6, 0xcb4b, 0x5370, 0x9f0d, 0xc5e3, 0x5126, 0xd67f, 0x60a0, 0x31cc,
+    0x79b8, 0xc9f3, 0x9423, 0xd3cb, 0x207c, 0x575e, 0xcc71, 0xabcb, 0x18a2, 0x5aa8, 0xa327, 0xb219, 0x22b8, 0x72ae, 0x45dc, 0xc7f3,
+    0x5cc0, 0xe25d, 0xae8b, 0x38d2, 0x5fd6, 0x5938, 0xc37d, 0x1d72, 0x9db3, 0x6e38, 0xc4e5, 0x5200, 0x7af2, 0xf025, 0xb905, 0xd0bd,
+    0x52f4, 0x9d6b, 0x3bec, 0x5c60, 0x2318, 0xcc91, 0x8731, 0x1d56, 0x41e2, 0x53aa, 0x4062, 0xb717, 0x9e3d, 0x75b4, 0xe231, 0xa755,
+    0xc5ff, 0x4850, 0x2c62, 0x8bc1, 0xb5b1, 0x3836, 0xbcb9, 0x2eb8, 0x8709, 0x6a80, 0x22a4, 0xa245, 0x4b2c, 0x730a, 0x5972, 0xc30f,
+    0x2360, 0xa847, 0xe4db, 0x20a2, 0x4718, 0xe80b, 0xaef9, 0x3050, 0x1778, 0x996b, 0x6a5a, 0x75bc, 0x45ac, 0x23e0, 0x8a29, 0x36e6,
+    0xc47d, 0x4482, 0x71da, 0x8a3f, 0x9321, 0x2fe4, 0xd561, 0x8dc9, 0x3ea0, 0x9457, 0x213e, 0xd04d, 0x3512, 0x6986, 0x270c, 0x971d,
+    0xc12d, 0x2efc, 0x5a52, 0x9d8f, 0x90bf, 0x1c54, 0xaa9b, 0x82e9, 0x93f5, 0x2648, 0xc291, 0x6974, 0x3f7a, 0xacb1, 0xdfbd, 0x88fb,
+    0x63be, 0x6a3c, 0xa987, 0x6738, 0x4cbe, 0x93c1, 0x42a0, 0x8759, 0x1a5e, 0x5ce6, 0x40f2, 0xcfdf, 0x3962, 0xa899, 0xd805, 0x4bfc,
+    0x20be, 0x56e6, 0x86f9, 0x16c0, 0xc177, 0x4544, 0xdcbd, 0xb933, 0x4c62, 0xa841, 0xd7b9, 0x723c, 0x535c, 0x4512, 0x29b8, 0xe2f7,
+    0x646c, 0x8587, 0xb379, 0x5772, 0xa63b, 0x98dd, 0xc3e5, 0x62d2, 0xdfcb, 0xa25d, 0x682a, 0x8c25, 0x34c4, 0x71d2, 0xa4df, 0x89a7,
+    0xbaa5, 0x8d97, 0x6de0, 0x4246, 0x9677, 0x5b46, 0x70bc, 0xd26f, 0x63b4, 0xe7bf, 0x45a4, 0x5ffe, 0x26e4, 0xd3ff, 0xbc41, 0x6f62,
+    0xb5b9, 0xa3f9, 0xcbef, 0x6112, 0x8517, 0x33de, 0x52fc, 0x7ada, 0xcebf, 0x372c, 0x26a6, 0x63ec, 0xa5e7, 0x44b2, 0xdd51, 0x5c76,
+    0x5f40, 0x5156, 0x7638, 0xa573, 0x27c0, 0x5c0e, 0xe945, 0x7cb4, 0xa379, 0xd8eb, 0x790a, 0x8fad, 0x5004, 0xcf4d, 0x1ee2, 0xaff9,
+    0x272c, 0x7e02, 0xc8b1, 0x6bb0, 0x2e04, 0x822d, 0xd2ff, 0x48a6, 0x3b16, 0xdf37, 0x6058, 0xae37, 0x2d00, 0x49ec, 0xbc3b, 0xd049,
+    0x3a5c, 0xe2c9, 0x2e80, 0xc0d1, 0xb107, 0xd05f, 0x81c7, 0x71ca, 0x9d73, 0xb599, 0x8a25, 0x348e, 0xb6d5, 0x9315, 0xdc1f, 0x75e8,
+    0x5c76, 0x9acf, 0xc4a7, 0x68a6, 0x4be6, 0x6f12, 0xad13, 0x5ba4, 0x9175, 0xb04d, 0x6800, 0x31b0, 0xa363, 0x7ff0, 0x2536, 0x9a9f,
+    0xdc09, 0xaf7d, 0x1318, 0x6058, 0x7e1e, 0xe051, 0x3774, 0x3e32, 0x5eae, 0xd3a3, 0x387e, 0x71d2, 0xe493, 0x61c0, 0xba2d, 0x38d2,
+    0x62f2, 0x45d4, 0x976d, 0x7816, 0x8599, 0xe0d7, 0x2c7e, 0x7502, 0x5860, 0x387e, 0xd091, 0x20a6, 0x4206, 0x9047, 0x1716, 0x74c2,
+    0xdb47, 0x3382, 0xb9d5, 0xdb5f, 0xae6d, 0x5394, 0x627e, 0xc31b, 0x7392, 0x9961, 0x88bf, 0xd11d, 0x32c8, 0x5998, 0x2608, 0x7ec8,
+    0x3b18, 0x6c08, 0xcfd5, 0xacc3, 0xe9b3, 0x4ca0, 0x7aa0, 0xd78d, 0x5b24, 0x9893, 0xb87b, 0x6950, 0xd1dd, 0x9049, 0x2c56, 0x9227,
+    0x354a, 0x4928, 0x8f23, 0xcc33, 0x9ffd, 0x609e, 0xc689, 0x727e, 0xb611, 0x5308, 0xbe73, 0x29b2, 0x9919, 0xb9fd, 0x62f2, 0x526e,
+    0xd48d, 0x2e82, 0xaad3, 0xe813, 0x54a8, 0xbce1, 0x6656, 0x7040, 0xb72b, 0x5600, 0x3eba, 0x808b, 0xa0b3, 0xbbc3, 0xd2b3, 0x44e0,
+    0x8573, 0x16e4, 0xab81, 0x852b, 0x2f14, 0xc06d, 0xe653, 0x66f8, 0x5afa, 0x89a3, 0x4b42, 0x2b38, 0xd24b, 0x7d62, 0x45ea, 0x993b,
+    0xc23b, 0x1de0, 0xd617, 0x85cf, 0x33be, 0xb9ef, 0x5db0, 0xd2df, 0xa831, 0x53ea, 0x9501, 0xbde3, 0x7c46, 0x6428, 0xa1a9, 0xc5ad,
+    0x950d, 0xdda3, 0xb943, 0x4b0e, 0x5f04, 0x231a, 0x7aee, 0x5dda, 0x34a6, 0x84db, 0x44fc, 0x981d, 0x1ba6, 0xcc99, 0xa127, 0x432c,
+    0x8d77, 0x2600, 0xcd9f, 0x4414, 0x2ae2, 0xd267, 0x3af0, 0x9575, 0x4f84, 0x279a, 0xc6a9, 0xeaa3, 0x50fe, 0xb4c5, 0x28f8, 0x5b4c,
+    0x4836, 0x7b80, 0xb451, 0x264e, 0x7f30, 0xe11b, 0x17dc, 0x2ed6, 0x8f85, 0x6b26, 0x1df0, 0xdbb9, 0x9a9d, 0x6e44, 0x44a0, 0x22be,
+    0x56aa, 0x874d, 0x6860, 0x4982, 0xc6db, 0x23c8, 0xde57, 0xb2b5, 0x69b2, 0x8c45, 0x7776, 0xd29f, 0x1ec6, 0x4a5a, 0xa44b, 0xb57d,
+    0x17c8, 0xc21d, 0xd7cf, 0x3342, 0x820d, 0xbd79, 0x7882, 0x4ee6, 0x9ed7, 0x1dc6, 0xb259, 0xbb95, 0x2980, 0x87f7, 0x5f2c, 0xce25,
+    0x4890, 0x96e3, 0xdf4f, 0x2336, 0x3f78, 0x9b9d, 0x5e64, 0x2a10, 0x7ee4, 0xa3ef, 0x67c2, 0x39a6, 0xe4e9, 0x75be, 0x6890, 0x24c0,
+    0x7860, 0xbb1d, 0x9ca7, 0x2144, 0x8c9d, 0x3360, 0x3962, 0xd1ef, 0x1f4e, 0xc451, 0x4390, 0x4d6a, 0x9f87, 0x19aa, 0x2d0a, 0xc057,
+    0x8a2f, 0x26ee, 0x4612, 0xd1df, 0x80b5, 0x30bc, 0xdf97, 0x3846, 0x403e, 0x17b6, 0x8519, 0xdf0f, 0x5ea0, 0x924f, 0xb565, 0x40ca,
+    0x4f90, 0x6a7a, 0x3a80, 0xa007, 0xb44b, 0x777e, 0xbc63, 0x94e1, 0x8967, 0xba0f, 0x2c7a, 0xcb27, 0x881d, 0x4e2a, 0x8fe3, 0xb3ef,
+    0x7dd4, 0x1de6, 0xd7b7, 0xbaed, 0x3812, 0xa6a1, 0x4562, 0x6812, 0xbcb7, 0x88cf, 0xa9f1, 0xd98f, 0x73a2, 0xc395, 0x3c2a, 0x5c72,
+    0xad45, 0x86f7, 0x6a32, 0x3f56, 0x7bf4, 0x90bd, 0x38e6, 0xe06f, 0xac97, 0x2ee8, 0xc939, 0x687a, 0x4980, 0xc009, 0xd2c5, 0x44ec,
+    0xafa3, 0xde3d, 0x80b1, 0x5b6c, 0x35de, 0x963d, 0x7e06, 0x6ca8, 0xa8ab, 0x2f36, 0x3d1a, 0x752e, 0x28ba, 0xe807, 0xb2b1, 0x6ec4,
+    0xdd27, 0x9e8f, 0x7264, 0x6718, 0x29c8, 0x8427, 0x919f, 0x4506, 0xe2b5, 0x8235, 0xaa3f, 0x5744, 0xee2d, 0x76b2, 0xadbd, 0x8915,
+    0x9c25, 0xb3ab, 0x3c36, 0x6ae8, 0x2ff6, 0x8859, 0xaf27, 0x1c2c, 0xdbd7, 0x89df, 0xc25b, 0xe61b, 0x5a88, 0x4dee, 0xca2f, 0x773c,
+    0x6582, 0xdd5b, 0x54c8, 0xc59f, 0x5dda, 0x7698, 0x4416, 0x265c, 0xcc31, 0xaf65, 0xe1a1, 0x89c9, 0xba79, 0x597e, 0x6110, 0x31ce,
+    0x5026, 0xadf7, 0x2b82, 0x768e, 0xa9ff, 0xe8e3, 0x6a3c, 0x2d40, 0x7bc4, 0xe431, 0x7324, 0x20e2, 0xda4f, 0x8a33, 0x3a48, 0x2902,
+    0x6722, 0x79c4, 0x35aa, 0x97b1, 0x779c, 0xb053, 0x8d81, 0xcfcf, 0xe857, 0xb8c3, 0x63dc, 0xc689, 0xdd93, 0x85c1, 0x8de7, 0xa9c7,
+    0x5126, 0x751e, 0xa283, 0xe967, 0x8423, 0x76f2, 0xb701, 0x6cf4, 0xb1d3, 0x6a24, 0x4748, 0x7e38, 0x1af6, 0xd7af, 0x9dab, 0xe2a9,
+    0x1d24, 0xa971, 0xdf6b, 0x3754, 0x622a, 0xbeb1, 0x9f53, 0x52ae, 0xac2f, 0x2dbc, 0xb0bd, 0x8e7d, 0x55a2, 0xc85f, 0xa9f3, 0x968f,
+    0xe77f, 0x4142, 0x14a6, 0x77a8, 0xb781, 0x9989, 0x6618, 0xb6e3, 0x16e0, 0x4418, 0xa38b, 0xbe49, 0x7de8, 0x3370, 0xc675, 0x946b,
+    0xeb2b, 0x9aaf, 0x6688, 0x9ec9, 0x436e, 0x9607, 0xc895, 0x32a6, 0x6534, 0x3ab0, 0xd38b, 0x6cee, 0x35da, 0xa46f, 0x77ca, 0xde1b,
+    0xa443, 0x6a98, 0x5a1c, 0xab61, 0xcf21, 0x93f5, 0xc6f1, 0xb5dd, 0x275a, 0xc949, 0x564c, 0xad45, 0x9009, 0x38e2, 0xa61b, 0xcbf5,
+    0x9013, 0x59e0, 0x87fb, 0x5dac, 0x4e6e, 0xe3a3, 0x8d35, 0x5fc8, 0x8fd1, 0x6e52, 0xe3b9, 0x78c2, 0xd0e1, 0x836f, 0x6b3e, 0x4e24,
+    0xd9b5, 0x913d, 0x752a, 0xb201, 0x383c, 0xc587, 0x9dd9, 0x7d1c, 0xdea9, 0xc37f, 0x752c, 0x36f8, 0x40e8, 0xc66d, 0x784a, 0xdfdf,
+    0x873b, 0xcc53, 0x30d6, 0xde91, 0x8a2f, 0x455a, 0x288c, 0xa151, 0xda5b, 0x514c, 0x6f08, 0x9c7b, 0x2092, 0xa2b5, 0x2a80, 0xd389,
+    0x9ee5, 0xc299, 0x5fb0, 0x25fc, 0x6960, 0xd83d, 0x95b3, 0xaed7, 0xeab9, 0x44d8, 0x2466, 0x6528, 0xac95, 0x36c6, 0x987d, 0xbd85,
+    0x2518, 0x9d65, 0x5358, 0x13e0, 0xe91d, 0xa2e9, 0x241e, 0xb84f, 0x7b8a, 0x555a, 0xebb5, 0x2318, 0x87d5, 0xb195, 0x79e8, 0x2b42,
+    0x9133, 0x57de, 0x1804, 0x3d16, 0xc723, 0xab0b, 0x1a44, 0xc433, 0x4efc, 0xe14b, 0xc901, 0x96d5, 0xa40b, 0x5662, 0x3e92, 0x7e90,
+    0xcddd, 0x50a0, 0x189c, 0xbc2f, 0x40e6, 0xcf69, 0x2694, 0x6576, 0xcad3, 0x2ea8, 0x8d93, 0x39e6, 0xce91, 0x18b4, 0x3f00, 0xd8a1,
+    0x27d4, 0x7212, 0x5bde, 0xda73, 0xc3e3, 0x4402, 0xa1d3, 0x456e, 0x38ca, 0x9ed3, 0x2cc6, 0x9261, 0x1280, 0x66e8, 0x9311, 0x22ce,
+    0xa4df, 0xdc6b, 0x6a46, 0x435e, 0xa25b, 0xde23, 0x9005, 0xb97d, 0x3800, 0x7068, 0x6428, 0x9405, 0x1da6, 0xc847, 0xa653, 0xeb3b,
+    0x82db, 0xc459, 0x9749, 0x580e, 0xc9c3, 0x253c, 0x8c4d, 0xc02b, 0x3d16, 0xa1cf, 0xc699, 0x554a, 0x3362, 0xb37d, 0x51ce, 0xbac5,
+    0xea6d, 0xaa13, 0x2db8, 0xcd3f, 0xebe3, 0xa43f, 0x3bee, 0x1880, 0x98a5, 0x72a6, 0x22e8, 0x4de0, 0x3afe, 0xb36d, 0x62c0, 0x35c4,
+    0xdc3b, 0xc1e5, 0x1f00, 0x6314, 0xb45b, 0x4532, 0x190a, 0x899f, 0xda83, 0x3738, 0xb8df, 0x9589, 0x9d83, 0x781e, 0x6a74, 0xc127,
+    0x3ffe, 0xcf25, 0x5ed0, 0x9a19, 0xca55, 0x8991, 0x496a, 0xd9d5, 0xcb0d, 0x81db, 0x7ad8, 0x3aea, 0xb6c1, 0x36a4, 0x77be, 0x5eee,
+    0xd74f, 0xc6ab, 0xb2f7, 0xdb65, 0x33aa, 0x8c9d, 0x69ee, 0x44be, 0xc3d3, 0x5eba, 0xe14f, 0x411e, 0xa94f, 0xdf9b, 0x75de, 0x3e92,
+    0x8427, 0x3894, 0x53c6, 0xc851, 0xe1d1, 0x4b32, 0x2446, 0xb3b9, 0xe535, 0x890f, 0x4ea0, 0x7eec, 0xc245, 0xe401, 0x5378, 0x3b50,
+    0x1962, 0xb62f, 0x38bc, 0x752a, 0x4f92, 0x185a, 0x6660, 0x8823, 0xe0f1, 0x7b0a, 0x3e2c, 0xc71b, 0x99ab, 0x16f8, 0x513e, 0xe353,
+    0x2dda, 0x424c, 0xda1d, 0xc22f, 0x743e, 0xb309, 0xc2a9, 0x4c22, 0x2d3e, 0x85f9, 0xa8d9, 0x1f0c, 0x6028, 0xb68f, 0xe675, 0x34f0,
+    0xadbf, 0x6828, 0x15cc, 0xe309, 0x5b28, 0xb4d1, 0x4cae, 0x6600, 0xb285, 0x55be, 0xa259, 0xd815, 0xad5d, 0x1fac, 0x96e9, 0x5464,
+    0x219e, 0xa9e1, 0x785e, 0xbd01, 0x378a, 0x5aae, 0xc825, 0x67b6, 0x18d2, 0xaa15, 0x6442, 0xbf23, 0x44d0, 0xe1f9, 0x6328, 0x75f2,
+    0x29d8, 0x4d1a, 0x8d31, 0xb083, 0x5570, 0xc22d, 0x1c16, 0x3098, 0x73de, 0xc55f, 0x7904, 0x9bb5, 0x5c32, 0x7f00, 0xdd0f, 0x7c2c,
+    0x441a, 0xe6e1, 0xce51, 0x836b, 0xc227, 0x5c4c, 0x8603, 0x48ec, 0x2ffe, 0x8d93, 0xb0db, 0x42f0, 0x9b7f, 0xe139, 0x5b9c, 0xc783,
+    0x72c4, 0xc31d, 0x9a2d, 0x8afb, 0xdde7, 0x578e, 0x6964, 0x3842, 0xa0d9, 0x87e9, 0x6942, 0x58fe, 0x35d2, 0xcb83, 0x7096, 0x2382,
+    0xb055, 0x32ec, 0x9111, 0xe3c1, 0xb3b1, 0x5504, 0xa4d5, 0xa377, 0x5b9a, 0x1f1a, 0xd479, 0x66ec, 0x833b, 0x9939, 0x30d8, 0x6e5e,
+    0xc1b9, 0x4d5e, 0x8c73, 0xa60f, 0x2ba6, 0x74f8, 0xdd3d, 0x6e36, 0xcd41, 0x692a, 0x7058, 0xb225, 0x3ddc, 0xa0bb, 0xe6f1, 0x52d2,
+    0x3516, 0x97d1, 0x2b00, 0xae93, 0x24ea, 0x966f, 0x52f0, 0x832d, 0xb197, 0x4192, 0x4896, 0xad87, 0x3826, 0x6f00, 0x2454, 0xae33,
+    0x3e4c, 0x6be6, 0xdedf, 0x466c, 0x38d6, 0x6f4a, 0x4b26, 0xb62f, 0x7d3c, 0x25a6, 0x46d8, 0x8a81, 0xa44f, 0xdcfd, 0x73e8, 0x1828,
+    0x8d8b, 0x443e, 0x803d, 0x592e, 0x2292, 0x46ba, 0xc2cb, 0x68f8, 0x5430, 0x307a, 0xc759, 0xb461, 0x9061, 0x5972, 0x2448, 0xc37d,
+    0x5c1c, 0x6db4, 0x8cab, 0x325e, 0x5e5e, 0xa663, 0xdcbd, 0x5b22, 0x7cba, 0x201a, 0xcb5d, 0x5d40, 0x2cbc, 0x449c, 0x8b9d, 0x32ae,
+    0x82eb, 0x6fca, 0x8f71, 0x24c6, 0x6802, 0x2056, 0x6ad2, 0x9f33, 0x6038, 0x3f5a, 0xd3e5, 0xa195, 0x5d62, 0xdcf1, 0x89f9, 0x17fc,
+    0x31bc, 0x8063, 0x955b, 0x5ac6, 0x426a, 0xd055, 0x2a2a, 0x9fa9, 0xdb5f, 0x86f3, 0x2820, 0x6196, 0x52ba, 0x8941, 0x5d1e, 0x211a,
+    0xab2f, 0xb361, 0x7820, 0x1b2c, 0x6bae, 0x7d1e, 0xa79f, 0x6148, 0x93a9, 0xbe3b, 0x2b44, 0x97ed, 0x59f4, 0x23e2, 0x8d13, 0x96fd,
+    0x813f, 0xcbdf, 0xe7b5, 0x8cab, 0xa803, 0xd235, 0x3e7a, 0xae31, 0x51e4, 0x9eb7, 0x2490, 0x7dc0, 0xdfa1, 0xb7ff, 0x6860, 0xa0df,
+    0x6e78, 0xa8c9, 0x1c5c, 0xc901, 0x3b30, 0x22fe, 0xa289, 0x6ee8, 0xc47d, 0xdab3, 0x38f2, 0x42ca, 0xc0b5, 0x942d, 0x41bc, 0x5530,
+    0xcb03, 0xbc31, 0x39cc, 0xa27f, 0x6f9a, 0x295c, 0x825f, 0x2260, 0xb9a7, 0x27bc, 0x914b, 0x638a, 0x4cd6, 0x7b88, 0xc39f, 0x31d4,
+    0x8c7b, 0xbf09, 0x592e, 0x1eac, 0x93a1, 0xe9a3, 0xb3cd, 0x7406, 0x39f8, 0x8ee3, 0xe50b, 0x3854, 0x7c96, 0xb347, 0x59ca, 0xd86b,
+    0x3f02, 0xaa7b, 0xeaef, 0xa293, 0x42dc, 0x785a, 0x86a9, 0xd62f, 0x5168, 0x8db9, 0x1b2c, 0xbc33, 0xe281, 0x2266, 0xa68b, 0x6814,
+    0x29b4, 0x8ebf, 0x3df0, 0xb09b, 0x2fca, 0x6622, 0xd027, 0xe38d, 0x7094, 0x5b3a, 0x1c4c, 0xcd5f, 0x71d6, 0x37a4, 0x179a, 0xa14d,
+    0x4e80, 0xe1f3, 0x299e, 0x7196, 0xb9bb, 0x2c24, 0xe06b, 0x9371, 0xb893, 0x4dce, 0x168a, 0xd1a7, 0xa383, 0x8cb9, 0xbc13, 0x64ca,
+    0xea39, 0x7ba2, 0xa211, 0x5efe, 0x7322, 0x79da, 0x3c58, 0xe27d, 0x7d74, 0xada9, 0x4dca, 0xad0f, 0x90f9, 0x5384, 0xbab7, 0x8d6b,
+    0xafdb, 0xdd9f, 0x1e52, 0x8357, 0xb69f, 0x5e40, 0x977b, 0x1bc8, 0x9389, 0xc1e3, 0x55f0, 0xdc4f, 0xcd05, 0x81f3, 0x3002, 0xb2d3,
+    0x69b2, 0xc2a5, 0x8c2f, 0x7e18, 0xe00d, 0x3c62, 0x65ce, 0x216e, 0xd219, 0xe5ab, 0x2b5c, 0xc6ed, 0xde45, 0x8aed, 0x5eb6, 0xd177,
+    0x8d33, 0x26d2, 0x666e, 0xac95, 0x9a61, 0xc069, 0x63d8, 0xdf53, 0x57ca, 0xd057, 0xbab3, 0x6d4c, 0x33d2, 0x8007, 0xcd81, 0x5a46,
+    0xa235, 0x6c96, 0xd6e9, 0xc1b7, 0x9525, 0x5c9e, 0x8811, 0xa8a5, 0xddb5, 0x8cc5, 0x8437, 0xe5cb, 0x44ac, 0x73d4, 0xd187, 0x8d1f,
+    0xa02f, 0x4432, 0xda71, 0xaead, 0xccc5, 0x98bf, 0x3e7e, 0xc1e9, 0xac65, 0x956f, 0x6ca6, 0xe0a5, 0xc23f, 0xaa87, 0xd359, 0x57f2,
+    0xb2ab, 0x1abc, 0xa925, 0x4eec, 0xd6d7, 0xbcc1, 0x3a62, 0xe2a3, 0x1b2e, 0x4bb2, 0xdf4b, 0x6dbc, 0x19c4, 0x4304, 0xb18f, 0xb52f,
+    0x4f00, 0x6c92, 0x2098, 0xa1bd, 0x6d26, 0xe85f, 0x82bd, 0x521e, 0x356e, 0x769e, 0xb72b, 0x9b1d, 0xc91b, 0x2064, 0xbde9, 0xd683,
+    0x4890, 0x2fc0, 0xdf67, 0x8ec5, 0xad43, 0x3a5e, 0xd795, 0x79ba, 0x3f76, 0x1498, 0xab85, 0xd1c5, 0x460e, 0xb47d, 0xdaf7, 0x27b4,
+    0x6c0c, 0x4b28, 0x2bc4, 0x5e1a, 0xb879, 0x2a84, 0x5b98, 0x94e3, 0x3420, 0x6a42, 0xd1f7, 0x303c, 0x5868, 0x4af0, 0xcaeb, 0x8af5,
+    0x37b6, 0xd795, 0x5384, 0x8491, 0x9069, 0x638c, 0xe00d, 0x1cbe, 0x4376, 0xb711, 0x8b1b, 0x68da, 0xdd8b, 0x1f46, 0x731a, 0x9d93,
+    0x28a6, 0x8067, 0x4b48, 0xdad9, 0x6aac, 0xc8a3, 0xa999, 0xe5ed, 0x612a, 0x3bc2, 0xcd87, 0x2452, 0x81bf, 0xeab9, 0xacd9, 0x4196,
+    0x6a2a, 0xdfd9, 0x4130, 0xcb69, 0x7080, 0x46e6, 0xb3cf, 0x3068, 0xcd75, 0x59f6, 0xa39d, 0x6e8a, 0x8c43, 0x1aa0, 0x9a8b, 0xc7a7,
+    0x7892, 0x6124, 0x1b2a, 0x693c, 0xda3d, 0x2a72, 0x604a, 0xb81d, 0x3caa, 0x60b6, 0xc603, 0x4e76, 0x7324, 0x321a, 0x5294, 0xd36f,
+    0xb51d, 0x61dc, 0x68ea, 0xa6b9, 0x4dda, 0x9167, 0x1fbc, 0xac49, 0xc68d, 0x9eff, 0xc211, 0x842b, 0x4fa4, 0xb945, 0x8573, 0x6aec,
+    0x8437, 0x3b06, 0xa96b, 0x5140, 0x5f9c, 0x919d, 0x48c0, 0x74c6, 0x64f0, 0xd6b5, 0x274e, 0x788c, 0xbb37, 0x41e2, 0x18ac, 0x9725,
+    0xd4e1, 0x4c7a, 0x3dcc, 0x21f4, 0xc44b, 0x8f85, 0xb8c7, 0x1be4, 0x9643, 0x5688, 0xbf97, 0x740c, 0x24e6, 0xc8c7, 0xd963, 0x5646,
+    0x5a60, 0x3e3c, 0xc813, 0x68be, 0x4b04, 0xdc6d, 0xaf75, 0x37e0, 0xbab5, 0x4560, 0x7eb6, 0x203c, 0x58f6, 0xba33, 0x499c, 0xdb3f,
+    0x7dea, 0x4616, 0xcf83, 0x5e56, 0x50a0, 0xaf13, 0xda23, 0x5b16, 0xa253, 0x91b3, 0x76d6, 0x6be4, 0x9a4b, 0x45aa, 0xae9d, 0x554e,
+    0x7482, 0x22b2, 0xd5e7, 0x856d, 0x1c3e, 0xccc1, 0x33a4, 0x94ef, 0x105a, 0x71f8, 0x9de1, 0xebab, 0x49ae, 0x1f78, 0x9707, 0x3e8c,
+    0xaa9b, 0x4d32, 0x2074, 0x7a76, 0xdfa1, 0x308c, 0xae93, 0x281c, 0xb81b, 0x4748, 0x5dae, 0x1e9e, 0x9f43, 0xc123, 0x530c, 0x943f,
+    0x19f2, 0xb8c5, 0x7d86, 0x25f6, 0x51d6, 0x8121, 0x2214, 0x6842, 0x319a, 0x4aca, 0x8667, 0x3b38, 0x6c4e, 0x2808, 0x6516, 0xe4a9,
+    0x852f, 0xc94b, 0x61f6, 0xe1c9, 0x7e5a, 0xa9d7, 0x533a, 0x8931, 0xab33, 0x2738, 0x95a5, 0xb3c3, 0x9617, 0x78fc, 0xd491, 0x6d78,
+    0xa55f, 0xc9ed, 0x3f12, 0x9513, 0xb37d, 0x2372, 0xbd57, 0x95fb, 0xad4b, 0x6232, 0xd8ff, 0x4afa, 0x78ae, 0x338e, 0xa297, 0x6e56,
+    0x89ed, 0x9aff, 0xcf81, 0x42da, 0x55d6, 0x9109, 0x30ae, 0xc951, 0x9d79, 0x57a6, 0xee23, 0x748c, 0x302e, 0x7dee, 0xa617, 0x61b4,
+    0xcfe5, 0xb6a7, 0x8f9f, 0x3e82, 0xcba9, 0x71be, 0xe4b5, 0x8fdf, 0xd011, 0xc003, 0x9edb, 0x8621, 0x6dea, 0xb281, 0x2c30, 0x72b8,
+    0x4d3c, 0xc453, 0x6908, 0xa6f1, 0x30f0, 0x459a, 0xd3ab, 0x7e08, 0x9ff3, 0x5c64, 0x7202, 0x2ae8, 0xa6e7, 0xc325, 0x6316, 0x910f,
+    0xdf45, 0x70ae, 0x2f44, 0x99e7, 0xaa77, 0x4472, 0x3662, 0x81e1, 0x95a5, 0xaa2b, 0x7ce8, 0xbb17, 0x5a26, 0x2efa, 0xcdc7, 0x70c0,
+    0xb3ad, 0x829f, 0x493a, 0xa67d, 0x8761, 0x1afc, 0x90eb, 0x644e, 0x8407, 0xba4b, 0x2136, 0xc929, 0x4f8c, 0xc4d5, 0x36fa, 0x86ef,
+    0x2a1c, 0xb58b, 0x93a5, 0x38f4, 0xcf6d, 0xa961, 0x4e28, 0x9dad, 0xe387, 0xa69d, 0x31a4, 0xad55, 0x8e35, 0xc77f, 0x9e33, 0x8d5b,
+    0x43ac, 0xbfc5, 0x2132, 0x8603, 0xd95d, 0x765c, 0x3e36, 0x80ad, 0x24de, 0x4a70, 0xdc2b, 0x6866, 0x2c02, 0xad29, 0xd429, 0xdb53,
+    0x4572, 0xbb2d, 0x8729, 0xcf75, 0x3a7e, 0xad6d, 0xc6b5, 0x24da, 0xbf49, 0xb5fd, 0x936b, 0x6782, 0xe4a3, 0x3b90, 0x9fd9, 0x568e,
+    0x31d0, 0x8a31, 0xbe2d, 0xe017, 0x2f20, 0x54ba, 0x46fe, 0x695a, 0xd28d, 0x8399, 0x31a4, 0xd99b, 0x5dbe, 0x76fa, 0x1a66, 0x7c16,
+    0x2c24, 0x9a15, 0x78c8, 0xb0b5, 0x3090, 0x212a, 0x8011, 0x60de, 0xe941, 0x2f98, 0x6cc0, 0xa121, 0x3a6e, 0x8b9f, 0x6f62, 0xab3f,
+    0x1c36, 0x5576, 0x9f87, 0x2968, 0x90f1, 0x7f34, 0xc067, 0x421a, 0x7026, 0x1a74, 0x55b2, 0xb4a5, 0x368a, 0x7a74, 0x1a42, 0xda4d,
+    0xa207, 0xc4c9, 0xbdb1, 0x7052, 0x50a6, 0xe635, 0x8cb7, 0xaa8b, 0x4032, 0x5b70, 0x2dda, 0xc4e7, 0xa5bd, 0x688e, 0xe3ad, 0xc4ab,
+    0x2ffc, 0xd0c9, 0xb3bd, 0x3b68, 0xa2b9, 0x51fc, 0x76fa, 0xdfd9, 0x3a82, 0x9d13, 0xd4a7, 0x8527, 0x2bf2, 0x922b, 0xdc87, 0x3938,
+    0x55fc, 0x909d, 0x47cc, 0x6880, 0xd865, 0x8083, 0xcff1, 0x6418, 0xe851, 0xbcd1, 0xd6d7, 0x1558, 0x834b, 0xb453, 0x96f9, 0x22e0,
+    0x42f6, 0xa09f, 0x3388, 0x804b, 0x412e, 0x8ec3, 0x2b2c, 0xc02f, 0xa9f3, 0x6f58, 0xc673, 0x32b4, 0x513e, 0xbd87, 0x2882, 0x8b3d,
+    0xe2c3, 0x3432, 0xbd93, 0xdcd3, 0x5f1e, 0x6cc6, 0x3c88, 0x4f70, 0xcb4b, 0x1722, 0x3038, 0xbd45, 0x615a, 0xaefb, 0xd7df, 0x3c30,
+    0xcd27, 0x58da, 0x2342, 0x6f00, 0xc413, 0x63f0, 0xb73d, 0x6cc2, 0x37fc, 0x8525, 0xb593, 0x6244, 0x8f33, 0xccc1, 0x403c, 0x2ae2,
+    0x5b54, 0xe575, 0x9de9, 0x1d76, 0x7ca2, 0x4dfa, 0xa50f, 0x207c, 0x4302, 0x519a, 0x1a20, 0xa7c1, 0x3c38, 0xe18b, 0x9d4d, 0x205a,
+    0xb141, 0x93b9, 0x21ea, 0xeb01, 0xbec7, 0x85c1, 0x6204, 0x90eb, 0x3650, 0xe0bb, 0xa2f1, 0xcafd, 0x513a, 0x82db, 0x30d6, 0x473e,
+    0xb365, 0x62be, 0xcfaf, 0xc2f9, 0x1aee, 0x76ba, 0xdd9f, 0x4d6c, 0x6a9c, 0xc54b, 0x495c, 0xe0db, 0xae89, 0x3a6c, 0x8843, 0x1d82,
+    0xd0d7, 0x2564, 0x2e4e, 0xc16f, 0xe2eb, 0x525c, 0xcdd7, 0xd7c5, 0x44de, 0x9773, 0x283a, 0x5fbc, 0x7a20, 0xdc17, 0x5ade, 0x72f0,
+    0xdc2f, 0x59cc, 0xc6dd, 0x7c08, 0x59d0, 0x93f9, 0xb881, 0x1ec0, 0x7a46, 0x82c9, 0x6492, 0xddf1, 0x42ce, 0x5780, 0x1e6c, 0xe2ef,
+    0x7b7c, 0xa291, 0xd94d, 0x2d7a, 0xc719, 0x6408, 0xe8f9, 0xb537, 0x5142, 0x764e, 0x4126, 0x9c09, 0x9105, 0x4786, 0x22ac, 0x5fc4,
+    0x8dc1, 0x1e0c, 0x9b4f, 0x6bb8, 0x89ed, 0xdc91, 0x530a, 0x69f6, 0x333e, 0x8acd, 0x3e5e, 0x50b0, 0xcbb3, 0x8d01, 0x7314, 0x86c1,
+    0xc1c5, 0x6b4a, 0x72b8, 0xa1b3, 0xae17, 0xd8dd, 0x923b, 0xa8a5, 0x411e, 0xb62b, 0x8737, 0x3cb8, 0xa609, 0x99d7, 0x4144, 0xe89f,
+    0xb3a5, 0xc2cd, 0x4e2e, 0x926d, 0xd36d, 0x6b9a, 0xcbb1, 0x9ec3, 0x7b58, 0xb2db, 0xd721, 0x9b99, 0xde05, 0x6678, 0x233c, 0x9869,
+    0xe4cd, 0xbd67, 0x3998, 0xdaa9, 0xc815, 0x18f8, 0xa139, 0x35a8, 0xdc77, 0xc749, 0xa833, 0x4d9c, 0xe4a1, 0xcfab, 0x689c, 0x5bca,
+    0xa449, 0x3332, 0x4204, 0x59d0, 0x9ab1, 0x2c22, 0x6352, 0x848d, 0xda81, 0xcf23, 0x85e1, 0x74a6, 0x22e4, 0xb16f, 0x58ce, 0x82b7,
+    0x7492, 0x9f59, 0x5b48, 0x8123, 0x6e68, 0xc94d, 0x3f68, 0x9663, 0x5aee, 0x6a5c, 0x53cc, 0xc919, 0x630e, 0x55e8, 0x7888, 0xaf3d,
+    0x6e68, 0xed77, 0xca7b, 0xaf1d, 0x2254, 0x95b7, 0xbd05, 0x44ea, 0x8d79, 0x75ec, 0xa547, 0x5300, 0xccd3, 0xe2fb, 0x3b20, 0x70a0,
+    0xc759, 0x6c56, 0x93f3, 0x2e28, 0xb0b5, 0xd12b, 0x4f4c, 0x6d2a, 0xdd85, 0x4594, 0x816d, 0x6094, 0xe409, 0x87db, 0x334c, 0x5604,
+    0x49dc, 0x7132, 0x80f3, 0x5056, 0x3216, 0x9e71, 0xb363, 0xe473, 0x701c, 0x888b, 0xa559, 0x77ba, 0xe8c3, 0x8e9d, 0x16d4, 0x5e4e,
+    0xe78b, 0x344c, 0xa5b1, 0x8931, 0xe983, 0x1db8, 0xd12f, 0x51b0, 0x88ed, 0xd99b, 0x2ea8, 0x4288, 0x21f0, 0xdfef, 0x874f, 0xbe3d,
+    0x8747, 0x79b0, 0x36cc, 0xd481, 0xc7f3, 0x959b, 0x3832, 0xc0d3, 0x83f7, 0x6982, 0xe90b, 0xc8c1, 0x49ee, 0x9379, 0x6b16, 0xc3f1,
+    0xe62d, 0x5b02, 0x3c10, 0x7d74, 0xcc1f, 0x5168, 0xad89, 0xca11, 0x609c, 0x19e0, 0xb42d, 0x65d6, 0x3400, 0xaf97, 0xe9f5, 0xc9d9,
+    0x2b44, 0xa18d, 0x3f4c, 0x85ad, 0x5354, 0x6fea, 0xc6af, 0x2e22, 0xb063, 0x1718, 0x2b9c, 0x86c7, 0x6bc4, 0x9d8d, 0x62c2, 0xb691,
+    0x5bc4, 0x98e5, 0xa89f, 0x7d4a, 0x5d7a, 0x26ca, 0x9b8f, 0x39f6, 0x6b74, 0xaf47, 0xe2cf, 0x8b47, 0xb78d, 0x40f6, 0x9821, 0xac63,
+    0x4f20, 0x9b9d, 0x79e8, 0x2ac2, 0x4180, 0xe041, 0x7470, 0x31c8, 0xc0cd, 0x57d2, 0x23de, 0x99a5, 0xc12d, 0x6ec2, 0xb02b, 0x2cd6,
+    0x51fe, 0x62fe, 0x4d86, 0xa7cb, 0x540c, 0x361c, 0xbaf1, 0x8ec5, 0x3392, 0xdbab, 0xb2d9, 0x21da, 0xe7cf, 0xc44d, 0x7dd0, 0xaee7,
+    0x777a, 0xdf8b, 0x5a3a, 0x274c, 0xba87, 0x2308, 0xb1ab, 0x9f5d, 0x6e18, 0xe777, 0xbefb, 0x7dde, 0x2e2e, 0x1c6c, 0xb667, 0xe5b7,
+    0x4044, 0xa809, 0x17da, 0x80c7, 0x3470, 0x6304, 0x2ed2, 0xe521, 0x56c8, 0x1ba6, 0x669c, 0x9db7, 0x4ef8, 0xd08d, 0xb549, 0x6e1a,
+    0x92e5, 0x40de, 0x1b42, 0xe381, 0xab1f, 0x3e1a, 0x92cf, 0x4ce4, 0x1094, 0x5532, 0x8223, 0x1faa, 0x5126, 0xc401, 0xca6d, 0x3ee2,
+    0x6f2c, 0x4e88, 0x8941, 0x7694, 0x3f76, 0x620a, 0x5884, 0x9185, 0x89cf, 0x3f26, 0x66d0, 0x25aa, 0x8b91, 0xa18d, 0x36e2, 0xb149,
+    0x667a, 0x8445, 0xe36f, 0x983d, 0x3f34, 0xbd29, 0x5004, 0xb4bd, 0x369c, 0xa3b1, 0x52e4, 0x3a9c, 0xd02b, 0x9053, 0x40b0, 0x2ef4,
+    0x6ac0, 0xe35d, 0x4698, 0x1896, 0xad1f, 0xd7c7, 0x1f7e, 0x8a0b, 0xc5cf, 0x2a2a, 0xa24f, 0xbdf1, 0x3f3e, 0xc7c1, 0x251e, 0xb54f,
+    0x2be6, 0x9433, 0x56b8, 0x327e, 0x98e1, 0x37e4, 0x5878, 0xa5cf, 0x1b6c, 0x2626, 0xc0c1, 0x415c, 0x6916, 0x9269, 0x4eba, 0x8a8f,
+    0xdf27, 0x5582, 0xbfaf, 0xda9f, 0x62ee, 0x218a, 0xc5e5, 0x9ac1, 0x36ba, 0x2096, 0xd17f, 0xa7f9, 0x1c42, 0x9885, 0xa89b, 0xc655,
+    0xb64f, 0x6116, 0x190a, 0xa491, 0xcc8b, 0x8eef, 0x2710, 0x7ef6, 0x549e, 0x45b0, 0xb9cb, 0x81b3, 0x5132, 0x2946, 0x6eca, 0xb613,
+    0x55b6, 0x7802, 0xc069, 0x4c22, 0x8fd3, 0x3924, 0x7c26, 0xab55, 0x268c, 0xc40d, 0x7630, 0xa48b, 0xb7f3, 0x60ea, 0xa707, 0x4f22,
+    0x1c3c, 0xb581, 0x4374, 0x66ee, 0x8931, 0x5598, 0xd9d5, 0x79b0, 0xb4e3, 0x4356, 0x92c7, 0x76a8, 0x2af2, 0xcbb7, 0x52f8, 0x34f8,
+    0x7276, 0x2dbe, 0x8a8f, 0x9d49, 0x3c88, 0x1092, 0x2a44, 0xe04f, 0x41cc, 0x7c3c, 0x502c, 0xd6d9, 0x2000, 0x7080, 0x989b, 0x5200,
+    0x670a, 0xa0c5, 0x768c, 0x2784, 0xd5d1, 0xad23, 0x9f2d, 0x8d41, 0xd5e3, 0x77aa, 0x9543, 0x51a6, 0x25c2, 0xdcc9, 0x4a36, 0xcd2f,
+    0x80d1, 0xe651, 0x6e4e, 0xc4d5, 0x3bc6, 0xaf1f, 0x7c22, 0xb7d5, 0x5ca6, 0x4ad4, 0xc3a5, 0x3468, 0xa1b1, 0x1ea0, 0x7e3e, 0x2c38,
+    0xc913, 0x2468, 0xd8ef, 0xb937, 0x96a9, 0x210a, 0xce8d, 0x931f, 0x4bf8, 0xd735, 0xb4db, 0x5124, 0x7e24, 0x3474, 0xd7ef, 0x9659,
+    0xa9e7, 0x36e2, 0xbfcf, 0x927d, 0x7d02, 0x9dd3, 0x1810, 0x69de, 0x93e9, 0xce73, 0x6486, 0x7f9a, 0x6c9c, 0x5b8c, 0x964b, 0x329c,
+    0x48be, 0xce1b, 0xa89f, 0x4754, 0x91cb, 0x5e52, 0x7dcc, 0x5456, 0xcc73, 0x1b86, 0x4390, 0xa635, 0xdc4d, 0x6500, 0xbbd1, 0x4b7a,
+    0x26b2, 0xd907, 0x52ae, 0xcfcf, 0x43fa, 0xb539, 0x7cac, 0xc971, 0x78fe, 0xaadd, 0xc703, 0xe719, 0x7016, 0x3128, 0x52b4, 0x21c0,
+    0xcc15, 0x5bb6, 0x7a32, 0x99e7, 0x59b6, 0x2662, 0xbda3, 0xd9b9, 0x38a2, 0xa073, 0xc3bb, 0x3d24, 0xabbb, 0x7e92, 0x2d9e, 0x824d,
+    0xbaab, 0x5b44, 0x9e13, 0xb9fb, 0x82f1, 0xd4e3, 0xc10f, 0x30e8, 0xe99d, 0xb84d, 0x933f, 0xce73, 0x5fc2, 0x7666, 0x22c2, 0xdb63,
+    0x487c, 0x15ee, 0x82c7, 0xd1a5, 0xb347, 0x7d64, 0xd633, 0x5af0, 0x174e, 0xb4f1, 0xe145, 0x6018, 0x9e2d, 0x7950, 0xd54b, 0xaea3,
+    0xa26d, 0x2e16, 0xbf5d, 0xd939, 0x8641, 0x99b9, 0x48f0, 0xb2a7, 0xe2bd, 0x785c, 0x1952, 0xe3ff, 0x9977, 0x8263, 0xa153, 0x5366,
+    0xd13b, 0x412c, 0x8023, 0xcd85, 0x6cb0, 0x89b5, 0xc67d, 0xe273, 0x7fd4, 0x5f88, 0xae9b, 0x3600, 0x793a, 0x20a8, 0xaf13, 0x3516,
+    0xa5fb, 0x1560, 0x80c5, 0x4e8a, 0x6c6e, 0xa5c3, 0x7e94, 0x86c9, 0x5cf0, 0xb83b, 0x9325, 0x3ab0, 0x6300, 0xd915, 0x6d2e, 0x2298,
+    0xd469, 0x9fb5, 0xdf43, 0x43bc, 0x70ce, 0xd4d3, 0x2066, 0xc8a3, 0x9e19, 0xd945, 0x2740, 0x3842, 0x9c71, 0xcb9f, 0x4c60, 0x91b3,
+    0xa545, 0x3d00, 0xd4c1, 0x6b2c, 0x304e, 0x9e9d, 0x5f42, 0xe299, 0x9471, 0x6848, 0x3e9c, 0xd8a5, 0x924f, 0x6120, 0x2c2a, 0x9851,
+    0xd319, 0xae9f, 0x5c60, 0x28c8, 0xadc1, 0x3b5a, 0x60d0, 0x2496, 0x9f53, 0xcec1, 0x3080, 0x6210, 0xb9f7, 0x8149, 0x4372, 0x97ad,
+    0xad1d, 0xda4f, 0xbfdd, 0x6be2, 0xdc31, 0x8491, 0x6e92, 0x9e65, 0xae0b, 0x7cf0, 0xc2e7, 0xa74b, 0x87f7, 0xb351, 0x7d5a, 0x17ee,
+    0xc0c1, 0xe32f, 0x4f6c, 0xb463, 0x67c8, 0x3f64, 0x1c06, 0x56ba, 0x3c92, 0xe52d, 0xae21, 0xc0f3, 0xd1c5, 0x7fc2, 0x2926, 0xa21b,
+    0x3556, 0x3ed8, 0x18dc, 0x9247, 0x4cf8, 0xd8a1, 0x1abc, 0x908d, 0xe405, 0x2116, 0x7dc0, 0x688e, 0x5a94, 0xe303, 0xcbcb, 0x61aa,
+    0x8e31, 0x6608, 0x5384, 0x89e3, 0x69e8, 0xa0fd, 0x7c48, 0x5c84, 0xb069, 0x8a31, 0x1ac2, 0xa14d, 0xe9cd, 0x8baf, 0x6218, 0x503a,
+    0xcd83, 0x8467, 0xd863, 0x2c1a, 0x70fa, 0xe147, 0x4f1c, 0xc89d, 0x27a8, 0x7322, 0xa0d9, 0x44fa, 0x214e, 0xc9f1, 0x4314, 0xd35d,
+    0x6470, 0x8c71, 0x3be6, 0xe215, 0x7e90, 0xd525, 0x3e44, 0x2aaa, 0x917d, 0xa813, 0x560a, 0x7728, 0x8a37, 0x94b9, 0x5b72, 0x73fa,
+    0xa29f, 0x9859, 0x5cac, 0xc77b, 0x6ad2, 0xa305, 0x4c90, 0x1e1a, 0x947d, 0x539e, 0x3dd8, 0x266e, 0x7d3a, 0xc0a9, 0x897b, 0xa3cf,
+    0xe113, 0x3482, 0xb6ab, 0x3d8e, 0xbc75, 0x793a, 0x8963, 0x67a4, 0xcc4b, 0x7642, 0xe307, 0x616a, 0x9c21, 0xdd7f, 0x56f6, 0xa55f,
+    0xd1af, 0x17d6, 0x28a0, 0xe75d, 0x4962, 0x2426, 0x8f6b, 0x6e52, 0x6228, 0x4b5a, 0x1cca, 0xb08f, 0x41b4, 0xd38d, 0xbce3, 0x9ba7,
+    0xbf69, 0x70e2, 0x9981, 0x3046, 0x5abe, 0x1f7c, 0x9569, 0x9851, 0x7082, 0x8023, 0x2bb8, 0x890b, 0x34b4, 0xc2bb, 0x1bd8, 0x51cc,
+    0xba4d, 0x8cff, 0x6338, 0x3968, 0x6852, 0x2bde, 0x5d62, 0x3b58, 0x6c7a, 0x888d, 0x529a, 0x452c, 0x5970, 0x3172, 0xe095, 0x63e0,
+    0x8941, 0xa9ff, 0x71ca, 0x464a, 0xe317, 0x73b6, 0x4bfc, 0x3336, 0x6ec6, 0xd649, 0x9f71, 0xd12f, 0xe8e9, 0xa3d5, 0x670a, 0xbd63,
+    0x7b46, 0x40a8, 0xd173, 0x8e2d, 0x2b7e, 0xe0ed, 0x44da, 0x3212, 0xd133, 0x7bd6, 0xa613, 0x4b7c, 0xb5f7, 0x7be4, 0x4312, 0x4d12,
+    0x8bf1, 0x38dc, 0xc1f1, 0x811b, 0x8e4d, 0x5790, 0x5d80, 0xac97, 0x357e, 0x752e, 0xd0c7, 0xafdb, 0x696a, 0xc08d, 0xd577, 0x1df8,
+    0xceb7, 0x5f90, 0x1d2a, 0xae1b, 0xc62f, 0xd57d, 0x83bb, 0x4890, 0x302c, 0xb0cd, 0x4e72, 0x1cf0, 0xcaa1, 0x3888, 0xe0a3, 0x7750,
+    0x3de8, 0x8da5, 0xcf65, 0xea81, 0xa665, 0xbf0b, 0x929f, 0xcfa9, 0x50b0, 0xaaa3, 0x1bc2, 0xdb43, 0xabdd, 0x250a, 0xe461, 0xb993,
+    0x4c84, 0x7f40, 0x23f6, 0x4ea2, 0xaa93, 0xcdb5, 0x5fb2, 0x4812, 0xd777, 0x539c, 0x2442, 0x639a, 0x308e, 0x5094, 0xd359, 0x3f48,
+    0x899f, 0x3424, 0x7396, 0xc6fb, 0x98b3, 0xddbf, 0x8b6d, 0xb865, 0x4b6c, 0x6210, 0x81e5, 0x3c68, 0x5e5c, 0xb2af, 0x9725, 0x6ddc,
+    0xbf29, 0x8eaf, 0x5e3c, 0xd37d, 0xa7e1, 0x7100, 0x9413, 0xca09, 0x6a60, 0x3962, 0x98ff, 0xd503, 0x9d05, 0x4f90, 0x71ac, 0xbb7d,
+    0x3fdc, 0xa711, 0x35d2, 0xc05f, 0xdb91, 0x3f14, 0x4b06, 0x2ce0, 0xe8db, 0x6e1e, 0x35aa, 0x59b6, 0xae41, 0x4396, 0x1d0a, 0xb8c3,
+    0x7296, 0x15a8, 0x5f24, 0x3f70, 0xb0c3, 0xc6e7, 0x8767, 0x438c, 0xaa41, 0x51b6, 0x3894, 0xe0cf, 0x97b1, 0xba1b, 0x8451, 0xaca9,
+    0x1b2a, 0xbadb, 0x7e7a, 0x267a, 0x9c0f, 0xb3e9, 0xc639, 0xe28b, 0x7dba, 0xb5c3, 0x299a, 0xc6fd, 0x3372, 0x42f2, 0xd305, 0x1f12,
+    0xc83d, 0x8667, 0x344e, 0xe7cd, 0x288c, 0x8b3d, 0xdf25, 0x36ac, 0x86a3, 0xdd09, 0x9087, 0xc6fb, 0x6a9e, 0xd749, 0x3dac, 0x4e0c,
+    0x714c, 0x862d, 0xd57b, 0x67de, 0x1c4a, 0xe4c5, 0xafeb, 0x1f68, 0x92ff, 0x447a, 0x2f98, 0x83eb, 0x1878, 0x672c, 0x8dc7, 0x44a8,
+    0xdb55, 0x7860, 0x3a0a, 0xc8e7, 0x639e, 0x96dd, 0xb50b, 0x4304, 0xcac9, 0xa259, 0x7c7a, 0xe5d7, 0x2e84, 0x4eea, 0x8479, 0x5452,
+    0x2d9c, 0xd2df, 0x5d8c, 0xb4cd, 0x471e, 0xac67, 0xe287, 0x42b4, 0xcc87, 0x6a02, 0xc1fd, 0x49a2, 0xb43d, 0x6704, 0x7f22, 0xd935,
+    0x4300, 0x74e0, 0xc9f3, 0xa8ab, 0x577e, 0xb8e9, 0xe9c5, 0xc4c1, 0xa031, 0x363a, 0xdb67, 0xb323, 0x72a2, 0xc2e5, 0x93c9, 0x3216,
+    0x17a4, 0xcc13, 0xbd4b, 0x26be, 0xae37, 0x197e, 0xc82d, 0x9f41, 0xb51b, 0x4002, 0x46b6, 0x86d9, 0x26fa, 0x6fa6, 0xd31d, 0x4da6,
+    0x6320, 0xe887, 0xb311, 0x3c1c, 0xb929, 0x66c4, 0xb591, 0xabef, 0x1e9a, 0x65d8, 0xe3fd, 0x27cc, 0xbe29, 0x33bc, 0xddab, 0x886f,
+    0x2a9e, 0x6e60, 0x5bb4, 0xa8bd, 0x3342, 0xc279, 0x46f6, 0xb56d, 0x86ef, 0x4cd0, 0x6258, 0x78fa, 0x2da2, 0x5c74, 0x8717, 0x676c,
+    0xa681, 0xe665, 0x8c1b, 0x74dc, 0x5336, 0x6122, 0x216e, 0xba0d, 0x74b2, 0xd3d9, 0x80e1, 0xa5b1, 0x98ab, 0x4192, 0x83f5, 0xc6fd,
+    0x4cd6, 0x3126, 0x80bf, 0x6c42, 0x13e8, 0x78d2, 0x2d4c, 0x57c2, 0x87f5, 0x7274, 0x7ab6, 0x5326, 0x99af, 0x6e08, 0x8999, 0x624c,
+    0x1690, 0xce4d, 0x953b, 0x3edc, 0x33f8, 0xb6f5, 0x8907, 0x1fb8, 0xbeff, 0x3508, 0x9203, 0xd16d, 0xee7b, 0xba73, 0x619a, 0xa827,
+    0xd1f1, 0x634c, 0x9acb, 0x2c90, 0x4bae, 0x3714, 0xca85, 0x7bb0, 0xae45, 0x2c40, 0xc793, 0x1e02, 0x84f3, 0x3b2a, 0xdee3, 0x1774,
+    0x53a8, 0xdf81, 0xb455, 0x2a50, 0x804f, 0x5390, 0x304e, 0x41b6, 0xa28f, 0xb815, 0xcd4b, 0x1cde, 0x34e8, 0x861f, 0x3060, 0xda51,
+    0x9661, 0x7bbe, 0xd159, 0x4a60, 0x2436, 0x913b, 0xb563, 0xc081, 0x85b7, 0xa057, 0xd1f5, 0x74e8, 0x2b88, 0xc4b1, 0x8303, 0xd3a5,
+    0x3f72, 0xa425, 0xe885, 0x9c09, 0x5230, 0x2802, 0x79dc, 0x61d6, 0xef1b, 0xc27b, 0x7d08, 0xc895, 0x612c, 0x281c, 0x7618, 0xdd83,
+    0x589c, 0x9bf7, 0xd385, 0x4c16, 0x6184, 0x1656, 0x46a4, 0x977d, 0x35ea, 0x64ac, 0xd7fb, 0x577a, 0xaf95, 0xc30d, 0xaddd, 0x5ea8,
+    0x73c0, 0x448c, 0xa833, 0x7a7a, 0x94a3, 0x57d8, 0xc55b, 0xcffb, 0x6e12, 0xb05b, 0x2a52, 0x5750, 0xa367, 0x17ae, 0x8fdb, 0xb37b,
+    0x2586, 0x9de3, 0x4d2a, 0xad29, 0x878f, 0x5568, 0x3c26, 0x54f6, 0xafa7, 0xc1eb, 0x77b0, 0xbfa7, 0xcf9b, 0x3d1c, 0xaef3, 0x2482,
+    0x64a0, 0x99ad, 0xaadf, 0x8a9d, 0x563e, 0x3854, 0xdb7d, 0x214c, 0x6656, 0x39ca, 0x862d, 0xc313, 0x9961, 0x74dc, 0x9fef, 0x3b3c,
+    0xa8e7, 0x9439, 0xe5b3, 0x3ab0, 0x73f0, 0x8693, 0x583c, 0x276c, 0xaae3, 0x5168, 0xdb17, 0x7a94, 0xac17, 0x533a, 0x98cb, 0x2be8,
+    0x7f68, 0x54aa, 0x23f0, 0x92d3, 0xd409, 0x880f, 0x1aec, 0x767e, 0x4a00, 0x905b, 0xcc71, 0x8409, 0x202e, 0xcf7b, 0x4b86, 0xb65d,
+    0x7846, 0x54d2, 0x5a42, 0x9d67, 0x902b, 0x789a, 0x5a36, 0x2d40, 0x90b9, 0x74c8, 0x1d0a, 0xb8a3, 0x50aa, 0x3a98, 0x952b, 0x9587,
+    0x2136, 0x88ab, 0x58aa, 0x9f29, 0x6bec, 0x85bf, 0x52f8, 0xd0df, 0x99c5, 0x4750, 0xc855, 0x82a9, 0x9a55, 0x5f8c, 0xcb45, 0xa579,
+    0xbb7b, 0xe6b1, 0x4806, 0x21f0, 0x9a6f, 0xe859, 0x766c, 0x1fc4, 0x9579, 0xe087, 0xc5db, 0x19a8, 0x9303, 0xe659, 0x419e, 0x1fea,
+    0x85c3, 0xb94b, 0x4206, 0x24ae, 0x97ad, 0x3d1e, 0xd573, 0xa773, 0x6390, 0xe491, 0x246e, 0x6d46, 0xbe09, 0x6524, 0xb089, 0xa73d,
+    0x23c6, 0xd7b5, 0x9717, 0x3e7e, 0x4dea, 0xe197, 0xad43, 0x44d4, 0xda67, 0xbbcb, 0xc669, 0x3566, 0x46ee, 0xd1fb, 0x371a, 0xc3b5,
+    0x3a86, 0x74ba, 0xb0ef, 0x8d05, 0xe113, 0x6bfa, 0x3ee4, 0xa115, 0xe571, 0x7084, 0xadab, 0x453a, 0x7e88, 0x196c, 0x906b, 0x6d12,
+    0x26fc, 0xb1bb, 0x4ba4, 0xc731, 0x81db, 0x6e94, 0x9b6f, 0x1d06, 0xde9b, 0x8e89, 0x7034, 0xabb1, 0xca15, 0x4a0e, 0x66e6, 0xad73,
+    0x7f60, 0x7574, 0xa01d, 0x34d6, 0xcc57, 0xbe4b, 0xde75, 0x2464, 0x800b, 0x78dc, 0x5ba4, 0xa737, 0x8195, 0xc385, 0xa353, 0x59c0,
+    0x4456, 0x1776, 0xa25d, 0x6e1e, 0x8539, 0xcb97, 0x6a54, 0x1e54, 0x3eaa, 0x2f06, 0xc4c9, 0x8f99, 0x60f4, 0xe0f9, 0x9b15, 0x5a1e,
+    0x86a1, 0xb6a3, 0x6ec2, 0xc70f, 0x1e18, 0xa6cb, 0xd08d, 0x3304, 0x9d0d, 0x8bb1, 0x101c, 0x6dac, 0xa13f, 0x4136, 0x8cd9, 0x5474,
+    0x2364, 0x408c, 0xb05f, 0x769e, 0xc687, 0x8aa5, 0x59ce, 0x6c48, 0xba39, 0x46f2, 0x9c51, 0x8d57, 0x6f1a, 0x2434, 0x7ee2, 0x3cca,
+    0xdf87, 0xba51, 0x4e24, 0x1904, 0xc7a1, 0x3fe2, 0xa5f5, 0x1d2a, 0x5766, 0x3d22, 0x7a5a, 0x9b91, 0xb7c7, 0x46e4, 0x7a9a, 0xe861,
+    0x59be, 0xc48b, 0x6892, 0xd96d, 0x3400, 0xccd9, 0x9f39, 0x808b, 0xdaa9, 0x280e, 0x5494, 0xa459, 0x4d70, 0xc4ff, 0x81cb, 0xe479,
+    0x5314, 0xc039, 0x4cc8, 0x6e10, 0xcd49, 0xa8ab, 0x7eba, 0xc0cd, 0x99a1, 0xd9d1, 0x530e, 0x1716, 0x633c, 0xdd41, 0x2c54, 0xc66b,
+    0x7bce, 0x40da, 0x5d02, 0xa373, 0xc795, 0x71b8, 0xceff, 0x19ae, 0xba8f, 0x8b89, 0x338c, 0x1d52, 0xe61b, 0x3e06, 0xbfab, 0xd13f,
+    0x726c, 0xb72d, 0xdff1, 0x30d6, 0x419a, 0xa02b, 0x5af8, 0xce4f, 0xaa55, 0x217c, 0x64f6, 0x38d8, 0xa0ff, 0x5bea, 0x6542, 0xb225,
+    0x9ca3, 0xe28d, 0x32c0, 0xd7dd, 0x3a1e, 0x6c58, 0xc4f7, 0xe755, 0x66be, 0xca3f, 0xdf61, 0xaa6d, 0x6b1a, 0xe4b9, 0xb17d, 0x2d86,
+    0xc457, 0x7784, 0x32ec, 0xc0eb, 0x1ba8, 0xd651, 0x3742, 0x907d, 0x8000, 0x28b0, 0x57d4, 0x3462, 0x6e84, 0xaea9, 0x1b7e, 0x6080,
+    0x436a, 0xa773, 0x8599, 0xd63b, 0x61b0, 0x3d5e, 0x6f94, 0xcf63, 0x5924, 0x2bb0, 0xa26f, 0x6d42, 0xd011, 0xac8f, 0xb2cd, 0x4dbe,
+    0x610c, 0x34da, 0x5a84, 0xcb3f, 0xed53, 0xb417, 0x7e72, 0x285e, 0x8c09, 0x3cb6, 0x4726, 0x9ad7, 0x3428, 0xd499, 0x1e92, 0x856b,
+    0x6a6a, 0xbe35, 0x629e, 0xb14b, 0xceaf, 0x6f1a, 0xc71f, 0x90f9, 0x1ec8, 0x2594, 0x6680, 0x9215, 0xb04b, 0x5af0, 0xbb81, 0x7eea,
+    0xa2ef, 0xddd7, 0x60fa, 0xbbd9, 0x1bb6, 0x51be, 0xc91d, 0x7818, 0x2df2, 0x4cb0, 0x89d7, 0x5936, 0xa369, 0x71e6, 0x37bc, 0xc6f1,
+    0x81b7, 0xe743, 0x8bb3, 0x185a, 0xaf8f, 0xea89, 0x409c, 0x52cc, 0xc275, 0x473c, 0x3238, 0x9b8d, 0xdae3, 0x78dc, 0xa11d, 0xd053,
+    0x303c, 0x4562, 0xbc43, 0x1c60, 0x5c3c, 0x7c0c, 0x93ed, 0xbe89, 0x5972, 0xd221, 0x2c0a, 0x4a20, 0xe097, 0x6412, 0x21be, 0x8005,
+    0xebb7, 0xcd7d, 0xb7ad, 0x5ebe, 0xe207, 0x3996, 0xa557, 0xdac1, 0x8c6f, 0x54bc, 0xdf43, 0x18e0, 0x475e, 0xa547, 0x36f0, 0x6880,
+    0x2674, 0x4d92, 0x30b0, 0x7fc6, 0x7844, 0xe0f5, 0x45d2, 0xaf83, 0x5eac, 0x434e, 0x268a, 0xdb85, 0xd319, 0x38d4, 0xaaf1, 0xcac3,
+    0xe631, 0x787e, 0x33bc, 0xd69b, 0x4346, 0xa27d, 0xe337, 0x2d90, 0x8ae9, 0xc4dd, 0x1ef6, 0x7a16, 0xe4b5, 0x5cfc, 0x9695, 0xcfab,
+    0x2528, 0x5a76, 0x9de7, 0xd321, 0x6cbe, 0x7976, 0x74a2, 0x45b2, 0xa409, 0xc5fb, 0xe819, 0x6e6e, 0x3a6c, 0xd247, 0x673c, 0xc55f,
+    0x3402, 0x1a5e, 0x92db, 0x424e, 0x763e, 0xbb31, 0x70a6, 0x31be, 0xb5f7, 0x6338, 0xe25b, 0x8847, 0x238c, 0x5eec, 0xa793, 0x8ee1,
+    0x2bc8, 0xa579, 0xd303, 0x28cc, 0x178c, 0xb583, 0x4e9e, 0x855f, 0x2c98, 0xb1b1, 0x4b28, 0xa235, 0x3f62, 0xc8f9, 0x957d, 0x4a2c,
+    0x6c58, 0xb613, 0x1594, 0x8adf, 0x2e82, 0xaf27, 0x9bef, 0x7d82, 0x5ee4, 0xa30d, 0x7296, 0xafa3, 0x6c88, 0x8819, 0x4708, 0x2d74,
+    0xa37d, 0xc7a3, 0x5238, 0x7926, 0x63a0, 0xcab3, 0x87d3, 0x29f6, 0x5404, 0x80f7, 0xd62b, 0x4da2, 0xeaf3, 0x8c2d, 0x2156, 0xc8ad,
+    0x404e, 0x5f68, 0x7338, 0xb9b3, 0x4a7a, 0xd53d, 0xac2b, 0x4530, 0x1c6a, 0x51c0, 0x8e4b, 0x30f0, 0x7bc4, 0xc37d, 0x44b8, 0x7f36,
+    0x5860, 0xb9a1, 0xe019, 0x4eb2, 0x95db, 0x7c36, 0x20da, 0x62f2, 0xe60d, 0xb7ad, 0xd9c5, 0x898d, 0x4b04, 0xe8eb, 0x4958, 0x7e16,
+    0xc9f3, 0x2a82, 0x6b9a, 0xc9c3, 0x902d, 0xba77, 0xa5ad, 0x8839, 0xae57, 0x4172, 0xbc27, 0x45b4, 0x515a, 0x1f8c, 0x78c8, 0xe149,
+    0x1478, 0xcc43, 0xac97, 0x87ab, 0x94f9, 0x3f3a, 0x6c38, 0x5266, 0xbf97, 0x81c9, 0xb3c5, 0xdabf, 0x76d2, 0x40b4, 0x4d06, 0xa0a5,
+    0xe101, 0x4c24, 0xa25d, 0x23ca, 0x88cd, 0x2fd0, 0x7be2, 0x5880, 0x9f7f, 0x74b0, 0xe7f9, 0xd549, 0x7fb6, 0x166a, 0xa9bb, 0x4976,
+    0x8d6f, 0x24e2, 0x315c, 0x77e8, 0x9751, 0xd6f1, 0x88fd, 0x5dda, 0x935f, 0xdf31, 0xc79b, 0x20d6, 0xb245, 0xe405, 0x4a8e, 0x9341,
+    0x2ef8, 0x50ba, 0x721a, 0x5d72, 0xb9d1, 0x987f, 0x2c02, 0x649e, 0xa991, 0x7e32, 0xe237, 0x584a, 0x1e9a, 0x7d4a, 0x2804, 0x43e4,
+    0xb437, 0x92ff, 0x7348, 0xe4ff, 0x5224, 0xa5b1, 0x42e8, 0x67e2, 0xa7dd, 0x3aec, 0xb825, 0x95ab, 0x6df4, 0x9ae9, 0xd0a9, 0x36b6,
+    0x691a, 0x8a37, 0x285c, 0x3bfa, 0x9b91, 0x4dae, 0x7726, 0xba91, 0x600a, 0x9c99, 0x70de, 0xb0d3, 0x866b, 0x4570, 0xe20b, 0xb581,
+    0xc5e7, 0xdd27, 0x94d5, 0x49e2, 0xb5a1, 0x5622, 0x8db7, 0x6f94, 0xc90b, 0x8bb3, 0xafd5, 0x7456, 0x5ade, 0xb2f5, 0x1f96, 0x6cd6,
+    0x9fe7, 0x637e, 0x7f78, 0x98f3, 0xb373, 0x2558, 0x810d, 0xcf17, 0xa72f, 0x5a42, 0xa9e1, 0x37ea, 0x3504, 0xbb1b, 0x4b14, 0xb3b9,
+    0x89c9, 0x7e96, 0xa62b, 0x3a2e, 0xb98d, 0x300e, 0xb0fb, 0x923d, 0xd7c3, 0x82d5, 0x1990, 0x4cf4, 0xcb29, 0x86e3, 0x2824, 0xab01,
+    0x8cc1, 0x73b2, 0xbb27, 0x5116, 0x845d, 0x272c, 0xda99, 0x4c4e, 0x8f4b, 0x172e, 0x401a, 0x9dad, 0x723c, 0x8c35, 0x46e4, 0xb61f,
+    0x1ae8, 0x7efe, 0x63a4, 0xe24f, 0x8d15, 0x6336, 0x3fec, 0xe6d3, 0x5a48, 0x77be, 0xd533, 0x8f6f, 0x8061, 0x5d32, 0xb173, 0x212c,
+    0xe265, 0xd7a7, 0x8175, 0x51ec, 0xd827, 0x3ab4, 0x4b2a, 0xe1ef, 0x3050, 0xd323, 0x5d2a, 0xcc3d, 0x272c, 0xc739, 0x9aa1, 0x778a,
+    0x55f4, 0x398e, 0x9dc3, 0xb4e3, 0x1f32, 0xe1df, 0x3e7e, 0x726a, 0xde7d, 0xba4b, 0x9e65, 0x28e2, 0x7f3e, 0xafeb, 0x351a, 0xde8f,
+    0x7f0a, 0x1dd2, 0xa1b3, 0x8977, 0x1fc2, 0x91cf, 0x34ae, 0x85a7, 0xa17f, 0x7106, 0xb585, 0x447e, 0x9929, 0x18a8, 0x5848, 0xd827,
+    0xa887, 0x6a60, 0x8bbb, 0x3d3a, 0xb585, 0xd73f, 0xa861, 0xbd3f, 0x4720, 0x672e, 0xa24f, 0x25f4, 0xc975, 0xab53, 0x2f7a, 0x91b9,
+    0x5d3a, 0xb077, 0x9481, 0x1f32, 0x4b76, 0x2e88, 0x4720, 0x1f88, 0x66e8, 0xe46b, 0x8081, 0x8a7d, 0xb04d, 0x62a0, 0x3a70, 0xc8a5,
+    0x9f31, 0x552e, 0x7594, 0x2b28, 0x590e, 0x1b96, 0xd097, 0xa1e3, 0xdfb9, 0x1dd6, 0xc4bd, 0x5a3c, 0x87c9, 0xba0d, 0xd243, 0x74c2,
+    0x2986, 0x318c, 0x7ca8, 0xd259, 0x9f05, 0x25f6, 0x60b0, 0xd6e3, 0xc0ad, 0x3036, 0x4f7c, 0x9567, 0x2318, 0x7242, 0xe303, 0x6bee,
+    0xc08b, 0x55d8, 0xd797, 0xa8b1, 0x4450, 0x2dc4, 0xaa81, 0xb72f, 0x1a3a, 0x6d2a, 0xd1fb, 0x371c, 0x2c8a, 0xcda3, 0x65d6, 0xbc01,
+    0xaf27, 0x4290, 0xdd4b, 0xc08b, 0x39a8, 0x4f62, 0xd295, 0x8e47, 0xc9df, 0x3676, 0x68f6, 0xafbf, 0x421e, 0x6bf2, 0xcb67, 0xe301,
+    0x7a7a, 0x58d6, 0xd44b, 0x8c2f, 0x9615, 0x34e8, 0xcc65, 0x1f76, 0xe271, 0x6556, 0x88dd, 0xca1f, 0x283a, 0x3d66, 0xba0f, 0x74c4,
+    0xab09, 0x523e, 0x661c, 0xc3db, 0xb55d, 0x1dd2, 0x8513, 0x426e, 0x2714, 0xc587, 0x3c14, 0x78d4, 0xd22f, 0x93a3, 0x2730, 0x5d5a,
+    0x77d8, 0x2564, 0xa177, 0xcadd, 0x30ca, 0x5d42, 0x9f9f, 0x1962, 0x3810, 0xdef3, 0xab8b, 0x39ae, 0x91e1, 0x8535, 0x8743, 0xd03f,
+    0x4348, 0xba7f, 0x1d10, 0x537a, 0x45fe, 0xa727, 0x6098, 0x3276, 0x478e, 0x6fae, 0xe2ed, 0x6a30, 0xcca7, 0xa293, 0x7258, 0x4d34,
+    0x2e06, 0xdcc9, 0x6f56, 0x3f74, 0x909f, 0xe59b, 0x54ba, 0x34b4, 0xd863, 0x267a, 0x5684, 0xabcd, 0x9a61, 0x3e5c, 0x999b, 0x555c,
+    0x7f08, 0xebf7, 0xd6e7, 0x2ac2, 0xac49, 0xbf4f, 0x6520, 0x985d, 0xd5fd, 0x7ba2, 0xc955, 0xc4ff, 0xd9b5, 0x2126, 0xca63, 0x6082,
+    0x6a7e, 0xc9f3, 0x38a4, 0x9df1, 0xadb9, 0x33c0, 0x9205, 0xca57, 0x1afc, 0x9a1b, 0xbd69, 0x2b34, 0xe6b9, 0x35a0, 0x704c, 0x89c5,
+    0x9e65, 0x31c6, 0xa6c3, 0x7732, 0xbe25, 0x5c66, 0xa0d5, 0x7646, 0xbfa9, 0x3f16, 0x91d3, 0x4e68, 0x75f4, 0x68d2, 0xb7ef, 0xe19b,
+    0x192c, 0x8125, 0xd9db, 0x734e, 0x4ff0, 0xac3b, 0x9453, 0xbf5b, 0x5bb6, 0x335a, 0x6a76, 0xc115, 0xcc0b, 0x64ae, 0x98e9, 0x5ade,
+    0x8fe1, 0xcd1b, 0x4b40, 0xe173, 0xc429, 0x5452, 0x7662, 0xc3cb, 0xde97, 0x401a, 0xd4b1, 0x308a, 0xcfa7, 0x9467, 0x7002, 0x3052,
+    0xbb1b, 0x37f0, 0x1c82, 0x5e94, 0x861f, 0x530e, 0x6bdc, 0x3596, 0x7f7a, 0x173c, 0xbf43, 0x71f0, 0x62f4, 0x8911, 0xc10b, 0xdf3d,
+    0x75ee, 0x34a0, 0x4704, 0xe479, 0x820d, 0xb4e7, 0xde35, 0x93ff, 0xcecf, 0x6bf6, 0x1ae6, 0x3456, 0xd795, 0xe619, 0x94c7, 0x8ac7,
+    0xb885, 0x4086, 0xebc7, 0xc03f, 0x4e56, 0xc59d, 0xb06b, 0x31fe, 0x42fc, 0x7156, 0x6644, 0x1e74, 0x34ea, 0x94d1, 0x61fa, 0xc5a9,
+    0x843d, 0x97bf, 0xc16d, 0x4e0e, 0x7200, 0xe93f, 0xa69b, 0x4df8, 0x8757, 0x67a4, 0xad03, 0x4200, 0x5b44, 0xd1e9, 0x3fd2, 0x8d43,
+    0x2352, 0x8079, 0xb9dd, 0x8e15, 0x5e4e, 0xc28f, 0x3cce, 0x8ae3, 0x3e94, 0xa58b, 0x592c, 0x76b6, 0x9d9b, 0x8727, 0x5342, 0x1eca,
+    0xd5eb, 0x9a75, 0x7c68, 0x1ec4, 0xa221, 0x8243, 0x77d4, 0x27de, 0xa82f, 0x1a28, 0xd0e7, 0x9893, 0xc349, 0x9bf1, 0x62c8, 0x8f3f,
+    0x168c, 0x3034, 0xa573, 0x2112, 0x7338, 0xb8c9, 0x86b9, 0x91cd, 0x4f86, 0x9b79, 0x1c6a, 0x78e8, 0xdd35, 0x548e, 0xc389, 0x3072,
+    0x94d1, 0xddbb, 0x1b16, 0x816f, 0xdd51, 0x48a6, 0xcedd, 0xeb51, 0x7d44, 0xace9, 0xdaf1, 0x23d0, 0x587e, 0x6c64, 0xc4f7, 0x8c09,
+    0x4aa2, 0xd2c9, 0x5f4c, 0x6c7a, 0xb34f, 0x884d, 0xdc9d, 0xc711, 0x73ac, 0x534e, 0xbca1, 0x2024, 0x5e46, 0xe755, 0x4c6c, 0x2f42,
+    0x71d6, 0xa8e5, 0xcd6f, 0xebc5, 0x69c8, 0x7fbe, 0xdc4d, 0x9f29, 0xb761, 0x2454, 0x9213, 0xb74f, 0x7e4a, 0x1b58, 0xd7fd, 0x40ca,
+    0xc6f5, 0x8bb1, 0xbf7b, 0x24ee, 0xa011, 0xd11f, 0x6aba, 0x972b, 0x48f6, 0x62f6, 0xba5d, 0x7ae0, 0xe4e7, 0x1d26, 0x6daa, 0xca57,
+    0x2d1e, 0x40ac, 0x9c93, 0x63da, 0xdb73, 0x4a8a, 0x68cc, 0x30c2, 0xacb3, 0x5348, 0x6a50, 0x2e52, 0x4dfa, 0xa72b, 0x8675, 0xdec3,
+    0x948d, 0xba1b, 0x4722, 0x7438, 0x5cc0, 0xc8b7, 0x7e10, 0xae91, 0x46b0, 0x39b8, 0x6700, 0x5018, 0xcea7, 0x9fd5, 0x4a2c, 0xbe4f,
+    0x5666, 0x3990, 0x65d6, 0xc521, 0x2536, 0x7662, 0x34e2, 0x8fcd, 0x81c9, 0x1a62, 0xbe45, 0xa8d9, 0x33f8, 0xd4e9, 0x3ebe, 0x5560,
+    0xbed7, 0x8ddb, 0x2a70, 0x60c8, 0xc93f, 0x32e6, 0x43b2, 0x9d9f, 0x1dbc, 0x8153, 0x4242, 0x8b05, 0x19ca, 0x41fe, 0x7084, 0xbd0f,
+    0x2cfc, 0xb1d3, 0x5872, 0xa2e3, 0x6cee, 0x24e6, 0x65aa, 0xc877, 0x1dc4, 0x5396, 0x8879, 0xbcbf, 0x6754, 0xb1bd, 0xe929, 0x4dcc,
+    0x7ba8, 0xd3e1, 0xad7d, 0xc9a7, 0xe733, 0x20ea, 0x9001, 0xd113, 0xb09b, 0x4ed4, 0xe0df, 0x3b16, 0x5590, 0xb5dd, 0x1550, 0x389a,
+    0xa205, 0xd81d, 0x8d93, 0x678c, 0xa069, 0xc9f3, 0x7188, 0x370e, 0xa663, 0x5502, 0x9e33, 0xb747, 0x7394, 0x5982, 0x26f6, 0x4222,
+    0xdcf3, 0x6980, 0x8e8d, 0xa0c5, 0x38f2, 0xdf73, 0x8503, 0x83cf, 0x623a, 0xd67b, 0x9bdb, 0xc0bb, 0xeb39, 0xa6cd, 0x4044, 0x1ba2,
+    0xacb3, 0xe397, 0x6252, 0x2d2c, 0x8623, 0xb16b, 0x4074, 0xc077, 0x185a, 0x804b, 0xd451, 0xc16b, 0xa589, 0x8b4f, 0xb2b3, 0x4b20,
+    0xa8e1, 0xcf71, 0x3e66, 0x69a6, 0x21ca, 0xdb91, 0x77aa, 0xccdf, 0x3010, 0xc2b3, 0x8df7, 0x6cee, 0xe711, 0x4b70, 0x9fa7, 0x762e,
+    0x8813, 0x2b84, 0x6480, 0x4594, 0xcefd, 0x6330, 0xb90f, 0xe149, 0x4d5c, 0x6b42, 0x8525, 0x2d84, 0xe07b, 0x37fa, 0xa7f5, 0xc57d,
+    0x4fac, 0xb3f9, 0xca03, 0x468e, 0xd7a9, 0x3da6, 0x5d26, 0xcbb5, 0x756e, 0xb69f, 0x552e, 0x3ac0, 0xac31, 0x7d7c, 0x5f2a, 0x9d29,
+    0x4492, 0xd0bb, 0x62d4, 0xa081, 0x8ffd, 0x2f8a, 0x68d6, 0xac9f, 0x16cc, 0x4f7c, 0x8d7f, 0x41c4, 0xbff3, 0x9e53, 0x393c, 0xbbad,
+    0x736a, 0xadb5, 0x87e9, 0x3db8, 0xde0b, 0x1f96, 0x42a6, 0xa8e3, 0x271e, 0x6466, 0x958b, 0xcb3d, 0x2fd2, 0xcc6f, 0x97fb, 0x5d94,
+    0xafbb, 0x23d6, 0x5084, 0x96d7, 0x2dd0, 0xc199, 0x3d5a, 0x87f3, 0x7228, 0xc1a9, 0x2930, 0x5874, 0x4d4e, 0x8315, 0xb1c5, 0x647c,
+    0x9441, 0x3384, 0x5c7c, 0xa861, 0x3f84, 0x5a32, 0x1844, 0x7dfa, 0xc1a3, 0x9577, 0xa34d, 0x3086, 0xc105, 0x57ec, 0xb8a9, 0xe049,
+    0x5c00, 0xac2f, 0x4b06, 0x16b2, 0x800f, 0x8c6d, 0x3dcc, 0xe285, 0x82e5, 0x45e4, 0xb20b, 0x8dfd, 0x613c, 0x388a, 0x9cb7, 0x21ba,
+    0x3f9a, 0xa8dd, 0x2b0c, 0xd9dd, 0xbcdf, 0x4750, 0x2248, 0xd473, 0x8967, 0xe12f, 0x9893, 0x7188, 0x1b48, 0x66f4, 0xa8f3, 0x2ef0,
+    0x7c2e, 0xe883, 0x8d67, 0x4b26, 0x9999, 0xe447, 0xd1fd, 0xb439, 0x51f8, 0x66d4, 0xe405, 0x766e, 0x8e6f, 0xa14b, 0x1cc2, 0x6bb6,
+    0xb1cd, 0x4722, 0xc51b, 0xa63f, 0x8fcf, 0xd39d, 0x7a2a, 0x6b08, 0xe3fb, 0xd487, 0xa3eb, 0x5bf4, 0xd797, 0xaccd, 0x3a28, 0xdb8f,
+    0x794a, 0x6c2c, 0x2b02, 0x8c13, 0x4132, 0xe7c7, 0xaafb, 0x5048, 0x94cd, 0x6b2c, 0xab41, 0x504c, 0x15b0, 0x3a22, 0x888b, 0x9e29,
+    0x23da, 0x9981, 0x714e, 0x4c12, 0x2e0c, 0xae3d, 0x4992, 0xd96d, 0x6324, 0x764a, 0x9961, 0x34ce, 0xd6bd, 0x9c79, 0x695c, 0x497c,
+    0x5e66, 0xaee9, 0xc175, 0x2302, 0x39ca, 0x5a8c, 0x142e, 0x7aaa, 0x4780, 0xc1c5, 0xdfd5, 0x84df, 0x177c, 0xa2e1, 0xc9cb, 0x7c4a,
+    0x60f2, 0x15ac, 0x278c, 0xb2cb, 0x7744, 0x6624, 0x5412, 0x296c, 0xbabd, 0xa5bf, 0x3dea, 0x4e5e, 0x719e, 0x2ae0, 0x69ce, 0xb309,
+    0x3ed2, 0x54ca, 0x1f54, 0x99f7, 0xcc87, 0x2586, 0x56b2, 0x7936, 0x94f7, 0xde87, 0x249e, 0x51de, 0x6e0e, 0x290a, 0x508c, 0xdba3,
+    0x605c, 0x7466, 0x2da0, 0xe989, 0x9531, 0x50b6, 0x971b, 0x5de0, 0x7dca, 0xe165, 0x3616, 0x13a6, 0xbae5, 0xd53f, 0x30b6, 0xbd45,
+    0x54f0, 0xe44d, 0xb799, 0x9645, 0xdbe7, 0x25fa, 0x3c8e, 0x986d, 0x5758, 0xa4c5, 0xc94b, 0x5126, 0x7382, 0x13ba, 0x4972, 0x8111,
+    0x6ee4, 0xe4d5, 0x6ca0, 0x8c2f, 0x5656, 0xb3b5, 0xa2db, 0x2ce4, 0x3fa6, 0xc5e1, 0xde07, 0x9811, 0xbb27, 0x1462, 0x7286, 0xe145,
+    0x2496, 0x865d, 0xb5e1, 0x3718, 0x5b3c, 0xbba5, 0x99bd, 0x764a, 0x56a2, 0xc435, 0x9911, 0x7514, 0xda3b, 0x1b16, 0x4ce4, 0xdf4b,
+    0x2bd0, 0x3cec, 0x152a, 0xbabd, 0x84dd, 0x4958, 0x6af2, 0x5e4c, 0x9c31, 0xe891, 0x8655, 0x409e, 0x6d86, 0xae13, 0x1c06, 0xd7e5,
+    0x98c5, 0x7e9a, 0xd195, 0x63ae, 0x83b5, 0xb819, 0x0f92, 0x4ed4, 0xd5a9, 0x8867, 0x41fc, 0x9f63, 0xdfa3, 0x380a, 0xc14b, 0x74d4,
+    0x2520, 0xb2ad, 0xeb0f, 0x760e, 0x8139, 0x9afd, 0xdfad, 0xa903, 0x3d8e, 0xd4dd, 0x49ae, 0x7d02, 0x3cdc, 0x9ad3, 0x8a97, 0x774e,
+    0x248a, 0x995b, 0x87c7, 0xc483, 0xba8b, 0x5b4a, 0xba85, 0xa723, 0x1c1a, 0xd185, 0x2b1c, 0xaaf1, 0xeaa9, 0x8921, 0xc42f, 0x536e,
+    0x642a, 0xd235, 0x7e74, 0x224c, 0x87cb, 0x9a9f, 0x6d50, 0x5a70, 0x2c9a, 0xb441, 0xc6c9, 0x462e, 0xb6b5, 0xdef7, 0x9b07, 0xd441,
+    0x6dc8, 0xb6f9, 0x266c, 0xb283, 0x8ac7, 0x5408, 0x14de, 0x42b8, 0x9df3, 0xcbd5, 0x2f6e, 0x54a4, 0xc921, 0x3998, 0x7ac0, 0xa26f,
+    0xe029, 0x2f78, 0x7a34, 0x3f08, 0x5072, 0x2564, 0xbb3d, 0x84db, 0x4fbe, 0xb211, 0x2d06, 0x7728, 0xeb55, 0x875d, 0x220e, 0x9269,
+    0x5118, 0xdf6d, 0x1b6e, 0xbcc1, 0x84a1, 0xd5c9, 0x2f06, 0x8489, 0xbac1, 0x3558, 0xe97b, 0x8d4f, 0x78d8, 0xbae7, 0x5a84, 0xc6a9,
+    0x4904, 0xd587, 0x60e2, 0x84f5, 0x9f2d, 0x7ade, 0x373e, 0x69cc, 0x991b, 0x3190, 0xc821, 0xac2d, 0x883b, 0x261a, 0xb747, 0xe597,
+    0x7d54, 0x2048, 0x6e0c, 0x4e94, 0xb991, 0xd337, 0x9b4d, 0xe5f7, 0x8eb7, 0x2b86, 0x5e76, 0x3a52, 0x4880, 0x6d36, 0xbb9d, 0x2cd8,
+    0xe6e5, 0x9869, 0xc6f3, 0x532a, 0xa0f7, 0x1d20, 0xc7e9, 0x95f7, 0xe489, 0x216e, 0x7868, 0xb497, 0x8715, 0xc801, 0xdf55, 0x7f9a,
+    0x8fbf, 0xa5d9, 0xdb35, 0xc031, 0x53e2, 0x8ef3, 0xe0f7, 0xb7af, 0x3360, 0x614c, 0x37b2, 0x935f, 0xea2b, 0xcb35, 0x772a, 0x9125,
+    0x1994, 0x9b2d, 0x55c6, 0xbdbd, 0xae81, 0x7ba0, 0x1734, 0xb2db, 0x6360, 0x9bdf, 0xc55b, 0x447a, 0x5e58, 0x80a9, 0x3620, 0x68b2,
+    0xa3df, 0x60ee, 0x34f6, 0x9b49, 0x78ba, 0x4ed2, 0xaab5, 0xcfb7, 0x3350, 0xbcf7, 0x40f8, 0x86e7, 0x6c68, 0xb7ff, 0xdc7b, 0x98ed,
+    0x210c, 0x3e42, 0x7e0a, 0xa0b9, 0x16de, 0x75da, 0x7146, 0xdd1b, 0x8c8f, 0x21ee, 0x68d8, 0x3010, 0xd31d, 0x64e2, 0xbcab, 0x4394,
+    0xa993, 0x5240, 0x6f48, 0x2b74, 0xd341, 0x77de, 0x23c8, 0xdd1b, 0x3d4c, 0xd439, 0x346a, 0x5d26, 0xb3e5, 0x7b20, 0x926b, 0x7132,
+    0xa12f, 0xd1e7, 0x5896, 0x9bfd, 0xcbc1, 0xa451, 0x954b, 0xd0af, 0xba85, 0x386c, 0xae8d, 0x5b08, 0xa5a9, 0x858f, 0x62c4, 0x4592,
+    0xb6db, 0x6f00, 0x35ec, 0x411a, 0xa6f1, 0xd42b, 0x594a, 0xa00b, 0x36de, 0xabcf, 0xd2a3, 0xb98d, 0x6b3a, 0x2666, 0xcfcd, 0x5d9c,
+    0xd3d3, 0x5030, 0x8df5, 0x1c2c, 0xd18b, 0xbaeb, 0x52a0, 0x228c, 0x5370, 0x720c, 0x1dd0, 0xdee5, 0x6520, 0xcecd, 0x1838, 0x4036,
+    0xbefb, 0xe82b, 0x7098, 0x359a, 0xd5b5, 0x1e88, 0x4f5a, 0xcd63, 0x5f0c, 0x95b1, 0x7b50, 0xd117, 0x4804, 0x6c1e, 0x2f3e, 0xbb5f,
+    0x772e, 0x39d2, 0x949d, 0xbd15, 0x6644, 0x3c28, 0xe615, 0xc249, 0x70a8, 0x5e1a, 0x1e36, 0x9bdd, 0x8695, 0x4a9c, 0x3728, 0x58f8,
+    0x19ec, 0xce17, 0x4c12, 0x3a7c, 0xa719, 0x62c4, 0x77cc, 0xbddf, 0x378a, 0x81fb, 0x9635, 0x432a, 0xe161, 0x65fa, 0xbcd1, 0xd3bb,
+    0x5cc6, 0x6420, 0xbecf, 0xe4ed, 0x9613, 0xac3d, 0x3c24, 0xceb3, 0x2396, 0x9777, 0x5bd0, 0x3866, 0x9811, 0x6b4c, 0xc433, 0x5e48,
+    0xa05d, 0xd543, 0xa7af, 0x53e8, 0xb3c5, 0x9319, 0x3d70, 0x5bae, 0xd9c9, 0x233e, 0xc5ad, 0x426e, 0xa41d, 0xdba9, 0x2e32, 0x6a82,
+    0xac61, 0x2296, 0xb14b, 0x365a, 0xd1bb, 0xe541, 0xa917, 0x8d8f, 0x1ffc, 0xdcd3, 0x5f54, 0x6bec, 0x4614, 0x6276, 0xd0cd, 0x9513,
+    0x2cd4, 0xc8bb, 0x9b1b, 0xdeff, 0x8d0b, 0x6828, 0x257c, 0x5a90, 0xba97, 0x71fa, 0xb085, 0x9937, 0xebf5, 0xd30f, 0x9035, 0x3ad6,
+    0xb729, 0x7b12, 0x5fb6, 0xd39f, 0x842d, 0x3f66, 0xdbbb, 0x4c96, 0x68f8, 0x30c6, 0x5ed8, 0xdc0f, 0x1cbc, 0x4fd6, 0x9749, 0x30ea,
+    0xd4a7, 0x6666, 0x4622, 0x788a, 0x3498, 0x688a, 0x7d9a, 0x4e44, 0xc23d, 0xac79, 0xb18d, 0x85c5, 0x1e2c, 0x9737, 0x326a, 0xb629,
+    0xd717, 0x89e1, 0xc329, 0x292c, 0x5bac, 0xd3e1, 0x4244, 0xe2fb, 0x242c, 0x4b5e, 0xb12f, 0x7096, 0xa5d3, 0x8fcb, 0xc747, 0x99ed,
+    0x1aee, 0xcdcb, 0x7ca6, 0x4858, 0xbc73, 0x2234, 0x8c41, 0x7e20, 0x6632, 0xeab1, 0x2788, 0xac61, 0xd83b, 0x91d7, 0x300a, 0x64ea,
+    0xcf73, 0xbb75, 0x3232, 0xda19, 0xbc7d, 0x4f16, 0xc657, 0x39a8, 0xabe3, 0x5ecc, 0x7ffe, 0x4bf0, 0x8c2d, 0x4110, 0x978d, 0xd669,
+    0x7eda, 0x9b43, 0xcba5, 0xe785, 0xae1d, 0x401a, 0x8697, 0xb2f1, 0x4a08, 0x8905, 0xb141, 0x26e6, 0xe74f, 0x40e4, 0xc945, 0x5f4e,
+    0xb0bf, 0x8c5f, 0xe69d, 0x6ab8, 0x2e2a, 0x2ae0, 0xde5b, 0x3e7c, 0x157c, 0x6ade, 0x4f0e, 0xd5db, 0xc153, 0x3cf6, 0xca2f, 0x5214,
+    0x2a0e, 0xc61d, 0xa115, 0xddd5, 0x2274, 0x9201, 0x70f0, 0xe643, 0x7da6, 0x5e30, 0x1952, 0x735e, 0x51b2, 0xa6bf, 0x900d, 0x40b8,
+    0xa3c9, 0x6cf0, 0xa991, 0x346c, 0x6688, 0x337a, 0xc20f, 0x8a15, 0xb8d5, 0xd429, 0x9221, 0xb4f3, 0x4b38, 0x75d4, 0xa159, 0x363c,
+    0x66aa, 0xb02d, 0x5018, 0x3e88, 0xaa13, 0x6702, 0x84e1, 0xb0f5, 0x7044, 0x30aa, 0xbdcb, 0x577a, 0x1a24, 0xb4c3, 0x8e6f, 0xdd19,
+    0xa0ed, 0xe52d, 0x5a3e, 0x434c, 0xd1a1, 0xaf6b, 0x1bca, 0x94c7, 0x4bd4, 0xa333, 0x35cc, 0xe263, 0x7116, 0x2908, 0xbd21, 0xad0b,
+    0x803b, 0x9fd5, 0x75ee, 0xc651, 0xd80d, 0x2d20, 0xea93, 0xb453, 0x5c5c, 0xd6c5, 0x8c5b, 0x2576, 0xa93d, 0x4bd8, 0x1be8, 0x83d7,
+    0x26b0, 0x48ac, 0x96fd, 0x1e92, 0x67c0, 0x496c, 0x994b, 0x6098, 0x6df0, 0xd02f, 0x4ede, 0xbee3, 0x1d92, 0x4fc2, 0xb985, 0x2a5a,
+    0x4112, 0x87b9, 0x6f84, 0x36ea, 0x5e1e, 0x1fb0, 0x6ee2, 0xa5b7, 0x7cc2, 0x6744, 0x929f, 0x26e8, 0x7024, 0xe153, 0x2140, 0x8c17,
+    0x82ff, 0xdf2f, 0x430e, 0x5f5c, 0x7c08, 0x58c0, 0x2bac, 0xbc85, 0x83f1, 0x4452, 0xb277, 0x274a, 0xc1f5, 0xa313, 0x3e92, 0x70b0,
+    0x4052, 0xb4af, 0x5560, 0x3aee, 0x9f99, 0x4722, 0xb16f, 0xd505, 0x6804, 0x19e4, 0xc88b, 0x3a4c, 0x7552, 0x2b74, 0x97e1, 0x6c3c,
+    0xc515, 0x3de0, 0x9269, 0x6a46, 0x3130, 0xb9a3, 0xb53f, 0x9939, 0x7c6e, 0xd1cf, 0xc413, 0x94f1, 0x9a9d, 0x398e, 0x5efa, 0x4a58,
+    0xc057, 0x22e6, 0x8809, 0xb323, 0xc9b1, 0xa24f, 0x1eb8, 0x99f3, 0x5520, 0x700e, 0x4b68, 0xd459, 0x6750, 0x4858, 0x5a6a, 0xbf7d,
+    0x3b32, 0x624a, 0x4d6e, 0x872f, 0x363c, 0xc4d9, 0x6856, 0xab93, 0x8775, 0x3e8c, 0xcca1, 0x2f20, 0xe78f, 0x20da, 0x53ce, 0xe15d,
+    0x6fce, 0xbba9, 0x294e, 0xdc9f, 0x6e86, 0xaf81, 0xdc99, 0x4624, 0x15c8, 0x966f, 0x608c, 0xbefb, 0x4ede, 0x383e, 0xa069, 0xc5a3,
+    0x4b86, 0xa9d1, 0x575e, 0x737c, 0x2c7e, 0x8f63, 0x89bd, 0x4c9e, 0x9ee5, 0xc325, 0xeb2f, 0xa83b, 0xc817, 0x258c, 0xa9dd, 0x5600,
+    0x2dfe, 0x62fe, 0x451e, 0x197e, 0x8e35, 0x56de, 0xc077, 0x3204, 0x921f, 0xcd17, 0x72d6, 0x50b8, 0x9f13, 0x44cc, 0xbb51, 0x2d4e,
+    0x1fc4, 0x472a, 0x7a7a, 0xb4f7, 0x5d32, 0xa907, 0x72b2, 0x7f12, 0x9e57, 0x6398, 0x8f43, 0x1e00, 0x29ce, 0x76ce, 0x9c4d, 0xe4bf,
+    0xab15, 0x8887, 0x5b22, 0x770c, 0x4d20, 0xbcef, 0x257c, 0x4670, 0xbb37, 0x8f3d, 0x3f56, 0xc3bb, 0x876d, 0xe45f, 0x1fb2, 0x7930,
+    0xc4c5, 0x32a8, 0xbcfb, 0x559e, 0xdd1d, 0x9fd7, 0x4924, 0x7172, 0x6ad6, 0x9d0b, 0x33b2, 0xba11, 0x2926, 0xc953, 0xf0e3, 0xb681,
+    0x8575, 0xd533, 0x26ae, 0x9185, 0xeebb, 0x7790, 0x251e, 0x41ae, 0xe08f, 0x4d66, 0x81dd, 0x3cc2, 0x961f, 0xd1ab, 0x4d3e, 0x39bc,
+    0x1378, 0xb141, 0x46a0, 0x6ed6, 0xae2d, 0x79dc, 0x4b1a, 0x927b, 0xc563, 0xd983, 0x7f44, 0x5a3a, 0xce95, 0x8b1b, 0x7c64, 0xd171,
+    0x4c36, 0x31ec, 0x8d11, 0x6728, 0x7dd4, 0x48bc, 0x9715, 0x8bad, 0x6d00, 0x1e62, 0xb60f, 0xc3ad, 0x7be2, 0x930f, 0xb4f5, 0x44a2,
+    0xd63f, 0x8751, 0xa5db, 0xca83, 0x69c0, 0xdb59, 0x892d, 0xad23, 0x41f4, 0x8c73, 0xb7b1, 0xe815, 0x77b0, 0xa99d, 0xd5e5, 0x842d,
+    0xe217, 0x68e4, 0x267a, 0xd7cb, 0xa3f1, 0xe231, 0xd281, 0xbe5b, 0x39ea, 0xd1a5, 0x5952, 0xb041, 0x4880, 0x64fe, 0x9559, 0xb07d,
+    0x4e74, 0x756c, 0xa647, 0x8f9d, 0x272a, 0xc135, 0x4a88, 0x6e60, 0xd22f, 0x635a, 0x9f61, 0xd7d7, 0x8549, 0x5bac, 0xe6a7, 0x516e,
+    0x9e09, 0x6d36, 0x79ae, 0xcecb, 0x1f66, 0x8d1b, 0x7ada, 0x3134, 0x9d2d, 0x4c90, 0x8a83, 0xb9f9, 0x5f76, 0xab5f, 0x14fc, 0x4db6,
+    0x2dc0, 0xae75, 0x277c, 0xdedb, 0x93c1, 0x702c, 0x4f16, 0x17ee, 0x833b, 0xa831, 0x2b70, 0x41d2, 0x75d6, 0xe679, 0xb703, 0xaabb,
+    0x7786, 0x1688, 0xe4d3, 0x6188, 0x2b7a, 0x40d4, 0xd225, 0xe851, 0x2e60, 0x87f3, 0xc9d3, 0x3b1a, 0xbbaf, 0xa5e3, 0xd1eb, 0x7330,
+    0x1d3c, 0x9b87, 0xe781, 0xa741, 0x701c, 0x89b1, 0x2f36, 0xb769, 0x7b98, 0xd487, 0x8b97, 0x6614, 0xb815, 0x40c6, 0x7750, 0xa425,
+    0x48c4, 0x876f, 0x53c0, 0x7e84, 0x8e59, 0x3552, 0x50a6, 0xa59f, 0xcf5d, 0x796e, 0xad31, 0x27da, 0x7544, 0x6e1c, 0x5b48, 0x84e7,
+    0x7382, 0x97e9, 0x4ccc, 0xb3f1, 0xe609, 0x4570, 0xcda7, 0x21a4, 0x71e8, 0x4158, 0x1890, 0x386a, 0x7704, 0x60d2, 0xe349, 0x1d78,
+    0xcc27, 0x9583, 0xaaf1, 0x7ee0, 0x66be, 0xcb33, 0x6fa2, 0xa171, 0x5be0, 0x1694, 0xa8ef, 0x89c9, 0xca79, 0x1e02, 0x7a4c, 0x8a69,
+    0xd13f, 0xa815, 0x3a2a, 0x2790, 0x8aed, 0x4de4, 0xc1fb, 0x52c4, 0xdbf9, 0xb3b5, 0xcf2d, 0x70b0, 0xdc37, 0xa657, 0x5940, 0x34f8,
+    0x6e4e, 0x1730, 0xb2cf, 0x3844, 0xd523, 0x717e, 0xa977, 0x893b, 0x5512, 0x2d82, 0xdb13, 0xa049, 0x2d22, 0x4ca2, 0xb3a7, 0x627a,
+    0x3b7a, 0xdcf7, 0x5eac, 0x8297, 0x921f, 0x75fe, 0xa6e7, 0x202e, 0xe7df, 0x516c, 0x389e, 0x80bf, 0x8457, 0x5a96, 0x8eef, 0x2cbc,
+    0x4d98, 0x9853, 0x1ba6, 0xcae1, 0xbde7, 0x5e36, 0x9e05, 0xcd53, 0x996f, 0xb375, 0xac1b, 0xda51, 0x7296, 0xa99f, 0x6158, 0x766c,
+    0x694a, 0xc6bd, 0x2d32, 0x8db1, 0xe147, 0x30ae, 0x3b2c, 0xd687, 0x2dde, 0x63c0, 0xb377, 0x420e, 0xab1d, 0x25a8, 0x59ee, 0x45c4,
+    0xe491, 0xb797, 0x28f0, 0xdc95, 0x425c, 0xaccd, 0x2228, 0x356c, 0xca65, 0x499e, 0x3c22, 0x6c66, 0x55a2, 0x3146, 0xe317, 0x705e,
+    0xaedb, 0xc3bb, 0x3834, 0x2f96, 0xbb51, 0x51de, 0x27a2, 0xc8c3, 0xe4cb, 0x19b6, 0x5624, 0xa275, 0x82fb, 0x3030, 0x4a20, 0x8bb1,
+    0x20e0, 0xbb7b, 0x978f, 0xc8c1, 0x53e6, 0x2edc, 0x81ef, 0x477a, 0x12e8, 0xaf85, 0x83a1, 0xcbe3, 0x8993, 0xc0f9, 0x41be, 0xcbb1,
+    0x2eae, 0xc489, 0xd411, 0x4bfc, 0xae4d, 0xdf9f, 0x9553, 0x3bda, 0xaea9, 0x751e, 0x4dfe, 0x3776, 0x85d1, 0x19fa, 0xbc35, 0x2878,
+    0xc9ff, 0xe0b3, 0x23f0, 0x9bad, 0x60b2, 0xea93, 0xce53, 0x38d4, 0x97bb, 0xe651, 0x699c, 0x49fc, 0xd737, 0x97f1, 0x66a2, 0xe5b9,
+    0x846d, 0x7942, 0xa5c9, 0x5300, 0xcdfd, 0x2a56, 0x6154, 0xe381, 0x406a, 0x4f94, 0x5db2, 0xbfab, 0xd54f, 0x7ce2, 0x2ca4, 0x88eb,
+    0xd0b7, 0x97c3, 0x5824, 0x91dd, 0xc2bf, 0x7548, 0x8a63, 0x6732, 0xb359, 0x26d8, 0x7654, 0x5d8e, 0x92a5, 0x1c14, 0x8197, 0x866f,
+    0x5268, 0xd4ff, 0xba59, 0x18f0, 0x5510, 0xdbab, 0x9735, 0x4db0, 0x550a, 0x1e28, 0xb9a3, 0x5348, 0xa017, 0xc8b5, 0x6320, 0x30d8,
+    0xaaf7, 0x394a, 0xd3d3, 0xa509, 0x1f32, 0xc5c3, 0x7120, 0xba6d, 0x3976, 0x546a, 0x8cb1, 0xd98d, 0x3bb4, 0xd0bb, 0xe7af, 0x158e,
+    0x25f0, 0xddfb, 0x353a, 0x6b1c, 0x8d35, 0xa2c9, 0x6844, 0xb9c9, 0xdde1, 0x94f9, 0xb1fd, 0xd6bb, 0x99af, 0x543a, 0xb70d, 0x3dd8,
+    0xa5f5, 0xc1a5, 0x3c00, 0xdb55, 0xb83d, 0x2322, 0x356e, 0xe229, 0x7e86, 0x41c8, 0xdaed, 0x3520, 0x63bc, 0xb27d, 0xe323, 0x5b50,
+    0x9d19, 0x69f4, 0xc45d, 0xe08f, 0xabc5, 0xd08d, 0x7e0c, 0x1e88, 0x3732, 0xbc2d, 0x435c, 0x8375, 0x52b0, 0xb117, 0x42de, 0xd1eb,
+    0x6ae8, 0x446e, 0xd295, 0xa345, 0x5f8c, 0x96fd, 0x3daa, 0xd3b7, 0xa9e7, 0xc5e3, 0x6ee0, 0xadcb, 0x5a28, 0xca99, 0x718a, 0xb1d7,
+    0x8681, 0x9879, 0x1a16, 0xab25, 0x3082, 0xc5d7, 0x3b20, 0x9419, 0xdab9, 0x2a20, 0x6a8e, 0xe209, 0xa0ab, 0x1ba8, 0x3c24, 0x7736,
+    0xc501, 0x5ef8, 0x6bb6, 0x830b, 0x3304, 0x4648, 0xc11b, 0x29a0, 0x4cc0, 0x14c8, 0x6014, 0x3140, 0x7f06, 0x2a02, 0xe0d5, 0x3c0a,
+    0xa2f1, 0x8eff, 0xd2c3, 0x227e, 0x6492, 0xb9f7, 0x8617, 0x73c0, 0x9817, 0x1e00, 0x82b1, 0x309a, 0xc0f7, 0xdee7, 0x9b41, 0xb09b,
+    0x6a42, 0x5660, 0x8d0d, 0xac43, 0x6ecc, 0x5c16, 0xc527, 0xde53, 0x6d06, 0xa10b, 0x90c7, 0xedfd, 0xd259, 0x83b7, 0xa1db, 0x47e6,
+    0x1b54, 0x603a, 0x6fba, 0x8e5d, 0xa99f, 0x77a6, 0x9597, 0x62e2, 0x350a, 0x79a0, 0x6c3e, 0x3f9a, 0x22b6, 0x60ac, 0xdbb9, 0x7462,
+    0x52e8, 0xaf9b, 0x4892, 0x7a3a, 0x4448, 0xaaed, 0x8e45, 0x66b6, 0x9771, 0xe7ef, 0x5a5c, 0x2db6, 0x1c98, 0xddb3, 0x72ae, 0x5000,
+    0x809b, 0x5820, 0x20b2, 0x8a55, 0x704a, 0x5f14, 0x1d92, 0xde53, 0x92d5, 0x2736, 0xcdd7, 0xb407, 0x72c4, 0xa755, 0x9911, 0x7046,
+    0x8867, 0xaadd, 0x3b42, 0xc30d, 0x6d5a, 0x4eb6, 0xaa7f, 0x5bb6, 0x7bce, 0xd6bb, 0x22ba, 0xa16d, 0x328c, 0x7f00, 0xcf01, 0x4b44,
+    0x6558, 0x5bf2, 0xc947, 0x3a48, 0x8311, 0xc371, 0xb307, 0x9ac1, 0xd741, 0xb51b, 0x2224, 0x9645, 0x596c, 0x1d9c, 0xc0ad, 0x4026,
+    0x5b96, 0x37d0, 0xb4c3, 0x71b2, 0xd7f1, 0x5240, 0xa671, 0x3886, 0x9ab9, 0xe1eb, 0x534c, 0xaaaf, 0xdb4d, 0x2d88, 0xe38f, 0x4bac,
+    0xa885, 0x31ce, 0x7636, 0x4060, 0xcadf, 0x6788, 0x22fa, 0xe109, 0xb31d, 0x9045, 0x460e, 0x2e8a, 0x8875, 0x22f2, 0xb9d3, 0xdc5f,
+    0x9811, 0x67ba, 0xc5db, 0x4c00, 0x5d3a, 0xe73d, 0x80db, 0x8fd7, 0x2a6a, 0xcb1b, 0x9c4d, 0x49e8, 0xb7a1, 0x9af3, 0xb1e7, 0x6628,
+    0xb593, 0xcd99, 0x852d, 0xc8b9, 0x20e6, 0x5112, 0x46c4, 0xc42d, 0x3190, 0x6752, 0x5976, 0x7d5a, 0x313a, 0xbd93, 0x72c0, 0x8511,
+    0x7134, 0x6146, 0x46d2, 0x2c2c, 0x748e, 0x80ad, 0xa89f, 0x5864, 0xc3bb, 0x9137, 0xbb59, 0x2bd2, 0x7ace, 0xa981, 0x6db8, 0x3e1a,
+    0xd6c1, 0x14de, 0x51b8, 0x8539, 0x6c7a, 0x1c02, 0x9d4f, 0xb4cb, 0x88b1, 0x5ad6, 0x29b2, 0xadef, 0x629a, 0x2062, 0x83b9, 0xc7fb,
+    0xaf1d, 0x946f, 0xedab, 0x852d, 0x27fe, 0xd281, 0x76f4, 0x1c4e, 0x6e42, 0x4808, 0x85dd, 0x2180, 0x7106, 0xa16f, 0x261c, 0xd771,
+    0x4baa, 0x7928, 0xcdb3, 0x49fe, 0xdded, 0x55ac, 0x55b0, 0x860f, 0xbb6d, 0x8aad, 0xab33, 0xc8ad, 0x5006, 0xd2e5, 0x6cbe, 0xb279,
+    0xe08f, 0x408a, 0xb63b, 0xd921, 0x5426, 0xa143, 0x8bcf, 0xdf39, 0x7068, 0x7f02, 0xdab5, 0xc4cf, 0x4ab4, 0xacaf, 0x9c59, 0xcd2f,
+    0xbacb, 0x5258, 0x7886, 0xaf0d, 0x9f6b, 0x5bd0, 0xcaa5, 0xb119, 0x50f8, 0xe173, 0x6350, 0x95d1, 0x6f26, 0x4daa, 0x1a40, 0x85a3,
+    0x2a38, 0x7bd0, 0xc5d5, 0x1b1a, 0xd7df, 0x861f, 0x9d49, 0x789c, 0xad5b, 0x7ddc, 0x2ec8, 0xa38f, 0x1694, 0x35c0, 0x6618, 0xcb3b,
+    0x949d, 0xea4d, 0x5770, 0xd5f5, 0x3eae, 0x1d3e, 0xda3f, 0x4bee, 0xa46f, 0xc0b7, 0xdc3f, 0xd3bb, 0x99b5, 0xbd8f, 0xc9eb, 0xa195,
+    0x39ba, 0xdf7f, 0x2b08, 0x8a71, 0xcf67, 0x70d6, 0x397c, 0xd78b, 0x28b6, 0x7526, 0x40c6, 0x92d7, 0xa281, 0x6698, 0x29f8, 0xb3ad,
+    0x9f57, 0x3cac, 0xb8f5, 0xe8a3, 0x3502, 0x7e6a, 0xb53f, 0x5b90, 0x4624, 0xbb1f, 0x2fa8, 0x58be, 0xdb6b, 0x3dda, 0x4c8c, 0xd3ed,
+    0x2f56, 0x5928, 0x4f00, 0xb533, 0x305a, 0x8317, 0x19e4, 0xbd43, 0x2918, 0xb0f5, 0x5ece, 0x9ef9, 0x6a18, 0x3de2, 0xbbc5, 0xa6c9,
+    0x221c, 0xdd6d, 0x9c8f, 0x1260, 0x66f6, 0xa45f, 0x4300, 0x2af4, 0x7d92, 0x740c, 0xdb11, 0x87f7, 0xa8f1, 0x4ab0, 0x962d, 0x6ed2,
+    0xdeab, 0x876b, 0xa48b, 0x1ac6, 0x3624, 0x97f5, 0x1efe, 0x53f6, 0x6cea, 0xc585, 0x9b11, 0x430c, 0x6d1c, 0x552c, 0xba3d, 0xc7bb,
+    0x9fdf, 0x687a, 0x60d0, 0xb7f5, 0x93f3, 0xb2cb, 0x78aa, 0x3cda, 0xca97, 0x6a12, 0xd6a3, 0xaa69, 0xe6c5, 0x70ea, 0x3a5a, 0x8629,
+    0x57ea, 0x169c, 0xdde7, 0x86d3, 0x9b9d, 0x4226, 0x1e94, 0xacad, 0x6542, 0xd601, 0x1da8, 0x64de, 0x5a90, 0x2a40, 0x4d8e, 0x9b8f,
+    0x4016, 0x4854, 0x94ad, 0x3484, 0xbc09, 0x7684, 0xa083, 0x82d1, 0x24b8, 0xa0a1, 0x4ce8, 0x9031, 0xd6d9, 0x3986, 0x9809, 0xd4b7,
+    0x21a6, 0xe57f, 0x8ce9, 0xa177, 0xd5c5, 0x454c, 0x98d7, 0xb173, 0x1d76, 0x585e, 0x77b4, 0xdf1b, 0x5262, 0xc139, 0x233e, 0x2e0e,
+    0xa491, 0x77c0, 0xb3af, 0x30cc, 0x54bc, 0x3e4a, 0xdd8f, 0x63fc, 0x7490, 0xeb1b, 0x7a24, 0x991f, 0xccf1, 0xe16d, 0x2cf0, 0x7d76,
+    0x4fcc, 0x185a, 0x3c6a, 0x6c8a, 0x4a92, 0xc17b, 0x4494, 0xb5d7, 0xe675, 0x3552, 0x8447, 0xd847, 0x4000, 0xd6a7, 0x8b05, 0x2fd6,
+    0x4f04, 0xbd3f, 0xa0bd, 0x615c, 0x825b, 0xa65f, 0x2096, 0xc3cd, 0x4d6c, 0x4fd0, 0x14d8, 0x74f8, 0x3534, 0xb3e9, 0x9af1, 0xcbdf,
+    0x259c, 0x827d, 0xa02f, 0x1f98, 0x8a4b, 0x2e8e, 0x67f2, 0xabc7, 0x429a, 0xb96d, 0xa29d, 0x3b5e, 0x7630, 0x578c, 0x6834, 0x1fc0,
+    0x4186, 0x5fc8, 0x396a, 0x326e, 0xd15f, 0x426e, 0x234a, 0x91b1, 0x388a, 0x7994, 0xc795, 0xd711, 0x39bc, 0x7e4a, 0xc755, 0xdbcb,
+    0xa231, 0xbea1, 0x3dc4, 0x4baa, 0xa387, 0x24ee, 0x4244, 0x32cc, 0x1b70, 0x5400, 0xc55b, 0x4936, 0x747a, 0xbfc3, 0xb177, 0x7bde,
+    0x353e, 0xb993, 0x2318, 0xadb5, 0x6de6, 0xc9e7, 0xbb5b, 0x6f4e, 0x93b9, 0x4fbc, 0x2194, 0xaaeb, 0x4a86, 0x7504, 0x18f2, 0x4b86,
+    0x82e1, 0xd191, 0xb2df, 0x5d3c, 0x1f6e, 0x9beb, 0xbb09, 0xcad7, 0x50ae, 0xb073, 0xd26b, 0xc037, 0x848d, 0x539c, 0xd733, 0x918d,
+    0x6f66, 0xdc95, 0x7c60, 0x56b4, 0xa423, 0x441a, 0xc337, 0x7cec, 0x88c1, 0xa6bf, 0x73b8, 0xa169, 0x8605, 0x5c5e, 0xcca5, 0x7fce,
+    0x17f0, 0x9019, 0xd70d, 0x8419, 0x9f77, 0xd9cf, 0x6cea, 0xa9e3, 0x4b76, 0x4204, 0x8e13, 0xc63d, 0x5bb8, 0xa6c3, 0x228e, 0xdab5,
+    0x57c8, 0xb069, 0xbba5, 0x2c22, 0x900b, 0xdc1f, 0x57d2, 0x2244, 0xc42f, 0xa00b, 0x3d9c, 0x2b50, 0x783c, 0xd9e3, 0xa8f3, 0xb6d1,
+    0x34e0, 0xcfff, 0x4bc4, 0x6278, 0xdd9d, 0x9759, 0xcbf9, 0xd8c1, 0x81f5, 0x2f64, 0x1400, 0xc6c1, 0x8add, 0x91d5, 0x379c, 0x61f8,
+    0x14c8, 0x8681, 0xeb8f, 0x389c, 0x248e, 0xc4f1, 0x4dd4, 0x6e8c, 0x8e8d, 0x1da4, 0x7c46, 0x5cea, 0xae7d, 0x6a4e, 0x4f8e, 0xc2dd,
+    0xa4e1, 0x3fc6, 0x734c, 0x2ce2, 0xb4c3, 0xd633, 0x5ad8, 0xc28b, 0x7d54, 0x4d44, 0x90df, 0xafa3, 0x7e1a, 0xcf4d, 0x915b, 0x77ce,
+    0xd6c9, 0x5e88, 0x6baa, 0xad7f, 0xe5b9, 0x3d12, 0xd11f, 0x96a7, 0xdbeb, 0x4640, 0xcda7, 0xb5c9, 0x1e82, 0x53f4, 0xabcd, 0x491c,
+    0x25ce, 0xb3d9, 0x45ec, 0xba99, 0x5b08, 0xc4a3, 0x6bcc, 0x7186, 0x2e48, 0xd337, 0x9ea7, 0x453e, 0x8a7f, 0x5e0c, 0xd1c9, 0x9217,
+    0xc1bd, 0x4b8e, 0xe957, 0x9b3d, 0xc277, 0xcb31, 0x50ec, 0x277c, 0xa571, 0xd4cf, 0x1606, 0x3834, 0x78fa, 0xa63b, 0x5560, 0xa359,
+    0xdb95, 0x5fb0, 0xb49b, 0x8ddd, 0x2252, 0xacb7, 0x634e, 0x8eed, 0x614c, 0x9b37, 0xc5db, 0xafb3, 0x4e70, 0xbca5, 0x6d18, 0xa59f,
+    0x39dc, 0xc71b, 0x24fe, 0x3026, 0x8acd, 0xbf35, 0x75c6, 0xa4c7, 0xdc53, 0x3342, 0x9ac3, 0xe699, 0x600e, 0x22ca, 0x7f32, 0x334e,
+    0x5332, 0x4878, 0x6672, 0xcc3d, 0x7a4e, 0xbe37, 0xd7c7, 0x3352, 0x897d, 0x510e, 0x590c, 0x9283, 0xe4c5, 0xc1d1, 0x33c2, 0xd5f9,
+    0x9fe9, 0xcbef, 0xe71d, 0x8d9d, 0x82c7, 0xa9f1, 0x7128, 0xdfbb, 0xb451, 0x3076, 0x9b5d, 0x6960, 0x27a2, 0xa5e9, 0x5a5a, 0x32fc,
+    0x478e, 0x642e, 0x95d9, 0xcef7, 0x7fa2, 0x5d2a, 0xc0a9, 0xd2a5, 0xe7a5, 0x982f, 0xbc0d, 0x5f0a, 0xdee9, 0x8dd3, 0x5368, 0x2796,
+    0x6482, 0xa479, 0x853d, 0x497c, 0x9749, 0x61a2, 0x3292, 0x2408, 0xc8b3, 0x3a52, 0x7e9a, 0x696c, 0x2d8a, 0x8fa3, 0xe0e3, 0x42a2,
+    0x94dd, 0x6c54, 0x31cc, 0x7420, 0xe65b, 0x440e, 0x5896, 0x788c, 0x878f, 0x241e, 0x6878, 0x489c, 0xe59b, 0x3cb6, 0xc3c3, 0x142e,
+    0x40b2, 0xabe9, 0x26ce, 0x60a8, 0xd127, 0x980b, 0x3386, 0xd01d, 0x67ee, 0x3922, 0xe361, 0xc7b9, 0x1e2e, 0x2644, 0xc163, 0xa155,
+    0xabc5, 0x7390, 0xe43f, 0x1f5e, 0x5358, 0x474a, 0x9191, 0xe477, 0x8457, 0xbf79, 0xd611, 0x2140, 0xe5f3, 0x79a0, 0x4aaa, 0x9339,
+    0x30d4, 0x411c, 0x7d18, 0x500a, 0xe7cd, 0x7b0c, 0xa8f5, 0xccb3, 0x8c07, 0x4ec0, 0x55ce, 0xb49b, 0xc4d7, 0x37a8, 0x4cc2, 0x1c4e,
+    0x8667, 0x7b98, 0xc52d, 0x9593, 0x5dba, 0xb909, 0x7278, 0x4b38, 0xb09d, 0x903f, 0x504a, 0xb4bf, 0xd345, 0x2a38, 0x7778, 0xdd31,
+    0x4f82, 0x9355, 0xd931, 0xa345, 0x7348, 0x9e99, 0x3f58, 0xd74d, 0xb4d7, 0x2dbc, 0xbc6f, 0x491a, 0x1446, 0x974f, 0xd229, 0x29ea,
+    0xe56d, 0xaefd, 0x6cb0, 0xc801, 0x3468, 0x73f2, 0x8d11, 0x4aa0, 0xe0eb, 0x33f0, 0xb93f, 0xdeff, 0x3f80, 0x20f8, 0xb95b, 0x378c,
+    0x8515, 0xb3d1, 0x193a, 0x90db, 0x5108, 0x57e8, 0x1aa6, 0x6938, 0x5668, 0xbb55, 0x7ac0, 0x622c, 0x9d55, 0xc605, 0x7af8, 0x67d6,
+    0xcc75, 0xaa0b, 0x7868, 0x6c74, 0x0e9c, 0x297c, 0xe4a7, 0x4c0a, 0x8a0d, 0xabf3, 0x6840, 0xba57, 0x2dae, 0xafd5, 0x6cb4, 0x7ff8,
+    0xce0b, 0x59a0, 0x2aac, 0xa667, 0x667c, 0x82ed, 0xae09, 0x9145, 0x42dc, 0x9f27, 0x5114, 0xb85b, 0xd329, 0x4a56, 0x332a, 0xcfe9,
+    0x7984, 0x2b36, 0xc56b, 0xdb5b, 0xa14d, 0xe411, 0x787e, 0x2f2c, 0xc66b, 0x239c, 0x5b44, 0x72d6, 0x2060, 0x4266, 0x7e5c, 0xef01,
+    0x60fe, 0x95f5, 0xd8b9, 0xb0a3, 0x5a6c, 0x2b92, 0xcf99, 0x4128, 0x667a, 0x7772, 0xd183, 0x96b1, 0xb905, 0x5584, 0xa103, 0x7998,
+    0xecef, 0xbd23, 0x2d66, 0xde99, 0x594c, 0x47ac, 0x9617, 0x1df6, 0xe997, 0xc80d, 0x2732, 0x14ec, 0x6c40, 0xa71f, 0x8289, 0x6340,
+    0x7a1e, 0xabd9, 0x1aba, 0x66e4, 0x4ebe, 0xc78d, 0x19f6, 0x627a, 0x5b44, 0xc8c9, 0x4480, 0x8f09, 0xe12f, 0xbbbd, 0x9321, 0x79b0,
+    0xe5fb, 0xaf3d, 0x6c7c, 0x36ca, 0xe021, 0x91e7, 0xb06f, 0x69be, 0x8621, 0x408c, 0x6cd2, 0x2de4, 0x9a13, 0x20f6, 0xcf35, 0xe111,
+    0x4990, 0xc715, 0xd857, 0x2864, 0x827d, 0xe22f, 0x8d2b, 0xa207, 0xe5eb, 0x5ee8, 0xc72b, 0xdf93, 0x9a0d, 0xcf1f, 0x6842, 0xa259,
+    0x2a58, 0xd387, 0x8dd9, 0x52f0, 0xae87, 0xca0f, 0x922d, 0x2f32, 0xe4cd, 0x9e69, 0x5f9e, 0x19d8, 0x9d43, 0xabb5, 0x8473, 0x6206,
+    0xcc6d, 0x9c49, 0xbd73, 0x4d5a, 0x8c59, 0x1ec4, 0xda97, 0x59ba, 0xa74f, 0x1696, 0x7b88, 0x5086, 0x91c7, 0x7416, 0xe4ef, 0x56ba,
+    0x3f9a, 0xc463, 0x3e28, 0x6f32, 0xc34d, 0xc6e9, 0x3582, 0x601e, 0x2bbe, 0x7176, 0x3478, 0x623c, 0x92ff, 0x31f4, 0xc2d9, 0x8763,
+    0xe469, 0x9cb5, 0xd44f, 0x6318, 0xb01d, 0x1b52, 0x37c8, 0x6496, 0x92d1, 0xe4bb, 0x1bf0, 0xd621, 0x8f75, 0x5d1a, 0x832b, 0xb271,
+    0x5c1e, 0x3fb6, 0xab8d, 0x2a1a, 0x78c0, 0x3c86, 0x25f8, 0x9e95, 0x27a6, 0xe181, 0x725a, 0x6474, 0x4c2a, 0x8465, 0xbe95, 0xae95,
+    0xc631, 0x2414, 0x4370, 0x549a, 0x65b6, 0xdd9d, 0x1996, 0xa2a7, 0x5cb6, 0x7dee, 0xa8d3, 0xe55d, 0x37a4, 0xbb73, 0x8c99, 0x2d92,
+    0x7d06, 0x5320, 0xb915, 0x93e5, 0x4f16, 0xa09b, 0x1e6c, 0x8253, 0xa157, 0x2776, 0x6fb4, 0x55a8, 0xc43d, 0xa0bd, 0x700c, 0xe235,
+    0x288c, 0xc87b, 0x4408, 0xdd67, 0x7e36, 0xbba3, 0xca19, 0xa53d, 0x271a, 0x9db1, 0x7fe0, 0x2054, 0x44fe, 0xe2dd, 0x3b2a, 0x88df,
+    0xd4a3, 0x5f5e, 0x3416, 0xc84f, 0x8d85, 0xa34b, 0x870d, 0xbb71, 0xdb3b, 0x524a, 0x1708, 0x83ef, 0xdb45, 0x7bd2, 0xa26d, 0x1d40,
+    0x4baa, 0x3598, 0x71ea, 0xd375, 0x153e, 0x32a0, 0x7b90, 0xd563, 0x233a, 0xbcfd, 0x6d44, 0x83c9, 0x2820, 0x8f3d, 0x6932, 0xbd29,
+    0x42e4, 0x9367, 0x53ee, 0x6c5e, 0x423c, 0x37d0, 0xbf51, 0x8729, 0x53c8, 0xa8b5, 0x3c8a, 0xe479, 0x8faf, 0x948f, 0x1dd4, 0xc7a1,
+    0x726a, 0x48ca, 0x7f7a, 0x6e9c, 0xe4fb, 0x4e82, 0x92eb, 0xb191, 0x553c, 0x23c6, 0xa385, 0x3e66, 0x6dd4, 0xdae5, 0x48ba, 0xc0b3,
+    0x9d55, 0xafb5, 0x7b0c, 0x8f25, 0x3348, 0xb309, 0x7ec6, 0x51fa, 0x734a, 0xa77b, 0xb1e3, 0x86cb, 0xcc47, 0x3b28, 0x4eb2, 0xcf0b,
+    0x24a8, 0x8f75, 0x5852, 0xb837, 0xa143, 0xe335, 0x3302, 0x8849, 0xa2cf, 0x8401, 0x1306, 0xa97d, 0x5138, 0x1da4, 0x625a, 0xcd93,
+    0x2c6e, 0x19fc, 0x84ef, 0xb4c7, 0x40e8, 0x1f94, 0x7b5a, 0x46ae, 0x28b6, 0xa6a3, 0xd3e3, 0x7b42, 0xaf81, 0x3926, 0x5bbe, 0xaa61,
+    0x8c4f, 0x635a, 0x3b5a, 0x5544, 0xba2b, 0x24f6, 0xac3b, 0x51b2, 0x7b86, 0x2b28, 0x97f7, 0x4a6a, 0x6c4a, 0x2268, 0xb6a1, 0x6ebc,
+    0x7fb4, 0xaffd, 0x466a, 0xc183, 0x81c9, 0x1f8c, 0x62f2, 0x4974, 0xad63, 0x4286, 0xd6a7, 0x8f4f, 0x6e34, 0x2d92, 0x4c72, 0x9fdb,
+    0x5cc8, 0x2f38, 0x6fca, 0xdf71, 0x8000, 0x5982, 0x736e, 0x8b65, 0x389a, 0xb4fb, 0x5fbc, 0xd85b, 0xaa6f, 0x3510, 0x6928, 0x8019,
+    0x23b2, 0xa4d1, 0x88f1, 0x6688, 0xa685, 0x289a, 0x7adc, 0xb0ed, 0xcebb, 0xa0e7, 0x4830, 0xa787, 0x5f34, 0xb113, 0xd53f, 0x6dfc,
+    0x5612, 0x17c2, 0xc205, 0x27fa, 0x48dc, 0x9681, 0xbcf3, 0x5464, 0x2a98, 0xbc69, 0x7482, 0x9ad7, 0x433a, 0x22a2, 0xe9b1, 0xcec7,
+    0x4d4e, 0xdc87, 0x716a, 0xcc9d, 0x573c, 0xe68d, 0x68d6, 0x98e5, 0x5ae2, 0xd471, 0x3ad2, 0x9c39, 0xe787, 0x1bee, 0x5992, 0x3d9e,
+    0x6c7c, 0x7fbe, 0xab6d, 0xba37, 0x299c, 0x8ac7, 0xbd77, 0x6436, 0xd6cf, 0x3f8a, 0xc8eb, 0x696c, 0x7802, 0xcd2b, 0x5be2, 0xa7c3,
+    0x98eb, 0x37b2, 0x2078, 0x83d1, 0xe5b5, 0x6c06, 0xcf3d, 0xc1c7, 0x6c6c, 0xcbed, 0x8979, 0x2258, 0x810d, 0x4912, 0x5446, 0x9869,
+    0x4dda, 0xaa51, 0x618c, 0xa0dd, 0x31fc, 0x809d, 0x4968, 0xae87, 0x4d0a, 0xe70d, 0x38e4, 0xcd47, 0x6ed4, 0x93cb, 0x29d8, 0x9455,
+    0x21a6, 0x4e2c, 0x965b, 0xdd4f, 0x4f32, 0xb26f, 0x5a74, 0x3440, 0x2bd6, 0x92d1, 0xcbc7, 0x3bfa, 0x5d44, 0x4210, 0x336e, 0xdec9,
+    0xa487, 0x8c1f, 0xafcd, 0x9673, 0x52be, 0xe385, 0xbd77, 0x6170, 0x832b, 0x3612, 0xdfa3, 0xae07, 0x62ba, 0xe22b, 0x1bba, 0xa419,
+    0x88f7, 0xe05f, 0x220c, 0xa68f, 0x80f7, 0x5a54, 0x1a0a, 0x9b3d, 0xd809, 0x6e32, 0x95fb, 0xd1f3, 0xb81f, 0x6026, 0xd399, 0xb25f,
+    0x2ac4, 0x9dc7, 0x1d08, 0x3cbe, 0xa0e7, 0xc14d, 0x17a0, 0x84df, 0xdc87, 0xb971, 0x534c, 0x7bec, 0x2156, 0xc82f, 0x2af6, 0x5d6e,
+    0x181e, 0x368a, 0x5028, 0x9f6b, 0x2218, 0xc8d1, 0xabd7, 0xcdfb, 0x85f9, 0x6596, 0x44a6, 0xe381, 0x936b, 0x1e8c, 0xba1f, 0xb3d9,
+    0x3906, 0x721c, 0xd8a3, 0x2ade, 0x3b6e, 0x5da4, 0x9819, 0xbb2d, 0x471a, 0xe0a5, 0x7088, 0x6572, 0xc1e1, 0x82cf, 0x4464, 0xbc6b,
+    0x7f92, 0xa10d, 0x5342, 0xc735, 0x58c4, 0xd87f, 0x9b57, 0x370a, 0xde45, 0xc273, 0x1d16, 0x49f2, 0xd025, 0x83df, 0x750c, 0xb135,
+    0x1e32, 0x723a, 0xcf45, 0xa6c3, 0x7a08, 0x916f, 0x3bc4, 0x6542, 0xcf2b, 0x8b9b, 0x19e8, 0xaf35, 0x583e, 0x3498, 0xc7d1, 0x4cd6,
+    0xde65, 0x21be, 0x552c, 0xda31, 0x2a7c, 0x6f4c, 0xb923, 0xd8ab, 0x83fd, 0xc509, 0x5c36, 0xbfbd, 0x4230, 0xd409, 0xba03, 0x7ca6,
+    0xe195, 0x8875, 0x235e, 0xac7d, 0x3d3a, 0xba0b, 0xae1f, 0x4ab2, 0xc69f, 0xa71b, 0x666c, 0x8b01, 0x44b2, 0xadf1, 0xce87, 0x5272,
+    0xd989, 0x7ae8, 0x327a, 0xb231, 0x4cfa, 0x9539, 0xe675, 0x4bd8, 0x1dde, 0x8d15, 0xba25, 0xe239, 0x80d5, 0x3b28, 0x1fa4, 0xa19b,
+    0xbceb, 0x8803, 0x7506, 0x83c5, 0xa5e3, 0xd3d7, 0x841f, 0xd971, 0x6d3a, 0xaeb7, 0x3750, 0x50a0, 0xce05, 0xa53b, 0x76fa, 0x9337,
+    0x310e, 0x9c7f, 0x135e, 0x8ecf, 0xa1f9, 0xb619, 0x8409, 0xc319, 0x4ed2, 0xb961, 0x7cb2, 0x3038, 0xc2e9, 0x5236, 0xb13b, 0x928d,
+    0x3174, 0xe367, 0x68a4, 0xcb6d, 0x3c08, 0x7d00, 0x9195, 0x331a, 0x6cea, 0x2030, 0x90e7, 0x4e0a, 0xa365, 0x27c6, 0x40ae, 0x7210,
+    0x6254, 0xd9a3, 0xc6f7, 0x9ea7, 0x4246, 0xaa7b, 0x278a, 0x4e76, 0x3b64, 0xa7b1, 0x671a, 0xdf63, 0xa205, 0xd0bf, 0x34da, 0xb251,
+    0x7df0, 0xd09d, 0x2eda, 0xbe1f, 0x7184, 0x243e, 0xd09d, 0x6c66, 0x7826, 0xc48b, 0x6000, 0xad1d, 0x503a, 0xcb5d, 0xae0b, 0x5e30,
+    0xe387, 0xbf5f, 0x7956, 0x2b2a, 0x38b6, 0xd427, 0x7146, 0x9a27, 0xc81d, 0x6cb8, 0x831b, 0xaefd, 0xa753, 0xcb1d, 0x947f, 0x718e,
+    0xbea1, 0xdac9, 0x28aa, 0xc447, 0x470a, 0x99b5, 0x40fe, 0x66fe, 0xcb6f, 0x4c70, 0x7b7a, 0x3cf4, 0x9cef, 0x5a0a, 0xc0f3, 0x3296,
+    0x62ca, 0x52fe, 0xc339, 0x359c, 0x9431, 0xe481, 0xb555, 0x57d4, 0x7554, 0x43bc, 0x8105, 0x2990, 0x486a, 0x7590, 0x3896, 0x6758,
+    0x51dc, 0xd3b3, 0xdeab, 0xbb01, 0x7cbc, 0x5f38, 0x33a0, 0x6db0, 0x9b0f, 0x3350, 0xe423, 0x67f6, 0xa97b, 0x9eff, 0x7c5e, 0x9259,
+    0xd11b, 0x6fcc, 0xd0bf, 0xede9, 0x6d94, 0x622c, 0x49f8, 0x14cc, 0x3862, 0xd3e1, 0x2c54, 0x7782, 0x524a, 0x6c86, 0x99b1, 0x67ca,
+    0xe0ad, 0x4e48, 0xc75d, 0x84e9, 0xacc9, 0x6fe6, 0xd4fd, 0x53dc, 0xc211, 0x36a4, 0x9933, 0xd775, 0x3be2, 0xa2e3, 0xdde9, 0x5a5a,
+    0x95c9, 0x66d6, 0xd833, 0x7a18, 0x385c, 0xc52b, 0x6b6c, 0xb2cd, 0x7630, 0x5a54, 0x7e48, 0x67a4, 0xe797, 0x2c08, 0xbb4d, 0x50fc,
+    0xdcb1, 0x33c4, 0x8e27, 0x469a, 0xdc73, 0xcc5d, 0x3172, 0xa817, 0x4a66, 0xbf7d, 0x6a80, 0xaa29, 0xea45, 0x7e60, 0x98eb, 0x2d92,
+    0x8df1, 0x9b63, 0x67da, 0x98c5, 0x3f48, 0xe08d, 0x5c78, 0x9725, 0x140e, 0x7016, 0x28fa, 0xa2d1, 0x6876, 0xdec3, 0x9511, 0x247a,
+    0x3aa8, 0xbd71, 0xd363, 0x54f0, 0x905b, 0x36cc, 0xd6ed, 0x83b9, 0x7a28, 0xe08d, 0x2c32, 0x50d4, 0xbe61, 0x2136, 0x6f36, 0x910d,
+    0xc179, 0x6430, 0xc98f, 0x5a06, 0xda3b, 0x6bba, 0x8797, 0x5dfe, 0xc2a7, 0x6ca4, 0x5540, 0x24a0, 0xca47, 0x966b, 0x4912, 0x7628,
+    0x2aae, 0x3ccc, 0xd8cf, 0xb633, 0x6062, 0x2f32, 0x3eca, 0x9faf, 0x2188, 0xdd03, 0x8041, 0x6a04, 0xbf6f, 0x2a1a, 0x7eb2, 0x405e,
+    0xd38f, 0x82e5, 0x5b32, 0xc56d, 0x340e, 0x20a8, 0xd5ff, 0x4252, 0x7ff2, 0x20a2, 0xa4f7, 0x9011, 0x6ffa, 0xcab1, 0x8c79, 0xd5ef,
+    0x1ed4, 0xc48b, 0x8695, 0x1ce2, 0xa069, 0xe679, 0x4f56, 0xd15b, 0xb1d1, 0x8137, 0xb975, 0x1d24, 0xdba5, 0x8783, 0xc725, 0xe6e7,
+    0x1b6a, 0xb14d, 0x741c, 0x559a, 0x2944, 0x6f44, 0x7bdc, 0x9d8b, 0xda35, 0x4f80, 0xadd1, 0x3066, 0x714a, 0xb7bd, 0x187a, 0xdde7,
+    0x7374, 0x3b36, 0x860d, 0x5704, 0xeaf3, 0xa855, 0x615e, 0x89b9, 0x247c, 0x3b1e, 0x97e1, 0xda27, 0x1354, 0x7e0c, 0xb687, 0x3800,
+    0x6efa, 0x4702, 0xb4cd, 0x82e3, 0x6898, 0xe3d7, 0x264c, 0x52fa, 0xa8a9, 0x4450, 0xe4fd, 0x2eea, 0x7fa6, 0x5cfe, 0xbe49, 0x24c8,
+    0x3eb0, 0x5972, 0x5f6c, 0x7b8e, 0x2f92, 0xa765, 0xb121, 0x2cf8, 0x9f5f, 0x9165, 0xbc4d, 0x2058, 0xcb1d, 0x90dd, 0xb47d, 0x75ba,
+    0xd5db, 0xa469, 0x80dd, 0xb0d7, 0x73bc, 0xce99, 0x4224, 0xa22f, 0x2e1a, 0xe71d, 0xbe13, 0x1870, 0x64de, 0xa8c3, 0xbde3, 0x3f16,
+    0x984b, 0x8c81, 0x5b06, 0x2e28, 0xa99f, 0x8d4b, 0xdebf, 0xb41f, 0x4286, 0x73d0, 0x987d, 0xcb69, 0x37da, 0x5a94, 0xe1eb, 0xa787,
+    0x3a38, 0x82f5, 0x5c2c, 0xb973, 0x3260, 0x9243, 0xdf33, 0xbfaf, 0x9ac9, 0xb493, 0x5b30, 0xc123, 0xaf3d, 0xd8fd, 0x3112, 0x7bda,
+    0x8db1, 0x9d85, 0x359a, 0x659c, 0xb4bd, 0x1e3a, 0x77ee, 0x216c, 0x684c, 0xacf1, 0x52da, 0x95b3, 0x713a, 0x274a, 0x71e0, 0x852b,
+    0x3974, 0xc729, 0x28bc, 0x9285, 0x7f90, 0xa025, 0x17ee, 0xcc9b, 0x4b5c, 0x8fa7, 0xa1eb, 0xb9c5, 0x38a0, 0x8e03, 0x6b82, 0x370e,
+    0x83cf, 0xb16d, 0xb989, 0x2088, 0x50c6, 0x670e, 0x8957, 0xe849, 0x24e0, 0xd8a3, 0x7dec, 0x302a, 0xcf4b, 0x8d89, 0x67f4, 0xbddd,
+    0xd4f1, 0x3be6, 0xb1d1, 0x8139, 0xc4bd, 0xae2f, 0x8535, 0x336a, 0x3e28, 0x9031, 0xb423, 0x5054, 0x7ac6, 0x1b56, 0x59a6, 0xc287,
+    0x455c, 0x6922, 0xa165, 0x788e, 0x6162, 0xc865, 0x283e, 0x4ca6, 0x35cc, 0x2384, 0xcdcf, 0x7c1a, 0xa663, 0xe7fb, 0x8145, 0x23e4,
+    0x3f00, 0xa967, 0x18e8, 0x7b3a, 0xa567, 0x1d38, 0x3626, 0xbeff, 0x99e1, 0x4158, 0xd4fd, 0x3052, 0x8a91, 0x664a, 0xe517, 0xb969,
+    0x7d42, 0x9cd3, 0x44bc, 0x2358, 0xe5bb, 0x6b94, 0x8a6b, 0xca87, 0x492c, 0x5ffe, 0x328a, 0x96a1, 0xe1bf, 0x5758, 0x4c10, 0xbdf9,
+    0x69f6, 0xad57, 0xb74f, 0x4880, 0x71ea, 0x5f0c, 0x9923, 0x2f1a, 0x7206, 0xdf27, 0x5ab8, 0x3cfc, 0x738c, 0x2358, 0x9fa7, 0x64f6,
+    0x510a, 0x9b69, 0x4c02, 0x6192, 0xb533, 0x58e8, 0x21e0, 0xa4ab, 0x4a84, 0xe325, 0x9d13, 0x4720, 0x6f0c, 0xab91, 0x3eee, 0x9a4f,
+    0x7df4, 0x4d96, 0x3436, 0x8bc7, 0xdfbd, 0xd36d, 0xbea5, 0x84ab, 0x1b66, 0x72c0, 0x9137, 0x4372, 0xbc49, 0x800b, 0x5e6c, 0x91c9,
+    0xc191, 0x2204, 0xb61b, 0x6370, 0x937b, 0x3cd4, 0xc611, 0xa559, 0xdff3, 0x7142, 0xb353, 0x8a5b, 0x2cba, 0x6420, 0x523e, 0xc8b3,
+    0x885f, 0xa573, 0xd4bd, 0x1b88, 0x9e4d, 0x8159, 0xbb11, 0x8db1, 0x1b04, 0x60d0, 0xc019, 0x4670, 0x1f1e, 0xd61d, 0x6666, 0x7d6a,
+    0x94ad, 0xab49, 0x3d80, 0xc36d, 0xdb2b, 0x68bc, 0x8383, 0xe0a5, 0x1d9a, 0x55f2, 0xdf55, 0x6ace, 0x2ad6, 0x7c80, 0x4942, 0x5544,
+    0x21da, 0xb989, 0x4290, 0x51fe, 0x1ed4, 0x4ae0, 0x8965, 0x6460, 0xc649, 0xa36f, 0x5bb4, 0xab89, 0xd577, 0xe231, 0x91ef, 0x26de,
+    0xe9bb, 0xb3c3, 0x6bbe, 0x226a, 0xcba3, 0x4cea, 0x2530, 0xcd13, 0x580c, 0xc42d, 0x62ac, 0x1988, 0x7f86, 0xb697, 0x4bde, 0x20c6,
+    0xc3bb, 0xb485, 0x3f0e, 0x1b14, 0xa8bb, 0x8003, 0x4476, 0x6728, 0x298c, 0x7a40, 0x9273, 0x1c92, 0x851d, 0x3880, 0xc827, 0xbec1,
+    0x1312, 0x562a, 0xd3e3, 0x952d, 0x5380, 0xe2a9, 0x9283, 0x9ebd, 0x47fc, 0x82a7, 0x1c9e, 0xbca7, 0x50a6, 0xaf59, 0xd079, 0x1d1c,
+    0xb977, 0x4cda, 0x611c, 0xae73, 0x2ece, 0x4d46, 0x5756, 0x93c1, 0xd749, 0x3c62, 0x2af8, 0xd0f9, 0x47be, 0xa86d, 0xdf39, 0xa241,
+    0x549a, 0xd6b7, 0x6576, 0x761c, 0x9ff3, 0x1ad8, 0xb16f, 0x7c52, 0x4d94, 0x9933, 0x5d56, 0x371e, 0x4e4a, 0x1ad6, 0xa4e3, 0x43f2,
+    0x56fa, 0x6742, 0x1a90, 0x8c23, 0x43c4, 0x1f98, 0x5fdc, 0xd473, 0xc17b, 0x6eaa, 0xeb53, 0xcce5, 0x35d8, 0x9aaf, 0x74aa, 0xac99,
+    0x8355, 0x88a9, 0x215c, 0xe0bb, 0x470e, 0x8ea3, 0xb231, 0x6bb0, 0x95b3, 0xa6d9, 0xbb5b, 0x4182, 0x2ef2, 0x62f6, 0x58c0, 0xa4b1,
+    0xe0f5, 0x9d2d, 0x6c58, 0x457a, 0xcb07, 0xb121, 0x7710, 0xd5f1, 0x2972, 0x81b5, 0xacd7, 0x7690, 0xbad3, 0x1d38, 0x543a, 0xc8d1,
+    0x6232, 0xd235, 0x5af0, 0x8b67, 0x7e60, 0xb95b, 0x1d9e, 0x8515, 0xafb7, 0xc525, 0xcfeb, 0xa1c1, 0x1ce4, 0x7a2c, 0xd1e9, 0xa059,
+    0x2122, 0x4ad8, 0x2e1c, 0x926b, 0xea8b, 0xc38b, 0x5454, 0xd0c3, 0xb493, 0x6846, 0xc8a5, 0xba9f, 0xdc4b, 0x46f8, 0xaf89, 0x36c0,
+    0xb423, 0x82bb, 0xd575, 0x32d0, 0xc925, 0x73de, 0xbb11, 0x64f8, 0x86d7, 0x5794, 0x2d60, 0xcf6d, 0x8beb, 0x3304, 0x5238, 0xb9a3,
+    0x2d52, 0xe095, 0xcb9f, 0xabad, 0x9827, 0x421a, 0x5ae4, 0x3434, 0xd519, 0xc661, 0x5eea, 0xd645, 0x29ce, 0x5092, 0xa6db, 0x329c,
+    0x486e, 0xa131, 0x889d, 0xcf25, 0x1a74, 0x7340, 0x4a08, 0x302c, 0xbc53, 0x1b2e, 0x4380, 0x5c06, 0xbec1, 0x9c67, 0xdea9, 0x2638,
+    0x8ad1, 0x29a6, 0x501c, 0x541e, 0xb64b, 0x369c, 0x4908, 0xdceb, 0x825d, 0xcfeb, 0x9861, 0x9c6b, 0x7654, 0xacbb, 0x375c, 0xe4a3,
+    0x1eb6, 0x83b5, 0xd741, 0xa0c3, 0x1f0a, 0x87c7, 0x4b7a, 0x7b3c, 0xcc5f, 0x445e, 0xb1bb, 0x620a, 0x3c92, 0xc493, 0xd35d, 0x96ed,
+    0x3688, 0x8f43, 0xe371, 0x6d98, 0x9abf, 0xa727, 0xdfe3, 0x1ef2, 0x6b54, 0x30b4, 0x88cd, 0x730e, 0x3982, 0x1efe, 0x7df4, 0x6178,
+    0xc557, 0x4b8c, 0x3b80, 0x9121, 0xbfdb, 0x6504, 0x9b4b, 0x7ef2, 0x2c18, 0xb431, 0x3a74, 0xa58d, 0xe26d, 0x69f2, 0x3bbc, 0x7266,
+    0xa443, 0x6130, 0x9051, 0x7d44, 0xde37, 0x563e, 0xad81, 0x951f, 0xe193, 0x55a4, 0xcb21, 0x409c, 0xb171, 0x4750, 0x5eba, 0x6b56,
+    0x3a86, 0xb397, 0x7770, 0x203a, 0xc88b, 0x5d5e, 0x3516, 0xb887, 0xe60d, 0xd727, 0xa51b, 0x6c34, 0xe7b3, 0x4318, 0x5f8e, 0x8471,
+    0xa845, 0xe1cd, 0x7496, 0xbb67, 0xd107, 0xe8d7, 0x7c92, 0xbcb3, 0x28e4, 0xa831, 0x720e, 0x8413, 0x5560, 0x15fa, 0x74d0, 0xc3f9,
+    0x1c4c, 0x7122, 0x8f41, 0x42c8, 0xe709, 0xc357, 0x638c, 0x9b75, 0x361a, 0xc865, 0xb007, 0x8ca7, 0xde21, 0x9c29, 0x2b3a, 0x7484,
+    0xe12d, 0xac11, 0xcda9, 0xe7cf, 0x55f8, 0xad79, 0x7996, 0xe143, 0xa6c7, 0x57fa, 0x1bec, 0x7a72, 0x549e, 0xc1e7, 0xe2f5, 0x3434,
+    0xd6f3, 0x5f6e, 0xad01, 0x3544, 0xc26b, 0x7f20, 0xa345, 0xe313, 0xc3b1, 0x5cf2, 0x8c13, 0x6b60, 0x9c9b, 0xc213, 0xc6dd, 0x49d8,
+    0x6a1e, 0x344c, 0x8b4b, 0xe8e1, 0x6574, 0x5468, 0x3280, 0xa239, 0x6890, 0xe2e7, 0x4bb0, 0x5dea, 0xa293, 0xd47d, 0x8b3b, 0x28e4,
+    0x6f26, 0xe529, 0xb041, 0x281a, 0x4f72, 0xac7f, 0xd65f, 0x3ac6, 0x5496, 0x7582, 0x2452, 0x3d68, 0x8b51, 0xb1e5, 0x3810, 0x739e,
+    0xe521, 0x8895, 0xd19d, 0x6d30, 0xa8db, 0x8041, 0x1dae, 0x9025, 0x9fef, 0x2634, 0x7e90, 0x3544, 0x88d5, 0x5d3c, 0xe601, 0x2e3c,
+    0x8907, 0xca47, 0x43fc, 0x8e79, 0x874b, 0x3414, 0x9819, 0x1d62, 0xc34b, 0x3b94, 0x722c, 0xbf01, 0x6638, 0xd91b, 0xa795, 0x77a2,
+    0x5efe, 0xa485, 0x66b8, 0x2400, 0x48ae, 0x1c92, 0xa8fd, 0x6a0c, 0x9d8d, 0x23d6, 0x7fe2, 0xa90f, 0x6708, 0xe793, 0xa637, 0xccb5,
+    0x59ec, 0xe651, 0x68ce, 0x485c, 0xad33, 0xc8c1, 0x71b4, 0x8197, 0xd48b, 0x6576, 0x9e85, 0xe835, 0x7eae, 0x3c68, 0xa65f, 0x5bf4,
+    0x6516, 0xc131, 0xeab7, 0x6e5a, 0x91c5, 0xca33, 0x5d0a, 0xa90b, 0x2eb2, 0x6f3a, 0x3c6e, 0x5700, 0xd5c1, 0x8d1b, 0x4418, 0xbe49,
+    0xc9c3, 0x502a, 0x6d08, 0x44c0, 0x582a, 0xca5f, 0x37f2, 0xbd83, 0x97f9, 0x3058, 0x9f33, 0x860b, 0xe3f1, 0xa987, 0x2734, 0x6d96,
+    0xdba1, 0xa977, 0x1c7c, 0xc31b, 0xd50d, 0x35ca, 0x7fca, 0xba15, 0x98b9, 0x4a48, 0xd75b, 0x65f4, 0x9675, 0x4e1a, 0xbe53, 0xa4a7,
+    0x1b8c, 0x684c, 0xd5b3, 0x8697, 0xe679, 0x446e, 0x365e, 0x989f, 0xda15, 0x8eb1, 0x44fa, 0xccb5, 0x96fd, 0x2aee, 0x8a37, 0xd3d3,
+    0xe45b, 0x24da, 0x4e5a, 0xcc45, 0xa289, 0x1982, 0x364e, 0xc403, 0x6252, 0x9dcb, 0x74e4, 0xd989, 0x6b34, 0x975b, 0xedab, 0xa9e1,
+    0x9935, 0xe36b, 0x8081, 0x36e8, 0xa6fd, 0x89db, 0xbd79, 0x6474, 0x7700, 0x3628, 0x5724, 0x2d90, 0xa175, 0xc643, 0x4f46, 0xb0af,
+    0x77a0, 0x3afe, 0x4df2, 0x1f80, 0x8895, 0x437a, 0x2f5c, 0xa9fb, 0x4f80, 0x6920, 0xc70f, 0xe5e9, 0x9115, 0xb7b3, 0x32fa, 0x81fd,
+    0x4720, 0xcabb, 0x2ef0, 0xbccb, 0x8c11, 0x30e0, 0x4888, 0xd231, 0x2b84, 0xde8b, 0x20d4, 0x6fa4, 0xbba7, 0x7428, 0xc1a5, 0x859b,
+    0x988f, 0x2c16, 0x5a74, 0x2ab2, 0x9649, 0x6f8a, 0x375a, 0x2738, 0x7f5a, 0xa797, 0x3de0, 0x9995, 0xd0d9, 0x8bc7, 0x4298, 0x1978,
+    0x9d7f, 0xca55, 0x3e56, 0xa545, 0x6d84, 0x49b8, 0x13bc, 0x2fa0, 0x4344, 0x2c74, 0xcdfb, 0x2352, 0xd857, 0x8e61, 0x2d48, 0x71fc,
+    0xd32d, 0xb52d, 0x4e8a, 0xc231, 0x28d8, 0x9433, 0xd81f, 0x52ae, 0x893d, 0x1bc6, 0xb085, 0xca03, 0x35e6, 0x694e, 0x462c, 0xa5f3,
+    0x0c0a, 0x3766, 0x7fec, 0xc275, 0xd043, 0x7238, 0x2d84, 0x6092, 0x9d69, 0xe58f, 0x7fb0, 0x4ece, 0xca0b, 0x65f6, 0x9e61, 0x5a86,
+    0x93f5, 0x3e0c, 0xaf6d, 0x1a38, 0x4202, 0x3bec, 0xb113, 0x7b5e, 0x4470, 0xcd97, 0x519e, 0x9955, 0x18fe, 0x6e4e, 0x9a93, 0xc16f,
+    0x683e, 0x2528, 0x57ac, 0xab0d, 0xe157, 0x566c, 0xd333, 0x7b12, 0xa93f, 0xdc9d, 0xad25, 0x16ce, 0x7738, 0xa235, 0x1ede, 0x46ce,
+    0xd0b3, 0x7d24, 0x3b3a, 0xb63d, 0x79d0, 0xe715, 0x95fb, 0xc035, 0x5092, 0x3620, 0xbaf3, 0x8d27, 0x1938, 0x3b90, 0x860f, 0x705e,
+    0x22d0, 0xaf5b, 0x358e, 0x8ced, 0x2d7a, 0xa947, 0xe647, 0x3c44, 0x5574, 0xadc9, 0x7b48, 0x2fd4, 0xc9eb, 0x1d60, 0xaf2f, 0xc7ed,
+    0x3ccc, 0x7ac0, 0x9e37, 0x2db4, 0x4066, 0xdebb, 0x1f98, 0x9647, 0x5238, 0xb51f, 0xe09f, 0x1fac, 0xbea7, 0x2d42, 0x6a66, 0xa3ef,
+    0x5e6e, 0x8b5f, 0x3464, 0xb675, 0x9607, 0xd70f, 0x2b98, 0xac9f, 0x5ef4, 0x75ac, 0xc86b, 0x1e20, 0x538a, 0x91c5, 0x46a0, 0xaa91,
+    0x8103, 0x50f8, 0x3b74, 0x730e, 0x87f7, 0x2780, 0x4d06, 0x5d94, 0xd783, 0xad99, 0x2ec2, 0xc25f, 0xd0ed, 0x44e8, 0xe4e9, 0x77cc,
+    0x3500, 0x9ed3, 0xc11f, 0x5578, 0x18b6, 0x8e09, 0xd34d, 0x71ac, 0x50fa, 0xabc9, 0x2000, 0x735e, 0x5254, 0xc02d, 0xaebf, 0x5b52,
+    0x395c, 0x82af, 0xbb07, 0x71f4, 0x3ffc, 0x6496, 0xd195, 0x7b8c, 0x3e12, 0x1672, 0x2d3c, 0xc153, 0x7680, 0x204a, 0x7f5a, 0x2848,
+    0xc993, 0x5548, 0x5b9a, 0xb95b, 0x72aa, 0x3f18, 0x255c, 0x4bc0, 0x9459, 0x23c4, 0xb7b5, 0x8eaf, 0x7eba, 0x76ba, 0x1c9c, 0xdbc3,
+    0x2f20, 0x96bb, 0xaa5f, 0xd585, 0x6272, 0x9a2f, 0x71e6, 0xd3d3, 0x85e9, 0x99a9, 0x2160, 0x3df8, 0x4b94, 0xd30d, 0x9da9, 0x640e,
+    0xe93b, 0xb883, 0x490a, 0xa6b9, 0x5dec, 0x6ab2, 0xaff1, 0x924f, 0x7988, 0xa47d, 0x6286, 0x427a, 0x36a8, 0xe735, 0x58fa, 0x3d2a,
+    0xb143, 0x4b36, 0x7d9c, 0xb737, 0x8aa5, 0xdf69, 0xc8e9, 0x8ac7, 0x4ae4, 0x3398, 0xc02b, 0x6c44, 0x26a4, 0x5de6, 0xafdd, 0x7806,
+    0x651e, 0x49a6, 0x866f, 0x938b, 0x6208, 0xbced, 0xd9ad, 0x7664, 0x8385, 0xc7df, 0x6fa8, 0xa3a1, 0x507e, 0x4170, 0xa689, 0x1ac2,
+    0x8841, 0x5bde, 0x2172, 0x9a6b, 0x7c94, 0xaae7, 0x4260, 0xb4cd, 0xd183, 0x71b2, 0x50e8, 0x95d9, 0x213c, 0x84f9, 0xdebf, 0xc4bf,
+    0x4a72, 0x8847, 0x6626, 0x32b8, 0x41f8, 0x9c87, 0x8703, 0xd6bd, 0xb6b1, 0x3b4e, 0xa2c1, 0x728e, 0xe09f, 0x3922, 0x20dc, 0xc97d,
+    0xbcb9, 0x2e22, 0x7a54, 0xdcd3, 0x5f56, 0xcafb, 0x6d36, 0xe23b, 0x344a, 0x5f5a, 0x7f38, 0xe0a5, 0xccd3, 0xa731, 0x45d0, 0xcfd5,
+    0x524e, 0x9d8f, 0xc4af, 0x1902, 0x61fe, 0xb291, 0x2d92, 0x3cf4, 0x6a3c, 0x52e2, 0x9573, 0x4782, 0x3c44, 0xe381, 0x6afc, 0xbe31,
+    0x9505, 0x1c64, 0x548c, 0xdb31, 0x8889, 0xcbe3, 0x29be, 0x7fbc, 0xdf99, 0x7666, 0xca71, 0x6340, 0xd295, 0xb6f9, 0xc13f, 0x43ac,
+    0x964b, 0xbea1, 0x7802, 0xe237, 0x60de, 0x542e, 0x9b05, 0x1c5e, 0x8beb, 0xc8bd, 0x3d44, 0xb1f3, 0x6ede, 0x8ba5, 0x50f4, 0x8a47,
+    0xd465, 0x4cd2, 0xb2bd, 0xccab, 0x83b3, 0xaf23, 0x7786, 0x6920, 0xc651, 0x2c82, 0x7b8c, 0xaac5, 0x86c3, 0x501a, 0xde1b, 0x764a,
+    0x1f58, 0xc189, 0xe237, 0xafb5, 0x20f8, 0x6e92, 0x7fd6, 0xdd8f, 0x4a58, 0x2788, 0xb51f, 0xd4bd, 0x7714, 0xb8d3, 0x5f84, 0x1fd2,
+    0xcde1, 0x930b, 0xa417, 0x5d2a, 0xbb5f, 0xe687, 0xabbf, 0x3d6a, 0x7636, 0x22a6, 0x7b94, 0xa593, 0x6bc6, 0x2b20, 0x8793, 0x5e5c,
+    0xd8b7, 0x84a9, 0x2ef8, 0xaa33, 0x71b6, 0xc263, 0x6842, 0xb75d, 0x1d92, 0xe493, 0x6702, 0x9ccd, 0x35e6, 0xd6ad, 0x1f1a, 0x9cd1,
+    0x68f2, 0xd785, 0x3210, 0x8fc3, 0xea29, 0xbad5, 0x9cbd, 0x8635, 0xb419, 0xde93, 0x8eb7, 0xa381, 0x5376, 0xaf43, 0x4672, 0x6a82,
+    0x3648, 0xbd5f, 0x2c80, 0x9add, 0xd821, 0xe34b, 0xada1, 0x8461, 0xd775, 0xda3d, 0x74b8, 0xafe5, 0x2b00, 0xd2e7, 0x4798, 0xbd11,
+    0x5ef6, 0xc9b3, 0x4e82, 0x7e5e, 0x2ada, 0xb22b, 0xc571, 0x1cce, 0x4744, 0xdaa1, 0xc09f, 0xa419, 0x2454, 0x6b74, 0xafe7, 0x35b0,
+    0x942f, 0x750a, 0x187a, 0x8595, 0xd927, 0x29b6, 0xcc91, 0x67ac, 0x3f32, 0x560a, 0xce63, 0xa93d, 0x823f, 0x988b, 0x251e, 0xd21f,
+    0x694e, 0xcd97, 0xa731, 0x33ee, 0x4300, 0xa499, 0x196c, 0x54fc, 0xbe33, 0xe383, 0x7e98, 0xa969, 0xdd77, 0x91a9, 0x55b8, 0xaa3d,
+    0xbd49, 0x719e, 0xe2a3, 0x2bc2, 0xce41, 0x3db2, 0x92cf, 0xb2bf, 0xa18d, 0xe9e5, 0x5768, 0x3590, 0x809b, 0xe0b9, 0x76b6, 0x94e9,
+    0xde81, 0xaa55, 0xd3ed, 0x498c, 0xc6d3, 0x76d4, 0x7dfe, 0x27ea, 0x5fe0, 0x9d17, 0x2f0a, 0xe29b, 0xb1c9, 0xc423, 0x5d26, 0x998b,
+    0xda8b, 0xc261, 0xb089, 0xe5ef, 0x8dc5, 0x590a, 0xbf63, 0x2626, 0x4940, 0x842b, 0x21cc, 0xb887, 0x9a1f, 0x821b, 0xd481, 0x6e12,
+    0x49d0, 0x9825, 0x6754, 0xc6a3, 0x9e37, 0x89c3, 0x2e48, 0xc6ed, 0x94c3, 0xadff, 0xb9ff, 0x2be0, 0x6602, 0x5100, 0x7e08, 0x21ce,
+    0xa749, 0x83ad, 0xe8cd, 0x6d98, 0x454a, 0xa657, 0xccd3, 0x9153, 0xe983, 0x26c4, 0xb0b7, 0xcc2f, 0x8caf, 0xb6fb, 0x52cc, 0x338e,
+    0xb095, 0xe811, 0x99d7, 0xa6b7, 0x3766, 0x5b96, 0x3ee4, 0x9257, 0x5caa, 0xa8e7, 0x2ce6, 0x41e8, 0x79da, 0x5376, 0x2db0, 0x64ca,
+    0xd529, 0x1dbe, 0x4c12, 0xcccd, 0x89bb, 0x214e, 0xbfff, 0xd92b, 0x74ac, 0x2d5c, 0xa047, 0x5e36, 0x457a, 0xdd73, 0x3192, 0x6a96,
+    0x2c4c, 0x9d93, 0x16a6, 0x62cc, 0x48a4, 0x29b2, 0xbb73, 0x4290, 0x95ed, 0xd027, 0x46a4, 0x60a8, 0x98e3, 0x3fe4, 0xc8ed, 0x2cb4,
+    0x908f, 0x443c, 0x65b0, 0x77fa, 0x5372, 0x9ded, 0x3f76, 0x64ca, 0x8fe3, 0xe825, 0x4582, 0x68dc, 0x348c, 0x33d0, 0xe07f, 0x82e1,
+    0xc2e3, 0x32ba, 0xd917, 0x267e, 0x49e4, 0x8c37, 0x71fc, 0xc053, 0xa69b, 0xe6bb, 0x51e6, 0x384e, 0x7ed0, 0xb06d, 0x16be, 0xaa23,
+    0xce87, 0x4388, 0x6158, 0x9b57, 0x3cce, 0x24ce, 0xa5a7, 0x82db, 0x3da2, 0x809f, 0xc2ed, 0xd787, 0x8243, 0x6fba, 0x45a0, 0x7846,
+    0x9a87, 0xb55d, 0x1566, 0xa43f, 0x5dde, 0x2770, 0x4bfc, 0x216a, 0xbf2b, 0x67e4, 0x4b28, 0xce09, 0x2ab8, 0xe035, 0xce69, 0xa05f,
+    0x696c, 0xb031, 0x8d0d, 0x1550, 0x4b38, 0x7a06, 0x61cc, 0x1d2e, 0xa01d, 0x42cc, 0x47cc, 0xca05, 0x5284, 0xa761, 0x9069, 0x75ba,
+    0x81e5, 0x294c, 0xbd29, 0x7d1a, 0xdc73, 0x41be, 0x5d1c, 0x879d, 0x790c, 0x39fe, 0x5fcc, 0x91e9, 0x81bd, 0x5b18, 0xd3f1, 0x2220,
+    0xbe87, 0x5a4a, 0x9ac5, 0xd679, 0x463e, 0x8f0f, 0xb7bf, 0x1ece, 0xe139, 0xc521, 0x93c5, 0x2c7e, 0xd0ab, 0x50da, 0x88b7, 0xad45,
+    0x1608, 0x7436, 0xe27f, 0x5e02, 0xbbb3, 0x6b56, 0x708c, 0x963d, 0xd533, 0x6b0a, 0x7f08, 0x4864, 0x3624, 0x26b2, 0xcbeb, 0xdba1,
+    0x19d0, 0x2c0c, 0xb707, 0x7c8c, 0xa469, 0x1e40, 0x4e22, 0x6240, 0x2650, 0x3c4c, 0x8c03, 0xa925, 0xb929, 0x6512, 0xc6a3, 0x50a0,
+    0x2f68, 0x372e, 0x817f, 0x5bf2, 0x1d4c, 0xdcf7, 0x5be2, 0xbee9, 0x7fa8, 0xdd8f, 0x3dd2, 0x67e8, 0x7c9a, 0x427e, 0x2b08, 0x7464,
+    0x3d86, 0x1d1c, 0x5760, 0x9cef, 0x4a30, 0x150e, 0xb0a5, 0x7548, 0xc86f, 0x6f6e, 0xcf1b, 0x5a1e, 0x2794, 0x4e52, 0x9f6d, 0x2772,
+    0x86cf, 0xda99, 0xacb7, 0x3432, 0x2110, 0x75cc, 0xad07, 0x553e, 0x16ae, 0x6bae, 0x42e4, 0x8607, 0xb099, 0x3bf4, 0xe119, 0x612e,
+    0x3386, 0x8627, 0x4148, 0x93ab, 0x834f, 0x35bc, 0x72f8, 0x5972, 0xbddd, 0x8075, 0x34ca, 0x6ca0, 0x616a, 0x2a7a, 0xc9d9, 0x843d,
+    0x45e6, 0x6d52, 0x2d58, 0x4c48, 0xb435, 0x7284, 0xae69, 0x27de, 0x8663, 0xdbc1, 0x1da4, 0x96b7, 0xb237, 0x9ff1, 0xde41, 0x90d7,
+    0x648a, 0x994f, 0x7faa, 0x3f42, 0xb811, 0x473a, 0x78e4, 0x6e0c, 0xac2b, 0x4f36, 0xe257, 0x9c63, 0x7e62, 0xc995, 0xb42d, 0xa42d,
+    0xd175, 0x5e7c, 0x7410, 0xe025, 0x9b69, 0x9b41, 0x607c, 0xe50d, 0x87b1, 0x61a6, 0x9e7d, 0x2de2, 0xe141, 0xb40d, 0x8d57, 0xa419,
+    0x60be, 0xcbb7, 0x8af3, 0x3504, 0xe1c5, 0xd023, 0xad03, 0x1c1c, 0xbe0b, 0xa731, 0x5a68, 0x8f9f, 0xad8b, 0xd0f3, 0x92ef, 0x459e,
+    0x6a70, 0x3808, 0x6974, 0xae99, 0xc7af, 0x1b7c, 0x9557, 0x2d4e, 0x43b6, 0x6b30, 0x90fd, 0xc6f9, 0xe20f, 0xa041, 0x4b58, 0x7256,
+    0x8f1f, 0x1ef4, 0xd881, 0xc123, 0xe1fb, 0x4f4c, 0xd067, 0x34ce, 0xb46b, 0x90d3, 0x2f0a, 0x5218, 0x400e, 0xacbb, 0xe8b9, 0x2ec8,
+    0xc717, 0x55e0, 0x6e10, 0x4c0e, 0x9b61, 0x84d3, 0xd723, 0x71a4, 0x35e6, 0xa45b, 0x7c80, 0x6f76, 0x3292, 0x6160, 0x8587, 0x58ce,
+    0xd395, 0x815b, 0xe4fd, 0x5ca4, 0xb6c9, 0x9151, 0x35fe, 0xbfb9, 0xbbcb, 0x798e, 0x3458, 0xe279, 0x1764, 0x61c8, 0x41fe, 0xe2bd,
+    0x3974, 0xa7f5, 0x7012, 0x8e0d, 0x5236, 0xa42d, 0xbdc5, 0x3072, 0xe937, 0xb04d, 0x72d0, 0x34fe, 0xe397, 0xc32b, 0x78ec, 0x4994,
+    0xe0e5, 0x2bc6, 0x6c2e, 0xc731, 0x3202, 0x517a, 0x67fa, 0x97c3, 0x3576, 0x76f0, 0x59d6, 0x1bd0, 0xb621, 0x3c38, 0x7c7c, 0xbc9d,
+    0x439e, 0x83cf, 0x3058, 0x89a9, 0x2674, 0xdf27, 0xb457, 0x350a, 0x4078, 0x97ab, 0x1f4a, 0xc1df, 0xb0d3, 0x6c48, 0x832f, 0x3f22,
+    0x8869, 0x5ce4, 0xc73b, 0x427a, 0x6baa, 0xded1, 0x8f3f, 0xd161, 0xb8b7, 0x1a9a, 0x728c, 0xcbbd, 0x2d48, 0x1dce, 0x9cbd, 0x4732,
+    0xc1f1, 0x73ec, 0xaf13, 0xbc95, 0x8c15, 0x3670, 0xa12d, 0x4704, 0x1d46, 0xbf4b, 0xa7ad, 0x88f9, 0xcfe7, 0x1ca6, 0xb4df, 0xa65b,
+    0xcc8b, 0x84eb, 0x2898, 0x7d9a, 0xcef7, 0x7260, 0xe8db, 0x3dd8, 0x508c, 0xa2e3, 0x82e3, 0x3494, 0xaeb7, 0xed6d, 0x7e02, 0xaf45,
+    0x5912, 0x2302, 0x79d6, 0x4f66, 0x9843, 0xe865, 0x4b22, 0xa3cd, 0x8151, 0xd0e9, 0xe543, 0x4cbc, 0x7608, 0xc6ad, 0x98cd, 0xbd69,
+    0xd793, 0x5afc, 0xc0bf, 0x2a7c, 0xbb57, 0xde2f, 0x9601, 0x174a, 0x3ad2, 0xa259, 0xd70d, 0x48c6, 0xe5af, 0xa32f, 0x783c, 0xa2a3,
+    0xda6d, 0x653a, 0xc945, 0x8969, 0x1fc2, 0xde43, 0xa915, 0xca9b, 0x3c20, 0xbe8f, 0x62e6, 0xe713, 0x82d3, 0x24bc, 0x38e0, 0xcbbf,
+    0xb66d, 0x327a, 0xabc9, 0x687c, 0xdb0b, 0x98e7, 0x3ad0, 0xc1f3, 0x435a, 0x81a1, 0x2a7a, 0xc7af, 0x19fc, 0x5e60, 0x3698, 0x4e04,
+    0x91bb, 0xbe53, 0x851b, 0x418a, 0xd0eb, 0x7038, 0xb943, 0x33fe, 0x198e, 0xa929, 0xcd41, 0x6eb2, 0x4f6e, 0x1412, 0x6588, 0x46be,
+    0xe611, 0x74f2, 0xb70b, 0x1928, 0x4c04, 0x8e2f, 0x5eb0, 0xcb2f, 0x3782, 0x728a, 0xb0a9, 0x221a, 0x7c56, 0x5318, 0x9ff3, 0xae17,
+    0x5cb4, 0xd5c1, 0x9a95, 0x7d1a, 0x7ede, 0x5716, 0xd8b9, 0x878d, 0xcf09, 0xac7d, 0x59be, 0x238e, 0x4222, 0x5e70, 0xc455, 0xe27b,
+    0x4100, 0x78bc, 0x5916, 0x8749, 0x67bc, 0x799a, 0x99d1, 0x529a, 0xe179, 0x7364, 0x9f1d, 0x19ea, 0xaf9d, 0x958f, 0xc519, 0x5c1a,
+    0x3e00, 0x8ac3, 0xc2b1, 0xdfc9, 0x6d22, 0xc8f5, 0x4956, 0xba87, 0x5cf8, 0xe80d, 0x1e56, 0xb46d, 0x9897, 0xa74b, 0x177a, 0xaff7,
+    0x25d4, 0x2f58, 0x485a, 0x8795, 0xc9b1, 0x41c4, 0xdeab, 0x5938, 0x5b10, 0x917d, 0x63ca, 0xa109, 0x86ad, 0xce9d, 0xb6c9, 0x8173,
+    0xa099, 0x59c4, 0xd441, 0x18a2, 0x301c, 0x85af, 0xd427, 0x623c, 0xa423, 0x5518, 0xcb7f, 0xb605, 0x43ea, 0x19b2, 0x9263, 0x8cb3,
+    0xa8e7, 0x3e5e, 0xb685, 0x8b41, 0x71ba, 0xaea9, 0xd497, 0x86f7, 0x4314, 0xb2ad, 0x8af7, 0xdbed, 0xa2c3, 0x7256, 0xde73, 0x5a86,
+    0x9dfd, 0xdb73, 0xb15f, 0x52ea, 0x77ec, 0x88c3, 0x4f1e, 0xc427, 0x8103, 0x29a8, 0x57b4, 0xdd43, 0x92cd, 0x509c, 0xbe45, 0x5f3a,
+    0xa58b, 0xdff3, 0x4faa, 0x760a, 0x995b, 0x3296, 0xaa81, 0x49c2, 0x7f46, 0xdd07, 0x9911, 0x504a, 0x82b7, 0xd047, 0x7f04, 0x91fb,
+    0xeacb, 0x8927, 0x2cc8, 0x51ea, 0x9695, 0x6dc2, 0xdd1d, 0xb2a3, 0x8b95, 0x73da, 0x4bee, 0x26ae, 0x5e9e, 0x8b5f, 0xee21, 0x6474,
+    0x7016, 0xe0a7, 0xb57f, 0xc5e3, 0x3b6c, 0xb457, 0x90c3, 0x8f1f, 0x2eec, 0xc549, 0xe0ab, 0x4754, 0x876f, 0xc7cb, 0x5c92, 0x40e4,
+    0xcd19, 0xdf63, 0x6d1a, 0xc17d, 0xd1d9, 0x666a, 0x3a26, 0xd811, 0x93ff, 0x2f48, 0x5dfa, 0x9625, 0x2946, 0x9d07, 0x18f0, 0x7202,
+    0x47ba, 0x9f4d, 0x6fbc, 0xd325, 0x58da, 0x4dc8, 0xace7, 0xc8a5, 0x6302, 0x77f4, 0xc59d, 0x562e, 0x9701, 0x16d8, 0x346c, 0xbead,
+    0x578c, 0x1d54, 0xaeb7, 0x79e4, 0xce25, 0x80c5, 0x49b0, 0x5ed6, 0x6ca2, 0x8611, 0x3f54, 0x6ea2, 0x4c30, 0xbea7, 0x6fa2, 0x4a74,
+    0x7614, 0x598e, 0xde9d, 0x2abe, 0x8f5d, 0x1aa2, 0xe06f, 0x620a, 0xa2ef, 0xc559, 0x72e6, 0x5640, 0xaca7, 0x9879, 0x7d5c, 0xe6f3,
+    0x20e8, 0x6428, 0x3198, 0xbfb7, 0x475e, 0x16e8, 0xb3e9, 0x7d4c, 0x46d6, 0x6d9a, 0xd79d, 0x3d4c, 0xb919, 0x8fbf, 0xd797, 0x3464,
+    0x79d8, 0x2230, 0x9d8b, 0xa581, 0xd1e9, 0x7332, 0x26ac, 0x9453, 0x52c8, 0x8173, 0x3538, 0xdadd, 0xd0ad, 0x5e36, 0x26da, 0x231a,
+    0x929f, 0xbe93, 0x200a, 0xdcab, 0x4626, 0xb003, 0x64fc, 0x363c, 0x6e6a, 0x1c04, 0xb9c5, 0x86e9, 0xd0cb, 0x32ee, 0x7480, 0x29b4,
+    0x9ead, 0xd1f9, 0xbe41, 0x33ac, 0x1f96, 0x9df5, 0xcb87, 0x18a8, 0x60be, 0x463e, 0xd213, 0xdcbf, 0x53f2, 0x6e12, 0x2648, 0x95fd,
+    0xb3e7, 0xd7b7, 0x24da, 0x3764, 0x8d97, 0x214c, 0xaab7, 0x9cfd, 0x903f, 0xcc3d, 0x4118, 0x7950, 0xca4b, 0xe73b, 0x475a, 0x849d,
+    0x99d5, 0x6cd4, 0xc1cd, 0xa273, 0x2222, 0x5e90, 0x8af1, 0xa0a9, 0x27ee, 0xdbfb, 0x2f98, 0xbe05, 0xa929, 0x2ade, 0x4d3a, 0x1bb4,
+    0xc88b, 0x4312, 0x87d9, 0xc163, 0xdf8b, 0x7242, 0x4624, 0x1af4, 0x8951, 0x3d98, 0x2416, 0x84f5, 0x5e64, 0xa3dd, 0x3926, 0xccc3,
+    0x5f30, 0x7c60, 0xdb87, 0x130e, 0x4d06, 0xe109, 0x3610, 0xb515, 0x26f0, 0xd787, 0x5832, 0x37a6, 0x6250, 0xbef5, 0x23f4, 0x2d5e,
+    0xc4d5, 0x3d56, 0x6546, 0xa875, 0xd143, 0x32a4, 0xa38f, 0x7046, 0xe985, 0x9a83, 0xcdc9, 0x6b94, 0x978b, 0x3556, 0xd115, 0x2470,
+    0xab09, 0x8ba5, 0x24f8, 0xc3b1, 0xb7c7, 0x5c92, 0xc90d, 0x3584, 0x6452, 0xae27, 0x5c32, 0xb4af, 0x625c, 0x42f0, 0xac53, 0x53d0,
+    0x1ecc, 0x6722, 0xcd7f, 0xde6b, 0x4684, 0xc4a7, 0x77a6, 0x5850, 0x379a, 0xe227, 0x9fbd, 0xcbf9, 0xc187, 0x3cbe, 0x9935, 0x4c8a,
+    0x3104, 0x8fb5, 0x4656, 0x53b8, 0x5ffa, 0x1f34, 0x9ec3, 0x66b4, 0xa845, 0x230a, 0x7306, 0x92d3, 0x1828, 0x6702, 0x3226, 0x8e0f,
+    0xa589, 0x3088, 0x3dfc, 0x8c39, 0x17f2, 0xaaa3, 0x7866, 0x25ba, 0xb4fb, 0x6772, 0xbbe1, 0x8853, 0xd3df, 0x4f92, 0x5bea, 0xcd6f,
+    0x8751, 0x2d3c, 0x7204, 0xb38b, 0x3a3c, 0x7b5c, 0x2e9c, 0xd449, 0x4f3c, 0x232c, 0x8c35, 0x2c1e, 0xb21d, 0x7d00, 0x4c82, 0xd3e1,
+    0x2c6e, 0x796a, 0xa35d, 0x54be, 0x3b6c, 0x2a7c, 0x93f5, 0xc521, 0x1d1c, 0xa637, 0xb5f3, 0xc9ff, 0x1804, 0xdf09, 0xa919, 0x8e3f,
+    0x2156, 0xcb31, 0x464e, 0x73ac, 0xade3, 0x4f60, 0x74f2, 0x882b, 0x200c, 0xda3f, 0x6a7a, 0x3e82, 0xe143, 0x3022, 0x6ace, 0xcd0d,
+    0x4350, 0x9b43, 0xb303, 0x8815, 0x9fed, 0x60e6, 0xde73, 0x7d46, 0xca1d, 0x93fb, 0x283a, 0x9bb1, 0x7e0e, 0x63b6, 0xa319, 0xc3dd,
+    0xb45b, 0x4f06, 0xdadd, 0x65c4, 0x2ff0, 0x80b7, 0xbc6d, 0x46e2, 0xd84b, 0xad21, 0xc1cd, 0x4cf6, 0x9a8d, 0x3e68, 0xc369, 0xe841,
+    0x7d68, 0x8827, 0x2c9c, 0x544c, 0x9aa3, 0x29ec, 0xa811, 0xe4a7, 0x5256, 0x9909, 0xe09b, 0x6d80, 0x9b1f, 0xa897, 0x9235, 0xaeed,
+    0x57ba, 0x2d98, 0x77ae, 0xa9cb, 0xd0ff, 0x4794, 0xbb31, 0x78a0, 0xad05, 0x351a, 0x862b, 0x988d, 0x6362, 0x360a, 0xdd87, 0x4e60,
+    0x68b8, 0x5488, 0x78ba, 0xa341, 0xc97d, 0x6c00, 0x4e98, 0x2a76, 0x6602, 0x25bc, 0xa37f, 0x5768, 0x2d0c, 0x6232, 0x3ede, 0xc6e7,
+    0xd613, 0x5b02, 0xdd63, 0x327c, 0x6c6e, 0xa261, 0xd3f3, 0x4b10, 0xae41, 0xd307, 0x76a2, 0x5538, 0x494a, 0x703c, 0xde1d, 0x656c,
+    0x96eb, 0x7108, 0x2a42, 0xa613, 0x6270, 0xa09b, 0xb493, 0x7d10, 0xcdab, 0xdc33, 0x67ca, 0xa38d, 0xde53, 0x840b, 0x637c, 0xb9f9,
+    0x2154, 0x4d9e, 0xa3b3, 0x271a, 0xbc95, 0x629a, 0x87a7, 0x6ef8, 0x9397, 0x782a, 0xc1e7, 0xa6e5, 0x4568, 0x83a3, 0xb117, 0x8cd7,
+    0x6670, 0x7a6e, 0x1920, 0xc029, 0x44d8, 0x9957, 0x5e7e, 0x1648, 0x5544, 0xab5f, 0x76da, 0x1270, 0x3efa, 0xe4a3, 0x7e96, 0x42ba,
+    0x6c6e, 0xd0e5, 0x3728, 0x921f, 0x198e, 0x6d2e, 0xe159, 0x9211, 0x21d6, 0xc355, 0x3244, 0xe235, 0x2780, 0xbf8d, 0xdb9f, 0x36c2,
+    0xb345, 0x9df9, 0x2888, 0x5e3a, 0x76d4, 0x2c84, 0x19e4, 0xbcfd, 0x60be, 0x27dc, 0x7d50, 0x450e, 0xaae9, 0x722e, 0x23a2, 0x7d4e,
+    0xbd33, 0x1d08, 0xa247, 0x8daf, 0xe2a3, 0x7c98, 0x4cca, 0xdae1, 0x472a, 0x7b98, 0xbc11, 0x5866, 0xcc0b, 0xab65, 0xdc71, 0x52fe,
+    0x826f, 0xb631, 0x7744, 0xa8c3, 0x2b44, 0x8677, 0xcd11, 0x6a3a, 0x4e4a, 0xa985, 0x1d76, 0x3c0e, 0xe167, 0x6bd4, 0xa8df, 0x4280,
+    0x9b4b, 0xb9f7, 0x1b1c, 0x91d3, 0x6512, 0xe2d7, 0x7094, 0x9b81, 0xaac3, 0xe31f, 0xbbbf, 0x6c68, 0xdf49, 0xc8e3, 0x6842, 0x97db,
+    0xae63, 0x4704, 0xcc07, 0xe7b7, 0xb57f, 0x689e, 0xae3b, 0xe9c3, 0x55e4, 0xd3ff, 0x355e, 0x998b, 0x5324, 0x8c9b, 0x3f3e, 0x5d7c,
+    0xbe3f, 0xa18d, 0x8831, 0xc13f, 0x6858, 0xcfbd, 0xbd89, 0x81d1, 0x293e, 0x9f3d, 0x94e3, 0x3360, 0xc815, 0xb777, 0x4d9c, 0x8bcd,
+    0xd91b, 0x5bc8, 0x5758, 0xe05b, 0x2d08, 0x83c3, 0x5766, 0x9399, 0x46d4, 0xaddb, 0x57d8, 0xe465, 0x44de, 0xcbd5, 0x2252, 0x54a2,
+    0x9795, 0x7c3e, 0x41fc, 0xbf8d, 0x5494, 0xad9d, 0xed63, 0x6152, 0x7a54, 0x1f08, 0x6be8, 0x5540, 0x8bf1, 0x7222, 0xdbf3, 0x6db4,
+    0x4478, 0xabb1, 0x642c, 0xc051, 0x95a7, 0xcce1, 0x6ecc, 0x8e9f, 0xba5d, 0x419a, 0x796c, 0x1ee4, 0x4716, 0x5392, 0xc853, 0x6eca,
+    0x4526, 0x9887, 0xe6ab, 0x6466, 0x4ec6, 0x7cfc, 0x27a4, 0xd91f, 0x904b, 0x2e58, 0xbdf1, 0x2594, 0xbb63, 0x8aeb, 0xd5f3, 0xa04b,
+    0x84a7, 0x2cf0, 0xb91d, 0x4a48, 0x59a4, 0x8e89, 0xe02b, 0x80ff, 0xd7b5, 0x47ea, 0x8eeb, 0xdb11, 0xa219, 0x7018, 0xaccf, 0x8df5,
+    0x2d6a, 0x5ebe, 0x8cbf, 0xa95b, 0x5644, 0xbd85, 0x1954, 0x69ae, 0x3a08, 0x875d, 0x9dcd, 0x43f0, 0xd455, 0x9427, 0x8cd1, 0xc091,
+    0x3af6, 0xb9db, 0xcefd, 0x4e56, 0x3aba, 0xc48f, 0x2ffc, 0x57d6, 0xaba1, 0x93b7, 0x1b46, 0xba7f, 0x56b6, 0xcc65, 0x2a78, 0x9b05,
+    0xe5bf, 0x7458, 0xcf5b, 0x97fd, 0xb0fd, 0x7b68, 0x3834, 0xccc3, 0x4a22, 0x821d, 0x18f4, 0xd467, 0x7822, 0x297e, 0xdc5d, 0x5202,
+    0xa717, 0xed31, 0xb7d7, 0x5ab4, 0x759a, 0xe4a5, 0xb9ab, 0x8c49, 0xbf7f, 0x3b72, 0x4c3a, 0xb597, 0x8aab, 0xb305, 0x5f6c, 0x902b,
+    0x2048, 0xb2c3, 0x6940, 0xe963, 0x821f, 0x5046, 0x3d36, 0xa219, 0x83bd, 0x568c, 0x3d98, 0x916b, 0x7a4c, 0x9481, 0x4ebc, 0x6ee6,
+    0x83fb, 0x5126, 0xbb0b, 0xac47, 0x8e5b, 0xb94d, 0x9ae1, 0x8eb7, 0xa751, 0xd51d, 0xb8b3, 0x2ef2, 0x67a6, 0xdd6f, 0xd707, 0xb4ad,
+    0x620a, 0xe089, 0x734a, 0x3e16, 0xa0f9, 0xbf7d, 0x316a, 0xd18b, 0x92ab, 0x6584, 0xe8ef, 0x357a, 0x8b43, 0x2842, 0xb98f, 0x7430,
+    0x1b94, 0x5de8, 0xce6d, 0xe383, 0x4a2c, 0x5c5e, 0xd769, 0x96ab, 0x377c, 0xe67d, 0x7676, 0x9241, 0xb443, 0x30c8, 0x8445, 0xe3fd,
+    0x5ca2, 0x4c30, 0xdbb1, 0xd2e9, 0x9edd, 0x2798, 0x85db, 0x2f12, 0x4352, 0x7e26, 0x5644, 0x345c, 0x444a, 0x23ae, 0x9d2b, 0xeb03,
+    0x7124, 0x32e6, 0x8c43, 0x6186, 0x1cce, 0x81c1, 0x420e, 0x2d10, 0x6dc0, 0x8e23, 0x46f8, 0x78ae, 0x2b48, 0xda67, 0xae9f, 0x262c,
+    0xe8f1, 0x68f4, 0x495c, 0x23d0, 0x9d15, 0x37dc, 0x4240, 0xdf3b, 0x62c4, 0x501a, 0xcf43, 0x830b, 0x6078, 0x89f3, 0x20fc, 0x9fff,
+    0xb117, 0x16d6, 0x8f7d, 0x7656, 0xcc35, 0x3e54, 0xb759, 0x3454, 0xccc9, 0x23ca, 0x7fda, 0x6876, 0x2e38, 0xb051, 0x68fa, 0x3ac4,
+    0xd06d, 0x1bdc, 0x686a, 0xcc13, 0x888f, 0x189c, 0x9c6b, 0x3d5e, 0xb1b7, 0x9211, 0xe379, 0x3ace, 0xaf9f, 0x139a, 0xa4e5, 0x53e4,
+    0x25e2, 0xce9f, 0xdab3, 0x7434, 0x2d96, 0x49ee, 0x7716, 0x22e2, 0x58be, 0xc85f, 0x6370, 0xb629, 0xe6fb, 0x3726, 0x1c66, 0xdc89,
+    0xbbbb, 0x7ed6, 0x2432, 0x89e7, 0xb5f9, 0x7202, 0x539e, 0x9c5f, 0xab97, 0xe47d, 0x7b74, 0x5cce, 0xa7d3, 0x3ffc, 0x6c3e, 0x1f52,
+    0xd855, 0xae3d, 0x9b75, 0xd377, 0x1a7e, 0xaf47, 0x43be, 0x9b5b, 0xb5b5, 0x5cae, 0xb7c9, 0x26f6, 0xcb23, 0x39d0, 0x75a6, 0x2682,
+    0xc74b, 0xa21d, 0x314e, 0x4528, 0xe6d5, 0x9351, 0x58ec, 0xd205, 0x92f5, 0x4c38, 0x2086, 0xe487, 0xb6b7, 0x2f52, 0x22de, 0xa3a3,
+    0x5c5c, 0xda87, 0x6ce4, 0x803d, 0x8ef1, 0x1e1a, 0x724e, 0xe00d, 0x404a, 0x5880, 0x2c84, 0x7886, 0xa14d, 0x3962, 0x5300, 0xc4cf,
+    0x4960, 0x8877, 0x359e, 0x62c6, 0x4926, 0xc483, 0x1ed6, 0xa495, 0xe817, 0x52d4, 0x29ae, 0xb86d, 0x92bf, 0x5ca0, 0xca65, 0x71ca,
+    0x3e08, 0x8cb5, 0x25f8, 0x4820, 0x9055, 0x362a, 0x2410, 0xd35b, 0x7a20, 0xa0c7, 0xdb79, 0x6d1e, 0xc581, 0x2700, 0xa0ab, 0xc939,
+    0xda07, 0x5648, 0x9c67, 0x4f16, 0xa9fd, 0xcfc5, 0x2584, 0xb72d, 0xdf63, 0xbd8f, 0x74d6, 0xd08f, 0xa489, 0x5d70, 0x1b76, 0xc571,
+    0x9ead, 0xe20f, 0x3e94, 0x64a2, 0x594a, 0xcea3, 0x4e8e, 0xdbb3, 0x3f38, 0x5398, 0x74d6, 0x948d, 0x535c, 0x2ad0, 0x87ff, 0x48ba,
+    0xa2dd, 0x6c8e, 0x29ec, 0xcadf, 0xae9d, 0x27d6, 0x51be, 0x72b0, 0xa9bb, 0x27a4, 0xc2c1, 0x487a, 0x7462, 0x5ab4, 0xd56d, 0x4b78,
+    0xe485, 0x9303, 0x3bb4, 0x6796, 0x9915, 0xb32b, 0x2afa, 0x42aa, 0x8401, 0xa8c7, 0xc835, 0x531e, 0x47b8, 0x881d, 0xc651, 0x28e4,
+    0xb789, 0x6e6c, 0x8065, 0x37aa, 0x500a, 0xb569, 0xc9e3, 0x5db4, 0xc94d, 0x1f16, 0xa615, 0xc629, 0x89e7, 0xa3eb, 0x5ee4, 0x3ba6,
+    0x7da4, 0xcb17, 0x270e, 0xa5ad, 0x7082, 0xc6ad, 0x9ff9, 0xca9b, 0xb5e5, 0x62be, 0xde23, 0xb08f, 0x68a8, 0xc93d, 0x7546, 0x4ef4,
+    0x8311, 0x3278, 0xd785, 0xb7bb, 0x8b6b, 0x8ffb, 0x2052, 0xb013, 0xcb59, 0xb091, 0x1ccc, 0xa8f5, 0x6b9a, 0x4d8c, 0xd6fd, 0x36f2,
+    0x76e0, 0x3c44, 0xb621, 0x46ca, 0xa4bd, 0x7dba, 0x70bc, 0xa557, 0x6518, 0xbd05, 0x7bdc, 0xa6d7, 0xc5ad, 0x8fab, 0x4f6c, 0xe4bf,
+    0xaf5d, 0x7576, 0xb60b, 0x2f64, 0x94d1, 0x4284, 0x72da, 0xc0ab, 0x5006, 0x2834, 0xa34b, 0x8625, 0xcb7d, 0x2d2e, 0x9709, 0xb745,
+    0x43e4, 0x9a87, 0x1c90, 0x7dc2, 0xb195, 0xe3f1, 0xc657, 0x1df0, 0xadfb, 0x9237, 0x2c92, 0xa6ad, 0x9051, 0xbfb5, 0x7058, 0x8e5b,
+    0x3f2a, 0x5534, 0xc423, 0x3da8, 0xc605, 0xe191, 0x2f9c, 0x4f72, 0x3f72, 0x639a, 0x4cd6, 0xcf1d, 0xb44d, 0x2e6e, 0x57e8, 0xc265,
+    0x420a, 0x5aee, 0x36a4, 0xe791, 0x717c, 0x59a0, 0xc98d, 0x2644, 0xbf8d, 0x3438, 0x850d, 0x8e01, 0x5314, 0xbea9, 0x61d6, 0xe197,
+    0x4ec6, 0xb49b, 0x764a, 0xc54d, 0x7068, 0x2804, 0x7a2c, 0xbebd, 0x325a, 0x6ad4, 0xbe33, 0x62c0, 0x7f26, 0x6d58, 0xc35f, 0x4c7c,
+    0x75da, 0x1be8, 0x2d9e, 0xa35d, 0xedbb, 0xb4a9, 0x6764, 0x9ca1, 0xcfd1, 0x4dca, 0xb2e7, 0xe9bf, 0x93d1, 0x1582, 0x82e7, 0xb2a1,
+    0x73c6, 0xb229, 0x33c4, 0xe135, 0x851d, 0x7280, 0xb3a5, 0x5838, 0x868f, 0xb865, 0x6526, 0xe1ed, 0x4148, 0xb1e7, 0x1ffe, 0x9cdd,
+    0x2e7c, 0xd2b7, 0x7072, 0xac21, 0xd59d, 0x8383, 0x5c44, 0x48b8, 0x949f, 0x2226, 0x2f8a, 0x8c29, 0x58fe, 0x6a8a, 0x34aa, 0x40dc,
+    0x7d1a, 0x2aa0, 0x77c2, 0xb78d, 0x3446, 0x917b, 0x67a4, 0x7644, 0x59c4, 0x18e6, 0x9805, 0x3766, 0x2a58, 0xb52d, 0xde61, 0x42fe,
+    0x2c88, 0x7cd6, 0x8995, 0x19f0, 0xd60d, 0x39c8, 0x6608, 0x639c, 0x8a89, 0xc3f3, 0x1e8a, 0xe319, 0xab29, 0xc205, 0x42ba, 0x6f92,
+    0xd651, 0xb6a7, 0x51ea, 0x7fbc, 0x611e, 0xbec9, 0x899d, 0x3d12, 0xd7c1, 0x18f2, 0x9aaf, 0x8c53, 0xb25f, 0x3928, 0xa15b, 0x6b7a,
+    0xc1b9, 0x25fe, 0xac8f, 0x7bf2, 0x1ee2, 0x78b0, 0xc131, 0xdd9f, 0x629e, 0x2cd2, 0x7488, 0x19be, 0xba11, 0x66f2, 0x2a60, 0x9dcf,
+    0x9ad9, 0x5a40, 0x2f96, 0xaa4f, 0x74c0, 0x48be, 0xd747, 0x8195, 0xb301, 0x6674, 0xe74b, 0x9aa5, 0x727a, 0x3788, 0xd4b3, 0x1a8c,
+    0xbcb3, 0x9daf, 0x4f1c, 0xdd4b, 0x3cec, 0xd723, 0x4f28, 0x1672, 0x8057, 0x3622, 0x2b04, 0xbb43, 0x4a12, 0x94bd, 0x3362, 0xa0ad,
+    0xc88d, 0xa5d9, 0x3f08, 0x5b44, 0xd195, 0x6c9e, 0x4db0, 0x7932, 0x8499, 0x3902, 0x5488, 0xe3a7, 0x2baa, 0xc8bd, 0xa08d, 0x6798,
+    0xc36f, 0xd797, 0x632e, 0x2a78, 0xc385, 0x1b7c, 0xe165, 0x8373, 0x86ed, 0x47aa, 0xdf93, 0x51f8, 0x1486, 0x82a1, 0xbde3, 0x9a53,
+    0x5d8a, 0x46a6, 0xd9b7, 0x5afe, 0xe43d, 0x7d2e, 0xd137, 0x3360, 0x8901, 0xd275, 0x5c1c, 0xb90b, 0x532a, 0x614e, 0xe5fd, 0x8355,
+    0xcd75, 0x928b, 0x657a, 0x4eca, 0x3fe6, 0x9867, 0x5f44, 0x9e05, 0xe61b, 0x740a, 0x3d5a, 0xd805, 0x5b04, 0x7ade, 0x9e79, 0x29f2,
+    0xa8bb, 0xd551, 0x7dda, 0x9b71, 0x2664, 0x8225, 0xab03, 0xd835, 0xb7f3, 0x1b86, 0x8cc9, 0x3a74, 0x8165, 0xe509, 0x94dd, 0xbe17,
+    0x77a2, 0x51a4, 0x8963, 0x6cf0, 0x278a, 0x9181, 0x89ef, 0x62f8, 0x46bc, 0x6e88, 0xebdf, 0x688a, 0x3ea8, 0xba35, 0x8581, 0xa7eb,
+    0x6a6c, 0x5422, 0x185e, 0x867d, 0xd7dd, 0xa559, 0x49e0, 0xe4bd, 0xa5b1, 0xd917, 0x928b, 0x24ea, 0x9e25, 0xb719, 0x5a44, 0xe2bf,
+    0xa57b, 0x8bd9, 0xc481, 0x58a0, 0x42ac, 0xbd67, 0x5064, 0x252c, 0x8655, 0xbca5, 0x7f24, 0x576c, 0xc74b, 0x6a60, 0xda07, 0x9deb,
+    0x2158, 0x4daa, 0xd507, 0xa9d5, 0x52e0, 0x29ec, 0xda99, 0x3690, 0xa699, 0x2384, 0x70ce, 0xa547, 0x6534, 0x5448, 0x80c9, 0xe209,
+    0x5f52, 0xba31, 0x96bb, 0x1ff0, 0xdddf, 0xa48b, 0x56e6, 0xafb5, 0xd3b3, 0x5d54, 0x7b8e, 0xad13, 0xd611, 0xa1b3, 0xe185, 0x8ed5,
+    0x666c, 0xca89, 0x9b9f, 0x20aa, 0x5908, 0xe71b, 0xce4b, 0x43ba, 0x2706, 0xaacb, 0xee1b, 0x4d32, 0x6c78, 0xc3cf, 0x8fd1, 0x65d6,
+    0xabaf, 0xcdb3, 0x6458, 0xc195, 0xb68d, 0x9119, 0x2458, 0xba93, 0x2baa, 0x6cf2, 0xa5e3, 0x4f86, 0x82fd, 0x62e2, 0xb69d, 0x1980,
+    0x33f0, 0x8771, 0xdb7d, 0x442c, 0x1840, 0xec05, 0xa3ed, 0x53bc, 0xbc77, 0x75ee, 0x5db6, 0xd11f, 0xdf93, 0x203c, 0xc097, 0x35c4,
+    0x8895, 0x53a6, 0xd9b3, 0x4482, 0xc927, 0x8f03, 0x564c, 0x6fa6, 0xaf0f, 0xccdf, 0x510e, 0xd5b1, 0xa99d, 0xe49b, 0x7110, 0x56de,
+    0xb0e9, 0x4678, 0xe025, 0xd3b3, 0x9c71, 0x5f10, 0x1d60, 0x906b, 0x39c2, 0x6d98, 0x4e46, 0x2540, 0x5bb6, 0xca29, 0xbc8f, 0x81a1,
+    0x53ea, 0x6dc2, 0xb671, 0x8a1f, 0x5954, 0x7b8e, 0x9315, 0x626e, 0xe111, 0x9c73, 0xc9c9, 0x899f, 0x1bea, 0xdfd9, 0x4882, 0xcfbf,
+    0x1da0, 0x7082, 0x8fd5, 0x7816, 0x1aec, 0xc4a5, 0xab67, 0xdfa9, 0x2b26, 0x6880, 0x9cf1, 0x7e40, 0xba1b, 0x4320, 0xaf6b, 0x56c0,
+    0x2a26, 0x8e0b, 0x81ed, 0xdd1d, 0xb3dd, 0x53f6, 0x4c72, 0xb68f, 0x2274, 0x2b14, 0x9faf, 0xb74d, 0x3966, 0xd64b, 0x5788, 0x257e,
+    0x1d4e, 0x86c9, 0x9ee1, 0x368a, 0xadd9, 0x24f8, 0xa5e5, 0x5b68, 0xbdaf, 0x766e, 0x3ab2, 0x1dba, 0xd9c1, 0x9ec1, 0x713e, 0x1990,
+    0x355c, 0xb4bf, 0xe223, 0x2a50, 0xbac7, 0x8b69, 0x2c16, 0x4c4e, 0x7b58, 0xcd4b, 0x1914, 0xb609, 0x22b6, 0x48c4, 0xe501, 0x6636,
+    0xad4d, 0x1ac4, 0x53cc, 0x6966, 0x45ac, 0x93a1, 0x38f4, 0x701a, 0x8ac1, 0xc99d, 0xe13f, 0x9c6d, 0x523c, 0x20c8, 0x6318, 0x9b21,
+    0x2c04, 0xddf5, 0xc55b, 0xa9a7, 0xb2c9, 0x43fa, 0xbe99, 0xe3d5, 0x8c91, 0x1800, 0xa85d, 0x2ad4, 0x99b7, 0xdbbf, 0x192e, 0x2f46,
+    0x97fb, 0xe0d9, 0xbd7f, 0x5e62, 0x9a41, 0x3d58, 0x17a4, 0x625a, 0x6e8a, 0x490a, 0xa791, 0x4a3a, 0xcd5f, 0x1ba6, 0x34e2, 0x77c8,
+    0xb04b, 0x54ae, 0xd779, 0x7102, 0x1e66, 0x8a37, 0xda13, 0xa2f9, 0x6d7c, 0x159e, 0x9879, 0x24de, 0x44c8, 0xb489, 0x359a, 0x619c,
+    0xc4ad, 0x6d02, 0x7d2a, 0x1fd0, 0xbe11, 0x95eb, 0x9133, 0x63e0, 0xc5ef, 0x928d, 0x4688, 0xca6d, 0x2e3c, 0xa55d, 0x92bd, 0xc13f,
+    0x355c, 0x7de2, 0x4430, 0x52da, 0x2d76, 0x7714, 0xc4fb, 0x1902, 0x8ea5, 0xe883, 0xbbdf, 0x3eea, 0x18ba, 0x4938, 0x6b68, 0xbb51,
+    0xa50f, 0x457a, 0xdb0f, 0x6f22, 0xb3ad, 0x8157, 0xa4a1, 0x39a2, 0x935f, 0x89c5, 0xbd2b, 0x7e88, 0xd093, 0x2334, 0x97b5, 0x579e,
+    0xb8cf, 0x1e10, 0x4a5c, 0x878b, 0x3e6e, 0x76f2, 0xa6e3, 0xecd9, 0x80e9, 0x9bed, 0x39c6, 0xc9d3, 0x73c8, 0x2ee0, 0xdf59, 0x9ab5,
+    0x5436, 0x22a0, 0xc349, 0x9207, 0x6c20, 0x7c76, 0x313a, 0x8ffb, 0xc99b, 0x48b6, 0x65a6, 0x3066, 0x50ec, 0x8c2d, 0x6c0e, 0xa4b1,
+    0x8095, 0x4d6a, 0x9e6b, 0x712e, 0xe405, 0x3374, 0x9f53, 0x1db2, 0x3a36, 0x9649, 0x8669, 0x6676, 0x3fda, 0x8dcd, 0x3a18, 0xcddb,
+    0x8d2d, 0xbc9b, 0x2718, 0x88bb, 0x59b0, 0x2886, 0xa5f9, 0xe28f, 0x33dc, 0x9f69, 0xbb3d, 0xd517, 0x42c4, 0x9205, 0x519a, 0x9bed,
+    0x2f32, 0xcf55, 0x4408, 0x1cdc, 0xade3, 0x30b4, 0xc0d1, 0x39a8, 0xad03, 0x516c, 0x6eca, 0xa571, 0x52ba, 0x6ce6, 0xb6fb, 0x8ba5,
+    0x611c, 0xad19, 0x4dac, 0xe251, 0x8baf, 0x35f2, 0xb99b, 0x4536, 0x8de3, 0xdf9b, 0xcb87, 0x3016, 0x8b31, 0x5a06, 0x8601, 0xe383,
+    0x4f60, 0xa917, 0x96f9, 0x4724, 0x6fea, 0x9241, 0x3736, 0xdb25, 0xa5fd, 0x6a3c, 0xd755, 0x7a3c, 0x5e9e, 0xa16d, 0x72f4, 0xaf6d,
+    0xd091, 0xc473, 0x777c, 0x4b7c, 0xbead, 0x6a6c, 0x8a8f, 0x3bee, 0xee37, 0x9ce1, 0x7f4c, 0x67c0, 0xa9fd, 0x4160, 0x8723, 0x4e26,
+    0x5cf0, 0xc195, 0x7bc8, 0x4a92, 0xa4bb, 0xcf73, 0x6c60, 0xabff, 0x3dc4, 0x9a0f, 0x7fae, 0x7140, 0xa1c7, 0x392c, 0xd06b, 0x8175,
+    0x4b2e, 0xbd8f, 0x8c63, 0xe9bb, 0xb9c9, 0xd201, 0x6272, 0x2110, 0x9b77, 0x5f34, 0x2386, 0x7048, 0xc52f, 0xd36d, 0x4b2a, 0xab33,
+    0xcb57, 0x7246, 0x1acc, 0x4af2, 0xc90d, 0x5912, 0x3194, 0xa0a1, 0x52a8, 0xb53d, 0xd041, 0xd24b, 0x63a2, 0x777c, 0x4c14, 0xc2d1,
+    0x8379, 0x39b8, 0x8ccb, 0x29e0, 0x4f3c, 0xe071, 0xb693, 0x8579, 0x26b2, 0xc2db, 0x3bae, 0x5804, 0x8963, 0xdc07, 0x923d, 0x5fb8,
+    0x29e6, 0xc50b, 0x3ca0, 0xa817, 0x97a5, 0x62c2, 0x30a6, 0x41f0, 0xc8e3, 0x6012, 0xdf67, 0x8e7d, 0xa41f, 0x6ff4, 0x9623, 0xe1d1,
+    0x43b6, 0x9ec5, 0x90af, 0xb3cd, 0x652e, 0x3e60, 0xcfc5, 0x487e, 0x2a38, 0xd38f, 0x5e0c, 0x8843, 0xe20d, 0x364a, 0x488e, 0x6660,
+    0x24ca, 0xe6b7, 0x8fcd, 0xc579, 0x687c, 0x414c, 0xadbd, 0x309a, 0x6a92, 0x455c, 0x6a50, 0xbd81, 0x8575, 0xcf23, 0x26f8, 0x55ec,
+    0x185e, 0xc0e1, 0x5266, 0x8d13, 0x3e5e, 0x1734, 0x5456, 0xc209, 0xdd95, 0x68a8, 0x39ce, 0x578a, 0x9429, 0x2f42, 0x4230, 0x81c3,
+    0xdb27, 0x3b1e, 0xa269, 0xed23, 0x2dec, 0x5fd4, 0x5b7c, 0xcaf1, 0x4d62, 0xb4b7, 0x54ea, 0x2544, 0xc1ef, 0x8a7d, 0x5338, 0xad9b,
+    0xe5e7, 0x72a4, 0xa3f7, 0x3f14, 0xd691, 0xb279, 0x4b1e, 0x63f4, 0x2a82, 0xe32f, 0xae55, 0xb735, 0x8431, 0x7638, 0xe8fd, 0x2ab6,
+    0xbc19, 0xd0b1, 0x3190, 0xac3d, 0x62e8, 0x464c, 0x8271, 0xbf45, 0xe657, 0x5f08, 0xb825, 0x2162, 0xa8cf, 0x5fb6, 0xb69d, 0x1a60,
+    0x463e, 0x6838, 0x7620, 0x4072, 0xd953, 0xb847, 0x882d, 0x57f0, 0xccf3, 0x8d07, 0x18ea, 0xaabb, 0x7e92, 0xe081, 0x698e, 0x3e42,
+    0xdf65, 0x9aaf, 0xa5dd, 0x769c, 0xe9af, 0x9e2b, 0x4f84, 0xb64b, 0x7816, 0x204a, 0x413c, 0xd617, 0x3290, 0xab6d, 0x769c, 0x295e,
+    0xd45d, 0x5c5c, 0xbd97, 0x3074, 0xa751, 0x4aaa, 0x81c3, 0x5554, 0x205e, 0xada1, 0x45c2, 0x4dcc, 0xb879, 0x29dc, 0x9c89, 0x1e60,
+    0xca15, 0x6f08, 0x21a2, 0xc28f, 0x33d6, 0xc15f, 0x5b2a, 0x8745, 0xc717, 0x549c, 0xaf97, 0x1e54, 0x8e8b, 0x37b8, 0xdf5d, 0x453a,
+    0x7c9c, 0x35da, 0xe1a7, 0x1940, 0x82c9, 0xdcf3, 0x4dae, 0x1970, 0xaf55, 0x2a8c, 0xc6fd, 0x97cd, 0x2e06, 0xb35d, 0xcaa3, 0xdc59,
+    0xa479, 0x273a, 0x94db, 0xd0c5, 0x18a0, 0x71c2, 0xe4d7, 0x2f1a, 0xb9e3, 0x5d3e, 0x48c8, 0xe653, 0x9927, 0xc213, 0x581a, 0x2c32,
+    0x95c1, 0x7286, 0x2db2, 0x9bbb, 0x2258, 0x547c, 0xc4c9, 0xe789, 0x4ffc, 0xa8f9, 0x43ac, 0x8585, 0xb527, 0x3fb6, 0x74fa, 0x2ee6,
+    0x5ab2, 0x3b72, 0x9dd9, 0x7e1a, 0x3a26, 0x78b6, 0xcdc3, 0x71b8, 0x3bd0, 0x85bf, 0x567a, 0x4674, 0x310c, 0x8f6b, 0xab6b, 0x607a,
+    0xd319, 0x46f4, 0xa2f1, 0xcca7, 0x7980, 0xc801, 0x9909, 0x5b82, 0xb789, 0x82c1, 0xe78d, 0xa253, 0x6f8c, 0xb9cb, 0x32b4, 0xa181,
+    0x8c13, 0x6c7a, 0x1186, 0x831d, 0xc4db, 0xd21b, 0x7980, 0xba77, 0x953b, 0xa91b, 0x3f8a, 0xd3a5, 0x53be, 0x22bc, 0x7e78, 0x4a40,
+    0xbbf7, 0x5790, 0x254e, 0x45a8, 0xe3db, 0x7950, 0xac65, 0x70ee, 0x9981, 0x46ba, 0xa989, 0x1f8a, 0xc18b, 0x7ef2, 0xd233, 0x9bb9,
+    0xc853, 0x595e, 0xa531, 0xdc49, 0x9937, 0xba4d, 0xe8b3, 0x804f, 0x99bf, 0x22c2, 0x9d2f, 0x2f2e, 0x7788, 0xb417, 0x9703, 0xe659,
+    0x7ba6, 0x9ed1, 0x2d74, 0xafed, 0x8d19, 0xd0bb, 0x9e77, 0x72fe, 0x3220, 0xc4fb, 0x1c60, 0xa935, 0xe677, 0xbe11, 0x66a6, 0xd339,
+    0x32ac, 0x8483, 0x6df6, 0xce95, 0xbb43, 0xa331, 0xd1d5, 0x1bd6, 0x3654, 0x9561, 0x8083, 0xd70b, 0xa691, 0x3962, 0x7a6a, 0x6ebe,
+    0x4666, 0x2fa0, 0xc637, 0x5b6a, 0xa73f, 0x3140, 0xdcc1, 0xc521, 0x802f, 0x9947, 0x3a7e, 0x1de6, 0xa2bd, 0x4c62, 0xc721, 0x3d7c,
+    0x5bd6, 0x7536, 0x90b9, 0x1ac0, 0x83bb, 0xd423, 0x9a8d, 0x6a36, 0x4586, 0x7446, 0xd6df, 0x3158, 0xc9f9, 0x86a3, 0x9c93, 0x6ff6,
+    0xe1af, 0x9959, 0xae05, 0xcbc5, 0x5190, 0x6f02, 0xc359, 0x5aec, 0x4818, 0xc7c1, 0x635c, 0x589e, 0x2df6, 0x991f, 0x210a, 0xa813,
+    0x8049, 0x5d06, 0x3102, 0xc801, 0x56b2, 0x6876, 0xd1f9, 0x5ed4, 0x8db3, 0xe681, 0xb707, 0x87a5, 0x8f8b, 0xc2b3, 0x5212, 0x96c5,
+    0x372c, 0x80ad, 0xd5b1, 0x698a, 0x66d4, 0x97c7, 0xd6ab, 0x7220, 0xc32f, 0x8327, 0x64a6, 0xac67, 0xdfc3, 0x6f06, 0xc8db, 0x90f1,
+    0x3d72, 0xba55, 0x5b8e, 0x521c, 0x8a5b, 0xe25d, 0x1e58, 0x988f, 0x4494, 0x214c, 0x8693, 0x484c, 0xdd37, 0xbe83, 0x8ad7, 0x5062,
+    0xabad, 0x6098, 0x943f, 0xb31f, 0x4466, 0xcfc5, 0x9545, 0x7748, 0xc663, 0x4e80, 0x3912, 0xe34f, 0x562e, 0x700c, 0x1e16, 0x91d1,
+    0x4544, 0x694e, 0xb4fb, 0x821d, 0x4e64, 0x43bc, 0xabd5, 0x8981, 0x87c9, 0xd7f5, 0x2e5e, 0xb037, 0x76a6, 0x3ada, 0x7e28, 0xb7b7,
+    0xe383, 0xd3b5, 0x3b88, 0xac29, 0x7c38, 0x3de8, 0x8555, 0x968b, 0x33f4, 0x7a08, 0xc543, 0x2cf2, 0x6648, 0xa1df, 0xd0f1, 0x8a95,
+    0xc2e3, 0x948b, 0xd63b, 0x6df4, 0xe4ef, 0x8f73, 0x2abe, 0xab13, 0xe02d, 0x800d, 0x2c6e, 0x9453, 0xb58f, 0xeafb, 0xbf33, 0x262a,
+    0x758e, 0xb479, 0x1efa, 0x6622, 0x81cd, 0x2fa8, 0x68b0, 0xa657, 0x2fe0, 0x4a1c, 0x94db, 0x1df0, 0x410c, 0xc5bf, 0x7298, 0x5784,
+    0xe8a3, 0xbb31, 0x5da2, 0xded3, 0x4b14, 0x275e, 0x568c, 0xe315, 0x4c8c, 0x2b26, 0x62ba, 0x78aa, 0xc21b, 0xb2ef, 0xd031, 0x16fa,
+    0x8caf, 0xae45, 0xd1b7, 0x7286, 0x9fc5, 0x275c, 0x18d6, 0xddbd, 0x8683, 0xb7bd, 0x7af2, 0x8ef3, 0x544a, 0x9eef, 0x62fe, 0x176a,
+    0xae37, 0x71de, 0x2d3a, 0x245e, 0x445c, 0x201c, 0x5fea, 0x58ce, 0xd6b5, 0xb9c3, 0xe27d, 0x6168, 0xc6cb, 0x53fe, 0x3010, 0x8ba5,
+    0x4068, 0x734c, 0x555e, 0xc36b, 0xe757, 0x2e4a, 0x5f90, 0xab45, 0x4ce4, 0x8f71, 0x730a, 0x9e29, 0x269e, 0x71c2, 0xaeeb, 0x9923,
+    0xc2a5, 0x798e, 0x53d6, 0x23e6, 0x45f4, 0x7b4e, 0x355e, 0x8447, 0x6a96, 0xbf4b, 0xe6b1, 0x5780, 0x623c, 0x24a2, 0xbffb, 0xcee1,
+    0xa56b, 0x913f, 0x7df2, 0x1f02, 0x5562, 0x8291, 0x9b37, 0x19b8, 0x5614, 0x7934, 0xd15f, 0x5bea, 0xdc17, 0x93fb, 0x1ace, 0x894b,
+    0xa5e3, 0x3864, 0xdfa9, 0xc1ef, 0x3de6, 0xae41, 0x2af4, 0xd73b, 0x87a1, 0x1c14, 0x9afb, 0x67f0, 0x4cf6, 0xe0bd, 0x2808, 0x54bc,
+    0xc71b, 0x331a, 0x56a8, 0x1ea4, 0x9931, 0x359a, 0x92d1, 0x1f84, 0x75ee, 0x9737, 0x399e, 0xe9f7, 0xc0b3, 0x6ae6, 0xca71, 0x4c8e,
+    0xc6eb, 0x8347, 0x1582, 0x9727, 0x7e7e, 0x2824, 0x88c7, 0x1dbe, 0xa3df, 0x3448, 0x513a, 0xc871, 0x1846, 0x3b76, 0xdfd1, 0xd2f7,
+    0x6380, 0x1f76, 0x9ec1, 0x4022, 0xd93f, 0x221c, 0xb041, 0x309a, 0xe835, 0x3944, 0x8a9b, 0xd521, 0x1f50, 0x396c, 0x5e20, 0xac1f,
+    0x72b6, 0x8bcd, 0xdf0b, 0xb383, 0xa545, 0x8135, 0x6200, 0xb8c7, 0xea35, 0x7344, 0xd5e9, 0xa813, 0x5b40, 0x74c2, 0x15e4, 0x98a9,
+    0xd9e5, 0x3642, 0x5db4, 0xa23d, 0x2bdc, 0x6d9c, 0x3598, 0x614e, 0xd4b5, 0x818d, 0x668c, 0xbda5, 0x4bfe, 0x85e9, 0xd6e1, 0x3434,
+    0x7cee, 0xe6db, 0x3c44, 0x2e26, 0x9db9, 0xde6f, 0x5fb4, 0x1bb4, 0xc487, 0xa66b, 0x1d9e, 0x6014, 0xbe37, 0x1a06, 0xa36d, 0x5b86,
+    0x2346, 0x7618, 0x4fba, 0xbd17, 0xe00b, 0x6ebc, 0x2eb4, 0xb1d9, 0xd095, 0x71b0, 0xdc0f, 0x952b, 0xe42d, 0x54c2, 0x241c, 0x6c4e,
+    0xde0d, 0x45a0, 0x2eb8, 0xa9c1, 0x5796, 0xa077, 0xb5e7, 0x4b70, 0x1f10, 0xcc29, 0xbed1, 0x6c56, 0x833b, 0x3b22, 0x15aa, 0x6410,
+    0x9ed9, 0xe7e7, 0x5544, 0xaf4d, 0xd889, 0x1436, 0x4328, 0xe3b7, 0xd17d, 0x896d, 0xbeff, 0x64d6, 0xdc9b, 0x5a08, 0x1e62, 0xd127,
+    0x4806, 0x3248, 0x9e9d, 0xb609, 0x89ed, 0x6a3e, 0x9723, 0x231a, 0x7d22, 0xa5f5, 0xc383, 0x1ee2, 0x9a25, 0x3e94, 0x5f74, 0x6f96,
+    0xe135, 0x67b4, 0x326c, 0x84a7, 0xc799, 0x5b60, 0xadb1, 0x96b3, 0x4ab0, 0x2f60, 0xe71b, 0x6a82, 0x333e, 0x2de2, 0xd97d, 0x7ff2,
+    0x42d2, 0x9195, 0x5e36, 0xa97b, 0x8881, 0xcd3f, 0x91c3, 0xa05b, 0x3014, 0x4c84, 0x8633, 0x8acd, 0x4a66, 0xa561, 0x60aa, 0xd8a5,
+    0xb883, 0xcda3, 0x1e2e, 0x64c4, 0x4bc4, 0x707c, 0x8fb3, 0x29d2, 0xe00b, 0xb87b, 0x569e, 0xd9f9, 0x37e2, 0x835f, 0x4c74, 0x15da,
+    0x3ed0, 0xa8fd, 0xa17b, 0xddf5, 0x9321, 0xae6d, 0x6094, 0xc861, 0xab1b, 0x2be2, 0x23a0, 0x8003, 0xb01f, 0x9b45, 0xd7ab, 0x1882,
+    0x585a, 0xb287, 0x6e7c, 0xde57, 0xd721, 0x6de4, 0x418a, 0xbae5, 0x51ce, 0xab63, 0x8f69, 0xbddd, 0x6694, 0x33c4, 0x6cdc, 0xb9a5,
+    0xdbf7, 0x6114, 0x515e, 0x7cc2, 0x595c, 0x7068, 0xa087, 0x4f7e, 0x370e, 0xbfa9, 0xb0bd, 0x5376, 0xabc3, 0x6d6e, 0x86ff, 0xa6d1,
+    0x450e, 0xa917, 0x7dc4, 0xb9e3, 0x9111, 0xdd6b, 0x46de, 0xaad1, 0xdba3, 0xba1b, 0x81cf, 0xa7f3, 0x4228, 0x4f6c, 0x936f, 0x26b2,
+    0xb49f, 0x5f1e, 0xd095, 0x4d2e, 0xc01b, 0xb33f, 0x418e, 0xdbe5, 0xcb11, 0x68b2, 0x9ad7, 0x5fb6, 0x878f, 0x6fc6, 0x5a62, 0xa60f,
+    0x811b, 0x955b, 0x519e, 0xbb69, 0x7de8, 0x8557, 0x5774, 0x4282, 0xa84b, 0x54c2, 0x20b2, 0x9ced, 0x75b4, 0x841d, 0xe01d, 0x4bfa,
+    0x2452, 0x96ab, 0x693a, 0x1362, 0x3b20, 0xce11, 0x2d26, 0x4ba6, 0x8b01, 0x37bc, 0xba83, 0x6768, 0x4044, 0xc661, 0x274e, 0x6b0e,
+    0xc219, 0x2298, 0xdd91, 0x821f, 0xc3dd, 0x9fa7, 0xe1a9, 0xaaeb, 0x46ae, 0x1a90, 0x9ea5, 0x93c7, 0xcc0b, 0xa9b5, 0x67e8, 0x5398,
+    0xc0b7, 0xa59b, 0x5bb4, 0xc983, 0x8d47, 0xbf09, 0x788c, 0x47d4, 0x3e4c, 0x6fb0, 0x8679, 0x49e0, 0xd4d9, 0x951f, 0xea61, 0x4930,
+    0xa521, 0x6be6, 0x89c9, 0x1dd6, 0x5e76, 0xc9fb, 0xa09b, 0x2162, 0x5926, 0x9865, 0x3e5c, 0x14dc, 0x7f38, 0x4d26, 0xaaab, 0x9a3f,
+    0x1ad8, 0x7bb6, 0xb4e7, 0x7402, 0x18ea, 0xc329, 0x4538, 0x6796, 0x8d95, 0x60a2, 0xa0d9, 0x21a4, 0xdb3f, 0x56b0, 0x9165, 0xce45,
+    0x5166, 0x867d, 0x29aa, 0x92b3, 0x55c0, 0xb425, 0x9e7d, 0x5f66, 0x3e42, 0x6f00, 0xaaf5, 0x368a, 0x9c39, 0x8d09, 0xaac3, 0xc73d,
+    0x98a3, 0x7c8e, 0x763e, 0x3866, 0x2712, 0xcb85, 0xaf0b, 0xbf75, 0x7272, 0xdc63, 0x4b3a, 0x538e, 0xe7b3, 0x8e4b, 0xa511, 0x2c8a,
+    0xb67b, 0x955b, 0x1f2a, 0xbd6b, 0x4ffe, 0x9cd9, 0x4224, 0xca15, 0x5f2a, 0x1b7c, 0xab9f, 0xd3a1, 0x920f, 0xb101, 0x4fda, 0x6ba8,
+    0xba75, 0xe889, 0xd065, 0x6ddc, 0xc2b1, 0x400c, 0x6930, 0x47a6, 0xc70d, 0x79f2, 0x35b0, 0x1b04, 0xe713, 0xc17f, 0x24a8, 0x6b2c,
+    0x4f66, 0xe0bb, 0xa309, 0x9ac7, 0xc9eb, 0x3fb0, 0xad15, 0xd045, 0x8353, 0x3648, 0x62d2, 0xc8a7, 0x5e16, 0xcf11, 0xad01, 0xe477,
+    0x6226, 0x34f8, 0xb537, 0x3b1e, 0x6ad8, 0x2352, 0xd7e1, 0x7864, 0x9ad9, 0x4758, 0xca97, 0x700a, 0x3708, 0x42c4, 0x5ef8, 0x7f00,
+    0xe9e9, 0x40b4, 0x8bd3, 0x47f6, 0xbb4b, 0x2ff6, 0x8c07, 0xeb73, 0x9e2f, 0x210a, 0x3f48, 0x2e18, 0x795a, 0xad1d, 0xe503, 0x559e,
+    0x7f9c, 0x2574, 0xa571, 0x9b11, 0xe7cf, 0x33ac, 0xc4b7, 0x71cc, 0xb2f7, 0x6178, 0xe493, 0x8237, 0x22de, 0xbdff, 0x3bcc, 0xd955,
+    0x8437, 0x2b9c, 0xe35d, 0x5302, 0x6644, 0x7fbc, 0xcd59, 0x59ca, 0x2c48, 0x4baa, 0x18d0, 0x75d4, 0xb5d3, 0x8faf, 0x7d68, 0xe11b,
+    0x4240, 0xa05b, 0x7d7a, 0xddeb, 0x64f0, 0xa1bf, 0x70e4, 0x5998, 0x7da8, 0x4820, 0xd3e1, 0x2cf2, 0xb5d5, 0xbaf5, 0x4254, 0x3022,
+    0xb859, 0xe8c9, 0x473e, 0xc921, 0x26f8, 0xab17, 0xd579, 0x9585, 0xc7a1, 0x7eca, 0x4c84, 0xb5b9, 0xca9d, 0x3144, 0x6746, 0xbaf9,
+    0xd105, 0x374c, 0xc2af, 0x4510, 0x93fd, 0x5af8, 0xaaa7, 0xc055, 0x64b2, 0x92f1, 0x14de, 0x7992, 0xe321, 0xa79f, 0xb109, 0x8789,
+    0x4806, 0x9107, 0xb1df, 0x5078, 0x62d2, 0x1624, 0x5896, 0x8a9f, 0xb72d, 0xd8c3, 0x75e0, 0x3b10, 0x27cc, 0x1cd4, 0x9995, 0xd529,
+    0x8459, 0x176c, 0x6ef4, 0xd95d, 0x1f5e, 0x312a, 0xb397, 0x9c9d, 0xd075, 0xc087, 0xe65d, 0x9c71, 0x5700, 0x272a, 0x7162, 0x8927,
+    0x378e, 0xce95, 0xa6e7, 0xd18b, 0x38ba, 0x9525, 0x4e34, 0xddd5, 0x81cb, 0x4c9a, 0xbd4d, 0xa80f, 0x7048, 0xbecb, 0x402a, 0xc80b,
+    0x5728, 0xa999, 0x561a, 0xcd99, 0x3852, 0x889b, 0x7360, 0xde01, 0xa63b, 0x387e, 0xd0bb, 0x45e2, 0xc62b, 0xa76d, 0x73ae, 0x3b80,
+    0xb7eb, 0x7720, 0x401a, 0xc2b7, 0xcd09, 0x7b4e, 0x8d71, 0x2508, 0xc125, 0x5272, 0x203a, 0xce19, 0x4bb8, 0x7cd4, 0x2402, 0x6ac8,
+    0x5e98, 0x22e2, 0xc63d, 0x5670, 0xe1bf, 0x7c18, 0x32e8, 0x5ce4, 0x3b3c, 0x9227, 0xaba7, 0x7e5c, 0x3746, 0x6730, 0xcb03, 0x4bc6,
+    0x433e, 0xcbc3, 0x588c, 0xe743, 0x8d73, 0x6a12, 0xd24d, 0x7a16, 0xc19f, 0x9baf, 0x448e, 0x7efa, 0xc183, 0x7792, 0xd86b, 0x9acd,
+    0x2f84, 0x1b44, 0x445c, 0x76b2, 0xa31b, 0xdcdb, 0x17a8, 0xb583, 0x728a, 0xaf11, 0xc53d, 0xa081, 0x7544, 0x81fb, 0x1d16, 0x9bd5,
+    0x88a5, 0x35b6, 0x20e2, 0x825b, 0x59b2, 0xba73, 0x6f32, 0x549c, 0x4320, 0x91a5, 0x1e52, 0xa939, 0x42c2, 0x2ee8, 0xbb95, 0x8009,
+    0x5858, 0xd9af, 0x8115, 0x4bde, 0xcca1, 0xa09b, 0x407a, 0x2894, 0xd37b, 0x5f2a, 0xaad5, 0x904f, 0xe0db, 0xcc2d, 0x797a, 0x276e,
+    0x7686, 0xca47, 0x1ba2, 0x4c60, 0xae57, 0x72a0, 0x6538, 0xcff3, 0x3794, 0x6afe, 0xec55, 0xd001, 0x949b, 0x4b9c, 0xbe9b, 0x263a,
+    0x9ba9, 0xcebb, 0x4538, 0x199c, 0xbee7, 0x818b, 0x422a, 0xd63d, 0x8325, 0x229a, 0x75b0, 0x3e3a, 0x8f6d, 0xd7cd, 0x78d6, 0x4afa,
+    0xb5d3, 0x6e32, 0x97a5, 0x40cc, 0xc425, 0x22ec, 0x9121, 0x69ac, 0xa6a1, 0xe237, 0x6682, 0xcaf1, 0x2de6, 0xd7bb, 0x3428, 0x9d35,
+    0x6838, 0x2b4c, 0x9149, 0x4f8c, 0x1c40, 0x33da, 0xd1fb, 0x92a7, 0x23b0, 0xb3bb, 0x7f6a, 0xa307, 0xe569, 0x27be, 0x8105, 0xd887,
+    0x5d94, 0x186c, 0x6fa8, 0x90f9, 0x5b56, 0x68ce, 0x3a86, 0x70e6, 0x1b42, 0xbb1b, 0xd8bb, 0x6e74, 0x3b84, 0xbed5, 0xa1ab, 0x8e3d,
+    0x51e6, 0x72a2, 0xe937, 0x9379, 0xcb0d, 0x71dc, 0x8545, 0x218e, 0xd897, 0xa9dd, 0x4af6, 0x2b46, 0x924d, 0x4fc2, 0x36c0, 0xea29,
+    0x5b36, 0x6fee, 0x293a, 0xd2cb, 0x877b, 0x40da, 0xba9b, 0x2490, 0x67ee, 0x337e, 0x5090, 0xc175, 0xead5, 0x6a6c, 0x439a, 0xb581,
+    0x2dd8, 0x4536, 0xafb9, 0x98bd, 0x5dc6, 0x49be, 0xe983, 0x65c6, 0x2b20, 0x563e, 0x8223, 0x3308, 0xc4d5, 0x7dc0, 0xba61, 0xd839,
+    0x5cc4, 0xc255, 0x2b46, 0x4c60, 0x8401, 0x76c8, 0xb3dd, 0x6f64, 0x873f, 0x286e, 0xcd23, 0x611e, 0x2fa4, 0x8e03, 0xd923, 0x77ce,
+    0x3ece, 0xe3e7, 0x8e47, 0x6946, 0xa5cf, 0xdf1b, 0x2996, 0xb21f, 0x3336, 0x4fcc, 0x7ab4, 0x60aa, 0x2d4a, 0x8bf7, 0x5af0, 0xc69b,
+    0xb16f, 0x2684, 0xd195, 0x6eaa, 0x5cda, 0x3482, 0xe88f, 0xb511, 0x9ced, 0x7bf2, 0xe429, 0xac31, 0x6278, 0xcadb, 0x3ade, 0x90fb,
+    0xe1dd, 0xabab, 0xd921, 0x6496, 0xb989, 0x4a12, 0x849d, 0xd3a3, 0xbad3, 0x16ee, 0x5fc6, 0xd34b, 0xb607, 0x2806, 0xe177, 0x9d91,
+    0x8181, 0x70ea, 0xa2e9, 0x1ea8, 0x75a8, 0x2966, 0x3fd8, 0x2028, 0x889f, 0xdeb5, 0x33a2, 0x5320, 0x265e, 0x18d6, 0xa767, 0x5d10,
+    0xc1ff, 0x8ac1, 0xa801, 0x510e, 0x2512, 0x9591, 0x5974, 0xd59d, 0x95c3, 0x26e0, 0x53ea, 0x64c6, 0x496a, 0xd219, 0xb0d5, 0xc625,
+    0x5ab0, 0x77a8, 0x62d4, 0xdad5, 0xb001, 0x1af0, 0x8669, 0x2e1a, 0xa28d, 0xd127, 0xe783, 0x8619, 0x8d8d, 0x69d0, 0x247c, 0x85a1,
+    0x9f8b, 0xc489, 0x1cb4, 0x5d5a, 0x8801, 0xc1d7, 0x5484, 0xab01, 0x7e96, 0x3f8c, 0xbee5, 0x510a, 0x1ff4, 0x93c3, 0xac81, 0xbf79,
+    0x5978, 0xa6e3, 0x7d66, 0xc5c3, 0xa0b1, 0x1b8a, 0x5814, 0xb155, 0x7cc4, 0x96f9, 0xb8bf, 0x624e, 0x9c7d, 0x1a98, 0x86b9, 0x3cdc,
+    0x60e4, 0xc3bb, 0x8f13, 0x65cc, 0xd441, 0x5300, 0x19ce, 0x959b, 0xa109, 0x440e, 0xd099, 0xa6e3, 0x2b10, 0x64e0, 0x99c1, 0x17e4,
+    0x5b60, 0xcdbf, 0xa567, 0x20b4, 0xa7ed, 0x366e, 0xba09, 0x4512, 0xc0d7, 0x8583, 0x9901, 0x49b8, 0x571c, 0xa867, 0x5cfe, 0x50cc,
+    0xd5ed, 0x804f, 0xcdf1, 0xb2a1, 0x8b71, 0x799c, 0xdfd9, 0x4d92, 0xa721, 0x3570, 0x6180, 0x3baa, 0x589c, 0x8c39, 0x6e58, 0xca9d,
+    0x3afa, 0x8131, 0xb489, 0x39be, 0xdc35, 0xc1c9, 0x2e08, 0xe20b, 0x9a5b, 0x5e60, 0x2cba, 0xa775, 0x5428, 0x8fff, 0x1d82, 0x772e,
+    0x3964, 0xaa13, 0x5b24, 0x79f0, 0x273e, 0xb9a9, 0xe63b, 0x3b54, 0x79b4, 0x72cc, 0xd20f, 0xc931, 0xafaf, 0x4484, 0x730c, 0xd33d,
+    0xa7a9, 0xc111, 0x8c69, 0x37ee, 0xacf3, 0xd3a5, 0xed49, 0x7b60, 0xa081, 0xcd53, 0x964b, 0x8447, 0xb14f, 0x5f66, 0x91f5, 0x7bde,
+    0xe0c7, 0x9011, 0xc8d5, 0x3da2, 0x7da0, 0xc92f, 0x890f, 0x17a8, 0x89ab, 0x4620, 0xadbd, 0x1cec, 0x6636, 0xa3d3, 0x3b84, 0x28ca,
+    0x9649, 0x7d4e, 0x6a44, 0xb1b9, 0xe59b, 0x4ff6, 0x2c3a, 0xc5c3, 0x3bc8, 0xd91d, 0x7de6, 0x9a43, 0xe7db, 0x4702, 0x9ded, 0x66ce,
+    0x81a3, 0x3064, 0x1efa, 0xc8e9, 0x97b1, 0x4d2a, 0x54a8, 0x8bdf, 0xc53d, 0xed6b, 0x87d7, 0xb6d3, 0xb1b1, 0xdf41, 0x19ac, 0x4536,
+    0xe8bf, 0x622e, 0x9833, 0x1f1e, 0x9c8b, 0x2816, 0x53ca, 0x67f0, 0x44ae, 0x2516, 0x9079, 0x3da4, 0x70f6, 0xbee9, 0xd61d, 0x564c,
+    0x4306, 0x2f7e, 0x8519, 0x1552, 0x953b, 0xa355, 0x2666, 0x57f0, 0xe5ab, 0x72d0, 0x2992, 0x88a7, 0x4b42, 0x8d8f, 0x5a98, 0x21f6,
+    0xd3ff, 0x3b74, 0x5c6a, 0x98bf, 0xbe15, 0xe0c1, 0xb083, 0x954b, 0x5358, 0xafbd, 0x702a, 0xa45f, 0xe435, 0x8ee3, 0x4e22, 0x7d60,
+    0x3a90, 0x736e, 0xdf55, 0xafe1, 0x3c88, 0xc2ff, 0x8703, 0x486c, 0x35b8, 0xdd91, 0x8f23, 0xcbad, 0x95fb, 0x397e, 0x57c8, 0x414e,
+    0xe095, 0xc383, 0xa77f, 0x3536, 0x4202, 0x9c8f, 0xe84d, 0xda27, 0x7540, 0x5f98, 0x2664, 0xb8dd, 0xa215, 0xde59, 0xb33d, 0x3a94,
+    0x46a2, 0x7008, 0xaa3d, 0xcd9f, 0x344c, 0xe715, 0x6714, 0x912f, 0x18e4, 0xdd03, 0x7c16, 0x2b32, 0xae9b, 0x4c90, 0x65fc, 0x3654,
+    0xb625, 0xd9fd, 0x2eb8, 0x6c40, 0xe89d, 0x3f7c, 0xd061, 0x2b72, 0x433a, 0x50b0, 0x1766, 0x6ff4, 0x3a6a, 0x682a, 0xd635, 0xe9e1,
+    0x7768, 0x2d54, 0xafe5, 0x34e6, 0x7e7e, 0xa6cd, 0x5d8a, 0xb3fb, 0xdec3, 0x1874, 0x688a, 0xb9bb, 0x565e, 0xe4c3, 0x79a0, 0xbfe9,
+    0x9081, 0x31a0, 0x80cf, 0xdc45, 0x5c06, 0x9e2f, 0xee25, 0x73ca, 0x19fa, 0x2ee0, 0x8c0f, 0xb1d5, 0xc683, 0x1f10, 0x84f7, 0xc1ef,
+    0xb91f, 0x1880, 0x368a, 0x6bc4, 0xbec1, 0x1e04, 0xb7ff, 0x59f4, 0x936d, 0xe411, 0xc8a5, 0x8ae9, 0xd22f, 0x39f0, 0x70ca, 0xad63,
+    0x9de1, 0x5510, 0xd0dd, 0xa4af, 0x4fc8, 0x9ab7, 0x85a5, 0x54cc, 0xad57, 0x4502, 0x85fb, 0xe3fb, 0x7e40, 0x4dce, 0xe693, 0xd515,
+    0x2c62, 0xba87, 0x2362, 0x9acd, 0x34a0, 0x513c, 0x9ced, 0x2fee, 0x9177, 0xb299, 0x40a2, 0x8049, 0x62be, 0xd2cb, 0x2254, 0x638c,
+    0x29a4, 0x3e1a, 0xd43b, 0x59f4, 0x76e8, 0x92cb, 0x4e14, 0x35c2, 0x5d9c, 0xd40d, 0x4a7a, 0x5800, 0x31f4, 0xdb6d, 0xc91d, 0x321e,
+    0x67ac, 0x5c5a, 0xd8c7, 0x3166, 0xb541, 0x532a, 0x9f89, 0xd9dd, 0xb24f, 0xc48d, 0x7c12, 0xe0ad, 0x9deb, 0x4dda, 0x8567, 0xe151,
+    0x4f7e, 0x1e82, 0x8f51, 0x4080, 0xcf0d, 0x1830, 0x99dd, 0xb1c5, 0x700a, 0xa327, 0x3fae, 0x5256, 0xb52d, 0x15de, 0x2a10, 0xb8ab,
+    0xb105, 0xc881, 0x7608, 0x6ce8, 0x3208, 0xbe21, 0x7d50, 0x135e, 0x6d58, 0x99f9, 0x1ebe, 0x39e0, 0x9723, 0x4ee4, 0x6a56, 0x8347,
+    0x9f61, 0x4f70, 0x9271, 0xda73, 0x8989, 0xaca1, 0xd335, 0x87a9, 0xdac1, 0xbe09, 0xc2c7, 0x5352, 0x2a9e, 0x9ae5, 0x1d10, 0xc05b,
+    0x74ce, 0x9a9d, 0xbf69, 0x3508, 0x73e0, 0xdb47, 0x7df2, 0xab2b, 0x4c3a, 0x95f1, 0xa69d, 0xe13f, 0x402a, 0xafdb, 0x77e6, 0xbf1d,
+    0x90db, 0xb16b, 0x3586, 0xc667, 0x4e6e, 0x5ee4, 0x816b, 0xd675, 0x5e3c, 0x1d1a, 0xb52f, 0x8833, 0xcc65, 0x4348, 0x636a, 0xef87,
+    0xb67d, 0x96d3, 0x6492, 0x1fb4, 0x6ee2, 0xe78d, 0x7c8c, 0x5cd6, 0xabc9, 0x8537, 0x39fe, 0x2d8c, 0xb75d, 0xdb1d, 0x8981, 0x7004,
+    0x1ffa, 0x8e7f, 0x6ed2, 0xcc93, 0x5dc6, 0x778e, 0x3c2a, 0xb503, 0x4ef0, 0x81b7, 0x2f62, 0x5674, 0x3942, 0x4f74, 0x6212, 0xe57b,
+    0xca05, 0x25a8, 0x8e4f, 0x40a2, 0x94b3, 0x7470, 0x37c6, 0xc831, 0x4f06, 0xbb73, 0x985b, 0x6a3a, 0xdab9, 0x84a3, 0xdc8f, 0x2056,
+    0x7ab8, 0x4b96, 0x80c5, 0x6090, 0xbd01, 0x8f35, 0x88c5, 0xaa21, 0xc2a7, 0xd315, 0x8e23, 0xdcc1, 0xc6e1, 0xb0bb, 0x5a0e, 0x947f,
+    0xa80b, 0x4c38, 0xde49, 0x59e2, 0xca0b, 0xe59b, 0x30c2, 0x6fa8, 0x3c54, 0xbc99, 0x9139, 0xcdb5, 0x7db8, 0x4826, 0xaa75, 0x2bdc,
+    0xd20b, 0x3cda, 0x65f8, 0xb79f, 0x705c, 0x8955, 0x5e44, 0x4d4e, 0xd669, 0xbbc5, 0x6af6, 0x3570, 0x7a32, 0xe33f, 0xa463, 0x3f54,
+    0x75ba, 0x5a5a, 0x9e37, 0xe737, 0x571e, 0x9baf, 0x6fcc, 0x33f4, 0x9e2d, 0x721a, 0x16ba, 0x469c, 0xa3c5, 0xbe49, 0x1992, 0x4c7a,
+    0xe3df, 0x61e6, 0x2698, 0x7f14, 0x6674, 0x1fdc, 0xc4a1, 0x363a, 0x7d88, 0xc7a5, 0x22a2, 0x6be4, 0x35f0, 0xbff9, 0x6390, 0xb347,
+    0x6698, 0x988b, 0xdef3, 0x65b2, 0xd5db, 0xb445, 0x6880, 0xcbbd, 0x5c66, 0x4722, 0xd895, 0x2862, 0x6f94, 0xa5ed, 0x878d, 0xc119,
+    0x95ed, 0x50ce, 0xb825, 0x17b2, 0x991f, 0x2f18, 0x665a, 0xa815, 0x868b, 0x2f1e, 0x9ecd, 0x181e, 0x871d, 0xa1bd, 0x4892, 0x1b0c,
+    0xabad, 0x9691, 0x24b4, 0x6fc4, 0xa6f9, 0x2560, 0x5aa4, 0x6a7c, 0x3b3c, 0x4ee4, 0x86db, 0x2b98, 0xd0a7, 0xbe57, 0x5db4, 0xb6af,
+    0x73a2, 0xd709, 0xc17d, 0x5f88, 0xa5fd, 0x7b00, 0xe641, 0x4516, 0x57c4, 0x20e0, 0xc3cf, 0x8429, 0x6d42, 0x80cd, 0xcebd, 0x5908,
+    0x5064, 0xda0b, 0x48e4, 0xb405, 0x5066, 0xd8d7, 0xb2c9, 0x4040, 0xc7d7, 0x530a, 0xcce9, 0x749c, 0xc1b7, 0x3424, 0xc7b9, 0xb5c7,
+    0x2aa6, 0x377c, 0xb193, 0x4c96, 0xc141, 0x425c, 0x93ef, 0x15d0, 0x5f30, 0x9de3, 0x373c, 0x70ca, 0xcfbd, 0x87cf, 0x667a, 0xaf75,
+    0x7aec, 0x62c4, 0xe259, 0x5146, 0xc38f, 0x5d48, 0x1ce2, 0x6c2c, 0xbf6d, 0x3270, 0x5642, 0xc91b, 0x7048, 0x9697, 0x37c2, 0x66ba,
+    0x431e, 0xa443, 0xe2c5, 0x7426, 0x3fbc, 0x9ef9, 0x30fa, 0xc13d, 0x4190, 0xddb3, 0x4d7a, 0x2e0a, 0x5eea, 0xaa3d, 0x2be0, 0xd13d,
+    0x1aee, 0x4430, 0xbf97, 0x88b1, 0xc61d, 0x32f8, 0x9ce1, 0x22f2, 0xd731, 0xc2db, 0x6ba2, 0xa49b, 0x4e86, 0x2298, 0x6810, 0xa14f,
+    0xd65d, 0x4926, 0x24ba, 0x8f03, 0xbcd3, 0x98d5, 0x6456, 0x1e12, 0x8bf3, 0xb83f, 0xc707, 0xd5bb, 0x7ac6, 0xa635, 0x19a6, 0x8139,
+    0x988f, 0x5caa, 0xd4cd, 0x4e8a, 0xb50d, 0x2204, 0xa1a7, 0xdd2d, 0x829f, 0x619a, 0x21c6, 0x4128, 0xcb79, 0x35e0, 0x9b1b, 0x8b9f,
+    0xc293, 0xc535, 0x3a06, 0xa619, 0x16ca, 0x48a8, 0x7496, 0xe1c9, 0x67f6, 0x401e, 0x9783, 0x2ef4, 0x4bd2, 0x7dd8, 0x1b2e, 0x2e42,
+    0xbe53, 0x6904, 0x8535, 0x2530, 0x8f15, 0x4e88, 0x8195, 0xc043, 0x4e1e, 0x5caa, 0x7866, 0x327a, 0x1966, 0x942b, 0xbb39, 0x75fa,
+    0x5548, 0x9ec3, 0xbd8d, 0x48d2, 0x2ec4, 0xc177, 0x2864, 0x9401, 0xabad, 0x5ade, 0xdac9, 0x2074, 0x949d, 0x56f4, 0x64fa, 0x297e,
+    0x9319, 0xd67b, 0xb0a9, 0x448a, 0x294a, 0x7e10, 0xdec7, 0x27c8, 0xd2c5, 0x5d3a, 0xa3a9, 0x80ab, 0x6132, 0xba31, 0x56b8, 0xccd1,
+    0x9117, 0x30ba, 0xbfa7, 0xdbe5, 0x43bc, 0xb6b3, 0x6c68, 0xa78f, 0xd7bf, 0x60de, 0xbbad, 0xa2d5, 0xb849, 0x73dc, 0x1f98, 0x9c2f,
+    0x4956, 0x8187, 0xc9ab, 0x4182, 0x75a2, 0x8281, 0x1cc2, 0x91d1, 0xbfe5, 0x1668, 0x6658, 0x9be5, 0xbd97, 0x4f4e, 0x18de, 0xdd9b,
+    0x7d7e, 0x6a0c, 0xe8b9, 0x827b, 0x4a02, 0xdc19, 0xb92b, 0x2286, 0xc20b, 0xde2f, 0x7c60, 0xca3b, 0xbe3f, 0x5b12, 0x763a, 0xc239,
+    0xd83b, 0x4648, 0x7cb4, 0xd00f, 0x966f, 0xdeb3, 0xc167, 0x3276, 0xcec1, 0xa3d3, 0x8055, 0x5288, 0x383c, 0x68c6, 0x161e, 0xc521,
+    0x343e, 0xa047, 0x4d84, 0x7e16, 0x30ce, 0x6832, 0x8ac9, 0x533e, 0xb941, 0x93bb, 0xd8bb, 0x38c8, 0xad97, 0xe1a1, 0x959f, 0x73b2,
+    0x9197, 0x19fa, 0x89a1, 0xa95f, 0x2020, 0x768e, 0xe58d, 0x8e19, 0x64f0, 0xa583, 0x2be6, 0x58e0, 0xdff1, 0x6068, 0x95a3, 0xda2d,
+    0x7b28, 0xd11f, 0x68f2, 0x1e34, 0x6f9a, 0x566e, 0xbffb, 0x7268, 0x2c62, 0x4e3a, 0x8177, 0xdc37, 0x9961, 0x5390, 0xe327, 0x4014,
+    0x2152, 0xc707, 0x32aa, 0x8819, 0xaddb, 0x3106, 0xca97, 0x950d, 0xe025, 0x6168, 0x77d8, 0x2c1a, 0xb2b1, 0x2036, 0xe3bd, 0xd301,
+    0x273a, 0x53bc, 0x8053, 0x2458, 0xd5b5, 0x8e7f, 0x1ada, 0x6e7e, 0x9e57, 0x7de0, 0x93c3, 0xd3f9, 0x7584, 0xc505, 0x848d, 0xa32d,
+    0x76a8, 0x547c, 0x3754, 0xa8cb, 0x47ec, 0x4d9c, 0x9b4d, 0xaea9, 0x4a22, 0x5726, 0x194c, 0xe6df, 0x7ddc, 0xbfd5, 0xad51, 0x33e4,
+    0xc771, 0x400a, 0xb03f, 0xe891, 0x1f46, 0x4f62, 0xd0e5, 0xa4ff, 0x411a, 0xe181, 0x6afc, 0x23c0, 0x9285, 0xd423, 0xb1e5, 0x6a70,
+    0x3402, 0xb561, 0x6cdc, 0x7aba, 0xe743, 0x56a6, 0x6cec, 0x45da, 0x2cf0, 0xa4cf, 0xe747, 0x8d53, 0xae09, 0x5938, 0x1618, 0x48e8,
+    0xdb47, 0x2544, 0x718c, 0xdfd7, 0x5894, 0xca63, 0x9d45, 0x35c2, 0x1b82, 0x74ea, 0xaf5b, 0x609e, 0xe595, 0xbd8d, 0x9a53, 0x4642,
+    0xd6b5, 0x1a48, 0xc901, 0x9e25, 0x4018, 0xb2a1, 0x1e94, 0xd91f, 0x989d, 0xaca5, 0xdbd5, 0x9ff5, 0x5076, 0xdc99, 0x3e86, 0x662c,
+    0xa687, 0xe473, 0x1abc, 0x8a3f, 0xd6cb, 0x4196, 0xad75, 0xd0bd, 0x72d6, 0x39d8, 0xa5eb, 0x7bf0, 0xd37f, 0xb8e7, 0x3724, 0xdd1d,
+    0xc8a1, 0x2250, 0x6f0a, 0x7e4c, 0x98fb, 0xc9d5, 0xadb3, 0x3e54, 0x896f, 0xbee3, 0x2ea2, 0xe33b, 0x38fa, 0xda8b, 0x2696, 0x7e88,
+    0x4260, 0xa9c9, 0x62f8, 0x8615, 0x578a, 0xe40b, 0x940b, 0x82d5, 0x440e, 0x2f02, 0x8f4f, 0x528e, 0xd17b, 0x4394, 0x835f, 0xdfb9,
+    0x2fd2, 0x3776, 0xa49d, 0x1d6a, 0x910d, 0xc7b9, 0x4116, 0xe96b, 0xabd7, 0x7ad8, 0xb639, 0x8c97, 0x4392, 0xe487, 0x587c, 0xb129,
+    0x46d2, 0x2fb2, 0xa431, 0xc105, 0x5a72, 0xcd59, 0x8dc1, 0x77fc, 0x5146, 0x3e8a, 0x905b, 0x3512, 0x69d2, 0xe2b9, 0x27bc, 0x8547,
+    0x744c, 0xabdf, 0x56ec, 0x62f2, 0x3640, 0x421e, 0x8a5b, 0x79cc, 0x5fa4, 0x2272, 0xb8fd, 0xdde7, 0xa0b3, 0x982f, 0x7e5c, 0x416a,
+    0x8be5, 0x6b48, 0xe4c1, 0x2680, 0xc123, 0xb931, 0x3a6e, 0xccfd, 0x8769, 0x2982, 0x69d4, 0x98e3, 0x4aba, 0x2058, 0x38e6, 0xc66f,
+    0x35f6, 0x621c, 0x8177, 0xddc1, 0x5b52, 0x9823, 0x3b50, 0x1b5c, 0x7918, 0xba77, 0x8d2b, 0x9bb1, 0x826b, 0x23d0, 0x41ae, 0x1406,
+    0x5914, 0xbda3, 0x8e1f, 0xdf8b, 0xa41f, 0x31ac, 0xdad3, 0xae3f, 0xe885, 0xce7d, 0xabb1, 0x40fc, 0x1d82, 0xb6bb, 0x36de, 0x8f15,
+    0xa3c3, 0x6c0a, 0xb109, 0x78d6, 0xdcdf, 0x4232, 0x9fbf, 0x4834, 0x2480, 0x8253, 0xb8b3, 0xd4f7, 0x530c, 0x7f4a, 0x60d6, 0x91ab,
+    0xadab, 0xb759, 0x7070, 0x9199, 0xc069, 0x6c48, 0xaaf3, 0x4924, 0xc959, 0x2996, 0xa5c7, 0x52ec, 0x1e64, 0x92af, 0x364e, 0x4eb8,
+    0xc083, 0x91bb, 0xe349, 0xa457, 0xccd3, 0x72a4, 0xdd4b, 0x3914, 0x8ab7, 0xcf8d, 0x995b, 0x8cad, 0x59ac, 0x4926, 0x99bf, 0x4c6a,
+    0x835b, 0x656c, 0x9645, 0x75c4, 0x30b4, 0x7e64, 0xe347, 0x5e8e, 0x29c0, 0x8035, 0x4980, 0x97c1, 0x6038, 0x2bd0, 0x82b9, 0x50cc,
+    0xd757, 0x4062, 0xa671, 0x1976, 0xc103, 0x8969, 0xd18f, 0xaf17, 0x7a14, 0xc50d, 0x3f00, 0x52d2, 0x723c, 0xc395, 0xe4a7, 0x68d0,
+    0x9e07, 0x5b8c, 0x9ddf, 0x887f, 0xb049, 0x2584, 0x6174, 0xc15d, 0xb439, 0x6138, 0xc65f, 0x236c, 0x8d93, 0x5010, 0x78e0, 0xc62b,
+    0x64b8, 0x8091, 0x5902, 0xad35, 0x73cc, 0xd2ff, 0x6ae4, 0x7e28, 0x28d6, 0x4152, 0x22b6, 0x6fa2, 0xbed1, 0x6470, 0xce25, 0x84e5,
+    0x296c, 0x5b90, 0x68d0, 0x79aa, 0xa7a5, 0x529a, 0x68f4, 0x1e44, 0x8449, 0x2b18, 0xc51f, 0x48c0, 0x2a0c, 0x83ed, 0x64d2, 0xabed,
+    0x4a4a, 0x526c, 0xbc3f, 0x27fe, 0xcc17, 0x549c, 0x5ae6, 0x1866, 0xb8b9, 0x9541, 0x3654, 0x7482, 0x997f, 0x8c85, 0x6a8c, 0xa2c1,
+    0xbb21, 0x7aea, 0x907b, 0x22b2, 0x9c25, 0x38f8, 0x2446, 0xbf71, 0x1a70, 0xe393, 0x8aaf, 0x5d00, 0x2ac6, 0xa719, 0x5c16, 0xca4f,
+    0xb8b9, 0x738a, 0x6d4a, 0xdebd, 0x2da8, 0x5a24, 0xa7b7, 0x4d26, 0x6ec2, 0x364e, 0xd35b, 0x29d8, 0x76ce, 0xca87, 0x30c2, 0x85e5,
+    0xcd09, 0x27c8, 0x889f, 0x2586, 0x6a52, 0x3f2a, 0x3280, 0xe627, 0x9aef, 0x5d24, 0xb9ed, 0x7980, 0x483c, 0xa87f, 0x399c, 0x5e82,
+    0x943d, 0x1bac, 0xe333, 0xa96b, 0xb63d, 0x1932, 0xb173, 0xe8e1, 0x9e11, 0xc5bb, 0x69f4, 0x4512, 0x2c74, 0xc659, 0xe4e9, 0x52e8,
+    0xbd3f, 0x78b0, 0xae0b, 0x5450, 0x50e0, 0xdecf, 0x9a43, 0x1e82, 0xc9ad, 0x7720, 0xe619, 0x5b18, 0xbd8f, 0x7670, 0x60a8, 0xaedf,
+    0xb815, 0xe7cd, 0x4356, 0xc325, 0x2aec, 0x8a45, 0xb17b, 0x53f4, 0xc399, 0x395c, 0xe133, 0x4392, 0xb45f, 0xcebf, 0xa463, 0x736e,
+    0xa9df, 0x4258, 0x92bb, 0x2f20, 0xcaf5, 0x4a7a, 0x8d1d, 0x36be, 0x5700, 0x892f, 0x29ae, 0x635c, 0x78da, 0xaa01, 0x59c8, 0xc71f,
+    0xd991, 0x4748, 0x90b5, 0x150e, 0x53be, 0x84f9, 0xb7ed, 0x755c, 0xc3a3, 0x40e4, 0x9599, 0x41f0, 0x72f6, 0xab6b, 0xc1cf, 0x3f84,
+    0x716e, 0x1d22, 0xcb63, 0x4496, 0x303a, 0xe5bd, 0x8c15, 0x5a52, 0xdaed, 0x6a92, 0xb257, 0x4a02, 0xc6bd, 0x75c2, 0xdb03, 0x4462,
+    0xd2c9, 0x2670, 0x6288, 0x73b0, 0x1d64, 0xb56f, 0x8273, 0x20a2, 0x742e, 0x6936, 0x2d9a, 0xb9dd, 0x3c34, 0xd68d, 0xcdb7, 0x2a98,
+    0xb581, 0xda4f, 0x5bb6, 0xab15, 0xbdd3, 0x4ac8, 0xa1cf, 0x6e34, 0xbd65, 0xd673, 0x87b9, 0x3c4e, 0xe681, 0xb7af, 0x41ee, 0xca43,
+    0xa833, 0x8f4d, 0x745c, 0x95a3, 0x30f0, 0x3820, 0x9123, 0x2114, 0x5804, 0xd291, 0x96c3, 0xaec5, 0x2b3e, 0x7cb0, 0xa53f, 0x3aea,
+    0xc40b, 0x4da0, 0x2eb8, 0xbdc9, 0x9741, 0x3bde, 0x83dd, 0x4b34, 0x95e1, 0xda75, 0x473e, 0x6b74, 0xa64b, 0x28ce, 0xd4c5, 0x99d1,
+    0x7bba, 0x3d4e, 0xe2f3, 0x6978, 0x1e50, 0x5742, 0x9c8f, 0x63be, 0xc7a9, 0xe98d, 0x9175, 0xb1d7, 0x838b, 0x16dc, 0x9871, 0x4630,
+    0xb88d, 0xd851, 0xaeb1, 0x3adc, 0x9511, 0xc11d, 0xe50b, 0x7f08, 0xb919, 0x614a, 0xeac7, 0x95ad, 0xa78d, 0x5aca, 0xc559, 0x99e5,
+    0x74f0, 0x89f3, 0xe989, 0x628a, 0x37e8, 0xad77, 0x935f, 0x7308, 0xcde7, 0x6b44, 0x50a6, 0xc741, 0xb541, 0x47ca, 0xcae1, 0x1a80,
+    0x5404, 0xe3b1, 0x3802, 0xce79, 0xb68d, 0x7100, 0x6196, 0xb723, 0x6aec, 0xa829, 0xcbc9, 0x37ba, 0x945d, 0xe92f, 0x6854, 0x17de,
+    0x8fff, 0x5304, 0xcfeb, 0x8ce9, 0x9a53, 0xbed3, 0x6968, 0x2d3e, 0x95e7, 0x5a9e, 0xe2bd, 0x50f6, 0xa925, 0x66fe, 0x954f, 0x6f1c,
+    0xab3d, 0xbcc7, 0x6736, 0xd79d, 0xb231, 0x98a9, 0x5fda, 0xaad1, 0x2800, 0x70ba, 0xd583, 0x1f76, 0xd9ab, 0xa201, 0xb7f9, 0xd08f,
+    0xd941, 0x4578, 0x3282, 0xc5a5, 0x79ea, 0x5710, 0x90ad, 0x4b94, 0x2334, 0x3ea4, 0x832f, 0xa9df, 0x77f0, 0x603e, 0xa64d, 0x29be,
+    0xd5d3, 0x1af8, 0x394c, 0x8471, 0x9197, 0x770c, 0x5e30, 0x3902, 0xa5c3, 0x48e6, 0x899b, 0x12ea, 0xd13b, 0x9ab9, 0xda37, 0x841b,
+    0x2144, 0x569c, 0x75ac, 0xac21, 0x4840, 0xd0b9, 0x6fda, 0xd565, 0x99d7, 0x6b9c, 0x55cc, 0x1a8e, 0x6574, 0x3cc8, 0x89c3, 0xc971,
+    0xe8d9, 0x339c, 0x546a, 0x7616, 0xaeb7, 0x659a, 0x7c8e, 0x1968, 0x6c08, 0x9adb, 0xb73b, 0xe2c7, 0xd2f5, 0x8dc5, 0x69d6, 0x21cc,
+    0x51be, 0x7fd8, 0x36a4, 0xbf65, 0x691c, 0xcfa7, 0x2ca6, 0xa987, 0x5e0e, 0xe7af, 0xa4e9, 0x2c32, 0xd131, 0x60f0, 0x34fa, 0x96ad,
+    0x50da, 0xd93d, 0x609a, 0xa5f9, 0x74a8, 0x5318, 0xccaf, 0x9725, 0x19ca, 0x8263, 0x37be, 0xe4ef, 0x8653, 0xad77, 0x6306, 0xa379,
+    0x73e8, 0xafc5, 0x4d38, 0x36ec, 0x9f21, 0x5bf4, 0x5228, 0xaa07, 0xcd19, 0xdf79, 0x47b4, 0xb00b, 0x9053, 0x22ac, 0x6e84, 0x8aa9,
+    0x724e, 0x1802, 0x36d2, 0xd00d, 0x2f3c, 0xaef5, 0x8f0d, 0x1cac, 0x54ec, 0xb465, 0x194a, 0x70a0, 0xc8d3, 0x7cee, 0x54e0, 0x684a,
+    0x1ffe, 0xe261, 0x585e, 0x4ae4, 0xcf0b, 0x6832, 0xaae7, 0xdaed, 0x2950, 0x495c, 0x68e0, 0x1f80, 0xd0e7, 0x4b40, 0x2de6, 0x8309,
+    0x1bd6, 0xe6dd, 0x8add, 0x4718, 0x68e8, 0xe1f5, 0xdc09, 0x7186, 0x9b6f, 0x1e08, 0x7aa4, 0xc47b, 0xd28b, 0x384e, 0x6724, 0x1b74,
+    0xb473, 0x9f39, 0x3862, 0xb877, 0x9255, 0xdc51, 0x388a, 0xa8c5, 0x3c46, 0x7752, 0x62f8, 0x2f98, 0xd41d, 0x51c0, 0xb123, 0x7290,
+    0x32f6, 0x8ce7, 0x4ffe, 0xdbbf, 0x241c, 0x5992, 0x470c, 0x3204, 0x9cfb, 0xc875, 0x68ac, 0x70fe, 0x226c, 0x3f68, 0xe375, 0x1a1e,
+    0x3444, 0x2f0c, 0xa8d3, 0xa10f, 0x730a, 0x472a, 0xe6d3, 0x9e25, 0x3814, 0xd89b, 0xa611, 0x1c60, 0x792a, 0x5438, 0x3aee, 0x91d3,
+    0xc697, 0x7d14, 0x431e, 0x6b0a, 0xcaa9, 0x4e78, 0xde4d, 0x930d, 0x3a0c, 0x55f6, 0xb4b3, 0x18c4, 0x7cf6, 0xbd37, 0x4512, 0x9ee7,
+    0xd6ad, 0x2792, 0xae5d, 0x4698, 0x34b6, 0xcf8d, 0x821d, 0xd95b, 0xc89f, 0x20a0, 0xb633, 0x4586, 0x8691, 0x2816, 0xb855, 0x3d08,
+    0x544e, 0xe8cb, 0x4c6a, 0x2afa, 0x81dd, 0xbc4b, 0x1de8, 0xd3f3, 0x4e00, 0xc451, 0xaf29, 0x5372, 0x91c5, 0x5ea2, 0x1e92, 0x724c,
+    0x392c, 0x7ae8, 0xadd5, 0x8c1f, 0x66be, 0xd81d, 0x3812, 0x6a02, 0xc0b7, 0xd82d, 0x8c87, 0x2310, 0xe69d, 0x48b2, 0x36dc, 0x8679,
+    0x9f27, 0x6d4e, 0xcd3d, 0xe2f5, 0x2dde, 0xb71f, 0x81cf, 0xb215, 0x5762, 0xc0b9, 0x7138, 0x34a6, 0xa5bf, 0x3f10, 0x2b9c, 0x47d6,
+    0xa1dd, 0xd1df, 0x962b, 0x212c, 0x55ac, 0xa88f, 0x7662, 0x1958, 0x4468, 0xa233, 0xd231, 0xc115, 0x999b, 0xdc73, 0x4c46, 0x5ce0,
+    0x2280, 0x8eb9, 0xbf23, 0x6dc2, 0x271a, 0xddff, 0xc0bd, 0xc3cf, 0xd7d1, 0x460c, 0x591a, 0x187a, 0x4de6, 0x3726, 0xb3e1, 0x7f46,
+    0xe0b3, 0xba65, 0x7450, 0xeb0d, 0xa7af, 0x3bfa, 0x7810, 0x94b7, 0x15b4, 0x6934, 0x7846, 0xb409, 0x92c1, 0x1eae, 0xddeb, 0x754c,
+    0xbf71, 0x84fd, 0x37b6, 0x9c85, 0xb60b, 0x22ce, 0x37c8, 0xa711, 0x43a6, 0xbe9b, 0x5bc8, 0x9f2f, 0x26ae, 0x4760, 0x13da, 0x841d,
+    0x2f42, 0xcce5, 0xe301, 0x8f79, 0xc77f, 0x2b66, 0xe41d, 0x998d, 0x4242, 0x9edf, 0x15b2, 0x74ec, 0xd447, 0x5500, 0xa5e7, 0xeaff,
+    0x49e8, 0xb89b, 0x90cb, 0x7f12, 0x508e, 0x64e2, 0xd8bb, 0x3a5e, 0x99df, 0xe8bb, 0x631e, 0xa8b3, 0x4fc8, 0x28fa, 0x9c17, 0xc363,
+    0x7b7e, 0x2df8, 0xc691, 0x9b9d, 0x7e58, 0xb581, 0x53b2, 0x777c, 0x96a1, 0x87e7, 0xe421, 0xa33b, 0x8fa7, 0xca77, 0x643c, 0xb57d,
+    0x677e, 0xba09, 0x5880, 0xcb57, 0x71aa, 0x224e, 0xa8cf, 0x2ce2, 0x557e, 0xcf51, 0x3900, 0x955b, 0x4e24, 0x8861, 0xe691, 0x5556,
+    0xc34b, 0x4f50, 0xcfcd, 0x784c, 0x42b2, 0x8ced, 0xbc41, 0x4b3e, 0x8a73, 0x9df5, 0xc105, 0x4c0e, 0xa425, 0x3ca2, 0xe82d, 0xcde3,
+    0x7df6, 0x1fc6, 0x6266, 0xc773, 0x86c3, 0x711a, 0xdab5, 0xad1b, 0x4c6e, 0x171e, 0x34f8, 0xa945, 0xd4b5, 0x7d68, 0xd1e1, 0x6a56,
+    0xb3db, 0xd997, 0x56da, 0xc029, 0x1da8, 0xcf31, 0x5aae, 0x232a, 0x7806, 0x4a90, 0x8c91, 0x2690, 0xbeeb, 0xde21, 0xa9a9, 0x8b33,
+    0x5a1c, 0x2aa4, 0xb7f5, 0x8eeb, 0x806f, 0x2b9c, 0x9e53, 0xd0f1, 0x3340, 0x779a, 0xdf85, 0x62aa, 0xca1f, 0x8a69, 0x32b0, 0x651e,
+    0x8033, 0x3a40, 0xc3d7, 0x70c2, 0x564e, 0x1d6a, 0x87f1, 0x468e, 0xa5fb, 0x81e1, 0x6d62, 0xcacf, 0xa289, 0xdeb3, 0x52b4, 0xcfb3,
+    0x1d26, 0x7804, 0x8597, 0x394e, 0xcfc3, 0x5910, 0xacab, 0x891f, 0x8f35, 0x36da, 0x2260, 0x7402, 0xcec5, 0x2fd8, 0x4e04, 0xb10d,
+    0x9241, 0x5bb0, 0xdfe3, 0x3cea, 0x1bb0, 0xcec3, 0xb301, 0x7f9a, 0xa7a9, 0x5d34, 0x4e18, 0xc751, 0x99e7, 0x6e4e, 0xc1b9, 0xd033,
+    0x6014, 0x4e36, 0xb657, 0xa921, 0x3f8c, 0x1cda, 0x94db, 0xd5c7, 0x2478, 0x98fb, 0xe265, 0xb76b, 0x80c3, 0x67aa, 0xbc8f, 0x74d0,
+    0xc55f, 0x37e8, 0x6864, 0xe31d, 0x91ed, 0xc179, 0x3900, 0xdc4d, 0xb041, 0x28a4, 0x812d, 0x7caa, 0x5998, 0xaae5, 0x2eb4, 0x7e22,
+    0xb503, 0xd30f, 0x53c6, 0xdb91, 0x9dd9, 0x45fc, 0x90af, 0x2eb6, 0xa7e5, 0x32d0, 0x864b, 0xbfb9, 0x9d6d, 0x3318, 0xd195, 0x9461,
+    0x60c0, 0x28e0, 0x9b23, 0x5334, 0x8ccf, 0x2afe, 0xc83d, 0xe195, 0x5008, 0xbd4b, 0x34ba, 0x4b48, 0xc495, 0x5292, 0x7f16, 0xb70f,
+    0x90cb, 0x2ab2, 0xc3df, 0x6d90, 0x8bf3, 0xc09d, 0x813f, 0x71b2, 0xd5f3, 0xa7b1, 0x77c0, 0xc8b3, 0x8f9d, 0xd281, 0xbfa1, 0x7954,
+    0x964d, 0x5ed8, 0x7e38, 0x43ca, 0xdb27, 0x711c, 0x355a, 0xbc83, 0x5d38, 0x80d5, 0x53d4, 0xb6ff, 0x8217, 0x3e0c, 0x61e4, 0xc28d,
+    0x3262, 0xcf43, 0x9ebb, 0x6df2, 0xdf59, 0x219c, 0xc599, 0x78e8, 0x8529, 0x2d88, 0x4406, 0xd9f5, 0x9293, 0x1dc2, 0xd963, 0xac8d,
+    0x43d2, 0x5d38, 0xb555, 0xd9e7, 0x1cb0, 0x365e, 0x8bd7, 0xc3e1, 0x47e6, 0xac9f, 0x3652, 0x58c6, 0x3e0e, 0x9d87, 0x5206, 0xd77f,
+    0x3a12, 0x7fc6, 0x239e, 0xaa23, 0x38b2, 0x92db, 0x5e20, 0xc7ef, 0xb8bb, 0x70a6, 0xaed1, 0x5ad8, 0x706c, 0xbd69, 0xaa89, 0x230e,
+    0x8af9, 0x6d14, 0x5ea2, 0x1ada, 0x95af, 0xce17, 0x7302, 0x1d48, 0xe2bf, 0x59ec, 0x16ec, 0xb8e5, 0x8ac5, 0x63da, 0x26b2, 0x588c,
+    0xa537, 0xd957, 0xb545, 0x44ce, 0xa4d3, 0x2b06, 0xc72f, 0x964f, 0x7980, 0xdbd7, 0x8747, 0xbf3b, 0x56fe, 0x32e8, 0x9e55, 0x80c1,
+    0x630a, 0x9781, 0x67ee, 0x48ec, 0xb4c5, 0x6d5a, 0x8cc3, 0xad81, 0xc393, 0x5d2e, 0xe8a1, 0x9ca5, 0x62bc, 0x752e, 0x2f32, 0xe1fb,
+    0x6c50, 0xa7c3, 0xd771, 0x192a, 0x3f74, 0xb985, 0x5ae2, 0x20d0, 0xbe2d, 0xac5f, 0x4a5c, 0x94b1, 0x31a2, 0x5258, 0xbe4f, 0xeb91,
+    0x986d, 0x23a2, 0xdd71, 0x94df, 0xaadf, 0xe2c5, 0xb727, 0x4b26, 0x28de, 0x931d, 0x3536, 0x73a0, 0x1788, 0x5cbe, 0x78ce, 0x96ad,
+    0x9ae7, 0xb269, 0xcd35, 0xa53d, 0x92ab, 0x5e2c, 0x3d68, 0x76f8, 0xe803, 0x65ea, 0x9ed1, 0x4e4c, 0xc18b, 0x8643, 0xe449, 0xace5,
+    0xc29d, 0x21aa, 0x738e, 0x99b1, 0x4d18, 0xa939, 0x4190, 0x2aae, 0xde81, 0x75e8, 0x31a6, 0xb7a9, 0x256c, 0x9e4f, 0x82ad, 0x1a1a,
+    0x3a80, 0x8eb5, 0x300a, 0x6898, 0xcbf1, 0x60c4, 0xe251, 0x53d4, 0x5d3c, 0x2f86, 0x7d2a, 0x4a76, 0x209c, 0xe3e7, 0x94d5, 0xa9eb,
+    0x5f38, 0x7e88, 0x4946, 0xb9cf, 0x275a, 0x3cce, 0x6bb8, 0x5c62, 0x8f5f, 0x6060, 0x3b06, 0xe00d, 0x185e, 0x43ce, 0xcb9b, 0xa27f,
+    0x63d6, 0x297c, 0x9543, 0x8085, 0x3772, 0x59e6, 0x70e0, 0x4f38, 0xe909, 0x7c8a, 0xc9fd, 0x94b9, 0x7972, 0xe25d, 0x4be6, 0x2108,
+    0xa389, 0x40d2, 0xcaab, 0x1cfa, 0xaced, 0x491e, 0x6be2, 0xa075, 0x41a8, 0x8b53, 0xe17d, 0xad49, 0x5f02, 0x9857, 0x37b8, 0xd469,
+    0x209c, 0x4c98, 0x790c, 0xd4b3, 0x1dd4, 0x49e0, 0xe3df, 0x6306, 0x2ba8, 0x4bca, 0x1d24, 0x6fd2, 0x36ac, 0x597a, 0xdd2b, 0x425a,
+    0x3974, 0xb8ef, 0x1c78, 0x5eb6, 0xa11b, 0xb07b, 0x58dc, 0x85c3, 0x1ec8, 0xe2e9, 0xc635, 0x99fb, 0x377e, 0xd829, 0x1e7c, 0x96cf,
+    0x4bf8, 0x5f70, 0x1dca, 0x3c18, 0xb499, 0x8c17, 0x4bfa, 0xaab9, 0xb67b, 0x59fc, 0xc917, 0x8617, 0xb241, 0x6c4e, 0xe2a9, 0x374c,
+    0x73e4, 0x906d, 0x3a78, 0x6eb6, 0x5e18, 0xe631, 0xad09, 0x1f64, 0xcfa5, 0x5f5e, 0xbd21, 0x753e, 0xbca9, 0xdfcb, 0x299e, 0x79a0,
+    0xe3fd, 0x9fd7, 0x5d60, 0xe6a3, 0xbe4b, 0x844b, 0x4208, 0x8eb5, 0x36c8, 0x7e7a, 0xdfa9, 0x217c, 0x2c64, 0xcb1b, 0x45de, 0x7620,
+    0x3a66, 0x9caf, 0xcc45, 0xe2b1, 0x52c4, 0x3e1a, 0xa359, 0x63f8, 0xda1d, 0xa851, 0x4018, 0xd901, 0x78d4, 0x9bdb, 0xb89d, 0x48c6,
+    0x8759, 0x7460, 0x4e5a, 0x7356, 0xa069, 0x539e, 0x1ec8, 0x664a, 0x4196, 0xb1bd, 0x2fc4, 0x6978, 0x9703, 0xa94b, 0x4f78, 0x249e,
+    0xb92d, 0xcfc1, 0x245a, 0x7f5c, 0x9581, 0x2f0c, 0xc917, 0x4afc, 0x68de, 0x375a, 0xbddf, 0x82a5, 0x3aec, 0xca27, 0x4d5c, 0xb1cd,
+    0x24a0, 0x9363, 0x57a6, 0x732e, 0xe207, 0xaccf, 0x7d2e, 0x4b6e, 0x997f, 0x8847, 0x1bea, 0x717a, 0xd39d, 0xad8b, 0x1d94, 0x73e0,
+    0x5d54, 0xaea9, 0x67f0, 0x306a, 0xc3b1, 0x3dee, 0x74da, 0x68ea, 0xcded, 0xebe5, 0x5b30, 0xb0d1, 0xd175, 0xa4b7, 0x37e8, 0xc105,
+    0x6a88, 0x2546, 0x4490, 0x69e6, 0x202c, 0xdbff, 0x2bc6, 0xbf3f, 0x3504, 0x96ab, 0xbe27, 0xdef3, 0x7098, 0x3ae6, 0x19d0, 0xcdc3,
+    0x6818, 0x41ac, 0xbf0d, 0xcf7d, 0x7fc8, 0xdbff, 0x63d8, 0x8c07, 0x292a, 0xa363, 0x6ac0, 0xd623, 0x3d96, 0x5690, 0xe205, 0xbb0b,
+    0xb071, 0xe567, 0x7f52, 0x5460, 0x892f, 0x9d69, 0x3f80, 0xc2a7, 0x8c9d, 0xa2db, 0xcebb, 0x614c, 0x99d9, 0xd649, 0x2312, 0x3ad2,
+    0x7a36, 0x1c88, 0xd45b, 0x7a1a, 0xa589, 0x89d3, 0xcb95, 0x9fc1, 0xc0b7, 0xd6c9, 0x52f2, 0xb929, 0x9909, 0x86c7, 0xdb93, 0x7a46,
+    0x3bac, 0x53a2, 0xaddf, 0x19f4, 0xb7e5, 0xd433, 0x8dad, 0x1a82, 0xb323, 0x62e8, 0x2620, 0x3c70, 0xac87, 0x6452, 0x82e9, 0xc3f3,
+    0x6c78, 0x88cd, 0xe0e3, 0x73d4, 0x82e5, 0xd483, 0x5c98, 0xbaeb, 0xa47d, 0x28c0, 0x6c2a, 0x82e9, 0x1a6c, 0xc813, 0x44e2, 0xa4b3,
+    0x6130, 0xe037, 0xb023, 0x4262, 0x965f, 0x5c38, 0x9df3, 0xb865, 0x8d67, 0xd6dd, 0xb6a1, 0xe70d, 0x6248, 0x9321, 0xaf77, 0x6a0c,
+    0xea2d, 0x99c5, 0xa52b, 0x2736, 0x7a36, 0x48c0, 0xd2d5, 0xa9c5, 0x393a, 0x6c38, 0x2808, 0x42e4, 0xc82b, 0xb011, 0x8489, 0xb165,
+    0x8223, 0xd91f, 0xa531, 0x8db5, 0xbf61, 0x3096, 0x6138, 0xdb37, 0x1a0e, 0x66a6, 0xa17b, 0x2866, 0x3452, 0x5ac0, 0x8af7, 0x4b8e,
+    0xbdab, 0xd533, 0x22c2, 0x9fdb, 0xc16d, 0x8a17, 0x420a, 0x5f58, 0x7f6a, 0x884f, 0x2b1e, 0xa179, 0x7aca, 0x233c, 0x8abb, 0xaa2f,
+    0xc855, 0x46a2, 0x1568, 0x8e95, 0x5172, 0xd241, 0x6ffe, 0xe84b, 0x19bc, 0x8f53, 0x52be, 0xc3c9, 0x9f23, 0x8d31, 0x5f34, 0xe343,
+    0xd10b, 0x28ec, 0x822b, 0xae53, 0x264c, 0xb1c1, 0x8269, 0x27dc, 0x9187, 0x3552, 0x7c9c, 0x5e40, 0x2c16, 0xda71, 0x404e, 0xa4e9,
+    0x1d80, 0xe075, 0x2c30, 0x35b4, 0xd76d, 0xeb25, 0x8d77, 0xc021, 0xa4c5, 0x5d84, 0xde7d, 0x49d4, 0xc205, 0x217a, 0xe8a3, 0x74d4,
+    0x40e0, 0x35a8, 0xdfe7, 0xb3cd, 0x5070, 0x6030, 0xa13f, 0xd61f, 0x1f80, 0x9137, 0xd2eb, 0x5054, 0x12d6, 0xa6cf, 0x8a6f, 0x3a06,
+    0xb8f5, 0x49bc, 0x8893, 0xc3bd, 0x655c, 0x393a, 0xb5df, 0x6a68, 0xea97, 0xc863, 0x3b56, 0xd7fd, 0x8bef, 0x9087, 0x38a6, 0xa9f5,
+    0xca95, 0x8a8d, 0x4bf6, 0x78da, 0x54b8, 0x1eb6, 0x9b17, 0xbd15, 0x384c, 0x7cda, 0xb8df, 0x4bd2, 0x2b00, 0x6e2a, 0xb045, 0x45ea,
+    0xd7e1, 0x5bc2, 0xbaa9, 0xd5a3, 0x7a54, 0xb467, 0xa007, 0xce91, 0x50aa, 0x78e0, 0x1e42, 0x5640, 0x8d83, 0xaccd, 0x7b4a, 0x5544,
+    0x2f22, 0x8877, 0xaa5f, 0x1e8e, 0x501c, 0x3324, 0x8671, 0xc60b, 0xcc6f, 0x4f9a, 0x924f, 0x90c9, 0x74e4, 0x2f36, 0x8aff, 0x4c06,
+    0x6a6e, 0x2768, 0xd655, 0xc38d, 0x17d6, 0x7926, 0xa7bd, 0x7380, 0xb559, 0x1b6e, 0x4458, 0xaae5, 0x3526, 0x7748, 0x5498, 0xc92d,
+    0xed8d, 0xb759, 0xa0c3, 0x5174, 0x6056, 0xdd63, 0x342e, 0x405a, 0x2038, 0x78d2, 0xa399, 0x3982, 0x68b6, 0x1eb6, 0x53c4, 0xbc3d,
+    0xde29, 0x9289, 0xc7dd, 0x6ebe, 0x4e34, 0xaeaf, 0xde3d, 0x3d36, 0x9701, 0x524c, 0xd727, 0x5bb4, 0xb405, 0x1ec6, 0x9b0f, 0xe045,
+    0x3978, 0x52e0, 0xbdf3, 0x5cfe, 0x2ac8, 0xe297, 0x3394, 0x16ac, 0x7b1e, 0xcba9, 0x3e56, 0xdb31, 0x8ed3, 0x6c04, 0xbe47, 0x76a2,
+    0x8817, 0x48de, 0xba63, 0x7a52, 0x325a, 0xd1f9, 0xae5d, 0x2282, 0x35ac, 0x8171, 0x460a, 0xaa5f, 0x2bf8, 0x1c8e, 0x78ae, 0x2878,
+    0xcacf, 0x6424, 0x5328, 0xd2d7, 0xb78d, 0x2adc, 0x6a42, 0x9813, 0xcd07, 0xb443, 0x8fa5, 0x5bb4, 0x762a, 0x6b36, 0x25f4, 0x40ae,
+    0xc129, 0x72f8, 0x2a08, 0xe8d3, 0x5b66, 0x6cfe, 0xcfd9, 0x4124, 0x83dd, 0x5424, 0xbddd, 0xe26d, 0x4c16, 0xa775, 0xc335, 0x13f0,
+    0x9ef1, 0xe9a7, 0x79d0, 0x31d6, 0x527e, 0x9233, 0x2dcc, 0xa553, 0xb50d, 0x3ac4, 0xd719, 0x49fa, 0x4de4, 0xc4db, 0x59e8, 0x2902,
+    0x8ef1, 0x74b0, 0xd4f9, 0x6b36, 0x2828, 0xafaf, 0x245a, 0xa523, 0x6580, 0xa681, 0x437a, 0xd595, 0x6e02, 0x52ee, 0x17ac, 0xbbe9,
+    0x974d, 0x4c3a, 0x67aa, 0x4824, 0x858f, 0x6754, 0xdf43, 0x4f38, 0xbda1, 0x6f74, 0xd1db, 0xa391, 0xad55, 0x59ee, 0xcb63, 0x682a,
+    0x790a, 0xd227, 0xbcb5, 0x9525, 0xb0d3, 0x4c52, 0x5b72, 0x3942, 0xcf17, 0x1e94, 0x9dcd, 0x811d, 0x6150, 0x891f, 0xd4a5, 0xaea1,
+    0x9b6d, 0x571c, 0x79e2, 0xc989, 0x3ce4, 0xda93, 0x2d4a, 0x7ada, 0xa5a5, 0x69fc, 0x3288, 0x70f0, 0xb0ed, 0xe0b7, 0x6b88, 0x7c58,
+    0x6876, 0xe699, 0xb203, 0x2844, 0x4976, 0x9c75, 0xd3c1, 0x1412, 0x4158, 0x5f98, 0xa163, 0x5b4e, 0xb5f1, 0x6220, 0x4e8e, 0xdc63,
+    0x2a06, 0x3826, 0xcf6f, 0xc233, 0xb067, 0xdc8f, 0x88a5, 0x4dfc, 0x9ad9, 0x19c8, 0x66b4, 0x9467, 0x8aeb, 0xd945, 0x7ec0, 0x4c9e,
+    0x1b26, 0x7fae, 0x9a71, 0x386c, 0x4226, 0x88dd, 0x6844, 0x3800, 0x878f, 0xd8c3, 0xae3f, 0x2ac2, 0x384c, 0xdb4d, 0xb633, 0x4ed4,
+    0xe057, 0x7858, 0x3c5a, 0xcf91, 0x9aad, 0xb845, 0x6a5c, 0x3bd2, 0x5b0a, 0xb249, 0x1b80, 0xe399, 0xb455, 0xcf3b, 0x65bc, 0x9dd5,
+    0x388e, 0x5752, 0x986d, 0xb20f, 0x3eb8, 0xdba3, 0x2d58, 0x42f2, 0x5c12, 0x92d9, 0xe799, 0x93e3, 0x69b8, 0xc145, 0x9291, 0x4ce2,
+    0x6390, 0x8f6d, 0x3266, 0xc139, 0x2028, 0x941b, 0xb29d, 0x6c4a, 0xe593, 0x2c6c, 0x92ab, 0xd239, 0xc57b, 0x62c0, 0xa4ab, 0x2f88,
+    0x1fac, 0x7b0a, 0x4706, 0xe4ad, 0x2ec8, 0x7486, 0x6540, 0xc67b, 0x8635, 0xcd89, 0xabbf, 0x7926, 0x38a0, 0xc28b, 0x52d0, 0x741c,
+    0xa185, 0x31a4, 0x932b, 0x405c, 0xa8c1, 0x9b0d, 0x875d, 0xb221, 0x63a2, 0x9e6f, 0x5384, 0xb92d, 0x4d86, 0x271a, 0xe753, 0x351e,
+    0xcc1b, 0x1614, 0x8f29, 0xc6b5, 0x6e5e, 0x8141, 0x45e0, 0x6c88, 0xceff, 0x9fc3, 0x54e6, 0xc2af, 0x8aa7, 0xd29f, 0xba2b, 0x7fc8,
+    0x4fbc, 0x980f, 0x751e, 0xe165, 0x3f7a, 0x8e4d, 0xe617, 0x164a, 0x4bc6, 0x7c76, 0xe3c7, 0xb767, 0x4d4e, 0xd733, 0xe589, 0x583e,
+    0x3570, 0x9425, 0x486e, 0xb7d5, 0x7fb8, 0x2652, 0x96bf, 0xafbb, 0x86d7, 0xd2df, 0x2694, 0x787c, 0x92f5, 0xd11d, 0x769e, 0x2886,
+    0x620e, 0x492a, 0x5b50, 0xb521, 0xd83d, 0x78ca, 0xd075, 0xe387, 0x566a, 0x6a56, 0x9c39, 0xd11f, 0x840d, 0xb7ff, 0x678e, 0x3c9c,
+    0xb3e5, 0x5a72, 0xca93, 0xa675, 0x3f2e, 0x8971, 0x5698, 0xc5d9, 0xd91b, 0x79e2, 0xb17f, 0x8315, 0x37d8, 0xe2b1, 0xb085, 0x703c,
+    0x3c70, 0xa641, 0xe953, 0xbdb9, 0x7c64, 0x9fc9, 0xc917, 0x43e0, 0x94fb, 0x2716, 0xe78b, 0x484e, 0x1af4, 0x8d63, 0x768e, 0x9be7,
+    0x3b9e, 0xa123, 0x5d20, 0x67a4, 0x1816, 0x7e20, 0x7aca, 0xa745, 0x5528, 0x6c80, 0xd3f9, 0xb9c9, 0x342e, 0x50f2, 0x2c40, 0x65e0,
+    0xc203, 0x8b3b, 0x268e, 0x9f49, 0x6758, 0x8f65, 0xbab1, 0x4c48, 0x9085, 0xe953, 0xc0f9, 0x475a, 0xc477, 0x28a0, 0x566e, 0xd203,
+    0xa0cf, 0x1cc6, 0x7398, 0x9727, 0xd943, 0x32f6, 0x9019, 0x6f5a, 0x9b13, 0x287a, 0xb80f, 0x7010, 0x1a20, 0x2e58, 0xc585, 0x8b2b,
+    0x6ae2, 0x94ff, 0x1f14, 0x8c93, 0x5bf4, 0x2cda, 0x6e9e, 0xd869, 0x5a2e, 0x9065, 0xdffb, 0x3fa0, 0xbbe1, 0x2638, 0x924b, 0xcdad,
+    0xabd7, 0x7674, 0xee83, 0xc535, 0x228a, 0x59bc, 0xb735, 0x1d9a, 0xa383, 0x4814, 0x70d4, 0xca07, 0x9b3f, 0x63a6, 0x1f0c, 0x9527,
+    0xac11, 0xc743, 0x835d, 0x49dc, 0x6b26, 0xe545, 0x1dd4, 0x9e79, 0xe029, 0x7d3e, 0x5b34, 0x3a48, 0x50d6, 0xbaa5, 0x22a0, 0xde23,
+    0xc705, 0x83c3, 0x2fd2, 0x4b9a, 0x6356, 0xa381, 0x7f5e, 0xcbb7, 0xd82d, 0x79f2, 0x2c46, 0xbf15, 0x465a, 0xde29, 0x3546, 0x9c07,
+    0x24de, 0x6bc8, 0x3fc8, 0xd297, 0x7ad6, 0x37a0, 0x567a, 0x8a7b, 0xafb7, 0x712c, 0x5702, 0x4214, 0x85d1, 0xe557, 0x982d, 0x6c02,
+    0xa53b, 0xcfaf, 0x6142, 0xa469, 0x8ef9, 0x218e, 0x41c8, 0xb643, 0x2c40, 0x1470, 0x6af8, 0x3eb0, 0xe295, 0x8f95, 0x40e2, 0x2306,
+    0xb59d, 0xd1bd, 0xea61, 0x20e6, 0xc3fb, 0x4fbe, 0x72b8, 0xc7db, 0x4b74, 0xe415, 0x336a, 0xbfd7, 0xa20d, 0x79b4, 0xb209, 0x53c6,
+    0xa229, 0x5e0e, 0x294c, 0x5870, 0xd465, 0x1e52, 0xb941, 0x5824, 0xeb49, 0x63c8, 0x1308, 0x75cc, 0x5192, 0xdf35, 0x5d72, 0x3ee4,
+    0xbf3d, 0x213a, 0x2e80, 0xa49b, 0x56f8, 0x8025, 0xc471, 0x7096, 0x3eb2, 0x2616, 0x9fab, 0x3388, 0x1668, 0x9bff, 0x9671, 0xb243,
+    0x861f, 0xdee3, 0x5fe4, 0x3f84, 0x9de7, 0xcc49, 0x42d2, 0x6a0c, 0xc05d, 0x3346, 0x95df, 0x6554, 0xa993, 0x35a8, 0xb83f, 0xd81f,
+    0x8fc9, 0xae9b, 0xc9f7, 0x887f, 0x19a4, 0x3ac0, 0x5c62, 0x248e, 0x8b07, 0xb9e1, 0x174a, 0x5d5c, 0x2f90, 0xe817, 0x9cff, 0xd91b,
+    0x25d0, 0x9519, 0x3db0, 0x7860, 0xbd1b, 0xe28b, 0x94b5, 0x35fe, 0x4678, 0x28f8, 0x59b4, 0x1fba, 0x901d, 0x4e2c, 0xbffd, 0x2936,
+    0x5936, 0x85dd, 0x338a, 0x1f8c, 0xd1d1, 0x3472, 0x16a6, 0x8211, 0x5c5e, 0xacdb, 0x6788, 0x89b5, 0x68ca, 0xc1bf, 0x3136, 0xda79,
+    0x4936, 0x23f6, 0x874f, 0xdc3b, 0x415e, 0xc8cd, 0xdd23, 0x2ec6, 0x8b41, 0x41fa, 0xa74b, 0x25bc, 0x78fc, 0xa98d, 0xdb49, 0x3ae2,
+    0x511a, 0xd693, 0xb641, 0x4bf2, 0x17da, 0xcd99, 0xafab, 0x39e2, 0x55a8, 0x29c4, 0x9dcb, 0x5b48, 0x8e91, 0x95fb, 0xb2d1, 0x30a8,
+    0xc73b, 0x4b50, 0x3b2a, 0xbe5b, 0x5fb2, 0x7b02, 0xcbaf, 0x51cc, 0xe311, 0x801d, 0xce95, 0x4a96, 0xe1ff, 0xa151, 0xacbb, 0x79d0,
+    0xbc5f, 0x64f8, 0xe209, 0x78cc, 0x40a6, 0xcb6d, 0x9933, 0xb661, 0x21ee, 0xcb75, 0xb165, 0x691e, 0x4a52, 0x9b75, 0x6408, 0x3a92,
+    0xb92d, 0x2684, 0x9c89, 0x66a2, 0xb0c3, 0xdcb1, 0x784a, 0xde19, 0x9e71, 0x592c, 0x8597, 0xe6f3, 0x4f56, 0x8801, 0x79bc, 0xca15,
+    0x25ba, 0x5bae, 0x9e21, 0x24c6, 0xbb4d, 0x7d0c, 0x4700, 0xab3f, 0x83e7, 0x2b72, 0xc5fb, 0xa7db, 0x68c0, 0x29d8, 0x8e09, 0x7702,
+    0x5b90, 0xa397, 0xea9b, 0xbd3f, 0x90a9, 0xcef1, 0x1f52, 0x5f4e, 0x36c4, 0x9fbf, 0x50a4, 0x612c, 0x13f0, 0x8a9d, 0xb149, 0x802f,
+    0xd521, 0xc4c9, 0x8153, 0x61f4, 0xb027, 0x9c45, 0xdf35, 0xbf01, 0x44fa, 0xc6ed, 0xa1e7, 0x1be8, 0xaa97, 0x4010, 0xc741, 0x479e,
+    0xb777, 0x58d8, 0x2ef2, 0xb38f, 0xde5d, 0xbbe9, 0x7146, 0xa329, 0x8fd9, 0x5a52, 0xc291, 0x9653, 0xac73, 0x6d08, 0xd851, 0x970b,
+    0x80d1, 0x50c4, 0x6ff6, 0x7734, 0xa0d3, 0x2df0, 0xd979, 0x4364, 0x1bc0, 0x8fcb, 0x6f16, 0x1c90, 0x6040, 0x45be, 0x860d, 0x3d44,
+    0xc331, 0x89cf, 0xe2a9, 0xa879, 0x9a85, 0x62a8, 0x8d9f, 0xa5c1, 0x81eb, 0x3046, 0x8ec5, 0xded1, 0x9e55, 0x38a6, 0x6e2a, 0x9579,
+    0xddd3, 0xb37b, 0x85c7, 0x734a, 0xc599, 0x2158, 0x60ec, 0xa961, 0xdde9, 0xc6d9, 0x6ac4, 0x8731, 0xbc39, 0x409c, 0x5b1a, 0x213a,
+    0xc8eb, 0xa99f, 0x196e, 0xbdcb, 0x60fc, 0xdc07, 0x2080, 0xa76d, 0x5474, 0x3c3c, 0xd1df, 0x5bfa, 0x42ae, 0x1472, 0x7fb8, 0x5938,
+    0x3c68, 0x7256, 0x2392, 0x654a, 0x9cdb, 0xc713, 0xae5b, 0x7dbe, 0xc76f, 0x43f6, 0x75f4, 0xa531, 0xba3d, 0x3b1a, 0x6df0, 0x1b84,
+    0x5c82, 0x8a31, 0xdeed, 0x2356, 0x5c22, 0x6d62, 0x1df6, 0x7d1e, 0x90cd, 0xbe51, 0xd2d9, 0xe0cf, 0xa743, 0x6702, 0x8b79, 0x7d6e,
+    0xd9c5, 0xbdeb, 0xc425, 0x5536, 0x958f, 0x680c, 0xb6ff, 0xe413, 0x7af4, 0xc5df, 0x3296, 0xcf97, 0x42a2, 0xadbb, 0x5138, 0x8d4f,
+    0xb8a1, 0xcdc9, 0x767a, 0x53e4, 0x9edb, 0x32b6, 0x9e09, 0xb657, 0x8b03, 0xe043, 0x6b8a, 0x4882, 0xdc25, 0xb7a9, 0x73b2, 0x94a7,
+    0x7592, 0x30d4, 0x6a10, 0xe485, 0x924b, 0x6038, 0x3126, 0x74ec, 0xcfb1, 0xb4b5, 0x83b9, 0x3436, 0xd16b, 0x73bc, 0x3f7a, 0x4232,
+    0x8633, 0x718e, 0xa1fd, 0xdacd, 0x6358, 0x1f4a, 0xb869, 0x3cc6, 0xabdf, 0x3732, 0x8f59, 0x5710, 0x91f1, 0xcf1b, 0x3ee2, 0x1d18,
+    0x51f4, 0xac5b, 0x5044, 0xa3a5, 0xc51d, 0x5068, 0x3212, 0x77b2, 0x3912, 0x84d9, 0x50d2, 0x279e, 0xce4d, 0x61b0, 0xe19b, 0x8a59,
+    0x4bc2, 0x679c, 0x3eb0, 0x483c, 0x85bb, 0x8fed, 0x3fb6, 0x38e0, 0xcc21, 0x29ba, 0xbb15, 0x3fbe, 0x2266, 0xd3f5, 0xbb0b, 0x458e,
+    0x2da4, 0x6fec, 0xdb3f, 0xaf4f, 0x402c, 0x90af, 0xca25, 0x6054, 0x356c, 0x6550, 0x916b, 0xdb3f, 0x4698, 0x8647, 0xb72f, 0x3ff0,
+    0xcc03, 0x1a80, 0x681c, 0x7b76, 0x31a4, 0x5bda, 0xa485, 0xc061, 0x8815, 0xb791, 0xdb2f, 0x9f07, 0xab89, 0xcd83, 0x3b8e, 0x5838,
+    0x54a0, 0xa473, 0x1f78, 0xe493, 0x69e2, 0x25f4, 0x6ed4, 0x1b0a, 0x581e, 0x3802, 0xe4d7, 0x86d9, 0x67e2, 0x27ba, 0x99cd, 0x152e,
+    0x87b3, 0xe033, 0x286c, 0x712e, 0x5546, 0x4170, 0xceff, 0x57fc, 0xe4a5, 0x8035, 0xd489, 0x4a1c, 0x27ae, 0x7758, 0xb86d, 0x6132,
+    0x1448, 0xbbdd, 0x66d6, 0x3758, 0xb1d9, 0x5368, 0x804d, 0xbc6f, 0xa1d3, 0xafbd, 0xd871, 0x8537, 0xe579, 0xcadd, 0x29f0, 0xd2fd,
+    0x769a, 0xada7, 0x44de, 0x45a8, 0x34ec, 0xdb39, 0x3d94, 0x236c, 0xb91b, 0xcbd9, 0x4372, 0xb169, 0x2ace, 0x5dbc, 0xab3d, 0x18ee,
+    0x54b8, 0x7794, 0x42da, 0xe453, 0x9bb9, 0x4c94, 0xafab, 0x3ac4, 0x84ff, 0x5af2, 0x92af, 0xe8fd, 0x75a0, 0xab5d, 0x7c12, 0x4c0a,
+    0x3056, 0x8577, 0x75f6, 0xad31, 0x3100, 0x7c44, 0x8721, 0xe62b, 0x75aa, 0x9cb9, 0x8ba3, 0xbfd3, 0xeec5, 0x7020, 0x9d33, 0xe28b,
+    0xc081, 0x99c5, 0x3692, 0xe1bb, 0xc0a1, 0x702c, 0x8db1, 0x4ba8, 0x2dee, 0xb141, 0xe0bd, 0x55ba, 0x8e67, 0x47e2, 0xa11d, 0xd317,
+    0x42e2, 0xb9ab, 0x5896, 0x8f35, 0xaf47, 0x464a, 0xccbb, 0xec97, 0xadeb, 0x689a, 0x54ec, 0x79a8, 0x2aa8, 0xc375, 0x3d24, 0xcc3b,
+    0x20c6, 0x94cf, 0x4278, 0x805d, 0xa7d9, 0x5156, 0xd0b1, 0x3e3a, 0x2496, 0xa1c1, 0x550a, 0x7d6c, 0xa355, 0xe485, 0x188c, 0xc2e5,
+    0x67e6, 0x2a04, 0xae89, 0x8f0b, 0xc1fb, 0x5fa6, 0x646a, 0x47ac, 0x5224, 0x1910, 0xc22f, 0x8879, 0x9715, 0x191c, 0x436c, 0xc731,
+    0x2814, 0x9937, 0xb4ad, 0x453a, 0x776a, 0xc241, 0xa0f9, 0xdd39, 0x1c8a, 0x6d28, 0xc5e9, 0x4a58, 0x227a, 0xa64f, 0xe473, 0x8f2f,
+    0xb2ab, 0xdf8d, 0x316c, 0x85cb, 0x47be, 0xa7df, 0x97bf, 0x6a4c, 0x6698, 0xd1c9, 0x24bc, 0x651c, 0xb1a7, 0x2afe, 0x5dfa, 0xdf25,
+    0x902b, 0x368a, 0xd075, 0x2b80, 0x8463, 0x6218, 0xa603, 0xbd5b, 0x5de8, 0xec31, 0xc19b, 0x9dbf, 0x7bea, 0xb1cf, 0x356e, 0x7a0e,
+    0xb69f, 0xe243, 0xd0eb, 0x3268, 0xbdc3, 0x232e, 0xa2bb, 0xb363, 0x7bee, 0x4e80, 0xb3f7, 0x9037, 0x9e69, 0x7798, 0x54d4, 0xa911,
+    0x986b, 0xe9a3, 0x5402, 0x8133, 0x2d7e, 0xa375, 0x2bf8, 0xbbbb, 0xdecf, 0x9841, 0x1bb4, 0xb285, 0x5e06, 0xe1dd, 0xa007, 0x6150,
+    0x4ed6, 0xa2d1, 0x2c7c, 0xc0e7, 0x457c, 0xdc63, 0x27d2, 0x6bce, 0x49d0, 0x397e, 0x2184, 0x7eb6, 0x5394, 0x6c86, 0x1c52, 0x9fa3,
+    0xdb51, 0x3a58, 0x8a7d, 0xca9d, 0x486a, 0x9d6f, 0x531e, 0xd1d9, 0x982b, 0x7ee8, 0xbb6d, 0x5516, 0xd97b, 0x7ec2, 0xd259, 0x5c26,
+    0x6db8, 0x9a8f, 0xbce5, 0x8399, 0x168a, 0x98db, 0x8533, 0x1cf0, 0x3852, 0xabbd, 0x4370, 0x1dba, 0xbf3b, 0x55d6, 0x3b34, 0xdea9,
+    0x3e9a, 0xa341, 0xdda3, 0x94c9, 0xcdf7, 0x2692, 0xd351, 0x689a, 0x789c, 0x36fe, 0x5a24, 0x39c0, 0x9b21, 0xb215, 0x7388, 0x4e20,
+    0x9229, 0x1d98, 0xb701, 0x7e42, 0xacad, 0x7434, 0xc48b, 0xa463, 0x5e92, 0x4b12, 0x6b68, 0x8c63, 0xc535, 0x84d3, 0xe90f, 0x932f,
+    0xc2cd, 0x67bc, 0x2cc6, 0xb8cf, 0x20c2, 0xcbfb, 0x7dd6, 0x9c11, 0x2e7c, 0xb6f1, 0x1e82, 0x423a, 0x2808, 0xd19b, 0xe99f, 0xbea9,
+    0x983b, 0x4f4c, 0xdf49, 0x5c76, 0x8da9, 0xba57, 0x4dd2, 0x2fd8, 0xade1, 0x1e74, 0x8a03, 0x28fc, 0xcb51, 0xa839, 0x45ea, 0x6008,
+    0x21b6, 0xd21d, 0xa473, 0x47f8, 0x5368, 0x15e0, 0x3876, 0xe5ed, 0x6008, 0x9d37, 0x66cc, 0x2320, 0xc30f, 0x7f00, 0x58da, 0xb769,
+    0x85a1, 0x318a, 0xce27, 0x6b04, 0xdaa7, 0x3272, 0x9d91, 0x6702, 0x36a8, 0x2162, 0x9abb, 0x4104, 0x6fd0, 0xaffd, 0x5804, 0xa4e5,
+    0x4a8e, 0x676a, 0x64f0, 0xdf59, 0x312a, 0x9447, 0x6336, 0x6d8e, 0x9445, 0x516e, 0xd5c1, 0x20ea, 0xb9bb, 0x64bc, 0x4132, 0x7a2a,
+    0x992f, 0x3a08, 0xe195, 0x1ed2, 0x79c0, 0xcfaf, 0x25fa, 0xdf87, 0xa865, 0x6d42, 0xd185, 0x33b6, 0x4eb0, 0x6036, 0xbc5f, 0x8bdf,
+    0xdc45, 0x630a, 0xd5f9, 0x85b1, 0x1ba4, 0x553e, 0xa313, 0x8605, 0x4156, 0x8ef9, 0x5886, 0xe185, 0xb2c1, 0x7aa8, 0x5b14, 0x1706,
+    0x5fd8, 0xc1c5, 0x226e, 0x581e, 0xcd9d, 0xe6bf, 0x2a40, 0x53b6, 0xb8f7, 0x8cf5, 0xa577, 0x3c96, 0xc315, 0x4f04, 0x7344, 0x9bfd,
+    0xcea1, 0x7ad6, 0x7066, 0x9b45, 0xac91, 0x1bc6, 0xe3e3, 0x8e01, 0x2d48, 0x682c, 0x19d4, 0x8059, 0x3634, 0x69d8, 0xc509, 0x2336,
+    0x9831, 0x5eb0, 0x8eb3, 0xa947, 0x7e20, 0x63c2, 0xc989, 0x56b2, 0x8475, 0x1596, 0xddc3, 0x64d2, 0x3600, 0xda75, 0x1d4e, 0x61c0,
+    0xbc07, 0x7b6a, 0x1776, 0xc7e3, 0x659a, 0xe415, 0x6afa, 0x4dd4, 0xb5df, 0x57d2, 0x394c, 0xce53, 0x7fd0, 0x22f0, 0x2d9e, 0xbe39,
+    0xd135, 0x8c49, 0x952f, 0xdfcf, 0x6368, 0xa7df, 0x7ac6, 0x9e09, 0xe613, 0xc9df, 0x77a2, 0xd32b, 0x356a, 0xe80d, 0x9741, 0xc799,
+    0x7488, 0x7c18, 0x5dea, 0x2fd6, 0xb71d, 0x882d, 0xc1db, 0x903f, 0x308c, 0xa619, 0x4a46, 0x214e, 0xa773, 0xbef7, 0x5168, 0xb053,
+    0xd7bb, 0x39bc, 0x48c2, 0xcdd1, 0xae1d, 0xe1cf, 0x4da6, 0xc577, 0xa7bf, 0x6804, 0x8ba9, 0xdc21, 0xa765, 0x8fd1, 0xcf87, 0xafed,
+    0x7400, 0x2b10, 0x568a, 0xb3a3, 0x48e4, 0x82b3, 0x9753, 0x4d92, 0x2880, 0xc9fd, 0xbc6d, 0x4a08, 0x6722, 0x1ba8, 0x9b65, 0x654c,
+    0xca9b, 0x2886, 0x5b0e, 0xd07f, 0x8f09, 0x23dc, 0x542c, 0xd7b7, 0x840f, 0x9a35, 0xdfa3, 0x211a, 0x55c0, 0x435e, 0x3706, 0xb401,
+    0x29b2, 0xda23, 0xa8b3, 0x5bb6, 0x90e7, 0x7086, 0x3e20, 0xe0e3, 0x62c0, 0xd733, 0x80c1, 0xb2ef, 0x59d0, 0x4d24, 0x8ddb, 0x3b34,
+    0x6b82, 0xcfd7, 0x2d2c, 0xbff9, 0x413c, 0x68dc, 0xd3f5, 0x952f, 0x6800, 0xd2b1, 0x79fa, 0x46b8, 0x3bb6, 0x8985, 0x2952, 0xb16b,
+    0x75f8, 0x52d4, 0x6d60, 0x81ef, 0xdaf5, 0x7f0e, 0xa0c9, 0xc087, 0xd1dd, 0x8291, 0x4640, 0xcf01, 0x39c6, 0xb519, 0x27da, 0xdf79,
+    0x3846, 0x744a, 0xa1eb, 0x18cc, 0xb493, 0x8535, 0x535c, 0xc4ad, 0x777e, 0xb791, 0xe85f, 0x958b, 0xd6d9, 0x1956, 0x7f44, 0xf001,
+    0xa8f9, 0x3432, 0xbd75, 0x91c9, 0xc479, 0x2352, 0xbd99, 0x8a27, 0xcf9b, 0xb77d, 0x8edb, 0x3706, 0x6f06, 0x97b3, 0xabe7, 0x3690,
+    0xdbb3, 0x6a8c, 0x5d2a, 0xaf0f, 0x4ad4, 0x385e, 0x88db, 0xcb17, 0x8275, 0x359c, 0x9ed7, 0xb3cb, 0x7782, 0xe6cf, 0xaec3, 0x318a,
+    0x5332, 0x6e94, 0xa933, 0x37f0, 0x6dd4, 0xd8e5, 0x2a98, 0x648a, 0xba85, 0xac8b, 0x2aac, 0x9aef, 0x64f4, 0x3220, 0xbb25, 0xca53,
+    0x3b0c, 0x7e9a, 0x953f, 0xb20f, 0x7798, 0x37b8, 0x7cec, 0xd001, 0x1b10, 0x4a2a, 0xe9b5, 0x7c72, 0xa06f, 0xdd7b, 0xb651, 0x39e4,
+    0xa355, 0x1ca6, 0x5a58, 0xd1d3, 0x3e12, 0x521a, 0xc025, 0x4b60, 0xd209, 0x99bb, 0xae8b, 0x4d94, 0xdcbf, 0x93bd, 0xa68d, 0x524e,
+    0x727c, 0x344a, 0x15d0, 0xbc21, 0xdde9, 0x3a8e, 0x5cb6, 0xe8e9, 0xa019, 0x6a0c, 0xc967, 0x451c, 0x7c00, 0xa013, 0xc43b, 0x89c9,
+    0x2e26, 0x44e0, 0x97d1, 0xb87d, 0x5866, 0x9aaf, 0x22c6, 0x80f5, 0x8041, 0xe699, 0x2e22, 0x7576, 0xc1a3, 0xa58b, 0x53ba, 0x6f26,
+    0x783e, 0x20a4, 0x561a, 0xb153, 0x327e, 0xc66f, 0x55ee, 0xb049, 0x2fc4, 0x5d4e, 0x8b0b, 0xa307, 0x4ee6, 0xba4b, 0x8595, 0x45aa,
+    0x2686, 0xb993, 0x5836, 0x93cf, 0xdb8b, 0x59c6, 0x34d2, 0x56d4, 0xdd57, 0x7216, 0xcc85, 0x8be5, 0x740a, 0x3d5c, 0x2ed0, 0x893d,
+    0x2874, 0x735a, 0xa6c9, 0x644e, 0x3036, 0x71fc, 0x5c6c, 0x7b1a, 0x9a45, 0x2a9a, 0xbb35, 0x61e4, 0x6ed2, 0x2bb4, 0x47ce, 0x65a2,
+    0x8859, 0xcb13, 0x9417, 0x1bb0, 0x5f32, 0xa6a5, 0x437a, 0xe333, 0xb51b, 0x73fa, 0x924b, 0x3062, 0xd25d, 0xbe11, 0x37dc, 0xe559,
+    0x9587, 0x7f1e, 0x9bc7, 0x68b4, 0xdc01, 0x960b, 0x424c, 0x7384, 0x1a70, 0x3488, 0xb623, 0x7c56, 0xbe55, 0xd6b7, 0x9f1f, 0x741a,
+    0x4620, 0x9cf1, 0x7ef8, 0x344e, 0xe95d, 0x8443, 0x270c, 0xaddd, 0x4d4c, 0x6a62, 0x98e7, 0xca2d, 0xab67, 0x7f12, 0x1446, 0xad1d,
+    0x5d14, 0x7f86, 0xa261, 0x6800, 0x9ddd, 0x1c5a, 0x7fe0, 0x3858, 0xbbd7, 0x4fae, 0xa75b, 0x6764, 0xbc03, 0xdb3b, 0x743c, 0xcd95,
+    0x3896, 0x8ad7, 0xb805, 0x255e, 0xae09, 0xcd83, 0x6080, 0x274e, 0x69d8, 0x1ca4, 0x8e09, 0xaecb, 0x7166, 0xe725, 0x99e9, 0x6b10,
+    0xc61f, 0xc023, 0x5c1a, 0x72c4, 0x44d4, 0x6cec, 0x266e, 0x912d, 0x19ca, 0x483c, 0x8443, 0x3010, 0xc175, 0x6192, 0x41d8, 0x8e01,
+    0x2a56, 0xcf55, 0x780a, 0x3564, 0x4872, 0x761e, 0xe881, 0x34a0, 0x13b0, 0x6120, 0x5e60, 0xc541, 0x31ba, 0xdb65, 0x51e6, 0x8afb,
+    0xd1f3, 0x421a, 0x9dfb, 0x8801, 0xcc5b, 0xacc1, 0x96a1, 0x5358, 0xaf51, 0x2ac8, 0x640e, 0xd1a9, 0x1ffa, 0x418e, 0x8be5, 0x6cd6,
+    0xc37d, 0x170e, 0x4398, 0x99b7, 0xc81d, 0xbba5, 0x4c28, 0xe309, 0x3b10, 0x767e, 0xd34f, 0x838f, 0x410c, 0xc5f1, 0x9827, 0x4fe8,
+    0xa0d5, 0xe303, 0x49ea, 0x1ce0, 0x8c3f, 0x5ebe, 0xb67b, 0xa475, 0x8e1b, 0xc6cf, 0x6bbc, 0x4bf6, 0x1d82, 0x8135, 0x2532, 0x630c,
+    0x494c, 0xb8b1, 0x5088, 0xe6e1, 0x94df, 0x77b0, 0x282e, 0x6a7c, 0xaa1f, 0x3d1e, 0xc435, 0x5bb0, 0xbaa7, 0x414e, 0x1c42, 0xe277,
+    0xc6db, 0xd7c1, 0x8265, 0x521e, 0x4d96, 0x91b7, 0x1e30, 0x7ef0, 0x2ff0, 0x3ef0, 0xcf09, 0x21da, 0xb5bd, 0x5092, 0x3ef4, 0xdfcd,
+    0xa77b, 0xcddf, 0x7776, 0x3942, 0x7e9a, 0xd7ab, 0xbe7b, 0x3bfc, 0x5f3a, 0xa5bd, 0x935d, 0x6536, 0x36b8, 0x8a4b, 0xe17b, 0x9b11,
+    0x3af2, 0xe22b, 0x5074, 0x765a, 0x7b54, 0x42d6, 0x8d7b, 0x1ebc, 0x6388, 0xad0d, 0x3f9e, 0x1812, 0xbe97, 0x62d8, 0x28bc, 0xadc5,
+    0xd3bd, 0xa78d, 0xdecd, 0x4030, 0x6bc6, 0x1dfc, 0xa639, 0x790e, 0xb2e9, 0x3b36, 0x5d48, 0x185e, 0xe295, 0x86e9, 0xb487, 0x9f79,
+    0xc4bf, 0x600e, 0xe61b, 0x5290, 0x8db3, 0xcb87, 0xaeb7, 0x293e, 0xdd8f, 0x53f8, 0xcff1, 0x354c, 0x8385, 0xb38f, 0xc011, 0x2106,
+    0x5c26, 0xe47d, 0x3a8c, 0x6998, 0xdbb7, 0x7a64, 0xb7bd, 0x1c88, 0x8341, 0x4ade, 0xa45d, 0xe207, 0x7de4, 0x8937, 0x505e, 0x3ec4,
+    0xaa85, 0xdb3d, 0x4540, 0x303a, 0x179e, 0xb2f5, 0xc279, 0x6bf4, 0xe8f3, 0xa74b, 0x575e, 0x8cf3, 0x2978, 0x6d68, 0xa351, 0x5a26,
+    0x3c88, 0xd0b7, 0x6912, 0x46c8, 0xb5b1, 0x5472, 0xbb6b, 0xce3d, 0x8bfb, 0x1a18, 0x340a, 0x30f0, 0xe047, 0x6672, 0x26c0, 0xdf81,
+    0xc28b, 0x43cc, 0x29ee, 0x8485, 0xdfbf, 0xb21b, 0xca03, 0x5708, 0x8f7f, 0xdceb, 0x3790, 0x8045, 0x9525, 0x1eb2, 0x4e6e, 0xa8bf,
+    0xdd6f, 0x40c8, 0xc525, 0x5b62, 0x2f2c, 0x909b, 0x4ff2, 0x85a3, 0x40b4, 0xd4c9, 0x5976, 0xbdd3, 0x5e14, 0x3cc6, 0x8665, 0x4fc2,
+    0x1ff2, 0xe7d9, 0x9b53, 0x3800, 0xe02d, 0xc227, 0xa85d, 0xea27, 0xd0e5, 0xae33, 0x6288, 0x4ad6, 0xa8bb, 0xcbe3, 0x38ba, 0x7744,
+    0xb4e7, 0x558a, 0x950d, 0xacad, 0xb3bd, 0x56de, 0x6e4e, 0xa955, 0x433c, 0x8303, 0xe23f, 0xb5b3, 0x9745, 0x6aee, 0x1fe0, 0xb781,
+    0xa93f, 0x1a1e, 0xc279, 0x639e, 0x29a8, 0x741e, 0x64bc, 0x207c, 0x4392, 0xe291, 0x92df, 0x4a98, 0x8053, 0xbffb, 0x2a8a, 0x9c77,
+    0xe01b, 0xb151, 0x8a05, 0xd4a9, 0x25d4, 0x660e, 0x7efe, 0x92bd, 0xc787, 0x3ef8, 0x9f0b, 0x1e12, 0x5d86, 0xecbd, 0x714a, 0x205a,
+    0x821b, 0x6c00, 0xa9cd, 0xd69d, 0xc8a1, 0x4d60, 0xdf99, 0x3d32, 0x2856, 0x79c6, 0xb015, 0x3ae8, 0xcc8f, 0x917d, 0x5dc6, 0xe687,
+    0xd9f7, 0xa4a5, 0x6bf2, 0x3218, 0xb43b, 0xa425, 0xdcdd, 0x5028, 0x866f, 0x5fc2, 0x213c, 0x7c5a, 0x73ae, 0xd03d, 0x5bb4, 0x8897,
+    0x46ca, 0x6890, 0xa3ff, 0x2872, 0xb121, 0x9245, 0xd0df, 0xc4b1, 0xb13b, 0x93d9, 0xabb9, 0x5efc, 0xd873, 0x91a9, 0x73e6, 0x1f50,
+    0x65b0, 0x53aa, 0xd993, 0xa851, 0x1b6c, 0x4508, 0x6a00, 0xb109, 0xc4e7, 0x1bca, 0xd3f1, 0xb8cb, 0x4c52, 0x19fa, 0xc7f7, 0xae23,
+    0x2b36, 0xbf05, 0xa7bd, 0xd201, 0x1b82, 0xbc27, 0xe41b, 0x7812, 0xd5f9, 0xcc27, 0x96a7, 0x6a1c, 0xe78b, 0x7d58, 0x3552, 0x59cc,
+    0x6718, 0x13be, 0x4da8, 0xaa83, 0x8931, 0xd3ff, 0xec81, 0x45be, 0x2360, 0x8133, 0xc3ef, 0x92af, 0x5e1c, 0xc6ab, 0x66b0, 0x1812,
+    0x6fc2, 0xba95, 0x2f9e, 0x7c9a, 0x239e, 0xd8c9, 0x3e48, 0x87ff, 0x4a50, 0x6bda, 0xaab3, 0x19fc, 0xe28b, 0x582c, 0x991b, 0xd163,
+    0xadf1, 0x4930, 0xad95, 0x87d3, 0xc963, 0x3064, 0x5672, 0x966d, 0x7066, 0xd117, 0x20dc, 0x5c6c, 0x42b2, 0x98d3, 0xb99b, 0x6bd2,
+    0x1fa0, 0xbbdd, 0x69ba, 0xc49d, 0x8071, 0x4f00, 0x9e59, 0x2c1e, 0xca7d, 0x6662, 0xcb1f, 0x73ba, 0x3e1a, 0xe155, 0x1e64, 0x8347,
+    0xe255, 0xae85, 0x193e, 0xc349, 0xa123, 0x1c30, 0x6524, 0x35c4, 0x9f51, 0xe5ed, 0x773e, 0x5324, 0xbb99, 0x7e8c, 0x9a69, 0x909f,
+    0x7282, 0xd27b, 0x92d5, 0x399c, 0x75d8, 0x44aa, 0x2a98, 0x97d1, 0x6dd4, 0x20b2, 0xa0ad, 0xd059, 0x6040, 0xbf09, 0x464a, 0x807b,
+    0x66be, 0x103a, 0x9d7d, 0xe791, 0x769e, 0x4132, 0xdd65, 0xbec3, 0xc62b, 0x8497, 0xa839, 0x3540, 0x6fb6, 0x1520, 0xd321, 0xa6e1,
+    0x69a4, 0x482a, 0x63fc, 0x8767, 0xce33, 0x4bae, 0x6696, 0x5a76, 0x33d2, 0x7b6c, 0xdcc1, 0x6846, 0x2942, 0x9a6b, 0xdf91, 0x6ffe,
+    0xc2e1, 0x3d9a, 0x63ba, 0xd9ef, 0x3048, 0x8e63, 0x9e99, 0xde9d, 0xc435, 0x9735, 0x250c, 0x77ca, 0x4122, 0xc27d, 0x7aa0, 0x5f00,
+    0x7678, 0x2252, 0x9493, 0xdacf, 0x437a, 0xe615, 0xc2a5, 0xd48f, 0x7bf0, 0xad67, 0xca03, 0x58ae, 0xa83b, 0xde07, 0x62e4, 0x7e74,
+    0x48b8, 0x2bc8, 0x5f78, 0x7fe6, 0x4f22, 0x9b8b, 0xb0ed, 0x14b8, 0x5a46, 0x6bc2, 0x5822, 0xd9e9, 0xafc1, 0x8c3b, 0x39e4, 0xd12f,
+    0xb335, 0x417a, 0x5750, 0x343a, 0x6a7c, 0x1f20, 0x8623, 0x56d6, 0x69ba, 0xa991, 0x26ea, 0xdbc1, 0xa8e9, 0x44ce, 0xab1d, 0x7aa8,
+    0x8ac9, 0x550e, 0x2010, 0x81ab, 0x4102, 0x6328, 0xc4c7, 0x355c, 0xbc95, 0xd6e1, 0xa38b, 0xe301, 0x3130, 0x95bd, 0x2b48, 0x9eab,
+    0xafff, 0x3378, 0xccbb, 0x8285, 0xe48f, 0x6cf6, 0x45a4, 0x5f82, 0x267e, 0x535c, 0x8097, 0x6ef6, 0x3106, 0xab05, 0xc149, 0x5eee,
+    0xb42f, 0x8def, 0x2d9e, 0x5da4, 0x916d, 0xe2fb, 0x5050, 0x96b3, 0x309c, 0x7544, 0x4b86, 0xa1dd, 0xe575, 0x6b52, 0x45a6, 0x5b80,
+    0x6690, 0x7b82, 0x497a, 0x986d, 0x5e28, 0x6a18, 0xa835, 0x4498, 0x3378, 0x83c7, 0x4c9e, 0x2868, 0xd323, 0xa1e3, 0xaa03, 0xdb8b,
+    0x8b47, 0x8e29, 0xc977, 0x7b46, 0x2358, 0x984f, 0x6c04, 0x8fe5, 0xc9a9, 0xa511, 0xda35, 0x3b50, 0xa629, 0x3180, 0xdcbb, 0x4440,
+    0x8595, 0xd381, 0xa835, 0x47be, 0x9b55, 0x7abc, 0x52d8, 0xc34b, 0xd439, 0x8757, 0x9c13, 0xc473, 0x4826, 0xa053, 0x5f54, 0x2b96,
+    0x7ab0, 0x889b, 0x544c, 0x9a43, 0x2a74, 0x897d, 0xdf85, 0x65da, 0xc05b, 0x3a22, 0x7d06, 0xaf65, 0xc631, 0x2680, 0xe07f, 0x6568,
+    0x45dc, 0x9967, 0x280a, 0xad07, 0xe611, 0x5b32, 0x90f9, 0x3926, 0x84e5, 0x4308, 0x23b0, 0x9d93, 0xb1ad, 0xc81f, 0x442c, 0x938d,
+    0xb8f1, 0x2ac2, 0x5af6, 0x8e99, 0xd473, 0x74c2, 0xdcfb, 0x7b5e, 0x4b2e, 0xb765, 0xd1c5, 0x8bf5, 0x4452, 0xc713, 0x3c80, 0x49ee,
+    0x1c62, 0xb4ef, 0x5d54, 0xe513, 0xbf4b, 0x6098, 0xd803, 0x849b, 0xc0c5, 0x51ea, 0xb13b, 0x2ae4, 0x3a4e, 0xea67, 0xacd1, 0x96d3,
+    0xd5ed, 0x6954, 0x50e2, 0x8fe9, 0xcb1d, 0x2224, 0x6bce, 0xa529, 0x5590, 0x2300, 0x68da, 0xdeef, 0x4fda, 0x8e73, 0xb3c5, 0x2ccc,
+    0x83f1, 0x9237, 0xd599, 0x2620, 0xa6e9, 0x182e, 0x833b, 0x9743, 0x2906, 0xc169, 0x9fb5, 0x3ffa, 0xb859, 0x7e2a, 0x595c, 0xa1b9,
+    0x2022, 0x8541, 0xcd05, 0x1dda, 0x791c, 0xc7b3, 0x39ac, 0x22e8, 0x4fe0, 0x6d72, 0x2eac, 0xd36b, 0x4f04, 0xa5e5, 0x3608, 0xd45f,
+    0xe793, 0x6ac2, 0x5172, 0x895f, 0x9e27, 0x1c08, 0x55fe, 0x9bc1, 0x86a1, 0x19d8, 0x69a2, 0x327e, 0xb2e9, 0x19d6, 0x556c, 0xcbf3,
+    0x3f52, 0x9f73, 0xc173, 0xe3ab, 0x3d3a, 0x2fb0, 0xd857, 0x4510, 0x9b2d, 0xb565, 0xc163, 0x812f, 0x2846, 0x475c, 0xa46b, 0x581c,
+    0x2c68, 0xca97, 0x888b, 0xb9f9, 0x9d51, 0xa345, 0xc25d, 0xd3ab, 0xdb5f, 0x9d9f, 0x3f20, 0x8449, 0x710a, 0xb765, 0x4dc4, 0x0eae,
+    0x320c, 0xb86d, 0xcef1, 0xe56b, 0x6ab6, 0xabb3, 0x1a7c, 0x8f13, 0x7c00, 0x2482, 0x4080, 0x909f, 0x5100, 0xad8d, 0xc453, 0x7f28,
+    0x4880, 0x8f13, 0x6100, 0xbfc9, 0x21f2, 0x31aa, 0xa8a3, 0x7a40, 0xe39f, 0xd445, 0x3dfe, 0x9e71, 0xe28b, 0x43f4, 0x362a, 0xd3d5,
+    0x892f, 0x3c58, 0xbd07, 0x7d52, 0xc907, 0xa3e3, 0x331a, 0x7b50, 0xdb43, 0x5b18, 0xbac1, 0x61a4, 0x86cd, 0x2b32, 0xcaf3, 0x9851,
+    0xd4db, 0x2a82, 0xbdaf, 0x3c6e, 0xdf3f, 0x27c0, 0x563e, 0x8a21, 0xa01b, 0xe861, 0x4160, 0xb119, 0x8ce3, 0x4210, 0x1e7a, 0x7a6e,
+    0xbe65, 0x2ebc, 0x585e, 0xb855, 0x3bf6, 0x358a, 0xb80b, 0x4e4c, 0x70f4, 0x2e22, 0x46b0, 0x677e, 0x8647, 0x795a, 0xa2f7, 0x3bd4,
+    0x95af, 0x2ece, 0x6868, 0xd57b, 0xbaa1, 0x6b76, 0x1b68, 0x9e2f, 0x3232, 0x5d66, 0x23c6, 0x5986, 0x6d76, 0x8af1, 0x38ba, 0xdcfb,
+    0x6e16, 0x1d82, 0xd817, 0x62a6, 0xb0e5, 0x492c, 0x7bf0, 0xb113, 0x4252, 0x9207, 0xbee1, 0x5542, 0x65ec, 0x2a9c, 0x985b, 0xc18b,
+    0x84c9, 0xddc7, 0x5700, 0x88ed, 0x762c, 0x2186, 0xda4f, 0xaad1, 0x7f56, 0xbb0b, 0xdecb, 0x8aa9, 0x5e48, 0x7ef0, 0x2f9e, 0xca97,
+    0x56dc, 0x77f2, 0xa225, 0x3c6e, 0x4e98, 0x2dcc, 0xa7d7, 0x584c, 0xb835, 0x6104, 0x2ad8, 0xa141, 0x1cd2, 0x5e96, 0xb21d, 0xe3cb,
+    0x6066, 0x883f, 0x9db3, 0x1cb4, 0x6b7a, 0x8b85, 0x3830, 0xa44f, 0x409c, 0xd51d, 0x6b9e, 0x8bd3, 0x792a, 0x6a78, 0x2186, 0x343e,
+    0xb87d, 0x30be, 0xafcb, 0xa96f, 0x3bf2, 0xb759, 0x960d, 0x7bb2, 0x3058, 0xce09, 0x98b7, 0xbfef, 0xa427, 0xca31, 0x5efa, 0xdd4f,
+    0xbd3d, 0x2e92, 0xb53b, 0x5156, 0x7762, 0x3f42, 0xce27, 0xb939, 0x46ba, 0x7816, 0x25fc, 0x8c05, 0xcfe9, 0x1920, 0x42b2, 0xd937,
+    0x32b0, 0xafc1, 0x6eaa, 0x9d17, 0x4ee6, 0x7440, 0x5bd4, 0xcf01, 0x8b31, 0xba19, 0x645c, 0xbc0f, 0x8b6d, 0xdb97, 0x17ba, 0x9299,
+    0x4d12, 0xb19f, 0xc085, 0x3a36, 0x76ae, 0xae05, 0x45ea, 0x31d2, 0xc18b, 0x4f4e, 0xd5f3, 0x7330, 0x9771, 0x42b0, 0xac0b, 0x9117,
+    0xea09, 0x7276, 0x1b52, 0x97cd, 0xc76f, 0x755e, 0xc2e1, 0x88d3, 0xdef5, 0x2460, 0x3302, 0x8eab, 0x6682, 0xbc25, 0xc903, 0x6dbe,
+    0x9ac7, 0xdb9d, 0x1f94, 0x76ec, 0xe6f9, 0x44d8, 0x2ae6, 0x7468, 0x393e, 0x8bf7, 0x54ba, 0xc13d, 0x5fd8, 0x2f82, 0xcf01, 0x9759,
+    0xade9, 0x645c, 0x812b, 0xa3e1, 0x3b36, 0xd441, 0x4770, 0x8f1f, 0xe5eb, 0x5870, 0x6b2e, 0xb5e3, 0xcc89, 0x3c58, 0x686e, 0xe6e5,
+    0x1cc2, 0xd4e9, 0x3ede, 0x981f, 0x4c62, 0xa253, 0xcc85, 0x57a6, 0x8dd3, 0x5298, 0xb83b, 0x1ca6, 0x6726, 0x552a, 0x948b, 0x7186,
+    0xa035, 0x1d90, 0xe795, 0x532e, 0x6c58, 0x2698, 0xca67, 0xbe8d, 0x91c9, 0x6c4a, 0x209a, 0x3198, 0xb149, 0xb837, 0x7c4a, 0x9ab7,
+    0x5a9a, 0xaa69, 0x8b39, 0x76dc, 0x93ff, 0xad99, 0xd39d, 0xbae3, 0x1a92, 0x65d2, 0xc1b5, 0x7c5c, 0x5b7c, 0x2dc0, 0x96ab, 0xe5bb,
+    0x4546, 0x5d5a, 0xa30b, 0xec9f, 0x6f34, 0xc2cd, 0x8215, 0x14c8, 0xb457, 0xe3d1, 0x609c, 0xb6d7, 0x1d6e, 0xcf8f, 0x55de, 0xb597,
+    0xdf7f, 0x5638, 0x7bd8, 0x35bc, 0x5222, 0xcf7b, 0xe4a3, 0x8511, 0x4d3c, 0xba47, 0xe27d, 0xad4d, 0x2da2, 0xca0f, 0xbc17, 0xa07d,
+    0x588e, 0xca13, 0xc66d, 0x38f0, 0x6eea, 0xa4b1, 0x1c8c, 0xd297, 0x6c88, 0x2946, 0x8c2f, 0xd443, 0xab0f, 0x7cc6, 0xd047, 0x38ac,
+    0x16d8, 0x7cce, 0xcc73, 0x3afa, 0xc401, 0x4674, 0xb9f7, 0x1c3a, 0x6a64, 0x57bc, 0x321e, 0x21b8, 0x5034, 0xdaa3, 0x6a62, 0x9a61,
+    0x4130, 0xeb0b, 0xc61b, 0x852b, 0xdeeb, 0xb89d, 0x942b, 0x3512, 0x1876, 0x82b5, 0x6948, 0x9fa9, 0xe373, 0x81cb, 0xc48f, 0x9d13,
+    0x2d78, 0xc697, 0x41e6, 0x7300, 0xc4c5, 0x453e, 0xb72b, 0x83ab, 0x172e, 0x9339, 0x56f6, 0xd24b, 0xa5fb, 0x4e08, 0xc667, 0x8581,
+    0x62ae, 0xd667, 0x4670, 0x7cbe, 0x5f02, 0x54e8, 0x1b26, 0xe71f, 0x4bfe, 0x8837, 0x3b64, 0x1bcc, 0x719e, 0x30a2, 0x3d32, 0x67d6,
+    0x338e, 0x4b96, 0xd033, 0x6ef6, 0xa0cb, 0xe901, 0x64a8, 0x92ed, 0xd0f1, 0x5de4, 0xde19, 0xb50d, 0x5ee4, 0x7356, 0x9b19, 0xc11b,
+    0x771e, 0x9321, 0x454a, 0xe685, 0xae93, 0xc09b, 0x30f2, 0xa51f, 0x475c, 0xe807, 0x9ce5, 0x2322, 0x51e8, 0x6efc, 0xad81, 0x6288,
+    0x8229, 0x2e48, 0xa01f, 0xd0cb, 0x6258, 0xd2f3, 0x91f3, 0x6b7e, 0xe055, 0x3eba, 0xa017, 0x2eba, 0xe3b3, 0xc96d, 0x6c16, 0x1e02,
+    0x9a09, 0xb8cd, 0x40a6, 0xaa3f, 0x4d52, 0x6b98, 0xa117, 0x25d4, 0x6456, 0xc695, 0x4a84, 0xa7bb, 0xd521, 0x76e0, 0x15a4, 0x8ed1,
+    0x7a30, 0x52f4, 0x9903, 0x39e8, 0x55d6, 0x6494, 0xad4d, 0x194e, 0x5864, 0xc265, 0xe241, 0x2228, 0x9d1b, 0x8729, 0xdc79, 0x742c,
+    0xe5c7, 0x4034, 0x47d0, 0x25fa, 0x91db, 0x5e7a, 0x6a36, 0xb35b, 0x45b6, 0xc1e1, 0xa141, 0x1bc4, 0x8055, 0x5764, 0x2342, 0xa5f7,
+    0x538a, 0x8837, 0x70a0, 0xbe99, 0x6732, 0xdce9, 0x86f9, 0x19da, 0x2c96, 0xac33, 0x818b, 0xc6f7, 0x92d7, 0xd0e1, 0xbd55, 0x2cd8,
+    0x4aa0, 0xc585, 0xa25b, 0x3240, 0xafd7, 0x829d, 0x45c0, 0x61e8, 0x40c2, 0xa53d, 0xcead, 0x9b89, 0xdcfd, 0x55d4, 0x3704, 0x335e,
+    0xdcb5, 0x1f1a, 0x55d0, 0xd64b, 0x4c1a, 0x28e6, 0x7bd0, 0x435e, 0x68a2, 0x9301, 0x258a, 0xae1b, 0xe04b, 0x6e04, 0xb829, 0x57d8,
+    0xb3cd, 0x778e, 0x2058, 0xd79f, 0x8cad, 0x5ae6, 0xa9a7, 0x3f7c, 0xd3ef, 0x9191, 0x8081, 0xc285, 0x42f8, 0x96d7, 0x6164, 0xbd29,
+    0x75fc, 0x179c, 0xc785, 0x8fe9, 0x4138, 0x9381, 0x2ff6, 0xaabd, 0xc83f, 0x72f6, 0x913b, 0x4ad8, 0x7c2a, 0xd9e9, 0x5cdc, 0x3eb8,
+    0xa393, 0x3302, 0x860d, 0x74f8, 0xeac3, 0xce77, 0x2d70, 0x8f4f, 0x52d0, 0xe3ed, 0x5c0e, 0x1532, 0x6e7a, 0x483c, 0x9d4b, 0x5c7a,
+    0xaacb, 0x9eb1, 0x4400, 0xabc5, 0x6d74, 0xa1e7, 0x5544, 0x9229, 0xdf59, 0xd415, 0x9205, 0xb6a3, 0xcb07, 0xa447, 0x1684, 0xa981,
+    0x2370, 0x66c8, 0x35ee, 0x54d8, 0x242c, 0x6c80, 0xce23, 0x9b6f, 0xe0a5, 0xcba5, 0x4df4, 0xd47f, 0x37e8, 0x4bfc, 0x26e8, 0x6f2e,
+    0x474e, 0x9009, 0xd4e9, 0x4f78, 0xa091, 0x226e, 0xcfad, 0x6550, 0xe3eb, 0x7796, 0x2f36, 0xbe99, 0x202c, 0x97e1, 0xe11b, 0x56f6,
+    0x79ec, 0x9c9d, 0x1eb8, 0x9017, 0xca43, 0xdcb3, 0x82cb, 0xb0a3, 0xc2b9, 0x74f0, 0xb3ab, 0x5efa, 0xe30b, 0x8e17, 0xa76f, 0x9fad,
+    0x7404, 0xa479, 0xe3f3, 0x8473, 0x3626, 0xbbe1, 0x23be, 0x68f8, 0x1ba0, 0xa35f, 0x687e, 0x48e8, 0x30d0, 0xe905, 0xad29, 0x4f92,
+    0x2c28, 0xc1b7, 0x5aa8, 0x344e, 0x1f3e, 0xd4c9, 0x7bfa, 0x9365, 0x1890, 0x7224, 0x3ec4, 0xc8d5, 0x8da9, 0x2f98, 0xc22b, 0x42b8,
+    0xc833, 0x59e4, 0x7b7e, 0x1eea, 0x41a0, 0xdf23, 0x809f, 0x20ee, 0xaf23, 0x61ea, 0xb6ef, 0x836b, 0x52ce, 0x7ed6, 0xa241, 0x2d90,
+    0x5074, 0x7c62, 0x5614, 0x845b, 0x2774, 0xe173, 0x3ddc, 0x4b74, 0x8393, 0xaff7, 0x6c7e, 0xdfc9, 0x2946, 0x38c0, 0x5350, 0xe4d1,
+    0x334a, 0xbb45, 0x6afc, 0xad7b, 0xd2a7, 0x914d, 0xa811, 0xdd5d, 0x742c, 0xa433, 0x37f0, 0x723a, 0xb1d5, 0x3c9a, 0x4f9a, 0x7848,
+    0x2bf4, 0xc0b7, 0x918f, 0xd443, 0x7cca, 0xbe8b, 0x21f2, 0xcba1, 0x9993, 0x61d0, 0x3706, 0xdceb, 0x7894, 0xd99b, 0x8c11, 0xbff5,
+    0xcec3, 0xaf2d, 0x2b68, 0xe10f, 0x1594, 0x799e, 0x43e4, 0xb7f9, 0x9ce3, 0x6dc6, 0x409a, 0x5bb4, 0x96ff, 0x25dc, 0x8071, 0xdddf,
+    0x7a82, 0x6aee, 0x8587, 0x447c, 0xd33f, 0x5dde, 0x16d2, 0xb24d, 0xe93b, 0x30f0, 0x4de2, 0x7790, 0x6a94, 0x1810, 0x8205, 0xaded,
+    0xc5fb, 0x699e, 0x3a12, 0xabad, 0xc42b, 0x5fe4, 0x9fa3, 0xdb2b, 0x55ea, 0xd661, 0x7c08, 0x419a, 0xab15, 0xceff, 0x1e32, 0x8569,
+    0xcfa7, 0x2fb6, 0x8a37, 0x4d5a, 0x9cbb, 0x2216, 0xdfad, 0x98b3, 0x53ac, 0x2f88, 0x9665, 0x2e66, 0xa43f, 0xe81f, 0x2fcc, 0x254a,
+    0x8387, 0x9ee5, 0xebb9, 0xb141, 0x21c4, 0x749e, 0x5ad4, 0x3f0a, 0x873f, 0x1df6, 0x3452, 0xd089, 0x99fd, 0x48f4, 0x1ac8, 0x7d90,
+    0x6eb2, 0x9427, 0x42bc, 0x2184, 0x9c23, 0x523c, 0x803d, 0x6a88, 0xbf09, 0xa51b, 0xb227, 0x3bc8, 0xe047, 0xb75d, 0x2c2a, 0xe2d1,
+    0x72f4, 0xbed1, 0x5df6, 0x1f18, 0x8237, 0xeebd, 0x75d6, 0x2f06, 0x626c, 0xa5e7, 0x3cf0, 0x79d6, 0x66e8, 0x3642, 0x8371, 0xd64d,
+    0xbd73, 0x9007, 0xd9ed, 0x965b, 0xa9af, 0x4638, 0x6322, 0x2224, 0x78a0, 0xa8d9, 0x3d00, 0xb927, 0x63ee, 0x9549, 0xbbb1, 0xac03,
+    0xd977, 0x6054, 0xb21f, 0x2a8c, 0xdfa5, 0x8c6f, 0x6e48, 0x4828, 0xb7fd, 0x9fa3, 0x408e, 0xd9ed, 0x8429, 0x5c42, 0x3038, 0xb0c3,
+    0xc927, 0x43c0, 0xe341, 0x710c, 0x2d4c, 0x9f29, 0x3ee4, 0x2880, 0x5064, 0x9907, 0xd947, 0x81e7, 0x5294, 0xc151, 0x222c, 0xd5e5,
+    0x7e04, 0x249e, 0x4076, 0x179a, 0x57a6, 0xd339, 0x4d56, 0x986b, 0xca03, 0x81a5, 0x373c, 0xa12f, 0xc6ab, 0x8b0f, 0x3cb2, 0x5d3a,
+    0xdbf5, 0x7a6a, 0xcb11, 0x9cb3, 0x818b, 0x6bee, 0x5098, 0xb333, 0xda27, 0x5dd4, 0xa7ab, 0x866b, 0x46b2, 0xe70b, 0x8079, 0xa129,
+    0x23aa, 0xe013, 0xad11, 0x73a0, 0xb1d1, 0x29e8, 0x54ca, 0xc0cf, 0x9a59, 0x7b16, 0x2570, 0x59f8, 0xc76f, 0x39b8, 0x6304, 0xd68d,
+    0xca85, 0xdc2f, 0x3a8e, 0xcc31, 0xa283, 0x929f, 0xbfa1, 0x7dea, 0xd3e3, 0x92f9, 0x2ef2, 0x597a, 0x8905, 0xb4cb, 0xd3cf, 0xa6fd,
+    0x43c0, 0x7504, 0xdc05, 0x2076, 0x7cde, 0x3572, 0xc5f1, 0x4cea, 0x8069, 0x464e, 0xcc67, 0x96af, 0x5dae, 0xc5f1, 0x214a, 0xa635,
+    0x4608, 0xa1a3, 0x5c5e, 0xb4a1, 0x33e2, 0xe797, 0x7f2c, 0x2c12, 0x4dde, 0x766e, 0x93b1, 0xbf4d, 0x4608, 0x9de9, 0x2fc8, 0x43b8,
+    0x696e, 0x5e2a, 0x335a, 0xa781, 0x4566, 0xb755, 0xca8b, 0x68ca, 0xe575, 0xab27, 0xd5a7, 0x29c4, 0x5130, 0xa731, 0x3bfa, 0x5c6c,
+    0xaf1d, 0xd323, 0x226c, 0xb5df, 0x89b7, 0xdb3d, 0x9757, 0x79ce, 0xa335, 0xbcf7, 0x8883, 0x3f6a, 0xc967, 0xe6d3, 0x5106, 0xceb7,
+    0x6324, 0x7bca, 0x98d1, 0xb84f, 0x177a, 0x6ce4, 0xb58d, 0x3746, 0xa8ab, 0xc38d, 0x2dc2, 0x53d2, 0x89d5, 0x2a96, 0x6cce, 0x9bc1,
+    0x5c10, 0xad6d, 0x7124, 0x393c, 0xcbb1, 0x2cba, 0x7850, 0xbceb, 0x65a8, 0x19e6, 0x742e, 0xc855, 0x5fa2, 0x814f, 0x6eb0, 0xc8cd,
+    0x4d02, 0x3e1c, 0x53b4, 0x6fbc, 0xcfe7, 0xc875, 0xdda3, 0x9973, 0x7034, 0xdebf, 0x54d8, 0xab41, 0x6b40, 0x27a6, 0xe3c1, 0xc099,
+    0xce3b, 0xdf8b, 0x5c76, 0xb2af, 0xbe1d, 0x3638, 0xa247, 0xd8e1, 0x459a, 0x2676, 0x7900, 0x8039, 0x992b, 0x55e0, 0x5b8e, 0x9069,
+    0x2bfc, 0x4ff6, 0xdf69, 0x95a9, 0x2a4a, 0xaf67, 0x3e60, 0xbd8b, 0x46e2, 0x80d7, 0x2022, 0xe493, 0x9ab5, 0x4b5c, 0xddfd, 0x5c5c,
+    0x7712, 0x4876, 0xa7e1, 0x17d4, 0x77ac, 0xc123, 0xe3ff, 0x5256, 0x7e74, 0x2f94, 0x5636, 0xa099, 0x2000, 0xd75d, 0x881f, 0x374a,
+    0x1602, 0x6576, 0xc19d, 0x7a2c, 0x67f4, 0xac65, 0x36b4, 0x2be8, 0xbfad, 0x843d, 0x1d30, 0x5522, 0xb593, 0x3be0, 0x6ed8, 0x89f5,
+    0x2928, 0x6294, 0xb17d, 0xba59, 0x4a52, 0x7862, 0xb837, 0xe065, 0x63b6, 0x1962, 0x37fc, 0x9c39, 0x2baa, 0x6dde, 0xb0db, 0x6752,
+    0x5226, 0xc43b, 0x9f2f, 0xbb5f, 0x9827, 0x7e72, 0xa9d7, 0x340c, 0xe30b, 0x45f0, 0xbd5b, 0x901f, 0x2174, 0x6f00, 0xb877, 0x1988,
+    0xa5c3, 0x7c94, 0x2746, 0xb7d3, 0x4ef6, 0xdeab, 0x3c96, 0x2a24, 0xc3e3, 0x6650, 0x3388, 0xbe95, 0x619c, 0xa241, 0x4dae, 0xb929,
+    0x877b, 0x6e1e, 0x48a2, 0xc215, 0x9753, 0x673c, 0xa1f9, 0x34ae, 0x46b4, 0xe7d1, 0xc849, 0xa893, 0x1dee, 0x9539, 0xb821, 0x7284,
+    0x85d1, 0x1f1c, 0xa73d, 0x6cea, 0xd50f, 0x1b7a, 0x4728, 0xaeff, 0x26bc, 0x3eea, 0xb8b1, 0x7326, 0xc435, 0x9abd, 0x67aa, 0x1e04,
+    0xb585, 0x8847, 0x9c1b, 0x27da, 0x57f8, 0x71f2, 0xd7bd, 0x1e2a, 0x5774, 0xa8dd, 0x2a88, 0x656e, 0x468a, 0xe8a5, 0x9091, 0xbf15,
+    0x7bb8, 0xdc7d, 0x18ce, 0x6a72, 0x4232, 0x92df, 0x6478, 0xab69, 0xdd51, 0x27e6, 0xccd9, 0x571e, 0x1a74, 0xb421, 0x7f00, 0xcff7,
+    0x2124, 0x9b4b, 0x8f93, 0xd38f, 0x56ac, 0x926f, 0x2fa6, 0x6c3e, 0x51c8, 0x1b5e, 0x86f3, 0xba09, 0xe66f, 0x78f4, 0xc0b7, 0x413c,
+    0x923b, 0x354c, 0x4e52, 0x7710, 0x9e0d, 0x2d1e, 0xbeaf, 0x3778, 0x6534, 0x5932, 0xd43d, 0x23bc, 0xa39b, 0xb6ff, 0x70c0, 0x92ad,
+    0x2698, 0x4744, 0xe903, 0x3590, 0x4f70, 0xdc89, 0x857b, 0x1e52, 0x5b9c, 0x6b68, 0x99b5, 0xe437, 0x5100, 0x7ba8, 0xc3bf, 0x39f4,
+    0x43d6, 0xe0ab, 0xc533, 0x7be8, 0xbd1f, 0x60b8, 0x7ca4, 0x50f2, 0xcaab, 0xb0c3, 0xddfb, 0x560c, 0xad69, 0x4318, 0x9825, 0xdc03,
+    0xaeef, 0xb7db, 0x2b3c, 0x7ea8, 0x3c38, 0xa1df, 0x4f06, 0x1ac8, 0xc8f5, 0x8079, 0x2cb4, 0xc317, 0xb265, 0x8fa7, 0x7790, 0x9db3,
+    0x3444, 0x1dc8, 0x7d24, 0xd5c3, 0x70e4, 0x557c, 0x181c, 0x8349, 0xaaf3, 0x65f8, 0xcdb5, 0x3560, 0xaa5f, 0xbeb1, 0x1f74, 0xd82b,
+    0x8647, 0xa1b5, 0x7a92, 0xd2d1, 0x5256, 0x7116, 0x8f7d, 0xdde9, 0x2af4, 0xc661, 0xb045, 0x5a2e, 0x2da4, 0xb8bd, 0x9095, 0x2754,
+    0x5db0, 0x3d70, 0xc11f, 0x53e6, 0xd3a9, 0x898b, 0x350a, 0xa539, 0xb9f9, 0xd5af, 0x8df5, 0xcf95, 0x798a, 0x41d2, 0x6000, 0xcca7,
+    0x9b27, 0x4090, 0x95af, 0x2c02, 0x55f2, 0xc88f, 0x9eb3, 0xd9d5, 0x5ebc, 0xcf5b, 0x67de, 0x9319, 0xf301, 0xa5bd, 0xcfe3, 0x4cdc,
+    0xc09d, 0x9649, 0x580e, 0x3940, 0x8647, 0xd5f1, 0x5e7e, 0x7f3c, 0x96db, 0xcfbd, 0xbe6f, 0x4db8, 0xd889, 0x98b9, 0x406c, 0xec49,
+    0x2e3a, 0xb431, 0x70ae, 0x67c0, 0xe42d, 0x3d32, 0x84ed, 0x51f6, 0x66cc, 0x7010, 0xdec7, 0x5788, 0x7b76, 0xd2c3, 0x5496, 0x8bd7,
+    0xb2e1, 0x435c, 0x4eae, 0xaee1, 0x7318, 0x93dd, 0xc727, 0x9ea9, 0x8c01, 0x4530, 0x98a5, 0xddbf, 0x27de, 0xd22b, 0x2fce, 0x57f8,
+    0x3aae, 0xd917, 0x2d50, 0x7e8c, 0x4110, 0xdf2b, 0x92a9, 0xd469, 0x6772, 0x3d10, 0x8b37, 0x7772, 0xd6e1, 0x4b98, 0x8edf, 0x297a,
+    0x456e, 0x9f47, 0x4272, 0x7b48, 0x5324, 0x6f68, 0xa549, 0x617a, 0xe1b9, 0x9ffb, 0xcf9d, 0x1816, 0x486c, 0x3472, 0x7ee0, 0x5ca4,
+    0xc38d, 0x3e4a, 0xd44d, 0xae35, 0xc21f, 0x3f60, 0x6c70, 0xa02d, 0xd109, 0x805d, 0xc41b, 0xddb1, 0x825f, 0xa2f9, 0x3530, 0x622e,
+    0xceb9, 0x3d46, 0x876b, 0xca6d, 0xad5d, 0x560e, 0x39ec, 0xc5a7, 0xbb2d, 0x6a88, 0x42e6, 0xa5ab, 0x67ca, 0xe505, 0x63e6, 0x917b,
+    0x50c0, 0xe25d, 0xc17f, 0x7fb8, 0x626a, 0xab2f, 0x2572, 0x8aa3, 0xd1db, 0x36b6, 0x9591, 0x7434, 0x357e, 0xa3e9, 0x87b3, 0x1834,
+    0xb5f1, 0xc9e1, 0x9cc7, 0xe319, 0x3f5a, 0x5f0e, 0x5688, 0xc923, 0x46b8, 0x178a, 0xad8f, 0x64a6, 0x8879, 0x369e, 0x545a, 0x20f8,
+    0xa32f, 0xd39f, 0xb97d, 0x86e9, 0x7cd8, 0xa1e7, 0x4524, 0x92b1, 0xe30f, 0x7a0c, 0x3c48, 0xcd9d, 0xbab9, 0xa9d3, 0x640c, 0xe5a1,
+    0x91b5, 0x6174, 0x260c, 0x5050, 0xd68d, 0xaae5, 0x19bc, 0xe3ab, 0xa755, 0x3bec, 0x76b0, 0x8da5, 0x3218, 0xd419, 0x1b9e, 0x5d00,
+    0x8b99, 0x7dac, 0xe10d, 0x9adb, 0x5f96, 0x2db6, 0x8033, 0xac45, 0x49aa, 0xbc81, 0x82bd, 0x5c48, 0x42fa, 0xd26d, 0x4e98, 0x44e8,
+    0x6012, 0x8b03, 0xc213, 0x2ce6, 0x4002, 0x9191, 0xc551, 0xdf29, 0x56b8, 0x1d66, 0xbe7d, 0x5df6, 0xd2cd, 0x4222, 0x70f2, 0xb6d9,
+    0xc7ed, 0x379e, 0x1204, 0xbb73, 0x4a6a, 0xd1d9, 0xa7af, 0x64d2, 0x950d, 0x6e64, 0xd411, 0x89e9, 0x7590, 0xc479, 0x20a8, 0xaaf3,
+    0xa4e3, 0xe3d1, 0x3550, 0x7a82, 0xa3df, 0x3998, 0x18ea, 0xc505, 0x6c32, 0x45b2, 0x1b06, 0x75a0, 0xbf7f, 0x2d3a, 0x5096, 0xea39,
+    0xb5fb, 0x75a2, 0xd773, 0x21fe, 0xe3a7, 0x4eb2, 0x75be, 0x8bc9, 0x16a8, 0xa875, 0x3750, 0x75f0, 0xc27f, 0x17a2, 0x594c, 0x7b2a,
+    0xddbf, 0x21b2, 0x8629, 0xdc3d, 0x182e, 0x9601, 0x22d4, 0x3386, 0xaa4b, 0x727e, 0x5ef8, 0x833f, 0x805d, 0xa5a5, 0x2294, 0x952f,
+    0x794a, 0xd981, 0x49e2, 0x2c94, 0xc61d, 0x1eba, 0xa453, 0xc3b3, 0xb231, 0x1a34, 0x9809, 0x2bee, 0xab53, 0x4c46, 0x97b3, 0xcf89,
+    0x3a00, 0xdcdb, 0x6b36, 0xd959, 0x31a2, 0x1dca, 0x5b80, 0x7718, 0xe21b, 0x23d2, 0xa5f3, 0x55de, 0x72ac, 0x891f, 0xafab, 0x6eca,
+    0x99d9, 0xd179, 0xa067, 0x5542, 0xc3e5, 0x19ee, 0x74d4, 0xbd23, 0x4daa, 0x9d47, 0x2e86, 0x5e36, 0x5986, 0xc355, 0x8085, 0xe30d,
+    0x6974, 0xd581, 0x9999, 0xc09f, 0x2c4a, 0xc75d, 0x9d17, 0x30c4, 0x84d7, 0x4c0c, 0x67a4, 0x7dd2, 0xe98b, 0xb007, 0xda59, 0x910b,
+    0x28c8, 0x4c0c, 0x68ea, 0x4ea4, 0xe683, 0x8ddb, 0xb0c5, 0x31da, 0x94dd, 0x37fe, 0x8fd3, 0x4bc6, 0x14e6, 0x7188, 0xadb3, 0x1f7e,
+    0x7f5a, 0x50ce, 0xa2a7, 0x28da, 0x816f, 0xd475, 0x9caf, 0x2d16, 0x55fc, 0x897b, 0x93df, 0xcaf9, 0x78be, 0x3238, 0xbec5, 0x3ab2,
+    0xa739, 0x7a34, 0x285c, 0x18bc, 0x3f12, 0xec7f, 0xc3ed, 0xa445, 0xb06d, 0x599a, 0xc937, 0x4952, 0x5b24, 0xd533, 0x57c0, 0xd93d,
+    0x69f8, 0x8195, 0x240c, 0x4958, 0x9001, 0xb749, 0xab53, 0x8f35, 0xe445, 0x7dfc, 0xbc27, 0xdd1b, 0x2d14, 0x8039, 0xc4e9, 0xdf9d,
+    0x7906, 0x4d54, 0x640e, 0x20c2, 0xc85f, 0x4db2, 0xd311, 0xbdd5, 0x1ffc, 0xa637, 0x8457, 0x2954, 0x5dc8, 0x1306, 0x3d6c, 0x9bc3,
+    0xb799, 0x1d48, 0xa0a3, 0x8a73, 0x4180, 0x94c9, 0x694a, 0x323e, 0x86ef, 0x5732, 0x245c, 0xbf99, 0x661a, 0xb1e3, 0x75a4, 0x4f9e,
+    0x1f42, 0x3250, 0xc6b3, 0x4a98, 0xcbcf, 0x9569, 0xe5a5, 0x6098, 0x8ff3, 0xa96d, 0x4722, 0x23de, 0xc41b, 0x7d4e, 0x1832, 0xdb33,
+    0xc13f, 0xa5cd, 0x4e5e, 0x9c73, 0xeb4d, 0xaefd, 0x73b0, 0x376a, 0x9255, 0x8ded, 0xe6b9, 0x49ce, 0x7cea, 0x2918, 0x9afd, 0x5704,
+    0x451a, 0x8fa1, 0x61bc, 0x9c1f, 0x821f, 0x1fd0, 0x2f62, 0xb88b, 0x78f0, 0x13ae, 0x4b3e, 0x3754, 0xdad3, 0x81e7, 0x4ecc, 0x714c,
+    0xcedf, 0x8f25, 0xb2b3, 0x6c64, 0xde47, 0x5da6, 0x8ec3, 0x766c, 0xdc9f, 0x9725, 0x3a8c, 0xe86b, 0xb425, 0x936f, 0xa775, 0x7c42,
+    0x20ca, 0x52a6, 0xc9d7, 0x8169, 0xa84b, 0xb503, 0x2962, 0x630a, 0x40a8, 0xe715, 0xba5b, 0x4802, 0x2a10, 0x6052, 0x9567, 0x3a56,
+    0xa29b, 0x4f04, 0xd101, 0x7b70, 0x43e4, 0xb5d7, 0xc99f, 0x536e, 0xba4f, 0x2e84, 0xe0e1, 0x23d4, 0xaad3, 0x52c6, 0x640a, 0xd341,
+    0x37a8, 0x1a18, 0x8a2f, 0xa773, 0x5944, 0x75ee, 0xd141, 0x2c6c, 0x8dd9, 0x4bd8, 0xccc5, 0xa2e7, 0x65d4, 0xe2db, 0x242a, 0x7110,
+    0x5c94, 0x9521, 0x18d6, 0xa2cd, 0xc191, 0xcee5, 0x484a, 0xa739, 0x3be0, 0xc665, 0x8fa5, 0x41b0, 0xc985, 0x1e3e, 0xc163, 0x4f86,
+    0xb86f, 0x2590, 0x7488, 0x646c, 0xaf33, 0x3e40, 0x9cff, 0x5bb6, 0x1f82, 0xb6b1, 0xdb59, 0x8857, 0xbc7b, 0x3162, 0x1d36, 0xb1a3,
+    0x5820, 0x717e, 0x246a, 0xe5e7, 0x4e60, 0x8bb3, 0xdc83, 0x6fd2, 0xbb45, 0x2694, 0xb52d, 0xa341, 0x5a12, 0x275c, 0x42f0, 0x76e8,
+    0xdca3, 0xab9d, 0x7866, 0x9c27, 0x2588, 0x8add, 0x566a, 0xdaf1, 0x5c92, 0x6eb0, 0xbcc7, 0x2d62, 0xa677, 0xd975, 0x465a, 0x57ac,
+    0x9e17, 0xc451, 0xddaf, 0x6096, 0xb4bb, 0x236a, 0x8851, 0x7404, 0x4a36, 0xe24d, 0x1a4e, 0x39c4, 0xb5d9, 0x8811, 0xa385, 0x14f6,
+    0x6cc4, 0xc33d, 0x4934, 0xb163, 0xd7e7, 0x71de, 0x498a, 0x79d0, 0x1446, 0x6618, 0xdded, 0xbafb, 0x1e02, 0x8eb7, 0x2c6e, 0x79ec,
+    0x35dc, 0xa637, 0xcf99, 0x61c2, 0xda1b, 0x1c04, 0x6ac4, 0x3180, 0xa267, 0x8f1f, 0x407e, 0x6d16, 0x52a6, 0xcfc1, 0x4708, 0xb89d,
+    0x87e5, 0x3698, 0x9847, 0x589e, 0xb8cf, 0x2a48, 0x72ca, 0x62c4, 0x4a36, 0xc491, 0x4d54, 0xd34b, 0x7602, 0x89bb, 0xd2d3, 0x3004,
+    0x8249, 0x6d82, 0xc515, 0xe593, 0x2de8, 0x599e, 0xdd13, 0xb9b7, 0x571a, 0x8265, 0xdfe5, 0xa1af, 0x41ba, 0x8b59, 0xcafb, 0xeb7d,
+    0xb853, 0x6992, 0xaa99, 0x1f36, 0x7584, 0xb4f7, 0x261e, 0x6770, 0x38ac, 0xd305, 0x77cc, 0xe17f, 0xa2d1, 0x3476, 0xa56b, 0x9e63,
+    0x7398, 0x3254, 0x547e, 0x86bf, 0x650e, 0x22ee, 0x4cf6, 0xc4fd, 0x49c8, 0xabd5, 0x6cc4, 0x1fde, 0x93d5, 0xb855, 0xe9bb, 0x6c20,
+    0x251c, 0xe161, 0xacab, 0x40fa, 0xc893, 0x7566, 0x4f78, 0xe9eb, 0x4874, 0x8a4b, 0xc0a9, 0x652a, 0x9f3b, 0x4684, 0xe031, 0xa455,
+    0x3548, 0x433e, 0x54fc, 0x212e, 0xb073, 0x4d44, 0xbaf1, 0x248a, 0x4fce, 0x83eb, 0xa6e1, 0x59a2, 0x141c, 0x6d10, 0xd091, 0x2ac8,
+    0x84f3, 0x4bb6, 0xaa55, 0x37fe, 0x5776, 0x797e, 0xce63, 0xb283, 0x9939, 0x83e5, 0x61ec, 0x9ef7, 0xd3e3, 0x8f13, 0xe549, 0xb7e9,
+    0x29aa, 0x6afc, 0xb0bb, 0x617e, 0xbde3, 0xa4f7, 0x72e0, 0xd8e1, 0x88af, 0x3f56, 0xa233, 0x665a, 0x398e, 0xd20f, 0xbf8f, 0xaa5f,
+    0x67a0, 0xb909, 0xdae5, 0x9ba9, 0x3d5a, 0xb0c7, 0x4c22, 0x67c8, 0xe5dd, 0x7e3e, 0x3eb4, 0x6a84, 0x3042, 0xbdfb, 0x52f6, 0x7ca4,
+    0xb3eb, 0xc757, 0x4882, 0x78a0, 0x87d9, 0x5d40, 0xae35, 0x87d3, 0x4854, 0x7ba0, 0x6e24, 0xaf27, 0x6392, 0x9b0b, 0x3e90, 0xdbed,
+    0x853d, 0x1718, 0x924d, 0xd525, 0xb849, 0x2e7e, 0xdc59, 0x82a3, 0xc961, 0x9db3, 0x778c, 0x3a62, 0xabaf, 0x5d16, 0x9ccd, 0xd331,
+    0xb98f, 0x34d8, 0x8afb, 0x65bc, 0xb07d, 0x37ba, 0x15ea, 0xa911, 0x47bc, 0x8b53, 0xe217, 0x3e1c, 0x84e1, 0xcb87, 0xa29f, 0xbd5f,
+    0x398c, 0x7f54, 0x1c86, 0xc967, 0x5ae4, 0x35e2, 0x7f38, 0xc681, 0x194a, 0x49f4, 0xec7b, 0x5f3a, 0x8295, 0xce93, 0x8fd1, 0xe26b,
+    0xae05, 0x2ec0, 0x4680, 0x6df8, 0x4388, 0xd93f, 0x6c68, 0xd707, 0xbe27, 0xa6dd, 0x63d0, 0xd77d, 0x4abe, 0x4f5e, 0xd8cb, 0x818b,
+    0xe211, 0x5ba2, 0xa39b, 0x8b5d, 0x9745, 0x5a88, 0x3374, 0xdd21, 0x4480, 0x825f, 0x2d4e, 0x9f3f, 0x7ada, 0xad13, 0xcfa5, 0xc2d5,
+    0x4a32, 0x70ae, 0xb2a7, 0x350e, 0xc383, 0x812d, 0x444e, 0xcd6d, 0x60a0, 0x259e, 0xc45d, 0x4f88, 0xa013, 0x9169, 0x5f3e, 0x281e,
+    0xa0bf, 0xe06f, 0xc4b1, 0x432e, 0xe585, 0x8255, 0xab7d, 0x9dbf, 0x33a2, 0x8105, 0xab31, 0x61dc, 0x9677, 0xc383, 0xa859, 0x5500,
+    0xdcb3, 0x44d4, 0x5f40, 0x9ff9, 0x1f5c, 0x764a, 0xb3b5, 0x47e4, 0xca11, 0xa543, 0x3fa6, 0xcd15, 0x52f2, 0x9fb9, 0x2d48, 0x38e8,
+    0x95a5, 0x839f, 0x5a84, 0xd2d3, 0x9fcd, 0x5434, 0x3b6a, 0xa9c9, 0xc869, 0x21b2, 0x4e5a, 0x8fd1, 0xb4dd, 0x6d64, 0x5b30, 0xc939,
+    0x288e, 0xdd23, 0xd643, 0xb325, 0x3b6e, 0xd335, 0xa38d, 0x63b0, 0x8475, 0xbbe7, 0x3a10, 0xa105, 0xd96d, 0x61d6, 0x3a62, 0xbf4d,
+    0x8369, 0xcf1d, 0x74be, 0x2cec, 0xe5c1, 0xa2b5, 0x6a78, 0xcfd7, 0xa861, 0x2fee, 0xd993, 0xaf2d, 0x2214, 0x9201, 0x5f24, 0x17ca,
+    0x758e, 0xc2b9, 0x99c5, 0x1a04, 0xcebf, 0x7fc0, 0xed2f, 0xa01f, 0x360c, 0xd01d, 0xc081, 0x85cb, 0x4704, 0xc5c7, 0x4242, 0x57de,
+    0xc23f, 0xe083, 0x70b4, 0x8d3f, 0x164a, 0xd547, 0x52f0, 0x3238, 0xbedd, 0x21c0, 0x50d6, 0xad73, 0x44dc, 0xa435, 0x5b46, 0x7176,
+    0x41c6, 0xcb5d, 0x9167, 0x38b6, 0x2b0e, 0x5588, 0x7544, 0x1f54, 0x5a24, 0x93f3, 0xbb43, 0xc819, 0x83fd, 0x5a92, 0x1f3c, 0x8963,
+    0x29ca, 0x5df6, 0x4db4, 0x8071, 0xe0df, 0x6a16, 0x9159, 0x3888, 0xa3af, 0x5e8a, 0xc603, 0xd9ad, 0x8837, 0x96f7, 0xa93b, 0x3b18,
+    0xbca9, 0x3552, 0xe219, 0x6468, 0x3b34, 0x8fdb, 0x2ea8, 0xcfd1, 0x1ee8, 0xc1c9, 0xe115, 0x29b0, 0x9385, 0x7e0a, 0x4b34, 0x690a,
+    0xac7f, 0x55ac, 0xe2eb, 0x38e8, 0x4a90, 0x689e, 0x95a9, 0x35aa, 0x28c0, 0xc149, 0x468c, 0x1ae0, 0xeab9, 0x8a45, 0x6ca6, 0x4192,
+    0x8517, 0x2e1a, 0xa725, 0x7080, 0xcc51, 0x7fd4, 0x5320, 0xd5e7, 0x76ec, 0x2eba, 0xc797, 0x68c6, 0x1bd8, 0x7aca, 0x5d06, 0x50f4,
+    0xb1fd, 0x5da4, 0xd525, 0xbf61, 0x4496, 0xe02b, 0xb1a7, 0x6dea, 0x9b8d, 0xd41f, 0xb793, 0x3ba8, 0x9c91, 0x4f94, 0x31e0, 0x773c,
+    0x248c, 0x6416, 0x8987, 0xb287, 0x9811, 0x53a8, 0x318e, 0xad23, 0x20ea, 0x536e, 0x7aee, 0xb187, 0x6d00, 0x26e2, 0xb0cb, 0x4160,
+    0x9195, 0x30be, 0xcc93, 0x7c74, 0x1b04, 0xb505, 0x93b9, 0xd351, 0xb55d, 0xa80d, 0x70ba, 0xe901, 0x4bbc, 0x3e02, 0x5eb0, 0x9b0f,
+    0xe4ab, 0x2b54, 0x9341, 0x508a, 0x730e, 0x9a25, 0xa80f, 0x6070, 0xc37b, 0x647a, 0x8283, 0xc20b, 0xe327, 0x192a, 0xa8a7, 0x6d44,
+    0x46d8, 0x1a64, 0x78b2, 0x8f73, 0x6838, 0x16ca, 0x3b4e, 0xe08d, 0xd5f1, 0x6776, 0x2db6, 0xe57d, 0x362c, 0x4972, 0x1df2, 0x6a5a,
+    0xcc1f, 0x36f4, 0xa801, 0xd489, 0x8447, 0xca49, 0x8f7b, 0x15f4, 0x6f34, 0x2c32, 0xaec3, 0x656a, 0x15d2, 0x6f72, 0xbabb, 0x4936,
+    0xa6b3, 0xde6f, 0x3e9c, 0x31f6, 0x88bb, 0xc6d1, 0xe139, 0x6514, 0x8673, 0xbe4f, 0x66b0, 0x259e, 0x40da, 0xd8af, 0x46ce, 0x8941,
+    0x6134, 0x4354, 0x6f96, 0x196c, 0x7660, 0xc479, 0x8c45, 0x2832, 0xd28f, 0x2038, 0x595e, 0xc5c5, 0x7b36, 0x3c8a, 0xa073, 0x940d,
+    0x4a36, 0x1faa, 0xb3a3, 0x5904, 0x877d, 0x1ec8, 0x8ccb, 0x40cc, 0x8009, 0x57c4, 0x7108, 0x7bec, 0x2e54, 0xcf01, 0x87f3, 0xb0c5,
+    0xd6af, 0x982b, 0xe053, 0x6c9e, 0xa94b, 0x3704, 0x8a2d, 0x6802, 0xbefb, 0x4526, 0x274c, 0x615a, 0x7ddc, 0xe3fd, 0x9613, 0x768c,
+    0xd0d9, 0x358a, 0x9a17, 0xcb71, 0x4176, 0x9133, 0xa2a9, 0x5884, 0x783a, 0xe1cb, 0xcb53, 0x32ee, 0x6fac, 0x222a, 0xbc5f, 0x8ef5,
+    0x9dd5, 0xea29, 0x1fda, 0xcc6b, 0x90a3, 0xe225, 0x99bb, 0xbd2d, 0x32ee, 0xd5ef, 0x544e, 0x195c, 0xdbeb, 0x9bcd, 0x47a8, 0xebd5,
+    0x8fbb, 0xa501, 0x28fe, 0xc3ab, 0x22e8, 0x7fda, 0xc34d, 0xd87b, 0x2150, 0x3fe0, 0xb3d3, 0x193a, 0x737a, 0x4930, 0xe207, 0x1aba,
+    0x6be6, 0x844f, 0x57a6, 0xa27f, 0xca5b, 0x7a52, 0xda51, 0x6dc8, 0x9d9d, 0x9b07, 0x46dc, 0x3254, 0xda2d, 0xc339, 0x8cb7, 0x2da8,
+    0xcdef, 0x4072, 0x9ddb, 0x725c, 0x82a9, 0xc2e5, 0xeca7, 0x5640, 0xa843, 0x6070, 0x6df0, 0xb73d, 0xd6e5, 0x277a, 0x944d, 0x4f54,
+    0xe0db, 0xd941, 0xc297, 0x4220, 0x2b4c, 0x9c57, 0x6602, 0xe0d5, 0xa121, 0x5b7a, 0x4cbc, 0x9ee9, 0xb8b5, 0xd421, 0x2f26, 0x95a5,
+    0xe529, 0x3d36, 0x6de0, 0x9881, 0x2c60, 0x77a8, 0xbffd, 0x361a, 0x2392, 0x8461, 0x90c9, 0x274e, 0xc309, 0x1d7c, 0x6a04, 0xbc29,
+    0x992f, 0xea1d, 0xcfbf, 0x2324, 0xa431, 0xc5cf, 0x885d, 0x914d, 0x3f42, 0xc0c5, 0x34d8, 0x8c33, 0xca5d, 0x9a95, 0x60cc, 0x6bb2,
+    0xbc57, 0x2242, 0x6362, 0xe5ef, 0x4eb0, 0x2b2c, 0x9acf, 0x6230, 0x25e2, 0x500c, 0x3cac, 0xc87f, 0x3158, 0xb05d, 0x6a80, 0x18d2,
+    0x5450, 0x891b, 0xd2b7, 0x22ee, 0xdee3, 0x4cfc, 0x20f8, 0xe5e3, 0xb9b5, 0x35ee, 0x211e, 0xa551, 0x36e2, 0x5560, 0x83c1, 0xdaf9,
+    0xca9d, 0x57d2, 0xa87b, 0xda77, 0x5134, 0xc725, 0x935f, 0x5e88, 0xb987, 0x1bd0, 0x8e9d, 0xa7fb, 0x7e18, 0xcefd, 0x84cd, 0xb2a7,
+    0x9edf, 0x726c, 0x1970, 0x627e, 0x493e, 0xe4dd, 0x3e96, 0x6554, 0x9e87, 0xd983, 0x4546, 0x9153, 0xdff3, 0x8203, 0xd973, 0x5e20,
+    0xcad3, 0x210e, 0x732e, 0xa585, 0x669c, 0x14a8, 0x7d58, 0x8b65, 0x4920, 0xa133, 0xe9ef, 0xa8fd, 0x8807, 0xbb95, 0x1dfe, 0xa78d,
+    0xc2f5, 0x90a5, 0xae75, 0x98e3, 0x5e50, 0xe0eb, 0x56fe, 0x386e, 0x7b90, 0xb375, 0xe1a9, 0x31fe, 0x844f, 0x5000, 0x1ef8, 0xdfc3,
+    0x9fa5, 0x5df6, 0x7eb6, 0xd5df, 0x4964, 0xbc1d, 0x6502, 0xd679, 0x2ad4, 0xc277, 0x9ec9, 0xe33b, 0x4bea, 0xc19d, 0x583c, 0x244c,
+    0x3ba0, 0x5f82, 0x4d36, 0x2dda, 0xc2e7, 0x42e4, 0x55ee, 0x139e, 0x7aae, 0xacf3, 0x929f, 0xdba7, 0xbbfd, 0x33a6, 0x1a0e, 0xa70b,
+    0x824b, 0x4b0a, 0x2054, 0x7ece, 0xbf47, 0xe705, 0x2e16, 0x7cb0, 0x3e84, 0xa061, 0x6f64, 0x8eeb, 0x6c6c, 0xcb19, 0x346e, 0x5c12,
+    0x252a, 0x7aae, 0x43f6, 0x6c4e, 0xb14f, 0x25ac, 0x3ce6, 0xaf93, 0x45e8, 0x75bc, 0xa23f, 0x7274, 0x4204, 0xaafb, 0x78b2, 0xcdd3,
+    0x37ca, 0xb59b, 0xbe4f, 0x494a, 0x9a05, 0x2c3e, 0x537e, 0xb465, 0x75ce, 0x8cd3, 0xa105, 0x5304, 0xc6f7, 0x2aa0, 0xd3d7, 0x5c78,
+    0x9d23, 0xde03, 0xb685, 0x17fe, 0x2c70, 0xbe99, 0x4ee4, 0x8947, 0x2cfa, 0x567c, 0x8841, 0xac71, 0x7132, 0x1f82, 0xe6b7, 0x9edd,
+    0xba1d, 0x61ce, 0xc607, 0xaabd, 0x229c, 0x1be8, 0x9fcf, 0x776e, 0xd8cd, 0x3396, 0x9d6f, 0x8033, 0x5664, 0x3570, 0xc08d, 0x790e,
+    0x1b18, 0x6276, 0x5b2a, 0x8a49, 0xdf89, 0xb89f, 0x37f0, 0x8773, 0x2016, 0xbc49, 0x856f, 0xe2f9, 0x57fc, 0x41fa, 0xabf3, 0x7dca,
+    0x25d0, 0x8861, 0x477e, 0xa92b, 0xcee1, 0x5688, 0x8e57, 0x4eb4, 0xd7c3, 0x5490, 0x654e, 0x7524, 0xe625, 0x8fd5, 0xd4d5, 0x4c06,
+    0xa17f, 0x51f0, 0x3c06, 0x715e, 0x5b16, 0x2bd2, 0xe7f3, 0x5eae, 0x711e, 0xa2a9, 0xdd25, 0x3aa4, 0x18c6, 0xed63, 0xa84f, 0x209e,
+    0xddc7, 0x9a63, 0x43f2, 0xab7b, 0xc4d9, 0x7260, 0x3fe0, 0x8551, 0xdecf, 0x9bb3, 0xba7d, 0x6db0, 0x8c47, 0xd875, 0x8dbb, 0xb7ad,
+    0xaae5, 0xc48b, 0x49dc, 0x9be1, 0xbc79, 0x8005, 0x2c4e, 0x7844, 0x8d21, 0x9e4f, 0xd947, 0x7846, 0x873f, 0xcd3b, 0xb9eb, 0x3dde,
+    0x90b1, 0x856f, 0x324c, 0xb657, 0x2682, 0xa5e9, 0x748c, 0x424c, 0x8983, 0x4090, 0xc8e3, 0x6772, 0xb18f, 0x4370, 0x57a0, 0x2f68,
+    0xe069, 0x4696, 0xb733, 0x9113, 0x2482, 0x56fe, 0xa645, 0xcf41, 0x5d18, 0x8bc7, 0x7642, 0x4e00, 0xb5e3, 0x3496, 0x8467, 0x2100,
+    0x6e7a, 0x8943, 0xb40f, 0xc9a5, 0xd283, 0x4c70, 0xa9b5, 0x342a, 0xac5d, 0x3d2e, 0x739a, 0x4cdc, 0xce99, 0x33be, 0x76ba, 0xe6dd,
+    0x3ee6, 0x4a32, 0x3242, 0xc635, 0x4366, 0x22ec, 0xc26d, 0xade7, 0x8edb, 0x677a, 0x9c9d, 0x4c16, 0xac4b, 0xc423, 0xd097, 0x6efc,
+    0x32f8, 0xaf5b, 0x4104, 0x9755, 0x284a, 0xb087, 0x6ff2, 0xb66d, 0x7f06, 0x4368, 0x16d2, 0xb883, 0x646c, 0x91e3, 0xe9b7, 0x71be,
+    0x9e3f, 0xba55, 0x886d, 0xac71, 0x81d1, 0x9507, 0xd6bd, 0xa5a5, 0xe341, 0x5124, 0x692c, 0x29fc, 0x9d2d, 0x5174, 0x8aed, 0xb2a9,
+    0x4708, 0xdb19, 0x63f2, 0xa943, 0x53f8, 0x70b4, 0x96d5, 0xbc4f, 0xd623, 0x4c4c, 0x2298, 0xbdf1, 0xe803, 0xaaeb, 0x4fac, 0xdad3,
+    0xaf99, 0xbd43, 0x8a7b, 0xa117, 0x61b0, 0x7248, 0x9b87, 0xd92b, 0x83f9, 0xc775, 0x2988, 0x5b9c, 0x8af3, 0x2f72, 0xd5c5, 0x5568,
+    0x831b, 0x790c, 0x64d0, 0x8b6d, 0xda61, 0x6b98, 0x4d26, 0xc787, 0x2926, 0x686a, 0xe705, 0x3cd2, 0xa1bd, 0x6518, 0xb437, 0x8fa9,
+    0x2fd8, 0x446a, 0x7468, 0x8ed9, 0xb23d, 0x7f6c, 0x3c2e, 0xb9eb, 0x7b6a, 0xc61b, 0xd2eb, 0x6806, 0x9e95, 0x480a, 0x5c76, 0x351e,
+    0x72ac, 0x1534, 0x4768, 0xdb19, 0x5b98, 0xb207, 0x62f8, 0x4610, 0xbce9, 0x8a4d, 0xdc19, 0x447e, 0xade9, 0xca75, 0x65b8, 0xa9c1,
+    0xae17, 0x38fa, 0x9a15, 0x75a0, 0x1d6c, 0x4fd8, 0xc0d1, 0x461c, 0x6b7e, 0xb44f, 0x22ea, 0x3760, 0x901d, 0x6dba, 0xc8ad, 0x6930,
+    0xcca5, 0xbcdd, 0x28e4, 0x8211, 0x6150, 0x1a3e, 0xb1f1, 0x9a7b, 0xca97, 0x34b2, 0xbc7b, 0xa07f, 0x4ebe, 0xb1c3, 0x5da2, 0x97eb,
+    0x15c0, 0x6060, 0xc259, 0x92cf, 0xda49, 0x470a, 0xb607, 0x1d84, 0xc8e3, 0x7ef2, 0xb6cd, 0x57de, 0x6468, 0xc2f1, 0x7b0a, 0x4c48,
+    0xca8b, 0x8399, 0x67c0, 0x3a1c, 0x8c01, 0xddc1, 0xb30d, 0xcc7d, 0x4d2c, 0x73d2, 0x1b44, 0xa03d, 0x535e, 0x2540, 0xde0f, 0x3968,
+    0x5e92, 0x316c, 0x7242, 0x5996, 0x3c02, 0xcf73, 0xa799, 0x5c48, 0x412e, 0xd1bb, 0x5298, 0x6092, 0x4364, 0x2ffa, 0x993f, 0x46a8,
+    0x246c, 0xdfbd, 0x5e76, 0x453a, 0x8045, 0xb0fd, 0x641c, 0x2d42, 0xe56f, 0xac95, 0x5014, 0x6be8, 0x1d0e, 0xd9e3, 0x9557, 0xa5eb,
+    0x5354, 0x9ea9, 0x78d6, 0xddb1, 0xb327, 0x81cf, 0xb515, 0x3646, 0x4580, 0xc0c3, 0xacdd, 0x26c8, 0xca17, 0x9a49, 0x4988, 0xa949,
+    0xc307, 0x5304, 0x25de, 0x5586, 0x3b6e, 0x954d, 0x7868, 0xd1a3, 0x2634, 0xc6c9, 0x5b76, 0x16b4, 0x90a1, 0x651e, 0x9ca1, 0x5f22,
+    0xaadb, 0x8035, 0xdfd3, 0x6f7a, 0x9b49, 0x8557, 0x729a, 0xda7f, 0x348e, 0x41e8, 0xc897, 0x7354, 0x2592, 0x9987, 0x84eb, 0x4122,
+    0x8d61, 0xcfa3, 0xe679, 0x68e2, 0x82dd, 0xd04d, 0x3434, 0x4cca, 0xe80d, 0x9035, 0x4ff6, 0xa519, 0x3914, 0x1d54, 0x8337, 0xa6af,
+    0x49e0, 0x2540, 0xdf6f, 0x3d14, 0xcc53, 0x66c4, 0x27d6, 0xb351, 0x8855, 0x35fa, 0x9611, 0xd4c3, 0x49e2, 0x6884, 0xcfbd, 0x2744,
+    0x67f2, 0xcbd1, 0x93c1, 0x1f2a, 0x31ae, 0xcce3, 0x450a, 0x1cbe, 0x6686, 0xae69, 0x80a9, 0x5aa8, 0x3dba, 0x8189, 0x9181, 0x7184,
+    0x3b44, 0x54cc, 0xd41d, 0x3706, 0xdd19, 0xcc15, 0x5282, 0x5d96, 0x20d6, 0xebad, 0xa195, 0xbdab, 0xd389, 0x686e, 0xa3fd, 0x1734,
+    0xf429, 0xd367, 0x26c6, 0x5bb2, 0xaf8d, 0x80d5, 0xe61f, 0xa7cb, 0x7076, 0xce21, 0x54ae, 0xbc7b, 0x81d5, 0x720c, 0x3f2a, 0xbec5,
+    0x82a5, 0xd29b, 0x55e8, 0x6dec, 0xe2b5, 0x342a, 0x5c60, 0xab8f, 0xe0ed, 0x18d8, 0x382e, 0x7cee, 0x2858, 0xbabd, 0xd4ff, 0x866b,
+    0x9af7, 0xdb2f, 0x3030, 0x8f8b, 0x7afc, 0xd539, 0x37b4, 0x8f53, 0x2bfc, 0x4b80, 0x1734, 0x6448, 0x97c5, 0x71f8, 0x1ed2, 0xdb21,
+    0x92f3, 0x28e4, 0xcad7, 0xda25, 0xaba7, 0x7bca, 0x9a4b, 0xe7f3, 0x57dc, 0xd383, 0x6582, 0xac69, 0xdad7, 0x16f4, 0x9ceb, 0x3436,
+    0x5700, 0x7954, 0xe215, 0xaec1, 0x3c9a, 0xd5bb, 0x7a04, 0x27ea, 0x6e3a, 0x7f48, 0xdd3d, 0x1b58, 0x3654, 0x7a2c, 0x2eea, 0xcf7b,
+    0x7f24, 0xb285, 0x74e4, 0x3300, 0xa907, 0x81ad, 0x6a68, 0x9c75, 0x399e, 0x457a, 0x2d6e, 0xa0af, 0x8903, 0x41a4, 0x3026, 0x89db,
+    0x59d6, 0x2f82, 0xb261, 0xcbe1, 0x172a, 0x566e, 0x62fa, 0x1fa0, 0x2f14, 0xb44d, 0x8bed, 0xd231, 0x4762, 0x7060, 0x9a5b, 0x4bd4,
+    0x7e36, 0xb853, 0xd22b, 0x8a69, 0x6b32, 0xdfef, 0x94af, 0x6d88, 0x2b56, 0xbd4f, 0x1e42, 0x9d51, 0xcb59, 0xe71f, 0x7868, 0x6bce,
+    0xb3cd, 0xc7a5, 0x71d2, 0x9c95, 0xe58b, 0x3b32, 0xd0e7, 0xc267, 0x9c23, 0x7ad2, 0x35fe, 0xc3e5, 0x9633, 0x5198, 0xcd13, 0x66d8,
+    0x1fac, 0xc0d1, 0x5a42, 0x32f2, 0xc6ad, 0x69b2, 0x2378, 0xd5af, 0x9559, 0x218e, 0xe4e3, 0x3c2a, 0x66c8, 0x56fa, 0xe36d, 0x7dd6,
+    0x3bb6, 0xd9b1, 0x962f, 0x4a3a, 0xe4e9, 0x8a8b, 0xbaaf, 0x5b38, 0x6620, 0x8533, 0x9797, 0xc8b5, 0xb3c5, 0x5832, 0xd0cf, 0x2684,
+    0xb723, 0x1ede, 0xd455, 0x7474, 0x3b5a, 0xb1a3, 0x23c2, 0x625e, 0xbaaf, 0x7d52, 0x1d80, 0xe5cd, 0x3b4c, 0x66ee, 0xd6c3, 0x58a0,
+    0x24a6, 0x7732, 0x4ed8, 0x1658, 0x9ebf, 0x6256, 0x8bbd, 0x1e88, 0xa3e1, 0xc259, 0x304c, 0x76a0, 0xde0d, 0x9b4f, 0xc625, 0x35ae,
+    0xd62f, 0x9117, 0x9e77, 0x4b32, 0x1f06, 0xa44b, 0x47d8, 0x31d6, 0xca21, 0x5c6c, 0x2098, 0xc601, 0x84ab, 0xb0eb, 0xef43, 0x581c,
+    0x38f0, 0xa7b5, 0x8793, 0xddbf, 0x7988, 0xa7ff, 0x9259, 0x7826, 0xc71d, 0x9bdf, 0x3a2e, 0xcdd3, 0x177e, 0xb21d, 0x26b8, 0x8e45,
+    0xc6cf, 0x1cc4, 0x96ed, 0x3c64, 0x1eaa, 0x8475, 0xb25b, 0x3a90, 0x83ff, 0x6fb6, 0x4114, 0x2f6a, 0x526c, 0x8a21, 0xb3d1, 0x3f36,
+    0xa11f, 0x9639, 0x4b16, 0xd837, 0x19ee, 0x3082, 0x983d, 0x3a4a, 0x1a5e, 0x8afd, 0x2dd6, 0xa6b9, 0x1fe8, 0xdd5d, 0x4d52, 0x21ae,
+    0xac11, 0x9a9f, 0x298a, 0xc11d, 0x55e0, 0x9f83, 0xd427, 0x2356, 0x6d6c, 0x8d35, 0x52cc, 0xdb9b, 0x9d31, 0x739c, 0x42cc, 0xae39,
+    0xcc13, 0x585a, 0x6d2e, 0xa6ef, 0x43b8, 0xc457, 0x8333, 0xe105, 0xb2ef, 0xd1f3, 0xa18f, 0xbfd9, 0xe4ff, 0x2e52, 0x4438, 0x5f22,
+    0xbbb9, 0x83bd, 0x5158, 0x30c4, 0x45a4, 0x6144, 0x2292, 0xa163, 0x2f86, 0x77a6, 0x456c, 0xc917, 0x82d3, 0x59fc, 0x4bbe, 0xe3b7,
+    0x9a83, 0x3d96, 0xc5e7, 0x53dc, 0x9cc7, 0xc77d, 0x4a0e, 0xde3b, 0xabcb, 0x41e0, 0x5f20, 0x9919, 0xd103, 0xae6f, 0x6706, 0xde89,
+    0x2c22, 0x41e8, 0xe13d, 0x951f, 0x27dc, 0xbb6f, 0x5538, 0xdab5, 0xae3f, 0x91ad, 0xe569, 0x7424, 0xd1eb, 0x3dfa, 0xd7db, 0xa895,
+    0xb95b, 0xe07b, 0x7c08, 0x4eb8, 0x9337, 0xbf8f, 0x7c54, 0x9685, 0xa6f3, 0x644c, 0xe5fd, 0x3d7e, 0xacb1, 0xc30d, 0x2de6, 0xcabf,
+    0x9705, 0xde7d, 0x1e5c, 0x26fe, 0xbcbd, 0x4ba2, 0x13f0, 0xb3d3, 0xdae3, 0x8a71, 0xa663, 0x40ae, 0x9015, 0x587e, 0x18da, 0xcea1,
+    0xa507, 0x3e3c, 0x2492, 0xc869, 0x5900, 0x0e0c, 0x8e0b, 0x6d5a, 0x19ee, 0x5946, 0xddef, 0x8693, 0x2f72, 0xaf13, 0x7702, 0x3792,
+    0xd3bf, 0x881b, 0x4768, 0x93f5, 0x3db6, 0x4978, 0x86db, 0x7da6, 0xae85, 0x5a74, 0x76b0, 0xbd01, 0x81e9, 0x1ae0, 0x94d3, 0xb6b9,
+    0x6452, 0x827b, 0xa739, 0xb48b, 0x7f5a, 0x1d6a, 0x3fd6, 0x9d81, 0xe90b, 0xac83, 0x41d8, 0xdd8f, 0x3b86, 0x9c37, 0x45de, 0x6ee8,
+    0x8f4d, 0x45b2, 0x92a7, 0x5b12, 0xbb93, 0xecc5, 0x4ec8, 0x992d, 0xd2bd, 0x5dea, 0x9f93, 0xb6ef, 0x8e6b, 0xc331, 0x28a8, 0xb595,
+    0xa849, 0xd3ed, 0x8ecd, 0xbecd, 0x46d0, 0xdbf5, 0xc237, 0x7508, 0x3fbe, 0x6f36, 0xcefd, 0x6260, 0xb8d3, 0x44d0, 0x530c, 0x6180,
+    0x77ec, 0xbfd5, 0x609c, 0x6682, 0x8a03, 0xc78b, 0xebfb, 0x6fc6, 0x8f39, 0xb161, 0xb82b, 0x7814, 0x3b0e, 0x2a0c, 0x94d7, 0x7a58,
+    0xb943, 0xd745, 0x2c0e, 0x4b8c, 0xb813, 0x6054, 0xd88d, 0x32d6, 0x54ee, 0xe8cb, 0xa5a1, 0x7e92, 0x6894, 0xc3dd, 0x4be6, 0xdeb5,
+    0x6f3e, 0xbae5, 0x7d84, 0x8f67, 0x6aec, 0xa46d, 0x30c2, 0xc9cb, 0x5e9e, 0xac43, 0x9aa5, 0x7c9c, 0xe231, 0xc335, 0x1c20, 0x5568,
+    0x3498, 0xb24b, 0x3fda, 0xacab, 0xc4c7, 0x6528, 0xbcd7, 0x6292, 0xb0af, 0xe47f, 0x6962, 0x496c, 0x9223, 0xde21, 0x8673, 0x64d0,
+    0xe737, 0x4bbc, 0xb569, 0x40d2, 0x8521, 0x70dc, 0x9a51, 0x41b8, 0xbf8d, 0x7bfa, 0xb21b, 0x3984, 0xc2bb, 0x9237, 0x27c0, 0x1984,
+    0x623e, 0x9da3, 0xbe07, 0x288a, 0x8ef1, 0x5632, 0x19a4, 0x5ae4, 0x724a, 0x770c, 0x2256, 0x57ba, 0x3f96, 0x7e6a, 0xd4b5, 0x9755,
+    0x44c8, 0xea4d, 0x6e76, 0x9c4b, 0xc057, 0xe5cd, 0x80a1, 0x61ea, 0xc207, 0x8b47, 0x9ac7, 0x5414, 0x216e, 0xb86b, 0x93b5, 0xb71d,
+    0x82e9, 0x168a, 0x6038, 0x2a8a, 0x736e, 0x8725, 0x577a, 0x2dea, 0x9283, 0xcef1, 0x5238, 0xc189, 0x2bf0, 0x7128, 0x4c0e, 0x98f3,
+    0xba3f, 0x8729, 0x5cd4, 0x4eb2, 0xcdc3, 0x7452, 0x3e14, 0x8463, 0x281c, 0x5dc4, 0xbd57, 0x1c22, 0x9df3, 0xabed, 0x6462, 0x7170,
+    0x1896, 0x3f62, 0x5eb2, 0x836f, 0x2bf8, 0xe475, 0x484a, 0xd67f, 0xcb1d, 0x4df0, 0x6d52, 0x25b0, 0x8c41, 0x8039, 0x6172, 0xa15d,
+    0x3d1e, 0x6e32, 0x4e8e, 0x9d81, 0x83b5, 0xacb1, 0x52ec, 0x3bf4, 0x9b4b, 0x5946, 0x7b20, 0xe05b, 0x6ff8, 0xb90f, 0x8215, 0x3a7e,
+    0x5a2e, 0x87ff, 0xaf97, 0x6aea, 0x9ce1, 0x4826, 0xdba1, 0xa8b5, 0x389c, 0xb75b, 0xd617, 0x68c0, 0x913f, 0xbe9b, 0x555c, 0xa4d5,
+    0x812d, 0x28ae, 0xcbcb, 0xb321, 0xe61d, 0x636c, 0xc583, 0x9e85, 0x3992, 0x4ff4, 0x8d43, 0xd3af, 0xa823, 0xd327, 0x4b6c, 0x2984,
+    0xc4c9, 0x335e, 0x646c, 0x1d06, 0xcdbf, 0x6244, 0xc109, 0x3794, 0x8683, 0x4cfc, 0x1a9c, 0x704c, 0x8423, 0x28d4, 0x7ec0, 0xe389,
+    0xc9e7, 0x62b2, 0x32da, 0x9cb9, 0x1e5a, 0x8d8d, 0x7b08, 0x39b2, 0x23ea, 0xc11b, 0x7768, 0x4ea2, 0x680c, 0x3418, 0x98df, 0x8cbd,
+    0x4712, 0x37a0, 0x63c4, 0x9b7d, 0x7086, 0x31b2, 0xc9e3, 0x649e, 0xd4b3, 0x9835, 0xaed3, 0x79ec, 0x2134, 0x8439, 0xb1bd, 0xd2b7,
+    0x39e2, 0x15e4, 0xb4c7, 0x467c, 0xcbf9, 0x7db4, 0x9a91, 0x547e, 0x3f00, 0xdd49, 0x2f06, 0x5762, 0xd6c3, 0x5250, 0x9a2b, 0x1a5c,
+    0x443c, 0x66d4, 0x4d20, 0x8df7, 0xc837, 0x128a, 0x411a, 0xbcd1, 0x6bfa, 0x1fa6, 0x467a, 0xc8cf, 0x9aa5, 0x66b6, 0xa605, 0x3420,
+    0x99ad, 0x55be, 0xb0f1, 0xdd15, 0xc49f, 0x62be, 0x8d11, 0x817b, 0xd655, 0x25ac, 0xc695, 0x2a12, 0x6cc8, 0x3eca, 0xa877, 0x7968,
+    0xcccf, 0x27a0, 0x7c8a, 0x78b6, 0x90b9, 0x261e, 0x8325, 0xda47, 0x545a, 0x99e7, 0x8221, 0xc1bd, 0x5cee, 0xa34f, 0x3486, 0xad1b,
+    0x719a, 0x1614, 0x79dc, 0xb0b9, 0xdaf9, 0x1eda, 0xb70d, 0x53f8, 0x8be7, 0x2c40, 0xcaf5, 0x65ae, 0x597a, 0xe691, 0xaa0f, 0x6dba,
+    0xd33d, 0x3e38, 0x86b1, 0xd4f7, 0x6d62, 0xe9e7, 0xa02b, 0x4036, 0xc58f, 0x4e9a, 0x9263, 0x8e09, 0xc469, 0xac4b, 0xb7cd, 0x64c2,
+    0x129e, 0xae91, 0x79e6, 0x1d94, 0x9101, 0xcb5f, 0x386e, 0xa9ef, 0xd72d, 0x1be0, 0xbb39, 0xe4f5, 0x709c, 0x40a8, 0xd21f, 0x2e26,
+    0x6d20, 0xa653, 0xdb83, 0x963d, 0xe837, 0x25aa, 0xb57b, 0x6c2a, 0xa069, 0xb79b, 0x1d3a, 0x7d82, 0x904f, 0xe313, 0x4868, 0xa35d,
+    0x2272, 0x733c, 0xcc39, 0x9ecd, 0x64b4, 0x323c, 0xe0e3, 0x9a4b, 0xc263, 0x47be, 0x7f12, 0x4fc8, 0xc75b, 0x4a94, 0x2794, 0xc0f1,
+    0x968f, 0xd805, 0xae63, 0xcc15, 0xa015, 0x73f8, 0x2620, 0x397c, 0x880b, 0x1dc0, 0x9c99, 0xcdc5, 0x51dc, 0xb66f, 0xde9d, 0x19e4,
+    0x572e, 0xc087, 0xb02f, 0xe75b, 0x2fba, 0x7284, 0xd265, 0xea7d, 0x680e, 0x4602, 0x317e, 0xb215, 0x2216, 0x4700, 0xac93, 0xd96b,
+    0x7de4, 0x4974, 0xe3d5, 0x3316, 0x8723, 0xba17, 0x5d4a, 0x7a02, 0x4f48, 0x9b85, 0x249e, 0x3d8a, 0x5a26, 0x17ce, 0x3ea6, 0xe919,
+    0x9add, 0xb37d, 0x5c0a, 0x7508, 0x926d, 0x2734, 0xd077, 0x4482, 0xe041, 0xc7d5, 0x2344, 0x3fea, 0x31c2, 0x5e9e, 0x72d0, 0xa60d,
+    0x4a08, 0xd9dd, 0x906f, 0x4bae, 0xb0ad, 0x9099, 0x7d92, 0xab67, 0x2bd0, 0xcf31, 0x7ccc, 0xbe33, 0xcc87, 0x6648, 0xb3eb, 0xa0a5,
+    0x3b3a, 0xb0e1, 0xd96b, 0x47be, 0xc667, 0x698c, 0xd75f, 0xaecf, 0x70a4, 0x9071, 0x3064, 0xd903, 0xc47b, 0x56a0, 0x7b56, 0xe2cd,
+    0x7332, 0xb93f, 0xdb7b, 0x25a8, 0xae69, 0x4a58, 0x846f, 0x16bc, 0x4ed0, 0x2542, 0x43b0, 0x395a, 0xe2b5, 0x7154, 0x2882, 0x998d,
+    0x9fc7, 0x7c98, 0xec57, 0xaa41, 0x331e, 0x1f7c, 0x5cda, 0xb143, 0x1756, 0x80e1, 0x8f1b, 0x6d0e, 0xaa41, 0xccff, 0x771a, 0xde15,
+    0xc94f, 0x9681, 0x2412, 0xac21, 0x6e5c, 0x7ab8, 0xb0fb, 0x9de5, 0x66ce, 0xb5f9, 0x7ee0, 0x2a6c, 0x39a0, 0xda3b, 0x88a1, 0x6f08,
+    0x4004, 0x7db6, 0x1eb6, 0x32e6, 0x4d84, 0xdc31, 0x4404, 0x9e2f, 0x4cf8, 0xb4e5, 0x689c, 0xa6cf, 0x55a8, 0x95c1, 0xd719, 0x6780,
+    0xeb9f, 0x9f53, 0x64da, 0xe163, 0x5d3c, 0xc563, 0x4b3a, 0xa66f, 0x2fd8, 0x1d6a, 0xb617, 0x3c9e, 0x2304, 0x7500, 0xc86f, 0x3bf8,
+    0x9489, 0xd163, 0x5ec2, 0x8b8f, 0x3316, 0x6064, 0xcf8d, 0x3830, 0xec6f, 0xaa8f, 0x4492, 0x9b53, 0x1a12, 0x4bba, 0x7c9e, 0xb8c1,
+    0x4c80, 0x73d6, 0x2610, 0xad07, 0x4bd0, 0x7580, 0x31ea, 0xb327, 0x989f, 0xdd31, 0x3b0c, 0xd8b5, 0x52e0, 0x67fc, 0x2b56, 0x8427,
+    0x36ea, 0xc579, 0xd385, 0x3ac4, 0x5550, 0x728e, 0x22d8, 0x47ca, 0x6f88, 0x383e, 0x5e34, 0x3452, 0x9835, 0xa809, 0x5b3e, 0x74a0,
+    0xcfd7, 0x50ca, 0xb9dd, 0x421a, 0x82b7, 0xa741, 0x5590, 0xcfe5, 0x3550, 0x76fe, 0x4300, 0x6820, 0xbd27, 0x39d8, 0xaed9, 0xd301,
+    0x5d14, 0x3392, 0xb16f, 0x1d72, 0x90b3, 0xb7c7, 0xab63, 0x15d8, 0x6ca4, 0xe051, 0xa90d, 0x2f9a, 0x78f0, 0x8d6f, 0xe2db, 0x880d,
+    0x4f1a, 0x6b96, 0x1d6a, 0x349e, 0x5c34, 0xc6bd, 0x8eb3, 0x65fe, 0xb1b9, 0xdae3, 0x83e9, 0xbd13, 0x6524, 0x411a, 0x307e, 0x87b3,
+    0xd5b5, 0x786a, 0x35aa, 0x95f7, 0x60ca, 0x432c, 0xa14d, 0x883f, 0x20c6, 0xc34f, 0xd867, 0x8ee5, 0x5d26, 0xd1a5, 0x989f, 0x2f9a,
+    0xb27d, 0x1f30, 0xc8d7, 0x765e, 0xd1bf, 0x92fd, 0x2d0a, 0xca1b, 0xe835, 0x89f5, 0x7014, 0xac83, 0xe29f, 0x90ef, 0xc4f3, 0x67f8,
+    0x49ac, 0x3286, 0x6588, 0x1820, 0xb625, 0x4898, 0x7d90, 0x0ec8, 0x6bf0, 0x8c07, 0x95bd, 0x7b66, 0xe689, 0xb7e7, 0x8afd, 0xc9cb,
+    0x95ab, 0x6068, 0xbf23, 0x3c96, 0xde23, 0x4f8e, 0xd099, 0x579c, 0x6248, 0xace3, 0x9303, 0x557c, 0x4e06, 0xe4df, 0x1b1a, 0x4bac,
+    0x2340, 0x7dc0, 0x88d7, 0x6afa, 0xa113, 0x4864, 0x2ffa, 0x81a7, 0xe54b, 0x4918, 0x5764, 0x2048, 0xadc7, 0xcfed, 0x403c, 0x1972,
+    0xa823, 0x30fe, 0x7bca, 0x5384, 0x97d9, 0xebb3, 0x70f6, 0x9f2d, 0xb519, 0xdfe9, 0x93a1, 0xcbbb, 0xa985, 0xc0b5, 0x5712, 0xd90f,
+    0x497e, 0x2afa, 0x8c1f, 0x51fa, 0xa179, 0xd6c9, 0x3f4e, 0xc8b5, 0xa5cd, 0xd1ab, 0x49e4, 0xb881, 0x2210, 0x8625, 0x5c98, 0x36b0,
+    0xaead, 0x767a, 0xccff, 0xece3, 0x3270, 0x4e86, 0xda6b, 0x2618, 0x8b53, 0xe1a1, 0x5ff2, 0xb9cf, 0x941d, 0x4dc2, 0x1f54, 0xcf5b,
+    0xc2c1, 0xe823, 0x6216, 0x9dc7, 0x713a, 0x1888, 0xb3e3, 0x841b, 0x6b78, 0x3262, 0x8c67, 0xe7c1, 0x4264, 0xb379, 0x2de8, 0x4948,
+    0x6b1e, 0x4b8e, 0xbc01, 0x3bec, 0xae8d, 0x33f0, 0x7130, 0x9085, 0xc561, 0x639e, 0xd5c3, 0x8c7d, 0xe329, 0x503c, 0xbe07, 0x50fa,
+    0x8765, 0xe0ab, 0x4410, 0x5394, 0xc231, 0xada5, 0x7e5e, 0x4816, 0xa0c1, 0x5dea, 0x8313, 0x7c6c, 0xcd03, 0x8acf, 0x3c2e, 0xc887,
+    0x97d3, 0xe783, 0x58de, 0x3744, 0xca9f, 0xa207, 0xbb8b, 0x8813, 0x563e, 0x26de, 0x603a, 0xb32f, 0x1802, 0x463c, 0xe181, 0xa80d,
+    0xd605, 0x50f8, 0x6330, 0x835d, 0xb7e9, 0xdbf9, 0x9b0f, 0x80fb, 0xe7c3, 0xa0ff, 0xb4c3, 0x86b7, 0xdaa7, 0x6ff8, 0xbf09, 0x21f0,
+    0x9835, 0x3604, 0x8253, 0x239e, 0xc339, 0x3f80, 0x98c7, 0x824b, 0x1852, 0xde7d, 0xb2cd, 0xd78b, 0xa123, 0x53d8, 0x1b34, 0x7cd4,
+    0x98d7, 0x4c48, 0xeb4d, 0x6cbe, 0xcab7, 0x4950, 0x744c, 0x5808, 0x5190, 0x9f07, 0x3b30, 0xd72b, 0xb6cd, 0x5d7c, 0x3350, 0xa613,
+    0x47e4, 0xcaf9, 0x9259, 0x7450, 0xb213, 0xe4bd, 0x514e, 0xb37b, 0x7aac, 0x44c2, 0x2f40, 0x2326, 0x93fb, 0xd84b, 0x75d8, 0xa0d7,
+    0xb3b9, 0x2192, 0x450e, 0x86c7, 0xc501, 0xd7a3, 0x2894, 0x8ed1, 0xb567, 0x44f0, 0x9965, 0x4fd0, 0x1d5e, 0xc601, 0x7160, 0x50a0,
+    0x68ee, 0x901f, 0x9d63, 0x4bee, 0x205a, 0x37c2, 0xa9af, 0x6582, 0x1d36, 0x337a, 0xb94b, 0xd125, 0x824d, 0xad31, 0x25ce, 0x7276,
+    0xaa81, 0xca15, 0xe1b5, 0x4208, 0xda27, 0x9b99, 0xb33f, 0x5766, 0xab25, 0xb797, 0x2ef6, 0x6068, 0xb101, 0x3b58, 0x1aea, 0x6a26,
+    0x1b2e, 0x77c0, 0xafcd, 0x6efe, 0x2afc, 0x9361, 0x1ba8, 0x7c38, 0xc751, 0xe55b, 0x1cce, 0x3604, 0xa99b, 0x9319, 0x97d9, 0x6b68,
+    0xc06f, 0xe48d, 0x5e00, 0x1f84, 0xb337, 0xc63d, 0x53c6, 0x1b96, 0xa2dd, 0xcb71, 0xbc13, 0x7b1e, 0x955b, 0x2e88, 0x8bc1, 0x643a,
+    0xd39b, 0x93eb, 0x3fe6, 0xcfad, 0x5f16, 0xab5f, 0x3802, 0xca33, 0x7d7c, 0x5c70, 0xb6d3, 0x62f8, 0x3ef2, 0x74e0, 0x2432, 0xaa7b,
+    0x6678, 0xc84d, 0x643a, 0x6c58, 0xc4a1, 0x894b, 0x645a, 0x333a, 0x85a5, 0x5494, 0x3054, 0xe963, 0x8067, 0x2800, 0xb349, 0x4b9e,
+    0x84f3, 0x2274, 0x3f6e, 0xa4d5, 0x5858, 0x92df, 0xd25d, 0x4450, 0x776c, 0x337a, 0xa6fb, 0x7010, 0xd581, 0x8239, 0xab05, 0x6162,
+    0x9439, 0x2d4e, 0x8ef5, 0xcd61, 0xafa5, 0x6362, 0xd195, 0x27c2, 0xc6c7, 0x52b4, 0x9787, 0x7e74, 0x1f52, 0xc9eb, 0x83fb, 0x8a5d,
+    0x186e, 0xa9f7, 0x813b, 0x1970, 0x9ed7, 0xd8c1, 0x6afe, 0x3eec, 0xe721, 0x6f30, 0x59f6, 0xa96d, 0x91c7, 0x6b58, 0x9743, 0x22c6,
+    0xa0e9, 0x33ee, 0xb421, 0x9865, 0x6f76, 0xd747, 0x21f0, 0x7028, 0xc829, 0x1e04, 0xda85, 0xb9df, 0x2b7c, 0xa15b, 0xdb2f, 0x5f84,
+    0x171c, 0xaa51, 0xbbab, 0x8e63, 0x8547, 0x56de, 0x19ba, 0x67c2, 0xd277, 0xab4b, 0x771a, 0xc50b, 0x93fd, 0xca23, 0x7f66, 0x5972,
+    0x712a, 0x9273, 0xb615, 0x35fc, 0x9963, 0x1c90, 0xcd97, 0x5786, 0xbfb5, 0x23da, 0x77c0, 0x4400, 0x28ee, 0x9917, 0x4a18, 0xb661,
+    0x6162, 0xded3, 0x6ee4, 0x9ec1, 0x5dfe, 0x6a34, 0xdfe3, 0x6316, 0xbd87, 0x5a14, 0x8f87, 0x2d54, 0x38ae, 0x8531, 0xe043, 0x6f06,
+    0xd5cd, 0xc295, 0x8731, 0x217e, 0x5914, 0x82c5, 0x3b0a, 0xc343, 0xcf67, 0x84df, 0x1e14, 0x90ad, 0x6bd4, 0xc921, 0x1ed6, 0x9e8f,
+    0xb7d1, 0x33e8, 0xe49d, 0x4a46, 0x2f46, 0x7f8a, 0x1696, 0x2b32, 0xce0b, 0x60f0, 0xa1a1, 0xe5d3, 0x581c, 0x8b7f, 0xc10f, 0x4ec8,
+    0x69b8, 0x94e5, 0xdddf, 0x5c60, 0x1a5c, 0xa785, 0x4fec, 0x5a0e, 0x7dd2, 0xa3ef, 0x7378, 0xe4df, 0x7c12, 0xa477, 0x3e24, 0xe33b,
+    0xb4a5, 0xd4d9, 0x4426, 0x5c42, 0xb4a5, 0x729a, 0xdaf5, 0x85fd, 0xbcd9, 0x8d33, 0x56fa, 0x29da, 0x426a, 0x392e, 0x9f65, 0xd32f,
+    0x2984, 0x8b51, 0x84f7, 0x9cbb, 0x596c, 0x6ee0, 0xcc09, 0x34cc, 0xd9a1, 0x5e14, 0xcc93, 0x4eb6, 0xc481, 0x98ad, 0x4fec, 0xd435,
+    0xea79, 0x4814, 0x3616, 0xc9e9, 0x88c5, 0x69e0, 0xba15, 0x34fa, 0x442e, 0x8b0b, 0x6daa, 0xd623, 0x7c52, 0x2fac, 0xcb01, 0x49d2,
+    0x9f4b, 0x555c, 0xcc63, 0x90df, 0x30d4, 0xd489, 0x8f1b, 0xb11d, 0x6480, 0x4e4a, 0x8aad, 0x3c8a, 0x6d72, 0xb457, 0xe4a9, 0x5dfc,
+    0xc4a1, 0x4c4a, 0x73b2, 0xc373, 0x1bce, 0x7f92, 0x28e0, 0xd405, 0x41e8, 0x26fe, 0x6f74, 0x18a8, 0x8a87, 0x54aa, 0xdfc1, 0x8899,
+    0x3076, 0xc02b, 0xdb5f, 0x1ade, 0x3ff2, 0x920b, 0xc18b, 0xe2a3, 0x737c, 0xb0b5, 0x5fde, 0xa1a5, 0xc719, 0x46b4, 0xdefd, 0x95dd,
+    0xd74d, 0x5f72, 0x7cb0, 0xbed7, 0x8775, 0x2e72, 0x6170, 0xada7, 0xc7ad, 0x4f84, 0xcbf9, 0x18d6, 0x45ee, 0x9c15, 0x2b98, 0xbfb9,
+    0x6af4, 0x4678, 0xd547, 0x56e8, 0x7d56, 0x32d0, 0x8cf3, 0x5f0e, 0xe07b, 0xad0d, 0x214a, 0xd253, 0x63d0, 0xa331, 0xbb97, 0x3928,
+    0xcb0b, 0x9c7d, 0xd845, 0x612e, 0x8779, 0xb195, 0xb9af, 0x1850, 0x985b, 0x28ee, 0x9b6d, 0x316c, 0x1842, 0xcb19, 0x49b0, 0xd4df,
+    0x7190, 0xc319, 0x7770, 0x17e2, 0x3666, 0x8c0f, 0x3d48, 0xb5a1, 0x9211, 0x2cca, 0x5244, 0x45b0, 0x6bfe, 0xb069, 0x5788, 0x2a78,
+    0x6858, 0x8ac3, 0x4bcc, 0x24a2, 0xdc2d, 0x4726, 0xd2b7, 0x3512, 0x508e, 0x98a1, 0x42cc, 0x7eee, 0x2fe8, 0x6024, 0x3a14, 0xb9c5,
+    0x2960, 0x1d7a, 0x8013, 0xe189, 0x6e88, 0x408a, 0xabbd, 0x60c6, 0x35aa, 0x8c0b, 0xcea1, 0x5cbc, 0xcc21, 0x345e, 0x80dd, 0x923f,
+    0x3cea, 0x76f0, 0xb45b, 0xde45, 0xbfe1, 0x2ff4, 0xaabd, 0x278c, 0x890b, 0x4132, 0x7138, 0xc523, 0x7568, 0x52ee, 0xa971, 0x300a,
+    0x2014, 0x51ec, 0x9ef3, 0x3d5e, 0xd7f9, 0xa21f, 0xe1ab, 0xb25f, 0x2cbc, 0x70da, 0xb93b, 0x50c6, 0x3e90, 0x7ea2, 0xdfeb, 0x7068,
+    0x6266, 0x81f3, 0xb887, 0xa049, 0x66e4, 0xacc1, 0xd573, 0x9679, 0x8f1d, 0xc2d7, 0x7108, 0xb609, 0x2d32, 0xa15d, 0x1eee, 0x39aa,
+    0xe4a5, 0x30b6, 0xcc15, 0xb9a9, 0x67b4, 0x854b, 0xb859, 0x3aa2, 0xdd75, 0x2ccc, 0x5184, 0xb539, 0x32f4, 0x8b2f, 0x585c, 0x1d00,
+    0x76f2, 0x33c4, 0xbc07, 0x8759, 0xee07, 0x94e3, 0x4db4, 0x9a1d, 0x4504, 0x64f6, 0xe273, 0x94bd, 0x6b0e, 0x8795, 0xb75b, 0x59e8,
+    0x4368, 0x93cf, 0x5f9a, 0x39a6, 0xb9cd, 0x26a0, 0x9061, 0x6f9a, 0x41a6, 0x8899, 0x22a0, 0x778e, 0x7a12, 0xd9fb, 0x2c22, 0x8811,
+    0xa73d, 0x5fc0, 0xd4b7, 0x9dcf, 0xb41d, 0x5c4c, 0xe151, 0x7b94, 0xaa31, 0x2d38, 0xb303, 0x5832, 0xbf81, 0x5d46, 0x89b7, 0xd22f,
+    0x1f2e, 0x84cd, 0x39be, 0x683a, 0x7a4a, 0x417a, 0x72f6, 0xe10b, 0x3588, 0x238c, 0xdd85, 0xd453, 0x542e, 0x4dfa, 0x9fa9, 0x34ba,
+    0x847b, 0x283a, 0xa415, 0xe58f, 0x6a4c, 0xb61d, 0x4ee8, 0x6bc6, 0x8e13, 0xc203, 0xa9fd, 0xd489, 0x3922, 0xaf99, 0xce99, 0x6ee2,
+    0x3f8e, 0x95df, 0x854d, 0xa831, 0x28b0, 0x59a6, 0xa677, 0x48c2, 0x2516, 0xc65b, 0x3bcc, 0x6e3c, 0x5ec8, 0xa2fd, 0x6970, 0x195c,
+    0xb823, 0x594a, 0xd8b1, 0x2196, 0xb5eb, 0xe163, 0x723a, 0x19c0, 0x9423, 0x3794, 0x9d73, 0x767e, 0xe1db, 0x6c96, 0x859f, 0x3e0a,
+    0x795c, 0xa53f, 0x1e98, 0x3930, 0xbc87, 0xdd89, 0x50c0, 0x96dd, 0x4244, 0x7d66, 0xb46b, 0x3fa8, 0x6eee, 0x4918, 0x5b56, 0xe00f,
+    0x3e3c, 0x4f1e, 0x314e, 0x6e3c, 0x3c7a, 0x4b98, 0x55c0, 0x80b5, 0xd095, 0x4f6c, 0xb42d, 0x809d, 0xbbb9, 0x628a, 0xaca1, 0x8eab,
+    0x37a2, 0x5e48, 0x4b46, 0xa3fd, 0xe5e1, 0xc09b, 0x5940, 0xe29b, 0x6de0, 0xbeed, 0xa949, 0x9c07, 0xc669, 0x3e02, 0x82bd, 0xbf49,
+    0x4b5e, 0xd42f, 0x6684, 0xc16d, 0x74d4, 0xa6db, 0x92a7, 0xb539, 0xc3ed, 0x2462, 0xdadf, 0x6398, 0xd387, 0xa977, 0x8b47, 0xe5d9,
+    0xacc1, 0xcc1f, 0x5052, 0x414e, 0xc049, 0x7482, 0x2450, 0x8719, 0xa4cd, 0x4558, 0xb665, 0x6ed2, 0x8f37, 0xaf19, 0xe6af, 0x72bc,
+    0xc78f, 0x26e2, 0x4b36, 0x199c, 0x8769, 0x48ca, 0xd269, 0x776c, 0xa4af, 0xbc15, 0xe887, 0x26e0, 0xaef9, 0xc773, 0x9541, 0xbcc9,
+    0x5c7a, 0x88a9, 0xbcd7, 0x7010, 0xb1ab, 0x61ec, 0x1d22, 0x4a68, 0x89ed, 0x639c, 0xec17, 0xced7, 0xa1ad, 0x2a92, 0xc191, 0x390a,
+    0x965d, 0x543e, 0x19e6, 0xd49f, 0x5e86, 0xc863, 0x4590, 0x5014, 0xa61d, 0x2792, 0x3552, 0x9063, 0x754e, 0x46b4, 0xce27, 0xbd01,
+    0x8551, 0x6f16, 0x4354, 0x86b7, 0x35f8, 0xe233, 0x499c, 0x937b, 0xd651, 0x7bf6, 0x1898, 0xbe01, 0x4ba0, 0xd5db, 0xb93b, 0xc859,
+    0x4858, 0x6f36, 0xa163, 0x2846, 0xc33b, 0x1cb0, 0x4cf0, 0x325c, 0xb141, 0xd3c9, 0x7a96, 0x197a, 0xc069, 0xe0bf, 0x326a, 0x7b7e,
+    0xe2f5, 0x1e4a, 0xcc37, 0xb5ad, 0x6b3e, 0x1e4a, 0xe575, 0x4af8, 0xbebd, 0xa153, 0xc9cb, 0x3c8e, 0x9cfd, 0x64e4, 0x4094, 0xbc6d,
+    0xac73, 0x232c, 0x7374, 0x3b78, 0x1dde, 0x47e0, 0xa65b, 0xcf8d, 0x9aab, 0x5ec8, 0x7cee, 0xa0bb, 0x3d6a, 0x2090, 0xaa1b, 0x59b0,
+    0x728a, 0xc89b, 0xacf9, 0xc109, 0xecfb, 0xa0e3, 0x49b0, 0x9ccf, 0xbed1, 0xa505, 0x79d8, 0x9be7, 0x3130, 0xc043, 0x23aa, 0x76b6,
+    0xb56d, 0xdb41, 0x8e2b, 0x33b2, 0x4446, 0x8edd, 0xac51, 0xdd81, 0x2272, 0x85e9, 0x56e8, 0xe82b, 0x8395, 0x5f00, 0x9a6d, 0x1ec4,
+    0xcdc3, 0x5570, 0x9f0f, 0x3f06, 0xdefb, 0xcfd5, 0x7554, 0x1d58, 0x8a77, 0xe59f, 0x8303, 0x1ed0, 0xcf87, 0x35a6, 0x7c72, 0x9c6d,
+    0x3d5e, 0xa0e1, 0x946b, 0x415e, 0x673e, 0x440c, 0xa215, 0x87f3, 0xe005, 0x6832, 0xbabf, 0x58b8, 0x347a, 0xbae3, 0x511c, 0xda57,
+    0xb659, 0xd57b, 0x99dd, 0x708e, 0x89bf, 0x28f2, 0xa34b, 0xc3df, 0x6a9e, 0x28c6, 0x5b5c, 0x9573, 0xce71, 0xb283, 0x265e, 0x892d,
+    0x6b78, 0xa285, 0xc3ed, 0xbe69, 0xe8ed, 0xc8e7, 0x2798, 0xa62d, 0xe407, 0x8a3d, 0x3fe8, 0xe459, 0x728a, 0x4264, 0x2dee, 0x7d16,
+    0xe9ab, 0x9a93, 0xd5e1, 0x8087, 0x53d8, 0x7296, 0x2cc6, 0x9e37, 0x8045, 0x3eba, 0x783a, 0xe477, 0x1ee0, 0x6256, 0xa80d, 0x9e03,
+    0xe507, 0xb015, 0x3948, 0x9981, 0x2cf0, 0x54ae, 0x9295, 0x6998, 0x7a38, 0x89d9, 0x7816, 0xb423, 0x4e3e, 0xae1f, 0x13b8, 0x6798,
+    0x4912, 0x8a2f, 0x5dc4, 0xa66f, 0xcd83, 0x94b1, 0x5624, 0xdabf, 0xedd1, 0x6bc0, 0x1b82, 0xd907, 0x39ca, 0x51d6, 0x1c56, 0x4a4e,
+    0xdbb1, 0xa947, 0x978f, 0x8023, 0x3aee, 0x6ed4, 0xe4bd, 0x2440, 0x4824, 0x38da, 0x98e1, 0x7a24, 0x63de, 0x44ce, 0x1af2, 0xd97f,
+    0x7cda, 0x3c0a, 0xdb21, 0x1a7c, 0xc2fb, 0x2f96, 0x7cda, 0xd533, 0xa4eb, 0x3cba, 0x315e, 0x94df, 0x5870, 0x8b01, 0xaf17, 0x4618,
+    0xdfcf, 0xcd55, 0x7ab6, 0x3e82, 0x1e66, 0x8f1f, 0x79de, 0x3202, 0x6baa, 0xdc91, 0x509c, 0xd453, 0xc527, 0x5e48, 0x6974, 0x95c9,
+    0x563a, 0x9e9d, 0xaf0f, 0x512a, 0x961d, 0xd593, 0x1afe, 0x61d4, 0xa5ad, 0x4306, 0xd639, 0x7032, 0x9205, 0x7a12, 0x28a6, 0x9b67,
+    0x86b3, 0xe167, 0x53fa, 0x611a, 0x3b66, 0xa4f3, 0x7a2a, 0xce83, 0x86e5, 0x2506, 0x9989, 0xabb7, 0x4234, 0x8aef, 0x601e, 0xcb37,
+    0xaef5, 0x6d32, 0x4bf2, 0x9529, 0xd8ef, 0xaa01, 0x86e5, 0x62be, 0xab6d, 0x6a38, 0x618a, 0xb09f, 0x297a, 0xcd7f, 0x8d2b, 0x673e,
+    0x3938, 0x8955, 0x5812, 0xa97b, 0xe7e9, 0x8015, 0x2d76, 0x20ca, 0x4a2a, 0xdf05, 0x226a, 0xd19d, 0x8b69, 0xbf9f, 0xe771, 0x3560,
+    0x9931, 0x2c0e, 0x3dd4, 0x5e8e, 0x557e, 0x1446, 0x2650, 0xc9fd, 0x60a0, 0x4182, 0x15ae, 0x69a4, 0xb79f, 0x9491, 0xe39d, 0x7056,
+    0x465a, 0x6394, 0x13a4, 0x55dc, 0xcd05, 0x79dc, 0xba17, 0x35da, 0x96f5, 0xd0a1, 0x40fe, 0x6aae, 0xb7c1, 0x2cf4, 0x43aa, 0x8d97,
+    0xeaa9, 0x27cc, 0x67b0, 0x88cf, 0x6a42, 0x98df, 0x4276, 0xd02d, 0x5f4a, 0xad89, 0xa101, 0xb4cd, 0x56c0, 0x8d07, 0xc5c1, 0xece7,
+    0x6b62, 0x26f4, 0xc53d, 0x3496, 0x9eb9, 0xc7a9, 0x5c6e, 0xbbfb, 0x46cc, 0x2136, 0xd841, 0x7f96, 0xa449, 0xcde9, 0x8455, 0x1732,
+    0x5306, 0x3080, 0x637e, 0xc131, 0xd865, 0x596c, 0x3884, 0x76b2, 0xe957, 0x8fb1, 0xd2d1, 0xa7e9, 0x3704, 0xe8d7, 0x779c, 0xa09f,
+    0xd097, 0x28a6, 0x5cd6, 0x8819, 0x22d0, 0x96d9, 0x7606, 0x3368, 0x6d3c, 0x5dce, 0x1d30, 0xcea3, 0x8581, 0xa773, 0xc6b5, 0x50a8,
+    0xabd9, 0x2a30, 0xb9c3, 0x2198, 0x91eb, 0xaf73, 0xc7f1, 0x19f2, 0x4d3e, 0xce07, 0x2b00, 0x5f0c, 0x8abb, 0xd323, 0x5010, 0x1b60,
+    0x7780, 0x257a, 0x88f9, 0x4c58, 0xda83, 0xca5f, 0x229e, 0xe241, 0x46e4, 0x282c, 0xcc01, 0x393e, 0x1e34, 0x76b4, 0x5276, 0x95af,
+    0xc615, 0xd6cf, 0x3474, 0x964b, 0x204e, 0xd82f, 0x3b34, 0xb5e3, 0x5322, 0x2644, 0x921b, 0xb093, 0x7902, 0xc4bb, 0xb7c1, 0x9b51,
+    0x7ddc, 0x34b2, 0x62de, 0xd935, 0xb9b5, 0x5b4a, 0x9bf3, 0xaba1, 0x6b2c, 0xd6a7, 0x5904, 0x2f5e, 0xcfe3, 0xa193, 0x6be2, 0x432c,
+    0xcdf9, 0xa371, 0x693c, 0x47c2, 0x961d, 0x5736, 0xbae1, 0x7404, 0x53ec, 0xdb3b, 0x80d1, 0x13a4, 0x78cc, 0xd23f, 0x67ec, 0x1c1a,
+    0x7286, 0x33c6, 0xa909, 0xbefd, 0x7220, 0xb431, 0xec4d, 0xc577, 0x9fe9, 0xc12f, 0x7a98, 0x1e82, 0xa027, 0xa0fb, 0x2814, 0xdcef,
+    0x3300, 0x1466, 0xd865, 0x6422, 0x2978, 0xb071, 0x709c, 0x8d77, 0xc2f3, 0x500e, 0xac83, 0x8a01, 0x35ee, 0xde55, 0x536a, 0x60a4,
+    0x240a, 0xafcb, 0x95b1, 0xd13d, 0x7fd8, 0x8f9d, 0xdf4b, 0xbffb, 0x6998, 0x4b30, 0x3802, 0xc8a5, 0x5d76, 0x48d8, 0x1ce4, 0x95b5,
+    0x3e5a, 0xb925, 0x2ef0, 0x7458, 0x4002, 0x99d7, 0x51b8, 0xc63b, 0x1914, 0x2bfe, 0xdc7b, 0x8c25, 0x7984, 0xe591, 0x1d70, 0x4a92,
+    0xc8cf, 0xe96f, 0xbd67, 0x6b60, 0xcf9d, 0x9853, 0x6e24, 0xc14f, 0x8887, 0x70d0, 0xbf53, 0x56b8, 0x701e, 0x91cb, 0x4c72, 0x683e,
+    0xbb5d, 0xd8c9, 0x7dfa, 0x9ab3, 0xd5f9, 0x84ef, 0xb18f, 0x74ce, 0x7aba, 0x956f, 0xe653, 0xb0b3, 0x3f4c, 0x6210, 0x95db, 0x5736,
+    0xcddb, 0xc2a1, 0xac45, 0xa055, 0xd837, 0x22e2, 0x3a42, 0x5ac2, 0x70a6, 0xb2b1, 0x3090, 0x1f0a, 0x9293, 0xdf03, 0x6f68, 0xaf4f,
+    0x65c8, 0xb4bd, 0x4f8e, 0xd811, 0xb0d9, 0x2eac, 0x7f46, 0xc4f1, 0x628e, 0x40ce, 0x2ac0, 0x7062, 0xcc6b, 0x6114, 0x2510, 0x45b4,
+    0x5874, 0x8091, 0xb99f, 0x7664, 0xd425, 0x2996, 0x8bb3, 0x2ff4, 0x5e5e, 0xab17, 0x8a67, 0x2744, 0x3858, 0x58f6, 0x953f, 0x7600,
+    0xb5a9, 0x84cf, 0x90bb, 0x1e7a, 0x5086, 0xa2c7, 0xcb67, 0x1894, 0xb06b, 0x4cd6, 0x1f44, 0x8311, 0x4ad8, 0x65b0, 0x17b4, 0xb6b7,
+    0x52ee, 0xde0b, 0x7e80, 0x421c, 0x65d2, 0xab41, 0xd1e9, 0x44fe, 0xc219, 0xb695, 0x8e67, 0x556a, 0x26b8, 0x992d, 0xdf0d, 0x1b6c,
+    0x71aa, 0x5448, 0x4028, 0x660a, 0xdceb, 0x35ca, 0x6398, 0x9bdf, 0xb6dd, 0x7446, 0xad8b, 0xbd81, 0x7ad6, 0x38aa, 0xb7b9, 0x6a96,
+    0xcb5d, 0x5cb6, 0xc379, 0x7dea, 0xb555, 0x763e, 0x374c, 0x8551, 0xbfa5, 0x62a6, 0xa9d7, 0x9ae1, 0x8d63, 0xedbb, 0xd00d, 0x4228,
+    0x754a, 0x2496, 0x6cee, 0xba6d, 0x449e, 0x6986, 0x7dfa, 0x9dab, 0xc2b7, 0x5a84, 0x8981, 0xce9b, 0x42ea, 0x66d8, 0x875d, 0x265c,
+    0x5ce0, 0xbd09, 0x48ea, 0xe68d, 0xa29f, 0x1f7c, 0xbfa9, 0x47c2, 0x87a9, 0xc253, 0x785e, 0xb417, 0x41f0, 0x89c3, 0xb03d, 0x59e0,
+    0x9721, 0x21e4, 0xb8c5, 0x8ce1, 0xe7c3, 0x4148, 0xd05f, 0x9459, 0x2164, 0xbfc7, 0xaf8f, 0x713e, 0xdd0b, 0x3a7c, 0xb755, 0x9289,
+    0xca7f, 0x8027, 0x50e4, 0x949f, 0xd5c5, 0x490e, 0x2856, 0x550a, 0x1816, 0x8d73, 0x6104, 0x3468, 0xe66f, 0x528a, 0x8141, 0xcacd,
+    0xb0d1, 0x4712, 0xc955, 0x8499, 0xe34d, 0x5d00, 0x3820, 0xb6cf, 0x3092, 0x69fe, 0x2088, 0x5cae, 0xb57f, 0x44c8, 0xa35f, 0xc561,
+    0xd575, 0x416a, 0x2fe4, 0x630c, 0xbc09, 0x4864, 0x28c4, 0x3b60, 0x91a3, 0xea95, 0x83dd, 0x7282, 0xdde3, 0xba25, 0xa3af, 0xd6f3,
+    0x5148, 0x8dbb, 0xdd25, 0x5e1e, 0x1d10, 0xba01, 0x3464, 0xd367, 0x804b, 0x9d05, 0x4f94, 0x3c38, 0xaa7b, 0x5618, 0x99c1, 0xb74f,
+    0x7290, 0x806b, 0x1770, 0x3cf2, 0x2b02, 0xaed1, 0x5f36, 0xd8e3, 0x443c, 0xa62b, 0x2dfa, 0x3604, 0xb065, 0x2e62, 0x74a2, 0xc1a5,
+    0x9047, 0x5396, 0x1b50, 0x6e40, 0xc051, 0x3784, 0xa01b, 0xd865, 0x39dc, 0xc6b3, 0x53ca, 0x81bd, 0x3720, 0xc631, 0x2738, 0x9f47,
+    0x3db8, 0x299c, 0x792a, 0x6fcc, 0x55d4, 0xaa57, 0x87df, 0xdad5, 0x4ed6, 0xc5ef, 0x7e70, 0xa773, 0x5e8a, 0xbf75, 0x3ca8, 0xcc85,
+    0x7eae, 0x35ea, 0xa7f1, 0x73e4, 0x1b62, 0x4c9c, 0x9689, 0xece5, 0x32c4, 0x7c4e, 0xbf7b, 0x9a79, 0x3bae, 0xaf7b, 0x8db5, 0xac41,
+    0xcda1, 0x9bc9, 0xe09f, 0x63ce, 0x4c5e, 0x7f0c, 0xbf1f, 0x784c, 0xdce5, 0xa519, 0x4ec2, 0xcec9, 0x7586, 0xe251, 0x2a7a, 0xcd51,
+    0x4d04, 0xc897, 0xe8f5, 0x3df6, 0xb0d9, 0x7fdc, 0x9289, 0x3d76, 0x6890, 0xc3a5, 0x6d2e, 0xbc91, 0x4608, 0xc6c1, 0x8fd3, 0x376a,
+    0xae87, 0x9e45, 0x3496, 0xc741, 0x4ffe, 0xe1f9, 0x6070, 0x2960, 0x7f02, 0xdaa1, 0x3324, 0x7908, 0xb68d, 0x3a16, 0x6bba, 0x8b7f,
+    0xcce9, 0xa4a7, 0xb98d, 0x887b, 0xc7a1, 0x46dc, 0x7a12, 0xeaa1, 0x5ad0, 0x39e0, 0x96a5, 0x2100, 0x4638, 0x9d63, 0xe201, 0x428e,
+    0x8201, 0x54d8, 0xe55d, 0x14ca, 0x6556, 0x5898, 0xa005, 0x2fa0, 0xb431, 0xdde1, 0x4fc6, 0x7d6a, 0xc9bd, 0x64ee, 0x33f8, 0xb411,
+    0x62ae, 0xa483, 0x904d, 0xebe7, 0x5502, 0x2f08, 0xaac7, 0x205c, 0x3b8e, 0x6a36, 0xbab5, 0x302e, 0x1de0, 0xe09d, 0x7770, 0x3eec,
+    0xdc55, 0x92e3, 0x723c, 0x2b4c, 0x505a, 0x78ba, 0x3542, 0xd7a1, 0x9c8b, 0x135a, 0x46d8, 0xaddb, 0xddc9, 0x62ba, 0x302a, 0xe335,
+    0x85e1, 0x438e, 0x2e96, 0xa085, 0x7a94, 0x219e, 0xa9f9, 0x375e, 0x816d, 0x4be0, 0x5bac, 0xc441, 0x4586, 0x485e, 0x9ab1, 0x6000,
+    0xe519, 0x44ea, 0x60c2, 0x1fec, 0x9995, 0x3846, 0x726e, 0x8deb, 0xc95b, 0x478c, 0xafd9, 0x740a, 0xccc3, 0x2c6e, 0x3c92, 0x740a,
+    0x93ff, 0x6142, 0x75ca, 0x28e8, 0x977b, 0xa1b9, 0x504e, 0xc913, 0x81cb, 0xec85, 0xa181, 0xd35f, 0x7df0, 0x819f, 0x1ec2, 0x68b0,
+    0x8f4d, 0x7aa0, 0xb66d, 0xe765, 0x1d76, 0x9421, 0xa4b1, 0x5ee8, 0x1ff0, 0xc139, 0xa601, 0x2ebe, 0x8daf, 0x7a4c, 0x36a8, 0x6a00,
+    0x1f92, 0x9b17, 0xb36f, 0xcc1b, 0x6aa2, 0xe5bf, 0x733e, 0x3e6a, 0xb135, 0x9455, 0xd707, 0x6bb0, 0xbd2b, 0x2744, 0x7c3c, 0xd5b5,
+    0x2e94, 0x5480, 0x9919, 0xa7bd, 0x724a, 0x39c6, 0x5120, 0x9d6f, 0x7fb0, 0xc217, 0x7338, 0x9d4d, 0xddaf, 0xdcf7, 0x1684, 0x3dcc,
+    0x5fa4, 0xe0cd, 0xab87, 0x3b84, 0x655a, 0xde2b, 0x463c, 0x568a, 0x232e, 0xb4b1, 0x22ae, 0x9ce5, 0xddc7, 0x7f34, 0xb1ad, 0x8d01,
+    0xd87d, 0x935b, 0x4800, 0xeb33, 0x856f, 0x3270, 0xc4c1, 0x93c1, 0x1c6e, 0xe307, 0x6ba2, 0xd2c3, 0x97e9, 0x1a72, 0x4a16, 0x7a32,
+    0x231e, 0x9533, 0xe3dd, 0x43a2, 0xc03d, 0xcffb, 0x702c, 0xac47, 0x179c, 0xc9db, 0x5c1a, 0xe1cf, 0x20ac, 0x754a, 0xda73, 0x6bc8,
+    0x181c, 0x38e6, 0x2fd6, 0xb6d7, 0x1430, 0xad95, 0xead7, 0x3d58, 0x6f9a, 0xc265, 0x38c0, 0xbff7, 0x93bd, 0xae5d, 0x628c, 0x3964,
+    0x99e3, 0x5c6e, 0x2c74, 0x708a, 0xd85b, 0x6a4a, 0x30f8, 0x852f, 0xe041, 0x9c2d, 0x2af4, 0xe4b5, 0x7d96, 0xa429, 0xddf5, 0x731e,
+    0x26a8, 0xbe4f, 0x7eda, 0xa8a9, 0x1654, 0xb4e7, 0x8825, 0xb661, 0x1d28, 0x9eeb, 0x5132, 0xe7fb, 0xb23f, 0x59ce, 0xd395, 0x48c4,
+    0x34e6, 0x7bbc, 0xde27, 0x2cfe, 0x5946, 0xa121, 0x1e88, 0xc4a1, 0x8d03, 0x3178, 0xdf33, 0x6d3a, 0xd0ad, 0x5bce, 0x90d3, 0xaa4d,
+    0x3346, 0xa555, 0x9795, 0x30a8, 0xbbdb, 0x8d47, 0xda7d, 0x4952, 0x6db0, 0x915d, 0x12b0, 0x3fe8, 0xa93b, 0x1f92, 0x8921, 0xacc7,
+    0xdcf5, 0x291a, 0x3ef2, 0xccdb, 0x82f5, 0xbf95, 0xe275, 0x7136, 0x949f, 0xe3e1, 0xa52b, 0x5264, 0xa7fb, 0x9a37, 0xccbb, 0xa241,
+    0xbc33, 0x1742, 0xb149, 0xc665, 0x6f2c, 0xaca3, 0x494e, 0x73fe, 0x5f0e, 0x27a4, 0xc3f7, 0x941d, 0x4f5a, 0x20aa, 0xbbc3, 0x7ac4,
+    0xb16f, 0xd7bb, 0x6a7e, 0xcff1, 0xb1fd, 0x5242, 0xdf27, 0x6334, 0x7e20, 0xd1b3, 0x2fd4, 0x9059, 0xa4cb, 0x854f, 0x1e92, 0x762c,
+    0x2aca, 0xa521, 0xcd95, 0xdfa5, 0x6644, 0xb2d1, 0xae81, 0xe963, 0x7024, 0x3022, 0xdca7, 0x5ce2, 0x8c25, 0xb2bb, 0x81bd, 0xcd31,
+    0x2592, 0xe0dd, 0xa1eb, 0x34f6, 0xc023, 0x6eee, 0xd7c3, 0x28fe, 0x5a42, 0x95b9, 0x38fc, 0xabdd, 0x4b20, 0xe2b5, 0xca85, 0x31e4,
+    0x5a6a, 0x9d81, 0x22b8, 0x71b6, 0x815b, 0x55a4, 0xb70b, 0xd657, 0x75e0, 0x4628, 0x5780, 0xcafb, 0x1b5e, 0x4896, 0xe9b7, 0xc80d,
+    0x73a8, 0x430e, 0x36a6, 0x7fd4, 0x457e, 0xa7e5, 0x91cd, 0x6134, 0x558e, 0x201c, 0x767e, 0xc3fd, 0x3b8c, 0x8c8b, 0x60a0, 0x472e,
+    0xa44b, 0x3cc2, 0xd423, 0xe3c5, 0x8c3f, 0xc9db, 0xe70d, 0x1b68, 0x24ba, 0xdaeb, 0x5f82, 0x8857, 0x513c, 0x647c, 0xa281, 0xc989,
+    0x9abd, 0x27da, 0x89d3, 0xc1c9, 0x4e6c, 0x91a7, 0x7602, 0xb10f, 0x9571, 0x76d2, 0xd0af, 0x608a, 0x6850, 0x25fa, 0x483a, 0x5a6a,
+    0x6a74, 0xb917, 0x22e2, 0xc77d, 0x3cc8, 0x9ff9, 0x6a5c, 0x48b8, 0x970f, 0x2c6c, 0x874d, 0x3da0, 0x740e, 0xd677, 0xa497, 0xb957,
+    0xd80d, 0x6ca8, 0x55fe, 0x8985, 0x9e31, 0x636a, 0x24ae, 0x49d0, 0x9e17, 0x94ef, 0x5b80, 0x84fd, 0xa2ed, 0x4cfa, 0x3772, 0xc1ed,
+    0x5542, 0xa30f, 0x6a4c, 0x8f55, 0x4582, 0x9aef, 0x5b46, 0x253e, 0x89a9, 0x1946, 0x7608, 0x6376, 0x1c32, 0x433a, 0x8d01, 0xb749,
+    0x7a20, 0x5270, 0xa731, 0x9b29, 0x1ff0, 0xb5a9, 0xca53, 0x55ee, 0xa54d, 0x3a14, 0x5844, 0xb1c3, 0x2f76, 0x1bde, 0x54c0, 0x60ae,
+    0x3876, 0x6d1c, 0xe771, 0x5b0c, 0x879f, 0x6a28, 0x3c26, 0x9c93, 0x546a, 0x7370, 0xbf97, 0x445c, 0x88d9, 0x1e4e, 0x84b1, 0xbbcd,
+    0xb1b3, 0x4910, 0x1508, 0x6c8a, 0xd807, 0x96f7, 0x3832, 0x740e, 0xd3b7, 0xa409, 0x840d, 0xb321, 0xc909, 0x6dfe, 0x1c50, 0x6320,
+    0xc23d, 0xd3f9, 0x6f58, 0x4482, 0xdd6d, 0x2bde, 0xc8e3, 0x976f, 0x27d0, 0xc8db, 0x6a74, 0xe121, 0x5dae, 0x6e12, 0x489e, 0xca7b,
+    0x81f3, 0x4cc8, 0x68f4, 0x9efb, 0x12e8, 0x64b8, 0xa379, 0x4874, 0xc3ef, 0x1e70, 0x7e4e, 0xd32b, 0x6eb2, 0x3726, 0x53fa, 0x20b0,
+    0x662e, 0x4c8a, 0x808b, 0x3e92, 0x9c8f, 0xe253, 0xbd25, 0x8d67, 0xb7bb, 0xe5f5, 0x7266, 0x7cb4, 0x4232, 0xca33, 0x9c5b, 0x305c,
+    0x56f8, 0x9325, 0x3ce4, 0x1f9c, 0x5fbe, 0x7fea, 0xbce7, 0x16c8, 0x9d43, 0xe8ef, 0xae85, 0x2318, 0x689e, 0xd107, 0xc00b, 0xd8c1,
+    0x7106, 0xb027, 0x3226, 0x8d67, 0x7734, 0x24b6, 0x535e, 0xc0a9, 0x3a36, 0x9e1f, 0x9f03, 0xb817, 0x1ce2, 0x6030, 0xaaf1, 0x3c78,
+    0x4c66, 0xbf61, 0x8555, 0x43d8, 0xd341, 0x1818, 0x8db3, 0xa3d7, 0x480a, 0xd829, 0x5062, 0x1924, 0x5b1a, 0x9755, 0xa88f, 0x4a8c,
+    0xdd33, 0xc73f, 0x4118, 0xac8d, 0xdd93, 0x633c, 0x33f0, 0xe2cf, 0x8fd5, 0xaa2d, 0x38d6, 0x9f4b, 0x63c2, 0xbb95, 0x889d, 0x5ed6,
+    0xb44f, 0x9443, 0xe559, 0xb6c1, 0x1aa2, 0x85e3, 0x269e, 0xc51d, 0xe655, 0x87af, 0xb2e3, 0x19ba, 0xa215, 0x8ab5, 0xdfa9, 0xbef1,
+    0xd095, 0x89eb, 0x5090, 0x6126, 0x1d6a, 0xa757, 0x7310, 0x93b9, 0x5f62, 0x4cc8, 0xc643, 0x20fe, 0xad0d, 0x7f28, 0x6fb0, 0x3640,
+    0xb47f, 0x765c, 0xd205, 0x3346, 0xa1f9, 0xb8c3, 0x1806, 0xd29d, 0x6272, 0x3d58, 0x8907, 0xaa3d, 0x47d8, 0xbfbf, 0xa211, 0xe72b,
+    0x32a6, 0x75ac, 0xa983, 0x690c, 0x9149, 0x77b8, 0xd135, 0xb60d, 0x802f, 0x52c4, 0xb933, 0x2dd8, 0x4a64, 0x891d, 0x5bec, 0x337c,
+    0x4a48, 0xc2f5, 0x2ef8, 0x7aaa, 0x26d6, 0xdac5, 0x8cbb, 0xb49b, 0x7812, 0xdc45, 0x2830, 0x40bc, 0xc0c5, 0xd3d9, 0x9b49, 0x8429,
+    0xbb09, 0xe77d, 0x7e52, 0xddc7, 0xc7e7, 0x366c, 0x6fe2, 0xd4e7, 0xb543, 0x570c, 0xa547, 0xd9f1, 0xb10d, 0x5d3a, 0xdff9, 0xcb3d,
+    0x1ed6, 0xdb5b, 0x8bc5, 0xd095, 0x4522, 0x5a16, 0xeb69, 0x7b72, 0x2010, 0x730e, 0x977b, 0xd15d, 0x67b2, 0x884f, 0xad6f, 0xde93,
+    0x140e, 0x84d3, 0xa0ff, 0x363c, 0x29f0, 0xdba7, 0x7924, 0xcfc9, 0xe40b, 0x9433, 0x6050, 0x196c, 0xd199, 0x6f22, 0x9e43, 0x3006,
+    0xdaf7, 0x66a2, 0x84bb, 0xa567, 0xbdd5, 0x68f2, 0xaa09, 0x26ac, 0x48e8, 0x584e, 0x14e0, 0x4bc0, 0x36de, 0x2cf0, 0xe4df, 0x82e1,
+    0x45ec, 0x2446, 0x7488, 0xa087, 0xab37, 0x4e08, 0x60d0, 0x82d5, 0xb273, 0x5f36, 0x3608, 0xa20d, 0xb45d, 0xc4f3, 0x3792, 0x6086,
+    0x1d1e, 0xb0c5, 0xd1f1, 0x9861, 0x38ea, 0xcd41, 0x585a, 0x8065, 0x385e, 0x5154, 0xb1d5, 0x28aa, 0x8557, 0xc0a9, 0xde83, 0x7e88,
+    0xb10b, 0xeaa5, 0x31e6, 0x5a12, 0xd219, 0x1c02, 0x2734, 0x52e4, 0xcbdf, 0x3ad4, 0x592e, 0xa3b1, 0xd6e5, 0x8c59, 0xaaa7, 0x4afa,
+    0x1606, 0xbaef, 0xdf1d, 0x75be, 0xc28f, 0x32e8, 0x928b, 0x3db8, 0x565c, 0x72b4, 0x3756, 0x7ee8, 0xe457, 0x59d8, 0x2f50, 0x3d6c,
+    0x93c1, 0x4ee8, 0x4fb0, 0xc165, 0x48a4, 0xd2fd, 0x92d7, 0x680c, 0x14be, 0x4e94, 0x78d8, 0x2b5e, 0xd11f, 0x5118, 0xe7d5, 0x9465,
+    0x6650, 0xcd8f, 0x2770, 0x5bfa, 0xb1fb, 0x50d6, 0x6e96, 0x37f6, 0x9a11, 0xbedf, 0x7adc, 0xc12f, 0x320c, 0x704a, 0xb281, 0x281e,
+    0x8157, 0x63b4, 0x2e4e, 0x914d, 0xc981, 0x3dc6, 0x78ee, 0x4c28, 0x1aca, 0x6ce8, 0xc8af, 0xe00d, 0x54c0, 0xaaa3, 0x3b94, 0x1276,
+    0xc89f, 0x2efa, 0x60cc, 0x5702, 0xc641, 0xd499, 0x4248, 0xae0d, 0x3464, 0x9537, 0x481c, 0x56fe, 0xe633, 0x4a44, 0x6886, 0x1abc,
+    0x7544, 0x24ec, 0x6f14, 0xae39, 0x2f64, 0x4a94, 0x7ce4, 0xd317, 0xb947, 0xa815, 0x7ffc, 0x3272, 0xc093, 0x44dc, 0xd52f, 0x8679,
+    0x5792, 0x46da, 0x6680, 0x9949, 0x60ae, 0x69ac, 0x287a, 0xdf95, 0x523e, 0xb8b1, 0x30b2, 0xdd43, 0xb44d, 0x7c20, 0x1b26, 0xca25,
+    0x9821, 0x3f0e, 0x527a, 0xdbb7, 0x1d18, 0x5184, 0x24ea, 0x3ee8, 0xdcc1, 0x6e0a, 0xce4b, 0xaecd, 0xe3e3, 0xbfad, 0x27ea, 0x8fe3,
+    0xabcf, 0x73e8, 0xbd57, 0xd861, 0xa66b, 0x45ac, 0xc347, 0x5d22, 0x329a, 0x9abb, 0xc631, 0xad2d, 0x6c7a, 0x1928, 0x5b76, 0x3ea0,
+    0x8bc7, 0x2352, 0x3498, 0xaa2f, 0x6782, 0x963d, 0x836d, 0xc589, 0x4cac, 0xe199, 0x86f7, 0x333c, 0x7072, 0x967f, 0x2642, 0x3a58,
+    0x6630, 0xc013, 0x2cb0, 0x63c8, 0x8c39, 0x387e, 0x9dff, 0x2786, 0xba99, 0xdd39, 0xb9bb, 0x3e40, 0x50d6, 0xc911, 0xc2e7, 0x9891,
+    0xb8dd, 0xc87b, 0x507c, 0xd387, 0xb0e5, 0xc899, 0x456a, 0x2d66, 0x254e, 0xa3e5, 0x3d88, 0xae6f, 0x9cc1, 0xc4df, 0x59b8, 0x6d68,
+    0x9625, 0xca43, 0x4324, 0xe777, 0x3134, 0x4aee, 0x87d7, 0xe0c9, 0xbbd5, 0x6ec8, 0xcd47, 0x99bb, 0x83c1, 0xac1f, 0xa46f, 0xb8c1,
+    0x3edc, 0xd69b, 0x616e, 0xbb17, 0x21a0, 0x7e00, 0x3be2, 0xdded, 0x4432, 0xa8db, 0xd85d, 0x84a1, 0x2dce, 0xd0c5, 0x8d3b, 0xe9e7,
+    0x9815, 0x7886, 0x3276, 0xb851, 0x7b94, 0x2aea, 0xb04b, 0x99a9, 0xdca3, 0x6c0c, 0xc41b, 0x449e, 0x9bb5, 0x5cf8, 0x2f22, 0x413c,
+    0x9b45, 0xd069, 0x7bb2, 0xa287, 0x94e9, 0x5eee, 0x7df2, 0xa081, 0x42ac, 0x909b, 0xb8e5, 0x16e0, 0x2cca, 0x5dfa, 0x6ff8, 0xe255,
+    0xcde9, 0x8c71, 0x55da, 0x959d, 0xab7f, 0x4b78, 0xe527, 0xcf67, 0xaefd, 0xbc73, 0x4fda, 0x9565, 0x7464, 0xb549, 0xa4d7, 0x7566,
+    0x955f, 0xde97, 0x1b24, 0xa2bb, 0x6df8, 0x38bc, 0x99a3, 0xd6b9, 0x845b, 0xd0b9, 0xb69b, 0x680c, 0xa141, 0x8267, 0x3534, 0xb93b,
+    0x1e0a, 0xa4cd, 0x7fca, 0xe515, 0xa1fb, 0xc14b, 0x84ab, 0xe4cd, 0x6a78, 0x2544, 0x865f, 0x9f7b, 0xe699, 0x5ede, 0x4408, 0xc9bb,
+    0x9e2b, 0xb531, 0xe149, 0x4faa, 0x24cc, 0x9dbf, 0xc423, 0x99cb, 0xd753, 0x5dd0, 0x8679, 0x279a, 0x7232, 0x9a9b, 0xdd6b, 0x533a,
+    0x929b, 0xd1b5, 0x3efa, 0x9495, 0x7e0a, 0x58e0, 0x7292, 0xdcdb, 0x4a3a, 0x6e50, 0xcb8b, 0x7e46, 0xb4d9, 0x287a, 0x9a01, 0x54cc,
+    0xb3ad, 0xa2a1, 0xecf9, 0x8b81, 0xbc99, 0xdcf9, 0x579e, 0x3a72, 0x2b9e, 0x8a4f, 0xe029, 0x6dc0, 0x91fd, 0x2d0e, 0xe575, 0x23aa,
+    0xa82d, 0xdabb, 0x3638, 0xc315, 0xe60f, 0x4690, 0x901f, 0x879d, 0xa347, 0x7986, 0x1b88, 0x900b, 0x53b8, 0x34b8, 0x8a07, 0x6580,
+    0xac35, 0xd609, 0x89a9, 0x87c5, 0xb96b, 0xdae7, 0x9319, 0xa5e3, 0x826b, 0x1d50, 0x93c1, 0x5aa8, 0x2316, 0x6ada, 0xa473, 0xe5df,
+    0x5428, 0x18a6, 0x9197, 0x53ae, 0x6588, 0x2cd2, 0x7ffe, 0xd63d, 0x1d0a, 0x62d4, 0x50aa, 0x30b4, 0x7c02, 0x9201, 0xe29b, 0x2c6c,
+    0x7532, 0xc075, 0x5596, 0x2552, 0x4c54, 0xe10f, 0x1e6e, 0xa0fb, 0x265c, 0x660e, 0x3c8a, 0xc67d, 0x44ba, 0xc6f1, 0x7a16, 0xa1c5,
+    0x5a2a, 0x96f9, 0x417e, 0x735a, 0xd179, 0xab63, 0x796a, 0x6340, 0x496a, 0x55e6, 0x81dd, 0x16e6, 0xdf01, 0x2d4e, 0x7450, 0x35ae,
+    0xe587, 0x743e, 0x1d5e, 0x77b6, 0x629c, 0x88bf, 0x6a1a, 0xa2f3, 0x811f, 0x65a4, 0xd93b, 0x8005, 0x2e4a, 0x4514, 0xe0ad, 0x383c,
+    0x234a, 0xa87d, 0x54f6, 0x806b, 0x1c8a, 0xca23, 0x617e, 0x928b, 0x9d4f, 0x3856, 0xe5e5, 0xc0e5, 0x4a30, 0xcfcd, 0x58c8, 0x6ef6,
+    0x8cfd, 0xb273, 0x84e3, 0x37b0, 0xe0d9, 0x77c2, 0xb3cd, 0x93f3, 0x1a8e, 0xc201, 0x4efc, 0x75a6, 0x8c05, 0x1ac4, 0x6478, 0xa81f,
+    0x4c8e, 0xd449, 0x577e, 0x4f8e, 0xe731, 0x70d2, 0xc567, 0x224e, 0x7548, 0xa6ef, 0x9471, 0x3958, 0xd609, 0x7b42, 0xb07b, 0x8edf,
+    0x5a7c, 0x1f26, 0xc105, 0x4a6a, 0xb18d, 0x3ed2, 0xe687, 0xc62f, 0x229e, 0x7b30, 0xe1d5, 0x4df4, 0x9b5b, 0xc04d, 0x3f9c, 0x2af4,
+    0xa05d, 0x73fa, 0x317e, 0x1d96, 0xd2c1, 0x78f2, 0x2d30, 0x6074, 0x84eb, 0x339c, 0xd5bb, 0x2222, 0x8ae3, 0x4396, 0x1a8a, 0x5f26,
+    0xca8f, 0x6d6c, 0xad2f, 0xd193, 0x6b3c, 0xb423, 0x29d6, 0xa96d, 0x451e, 0xdb1d, 0x615c, 0x32c6, 0x45b4, 0xcddb, 0x6e5a, 0x5fa0,
+    0x955b, 0x462a, 0x6dec, 0x32ac, 0x605e, 0x1cc6, 0x3e1e, 0xce5f, 0xafc9, 0x5094, 0xcc93, 0x3df2, 0xa69f, 0xbf47, 0x86a5, 0x1d04,
+    0x6636, 0x380a, 0x7c2e, 0x841d, 0xb447, 0x626c, 0x6e3c, 0x2d32, 0xb1c1, 0x3848, 0xa527, 0xb03b, 0x2fae, 0x6a68, 0xc505, 0x323a,
+    0x9d29, 0x8813, 0x6ae4, 0x20a8, 0xa3d9, 0x3bf6, 0xb623, 0x8e25, 0x18f6, 0xa1c1, 0x3fa0, 0x8da7, 0xbf7f, 0x3e70, 0xd745, 0x8041,
+    0x3754, 0x47ac, 0xcf27, 0x3b36, 0x156a, 0x9e05, 0x93ef, 0xc3cb, 0x7454, 0x4e7c, 0x1948, 0xb1db, 0x61b0, 0x9a8f, 0x54fc, 0xb523,
+    0x7e9a, 0x989f, 0x1c0e, 0x8789, 0x534c, 0xcca1, 0xb5a1, 0x3590, 0xc6a9, 0x5e6e, 0xe6a7, 0x6a04, 0xcdbf, 0x7232, 0xe0db, 0x53c8,
+    0x1d5a, 0x6d16, 0x2db8, 0x9913, 0x4876, 0x6986, 0xc3a7, 0x504c, 0x3632, 0xc74b, 0x4a2a, 0x8eb7, 0xd01b, 0x7d3e, 0x4312, 0xcb69,
+    0x78b4, 0x8325, 0x3f42, 0xe5e5, 0x5f44, 0x926d, 0xadf9, 0xa259, 0xb73b, 0x8ed1, 0xe813, 0xa21f, 0xcba3, 0x58ec, 0xbdaf, 0xab93,
+    0xdb13, 0xa59f, 0x8ad7, 0xd21b, 0x7e70, 0xb3cb, 0x3dde, 0x59a4, 0x75ce, 0x98b5, 0xba5b, 0xa89d, 0x5360, 0xe5b7, 0x69b2, 0x8cbd,
+    0xd4ff, 0xb801, 0xe13f, 0x1d04, 0xb785, 0x2fca, 0xdd33, 0x9eed, 0xcd6d, 0x3242, 0xa73f, 0x89a9, 0x77ac, 0x9919, 0x5720, 0x2b06,
+    0x65a0, 0x921d, 0x93c1, 0x46ac, 0xb5bf, 0x210c, 0x521a, 0xd7c3, 0xbccb, 0xc8a7, 0x54de, 0x6efc, 0xba69, 0x5e30, 0xa013, 0x83f9,
+    0xb9cd, 0x71ee, 0x4754, 0xbeb1, 0xa315, 0x7b66, 0xc0ab, 0x2b88, 0x41ee, 0x6f28, 0x2388, 0x6220, 0x6c5a, 0x1e56, 0x2ec6, 0xc1e7,
+    0x284c, 0x5430, 0xc92f, 0x6762, 0x9cb7, 0x47f6, 0xccc1, 0x548e, 0x69aa, 0x8dc9, 0x2d1a, 0x5bbc, 0x42f0, 0xb765, 0x546c, 0x351c,
+    0xbed3, 0x29be, 0x84f7, 0xa11b, 0x95e7, 0x57be, 0x46ae, 0xb37f, 0x4ac2, 0x3368, 0xe3ab, 0x1730, 0xa99d, 0xc437, 0x26ec, 0xd547,
+    0x3d48, 0x6be6, 0xdcb5, 0x541e, 0x23a4, 0xa9bd, 0x7130, 0x5db6, 0x88b9, 0xabb1, 0x6bac, 0xc4cd, 0x940b, 0xd62d, 0x7a78, 0xb0bf,
+    0x692e, 0x446c, 0xc063, 0xb285, 0x6cc8, 0x5b74, 0xb01f, 0x214a, 0x9055, 0x7656, 0xd559, 0x5f88, 0xc487, 0xa5ad, 0xdcef, 0xc1e7,
+    0x38be, 0x2102, 0x7a5c, 0x4314, 0xd7a3, 0x52ae, 0x779e, 0x5dca, 0x69c4, 0x22ca, 0x8371, 0xc951, 0xaaf5, 0x95cf, 0x2780, 0xdaa9,
+    0x9019, 0xde8b, 0xb279, 0x4c9c, 0xbca5, 0x8f0d, 0x9abb, 0x59da, 0x22de, 0x8c73, 0x49ac, 0x5f9a, 0x2052, 0x5122, 0x7ac2, 0xe10b,
+    0xa741, 0x54c6, 0xcbeb, 0x1dd2, 0x6986, 0xe137, 0x4bd0, 0xc873, 0x80d3, 0x4eec, 0xe3ff, 0x4c0c, 0xcfdd, 0x4ada, 0xa703, 0x7716,
+    0x415c, 0xbef1, 0xe05d, 0xb3a3, 0x970b, 0xe591, 0x32bc, 0x5d88, 0x7d36, 0xc981, 0xd40f, 0x2142, 0x61c8, 0x6e74, 0xe373, 0x95bf,
+    0xbdd1, 0x6346, 0x97e1, 0x5c08, 0x6ec6, 0x6ff4, 0xab35, 0x2af2, 0xda07, 0xa481, 0x3e48, 0xcbcb, 0xd545, 0x87ab, 0x70fa, 0x644e,
+    0x3a9c, 0xc751, 0x6d04, 0xb077, 0x25fc, 0x7596, 0x5e46, 0x1bc8, 0x68de, 0xbb93, 0xa81d, 0x2480, 0x9591, 0x30d2, 0xbec3, 0x7f36,
+    0x4650, 0xc52b, 0xcbe9, 0x3ad4, 0xa9a1, 0x23cc, 0x7688, 0x9dad, 0xea15, 0x6a48, 0xaee7, 0x7758, 0x3746, 0x4f4c, 0x91b3, 0x2df2,
+    0x5fe2, 0xc1a1, 0xa09b, 0xba23, 0x1a60, 0xc6c5, 0x5680, 0x235a, 0x436a, 0xd0c1, 0x6190, 0x22fe, 0x3a90, 0x8709, 0x5ec8, 0x361c,
+    0x4abc, 0x609a, 0x46de, 0xbb43, 0x316e, 0x6ea6, 0xca1f, 0xd6f9, 0xa319, 0xdcd9, 0x5f02, 0x1858, 0x7920, 0x2f62, 0xade3, 0x3402,
+    0x1bae, 0x46fc, 0x651a, 0x9a6d, 0x899d, 0x4de6, 0x3d86, 0x7ed2, 0xb79d, 0x61f0, 0xdccb, 0x55f0, 0xbeef, 0xb617, 0x49be, 0xcef9,
+    0x4b56, 0xc0b9, 0x327c, 0xce37, 0xb2b7, 0xe75b, 0x9561, 0x3ad4, 0x153e, 0x44a6, 0x8309, 0x2c5e, 0xa5d3, 0xd201, 0x6802, 0x17c4,
+    0xe293, 0xd769, 0x934b, 0x2a18, 0xb325, 0x3636, 0x6dd2, 0xa5eb, 0xd2cf, 0x5abe, 0x8e6b, 0xa481, 0xb967, 0xdd83, 0x77fa, 0x931b,
+    0xe1e1, 0xa1c9, 0x2ae6, 0x3fde, 0xb4d1, 0x2078, 0xd1e9, 0x2ada, 0xa8db, 0xeae3, 0xbe7b, 0xd491, 0x740a, 0xaad5, 0xde4d, 0x7e76,
+    0x9715, 0x6fe4, 0xb985, 0x2208, 0xa7df, 0x3800, 0xd54b, 0x9fcf, 0x847d, 0xccd3, 0x7066, 0x5d86, 0x801b, 0x46ea, 0x5470, 0xa193,
+    0xb179, 0x7a42, 0x32d4, 0x9325, 0x84f7, 0xd361, 0x47dc, 0x96eb, 0xdf65, 0x3aae, 0x1ba2, 0x6d62, 0x5584, 0x39c8, 0x1dc8, 0x86bd,
+    0xd9cb, 0x327e, 0x9739, 0xeca9, 0x3d0c, 0x8a6f, 0xd243, 0xdbcd, 0x44d2, 0x5574, 0xb149, 0x3b32, 0x2a76, 0x77c2, 0x5520, 0x8469,
+    0x979d, 0xb8e3, 0x5578, 0x8ecb, 0x3266, 0x87a1, 0xb78b, 0xeb9b, 0xaba1, 0x8b83, 0x337a, 0xe3a1, 0x4c4e, 0x6884, 0xb4d5, 0x4068,
+    0x4f3a, 0xc4b9, 0x2994, 0x918b, 0xd5d5, 0xe051, 0x2f96, 0x796a, 0xa785, 0xe427, 0xba5d, 0x885d, 0xd6c3, 0xb0f3, 0x35c0, 0xc1db,
+    0x46f4, 0x2ad2, 0xdceb, 0xae49, 0x9789, 0x33fe, 0x8c49, 0xa76d, 0x18d8, 0x5fc6, 0x79a6, 0x8f79, 0xc85d, 0x19ca, 0x6628, 0xe3b3,
+    0x2216, 0x4ef8, 0x5e12, 0x2160, 0x4b6c, 0x8743, 0xca43, 0xa109, 0xb7a3, 0x4a0c, 0x5306, 0x8a4d, 0xa98b, 0x2646, 0x4c78, 0xa185,
+    0x18ee, 0x2ce4, 0xb099, 0xcf37, 0x3208, 0xe15d, 0x44e8, 0x5bf4, 0xc20d, 0x9995, 0x67cc, 0x7c26, 0x238c, 0x3946, 0xaaf9, 0xce4f,
+    0x31f4, 0xdefb, 0x602a, 0xd5e1, 0x7fa0, 0xa839, 0xa4d1, 0xd7bd, 0x47e4, 0x75fa, 0x3fd6, 0x7dcc, 0x50be, 0xad6d, 0xca17, 0x3d56,
+    0xa60b, 0xe989, 0x7c08, 0x5eea, 0x9de1, 0xda7f, 0x5d12, 0x41be, 0xbb21, 0x2124, 0x567a, 0xa36f, 0xc70d, 0xe3e1, 0x6f66, 0xb9f5,
+    0xd4bb, 0x48ca, 0x30a2, 0xcedd, 0x7278, 0x8bdf, 0xe4b7, 0x6b4a, 0x33e8, 0x7bd8, 0xa559, 0xc15b, 0x7508, 0xdedd, 0x2460, 0xc3cd,
+    0x81df, 0x1d3a, 0xe2c5, 0x9ef9, 0x9d71, 0x6306, 0x8841, 0x37a8, 0x4582, 0x272a, 0x6fa0, 0xcb1f, 0x93af, 0x9e23, 0x4c1c, 0xccdb,
+    0x7186, 0x84b5, 0xc5e5, 0x3714, 0x7052, 0xdb07, 0x5c3e, 0x1d66, 0xbee3, 0x24e0, 0x7900, 0x3638, 0x2f8c, 0xe0d5, 0x7fba, 0xac6b,
+    0x1e82, 0xe085, 0x5c6a, 0x82bb, 0x6dee, 0x3884, 0x5f54, 0x7b8c, 0xb18b, 0x987d, 0x7088, 0xe183, 0x1fba, 0x83f7, 0xa9e9, 0x489a,
+    0x7ac2, 0x3024, 0x5f6e, 0x8275, 0xd915, 0x5532, 0xe18b, 0x1af6, 0x84ad, 0xc611, 0xd93d, 0x2f52, 0x4938, 0x9ac7, 0x3d5c, 0xaf9d,
+    0x4656, 0x6098, 0x77ca, 0xd9af, 0x8fbd, 0x5ab6, 0xa021, 0x7b26, 0x6022, 0x3f1e, 0x96b3, 0x235e, 0xaf33, 0xcd19, 0x2fc0, 0x5860,
+    0xb3d5, 0xd8c3, 0x3f3c, 0x4ece, 0x847f, 0xc09f, 0x6b76, 0x2174, 0x5a6c, 0xa4d3, 0x34fe, 0xb451, 0x9453, 0x2f9c, 0xe1bf, 0x6fa0,
+    0xc841, 0x5338, 0xc05b, 0xa497, 0x6386, 0xd877, 0x16bc, 0x2d56, 0xbc63, 0x5566, 0xcb35, 0x2f02, 0xac1f, 0xe7a9, 0x9941, 0x4ff4,
+    0xad03, 0xc951, 0x627a, 0x8267, 0x20b8, 0x4c90, 0x9a7b, 0x7248, 0x3404, 0xa581, 0xbc75, 0x8c5f, 0xe401, 0x7a14, 0xa5b5, 0x2c66,
+    0x483e, 0xebaf, 0x7536, 0xa9ad, 0xc4f9, 0x6f14, 0x16a8, 0x363a, 0xc39b, 0x56c6, 0xab71, 0x7c1c, 0x15da, 0xd34b, 0x83ab, 0xafdd,
+    0x6898, 0x5ff0, 0x12a6, 0x7904, 0x55ec, 0x6f84, 0x417e, 0xd6cf, 0x631e, 0x372e, 0x6f22, 0xc37d, 0x3362, 0x8f97, 0x5f72, 0x7632,
+    0x8751, 0x9d1b, 0x80a3, 0x4ec2, 0xbf29, 0x422e, 0xd2a5, 0x5efe, 0xd7dd, 0xc55f, 0xa89d, 0x345c, 0x5cc6, 0x7dae, 0xb1a3, 0x98cf,
+    0xcb8f, 0xb007, 0x9ac9, 0x38c4, 0xc159, 0x6de2, 0x3d72, 0x2332, 0xdc15, 0x72d0, 0x30d6, 0xe777, 0xa071, 0xc259, 0x6026, 0xbc65,
+    0x6e78, 0xdf7f, 0x8df7, 0x5018, 0xb82b, 0xa965, 0x1b7e, 0x80b7, 0x4e46, 0x3312, 0xe0a9, 0x93db, 0x4d5a, 0xd35d, 0x1f36, 0x9b0d,
+    0x87ef, 0x4a66, 0x9d11, 0x1c24, 0x3510, 0x4b4c, 0xd225, 0x3368, 0x8a0d, 0xb0ad, 0xd69f, 0x6336, 0xe27d, 0x7822, 0x1ce2, 0x65fc,
+    0x8c1b, 0x5cd0, 0x1206, 0x4b08, 0xc3ab, 0x32a6, 0x8a2b, 0xa581, 0x7426, 0x7cd8, 0xccc1, 0x3112, 0x7f02, 0x195e, 0xa823, 0x8bcd,
+    0x253c, 0x6b8e, 0x7e0e, 0x5a6c, 0x3cfc, 0x2468, 0xbcff, 0x6858, 0xb521, 0x8e2d, 0x163a, 0x908d, 0x4f26, 0xb17d, 0x9637, 0x8277,
+    0xa857, 0xba8f, 0x5c1a, 0x6c4c, 0x2a60, 0xd175, 0x1dd0, 0xb2c9, 0x7ff6, 0xc383, 0xb31b, 0x3d3e, 0x57de, 0xdd9b, 0x69a8, 0xbf61,
+    0x94a5, 0xaa9f, 0xdfc9, 0x2664, 0x96a9, 0xdae9, 0xab8b, 0x8b5b, 0x4cf4, 0x9b85, 0xbe73, 0xd3c3, 0x951b, 0x65b2, 0x1dea, 0x8c3d,
+    0x6838, 0x4292, 0xacab, 0x4658, 0x2826, 0xbacd, 0x8d4b, 0xde17, 0xc857, 0x35de, 0xd67d, 0x98ad, 0x3bfe, 0xbc59, 0x3e70, 0x8d07,
+    0xc3db, 0x57e0, 0xa623, 0x3c82, 0x7414, 0x8937, 0x9fb9, 0x4268, 0x6262, 0xaa81, 0x3dfa, 0x79c6, 0x60ea, 0xca79, 0x6ac0, 0xbf1b,
+    0x1976, 0x998b, 0xc08f, 0xad9d, 0x53c0, 0x7afc, 0x37d8, 0xd9e7, 0x4a78, 0xb957, 0x84b1, 0x4e8e, 0x759e, 0x3e16, 0x878f, 0x44fe,
+    0x1f48, 0x9cdf, 0x61d2, 0xcf49, 0xe23f, 0x502e, 0x9285, 0x7584, 0xdf7f, 0xc0cd, 0x4496, 0xd76f, 0x8363, 0xbb0b, 0x89b1, 0x3046,
+    0x1b84, 0x8d51, 0xe307, 0x419a, 0x3220, 0x73c4, 0xb49d, 0x7d46, 0x637e, 0xa2e3, 0x9cff, 0x8037, 0xb5ef, 0x7168, 0xc3ed, 0x41d0,
+    0x6e3c, 0x1e12, 0x53e2, 0xbcdd, 0xde0f, 0xa78f, 0x34ba, 0xc2fd, 0x7ec6, 0xdfb7, 0x1b8e, 0x5e8a, 0x39e0, 0xd1d9, 0x5d0a, 0xc317,
+    0x6f0a, 0xd6bf, 0x1ad2, 0x58b2, 0x45a6, 0xdc4b, 0x98f9, 0x48f6, 0xd307, 0x66a6, 0x42d2, 0x9fdd, 0x5696, 0x8fd5, 0x26ae, 0x9d21,
+    0x3874, 0xab2b, 0xd68d, 0xa1c3, 0x3b60, 0xa8d7, 0x1df2, 0xbe3f, 0x8f51, 0x911d, 0x180e, 0x57c8, 0x975d, 0x4dca, 0xcd8d, 0xe80b,
+    0x2054, 0xb803, 0x5c08, 0x6eda, 0x2878, 0xa063, 0x6b1a, 0x76dc, 0x30f2, 0x9a3f, 0x2288, 0x8385, 0xe54d, 0x9c11, 0x302c, 0x6790,
+    0x33a4, 0x8ae3, 0xe3b1, 0x7694, 0xae6b, 0xd461, 0x5866, 0x8e35, 0x3e06, 0x6902, 0xb8bd, 0x813b, 0x4006, 0x3646, 0x7e8a, 0xd687,
+    0x3f0c, 0x584c, 0x9ef1, 0x3640, 0x7a92, 0x7384, 0x8e93, 0xe2db, 0xb30b, 0x7038, 0x24ca, 0xa727, 0xb461, 0x6868, 0xb95b, 0x59d8,
+    0x7938, 0x6b86, 0xb5d9, 0x935b, 0xcad1, 0x6f7a, 0xbbef, 0x5a32, 0x96bf, 0x17a8, 0xc003, 0x34fa, 0x9c5f, 0x5ab0, 0x9175, 0xd5e9,
+    0x3254, 0xb13f, 0xa019, 0xd7f3, 0x8a09, 0x560a, 0xcc91, 0x210c, 0x918b, 0x3a78, 0xdc4d, 0x99a3, 0x454e, 0x6cee, 0x56ea, 0x3a90,
+    0xa59f, 0xe34f, 0x9965, 0xb2c3, 0xd9a1, 0xa5f9, 0x4f12, 0x96a1, 0xcd97, 0xe10d, 0x5438, 0x689a, 0xd4bd, 0x2b3a, 0x40be, 0xd07f,
+    0x5b5c, 0x3854, 0xa907, 0x403e, 0xc40d, 0x5674, 0x6656, 0xad01, 0x41f6, 0x8cad, 0xdf81, 0x3290, 0x73e6, 0xb511, 0x17d6, 0x369c,
+    0x4fd4, 0x23fe, 0x786c, 0x52ee, 0x479a, 0xb935, 0x34be, 0x74c2, 0xec27, 0x6900, 0x4ffa, 0x8071, 0x59ce, 0x4498, 0xd33b, 0xbd67,
+    0xa265, 0xd9a7, 0x9b79, 0x659e, 0xe075, 0xa33d, 0x49d8, 0x2462, 0x6c08, 0x5424, 0xac29, 0x7bbe, 0x4f06, 0x61e2, 0xe255, 0x9973,
+    0x2b6e, 0xb5cb, 0xd0dd, 0x200a, 0xd9e7, 0x2fc0, 0xbbe3, 0x75b8, 0xcc4f, 0x285e, 0x6544, 0xa705, 0xe2a3, 0x273a, 0x8087, 0x5614,
+    0xdc27, 0x8083, 0x3334, 0x299c, 0xe629, 0x71ce, 0xb955, 0xb4c1, 0x9139, 0x1934, 0x5d52, 0xddf1, 0x2878, 0x649e, 0xc8a5, 0xa9bf,
+    0xecc7, 0x7830, 0x2e10, 0x882d, 0x19ec, 0x9c01, 0xb273, 0x3bfa, 0x20a4, 0x8965, 0x4c56, 0x2c72, 0xc327, 0x6096, 0x44e8, 0xa571,
+    0xb885, 0x6274, 0x2498, 0x77fc, 0xc40d, 0x5284, 0xaf97, 0x9141, 0x3ef2, 0xcb4f, 0xe28f, 0x47a6, 0x3436, 0x550c, 0x1c08, 0xdb83,
+    0xbbaf, 0x9109, 0x9889, 0x3fb2, 0x786c, 0x6062, 0x84e1, 0xd0d9, 0x288c, 0x5cb4, 0x8cdf, 0x50d4, 0x98ab, 0xb7ab, 0x1ccc, 0x3c14,
+    0x8af9, 0x9f31, 0x3022, 0xbea7, 0x8467, 0xad9f, 0x676e, 0x70f8, 0x28a8, 0x826b, 0xc96f, 0xde8b, 0x76a2, 0xbc39, 0x4546, 0xcf0d,
+    0xe65d, 0x7c3e, 0x8891, 0x4796, 0xe181, 0xa0d5, 0x7934, 0x5616, 0xc99d, 0x452e, 0xe6e1, 0xb1f1, 0x6c76, 0x7b50, 0x2b76, 0xa857,
+    0x3da8, 0xc6b9, 0x3acc, 0xe3e7, 0x87fb, 0xbf0f, 0x1dcc, 0x907f, 0x4d58, 0xcc51, 0x6d38, 0x4dae, 0xbb5b, 0x4146, 0xd0e9, 0x4bf6,
+    0x5604, 0xc2f5, 0x6514, 0x1520, 0xb23d, 0x350e, 0x73e4, 0x8cad, 0xaa21, 0xcd1f, 0x9d91, 0x198a, 0x6b2a, 0xcf83, 0xb041, 0x2284,
+    0x91d5, 0x74e6, 0xcd23, 0xd819, 0x4512, 0xbe65, 0x30a8, 0xcbaf, 0x3e20, 0x5988, 0xc541, 0x6aca, 0x4022, 0x95f3, 0x7a1e, 0xe4b1,
+    0x25f6, 0xd021, 0x322c, 0x61e2, 0xe6cb, 0x86e9, 0x282a, 0x796c, 0xe903, 0x4dbc, 0x7142, 0x7d60, 0x2acc, 0xc015, 0x4a38, 0xbc89,
+    0x4bd6, 0x8bd1, 0x7420, 0x3b92, 0xb903, 0x9f17, 0x4c30, 0xbf97, 0xe945, 0x484a, 0x6a62, 0x622a, 0xb293, 0xe5cd, 0xcf9b, 0x7f82,
+    0xc29b, 0x52fc, 0x23d2, 0x60bc, 0x396c, 0x8f4b, 0x7cfe, 0x1a00, 0x2cc0, 0x43b6, 0xa4c9, 0x397c, 0xb8cf, 0x5caa, 0x8b35, 0x6bec,
+    0x240c, 0xdfd7, 0x8d19, 0x8ee3, 0x8735, 0xb9c9, 0x9f6d, 0xea6f, 0x5cc6, 0x51c4, 0x209a, 0x9d57, 0x6492, 0xcfe3, 0x7e1c, 0x9b4f,
+    0xeaed, 0xd479, 0x6876, 0xb75d, 0x8cef, 0x19ba, 0x76fa, 0x5a68, 0xd485, 0x2c14, 0xaa6f, 0x1f84, 0xa741, 0xc635, 0x7ce6, 0x236c,
+    0x606e, 0x7f76, 0xc211, 0x1698, 0xaf7b, 0xca91, 0x3e9a, 0xa3ad, 0x8675, 0x44e4, 0x1d8c, 0xc7a9, 0xa32d, 0x2c62, 0xb3d9, 0x4a36,
+    0x677e, 0x6c58, 0x9ea9, 0x7ac8, 0xc855, 0x58b4, 0xa035, 0x39f2, 0xde5d, 0x95f3, 0x5198, 0xc36f, 0x3154, 0xb3ab, 0xa727, 0x328c,
+    0x913f, 0x6df2, 0x5c08, 0xc09d, 0x9af3, 0x1922, 0x3d46, 0x564c, 0xc549, 0x6e46, 0xd27b, 0xb171, 0x9387, 0xbf2d, 0x73ec, 0x3824,
+    0xcdb7, 0x549c, 0x9145, 0xbf19, 0x6948, 0x2bb4, 0x617a, 0xc0b7, 0xcdc9, 0x9ce5, 0x76a6, 0xa54b, 0x1a26, 0x9c5f, 0xdf43, 0x7fbe,
+    0xd34d, 0x5902, 0x86ad, 0xb6af, 0x9c2b, 0x25ea, 0xec39, 0xd251, 0x1792, 0x69ac, 0x2338, 0x75c2, 0xc4bd, 0x89ed, 0x9c71, 0x7c98,
+    0x471c, 0xc327, 0x2c70, 0xd147, 0xb2c9, 0x18c0, 0x412a, 0x57ae, 0xb33b, 0x7718, 0xdc63, 0xc25f, 0x4950, 0x8025, 0x9371, 0xc7d7,
+    0xaa45, 0x606a, 0x7e74, 0xdfd7, 0x4eb4, 0x252e, 0xcb2f, 0x90c7, 0xbe2f, 0x95d3, 0x2e0c, 0x221e, 0xa213, 0x3c76, 0x4ee8, 0x944f,
+    0x2a98, 0x55dc, 0x48da, 0xb987, 0x6c20, 0xc535, 0x28c6, 0xaecd, 0x6fbe, 0x2b3e, 0x7e3c, 0xbc2b, 0xd17b, 0x3d3a, 0xb76d, 0x80b1,
+    0x5160, 0x65e8, 0x9499, 0xab4d, 0x53a6, 0xd2c1, 0x5912, 0xb9a7, 0xe7f9, 0x429c, 0xc1a9, 0x64b0, 0x7758, 0x1576, 0xa7df, 0xc5c3,
+    0x9369, 0x240e, 0x4224, 0x863d, 0x57ca, 0x97af, 0xe7d1, 0xc1f7, 0x1c6c, 0x4e8e, 0x5f3c, 0xd8a3, 0xab99, 0x563a, 0x8b29, 0x4ab8,
+    0xbd7f, 0x27f0, 0x6388, 0x1b7e, 0x58b0, 0x9c2d, 0x53a6, 0x6552, 0x9ecf, 0x8f07, 0xe451, 0x2ad2, 0x8655, 0xc73b, 0x3340, 0xa45f,
+    0x40f4, 0xafc5, 0xbf37, 0x7a94, 0x4f90, 0x4242, 0xaf45, 0x37da, 0xa723, 0x4310, 0xb6f5, 0xe197, 0xaa69, 0x6ab2, 0xda17, 0x7f22,
+    0x2626, 0xe729, 0xcf5d, 0x1aa6, 0x6778, 0x2bb2, 0x6f5a, 0x6070, 0xb091, 0x2498, 0x8bb3, 0xc23d, 0x24c0, 0x9351, 0x328e, 0x5ae6,
+    0x2364, 0xae8d, 0x742e, 0xd0b9, 0xbd31, 0x7256, 0xe717, 0x6332, 0xd331, 0x82f3, 0x7738, 0xc6ed, 0x87ed, 0xe533, 0xaa15, 0x4d20,
+    0xb3cf, 0xd17b, 0x6828, 0x453c, 0xd82b, 0x3128, 0x3502, 0x76f0, 0x2946, 0xd6a1, 0x9a01, 0xbeb3, 0x4a90, 0xe05b, 0x30cc, 0x571a,
+    0x472e, 0xb13b, 0x30d4, 0xa443, 0xe945, 0x6092, 0x9cd1, 0xc229, 0x3f08, 0x8c43, 0x7ba8, 0xdce7, 0x8e5f, 0x3862, 0xac75, 0x48ae,
+    0xc047, 0x3214, 0x4238, 0x4d4a, 0x77f4, 0x2dee, 0x5c5a, 0xd245, 0xc60f, 0xe38d, 0x3514, 0x8f09, 0xd403, 0x68c4, 0x888f, 0xd19f,
+    0x27e6, 0xe15b, 0x4b3a, 0x3476, 0xae3f, 0x605a, 0x4894, 0x8087, 0x26ca, 0xb609, 0x3f2e, 0x7dd8, 0x8b1d, 0x470e, 0x71b4, 0xd635,
+    0x483e, 0xb1e5, 0xd4eb, 0x4ae2, 0xa513, 0x67cc, 0xdeff, 0x8b0d, 0x2652, 0x7388, 0xa70b, 0x30e4, 0x4436, 0xd831, 0x5ac4, 0x7f62,
+    0x24ca, 0xa6d3, 0x47ce, 0xe00b, 0x5b8c, 0xd3e1, 0x8707, 0x51f8, 0x2f86, 0x683c, 0xe595, 0x8a93, 0x388a, 0x69f6, 0x4eb0, 0x8f57,
+    0x2d68, 0x4608, 0xcd19, 0xddef, 0x6d1c, 0x3b48, 0x5f0c, 0x7be8, 0x34ae, 0xb0bf, 0x595e, 0xa6a3, 0xd745, 0x2bf2, 0xb159, 0x502e,
+    0x2f7c, 0x8555, 0x6966, 0x4d6a, 0x96b9, 0xbf6d, 0xea5f, 0xa9ab, 0x95ef, 0x383e, 0xa88b, 0x3268, 0xd383, 0x639c, 0x782c, 0xe2ef,
+    0x45ca, 0x15f0, 0xaeab, 0x3fec, 0x8ec1, 0xbda3, 0x3282, 0x5522, 0xe6d9, 0x460c, 0x5eda, 0xb425, 0x8e97, 0xe413, 0x64a2, 0x8695,
+    0xd0bd, 0xb09f, 0x1f88, 0x8e09, 0x2ef2, 0x7072, 0x5a38, 0xa0ef, 0xdd7b, 0x933b, 0x4da0, 0x20bc, 0x479a, 0x8703, 0x6fb6, 0xd9f3,
+    0x9df1, 0x2e98, 0xda03, 0x1a44, 0x3db2, 0x9fbd, 0x376a, 0x72f0, 0x8755, 0x229e, 0xa505, 0xdce1, 0xb28b, 0x8a63, 0x69d0, 0xea83,
+    0x818b, 0xb341, 0xdc35, 0xb04b, 0xc9b7, 0x2718, 0x48fa, 0x6080, 0x31ca, 0xd633, 0x8c4b, 0x40cc, 0xc09f, 0x2c62, 0x647c, 0xe5b1,
+    0xacf3, 0x8035, 0xb4bd, 0xd5fd, 0x8d05, 0xb349, 0xe82b, 0x292c, 0x7f18, 0x4128, 0xafd7, 0x4f72, 0xd0e5, 0x251a, 0x544c, 0x6da8,
+    0x8efb, 0x4d78, 0x3c7e, 0x95ed, 0x1af0, 0xa883, 0xddef, 0x736c, 0xcafb, 0x662c, 0x205e, 0x8c01, 0x4b5c, 0x8593, 0x341e, 0x6db2,
+    0xa7d3, 0x4956, 0x9393, 0x5826, 0xb32b, 0xe053, 0x905f, 0x3540, 0x7fd0, 0x9f9f, 0xb881, 0x38a6, 0x700a, 0xad87, 0x4690, 0x9f55,
+    0xe861, 0x8937, 0x406e, 0x9dc9, 0x1988, 0x4b3a, 0x4302, 0xb099, 0xa991, 0x4a62, 0x9525, 0x2ad0, 0x5a94, 0x1db2, 0xc23f, 0x3d9e,
+    0x7820, 0x283e, 0x9909, 0x140a, 0x5bea, 0xb1cf, 0x8557, 0xcb8d, 0x90f1, 0xcd41, 0x6d02, 0x7768, 0x2170, 0x8f4f, 0xa8a9, 0x7334,
+    0x83bb, 0xc7a9, 0x73e2, 0x3ae8, 0xccf5, 0x4a18, 0x2988, 0xaefb, 0x875d, 0x44ee, 0xc823, 0x33e6, 0x602a, 0x5244, 0x9d23, 0xe99f,
+    0x8795, 0xa995, 0xd0a1, 0x924f, 0xbe8b, 0x68cc, 0x9027, 0x1e86, 0x7928, 0x9c09, 0x6332, 0xb5e5, 0x509c, 0x112a, 0xa849, 0x5c12,
+    0x932f, 0x8dc9, 0x3c5c, 0xce31, 0x94c1, 0x17ce, 0xe763, 0x8433, 0xa783, 0xd48f, 0x641a, 0xd6c7, 0xb1fb, 0x34ca, 0x610c, 0xcd85,
+    0x9a73, 0x1c04, 0x83cd, 0x2e5c, 0x74a2, 0xce73, 0xa1c1, 0xb1f3, 0x360e, 0x49f4, 0xea5d, 0x60a2, 0x848b, 0x18ee, 0x9d3d, 0xbe59,
+    0x6c06, 0x6448, 0x7c6c, 0xc7ab, 0x35d8, 0xabbb, 0x94ab, 0xdcc5, 0x8295, 0x9fb3, 0x4c80, 0xc053, 0xdcc9, 0xb391, 0x2314, 0x7cf0,
+    0xc2ff, 0x9d1d, 0x36c2, 0x18b6, 0x8985, 0x311e, 0xa5fb, 0xba99, 0x8af5, 0xe177, 0x9c9d, 0x4d6a, 0x3f6c, 0x6e0c, 0xe6f7, 0x6d82,
+    0xd135, 0xab73, 0xdfa3, 0x5f9e, 0x8013, 0x2936, 0x755e, 0x64be, 0x1f4a, 0x4686, 0x868f, 0x649a, 0x1d8c, 0xa017, 0x4a80, 0x27e4,
+    0x6e64, 0xd28d, 0x5f60, 0x9257, 0x6dd4, 0x7514, 0xa6af, 0x3b28, 0x9e31, 0x71e6, 0xd2b9, 0x7ed4, 0x48c4, 0xce8d, 0x1b44, 0x9e75,
+    0x3d50, 0x7474, 0xdd41, 0xae9d, 0xcbb3, 0x5014, 0xd1f9, 0x1bfa, 0x3cf6, 0xbf35, 0x7996, 0xa7b7, 0xdbd1, 0x5e1c, 0x1834, 0x987b,
+    0x48d6, 0x8317, 0xc755, 0x6c84, 0x7a1e, 0xe06f, 0xc2d3, 0x660a, 0xaa79, 0x912d, 0x53b2, 0x2a62, 0x357e, 0xca9b, 0x20e8, 0x4d4a,
+    0x392c, 0x6b6c, 0x3118, 0x5a2a, 0x691e, 0x8171, 0xcfd3, 0x95b3, 0x7244, 0xb2ed, 0x79c6, 0x2272, 0x8249, 0xb61b, 0x7562, 0x3a7a,
+    0xc9d7, 0x5106, 0x30ce, 0xaa35, 0x47a4, 0x3224, 0x7c0e, 0xb91f, 0xd619, 0x18ba, 0xbb23, 0x62de, 0x819d, 0x9e99, 0xdf59, 0xc241,
+    0xcad5, 0x85b9, 0xde8b, 0x7996, 0xcafb, 0x8f21, 0x60a0, 0x1f64, 0x86c5, 0xd297, 0x9989, 0x3300, 0x75ca, 0xb243, 0x1860, 0xa49b,
+    0xc75b, 0x6190, 0x3198, 0x8187, 0xc263, 0x42b8, 0x9ba9, 0xd765, 0xc629, 0x5690, 0x435e, 0xe3e7, 0x54f8, 0xd5c1, 0x9113, 0x6d8e,
+    0xbbaf, 0x5d0e, 0x2d2a, 0xdd5b, 0xac6f, 0x8bc1, 0xca55, 0x7a2e, 0xbca5, 0x1b72, 0xe27d, 0xc20f, 0x9da3, 0x4562, 0x88ab, 0xdf2b,
+    0x98c3, 0x51d6, 0xb4a9, 0xc517, 0x70d4, 0xd673, 0x521e, 0x1818, 0x4630, 0xa6ed, 0x35ce, 0x3e4e, 0xb115, 0x57c2, 0xd513, 0xbbc3,
+    0x17b2, 0x5270, 0x8d93, 0x203e, 0x8689, 0x70a8, 0xdcbf, 0x6c98, 0xce43, 0x607a, 0x9d39, 0x7c28, 0xc6c3, 0xdb01, 0x687e, 0x19e6,
+    0x5678, 0x7148, 0x2136, 0x9cf3, 0xe6c1, 0x4e8a, 0xda01, 0xb329, 0x4e16, 0x2c12, 0x71ec, 0x98f5, 0xe589, 0x3f74, 0xc293, 0x357c,
+    0xbbdf, 0xc8c5, 0x76ae, 0x5566, 0xb9e3, 0x72ce, 0xc9af, 0x4bcc, 0x5c3a, 0x71b6, 0x2a30, 0x1b24, 0x7f4c, 0x9f4d, 0xdf73, 0x78a2,
+    0x29d2, 0x6188, 0x92fd, 0xe2f5, 0x50ae, 0x7f02, 0x13a6, 0x5ce4, 0xd941, 0x88e3, 0xb9d5, 0x261a, 0xb011, 0x4e60, 0xd2d7, 0x3dee,
+    0xaa5b, 0xe449, 0x27e2, 0x987b, 0x4996, 0x67d8, 0x16d6, 0x42d2, 0xb80b, 0x2182, 0x51ce, 0x2e5c, 0x8bcb, 0x68ec, 0xbf79, 0x3a1e,
+    0xde19, 0x72e0, 0x520a, 0xbaf3, 0x85f5, 0xc677, 0xd779, 0x51d8, 0x5f20, 0x340e, 0xb9a3, 0x8089, 0xc735, 0x9207, 0x21fa, 0xb32d,
+    0x96d5, 0x3d28, 0x1c74, 0xaac3, 0xccc3, 0x3636, 0xd841, 0x8ec9, 0xbb3f, 0xd131, 0xe8b5, 0xb66f, 0x8ba9, 0xc121, 0x373c, 0xccbb,
+    0xaf57, 0x8eeb, 0xc1dd, 0x3046, 0xdf57, 0x4ed8, 0xcbeb, 0x7be6, 0x1cbc, 0xa6a9, 0x5aa0, 0x884f, 0x2b06, 0xac1d, 0x77ea, 0xb94b,
+    0x3178, 0xbecf, 0x6534, 0x7f18, 0x38d6, 0xb551, 0x8551, 0xa541, 0x89b1, 0x613e, 0xcb97, 0x9a81, 0x34e6, 0xc1d3, 0xb9cf, 0xe859,
+    0x3442, 0xcfb1, 0xb6bf, 0x5a18, 0x2454, 0x8e7d, 0x2ff6, 0x4852, 0x1a08, 0xce03, 0x7426, 0x79f6, 0x4648, 0x9747, 0x5d06, 0xa2a1,
+    0xd21f, 0x9eff, 0x82f3, 0xbf25, 0x4026, 0xaf11, 0x1d46, 0xaa85, 0xbc2f, 0x2ade, 0xa017, 0xe39f, 0x4f7a, 0x9b21, 0xd353, 0x1a02,
+    0x6054, 0x8ced, 0x6c0c, 0xe8a1, 0x7848, 0x1e1e, 0xc5e3, 0x4d0a, 0x700a, 0x92e1, 0x3ba2, 0x8ff7, 0xb79d, 0x42b8, 0x3b1a, 0x7590,
+    0x262c, 0x1a9c, 0x5ae0, 0xb3b9, 0x33be, 0x47ac, 0xc1b1, 0x920b, 0x4ef0, 0x3ee2, 0x5c74, 0xc43d, 0xe62d, 0x5e92, 0x93df, 0xda0d,
+    0x500c, 0x8d6d, 0xb215, 0xdd75, 0x5516, 0x1ce6, 0x6368, 0x49ac, 0x174c, 0x6e92, 0x9045, 0x8ce9, 0x6278, 0x1b30, 0xbd71, 0x260c,
+    0x3b7e, 0xd375, 0x959b, 0x654e, 0x802b, 0x4884, 0x21ec, 0x2b00, 0x8fcb, 0x60fc, 0x57fa, 0x37a0, 0x7b5e, 0xa3fd, 0x2a6c, 0xc10f,
+    0x705c, 0x3204, 0xed6f, 0x8c8d, 0x3f00, 0x9501, 0xa731, 0x697c, 0xb243, 0x626a, 0xe4ad, 0x887f, 0xe021, 0x65e6, 0x35cc, 0x29c2,
+    0x991f, 0xe3bf, 0x6a1a, 0xd3ff, 0xb975, 0x47c4, 0xa949, 0x2e86, 0x169c, 0xb88d, 0x4d18, 0x2482, 0xa46b, 0x40a0, 0x2920, 0x8e2f,
+    0xb66b, 0xdbed, 0x34c2, 0x6086, 0x2d02, 0x7bee, 0x37e0, 0x9f5f, 0x42bc, 0xdca3, 0xcd01, 0x26c8, 0x5aea, 0x8acf, 0x82df, 0x9ce3,
+    0x5ec6, 0x2108, 0x9eed, 0x276c, 0xda33, 0x9c83, 0x36aa, 0x24d4, 0xc013, 0x9415, 0xa169, 0xe4a1, 0x5c02, 0xbc03, 0x23c6, 0x4dce,
+    0xb8b9, 0xcfb1, 0x608a, 0xb083, 0x336c, 0xbe11, 0x4122, 0x6c50, 0xc53d, 0x915d, 0x5aa0, 0x6c82, 0xcc41, 0x82b5, 0x67fa, 0x27c2,
+    0xcc97, 0x9509, 0x11a8, 0x7cd6, 0xb879, 0xcc9b, 0x7afe, 0x9b8d, 0xcd09, 0x73ea, 0xd1ab, 0x9577, 0x7606, 0xa495, 0x434e, 0xaa1f,
+    0x6054, 0x8c3f, 0xa8c5, 0xe8f3, 0x6198, 0x7192, 0x1e7e, 0x9119, 0x4304, 0xca91, 0x1d26, 0x5826, 0x36be, 0xa993, 0x4472, 0x5630,
+    0x2d44, 0xbd6d, 0x761c, 0x4980, 0x9959, 0x575e, 0x9ea1, 0x4076, 0x5db6, 0x31b2, 0x6f62, 0x5472, 0x3d96, 0xde71, 0x79fe, 0x989b,
+    0x5fe8, 0x3620, 0x85ab, 0x9a75, 0x21ba, 0xb02b, 0x606e, 0x9463, 0xdc0f, 0x2ef4, 0xbe53, 0x4100, 0x9627, 0x613e, 0xd48f, 0x5830,
+    0x9093, 0x48fe, 0x74ce, 0x2276, 0x50f8, 0x9cad, 0x5fd0, 0x2d1a, 0xdf61, 0x4a20, 0x1b18, 0x683e, 0x81af, 0x4cb4, 0x799e, 0x63ce,
+    0x1d04, 0xa3b7, 0x55be, 0x3b78, 0xe183, 0xbe33, 0xab81, 0xd479, 0x4562, 0xe5b1, 0xb759, 0xa1e7, 0xcb35, 0xe7bd, 0xbbb5, 0x72cc,
+    0x3026, 0xbf3f, 0x1ed2, 0xe1a1, 0xa4b3, 0x73bc, 0x4e50, 0xe6cb, 0x5b64, 0x3fc6, 0x63c8, 0xca77, 0x69d6, 0x3030, 0x906d, 0xa99f,
+    0xb96f, 0x4052, 0x22b6, 0xc447, 0x5c8c, 0x9411, 0xa7fd, 0x27b6, 0x8647, 0x5e7e, 0xdf97, 0x74f8, 0xca17, 0x17ce, 0x8761, 0xb35f,
+    0x63a6, 0xd5fb, 0x9629, 0x835d, 0x9b55, 0x67b0, 0xe671, 0x34fc, 0xaebf, 0xd995, 0x7f1c, 0xa68b, 0x2d64, 0xc809, 0x3e90, 0x5dfc,
+    0x26ac, 0xcc1f, 0x1c72, 0x775c, 0xa18f, 0x8df9, 0xd0fb, 0xb523, 0xab93, 0xdbfb, 0x329e, 0xced7, 0xb155, 0x5350, 0x865b, 0xa391,
+    0x51fc, 0x791a, 0xc83b, 0x373c, 0xbab1, 0xe577, 0xa0b5, 0x6108, 0xdbab, 0x48d0, 0xb1a1, 0x9191, 0xd969, 0x6aee, 0x51de, 0xcde9,
+    0x6178, 0x410a, 0xba0f, 0x2a66, 0x7276, 0x2282, 0xe335, 0xc46d, 0x3360, 0x6fd8, 0x9f6f, 0x1d40, 0xc887, 0x96fd, 0x7752, 0xb1a7,
+    0x4bf6, 0x6e90, 0xa715, 0x3246, 0x54ee, 0x9813, 0xc865, 0x8b85, 0x7db0, 0xe665, 0x731c, 0xad2f, 0xd731, 0x79dc, 0xb8dd, 0xd3ff,
+    0x3fc8, 0xa527, 0x4e1c, 0xbf6f, 0xaffd, 0xc7ed, 0x7168, 0x6050, 0xbb07, 0x8cbb, 0x48fe, 0xa9c3, 0xbc99, 0x6db4, 0xdcdb, 0x4d84,
+    0x43de, 0xdf2b, 0x7206, 0x7b7e, 0x3f82, 0x60e0, 0x8d6b, 0xad33, 0xd4e1, 0x3d60, 0x4bb4, 0xb8f9, 0x64dc, 0x449a, 0x8635, 0xa5f9,
+    0x82e3, 0x3f8e, 0xc017, 0x9a0f, 0x22be, 0xd665, 0xa495, 0xa8b5, 0x325a, 0x1f92, 0xcbe7, 0x3f22, 0xa28d, 0xe1d3, 0x9a47, 0x421e,
+    0x5c7e, 0xb35b, 0x3fc0, 0xd563, 0x57de, 0x3544, 0xe4e5, 0x285c, 0x5eec, 0xa903, 0x3e9c, 0x473e, 0x208c, 0xe2c1, 0x5864, 0xcd55,
+    0x1958, 0x7412, 0x2548, 0x3ff4, 0x34f6, 0xb0e7, 0x582e, 0xe2ed, 0xb007, 0x77f8, 0x9f51, 0x8d7b, 0xdcf5, 0xc017, 0x7caa, 0x85cb,
+    0xd5f5, 0x71dc, 0x93cf, 0xb415, 0x6678, 0xdf1b, 0x1be4, 0x7e42, 0xc369, 0x92bd, 0x212a, 0x94b1, 0x671a, 0xc7e7, 0x25d8, 0x4cd0,
+    0xb38f, 0x322e, 0xd679, 0x5340, 0x7860, 0xd557, 0x30e0, 0x4f34, 0xbead, 0x832f, 0x6d30, 0xe56f, 0xb995, 0x401a, 0x2258, 0x8835,
+    0xe921, 0xa07f, 0xd00f, 0xb253, 0xc781, 0xe815, 0x4584, 0x69e8, 0xa857, 0xb905, 0x3374, 0xb6c1, 0xd3e9, 0x39f6, 0xad2b, 0x8ec5,
+    0x4060, 0x77a2, 0x8291, 0x9aa5, 0x4e60, 0x6510, 0x81ed, 0x7966, 0x98cd, 0x60b6, 0x1fe2, 0x5026, 0x6740, 0x182e, 0x8247, 0x3d5a,
+    0xabed, 0x656e, 0x4af4, 0x4c14, 0xce4d, 0x2f02, 0x8283, 0x3ec0, 0x8503, 0xd789, 0x91c3, 0x1ec6, 0x9f99, 0x5aac, 0xdedb, 0x4766,
+    0x7bd2, 0xdab1, 0x8a5d, 0xd0cd, 0x4048, 0xb3c7, 0xe349, 0x62d2, 0xd373, 0xa4d1, 0x4162, 0x2cba, 0xd955, 0x5b92, 0x9a9d, 0xeaf1,
+    0x52ee, 0xa3eb, 0x47e2, 0xc649, 0x289c, 0x3970, 0x85cb, 0xc1a5, 0x7196, 0x1664, 0x87f5, 0x473c, 0x62cc, 0x820b, 0x7524, 0xbb5f,
+    0x77e4, 0x99a3, 0x3fcc, 0xbadd, 0x3d4c, 0xddd1, 0x7326, 0x2e42, 0x7bb8, 0x65d6, 0xb57b, 0x4b60, 0x9ad7, 0x359e, 0xce0d, 0xe5bb,
+    0xaf95, 0x1bf2, 0x997f, 0x29a8, 0x6e48, 0x58b8, 0xc751, 0x7b34, 0xae51, 0xcb07, 0x831f, 0x2b64, 0xdc39, 0x4208, 0xa9bb, 0x2014,
+    0x8fc7, 0x7cf8, 0xaa95, 0x4fe0, 0xd871, 0x5bf4, 0x3e68, 0x83cb, 0x8493, 0x555c, 0xae63, 0x24a2, 0x4890, 0x5bde, 0x81db, 0xe05f,
+    0xce53, 0x8c71, 0x7fa8, 0xbfe7, 0x392a, 0x7600, 0x1fd4, 0x554c, 0xa569, 0x430c, 0x8add, 0x1e30, 0x4858, 0x8975, 0x3634, 0x5ddc,
+    0x1666, 0xdecb, 0x7b8a, 0x8eed, 0x5652, 0x21b4, 0xd749, 0x8d67, 0x1c62, 0x9ddd, 0x5bbe, 0x8153, 0x3516, 0x1d26, 0xcad9, 0x29e6,
+    0x88ab, 0xb633, 0xd0a5, 0x98dd, 0x2c92, 0xc62f, 0xe5a3, 0x6742, 0x1ffe, 0x79b4, 0x8801, 0xc7ab, 0x3250, 0xd05b, 0x94c9, 0x3aea,
+    0xd809, 0x6be8, 0x462a, 0x8685, 0x5fb2, 0x7176, 0x8f4d, 0x5102, 0xdef5, 0x7d0c, 0xa9cb, 0x5f42, 0x2d20, 0x1b9e, 0xbd27, 0x7362,
+    0x8af7, 0xc691, 0x6db8, 0xa9c3, 0x863d, 0x5ff8, 0xb31f, 0x45aa, 0x8a6b, 0x8779, 0xe2fb, 0xbbfb, 0xc471, 0x6cf2, 0x81b3, 0x99ad,
+    0x4ba4, 0xb687, 0xd34d, 0x9cf3, 0xc725, 0xa3cf, 0x8953, 0x251a, 0x7dec, 0x45ee, 0xce39, 0x51a4, 0x69fc, 0x41bc, 0xe15f, 0x3e8a,
+    0x9eeb, 0x4d36, 0xdedb, 0x3640, 0x1fb6, 0x7a5e, 0xb1af, 0xd243, 0x55a2, 0xa929, 0xe6ff, 0x5056, 0xa983, 0x8549, 0x6eda, 0xe3dd,
+    0x9621, 0xcb2d, 0x67ba, 0x4156, 0xc325, 0x8e75, 0x6acc, 0x94b7, 0x4520, 0x77d2, 0x9c53, 0x1c5a, 0x70b8, 0xcae9, 0x7cda, 0xa733,
+    0x6a18, 0x11e6, 0x395e, 0x6880, 0x8d0d, 0x22c8, 0xce19, 0x59e8, 0xc5cd, 0x91df, 0x7942, 0xe7af, 0x5a0c, 0x15da, 0xa273, 0xdabf,
+    0xc387, 0xe0cd, 0x1da0, 0xcd39, 0xc147, 0x28ca, 0x5132, 0x364a, 0xb84b, 0x85c3, 0x3bd8, 0xd799, 0xaa8d, 0x2f88, 0xbe11, 0x4d4e,
+    0xd74b, 0x9791, 0x7b7c, 0xabe1, 0x6a14, 0x93e1, 0x6656, 0xbedd, 0xac2d, 0x3768, 0x7446, 0xb21f, 0x44ac, 0x7aaa, 0xc2a7, 0x1cec,
+    0x6620, 0x9a8d, 0xa277, 0x55cc, 0x122c, 0x6bc0, 0x7e6c, 0x3778, 0xb69f, 0x2654, 0x7364, 0xadd3, 0x8971, 0x5040, 0x3052, 0x6f3a,
+    0xc079, 0x3b88, 0x7e0c, 0x64a2, 0xdf7f, 0xbca7, 0x8d2f, 0x581a, 0xa359, 0x3218, 0xcedd, 0x9c57, 0xab45, 0x239a, 0xdf77, 0xa595,
+    0x3592, 0xea43, 0x6cc8, 0x9d55, 0x59f6, 0x20c0, 0x934f, 0x509c, 0x3ea2, 0x89a9, 0x22da, 0x70a8, 0xb61d, 0x2dca, 0x6af2, 0x41dc,
+    0x883d, 0x632e, 0x53a0, 0xd123, 0xb235, 0x16f8, 0x94f9, 0x37b8, 0x1ca0, 0x5306, 0x9a85, 0x1aec, 0x5e3e, 0x827b, 0x9eb9, 0xc201,
+    0xe28f, 0x25ee, 0xcbf7, 0x68f0, 0xc4cb, 0x9ecd, 0xb0dd, 0xc9ef, 0x1d4a, 0xdd4b, 0xd905, 0x6e1e, 0xbb59, 0xa661, 0x3000, 0x20f4,
+    0x523a, 0x35ac, 0x1b86, 0xd4e7, 0xa869, 0xeb4d, 0x69a0, 0xce0d, 0x4fc2, 0xd7b1, 0x5efc, 0xc3c5, 0x6c54, 0xe2e1, 0x99cf, 0x8311,
+    0xbf53, 0x6ab0, 0x277a, 0xcf23, 0x9bd9, 0x3e86, 0xabfb, 0x7568, 0x4fe4, 0xca8b, 0x306a, 0xdfef, 0x9adb, 0xaf89, 0x89ad, 0xa051,
+    0x7348, 0x31e2, 0x5a92, 0xbc39, 0x49ca, 0xa4d1, 0x7624, 0x42ea, 0xb7af, 0xdc97, 0x5e8a, 0x2568, 0x9e2f, 0x7bd8, 0x6118, 0xb10b,
+    0x1aa0, 0x98f7, 0x2c9c, 0xe9cb, 0xb4f9, 0x1f12, 0xd969, 0x3c5e, 0x6878, 0x928f, 0x5062, 0xdcb5, 0x8b6d, 0x4eac, 0xb0eb, 0x2470,
+    0xd5bb, 0x32fe, 0x5072, 0xd98b, 0x22c0, 0x7db2, 0x99f9, 0xbfcb, 0x5444, 0x14f4, 0x75b4, 0x6476, 0x999d, 0x24da, 0x33f4, 0xc181,
+    0xe015, 0x3030, 0x659e, 0x823f, 0x4f4e, 0x2aa6, 0xcb27, 0x635e, 0xbe43, 0x36d4, 0xb791, 0x264c, 0x9f27, 0x1c5c, 0x9c3b, 0xc5cf,
+    0x630c, 0x19b6, 0xaac7, 0xca57, 0x87ab, 0xc1b1, 0x924b, 0x38a4, 0x6892, 0x2a7c, 0x812f, 0xc813, 0x338e, 0x20f0, 0xa10d, 0x5492,
+    0x17f2, 0xaa0f, 0x6fc4, 0x9755, 0xe185, 0x2e7a, 0xa8b9, 0x247a, 0xcc47, 0xd9cb, 0x3372, 0x4da6, 0x8fc3, 0xd8cd, 0x47c0, 0x2d52,
+    0xb8d9, 0x591c, 0xd915, 0x50b6, 0xa2b7, 0x2d4e, 0x86cb, 0xa92b, 0x1534, 0x5f3c, 0x40f8, 0xab2f, 0x8f71, 0x6e5c, 0xc843, 0x2ce4,
+    0x5540, 0x6ed2, 0xa4e7, 0x34ea, 0x93a3, 0xdfeb, 0xa647, 0xcf41, 0x19ea, 0x70c6, 0xc5ad, 0x9425, 0x7856, 0x5b5c, 0x9f07, 0x672a,
+    0x2b22, 0xe631, 0x3678, 0xc429, 0x2052, 0xb8fb, 0xd89b, 0x2264, 0x6c82, 0xcd5f, 0x51c4, 0xcc3b, 0xe1cf, 0x2c7c, 0x9cdf, 0x53ca,
+    0xc8a5, 0x2bb6, 0x33e6, 0xb6a1, 0x8e3f, 0xc33d, 0x32fc, 0x4c30, 0x977f, 0xd529, 0x4bb2, 0x6c68, 0xa1df, 0xd1eb, 0xb9b7, 0x243e,
+    0x8407, 0xaea5, 0x1b56, 0x4f14, 0xaeed, 0x6946, 0x1d76, 0x454e, 0xd7cf, 0x672a, 0xe34d, 0x55e8, 0x3020, 0xc097, 0x9157, 0x4c10,
+    0x5010, 0xb56b, 0x8185, 0x5512, 0xc613, 0x803b, 0xba03, 0xc749, 0xea5d, 0xabc3, 0xd27f, 0x4f6a, 0x9303, 0xe3e7, 0x5ed4, 0x21c6,
+    0x9871, 0xc359, 0xe8c7, 0x880b, 0x8eb3, 0x414a, 0xd823, 0xbc4f, 0x70fc, 0xe773, 0x6b62, 0xb77b, 0xc799, 0x783a, 0x47ca, 0x2c6a,
+    0x73e2, 0x577a, 0x99f7, 0x326e, 0x86a3, 0x21f2, 0x4a06, 0x711a, 0x3df2, 0x5fdc, 0x97f9, 0x793c, 0x3d24, 0xed1d, 0xb38b, 0xc2c1,
+    0x986f, 0x7902, 0xb353, 0x5ddc, 0x4d16, 0x8e57, 0x2b78, 0xbc63, 0x844b, 0x9fe7, 0x2e7a, 0x83f1, 0xa06f, 0x2c68, 0x4fb6, 0xb18b,
+    0x2f28, 0x8fef, 0x72d6, 0x3a82, 0xe39f, 0x6988, 0xb937, 0x3604, 0xe423, 0xbb01, 0x6294, 0x7822, 0x526c, 0x4120, 0x5abe, 0xe9e5,
+    0xbfeb, 0x213a, 0x7bf8, 0xd61b, 0x1946, 0x851f, 0x2892, 0x5198, 0x95fd, 0x3610, 0x9c41, 0xb9e3, 0x5946, 0xe815, 0x4750, 0xc80f,
+    0x59b4, 0xd9fb, 0x7636, 0xabaf, 0x3e52, 0x55b2, 0xcb9d, 0xae09, 0x81a1, 0x1a9c, 0xc979, 0xb93d, 0x7fc6, 0x6f5c, 0xe725, 0x3886,
+    0x9e47, 0x66d8, 0xa59b, 0x2ccc, 0xb751, 0xd0dd, 0x3ae2, 0x6c08, 0xde63, 0xc7c9, 0x3210, 0xa37d, 0x4cc8, 0xcc31, 0x7f74, 0x706e,
+    0x9ff3, 0x55d2, 0xaf69, 0x6f04, 0xdce9, 0x7802, 0x40c0, 0xa26b, 0x73b8, 0x96a3, 0xec99, 0x5b32, 0x87f3, 0xc335, 0x6d2e, 0x2aee,
+    0xb335, 0x7e1e, 0x5582, 0x42c8, 0x6626, 0x4d72, 0x561a, 0x1fe4, 0xda2b, 0x8a71, 0xb5f1, 0x668a, 0x8e5b, 0xc18d, 0xd9e3, 0x4424,
+    0x7634, 0xb103, 0x363a, 0x219e, 0x7fbe, 0x597e, 0xb8e9, 0x7e90, 0x60fc, 0x4e7a, 0xae83, 0x98e9, 0xbded, 0x665e, 0x3540, 0x8e2f,
+    0xdadf, 0x7b7a, 0x9c0d, 0xc50b, 0x730e, 0x614c, 0xb7e5, 0x9747, 0x3cce, 0xd5c5, 0x2fe0, 0xbef1, 0x21dc, 0x5fd4, 0x8269, 0x333c,
+    0x48f2, 0x96d7, 0x7a46, 0x4f46, 0x612a, 0x6f2e, 0x4312, 0xaf41, 0x4f58, 0xe901, 0xa659, 0x44da, 0x2896, 0xe1e1, 0xd46f, 0x8aaf,
+    0xa18f, 0xbedb, 0x6d32, 0x3d5a, 0x812f, 0x4e7e, 0xa151, 0x3fbe, 0x7e0e, 0x9993, 0x1fde, 0x8b41, 0x5d64, 0x6de2, 0x8ffb, 0xb07d,
+    0xee8b, 0x7032, 0x63cc, 0xe18f, 0x75a4, 0x4f1a, 0xe705, 0xa10d, 0x7248, 0xbe69, 0x8ecd, 0xdb8f, 0x20a6, 0x3ba4, 0x8d5b, 0x9dab,
+    0xe305, 0x6ec4, 0xd3a3, 0xa195, 0x7660, 0x3646, 0xc92b, 0x99e7, 0xb631, 0x74ec, 0x4120, 0xb9bb, 0x7dde, 0x5ee0, 0x3c00, 0xce95,
+    0x27ae, 0xbd01, 0x1a74, 0xcc09, 0x35d6, 0xaa0f, 0x4330, 0x23e0, 0x774e, 0x6680, 0x325e, 0x5ab8, 0xc169, 0xaba9, 0x8421, 0xd5ed,
+    0xb6ef, 0x2f98, 0x3d44, 0x5726, 0xa763, 0x62be, 0x58b6, 0x86bd, 0x2c86, 0x9b19, 0x4784, 0x8b5d, 0x39bc, 0xe0b5, 0xaa21, 0x6180,
+    0x3cf8, 0xdb1f, 0xb63f, 0x4452, 0xe497, 0x7558, 0x9299, 0xe0bf, 0xa6b7, 0x30a4, 0xb57d, 0x5714, 0x13ac, 0x86a3, 0x6c5e, 0x63e8,
+    0x49a0, 0xe09f, 0xa743, 0x28d0, 0x7f6e, 0x4462, 0xa9f9, 0x6556, 0x18aa, 0x7574, 0xb091, 0xc217, 0x4328, 0xcf47, 0x7908, 0xd555,
+    0x5910, 0xa3a9, 0xbd77, 0x4a32, 0xaa65, 0x164c, 0x544a, 0x8111, 0x3e98, 0x9279, 0x204a, 0xa7a7, 0xdb49, 0xb715, 0x2f9c, 0x673a,
+    0x4d4e, 0xcad7, 0xa9df, 0x4194, 0x6ac4, 0xed57, 0xc901, 0xad8d, 0xd01b, 0x6fe4, 0x7308, 0x3c92, 0x85e7, 0x9689, 0x295e, 0x7f6a,
+    0x8ccd, 0xaf19, 0x5168, 0xcc19, 0x3416, 0x8e2d, 0x7d1a, 0x2c7e, 0x572a, 0xb707, 0x767a, 0x2302, 0x3e72, 0xc1cd, 0xafb1, 0x5aec,
+    0x8f33, 0xbfbd, 0x8719, 0x3ac4, 0x73e8, 0x4c82, 0xa0a9, 0x2746, 0xb067, 0x4342, 0x6f50, 0x9533, 0xd851, 0x6106, 0xadc9, 0x1a14,
+    0x3e90, 0x8a6b, 0xd861, 0x370c, 0x1e7c, 0xb6bd, 0x923d, 0x583e, 0xcd37, 0x1884, 0x8897, 0x3d04, 0xdc7d, 0x94eb, 0x4fca, 0x4186,
+    0xd8a5, 0xbfab, 0x95c9, 0xd8e5, 0xa265, 0xe0af, 0xb073, 0xba9b, 0xa355, 0x6300, 0x3e42, 0xdc15, 0x4c5a, 0x7576, 0x6588, 0xcd2d,
+    0x859f, 0x56f4, 0xe235, 0xc9f3, 0x4908, 0xa23f, 0x3d88, 0xe207, 0x956d, 0xbf77, 0x82e3, 0x3abe, 0x1fca, 0xa4c9, 0xe541, 0x743a,
+    0xb00d, 0x3e84, 0x197a, 0x83e3, 0x2cd8, 0xd9a9, 0x55d0, 0x7552, 0xcca3, 0x7140, 0x8a97, 0xd3bb, 0x516c, 0xecb9, 0xc3b3, 0xa3a9,
+    0xdf51, 0xba1d, 0x23d4, 0xd5b5, 0xb993, 0x1e92, 0xc527, 0x830d, 0x8fd5, 0x5d88, 0x231e, 0xb37d, 0x6710, 0xafd7, 0x3906, 0x17dc,
+    0x52b6, 0x44c4, 0x5de8, 0x9fa1, 0xdfbb, 0x7abe, 0x5960, 0xe62f, 0xb2f3, 0x669e, 0x493c, 0xa0bd, 0x3b6e, 0xd5ed, 0x4036, 0x17fa,
+    0x821b, 0x4a38, 0xd48d, 0x9467, 0x251e, 0xa901, 0xc3af, 0x6236, 0x13c8, 0x2888, 0x5520, 0x3b14, 0xbc1f, 0x7602, 0x61f2, 0x46f8,
+    0x5698, 0x22c8, 0x948d, 0xc5ad, 0x4254, 0xe8f7, 0x89a1, 0x56b2, 0x2cbc, 0x8277, 0x21f6, 0x958f, 0xd78f, 0xa839, 0x705c, 0xb831,
+    0x968d, 0x6a56, 0x6bb0, 0x42ee, 0x903f, 0xe21f, 0x643e, 0x849b, 0xd25d, 0xb405, 0x99f3, 0xc6fd, 0x3d50, 0x1866, 0x9b99, 0x479e,
+    0x584a, 0x6fca, 0xa931, 0x21e0, 0xc851, 0x2878, 0xdf6f, 0xacd1, 0x5bbe, 0xd523, 0xc567, 0xaab3, 0x4c90, 0x2016, 0xd92f, 0xbc31,
+    0x8b05, 0xaeb7, 0x69f0, 0x15aa, 0xcb63, 0x5bae, 0x2976, 0xc27f, 0x836b, 0x1da0, 0xa529, 0xca17, 0xd1e3, 0x4da2, 0x26ac, 0xd7d1,
+    0x8dc1, 0x36ce, 0xcf89, 0x6e90, 0xdf6d, 0xc341, 0x85d3, 0xdd21, 0x3a1c, 0xd0fd, 0x467e, 0x5aa4, 0x88bb, 0x245c, 0xaf59, 0x4528,
+    0xeaa1, 0x24be, 0xcad5, 0x6044, 0x720a, 0xc711, 0xa111, 0xdc19, 0x5e36, 0xc51f, 0x492a, 0xcde7, 0x8947, 0x18b8, 0x93e3, 0xb0d7,
+    0x7c2a, 0x2e02, 0x90bf, 0x5b5e, 0xaf35, 0xa091, 0x3a9e, 0x5cd2, 0x1c4a, 0xe07b, 0x4a3e, 0xafc7, 0xd831, 0x1e86, 0xb64d, 0x6c3c,
+    0x3c26, 0x22ea, 0x5e92, 0x8757, 0xbe55, 0x6d8a, 0xa2ab, 0xd5a3, 0xe811, 0x3fd2, 0x9ce9, 0x5b70, 0x8fab, 0x20fa, 0xd07b, 0x6eaa,
+    0x44f0, 0x1a30, 0xea33, 0x97c1, 0xca8b, 0x5d3a, 0xe315, 0x850b, 0x65d4, 0xa013, 0xbf09, 0x4a6a, 0x2ba2, 0x85c5, 0x6cb8, 0xe775,
+    0xcc85, 0x25e0, 0x8055, 0xc523, 0x9f87, 0x6266, 0xdc0d, 0xb161, 0x2ecc, 0x7438, 0x4e06, 0x7348, 0xb737, 0x32dc, 0xafd3, 0x87e7,
+    0x7848, 0x23ee, 0x3270, 0x7118, 0x14e4, 0x2d22, 0x7972, 0x3602, 0xc737, 0x538e, 0x25ba, 0x9d6f, 0x16d2, 0xb3b5, 0x3b56, 0x9421,
+    0x29d2, 0xb59b, 0x6626, 0x8cad, 0x6d5c, 0xd8c7, 0x4b0c, 0x19d8, 0x69ec, 0x28e2, 0x5b84, 0xdc21, 0x786e, 0x4a7a, 0x9ad3, 0x21d8,
+    0x52c8, 0xc885, 0x67a2, 0xa429, 0xcca9, 0x4ce6, 0xbb53, 0x20a4, 0xa2b5, 0x5866, 0xae4f, 0x8049, 0x399a, 0xaed9, 0x89f3, 0x23e6,
+    0x774a, 0xccb5, 0x3cd2, 0x8783, 0xa429, 0x40d6, 0x8ef1, 0x6774, 0x2b52, 0xd23d, 0x8193, 0x7a56, 0xc617, 0x53e2, 0x8133, 0x765a,
+    0xc6cd, 0xd969, 0xb2e9, 0x90b7, 0x2f60, 0xc2bd, 0x3258, 0x8991, 0x1d02, 0xbb97, 0xddbb, 0x7878, 0xb5a7, 0xd329, 0x6950, 0xbc71,
+    0xa83f, 0x3cac, 0xbbb7, 0x1d8a, 0x526c, 0x7d5e, 0x3f72, 0xd59d, 0x8a05, 0xc767, 0xa125, 0xaa9d, 0x5534, 0xa5ab, 0xe3c9, 0xce27,
+    0xaf87, 0x3988, 0x702c, 0x4b54, 0x1886, 0xbf37, 0x9f63, 0x3ce4, 0xd749, 0xc7f9, 0xa027, 0x6c1a, 0x1e6a, 0x480c, 0x87b5, 0x2ef2,
+    0x7e62, 0xe557, 0xa7ed, 0xbb89, 0x766e, 0x5466, 0x9f2b, 0x36b4, 0x12a8, 0x4a62, 0x7fc2, 0x2b80, 0x68a4, 0x74ae, 0xd0a1, 0x37f0,
+    0xc07f, 0x9337, 0xe8df, 0x7a48, 0x9a5d, 0x34c2, 0xbf3f, 0x7ee0, 0x1600, 0x394c, 0x799e, 0x27f2, 0x694a, 0x7fb2, 0x926f, 0x2616,
+    0x48fe, 0x7fea, 0x2c68, 0x89fd, 0xbd57, 0xa1ed, 0x3e8e, 0xcbf3, 0x52ea, 0x6202, 0xe445, 0x4454, 0x7942, 0x9545, 0xa6c7, 0xc13b,
+    0x7988, 0x19ca, 0xaa1b, 0x56d2, 0x9249, 0x1c1a, 0x9f77, 0x4d7e, 0x9b43, 0x90c5, 0x698a, 0xe143, 0x82e9, 0x97c5, 0x6a30, 0x8277,
+    0x8459, 0x910f, 0x4516, 0x81a9, 0x276a, 0x919b, 0x4310, 0x7c02, 0x1ffa, 0xab2d, 0x6aaa, 0x5b32, 0x3790, 0x747a, 0xddb5, 0xcebf,
+    0x52e8, 0x9f3d, 0xde2d, 0x6fc2, 0x36c8, 0xbb95, 0x4b58, 0x7dcc, 0x89c9, 0xb9a5, 0x253c, 0xc38b, 0x6b9a, 0x54ec, 0xcee3, 0xa811,
+    0xe2cd, 0xc155, 0x9b2f, 0x1d8e, 0xdf33, 0x44be, 0x1fb4, 0x5eca, 0x4cb2, 0x8cc1, 0x69d4, 0xe511, 0xbfbb, 0x487c, 0x7c02, 0x2df6,
+    0xd411, 0x583c, 0xb41d, 0x6960, 0x9c09, 0x3142, 0x7bfc, 0x1dbe, 0x5598, 0xe663, 0x7ffc, 0x1d96, 0xaa29, 0xc763, 0x97e5, 0x4b60,
+    0xa941, 0x5b6c, 0x5092, 0x9a05, 0x4408, 0x6d34, 0x256e, 0x7faa, 0x44be, 0xca63, 0xa49f, 0xd397, 0x243c, 0x63f4, 0xe3bf, 0x5e3a,
+    0xa45d, 0xe8af, 0x65d0, 0xc869, 0x8a4b, 0xb5b5, 0x62ae, 0x400e, 0x7bb8, 0xd30b, 0xb0bd, 0x92a3, 0x7dce, 0xec49, 0xa821, 0x32d6,
+    0xd3e5, 0x7420, 0x98df, 0x2290, 0xbaef, 0x7af4, 0x9b4f, 0xcb39, 0xac8d, 0x9f55, 0xd62d, 0x6df8, 0xb7d3, 0xcee9, 0x8aaf, 0x568c,
+    0xbcc1, 0x986b, 0xe309, 0x3854, 0x5818, 0xb065, 0x8f0b, 0x2fc2, 0xe64d, 0x476c, 0x1912, 0x950f, 0x325e, 0x69fa, 0x48b8, 0x132c,
+    0x62da, 0x8f77, 0x329c, 0x702e, 0xe519, 0x2ecc, 0xc429, 0xdeef, 0x37b4, 0xb283, 0x4698, 0x9a85, 0x1624, 0x9025, 0xe8df, 0xb04b,
+    0x31e0, 0x638a, 0x1646, 0x5212, 0xb7d1, 0x72b6, 0xa967, 0x4cd6, 0xc95d, 0x3eb8, 0x85bb, 0x2db6, 0x1c1c, 0x7c72, 0x90d7, 0x2fb2,
+    0x5834, 0x8a89, 0xa14b, 0x6ff0, 0xcd2b, 0x9f25, 0x28a2, 0x6c24, 0xb047, 0x4cf8, 0xe68b, 0x6ed2, 0x7f2a, 0x2ff8, 0x90cb, 0x15c0,
+    0x856b, 0xc4fb, 0xdd61, 0xa989, 0x865b, 0x67f6, 0x4f96, 0xae0b, 0x745c, 0x4594, 0x5f08, 0xe62d, 0xadd9, 0x3a88, 0xe067, 0xcb39,
+    0x3f6e, 0x5120, 0x33c4, 0xc985, 0x26b0, 0x639e, 0xd66d, 0xc00b, 0x5834, 0xdeb9, 0xae35, 0xbe6b, 0xe66b, 0x5066, 0xb609, 0x8911,
+    0x61ba, 0x1832, 0xd013, 0x53a2, 0xb283, 0x6d32, 0x4f6c, 0x90e5, 0xc933, 0x5840, 0xe1e1, 0x9f9b, 0xd48b, 0xb37f, 0x480e, 0xc6c9,
+    0x5ee8, 0xef6d, 0xd12d, 0x6818, 0x4f88, 0x7c2c, 0xe49f, 0x716c, 0xa6b7, 0x7fe2, 0x8bd7, 0x28c2, 0xaba3, 0x6ade, 0x2f98, 0x3c4e,
+    0x5ac6, 0x83c5, 0x682c, 0xb395, 0x3eec, 0x6ea8, 0x58ee, 0x2be6, 0xce3b, 0xbebf, 0x1408, 0x2c38, 0xb571, 0x54da, 0xc11d, 0x2824,
+    0xb1d3, 0x51e8, 0xdb03, 0xc803, 0xb6e5, 0xe91f, 0x3264, 0xcf99, 0xb65b, 0x8d7d, 0x2ace, 0xe4bf, 0xbb5b, 0x5fa4, 0x2232, 0x6b50,
+    0x3cb6, 0xb571, 0x1dae, 0x47fa, 0xd41f, 0x853b, 0x21fa, 0xcbb1, 0x4386, 0x9e67, 0x54c2, 0x7b5c, 0x8fef, 0x40f2, 0x2ff2, 0x7410,
+    0x4ca4, 0x3732, 0xd477, 0x7d5a, 0x55b2, 0xb3cf, 0xcae9, 0x9853, 0x8605, 0xb171, 0x2f88, 0xd421, 0x85bd, 0x3142, 0xb301, 0x989f,
+    0xc02d, 0x8639, 0x36a6, 0x1c1e, 0x5344, 0xd2fd, 0xc0a5, 0xc407, 0xa897, 0x4968, 0x3578, 0xce63, 0x7136, 0x3e50, 0x7284, 0x28d4,
+    0xbe9f, 0x7338, 0xb3a1, 0xe21d, 0x341e, 0xcf29, 0x9b25, 0x64bc, 0xe565, 0xc2e1, 0x5b40, 0xa83d, 0x460c, 0x9bd7, 0xc167, 0x38b8,
+    0x2c78, 0x9673, 0x4d9a, 0xa403, 0x577c, 0xd385, 0xea81, 0x92e1, 0xa339, 0x28f6, 0x6dea, 0xc007, 0x482c, 0x6486, 0x5c54, 0x8b79,
+    0x4e7e, 0x7d2c, 0x3416, 0xaa01, 0x3f56, 0x2d24, 0xb21f, 0x637c, 0x3486, 0x408a, 0x8b53, 0x1ad4, 0x49bc, 0x3344, 0xc173, 0x186e,
+    0x68b2, 0xaa39, 0x2f0c, 0x781c, 0x724e, 0x98b3, 0x657a, 0x8099, 0xaf17, 0xc7f7, 0x7386, 0xbcc3, 0xdf45, 0xd919, 0x9fc9, 0xc5db,
+    0xe567, 0x5850, 0xa8d5, 0xbbff, 0x646c, 0xa4b3, 0x5614, 0x99dd, 0x77f2, 0x63d8, 0xe419, 0xc48d, 0x30cc, 0x6968, 0x4994, 0xbcab,
+    0x9723, 0x8d8f, 0x7a80, 0xdac7, 0x3c56, 0x5f8e, 0x812d, 0x9a75, 0x6fac, 0x5a22, 0x9f9d, 0xe9db, 0xac01, 0x5196, 0x4bb0, 0xdfad,
+    0x7ff8, 0xd6e5, 0x36fe, 0xa98b, 0x5958, 0xe4dd, 0x8d41, 0xa15b, 0x58fc, 0x747e, 0x3b1a, 0x1d60, 0xd703, 0xb719, 0x6a76, 0x29f4,
+    0x7d14, 0xa19d, 0x5b9e, 0x3144, 0x7864, 0xcde5, 0x261e, 0xe38f, 0x8b45, 0x1600, 0xc679, 0x4400, 0x809f, 0xbd47, 0x6b80, 0x9eff,
+    0x2112, 0x8945, 0x60f6, 0xdd13, 0x8297, 0x1978, 0xb59d, 0x9215, 0x6ea2, 0x77c8, 0x4552, 0x8a23, 0x6214, 0x1e7a, 0x9659, 0xdb45,
+    0x2d1c, 0x9bfb, 0x45a6, 0x5c46, 0x2e68, 0xa607, 0xe4b7, 0x67a2, 0xb2e3, 0x3018, 0x8af9, 0x4b26, 0x58c0, 0x39c2, 0x76be, 0x9eb1,
+    0x349c, 0xb9d9, 0x4632, 0x961d, 0x30c8, 0x1f36, 0x8bb5, 0x3c9e, 0x1892, 0xd55b, 0x3e2a, 0xb291, 0x63a6, 0xdb4b, 0xc81f, 0xa2b5,
+    0xe7f9, 0xd065, 0x47f4, 0x2b9a, 0xde8b, 0xcb4f, 0x9343, 0xb5f3, 0x55d6, 0x63f4, 0x96b9, 0xaa9b, 0x628a, 0xdc67, 0x3df0, 0x692a,
+    0xc0c3, 0x2426, 0x665e, 0x322c, 0x55aa, 0xa767, 0x64dc, 0x5248, 0x6264, 0xa15d, 0x4066, 0x7f02, 0xa389, 0xa517, 0x44f8, 0x8fcd,
+    0xe40d, 0x6aee, 0x7700, 0xc77f, 0x97af, 0x6668, 0xa9d3, 0xe117, 0x306a, 0x71ae, 0xd4ad, 0x3b5a, 0xa45d, 0xe85b, 0xb52f, 0x9213,
+    0xa76b, 0x5acc, 0x709c, 0xa61f, 0x3daa, 0x87f5, 0x72b8, 0x389c, 0xd6a9, 0x1ab0, 0x6f8e, 0xabe5, 0x407e, 0x6116, 0xeb95, 0x6b46,
+    0x3be2, 0xaacb, 0xca47, 0x7b2c, 0xae81, 0x43e0, 0x8ba9, 0x399e, 0x7792, 0x926d, 0xc8ad, 0x6784, 0xa3ad, 0xe269, 0x5500, 0x1f1c,
+    0xdba5, 0x8b77, 0x3b50, 0x1862, 0x75be, 0xc121, 0x57ca, 0x361c, 0x9167, 0x6ae2, 0x1bd0, 0x3214, 0x7742, 0x8787, 0x1638, 0x6ba2,
+    0xccdf, 0x87dd, 0xb34f, 0x381a, 0x75ba, 0x3c42, 0x68ae, 0x1c30, 0x82d3, 0xd801, 0x5ca4, 0x3590, 0xc861, 0x2a42, 0xba51, 0x7938,
+    0xd90b, 0xc607, 0x5a50, 0xeb2b, 0x8ebd, 0xcec5, 0x81ab, 0x5692, 0xe157, 0x7b58, 0xcb4b, 0xac0d, 0x9873, 0x6fac, 0xa723, 0xdeb5,
+    0x3ef0, 0x932b, 0x4dc2, 0xbf3f, 0xda59, 0x1e2e, 0x4f56, 0xce2d, 0x3cbc, 0x8f43, 0x5dc0, 0x506c, 0x2922, 0x81b9, 0x417c, 0x7cc8,
+    0xb0d9, 0x2eb4, 0xcde9, 0x215c, 0x7896, 0x3d46, 0x6c0c, 0x1ce2, 0xa887, 0x4624, 0x8c3b, 0x5674, 0xa7ed, 0xdf09, 0x57d0, 0x22aa,
+    0x3a70, 0xe219, 0x4d1a, 0xaa71, 0xa359, 0xc9c5, 0x2138, 0xe0ef, 0x2ede, 0xc081, 0x5136, 0x66ba, 0x92d7, 0x3e12, 0xb11f, 0xa60b,
+    0xc429, 0x1f90, 0x5f14, 0x45a6, 0xbeaf, 0x7642, 0x33b4, 0x1bac, 0xcdd9, 0x9fd3, 0xc015, 0x90ab, 0x5b6a, 0x501a, 0xc62b, 0x4608,
+    0xe789, 0x514a, 0x214e, 0xd937, 0x98ff, 0xbb4d, 0x3f90, 0x7fa4, 0x322c, 0x9bfb, 0xbc23, 0x6f78, 0x27b0, 0x9a49, 0x5114, 0x7d58,
+    0xd47f, 0xba63, 0xa43b, 0x4d46, 0x9915, 0x3fea, 0xe4f1, 0x316e, 0x98df, 0x2272, 0xc569, 0x32c0, 0xa12f, 0xd3ed, 0x3d46, 0x5b52,
+    0x70c6, 0xc3e5, 0x8b7f, 0xcc13, 0x81af, 0xd459, 0x42b4, 0x1c70, 0x9651, 0x7424, 0xbb7f, 0xa6af, 0x1882, 0xc355, 0xded9, 0x6e88,
+    0xa90f, 0x1d26, 0x6d70, 0xb08b, 0xca0d, 0xddff, 0xb889, 0x9649, 0x606c, 0xc4d5, 0x9a31, 0x52f4, 0x7ff8, 0x1a40, 0x774c, 0x4cce,
+    0x2a32, 0x95e1, 0xb143, 0xa033, 0x87c7, 0x4038, 0x6f02, 0xe959, 0x77ac, 0x3fa0, 0xd9f9, 0x880f, 0x2e6c, 0xa6c9, 0x8bf3, 0xd421,
+    0x5c8a, 0xa17d, 0x8e57, 0x77fc, 0x4118, 0x8089, 0x1cb8, 0xbad5, 0x39ea, 0xdb87, 0xc00f, 0x1d08, 0xcbdd, 0x55d6, 0xc715, 0xb0b5,
+    0x3412, 0xa12f, 0x5624, 0xae73, 0x2a7a, 0x3448, 0x5752, 0x9ddf, 0xbce7, 0x5de4, 0x8f45, 0xc0ed, 0x218e, 0x6fe6, 0x529e, 0xd689,
+    0x24c2, 0x8f4f, 0x307e, 0xc6ef, 0xd9cf, 0x29bc, 0x5be2, 0xa9a7, 0xc85d, 0x3d98, 0x5704, 0x8dbf, 0x21fa, 0xa01d, 0xc97f, 0x50c0,
+    0x2690, 0xdc7b, 0x61b8, 0x99a1, 0xe7a7, 0x16c0, 0x67c6, 0x6248, 0xd737, 0x27a4, 0x865d, 0xb0cd, 0x3f88, 0x947f, 0xa03b, 0xcb95,
+    0x8a4f, 0x5afa, 0xc847, 0xa315, 0x6b70, 0x8beb, 0xd26b, 0xaca7, 0x2a88, 0x7d40, 0xdc2d, 0x9113, 0xd1e1, 0xeb6f, 0x4ca8, 0xb0ef,
+    0xdb6b, 0x57f4, 0x21ea, 0xdc65, 0xb267, 0x2992, 0x9889, 0xbd89, 0x4c54, 0x3b12, 0xb5ff, 0x9b69, 0x54d6, 0xa323, 0x8745, 0x40da,
+    0xae9d, 0x1a22, 0x9349, 0x77b2, 0x5c04, 0x4896, 0x1bec, 0x904b, 0xbc4b, 0x2032, 0x5e48, 0x3e52, 0xebf5, 0x563e, 0x4518, 0xb6a5,
+    0x802f, 0x239a, 0xce7f, 0x9301, 0x4206, 0xc6b7, 0xb4f3, 0x2a9e, 0x5b04, 0xdb63, 0x2292, 0x93bf, 0xc98f, 0xabab, 0x563c, 0x8ecf,
+    0x3c0c, 0x6b74, 0x4e0a, 0x9619, 0xe667, 0x8f95, 0xd253, 0xbdbd, 0xd9d9, 0x2258, 0x9409, 0x2936, 0x7138, 0xd0e1, 0x8401, 0xa007,
+    0x626a, 0xce93, 0x6ce2, 0x2176, 0x8c65, 0x44b8, 0x4d90, 0xba5b, 0xa139, 0x8953, 0xaac3, 0x22b4, 0xce53, 0xda73, 0x6b36, 0x20aa,
+    0x5052, 0x8d45, 0xd85b, 0x84a5, 0x26c4, 0x579c, 0xbdf1, 0xda7d, 0x654e, 0x2e6e, 0x724e, 0xcd85, 0x268c, 0xaaab, 0x8f95, 0x9bab,
+    0xbf2d, 0x70e0, 0xae19, 0x4a9a, 0x3956, 0x9c5b, 0x6716, 0xc593, 0x62fa, 0xd4cb, 0x88fd, 0x63ae, 0x45e4, 0xcf95, 0x1fb2, 0xbc3b,
+    0x3f2c, 0x6bc0, 0x2bde, 0x66be, 0xbb17, 0x7ed0, 0x5db2, 0x4c08, 0xc4dd, 0x6492, 0xdf51, 0x56fc, 0x7314, 0xc0fb, 0x82b1, 0xaf8d,
+    0x4c1e, 0xe5c1, 0x3bfe, 0xa96d, 0x5782, 0x25da, 0x8493, 0xc2c7, 0x5660, 0xcfe5, 0x2b1c, 0xe3dd, 0x8239, 0x9313, 0x2d22, 0x4e7a,
+    0x8b93, 0x93a9, 0x4eac, 0xd3dd, 0x87ab, 0x5714, 0x4bc8, 0x727c, 0xcf6b, 0x32e8, 0x6f2e, 0xdfcb, 0xac61, 0x43ee, 0x902f, 0x68ae,
+    0xd7bf, 0x6e86, 0x36cc, 0x601c, 0xd19f, 0x1da2, 0xa4f3, 0x3732, 0x207e, 0x9e5f, 0x4da2, 0xc1a7, 0x54f0, 0x731e, 0x1f4c, 0x4396,
+    0x86bf, 0xe179, 0x20f0, 0xd45b, 0xb011, 0xccf3, 0x9e39, 0xe595, 0x74a6, 0x928b, 0x5a78, 0x63a4, 0x309c, 0x6dc0, 0x9947, 0x1e7c,
+    0x7cb0, 0xd8d5, 0x3d28, 0x894b, 0xe55d, 0xcdb1, 0x76d8, 0x4978, 0xe78b, 0x1cc8, 0xa8db, 0x4648, 0x944b, 0xbe7d, 0x254c, 0x6752,
+    0x7cb8, 0xd4d1, 0xb561, 0x4bdc, 0x648a, 0xa103, 0xe60b, 0x4e04, 0x6e3a, 0x9a5d, 0xe705, 0xc845, 0x711a, 0xd715, 0x1d86, 0x7f32,
+    0x8ae9, 0x7624, 0x1e66, 0x47c6, 0xc635, 0x7e64, 0xa3dd, 0xd00d, 0x2f32, 0xb613, 0x528a, 0x67f2, 0x10aa, 0xc1af, 0x723c, 0x3692,
+    0xa6e7, 0x4912, 0x9221, 0x2a66, 0xd6e9, 0x4990, 0x1af6, 0x7764, 0xa1df, 0x4cb4, 0xb4b5, 0x3c24, 0x644c, 0xb7f9, 0x2e9c, 0x8e7d,
+    0x4328, 0x774c, 0x97c7, 0x6b32, 0x9089, 0xd3b5, 0x5b60, 0xcd8b, 0xaf63, 0x603c, 0x92e5, 0xe407, 0x7f52, 0xc8e9, 0x2478, 0xdb23,
+    0x6784, 0x44dc, 0x2da0, 0xbb95, 0xaabb, 0xde49, 0xc4d9, 0x74f4, 0xa57d, 0x46aa, 0xbc7b, 0x84b3, 0xd59b, 0x2d10, 0x8827, 0x6e4e,
+    0xd655, 0x5518, 0x75de, 0x5c0e, 0x245e, 0x8617, 0xa09f, 0x777a, 0xbced, 0x47b8, 0xa177, 0xbdf9, 0x3920, 0x6604, 0x2bc2, 0xe309,
+    0xa54f, 0xd2d5, 0x8009, 0x633a, 0xb875, 0x283c, 0x51f0, 0x32a2, 0x6bb8, 0x79a4, 0xd29d, 0xb4b9, 0x3f52, 0x22b6, 0xaed7, 0x950f,
+    0x4e76, 0xbb39, 0x307e, 0x5836, 0xdc03, 0xc171, 0x75e6, 0x661e, 0x393a, 0xd29b, 0x46ec, 0x7088, 0x5c50, 0x89db, 0x335c, 0x8065,
+    0xb9d1, 0x61f0, 0x9e09, 0xb983, 0xabe7, 0x7a92, 0x98d7, 0x4a24, 0x86e5, 0xaed5, 0x5516, 0xa195, 0x3d96, 0xdd51, 0x7a6e, 0x4f4c,
+    0x2746, 0x8dc3, 0xce57, 0x85cb, 0xd153, 0x597c, 0x1ddc, 0xdbe7, 0xac0b, 0x4a6c, 0x220a, 0xe1e3, 0xa627, 0x932b, 0xacf7, 0x4ba2,
+    0x8405, 0x99af, 0xe1c1, 0xc7bb, 0x3864, 0xd709, 0x8c73, 0xac81, 0xd1bb, 0x3c2e, 0x8db7, 0xae65, 0x4510, 0x25f2, 0x692a, 0xc36d,
+    0x1dc8, 0x9d3d, 0x6606, 0x2664, 0x956f, 0xbcb1, 0x7554, 0xa7bb, 0x38f2, 0x7ce0, 0x3dcc, 0x6924, 0x4e68, 0xba0f, 0xa8d5, 0x43b0,
+    0xcccb, 0xe577, 0x61f8, 0x2016, 0x66ce, 0x2e58, 0xb9cd, 0x2ab0, 0xa323, 0x817b, 0x5184, 0x21b4, 0xc60f, 0xb799, 0xd189, 0x3c58,
+    0xa8c9, 0x1904, 0xba17, 0x7f16, 0x8b99, 0x50bc, 0x9ca5, 0xc349, 0x8817, 0xd673, 0x6d4e, 0x1d7a, 0xbee1, 0x9dc5, 0xd7c3, 0xb493,
+    0x6e8c, 0x3c1c, 0xb553, 0x68fc, 0x48c0, 0x2eac, 0x83b3, 0x5e94, 0x1dce, 0x44e8, 0xaccd, 0xe19d, 0x891b, 0x3d1c, 0xe2e5, 0x5af8,
+    0x698a, 0xc46b, 0x49d2, 0x1554, 0x6e7c, 0xa2d9, 0x8679, 0x1f46, 0x945b, 0x6846, 0x51d6, 0xcb9b, 0x62fc, 0x817f, 0x465c, 0xccaf,
+    0x9a91, 0x459e, 0x5482, 0x7f02, 0x19ae, 0xbc6f, 0x7de0, 0x209a, 0x84f7, 0x3306, 0x6604, 0xaa57, 0x39c8, 0x4bd2, 0xa377, 0xbbed,
+    0x4a80, 0xb191, 0xd0a5, 0x6466, 0x8c7b, 0x2888, 0x57de, 0xb1a1, 0x47a2, 0xa1a3, 0x7c52, 0xd2b9, 0x2cae, 0xde79, 0x4e7a, 0x5dee,
+    0x297e, 0xe46f, 0x6f02, 0x4c1e, 0xbb2f, 0x9dc7, 0x3c6c, 0xca4d, 0xeb07, 0x5bba, 0xc325, 0x19f2, 0x9387, 0x7824, 0x55f2, 0x9fef,
+    0x29b2, 0xbd0b, 0x40e6, 0xcb41, 0x45be, 0x7094, 0x3142, 0x7930, 0xdd17, 0x298e, 0x6e98, 0x1bf6, 0x3c96, 0x6b56, 0x5068, 0xaf0f,
+    0x8091, 0x9ca5, 0xcddd, 0x7d98, 0x3438, 0x250e, 0x626c, 0x3dc6, 0xd5d9, 0x2d92, 0x6ee2, 0x939b, 0x21a4, 0xa633, 0x7c6a, 0xc447,
+    0x3c88, 0xbe8d, 0xb0c9, 0xa7bd, 0xe611, 0x68bc, 0x3748, 0x937d, 0xda09, 0x6fd4, 0x8039, 0x5248, 0x7658, 0xd915, 0xb13b, 0x1c00,
+    0x505e, 0xbb4f, 0x22e2, 0x3a5e, 0xa8af, 0xc203, 0x4df6, 0x8641, 0xa185, 0x3e2c, 0xe581, 0x69f6, 0x8985, 0x9959, 0x3aac, 0xdeb3,
+    0x1b70, 0xd47d, 0x85f1, 0xb1b9, 0x6d42, 0x91a7, 0x318e, 0xce87, 0x876f, 0x1a52, 0x953b, 0xc68d, 0x29ba, 0xba15, 0xa7d3, 0xe2f5,
+    0x4924, 0x6d94, 0x2c62, 0x392c, 0xe3d3, 0x21cc, 0xcaa3, 0x6d1a, 0xacc5, 0x2480, 0xe023, 0x859b, 0x61da, 0x2186, 0xae21, 0x319e,
+    0xd169, 0x41dc, 0x5f10, 0x1694, 0x7888, 0xbce5, 0x8db5, 0x2fe6, 0x76c2, 0x357e, 0x9229, 0xc295, 0x31f0, 0x6b2c, 0xe8c5, 0x26c0,
+    0xb713, 0x5a5e, 0x154a, 0x744e, 0x4f8e, 0xaf5b, 0x22a8, 0x7036, 0x1c04, 0x7760, 0xa783, 0x2c6e, 0x9961, 0xed87, 0x8fdb, 0x34ee,
+    0xa595, 0xdbad, 0x7904, 0x4f0e, 0xccf3, 0xe5d5, 0x4838, 0x5ce6, 0xdbad, 0xb255, 0x9691, 0xcd0f, 0x365c, 0x7360, 0xde01, 0x1bb4,
+    0x7838, 0x3c7a, 0xae6d, 0x3ec2, 0xa0d5, 0xa9bb, 0x9937, 0xe33d, 0x3eac, 0xbbbd, 0x926b, 0x60e6, 0x36da, 0x7aa0, 0x2f88, 0x5aba,
+    0xbeb1, 0x7f74, 0x5020, 0xe31f, 0x3490, 0xc581, 0x6b2e, 0xd849, 0x5e56, 0xb77f, 0x8f85, 0x62fa, 0xe7a9, 0x3d1c, 0x62fe, 0x2df6,
+    0xacd1, 0x5130, 0x9c31, 0xc3dd, 0x72f0, 0xda39, 0x4150, 0xa37b, 0xbc9d, 0x8021, 0x2714, 0xa423, 0xc2ff, 0x5f78, 0xb2cb, 0xcd27,
+    0x37e4, 0x8ec9, 0xbb03, 0xda85, 0x5fe6, 0x305a, 0xbff3, 0x432c, 0xcf6d, 0xa83b, 0x78f6, 0x2f06, 0xe067, 0x93e3, 0xba39, 0xa7cd,
+    0x204c, 0xe41f, 0x6f8e, 0xb6a1, 0xcdab, 0x959b, 0x4544, 0xc63b, 0xc073, 0xd3f1, 0x7af2, 0x20e6, 0xcb4f, 0x60a6, 0x781e, 0x337a,
+    0xd665, 0x5e92, 0x9adf, 0x3aae, 0xb251, 0x4380, 0xd8e5, 0x7752, 0x92fb, 0xe71b, 0x42d6, 0xac97, 0x5b56, 0xa78f, 0x8251, 0xc989,
+    0xbbbf, 0xa693, 0x79de, 0x307a, 0x8619, 0xdc69, 0x5f68, 0x8ce1, 0x313c, 0x6430, 0xd75d, 0x8319, 0x2abe, 0xd90f, 0xc847, 0x84a5,
+    0xe3ad, 0x6f9e, 0x908d, 0xacc7, 0x156c, 0xba33, 0x8593, 0x20d4, 0xa2ab, 0x42ea, 0xc41d, 0xb50f, 0xd97d, 0x9d4f, 0x2fde, 0xb82b,
+    0x39d6, 0xde0d, 0x4b16, 0x69da, 0x8a25, 0x9e43, 0xaf83, 0x8479, 0xeadb, 0x936d, 0xa36d, 0x55f2, 0xcc4f, 0xbf3d, 0x466e, 0x1f64,
+    0x9c39, 0x83d7, 0x1380, 0x4658, 0xc59f, 0x575e, 0xcea3, 0x4998, 0x17fc, 0xaac3, 0x30a4, 0xe3dd, 0x9733, 0x40a0, 0x82c1, 0xc285,
+    0x6864, 0x9101, 0xd0b7, 0x3436, 0x7a34, 0x6c6c, 0x9a47, 0xdec5, 0xb367, 0x5a24, 0x2bba, 0x514e, 0xd991, 0xc0dd, 0x4700, 0x6e7e,
+    0x7882, 0x98cd, 0x4788, 0xe57d, 0x1e68, 0x397a, 0xc1f1, 0x5134, 0x6fa2, 0x5486, 0xaf97, 0xe4fd, 0x473c, 0x9c7b, 0x509e, 0x1970,
+    0xcc05, 0xb53f, 0xd991, 0x48d6, 0x6ab6, 0x4e9e, 0x9a3b, 0x3e88, 0xda4d, 0x3110, 0x59b6, 0x97fd, 0xc991, 0xd223, 0x857b, 0x5fec,
+    0xaf67, 0xc14d, 0x7c10, 0xad37, 0xe0ad, 0x5126, 0xa203, 0x8673, 0xcd99, 0x508e, 0x73fc, 0xd03b, 0x52f0, 0x3dae, 0x7cf2, 0x6284,
+    0xdbf9, 0xcc95, 0x43aa, 0x8c27, 0xa2cd, 0x636a, 0x3d1e, 0xe6ef, 0x945d, 0x4a4e, 0xc16d, 0x6032, 0x77bc, 0xd229, 0x454e, 0x6020,
+    0x7f74, 0x5b40, 0x408a, 0xaea7, 0x1a82, 0x6334, 0x9b65, 0x2edc, 0x859f, 0x183e, 0x5b26, 0xa31f, 0x2e0e, 0x7b8e, 0xd7a1, 0x584a,
+    0x9ff7, 0xbb2f, 0x9219, 0xd2b3, 0xe0c1, 0x4548, 0x7c6a, 0x6a84, 0x49be, 0xd69f, 0x480e, 0xc9ab, 0xa441, 0x7512, 0xe64d, 0x9e15,
+    0xd071, 0x416c, 0x5906, 0xa0af, 0xace9, 0x43c8, 0x6e3e, 0x187a, 0x46cc, 0x35b2, 0x2ba8, 0xacaf, 0x89e7, 0x4cf8, 0x7f70, 0xc895,
+    0xdba3, 0x4b64, 0x85f9, 0x32aa, 0x1d26, 0xb169, 0x68b8, 0x5186, 0xd81f, 0xea57, 0x6aa4, 0x458e, 0xc8e7, 0x1c4e, 0x748e, 0x4f28,
+    0x9bf7, 0x238a, 0x73c6, 0xa215, 0xa55d, 0x5332, 0xe5ad, 0xb115, 0x5fc0, 0x3724, 0xc1b9, 0x9a6f, 0x6776, 0x30a0, 0x740a, 0x355a,
+    0x5c04, 0x918f, 0x2f74, 0x9d4f, 0x3dec, 0x5914, 0x711e, 0x3066, 0x9d1d, 0x3d78, 0x50da, 0x9325, 0x8cc1, 0xb973, 0xa09d, 0x64f2,
+    0xc859, 0x8531, 0x1d78, 0xdff9, 0x78f8, 0xc847, 0xa741, 0x1858, 0x5f26, 0x3394, 0xc2b1, 0x70f2, 0x8cb3, 0x49ca, 0x8ed9, 0x2126,
+    0x842d, 0x4026, 0xd0f5, 0xc34d, 0xa9ad, 0x198c, 0x6b02, 0xc0a1, 0x9195, 0x3816, 0x78ee, 0xa853, 0x4810, 0x6608, 0x3a08, 0x1c8c,
+    0xb79f, 0x5c70, 0x2a80, 0x82bd, 0x53a4, 0xeb81, 0x9903, 0x5f70, 0xcf99, 0x57e4, 0x90e7, 0x5e74, 0x8725, 0x52de, 0xc037, 0x9397,
+    0x708c, 0x1e12, 0xa9b7, 0xbf9b, 0x610e, 0xcbb3, 0x4f94, 0x1024, 0x5c28, 0xbdb1, 0x4638, 0x3232, 0x67c8, 0x8c7d, 0x3964, 0x611a,
+    0xea7b, 0x6bf6, 0x37b0, 0x95bb, 0x7b56, 0x29de, 0xaa33, 0x849b, 0x6282, 0xcb05, 0x5990, 0xc39b, 0x2258, 0x5bf6, 0x907b, 0x4700,
+    0x2846, 0x9c69, 0x65ac, 0xad03, 0xe99d, 0x2c28, 0xce5d, 0x18c4, 0x43e0, 0xb7c3, 0x9623, 0xa9fd, 0x7682, 0x1faa, 0x57fc, 0xace9,
+    0xc14f, 0x2e7e, 0x5f94, 0x568e, 0x9f21, 0x8723, 0xb2f1, 0xa09f, 0xe84f, 0xbde1, 0x83ad, 0x640e, 0x3982, 0xd101, 0x7d20, 0x675a,
+    0x8913, 0x57f8, 0x9b6f, 0x7600, 0xc0a5, 0x8ddb, 0x2c66, 0x59f8, 0xcba1, 0x8f7d, 0x6c90, 0x49e6, 0xa39b, 0x3914, 0x4d74, 0x9237,
+    0xdff1, 0x468a, 0x255a, 0x8c05, 0x3752, 0x554c, 0x3a9c, 0xb845, 0xea2d, 0x255e, 0xaed3, 0x872f, 0x159a, 0xc227, 0x98d5, 0x9c4b,
+    0x37de, 0x827b, 0xa7e7, 0x30a0, 0xdeef, 0x8619, 0xb71d, 0xcd23, 0x6a24, 0x3248, 0xe44d, 0xc8f9, 0x179c, 0x53d2, 0xb73b, 0xde91,
+    0x2492, 0xbf4d, 0xd279, 0xa483, 0x89cd, 0x311e, 0x7d0c, 0xd1bb, 0xbf13, 0x680a, 0xebb3, 0xcecf, 0xb38f, 0x25cc, 0x92d1, 0x40b4,
+    0x6930, 0x217a, 0x4a8a, 0x74fc, 0x5f7e, 0x1bfc, 0xc773, 0xb053, 0x15ac, 0x8dcb, 0x7346, 0x2740, 0xbf17, 0x46f6, 0x51c0, 0x1dfa,
+    0x6f66, 0x8e7b, 0xdb95, 0x1f5e, 0x66ac, 0xbdc7, 0x9499, 0x7f30, 0xe48f, 0xa397, 0x7a38, 0xd2f3, 0x2674, 0xb985, 0x9d73, 0x1c56,
+    0x2a8a, 0xb4bd, 0x8031, 0xcf69, 0x9d43, 0x8b1f, 0xc193, 0x3160, 0x937f, 0x3320, 0x5d7a, 0x8b5d, 0x533a, 0x9721, 0x2cde, 0xb3ef,
+    0xe48b, 0x613e, 0x42e0, 0xc37f, 0x25dc, 0x79e2, 0x67d4, 0x26a8, 0x96bf, 0x83fb, 0xdbf9, 0x1d18, 0x4698, 0xb22b, 0xdab1, 0x54c8,
+    0xc6ab, 0xd945, 0x76b0, 0x278c, 0xd237, 0x5754, 0xe1ab, 0xa667, 0x6d2a, 0x58cc, 0xdfc9, 0xc9b7, 0x2942, 0x44c6, 0xe8fb, 0x2320,
+    0x3c20, 0xa851, 0x4f16, 0x7a88, 0x970d, 0x577c, 0x2434, 0x7f58, 0xbc8d, 0x4ca6, 0x8485, 0x2276, 0xe02f, 0xbd9d, 0x3b9e, 0xd497,
+    0x5ef6, 0x4a66, 0x28b8, 0x658a, 0x8d11, 0x3720, 0x559a, 0xceeb, 0x26c8, 0xa8fd, 0x552c, 0xc013, 0xe64f, 0x9951, 0xb143, 0x8b3d,
+    0x51ce, 0xcb0b, 0x7a6a, 0xde49, 0xc0d5, 0x6da6, 0x3b02, 0xb1b1, 0x8603, 0xdddf, 0x36fe, 0x2174, 0x7aba, 0xe0e3, 0x4038, 0x5cea,
+    0xd973, 0x52fa, 0x857b, 0x279c, 0xd353, 0x3812, 0xb783, 0x6c5c, 0x73f4, 0x2f1a, 0xb301, 0xd633, 0x7e00, 0xe121, 0x9a63, 0xc503,
+    0xb351, 0x544e, 0xca7b, 0xe607, 0xb661, 0x8a15, 0x4730, 0xe6fb, 0x9c8b, 0x3d3a, 0x8519, 0x75de, 0x9ead, 0xd807, 0xbee9, 0xaf87,
+    0x764a, 0xe41f, 0xbdc7, 0x4d48, 0x834b, 0x3e1e, 0x9dc5, 0x6256, 0x7366, 0x2c68, 0xcb41, 0x7090, 0x2f88, 0xdbef, 0x8ddf, 0xcde1,
+    0x4096, 0x9201, 0xb5f5, 0xcd7b, 0x7678, 0xdae9, 0x29ea, 0x5a76, 0x4028, 0x1ef4, 0x2d7e, 0x7224, 0x8d45, 0x2700, 0xac35, 0xbfc9,
+    0x398e, 0x24fc, 0xc221, 0x1d5c, 0xae15, 0xe5e7, 0xd1ff, 0x7c38, 0xa793, 0xb7a1, 0x1d7e, 0xc4f5, 0x2e70, 0x6c98, 0xb89d, 0x2052,
+    0x744e, 0x54ec, 0xa149, 0xbc9b, 0xd13d, 0x6e6e, 0x1f0e, 0x96b5, 0x6a1e, 0x3f68, 0xdaa9, 0xa161, 0x4c36, 0xdfd5, 0xb0a7, 0x2b98,
+    0x4a00, 0x6dc4, 0xc181, 0x5a5e, 0xcc37, 0x1ce8, 0x414a, 0x559c, 0xa731, 0x8739, 0x6f94, 0x426e, 0xa86f, 0x8669, 0x6c2c, 0xa615,
+    0x46f8, 0x8fb9, 0x2efe, 0x6f7a, 0xe431, 0x5a12, 0xab19, 0x98d3, 0x4892, 0x1fbe, 0x75b4, 0x4512, 0x8787, 0x6526, 0xae63, 0xc5ab,
+    0xed89, 0xa877, 0x329e, 0x92f3, 0xba59, 0x8779, 0x377a, 0x5690, 0x9c2f, 0xe5d3, 0xae15, 0x5944, 0xe173, 0x8c8b, 0xb4eb, 0x80a3,
+    0xc4d1, 0x2faa, 0xb17b, 0x7434, 0x358a, 0xccdf, 0x478a, 0x2430, 0xb7a9, 0xc3bb, 0x5156, 0x6ce0, 0x4486, 0xdadb, 0x6130, 0x8eef,
+    0x672c, 0xe711, 0x62dc, 0x4134, 0x551e, 0xe2cb, 0x8ed9, 0x14e4, 0x7656, 0xb2a3, 0xc621, 0x8601, 0x3c32, 0xe681, 0x7026, 0x8c5f,
+    0xc72f, 0x5686, 0x82a1, 0x3732, 0xd247, 0x915b, 0x4f4a, 0xd56b, 0x7256, 0x5194, 0x4708, 0xc295, 0x8d99, 0xd033, 0x2e1a, 0x8f39,
+    0x7f6e, 0x4db4, 0xba2f, 0x944f, 0x6e9c, 0xc501, 0x8d11, 0x1bb6, 0xbaeb, 0x7644, 0x29f6, 0xae01, 0x6c6e, 0x53e2, 0xb121, 0x70e4,
+    0x9003, 0x6b42, 0xd629, 0x3022, 0xbf2d, 0x466a, 0x8f0d, 0xe471, 0xd51f, 0x43f6, 0xa283, 0xb3dd, 0x28ae, 0x548c, 0x6ab2, 0xb0cd,
+    0x7c10, 0xdf17, 0xa0fd, 0xcb35, 0x4dda, 0xe027, 0xb763, 0x7f3a, 0x43d6, 0xdf91, 0x8c45, 0x1ddc, 0x31f8, 0x5c60, 0x77c6, 0xd8b1,
+    0xa6f3, 0x3570, 0x9b1d, 0x4336, 0x1e56, 0xa1d9, 0x2fac, 0xc00d, 0x1ace, 0x6d7c, 0xa875, 0xbec7, 0xab5f, 0x1f00, 0x93c5, 0x68a4,
+    0xb863, 0xcb19, 0xa245, 0x5d34, 0x3f16, 0x7cc8, 0xa869, 0xdf5d, 0x9cd9, 0xc93f, 0x86e7, 0x1dbe, 0x95d9, 0x319e, 0x5546, 0x2182,
+    0x7caa, 0x887b, 0x3220, 0x5904, 0x1ae6, 0x6948, 0xb793, 0x2930, 0x757c, 0xba1b, 0x43ae, 0xaac3, 0x2cf4, 0x4c50, 0x356a, 0xca41,
+    0x577c, 0x373c, 0x1acc, 0x63e6, 0x8ee3, 0xca09, 0x5586, 0xbfa1, 0x950b, 0xdb2f, 0x54f0, 0xa239, 0x3c1e, 0x9d05, 0xb6e1, 0x2466,
+    0x523c, 0xd9ed, 0x1e1e, 0x8943, 0x2c0c, 0x5acc, 0x7978, 0x8ee7, 0xd099, 0xa29d, 0xb4db, 0xd20d, 0xde85, 0x5dc8, 0xb5d9, 0x4b14,
+    0xe0c1, 0xa0a1, 0x6aba, 0x81cf, 0x3f40, 0x345a, 0x6e0e, 0x207c, 0x394a, 0x52e4, 0xda5f, 0x68de, 0x90bf, 0xe6fb, 0x8e51, 0xa92b,
+    0xcc37, 0x3900, 0xe6f9, 0x5444, 0x8693, 0xc983, 0xd733, 0x7bba, 0xb929, 0x32dc, 0x91d1, 0x7470, 0x2eec, 0x67d8, 0x4876, 0xcf1f,
+    0x9add, 0x22b2, 0xdd4b, 0x3c2c, 0x6b22, 0x9b89, 0x7b50, 0x2a76, 0xd5b1, 0x2410, 0x4c7a, 0x9881, 0x824d, 0x3466, 0x27b8, 0xc9a3,
+    0x74fa, 0xab3d, 0x609a, 0x7f16, 0x46b2, 0xbd9f, 0x23b6, 0xd98d, 0x3ed8, 0x9c4d, 0xae55, 0x312a, 0x5514, 0xdf05, 0x182e, 0x4b58,
+    0x85b1, 0x7e58, 0xd92d, 0x49e2, 0x2a32, 0xe33d, 0xa2c9, 0x770e, 0xbff1, 0x30c0, 0x6242, 0x3406, 0x942f, 0x1d86, 0x6176, 0x3aaa,
+    0xa3f3, 0x4cc0, 0xd96b, 0x6022, 0x89b3, 0xe90d, 0xa6a9, 0x6e40, 0xd1c5, 0x61e4, 0x1b84, 0x98cf, 0xc92d, 0x39da, 0x7190, 0xc981,
+    0x3306, 0x19e8, 0xa627, 0xbb83, 0x20ea, 0x46d2, 0x6620, 0xd0db, 0xa2cb, 0x4fdc, 0x1ee4, 0xab35, 0xd7d7, 0xbc65, 0x5b34, 0x3a4a,
+    0x1802, 0x9fef, 0xee75, 0x5d8a, 0xbb55, 0x4102, 0xbc13, 0xaf3f, 0x3182, 0x9145, 0xb115, 0x695a, 0x72a2, 0x5eaa, 0x990f, 0x6c64,
+    0x18ea, 0x9e61, 0x5db8, 0x3f96, 0x7e6a, 0xaf4b, 0x2ec4, 0x422e, 0x9e63, 0x8b17, 0xd167, 0x3dc2, 0x9e83, 0x8587, 0xdedd, 0x205e,
+    0xba39, 0xcc5d, 0x4a7c, 0x95c3, 0xd9c5, 0x658a, 0xafcf, 0x3c7c, 0x95c7, 0x6e78, 0x5d6e, 0xd65d, 0x76fe, 0x9c45, 0xc62b, 0x363e,
+    0x8569, 0x21c4, 0xadc7, 0x8549, 0x6b20, 0x28ea, 0x9fd7, 0x6398, 0x82ff, 0xcf41, 0x6124, 0x6e58, 0xa1b5, 0xcc4b, 0x120c, 0x520a,
+    0x6c1c, 0x2524, 0xb1e1, 0x85b3, 0x58d2, 0xd6a3, 0x7b06, 0x539e, 0x84e9, 0x44ca, 0xd705, 0x6796, 0x55e4, 0xcd19, 0x8391, 0x2880,
+    0x4218, 0x31f0, 0x7bda, 0xb23f, 0x7352, 0x91fd, 0x46b8, 0x1f88, 0x32cc, 0x520e, 0xae17, 0x5802, 0x4d74, 0xb51d, 0xd343, 0x424c,
+    0xb90f, 0xa843, 0xd2bb, 0x4d16, 0x81c1, 0xcd21, 0x569e, 0x9a5d, 0x62e4, 0xdc95, 0x1ac2, 0x80fd, 0xe42d, 0x8845, 0x657a, 0x2084,
+    0x8b75, 0x81c1, 0xd6ab, 0xb785, 0x26c8, 0xa8e5, 0x2c1e, 0x754e, 0xaec5, 0x3dc2, 0x7f2c, 0xc375, 0x6878, 0xac6b, 0x4b48, 0x6e88,
+    0x7aa2, 0xa5d3, 0x5e54, 0xbea1, 0x42e8, 0xd881, 0xb3b7, 0x1950, 0x66b0, 0x4a60, 0x7832, 0x512c, 0x1a62, 0x98bf, 0x6fcc, 0x2a5c,
+    0x7f5c, 0x5346, 0xb3af, 0xd663, 0x5b46, 0xa69f, 0x94cf, 0xb76b, 0x687c, 0x7dc4, 0xa61b, 0xad09, 0x76e0, 0x597c, 0x3e3c, 0x2280,
+    0x9e9d, 0x771a, 0x6ce8, 0x1500, 0x3e04, 0x8f7b, 0x2d02, 0x5040, 0x9e43, 0x60b2, 0xc1f9, 0x29a6, 0xe1ff, 0xb8b9, 0x72e0, 0x8751,
+    0xc761, 0x604c, 0x9491, 0xb043, 0x4e7e, 0xed43, 0xc4e3, 0xabf5, 0x7bb0, 0xd133, 0xb3ab, 0x6690, 0xc19b, 0xd6c3, 0x9c7f, 0xe57f,
+    0x399c, 0x1bea, 0xd993, 0xcd73, 0x2486, 0xa3b9, 0x71a8, 0x624e, 0x7d76, 0xc63b, 0xe021, 0x92d9, 0x8239, 0xd279, 0x7372, 0x915f,
+    0x3a76, 0x5acc, 0xce83, 0x9c2f, 0x680e, 0xadef, 0x514c, 0xcead, 0x3fd0, 0x7f42, 0x4d42, 0xc9cb, 0x7f02, 0xabe9, 0xd427, 0xe741,
+    0x7420, 0x42c4, 0xb96f, 0x25e2, 0x934f, 0x56b8, 0x5358, 0x31c0, 0x89d1, 0x3bd4, 0xe4e9, 0x8781, 0xaa59, 0x8525, 0x4ffa, 0xb047,
+    0x9ba5, 0x86f9, 0xcf7f, 0x7338, 0x95c3, 0xad53, 0xb727, 0x3e92, 0x721c, 0xd9eb, 0x4092, 0x7a20, 0x6322, 0x25b6, 0x8e5b, 0xc183,
+    0x7548, 0x3280, 0xb23d, 0x6f8a, 0x9ca7, 0x7794, 0x1744, 0x6192, 0xcbed, 0xea05, 0x2458, 0x9499, 0x3968, 0xb353, 0x4630, 0xeacb,
+    0xb197, 0x32ba, 0xcf61, 0xdf53, 0x22dc, 0x796a, 0x5896, 0xe93f, 0xd1e3, 0x5d5e, 0x50ec, 0xc5a5, 0x61ee, 0x3eb6, 0xd14b, 0x4de8,
+    0x2fd6, 0x7026, 0x9e13, 0x1990, 0x8177, 0x3150, 0x7674, 0x5038, 0x1d7a, 0xd7cf, 0x2dbc, 0x8e6b, 0x3c94, 0x4b72, 0x811b, 0xcfc9,
+    0x4984, 0x613c, 0xbadb, 0x31ec, 0x5a9e, 0xd8ad, 0xc41d, 0x2ce4, 0x1964, 0xdfe9, 0x40fa, 0xb2ef, 0x890f, 0xe4b5, 0x3dc4, 0x9889,
+    0xca0f, 0xe449, 0x6634, 0x977b, 0xb95b, 0x753a, 0xa1f7, 0xe141, 0x6ac6, 0xb089, 0x9ae9, 0x2f56, 0x42f4, 0x8ffd, 0xc72f, 0xe137,
+    0xa9b7, 0x9623, 0xd247, 0x1df8, 0xe7c7, 0xca83, 0xb22f, 0xd093, 0x6724, 0x8d03, 0xecd5, 0x723c, 0xc323, 0x89ad, 0x9129, 0x63c8,
+    0x1db2, 0x6860, 0x3be8, 0xa6cf, 0x9cb9, 0xdd65, 0x724c, 0x3108, 0xcf87, 0x976b, 0x4d20, 0xc163, 0x6a24, 0x9939, 0xdc13, 0xa3b7,
+    0xc8cb, 0xa905, 0x5524, 0x9667, 0x7810, 0xe36d, 0x6142, 0xd0d5, 0x25b4, 0x9019, 0x59c0, 0x1d30, 0xcf73, 0x2d1e, 0x8fd5, 0xe4a5,
+    0x3d3e, 0xa8b3, 0x4dc8, 0x7af0, 0x90df, 0xa9b9, 0x50ca, 0xc58d, 0x891f, 0xd85f, 0x989d, 0xc2d3, 0x3cd8, 0x8447, 0xd011, 0x90ad,
+    0xd0ff, 0x966b, 0x3b4a, 0x24f0, 0x69f0, 0xcb65, 0x4dae, 0xeddb, 0xd4ed, 0x3108, 0xbda9, 0x37e2, 0x2370, 0xc68b, 0xb345, 0x69e0,
+    0xdb6b, 0x4e48, 0xc0ad, 0xaec5, 0xa779, 0x5f94, 0x79fe, 0xe2b7, 0x2490, 0xccc5, 0x74d4, 0xa485, 0x983d, 0x3d3a, 0x5434, 0x2026,
+    0xe0a5, 0x42ce, 0xa6e3, 0x756c, 0x280c, 0x8bbd, 0x330a, 0x5dde, 0x41e6, 0x90e1, 0x3470, 0xe265, 0x1f58, 0x437e, 0x644a, 0x557a,
+    0x8421, 0xa38b, 0x554e, 0xb45f, 0x354a, 0x96cd, 0xd99d, 0xb415, 0x2f3e, 0x5240, 0x6a3e, 0x24b8, 0xb4ef, 0x42b4, 0xa2b7, 0x2f26,
+    0xc685, 0x22b8, 0xb2ab, 0x42ae, 0x79b6, 0x1f66, 0x5dec, 0x7bdc, 0x232e, 0xb759, 0xa6a7, 0xd8f9, 0x582a, 0x3b06, 0x29c4, 0x9f57,
+    0x57aa, 0x9425, 0x8285, 0xc913, 0x469c, 0xbc29, 0x1b2e, 0xd541, 0x9829, 0x4952, 0xb7d5, 0x2ffe, 0x5970, 0x22ac, 0xdf49, 0x57f4,
+    0xe077, 0x7d80, 0x49a8, 0x3592, 0xd6b5, 0x806f, 0x25bc, 0x8569, 0xc5cf, 0x6012, 0x9519, 0xc52f, 0x338a, 0x9b65, 0x53e2, 0xe27f,
+    0x6d82, 0xcd0b, 0x9419, 0x439a, 0x296e, 0xe251, 0x867f, 0x9f57, 0x3b7e, 0x7c1c, 0x4872, 0xaee5, 0xd60b, 0x2378, 0x7c7e, 0xcd85,
+    0x6208, 0x71da, 0x912f, 0x4d20, 0x9c9f, 0xcc39, 0xb747, 0x7016, 0x3a3c, 0x2384, 0xa95f, 0x8f1f, 0x1ab0, 0x787c, 0x9bc1, 0xb08b,
+    0x8b3b, 0x5c06, 0x7d8e, 0xb4c5, 0x5608, 0xe5c7, 0xd4c7, 0xa8d9, 0x7c88, 0xc979, 0xad11, 0x68f6, 0xe909, 0xba0d, 0x160a, 0xa579,
+    0xd92b, 0x5a7c, 0xc3fd, 0x2bbc, 0xa1b7, 0x8e5d, 0x522e, 0x754c, 0xa5a9, 0x5ba8, 0x97e7, 0x28b6, 0x4e1a, 0xacab, 0x2f9a, 0x84d7,
+    0x7d14, 0x3c8c, 0x43b0, 0xc9af, 0x2e76, 0x32d0, 0xa727, 0x25f6, 0xc349, 0x2a82, 0x819b, 0xe2fd, 0xa0e7, 0x6f26, 0x3dbc, 0x1e82,
+    0x60f6, 0x85f7, 0x4f24, 0x313c, 0x590a, 0x278c, 0x507a, 0x7520, 0xbc61, 0x2dbc, 0x9d27, 0x1fee, 0x3d02, 0xd701, 0x37a0, 0xb003,
+    0xe463, 0x5ba2, 0xc361, 0x7652, 0x40f4, 0x2582, 0xaac9, 0x3e84, 0x8131, 0x66c4, 0xa73f, 0x34a2, 0xae0d, 0x3502, 0x4a30, 0x6b62,
+    0x2b22, 0x4146, 0x5d1e, 0x355a, 0xb461, 0x4e3e, 0x7e58, 0x42b4, 0xa80d, 0x6cac, 0xe64f, 0xa32b, 0x78c2, 0x4e02, 0xc9d5, 0x6d6c,
+    0xb993, 0x2ec2, 0xe03f, 0xcb7d, 0x21d2, 0x6200, 0x3046, 0xe669, 0x3cb8, 0x54fe, 0x2e16, 0xa93d, 0x5e56, 0x399c, 0xeb8b, 0x525a,
+    0x1c7a, 0x74a6, 0xbf95, 0xe145, 0x80cb, 0x9ecd, 0x1134, 0x56cc, 0x8b3b, 0x1b66, 0x71a2, 0x485c, 0xd76d, 0x9e63, 0x3692, 0xcd81,
+    0x82d1, 0x3ab2, 0x8e57, 0x2780, 0xda57, 0xc9ad, 0x3c9e, 0xb03b, 0x8a2b, 0x3f0e, 0x8059, 0x578a, 0x45ce, 0xcc39, 0x90d1, 0xaa27,
+    0x3602, 0x520c, 0xc86d, 0x14d2, 0x91e1, 0xd92f, 0x52e2, 0x9e39, 0xc9e7, 0x82c9, 0x65aa, 0xa85d, 0x7948, 0x8ce5, 0xb853, 0x2346,
+    0xd307, 0x95b3, 0x63a0, 0x7e02, 0x86c5, 0x464e, 0x6608, 0x25e0, 0x8743, 0xcbcb, 0x6360, 0x188a, 0xc175, 0x6040, 0xdbbf, 0x67d2,
+    0xb551, 0x8d97, 0x57d0, 0xd257, 0x9359, 0xecbd, 0xc1b1, 0x988d, 0xd89f, 0x6768, 0x89cd, 0x1c3c, 0xbec1, 0x6e04, 0x8541, 0xc0bf,
+    0x1d92, 0xd8f7, 0x2e3e, 0x6674, 0xab1d, 0x7ffe, 0xb057, 0x85a9, 0x6e52, 0xa38f, 0x5852, 0xd613, 0x7dc6, 0xb3a9, 0xcc6b, 0x280a,
+    0x65ea, 0xb95d, 0x29ae, 0xa7f3, 0x6690, 0xdc2b, 0x5144, 0xa735, 0x31ae, 0x88bb, 0x1cf6, 0xeac9, 0x8357, 0x59dc, 0xc81b, 0xa109,
+    0x2fa8, 0x4520, 0xc2a1, 0x1d10, 0x60f6, 0xcd33, 0x51b0, 0x46b8, 0x94c5, 0x6860, 0xc5a9, 0x56ee, 0x6d9c, 0xa655, 0x8c8b, 0x5156,
+    0x2e4a, 0x9c8f, 0xda63, 0x6df6, 0x24da, 0x643c, 0x8b81, 0x1a66, 0x9cef, 0x801b, 0xbd2b, 0x5abc, 0xe3fd, 0xc183, 0x29da, 0x4594,
+    0xd909, 0xe097, 0x3bc6, 0xc97b, 0x676a, 0x4314, 0xa083, 0x24ae, 0x4bc2, 0x88f9, 0x431e, 0x2b06, 0xaa93, 0x8eed, 0x5370, 0x6fbe,
+    0x3eb8, 0x8c17, 0x825b, 0xe78f, 0x6efc, 0x3c56, 0xbbff, 0xd46d, 0x931d, 0x4ad6, 0xd3f1, 0x78e8, 0xc10b, 0x6c88, 0xd7df, 0x5ab4,
+    0xbd55, 0xa2b3, 0x1b1e, 0x81eb, 0xdca9, 0x6652, 0x47a4, 0x8431, 0x573c, 0x72a0, 0x5248, 0xc277, 0x25e2, 0x5f34, 0xba9d, 0xb055,
+    0x5632, 0xd237, 0xbdc3, 0xa28f, 0x7dd0, 0xa9bf, 0x8367, 0x34c8, 0xda0d, 0x7eb2, 0x46d2, 0xb79b, 0x877b, 0x6396, 0xa031, 0x545c,
+    0x98e5, 0x86e3, 0xd349, 0x24e0, 0xb693, 0x5a6c, 0x93c9, 0xdea3, 0x9b9b, 0x19da, 0xcbed, 0x8519, 0x76f4, 0x20fa, 0xbf13, 0x5d76,
+    0xb993, 0xe853, 0xd2d9, 0x84c3, 0x2490, 0x9caf, 0xd01b, 0x9631, 0xc2c3, 0x2596, 0x4a40, 0xb835, 0x8033, 0x3d4e, 0xa1dd, 0x1ec4,
+    0x951d, 0x8475, 0x5daa, 0x3c80, 0x7ec8, 0x9f5b, 0xbac1, 0x79ae, 0xa817, 0x20b0, 0xb6e9, 0xe629, 0x72ba, 0xb5df, 0xaecb, 0x283e,
+    0x6360, 0xa88d, 0x478c, 0x8cbd, 0x2c3c, 0xb61d, 0x38b6, 0x76f6, 0xb05f, 0xa2c5, 0xe383, 0x6b62, 0x879f, 0xa42d, 0x6edc, 0x5ae4,
+    0x293c, 0xa1ab, 0xe2d7, 0x5e8a, 0x73d8, 0x4da2, 0x8e01, 0x6910, 0xbc13, 0x3226, 0xb6a9, 0xda1d, 0x1c7a, 0xbb13, 0x81e1, 0xdcbb,
+    0x9a37, 0x756e, 0xd3a9, 0x4606, 0x6b18, 0xb97d, 0x6ecc, 0x2106, 0xdd0d, 0x262c, 0x500c, 0x3e8e, 0xcb45, 0x5430, 0x9f6b, 0x6de8,
+    0xc5f3, 0x3e46, 0x2450, 0xe74f, 0xd71f, 0x553e, 0xaf29, 0xdfed, 0x478a, 0xaa75, 0xea9b, 0x9c71, 0x4dde, 0x8793, 0x7f72, 0x53c0,
+    0xe51b, 0x7c30, 0x2e74, 0x6882, 0x4a1c, 0xa629, 0x370a, 0x2b3c, 0x564e, 0xa5ad, 0x6dae, 0x3752, 0xec85, 0xa621, 0x48f8, 0x7e98,
+    0xaab7, 0x5bf0, 0x9cd1, 0x3944, 0x9001, 0xe665, 0x2c30, 0x9eb5, 0xbc17, 0x238a, 0x7220, 0xcc25, 0x365e, 0x69ee, 0xa175, 0x3d62,
+    0x1558, 0xd115, 0x9a57, 0x43a8, 0x8883, 0x1d50, 0x663a, 0xcec9, 0x7d68, 0xbb7f, 0x5f92, 0xae25, 0x4864, 0x70a6, 0x1ed8, 0xa6f9,
+    0x604c, 0x8273, 0xe9d1, 0xa4ab, 0x9267, 0xb96b, 0x6f4c, 0xd807, 0xbbd7, 0x25a8, 0xd735, 0x85a9, 0x308e, 0xdee5, 0x49cc, 0xbd3d,
+    0x293c, 0xac85, 0x5764, 0xba93, 0x3d1c, 0xd0c1, 0x5366, 0xd8c5, 0xc7b5, 0x6de6, 0xdad3, 0x2ef8, 0x738e, 0xa503, 0x5e14, 0x64e4,
+    0x93df, 0x2a1e, 0x5b86, 0xac77, 0x23a6, 0x8917, 0xbfdb, 0x60d6, 0xe0cf, 0x72ac, 0xd44d, 0x5786, 0x745a, 0xcb37, 0x2d62, 0xc41d,
+    0xa7ed, 0x1f70, 0x4ba4, 0xd085, 0x9515, 0x1e1a, 0x8023, 0x5964, 0x29ec, 0xb231, 0x7090, 0x1ec2, 0x8aef, 0x39d0, 0x9e2d, 0x21fc,
+    0xca4f, 0x700e, 0xd3e7, 0x9ad7, 0x5bfa, 0xa141, 0xc5df, 0xde9f, 0x3714, 0xb87f, 0xac09, 0x3cf2, 0x8be1, 0xdf07, 0x8073, 0x9637,
+    0x2eaa, 0x6f24, 0x23da, 0xdba9, 0x6efe, 0xc741, 0x47de, 0x96ff, 0x5bcc, 0xc469, 0x6b78, 0xd6f7, 0x55ba, 0x1656, 0x7674, 0xcd7b,
+    0x278e, 0x379c, 0x640a, 0x8daf, 0xe873, 0x72d0, 0xc32d, 0x2ccc, 0x48f8, 0xaf69, 0x5e52, 0x4144, 0xd391, 0xac2f, 0xe6f1, 0x8103,
+    0x93d3, 0x17f2, 0x7892, 0x7128, 0xd823, 0x5b7e, 0x2a26, 0x7620, 0x54dc, 0x86bd, 0xce27, 0x38a2, 0x924b, 0xd9d9, 0x6944, 0xcb75,
+    0x42b2, 0x723c, 0xa8af, 0xb6c1, 0xe129, 0x59fe, 0x3d9c, 0x87bb, 0xa21d, 0x748c, 0x593a, 0x8867, 0x1b22, 0x7aa4, 0x5052, 0x9513,
+    0xc97d, 0xd641, 0x5b7e, 0xaf21, 0x5242, 0x687c, 0xdcab, 0xc783, 0x420a, 0x5f0c, 0x9279, 0xb445, 0x543a, 0x1b20, 0x41ec, 0x961b,
+    0xc2bf, 0xabfb, 0x5488, 0x32e8, 0x892b, 0xb4ff, 0x1bb8, 0x6a34, 0x56c0, 0xc43f, 0x7d3c, 0x644a, 0x9a07, 0x31c0, 0x6476, 0x4988,
+    0x25dc, 0xb755, 0x87d5, 0xa989, 0xde4f, 0x42de, 0x7e2e, 0xcb19, 0x4fd6, 0x9787, 0xc0df, 0xdb3b, 0x8b57, 0xad07, 0x2fcc, 0x350e,
+    0xdd4b, 0x5e0c, 0x988b, 0x36ce, 0xb9a9, 0x165e, 0x7fca, 0x99b9, 0x7262, 0x35d0, 0x89bd, 0x77d4, 0xb0c1, 0x3554, 0x1a66, 0xb47b,
+    0x4544, 0xc275, 0x9db3, 0x1e9e, 0xc4ab, 0x5b34, 0x758c, 0xcf85, 0xb283, 0x4892, 0x2308, 0x7f6a, 0x95c5, 0x326a, 0x6560, 0xd3cb,
+    0x428a, 0xc267, 0x8cef, 0xcb65, 0x5044, 0x61da, 0x3ed2, 0x5148, 0x3b7e, 0xd873, 0x92c9, 0x9b8f, 0x219a, 0x4b46, 0x84bb, 0x9369,
+    0x5900, 0xe893, 0x6f2e, 0x808b, 0xc96b, 0xb837, 0x9a77, 0x41cc, 0x4458, 0xd923, 0x6d6e, 0x3bbe, 0xc20f, 0xdf41, 0x88df, 0x2d18,
+    0xb15f, 0x73cc, 0x59a0, 0x29ec, 0x3e10, 0xcbf3, 0x2f26, 0x1d38, 0x8dcf, 0x562c, 0x721e, 0x3fbe, 0xae65, 0x6b3a, 0x7340, 0xa3f1,
+    0xdcdf, 0x8b3b, 0x166e, 0x7d60, 0xaf57, 0x9d3f, 0x828b, 0x330c, 0x513c, 0x3f54, 0x98c7, 0x1cda, 0x4912, 0xc729, 0xddf5, 0x1e6c,
+    0xa315, 0xbc3f, 0x4bfc, 0x9817, 0xd973, 0x60bc, 0x7e78, 0x33ca, 0x9651, 0x1aa4, 0xa0fd, 0xc2c7, 0x20a2, 0x4668, 0x97ed, 0xe6f1,
+    0x67e0, 0x8ae3, 0xb0ad, 0x605c, 0x3394, 0xdab5, 0xb039, 0x3d80, 0xd6bf, 0x8e17, 0xa75d, 0xe62f, 0x683c, 0xca7b, 0x4bc2, 0x7154,
+    0x8b1b, 0x4da0, 0x2ee4, 0x898f, 0xb0e3, 0x2030, 0x7306, 0x9619, 0x9819, 0x6d60, 0xe953, 0x6a96, 0x1824, 0xcdf5, 0x4932, 0x375c,
+    0xe4d9, 0x9285, 0x3f36, 0xb225, 0x8f45, 0x1f96, 0xe0ad, 0xb56b, 0x2206, 0x9285, 0x331e, 0xaf4d, 0x9d99, 0xe0cb, 0x49a8, 0xc15d,
+    0x6e04, 0xb039, 0xa589, 0x4980, 0x37c2, 0x9d7d, 0x54b6, 0x7840, 0xbf9f, 0x68c8, 0xe56b, 0x9665, 0x574c, 0x8809, 0x6952, 0x2dc6,
+    0xb063, 0x4702, 0x9887, 0xaf7b, 0x430c, 0xbb67, 0x6938, 0xb473, 0xda53, 0x60bc, 0x6f48, 0xac67, 0x497a, 0x2832, 0xae09, 0x83f3,
+    0x2fee, 0xd71d, 0x4d3e, 0x15b0, 0x8ff9, 0xcedb, 0x24f2, 0x6426, 0xdf4f, 0x50c4, 0xcfa1, 0x418a, 0xc7ef, 0x60c6, 0xd881, 0x42f8,
+    0x8467, 0x1538, 0x2e9c, 0x7fde, 0xe2e7, 0x97cf, 0xa8bf, 0x833f, 0x26ae, 0xcd3d, 0x355e, 0x251e, 0xc62d, 0xd9f5, 0xb7d9, 0xe927,
+    0x6a34, 0x1ba4, 0x77c4, 0xd18d, 0xb789, 0x303a, 0xd5c7, 0xa8a7, 0xe0bb, 0x2498, 0x94bb, 0x3422, 0x8d43, 0xe781, 0xb18b, 0x41c0,
+    0x915f, 0x60ee, 0x343e, 0x1dcc, 0x5cfe, 0x99c5, 0x330e, 0xb097, 0x5b5a, 0xaadb, 0x6ffc, 0x42b4, 0x12fa, 0x610c, 0xe37b, 0x7fea,
+    0xae37, 0x8b25, 0xc9a7, 0x623e, 0xa363, 0x3e70, 0xc2c7, 0x2ec4, 0xcff1, 0x4bd0, 0xb91f, 0x30cc, 0xe2cb, 0xd353, 0x7262, 0x9acf,
+    0x2452, 0x8a27, 0x66fc, 0xd9f7, 0xb9ed, 0x2530, 0x9c47, 0x8781, 0x6cd2, 0xe1ff, 0xc13f, 0xd7f9, 0x5d44, 0xb2af, 0xcd97, 0x2688,
+    0x856b, 0x6150, 0x6f04, 0x1aec, 0xb019, 0xa165, 0xd447, 0x8e35, 0xcc11, 0x64da, 0x4044, 0x5c86, 0xe677, 0xc215, 0xd89d, 0xaeeb,
+    0x8afd, 0x5504, 0x38aa, 0x9d9d, 0x4e24, 0x2e4a, 0x745e, 0xe2f3, 0x22de, 0xa169, 0x4ed4, 0x90f3, 0x2f16, 0x6930, 0xa3d1, 0xce43,
+    0x561a, 0x9427, 0xdaa1, 0xbec1, 0x762c, 0x62ee, 0x7bb8, 0x9f3d, 0xe80f, 0xa67f, 0x2f28, 0xbb6b, 0x9c37, 0xcc39, 0x1baa, 0x54b0,
+    0x6e48, 0xcb29, 0x449e, 0x657c, 0xe9c7, 0x21f0, 0x6f9a, 0xbadf, 0xae77, 0x7bda, 0xd31f, 0x91c1, 0xacdd, 0x39d0, 0x8977, 0x769a,
+    0x3f64, 0xccbf, 0x8315, 0x2dde, 0x73ca, 0xd4a5, 0x4646, 0xac17, 0xd289, 0xb495, 0x3a72, 0x8757, 0x9191, 0xb783, 0x503e, 0x7b04,
+    0x3242, 0xd4fd, 0x421c, 0x7664, 0x9fcd, 0x58f4, 0x7448, 0xbdff, 0x6b3e, 0x3d5e, 0x2fa4, 0x5104, 0xb04b, 0x802b, 0x96e7, 0xe4e1,
+    0x2bde, 0xad25, 0x446a, 0xc331, 0x64f4, 0x3646, 0xd1c1, 0x4cda, 0x1c94, 0xc4fb, 0x48ea, 0x8765, 0x5424, 0xaa69, 0x6986, 0x8193,
+    0xaf57, 0xc249, 0x5eb2, 0x51de, 0x32b4, 0x6682, 0x50ca, 0x7aa2, 0x6380, 0xd97b, 0x51f8, 0x7bf0, 0x2694, 0xbc91, 0x92c7, 0x5ad0,
+    0x7e74, 0x24a0, 0xd771, 0x8195, 0xc539, 0x1df2, 0x8021, 0xdd57, 0x931d, 0x3338, 0x6cb8, 0x2bd8, 0xbfa7, 0x211a, 0x5ac2, 0x3d00,
+    0xd287, 0x5318, 0x293e, 0xc98f, 0x89ef, 0x4d26, 0xa535, 0x1846, 0x388e, 0x9fb7, 0x219a, 0xca9b, 0x64fa, 0xbc1f, 0x7b1e, 0x52d8,
+    0xa121, 0xc945, 0x7fca, 0x5d7e, 0x3514, 0x78b8, 0xaf15, 0xca35, 0x34dc, 0xbec9, 0x720a, 0x8de9, 0xa109, 0x2fc0, 0xbe75, 0x768a,
+    0xe3d1, 0x9141, 0xa2fb, 0xd041, 0x26f6, 0x384a, 0x1bc4, 0x6708, 0x50e8, 0xebab, 0xac9b, 0x793c, 0x4118, 0x711c, 0x8773, 0x33de,
+    0x4a20, 0xc9db, 0x9541, 0x40e4, 0xa13d, 0x5502, 0x81e1, 0x453a, 0x8b75, 0x5c06, 0xa95d, 0x4956, 0xcf1d, 0x59ee, 0x73a6, 0xca4f,
+    0xd79b, 0x8f23, 0xe647, 0x7a48, 0xc275, 0x9081, 0xd7f7, 0x6c48, 0x35b0, 0x8d8f, 0x28a4, 0xc463, 0xa145, 0x6f0a, 0x9399, 0x5392,
+    0x422e, 0x1b46, 0x73da, 0x4de0, 0x7484, 0x8ddd, 0xda89, 0x6228, 0xb42d, 0x1534, 0x5a68, 0x66ec, 0x909d, 0x552a, 0xa601, 0xcf4d,
+    0x5a04, 0xe003, 0x49e6, 0x997b, 0x7d38, 0x4e9c, 0xe5b9, 0x40a6, 0x14cc, 0x8bcf, 0x6732, 0x9dbf, 0x4c00, 0x2542, 0x8151, 0x9a61,
+    0x4534, 0xa7c9, 0xe4c7, 0x3122, 0x7d3c, 0xc0f7, 0x22ae, 0x7784, 0xa35b, 0x2c42, 0xae9d, 0x85a1, 0xa8bb, 0x31c0, 0x72b4, 0x1dd6,
+    0xc85b, 0xb2b1, 0xdacd, 0x238e, 0xccfd, 0x98a9, 0x5ed8, 0xb485, 0xbcf9, 0x88bd, 0x2842, 0xe4e9, 0xbd3d, 0x7d90, 0x55be, 0x451c,
+    0xbcf3, 0x209a, 0x3490, 0x87a9, 0xa0f9, 0xd8df, 0x4ee6, 0xc0a7, 0x6ad4, 0x46be, 0xc5e7, 0x8867, 0x479e, 0x3776, 0xa587, 0xb9cd,
+    0x38a4, 0x9c33, 0xb151, 0x35b4, 0xd147, 0x55aa, 0x3a64, 0x6b5c, 0xde99, 0x1f4e, 0x597a, 0xc9c7, 0x6e0c, 0x4adc, 0xaf6f, 0xd54f,
+    0x5822, 0x6eb0, 0xe529, 0x9c67, 0x3fd2, 0xbf41, 0x1bc2, 0x64ee, 0x5520, 0x73e4, 0x5c10, 0xe9bb, 0x6dea, 0xd5a7, 0x5852, 0x3a2e,
+    0xc681, 0xa07d, 0x17ee, 0xc1e3, 0x8ccb, 0xd14f, 0x915d, 0x1be8, 0x99db, 0x83f7, 0xc635, 0x2318, 0xbd55, 0x3bc0, 0x17cc, 0xc1ef,
+    0x5e22, 0xd549, 0x9dad, 0x7b4e, 0xe4fd, 0x2d4a, 0x81af, 0xae31, 0x7d2e, 0x2db0, 0x7460, 0xb465, 0x9eed, 0x2e4c, 0xbc37, 0x4174,
+    0xca49, 0x2bf4, 0x8007, 0xdf33, 0xbed5, 0x8baf, 0xd41d, 0xc2a1, 0xa323, 0x20c8, 0xc4dd, 0x771a, 0x36a6, 0x6a24, 0xd147, 0x3382,
+    0xb141, 0xc21f, 0x4440, 0x9153, 0x62be, 0xaaf9, 0x3bb6, 0x9c99, 0x21e6, 0xaf09, 0x8495, 0xa621, 0x7e82, 0xb29f, 0xdfb5, 0xc335,
+    0xa6e5, 0x8929, 0xd6f9, 0x6650, 0x2e0e, 0x771a, 0xd55d, 0x985d, 0x8459, 0xe5bb, 0x807b, 0x98f7, 0x4312, 0x8ae9, 0xe977, 0x3782,
+    0xb439, 0x3058, 0xe0cd, 0x9d4b, 0xbf5b, 0xa8eb, 0x4d0c, 0x80d9, 0x13b6, 0xa4eb, 0xb20f, 0x263e, 0x510a, 0x6e02, 0xaa4b, 0x1da0,
+    0x58c2, 0x6788, 0x4b72, 0xc141, 0x6d42, 0x8c75, 0xc98f, 0xb65b, 0x9e3f, 0x7448, 0x6016, 0x9ab9, 0xbdab, 0x9c6f, 0x5afe, 0x26ac,
+    0x7fae, 0xc29f, 0x5b8a, 0x20ea, 0xe5bf, 0x6b38, 0xc589, 0xaed9, 0x3256, 0xd295, 0x763c, 0xb5e9, 0x93c3, 0x1fb8, 0x32cc, 0x9ba5,
+    0x1796, 0x459e, 0xb57b, 0x9ec1, 0x4e6c, 0x1906, 0x47e0, 0x7b5e, 0xc1b1, 0xe987, 0x810d, 0x5c46, 0xdad1, 0xbbc9, 0x2414, 0xca45,
+    0xbc1f, 0xcfed, 0x30a6, 0xe32d, 0xb3ef, 0x2fde, 0x55d2, 0x6c68, 0xa1e1, 0x90b9, 0xcd6b, 0xaba3, 0x22dc, 0x3eea, 0x6588, 0xaf3b,
+    0x3894, 0x7ace, 0x234a, 0xa431, 0x3604, 0x6630, 0xc29f, 0xa487, 0xc0af, 0x3718, 0x7494, 0x3af8, 0xc94f, 0x73ae, 0xafc1, 0xdff5,
+    0x6a72, 0x27be, 0xbcbf, 0xa227, 0x56c4, 0x3f2a, 0x6b14, 0xb5ef, 0x56b0, 0xdb93, 0x81db, 0x192a, 0x62fc, 0x497e, 0xd7ff, 0x3772,
+    0x7b02, 0x30e0, 0x7634, 0x627c, 0x89d5, 0xddbd, 0x520a, 0x7bb2, 0x39e4, 0x6748, 0xc553, 0x7c3a, 0xa60b, 0x4a7c, 0x3104, 0xde45,
+    0x81f5, 0xa555, 0x638c, 0x44d6, 0x162a, 0xab43, 0x24d6, 0x393e, 0xafd5, 0x6f16, 0x1eda, 0x9c6b, 0x61b6, 0xe433, 0x7914, 0x835d,
+    0x26aa, 0xe019, 0x5e2a, 0x886f, 0xa925, 0xc08b, 0x94cd, 0xb24b, 0x2ec2, 0x9361, 0x3adc, 0x7cea, 0xe111, 0x3202, 0x94ad, 0x269a,
+    0xb6eb, 0x8517, 0x19dc, 0x4f96, 0xb4cf, 0x7d5c, 0x930b, 0xa489, 0xd8d9, 0x25b2, 0x3fda, 0xad5d, 0x2e46, 0x1d88, 0x754c, 0xb303,
+    0x8e77, 0x6a78, 0x5786, 0xeaeb, 0x37da, 0x200e, 0x4a46, 0xb467, 0x59ae, 0xe561, 0x9d35, 0x7018, 0xda59, 0x8bed, 0x6154, 0xaa07,
+    0x822f, 0x3a72, 0x6a20, 0x193c, 0xa6c1, 0x8dab, 0xcce3, 0x6d30, 0x5956, 0xe249, 0xc599, 0x3828, 0xd533, 0x810f, 0xde87, 0x1960,
+    0x59c6, 0x6968, 0xa7f7, 0x2050, 0x9d9d, 0x58d6, 0x2880, 0x36da, 0x8347, 0x3fba, 0xb753, 0xea7f, 0x8b69, 0xa647, 0x2328, 0x4954,
+    0xe8ad, 0x7592, 0x276a, 0x6b26, 0xde83, 0xc431, 0x6f6c, 0x5f98, 0x42aa, 0xcf55, 0x4f86, 0xdd91, 0x35f2, 0x45dc, 0x8e43, 0x74ce,
+    0x2df8, 0x6820, 0x486a, 0xb367, 0x863f, 0xe1ff, 0x2b98, 0xb67b, 0x4704, 0x53a4, 0xbea7, 0x3116, 0xcf3b, 0x1900, 0x9817, 0x4724,
+    0x6d8a, 0x84df, 0x5f02, 0x3b94, 0x2290, 0xd80b, 0x6a4c, 0x97a5, 0x55ea, 0x41be, 0x7652, 0x8b1b, 0xe6e1, 0xc74f, 0x9669, 0x36b4,
+    0xcc3f, 0xb05d, 0x2ce4, 0x9b11, 0x5efe, 0xd8ed, 0x4b94, 0x30ee, 0xbd15, 0x2056, 0x436a, 0xd88f, 0x4f98, 0x158e, 0xd245, 0xb84d,
+    0xa8d3, 0xdd35, 0x700e, 0x8e71, 0xae99, 0x320c, 0x5210, 0x728a, 0x221e, 0x8585, 0xc20f, 0x2a1c, 0x7eae, 0xddf5, 0xc26b, 0x869f,
+    0x59bc, 0x67f0, 0x2f42, 0xcaf5, 0x6410, 0xbb21, 0xd66d, 0x975b, 0x1e98, 0x53de, 0xb1cb, 0x3066, 0x4892, 0x8b4d, 0x3370, 0x7338,
+    0xa7cf, 0x6ad0, 0x9385, 0x8b33, 0xc1cf, 0x1eba, 0xdb4b, 0x7fe6, 0x4b9e, 0xe2b9, 0x4086, 0x7c9e, 0xc587, 0xe303, 0x82ad, 0x1a7e,
+    0x86b9, 0xd4bb, 0xbc9d, 0x4448, 0xc9f9, 0x908f, 0x225c, 0x57ee, 0x4f52, 0xd7fd, 0xa791, 0x1e6a, 0xe38b, 0x8f1f, 0x344c, 0x5218,
+    0xcb81, 0x7e18, 0x5048, 0xd465, 0x952d, 0xe4ef, 0xaf41, 0x36aa, 0x8ecf, 0x3da0, 0xbfc9, 0xd227, 0x9c55, 0xb3c9, 0x9817, 0x601e,
+    0x483c, 0xd393, 0x96d3, 0xb83b, 0x241a, 0xb24f, 0x3f72, 0x2a36, 0xd9ad, 0x9acd, 0x5c40, 0x35c2, 0x1ad0, 0xc911, 0x9e29, 0x8da7,
+    0x6bd8, 0xb6cb, 0xe445, 0xd02d, 0x9013, 0x73c8, 0xe639, 0x7d22, 0x52ac, 0x9c53, 0xd995, 0x7180, 0xbb63, 0x482a, 0x8ee3, 0xd92b,
+    0x5394, 0xa0b5, 0x1516, 0x73ac, 0x4b00, 0x200e, 0x7b90, 0xdbd5, 0x4d38, 0x8c49, 0xb681, 0xa043, 0x21c4, 0xbb9d, 0x74c0, 0x43ec,
+    0xc627, 0x371a, 0xa5b7, 0x60f8, 0xcf1f, 0x2c9c, 0xdf0d, 0x34b2, 0x8c8f, 0xbac3, 0x9e31, 0xd337, 0x8d95, 0xbe31, 0xa511, 0xe4df,
+    0x29ea, 0x46f0, 0xb75d, 0xac07, 0x6710, 0x7838, 0xd035, 0x8d19, 0x28c2, 0xaf8d, 0x5d18, 0x44dc, 0x3790, 0xa017, 0x5560, 0x2f2e,
+    0xc8fb, 0x9663, 0xdfcb, 0xb9a7, 0x5946, 0x420e, 0x9997, 0xc063, 0x37f2, 0xa0d1, 0x8e6f, 0x41f4, 0x5ae0, 0x4f64, 0x77e0, 0x8c19,
+    0xb8e3, 0x4fc4, 0xd51f, 0x3d4a, 0xcc31, 0xae01, 0x9323, 0x66d6, 0xce29, 0x6134, 0x90cb, 0x2c46, 0x5950, 0xcce9, 0x7ce2, 0x918f,
+    0x9ef1, 0x5898, 0x826d, 0xb78d, 0x2a8a, 0x4416, 0x9085, 0xea15, 0xc9c5, 0x6868, 0x19d0, 0xbdcd, 0x5fa4, 0x95db, 0x1a16, 0x4c64,
+    0xe943, 0x9c09, 0xc18b, 0x1f3e, 0xa205, 0x537c, 0x6210, 0x6376, 0xcadb, 0x2d88, 0x6a9e, 0xa497, 0x5fe0, 0x7c60, 0xcd17, 0xab0f,
+    0xd2c9, 0x23aa, 0xaccf, 0x83c1, 0xb655, 0x552c, 0x3772, 0xd785, 0xbedf, 0xe0e5, 0x6672, 0xcba1, 0x227c, 0x3e64, 0x6290, 0x86e7,
+    0xd309, 0x4b3a, 0x7e32, 0xd9b5, 0x3f3c, 0xa947, 0x7a9a, 0x5896, 0x8ed3, 0xd2d3, 0xa46d, 0x333c, 0x818f, 0x63f4, 0xe5f9, 0x7814,
+    0x3918, 0x219e, 0x4844, 0xca49, 0x8181, 0x1b56, 0xd059, 0x985f, 0xe8f1, 0x6538, 0x3d9a, 0x50a8, 0xa371, 0x49b4, 0x675c, 0xb029,
+    0xdcbf, 0xa8c5, 0x4020, 0x7c24, 0x2b70, 0xa955, 0x3f70, 0xa245, 0x5d6a, 0xd1df, 0x9eaf, 0xa16b, 0x78e8, 0xc80b, 0x2a40, 0x5be6,
+    0xe10b, 0x368a, 0x4c98, 0x42f8, 0xced5, 0x5c28, 0x9583, 0x28c4, 0xb1b7, 0x33ce, 0x9291, 0x4e24, 0x71a8, 0x2b38, 0x9b35, 0xd75f,
+    0x5376, 0x6ca6, 0x9f1b, 0x59da, 0x7902, 0xe2bb, 0xb489, 0x7e08, 0x7652, 0xb087, 0x5aa4, 0x90c1, 0x4dcc, 0xbd1f, 0x5dc4, 0x1c02,
+    0x9529, 0x3f5c, 0x71a6, 0x5d48, 0x2936, 0x44fe, 0x6bbc, 0xd76f, 0x84c3, 0x5cde, 0x4692, 0x6c68, 0x55f0, 0x23aa, 0xc6ed, 0xac8d,
+    0x1054, 0x985b, 0x4674, 0x55e8, 0x36be, 0x74f0, 0xa30f, 0xc1b3, 0x7aac, 0x5172, 0xb5c1, 0x90ab, 0xd535, 0x6b96, 0xbee1, 0x1b48,
+    0x4ce8, 0x2d18, 0x7df6, 0x5aac, 0x3182, 0xb9b5, 0x8e81, 0xa801, 0x2b90, 0xd2f7, 0x3bd6, 0x8219, 0x2b84, 0xa8f5, 0x2274, 0x6324,
+    0xc611, 0xb015, 0x689e, 0xd8e5, 0xe54b, 0x35ce, 0x5d66, 0xc9f5, 0x6f0e, 0xdc75, 0x675e, 0x47a4, 0x8821, 0x840b, 0xdf15, 0x5dc2,
+    0x958f, 0x7b80, 0xdb73, 0x4608, 0x9cef, 0x6a24, 0x4d56, 0x560a, 0xca6f, 0x7122, 0x52b4, 0x2d08, 0x6ac2, 0x4a8c, 0x3cac, 0x6046,
+    0xd03b, 0x9453, 0x8113, 0x2abe, 0xd703, 0x6000, 0xb08d, 0x703e, 0x3c72, 0xc375, 0x287c, 0x8011, 0xb689, 0xda65, 0xe73f, 0x771a,
+    0x453e, 0x4a68, 0x259e, 0x65c0, 0xce57, 0x2d10, 0x2272, 0xddd5, 0x4ba0, 0x13ae, 0x6b62, 0x95bf, 0x244e, 0xc4ed, 0x9ec3, 0x404a,
+    0xe729, 0x973f, 0x860f, 0x6670, 0x7150, 0x4862, 0xe2c7, 0x1832, 0xa14b, 0xdaf7, 0x71ca, 0x1dce, 0xbe6f, 0x47ec, 0xae5f, 0x6d80,
+    0x1af2, 0xc0b7, 0x4034, 0xd745, 0x9769, 0x1b6c, 0x7cf6, 0x3250, 0xa99f, 0x76f0, 0x8ed7, 0x8bb3, 0xe617, 0x7164, 0xcd15, 0x659e,
+    0xac03, 0x3b78, 0x76b0, 0x5824, 0xbadb, 0x9655, 0x3cc6, 0x8c23, 0xa5dd, 0x78ae, 0x9219, 0x4b8a, 0xb8e3, 0x6e96, 0x2d06, 0x38e4,
+    0x7c3a, 0x4f2e, 0xc6bb, 0x77be, 0xe361, 0x2dc6, 0x780a, 0x8dd5, 0x2240, 0x99df, 0x3284, 0x4cfc, 0xaa8d, 0x7b84, 0xd7b5, 0x9d6d,
+    0x1d96, 0xa3b9, 0x7650, 0x28cc, 0xb009, 0x1a94, 0xa41d, 0xe24b, 0x680c, 0x3dc4, 0x7a28, 0xc863, 0xb533, 0x3150, 0x9123, 0x4e02,
+    0x9383, 0x6976, 0xbd05, 0x33a8, 0x5594, 0x9bf9, 0xbd25, 0x49b2, 0xa817, 0xb517, 0x9b91, 0xd9bf, 0x7648, 0x1b8c, 0x9401, 0x3666,
+    0x2896, 0xc027, 0xd423, 0x9993, 0xe5ad, 0x8767, 0x5332, 0x7578, 0x2858, 0x6dec, 0x3ec8, 0x193a, 0x6676, 0xede3, 0xb301, 0x81f3,
+    0xc05f, 0x8f8d, 0x1750, 0xa2cd, 0x74de, 0x4472, 0xa959, 0xc1ab, 0x76fc, 0x636a, 0xd60f, 0xae21, 0xbb93, 0x5c6a, 0x3820, 0xbcc3,
+    0xa3a5, 0x2fc2, 0xdf71, 0x1b5a, 0x5002, 0xa265, 0x3054, 0x3be4, 0xe4c1, 0x256a, 0x861b, 0xba3f, 0x6dc2, 0x2ff6, 0xa5dd, 0xb6d7,
+    0xefa9, 0xc22b, 0xac4f, 0x1bfa, 0xc3dd, 0x902b, 0x9d3d, 0x5712, 0x1a8a, 0xc5ab, 0xaea1, 0x315c, 0xe78f, 0x7368, 0x3b60, 0xe413,
+    0xad33, 0x7106, 0xc155, 0xb087, 0xe30f, 0xd261, 0x9131, 0x6ab8, 0x1f1c, 0xcbfd, 0xa7f9, 0x240e, 0x71f0, 0x826d, 0xab71, 0x47a2,
+    0xe79d, 0xc957, 0x3da8, 0xa0f5, 0x740c, 0x499a, 0x4732, 0xc9f9, 0x5e6e, 0xbd5b, 0x7a0a, 0x5242, 0xa517, 0x7d94, 0xc9f7, 0x45e6,
+    0x89cd, 0x2a7e, 0x3ca2, 0xb905, 0x88d5, 0xa8a9, 0x9cdb, 0x4202, 0x0f28, 0x34e8, 0xbe6d, 0xd151, 0x5672, 0x2f38, 0xb5ef, 0x3dc4,
+    0xa11d, 0xcf8b, 0x2a2a, 0x7fee, 0xc2b9, 0x8b97, 0xaab1, 0x3d90, 0xb2fd, 0x191e, 0x911b, 0xde37, 0xd28d, 0x864b, 0xa53f, 0x1d28,
+    0xb9f5, 0x3386, 0x7128, 0x4040, 0xc8dd, 0x93b5, 0x356e, 0xe509, 0xa397, 0x7abe, 0xddf3, 0x92df, 0x453a, 0x622e, 0x2d14, 0xc265,
+    0xa71d, 0xb1ab, 0x8e11, 0x7a70, 0xb2c3, 0x7410, 0x8431, 0xb6d5, 0x7c82, 0xa967, 0xcf79, 0xee47, 0xb96d, 0x84d3, 0x33be, 0xa729,
+    0x6776, 0x1a34, 0x3322, 0xc1ab, 0x2284, 0x5164, 0xbe0f, 0x77b0, 0x31e2, 0x4e14, 0xb689, 0x9cb5, 0xd8dd, 0x613a, 0x3936, 0xd8f7,
+    0xbad3, 0x4b30, 0xa133, 0x6a26, 0x7552, 0xa8ef, 0xd7b3, 0x57ba, 0xb35d, 0x3bd8, 0x5036, 0x29d6, 0xa759, 0x3092, 0xbbb7, 0x7fcc,
+    0x24bc, 0xd15f, 0x4f1c, 0x8edd, 0xdd4d, 0x2da4, 0xd011, 0xc0ef, 0x1b62, 0xb66f, 0xd20f, 0x39e0, 0xe237, 0xa091, 0xbeb7, 0x6666,
+    0xe56b, 0x9633, 0x38d2, 0x82ef, 0x4f80, 0x99eb, 0xd153, 0xab23, 0x5018, 0x7028, 0xc451, 0x96fd, 0xbc0d, 0x5622, 0x2f8e, 0x6a40,
+    0x49e4, 0xc5d9, 0xeae9, 0x53ba, 0x9401, 0x6a50, 0xc379, 0x2d04, 0x9491, 0xb333, 0x5700, 0x6d8e, 0xa13b, 0x44b2, 0xbd55, 0x24ee,
+    0xaf8f, 0xe9d1, 0xa28f, 0x772a, 0xb623, 0xde43, 0x3068, 0x65be, 0x58cc, 0x14c0, 0x2ff2, 0x8ebb, 0xcd13, 0xb6b5, 0xeafb, 0x54b4,
+    0x8b19, 0x7512, 0x4ea4, 0x53f6, 0x6ca4, 0x1860, 0xbe65, 0xe619, 0x8341, 0xc1e9, 0xcf1d, 0xd8b7, 0x9297, 0x53de, 0x9d6b, 0x1b36,
+    0x4c60, 0xd88f, 0xc443, 0x8473, 0xb78d, 0x2d06, 0xd2ef, 0x3e14, 0x546e, 0xad35, 0x20ac, 0x7df6, 0x43fe, 0xced1, 0x92e7, 0x7314,
+    0x486c, 0x57b4, 0xc897, 0xafff, 0x851b, 0x46e8, 0xcf8d, 0x8feb, 0xa445, 0x63b4, 0xc831, 0x4a8e, 0xd8f5, 0x7f46, 0xd845, 0x74f0,
+    0x54ca, 0x33d0, 0x9ea7, 0xd6c1, 0x85cf, 0xb0cf, 0x2966, 0xce2f, 0x78b0, 0xa341, 0xd959, 0x89fd, 0xa61f, 0x3f1e, 0x7f82, 0x6208,
+    0x268c, 0x87dd, 0x3892, 0x7914, 0x1d46, 0x57b2, 0x2aa8, 0xb18d, 0xe571, 0x3806, 0x81c9, 0x45cc, 0xdfd1, 0x5244, 0x2d1e, 0x9db5,
+    0x7aba, 0x9019, 0x2024, 0xb5b1, 0xd405, 0x1f90, 0xdb17, 0x90cb, 0x1dda, 0x9a73, 0x486a, 0xc2db, 0xdb65, 0x574c, 0x9d45, 0x3792,
+    0xd703, 0x7ab4, 0x9675, 0x55a6, 0x15b0, 0x642e, 0xc611, 0x8b0b, 0xaad1, 0x99d9, 0x755c, 0x23ec, 0xa75d, 0x6dbe, 0xcdc7, 0x818d,
+    0x1c30, 0x4eac, 0x67b4, 0xae23, 0x389c, 0x1a18, 0xd145, 0x6c40, 0xe1bf, 0x7f28, 0x4678, 0x39b6, 0xb073, 0x5a22, 0x7970, 0xd9d1,
+    0x6bb8, 0x5356, 0xe5bb, 0xa155, 0x8b6f, 0x189c, 0x420c, 0x844b, 0x50a2, 0x1c2c, 0xbb29, 0x5c1c, 0xacf1, 0x17ba, 0x907d, 0x8d75,
+    0x5a52, 0x241e, 0xd3ad, 0x40ec, 0xa133, 0xe605, 0x61da, 0x44de, 0xd1a9, 0x80fb, 0x2ed4, 0x574c, 0x3daa, 0x7064, 0xd0c7, 0x5a64,
+    0xcad3, 0x7c8a, 0xbb55, 0xe2af, 0x8e0f, 0x9927, 0xd57d, 0x67f8, 0xc43b, 0x82a1, 0x4184, 0x7a20, 0x50ea, 0xa199, 0x84c1, 0x2a0c,
+    0x5c90, 0x7d7c, 0x9025, 0xe14f, 0x5154, 0x38ac, 0xcae1, 0x6cfa, 0x214e, 0x9b31, 0xde1f, 0xc9c9, 0x7422, 0x40a4, 0xc23d, 0x9383,
+    0x5102, 0xab39, 0xc797, 0x6968, 0x2fe2, 0x6f20, 0x88bd, 0x54b4, 0x3f20, 0xe59f, 0x298e, 0x55a8, 0x8869, 0x1c50, 0x4dfe, 0x900b,
+    0xb57d, 0x1dd8, 0xd417, 0x627e, 0xb9e7, 0x266e, 0x60ca, 0x4760, 0xe019, 0x829d, 0x295c, 0xa483, 0x3c02, 0x8557, 0xe8ad, 0xb6f1,
+    0x35cc, 0x86b5, 0x6906, 0x3e64, 0xd3ad, 0x828d, 0x52d4, 0x3ddc, 0xa97d, 0x21b0, 0xca61, 0x2b92, 0xe4ad, 0x638a, 0x8775, 0xd1e7,
+    0x5c70, 0x861f, 0x1826, 0xcef1, 0x6586, 0x43a2, 0x7090, 0x8efb, 0xdc61, 0xc1b1, 0x7e68, 0x67da, 0x2cac, 0x3f46, 0x888b, 0x6d7e,
+    0xca21, 0x20b4, 0xac17, 0x334e, 0xc24b, 0x99af, 0x49be, 0xabd3, 0x38aa, 0x87f9, 0x59ba, 0x2a8c, 0x77a2, 0x3752, 0xcf0d, 0x415a,
+    0x74de, 0x650a, 0x2f44, 0x98ed, 0xe6df, 0x660e, 0x8f33, 0x7a90, 0xdef7, 0xa543, 0x6636, 0x26d4, 0x546e, 0xdaa7, 0x6998, 0x1dac,
+    0xe657, 0x82f7, 0x389e, 0x9231, 0xbeb9, 0x22d8, 0x6d4c, 0x5598, 0xbbe3, 0x353a, 0x282e, 0xa171, 0x5bbe, 0x16a4, 0x89af, 0x4888,
+    0x208a, 0x847f, 0x68ee, 0x513c, 0x55ba, 0x3a0a, 0x6eec, 0xbb37, 0x4214, 0x6522, 0x1c08, 0x4afe, 0xbd8f, 0x6dd8, 0xa927, 0xca21,
+    0x7656, 0xe8f5, 0xd2d9, 0x5164, 0x72e4, 0x9a85, 0x46fe, 0x85c9, 0x6690, 0x4fa2, 0x75e6, 0xc223, 0xbc5f, 0x3838, 0x7bdc, 0xd651,
+    0xb735, 0x5ab2, 0x83ad, 0xcc2b, 0x6956, 0x94b1, 0x7db4, 0x3946, 0x66c2, 0x5f1a, 0xe06d, 0x342c, 0x62fa, 0x185c, 0xba91, 0x6d26,
+    0xaddb, 0x5d78, 0xc48f, 0xdf4b, 0x3148, 0x73a4, 0xd8f7, 0x2a66, 0x5c34, 0xcde5, 0x83c7, 0x4d26, 0xe347, 0x9e31, 0x2816, 0x5776,
+    0xea79, 0xc1f3, 0x9a89, 0x6104, 0xe26d, 0x541a, 0x7eee, 0x93bd, 0x32dc, 0xc3cd, 0xab79, 0x5e92, 0x285a, 0x8dd7, 0x2d22, 0xa1e1,
+    0x884b, 0xb06b, 0xcc97, 0x21c8, 0x5cd6, 0xbd03, 0xdb6b, 0x6a28, 0xd551, 0x98d1, 0x3832, 0x72a4, 0xcbf7, 0x7d0e, 0x531a, 0xdf5b,
+    0x37e4, 0xc3dd, 0x5ea2, 0xb817, 0x4522, 0x1f00, 0x906b, 0xbd91, 0x2a0c, 0x4500, 0x63d6, 0xad39, 0x9073, 0xa741, 0x1d1a, 0x3c8e,
+    0x9183, 0x9a7f, 0x5098, 0x5db4, 0xac09, 0x2f02, 0x357c, 0x4dba, 0xa981, 0x278e, 0xdd31, 0xb061, 0x1a40, 0x7250, 0xec8d, 0x9955,
+    0xad5f, 0xcef9, 0x1ab6, 0x3160, 0xbc69, 0x83f3, 0x9a5d, 0xdacf, 0x46ee, 0x8431, 0xb501, 0x61ee, 0x4ac8, 0x9619, 0x2c28, 0xdd1d,
+    0x3ff2, 0x6c72, 0x1a0c, 0xbbc3, 0x439c, 0xacd7, 0xd86f, 0x69c6, 0x93bd, 0x85ed, 0x6a90, 0x4554, 0xced5, 0xa61f, 0x3754, 0x7db0,
+    0x4756, 0x621c, 0xac8b, 0x39b4, 0x9525, 0xb341, 0x748a, 0xbc97, 0x1e94, 0xb08f, 0x5bce, 0xde29, 0x65b8, 0x1b1a, 0xc9b5, 0x825d,
+    0x9c2d, 0x25e6, 0xc2f1, 0x9a1f, 0xae11, 0x3374, 0xdf85, 0x7f08, 0xd9c7, 0x57c2, 0x8715, 0x8d83, 0x3f9e, 0xa4c9, 0xcadd, 0x3470,
+    0x3e66, 0x774e, 0x31fe, 0x50be, 0x8a9d, 0xa8c7, 0x2464, 0xc535, 0x4060, 0x4f10, 0xaf93, 0xe41d, 0x9e11, 0x619a, 0xbd69, 0x3750,
+    0xa047, 0x6498, 0xe615, 0xa459, 0x417c, 0xd5f3, 0x5c44, 0x268e, 0x9b75, 0x4e10, 0xa579, 0xba03, 0x6246, 0xc03b, 0x7036, 0xaf97,
+    0xe2a1, 0x8c89, 0x4d08, 0x3bd4, 0x240e, 0x55ba, 0xab9d, 0x12ae, 0x4a7e, 0xcb09, 0x940f, 0xe5ff, 0xa865, 0x37f4, 0xadeb, 0x8729,
+    0xad5b, 0xcfcd, 0x1f82, 0x65aa, 0xdf07, 0x7dc8, 0xc8df, 0xa8fb, 0x6824, 0xd895, 0x7e40, 0xb353, 0x5600, 0x9417, 0x4186, 0xcc4f,
+    0xa5d9, 0xe341, 0x4200, 0xc5dd, 0x937f, 0xe77f, 0xa5b1, 0x5162, 0xde5b, 0x9619, 0x30f6, 0x5b1a, 0xd169, 0xdad1, 0x1dc8, 0x5014,
+    0xbaf3, 0x3dac, 0x6374, 0xa31f, 0xbe0d, 0xe1b3, 0xc777, 0x4286, 0xbb79, 0xa923, 0x9b5f, 0x2276, 0x5c00, 0x95f5, 0xcbc9, 0x1a2a,
+    0x65c0, 0x302a, 0x496c, 0xe4df, 0x2532, 0x5584, 0xacf5, 0xd1b7, 0xc391, 0xb353, 0x7704, 0x91e7, 0x8507, 0xdf37, 0x8e8d, 0x290a,
+    0xe581, 0x1fc6, 0x476a, 0x961f, 0xc8b3, 0xa35d, 0x4d64, 0x78a4, 0xe519, 0x4512, 0x666c, 0xad09, 0x406a, 0xbef1, 0x7ba8, 0x45de,
+    0xadc7, 0x755a, 0x2c14, 0x3bca, 0xce9b, 0x9469, 0xbac7, 0x2276, 0x4992, 0x8bd5, 0xda81, 0x7574, 0xea75, 0xc147, 0x4212, 0xcd93,
+    0x20a2, 0x34fa, 0x7dd6, 0x4552, 0x718e, 0xa9ff, 0x7b0a, 0x2d50, 0xb3f1, 0x895f, 0x629c, 0xe0c1, 0x376a, 0xa259, 0x3e0a, 0xb269,
+    0x7062, 0x945f, 0x6c26, 0x83c7, 0x2c86, 0xc583, 0x5994, 0x6af4, 0x9c4f, 0x910f, 0xd21b, 0x233c, 0x7b5a, 0xe75d, 0xbd15, 0x6c26,
+    0xd10d, 0x2734, 0xa561, 0x3dee, 0x6d40, 0xe79d, 0x7afc, 0x8c91, 0xd601, 0x683a, 0x5e52, 0x97a3, 0xc58b, 0x3494, 0xb999, 0x48ae,
+    0x3df0, 0x729a, 0x5298, 0xb27f, 0x6d62, 0x3984, 0x17e0, 0x614c, 0x8ab9, 0xe699, 0x3500, 0x1508, 0x89c9, 0xdcc1, 0x7d3c, 0x6252,
+    0xb3dd, 0x9e5f, 0x85d9, 0xecdb, 0x95df, 0x51f4, 0x216a, 0xb419, 0x3662, 0xc1f1, 0xaa9f, 0x935d, 0xbb1b, 0x7c22, 0xe387, 0xd5d3,
+    0xa1d5, 0x2af0, 0xc4e5, 0x5792, 0x7e32, 0xd115, 0x3432, 0x58de, 0x9031, 0x8d0f, 0x44cc, 0x78c4, 0xbf77, 0x98ff, 0x413c, 0x4a5e,
+    0x6078, 0xd1b9, 0x7dd6, 0x47a4, 0x2044, 0x5bd0, 0xbf59, 0x9be9, 0x6e8e, 0x33be, 0xad8d, 0xc049, 0x4d84, 0x178e, 0x73ba, 0xb6c9,
+    0xa4cb, 0xd659, 0xb579, 0xc1e7, 0x2f5c, 0xea41, 0x9719, 0x67da, 0xb347, 0x8d39, 0x7178, 0x2824, 0x4984, 0xb853, 0x1e44, 0xa5db,
+    0xdd67, 0x40a8, 0x81e5, 0xb887, 0x8627, 0x7168, 0x80f5, 0xcd39, 0xee77, 0x6760, 0x1eb6, 0xdcd5, 0x47ac, 0xa205, 0x2fa6, 0x8ce5,
+    0x1e00, 0xbbe9, 0xa515, 0xdd25, 0xc269, 0x9823, 0xd243, 0x33fa, 0xb8f9, 0x5f10, 0x3856, 0x7934, 0xc51b, 0x8067, 0x48b2, 0x2e00,
+    0xbcb7, 0x53d4, 0x700c, 0x98d9, 0x3670, 0x9b63, 0x42c2, 0x186a, 0x91d3, 0x497c, 0x8bdf, 0x6fc4, 0xe4fb, 0xd31d, 0xba2d, 0x6ca0,
+    0x78c0, 0xb91d, 0x2f7c, 0xa9bb, 0x1e7c, 0x6316, 0x3158, 0x811f, 0x5852, 0xb6b9, 0xc361, 0x7ea0, 0x2abe, 0x89af, 0x43e2, 0x9909,
+    0xa071, 0x161e, 0x8d87, 0x328e, 0x7c4e, 0x234a, 0x6c60, 0xd0c3, 0x7d54, 0x2bcc, 0xd087, 0xe173, 0x5096, 0x86d7, 0xa9c5, 0x3ff8,
+    0xddc3, 0xbef9, 0x8005, 0x98df, 0x38c8, 0xba41, 0x8141, 0x4542, 0x2a8c, 0x8579, 0x1b5e, 0x471a, 0x3a6e, 0xade3, 0x419c, 0x521e,
+    0xbae1, 0x79ee, 0x6e8c, 0xab1b, 0x3f0c, 0x5a80, 0xb4e1, 0x1f30, 0x6e7e, 0xc3c7, 0x9985, 0x25cc, 0x842f, 0x6472, 0xc887, 0x986f,
+    0x349c, 0x91af, 0xd3ed, 0x85ff, 0xa7b5, 0x47ce, 0xd465, 0x6f1e, 0xa141, 0x3dfc, 0x57fe, 0x198e, 0x8033, 0xcab9, 0x4b52, 0x7560,
+    0xa359, 0x5f98, 0xd40b, 0xa13f, 0xe43d, 0x3e32, 0x52d2, 0xbe31, 0x4044, 0x21a0, 0xa51b, 0x529e, 0x8b29, 0xdb75, 0x63ce, 0xc487,
+    0x458c, 0x2c28, 0xde0f, 0xabd1, 0x7364, 0xb823, 0xd9e5, 0x37f4, 0xa72d, 0xe57f, 0xc2d7, 0x339a, 0x9a91, 0x4b14, 0x2d4c, 0x9593,
+    0x72a0, 0x37ea, 0xe52d, 0x8073, 0x17d8, 0xc7d7, 0xa03d, 0x204e, 0xb5db, 0x3e7e, 0x294a, 0xc1b7, 0x4b74, 0x61ac, 0x8ddf, 0x215a,
+    0xc593, 0xe349, 0x966b, 0xa74f, 0xdc8d, 0x7ab4, 0xae29, 0xba09, 0x3010, 0xa8f1, 0x6f52, 0xcde5, 0xb2e9, 0x57e2, 0xb9df, 0x381e,
+    0xcde3, 0x51d4, 0x2a2c, 0x7f78, 0x5da4, 0xc6a7, 0xa4ab, 0x9455, 0x4396, 0x27b2, 0xd917, 0x5446, 0x26c0, 0x6092, 0x2136, 0x5a86,
+    0xbb5d, 0x8a43, 0x76fa, 0xe657, 0x1f42, 0x4cc2, 0xdf6f, 0xa643, 0x3ec0, 0xd8f9, 0xc917, 0x5134, 0x3130, 0xb3c9, 0x6d44, 0xd05f,
+    0x94db, 0x3082, 0xb733, 0xdefd, 0x8635, 0xa461, 0x3a36, 0x1862, 0x873d, 0xcd85, 0x4bdc, 0x6810, 0xde91, 0x9ea3, 0x874f, 0x60a6,
+    0x25d8, 0x9207, 0x7126, 0x5860, 0x7d68, 0xbbbb, 0x51e4, 0x2efa, 0xd513, 0x1b48, 0x5760, 0xcec5, 0x9929, 0xe2b7, 0x77c8, 0x4bae,
+    0x9707, 0x5788, 0x228c, 0x477c, 0x1a8a, 0x5064, 0xb891, 0x314e, 0x90cd, 0x7832, 0x3932, 0x9b91, 0x6cc6, 0x8ee5, 0xc5bb, 0x59ee,
+    0x371e, 0xcdf9, 0x6098, 0x82fb, 0x4794, 0x7174, 0x71be, 0xa069, 0x81f3, 0x5350, 0xaf43, 0x17ea, 0x4544, 0x9509, 0x7654, 0xc715,
+    0x645e, 0x3f58, 0xb861, 0xd789, 0x4d3c, 0x5e06, 0xe6f9, 0x81cb, 0xd053, 0x2870, 0xc221, 0x32fc, 0x21f2, 0x7e2a, 0x3054, 0xa6cf,
+    0x1a6e, 0x5a9a, 0xd3dd, 0x8629, 0x953d, 0xc499, 0xd35d, 0x7a58, 0x1a6c, 0xd62d, 0x77b0, 0x9b71, 0xb411, 0x3930, 0x7bd8, 0xe193,
+    0x57dc, 0x66ee, 0xd29f, 0xc23f, 0x4064, 0x546a, 0x9cfd, 0x19ea, 0x48d2, 0x8a0d, 0x3df2, 0x6de8, 0xaee3, 0x238e, 0x72f8, 0x5a36,
+    0x9c57, 0x2672, 0xabff, 0x718e, 0x5990, 0xdbd9, 0x3302, 0x657e, 0xdd75, 0xab87, 0xd44d, 0xc1a7, 0xcbef, 0x79a8, 0x6622, 0xcc97,
+    0x9901, 0x35b8, 0xcb3d, 0x2122, 0x9603, 0x8497, 0xd9a9, 0x8edf, 0x527a, 0xa6a1, 0x325a, 0xd2b3, 0x7d46, 0x4be4, 0x224a, 0xdc07,
+    0x6d8e, 0xc18b, 0x22be, 0x618c, 0x7612, 0x0e7e, 0x3174, 0x6400, 0xc333, 0xcd75, 0x944f, 0xabfb, 0x3544, 0xa0d5, 0x60a4, 0xde3d,
+    0x8bf7, 0xba25, 0x32d4, 0xafcf, 0x2c14, 0xc94d, 0x9013, 0xa2ad, 0x7a26, 0xcaa1, 0x8717, 0xc045, 0x2866, 0x7448, 0x199a, 0xd2e7,
+    0x9065, 0xb055, 0x1d20, 0xcd73, 0x4234, 0x8f63, 0x5bb8, 0x7756, 0x1fd0, 0x4042, 0x7162, 0x4ee0, 0xcbe3, 0x643a, 0x80e7, 0xb8c3,
+    0x5658, 0xc79b, 0xc09d, 0x9111, 0x6224, 0xcfb9, 0x4a46, 0x54a2, 0xe02b, 0x83a1, 0x97cb, 0xe843, 0xa2e7, 0x5816, 0xdae1, 0x8159,
+    0x6108, 0x3786, 0x7142, 0x4782, 0x2d54, 0xd0f3, 0x9c57, 0x5680, 0x74fc, 0xc39f, 0x59f2, 0x416a, 0x9c2d, 0x248c, 0x655a, 0x8dd3,
+    0x23de, 0xc48d, 0x6a34, 0xb407, 0x23e0, 0x38d2, 0x7628, 0xe8a3, 0x6c8e, 0xa6fd, 0x615e, 0xcd07, 0x3c10, 0xafe5, 0x8e0d, 0x3c3a,
+    0x4f28, 0xcd3d, 0x35c4, 0xb319, 0x9967, 0x6b50, 0x8cd9, 0x7e94, 0xb739, 0x69ba, 0x224a, 0x9d1f, 0x9181, 0xdfa1, 0x2378, 0x8815,
+    0xadcf, 0x33b8, 0x69de, 0x5b88, 0xc60b, 0x74c4, 0x9911, 0xbd65, 0x586c, 0xe77b, 0xa1b5, 0x2c9a, 0x7efe, 0xd09f, 0x3cb8, 0x54a4,
+    0xe293, 0x50c8, 0xd27b, 0x1f38, 0xa123, 0x44f6, 0x72c2, 0x8641, 0xbff5, 0x42e2, 0xa22d, 0x8755, 0x32a6, 0x686c, 0x875f, 0x235c,
+    0xd2bf, 0xc0f3, 0x7832, 0xd533, 0xe479, 0x99c1, 0xadc9, 0x3a0e, 0x5f8e, 0xc435, 0xb6e7, 0xcdfd, 0x1a44, 0xe4e9, 0x4fd6, 0x7c6e,
+    0xb43b, 0x6d0c, 0x274e, 0xa6c1, 0x1c30, 0x36be, 0xb0dd, 0xe9ff, 0x2502, 0xd695, 0xae73, 0x6610, 0xcc51, 0x62ac, 0xddcb, 0x2272,
+    0x8eb1, 0xaa2b, 0x821d, 0x1ae4, 0xc463, 0x8b4d, 0xb563, 0x327a, 0x73a6, 0xb797, 0xa8f5, 0x559c, 0xac3b, 0x7538, 0x4bf4, 0xe31b,
+    0x8f03, 0x4540, 0x73aa, 0x50fc, 0x39f4, 0x6702, 0x4998, 0x9e01, 0xc833, 0x2b68, 0x3996, 0x508e, 0xe473, 0x6526, 0xc855, 0x2e5c,
+    0xc21b, 0x7956, 0x543c, 0xa9f7, 0x73ae, 0xe3bd, 0x9a57, 0xb039, 0x78d4, 0xc215, 0x2bfa, 0x8299, 0xdd13, 0x3612, 0xc06d, 0xe859,
+    0x8619, 0x5124, 0xceff, 0x8faf, 0x149c, 0xccbb, 0x9ff9, 0x8c3b, 0x5732, 0x39be, 0x6138, 0x9a3f, 0x5b9c, 0x1ff0, 0xa103, 0xde89,
+    0x3eee, 0x85a9, 0x69f2, 0xdf8f, 0x7516, 0x2c04, 0x648a, 0x396c, 0xc7f9, 0x861b, 0x57c6, 0x482a, 0xd1a9, 0xa8f1, 0xb251, 0x446c,
+    0xa52f, 0x5a62, 0x47f8, 0xb5df, 0xe86f, 0x8c05, 0xb001, 0xeb7f, 0x838d, 0x25a8, 0x478a, 0xd37b, 0x5856, 0x878d, 0x2788, 0x1850,
+    0x92cb, 0x4074, 0x4d30, 0x8a2f, 0x60d0, 0x7d42, 0x1c0e, 0x5f6c, 0xdf41, 0x389e, 0x672a, 0x5c06, 0x98c9, 0xb859, 0x362c, 0x5ee4,
+    0x7af2, 0x9ce5, 0x4f32, 0x6204, 0x34ee, 0xc09d, 0x2a1e, 0xba1b, 0xca73, 0x63d6, 0x9255, 0x18e6, 0xb15d, 0xddab, 0x417c, 0xd765,
+    0x1c44, 0x760e, 0x4424, 0x2d78, 0x5110, 0xa2ab, 0x80bd, 0x30a8, 0xc1dd, 0x72b2, 0x5244, 0x3980, 0x6cbe, 0x2a32, 0xa871, 0xc013,
+    0x9e5b, 0xac7b, 0x25be, 0xc2df, 0x8673, 0x5506, 0x3c0a, 0xc82b, 0x440c, 0x1ed4, 0x95d9, 0xb977, 0x8659, 0xe36d, 0x4cce, 0xa897,
+    0x79f2, 0xe061, 0x481e, 0xa9c9, 0xdf3f, 0x8603, 0x2b5c, 0xcc3d, 0x4414, 0x7f0e, 0x1508, 0x8c47, 0x79ea, 0xc9d3, 0xdd61, 0x9ab9,
+    0x7a28, 0x19ec, 0x5d88, 0x916b, 0x4984, 0xb675, 0x24f8, 0x59d0, 0x4894, 0x2832, 0xaadd, 0x7d04, 0x6266, 0x39ca, 0x5208, 0xde53,
+    0xc465, 0x134e, 0xa173, 0x88dd, 0x1cc2, 0x4efc, 0xde5d, 0x6b4c, 0x379e, 0x2206, 0x775e, 0xb12d, 0x5964, 0x28be, 0xc16b, 0xa2e3,
+    0xc107, 0x8151, 0x383c, 0x8945, 0xd219, 0x3ac8, 0xd789, 0xa18f, 0x6148, 0xe019, 0x7706, 0xb389, 0x2cd8, 0xca37, 0xb35d, 0x6c5c,
+    0x41b8, 0x9c55, 0x65be, 0xb02b, 0x375e, 0x6760, 0xc7e9, 0x237e, 0xd459, 0x511a, 0x7f34, 0x31ae, 0x53c0, 0xbc8d, 0x227e, 0x9d57,
+    0xe3ab, 0x44fa, 0x8d95, 0xe837, 0xc103, 0xc731, 0x5898, 0x603a, 0x29dc, 0x92c3, 0x7926, 0x8aad, 0x2a02, 0xb8d3, 0xafa7, 0x3692,
+    0x7aba, 0xe893, 0x3066, 0x68ec, 0xa9bd, 0x24fa, 0x6394, 0x9acf, 0x4ac0, 0x6bc0, 0xdd51, 0x4978, 0xdb77, 0x92f3, 0x5ea0, 0x4522,
+    0xc55f, 0x9dcf, 0xb491, 0xd24b, 0xe093, 0x2830, 0xb1bf, 0x6080, 0xa967, 0x6864, 0x8c89, 0x9e6d, 0x232a, 0x6d8e, 0xa9d5, 0x8411,
+    0xdfe1, 0x2d40, 0xe0cf, 0x38ba, 0x85e5, 0xc963, 0x2b1e, 0x5dfc, 0xea0f, 0xb1b3, 0x53e4, 0x9cd3, 0xcbeb, 0x606a, 0x907d, 0x25be,
+    0x681e, 0xafeb, 0x3498, 0xe053, 0x3ef6, 0xb3cd, 0x7268, 0x2486, 0xc339, 0x7a6e, 0x6e1c, 0x34d2, 0xe4df, 0x91b9, 0x3036, 0x701c,
+    0x46fe, 0xc13d, 0xa987, 0x5a52, 0x43d0, 0xc443, 0xe06b, 0xae61, 0x75aa, 0x1c3c, 0xe06d, 0xb38f, 0x93a1, 0x6b40, 0x3148, 0x8017,
+    0x7e54, 0xd54f, 0x99e5, 0x2c3e, 0xc2cf, 0x58ae, 0x3f5a, 0x9c27, 0x499c, 0x76f2, 0xaf5d, 0x74a8, 0xd887, 0x7d40, 0xc1b9, 0xb599,
+    0xd33d, 0x7cee, 0xd99f, 0x7528, 0xa613, 0x45e4, 0xdaa5, 0xb9e5, 0x5068, 0x93d7, 0xb289, 0xdbfd, 0x4976, 0x85ab, 0xac1d, 0xe665,
+    0x348a, 0x6bdc, 0xcc41, 0xa9c9, 0x858b, 0xe773, 0x6cfe, 0x9ed9, 0x5466, 0x84b9, 0xeb7b, 0xbc6f, 0x7e02, 0x69f0, 0x2176, 0xaad5,
+    0x8739, 0x6700, 0xa189, 0xd35d, 0xb84d, 0xde49, 0x3d66, 0x6478, 0xaebd, 0x165a, 0xd09d, 0xb7f5, 0x8b2f, 0xc8a9, 0x1a42, 0x3e94,
+    0x5222, 0x6b8e, 0xd951, 0xa9b1, 0x6380, 0x1632, 0xe321, 0x9041, 0xad59, 0x6d7a, 0xdfa1, 0x4bd2, 0x2a44, 0x72bc, 0xcfeb, 0x88a9,
+    0x58a2, 0x3c34, 0x9115, 0x540e, 0xc17b, 0x65ee, 0x9bd1, 0x5a40, 0xb43d, 0xc1eb, 0x9913, 0xeb7f, 0xa277, 0x5278, 0x3260, 0x6ff8,
+    0xe0ed, 0xb9ab, 0xc40b, 0x5dd8, 0xd6f3, 0x372a, 0xcba1, 0xb739, 0xdd27, 0x98f7, 0xecad, 0x48ac, 0xccb9, 0xb62d, 0x7af0, 0x8cd1,
+    0x6306, 0x4384, 0xe99f, 0xbc5d, 0x38d4, 0xc9f3, 0x3046, 0xb28b, 0x869d, 0x962f, 0xc543, 0x3f2e, 0x9059, 0xa857, 0x7340, 0x3d0e,
+    0x286a, 0x70f0, 0xac35, 0x62e8, 0xc701, 0x646e, 0x1bc8, 0xa8e9, 0x2408, 0x7c5e, 0xc861, 0x51a2, 0x9d01, 0x4498, 0x59ca, 0xc42b,
+    0xe0c3, 0x176e, 0x8879, 0xc72b, 0x27f8, 0x8275, 0x730e, 0xa0b9, 0x8a8b, 0x29c2, 0x9d4b, 0x650a, 0xb053, 0x8ecf, 0x3c26, 0x66e0,
+    0xc58b, 0x2c06, 0x7378, 0x5610, 0x98d7, 0x4020, 0x8c2b, 0x849b, 0xb5ef, 0x4750, 0xc4b5, 0xe2c7, 0x3eaa, 0x9b91, 0x6c3e, 0xc475,
+    0x4c60, 0xbb4b, 0x59b2, 0xcec5, 0x7a12, 0x4690, 0xc16b, 0xd72d, 0x3d4c, 0x8e9f, 0x2e1e, 0x8277, 0xb45f, 0x1b26, 0xa463, 0xcf89,
+    0x867b, 0x2254, 0x2d66, 0x6426, 0xa6c3, 0x8077, 0x9489, 0x4d3c, 0x32da, 0xc071, 0xe06f, 0x6232, 0xcc5b, 0xc19b, 0x3200, 0x3c7e,
+    0xb881, 0x9969, 0x940b, 0x5efe, 0x1dbc, 0x7b7c, 0x42cc, 0x3642, 0x85c7, 0xd13f, 0x4174, 0x1868, 0x7a0a, 0x447e, 0xa68d, 0xd295,
+    0x397c, 0x4640, 0x60a8, 0xa667, 0x5900, 0x8123, 0x4e6a, 0xe5b7, 0xacc9, 0x295e, 0xd995, 0x8975, 0x481a, 0xb30d, 0xc157, 0x875b,
+    0x1dda, 0x9c61, 0x2abc, 0xc7f9, 0x91db, 0xa84b, 0x2376, 0x4538, 0x97af, 0xbfd5, 0x80bb, 0x5f84, 0x228a, 0x4862, 0xd54d, 0x5e2c,
+    0x1b7e, 0xb08f, 0x7130, 0x38a6, 0x7d0a, 0xa3ad, 0x6a4a, 0xc8cd, 0x1e70, 0xbfed, 0x3a4e, 0x949f, 0x2336, 0xa585, 0x4ac6, 0x3982,
+    0x6600, 0x9fa9, 0x204a, 0xb9e9, 0xcb63, 0x316c, 0xaefb, 0x6ca6, 0x3b0c, 0x8337, 0x1494, 0x2ba6, 0xbff9, 0x69d0, 0x8f45, 0x57e6,
+    0xb155, 0x444e, 0xd663, 0x2406, 0x9111, 0x4bca, 0x192c, 0xd8ab, 0xab3f, 0x35bc, 0x2e36, 0x9cf1, 0x4756, 0x2f32, 0x950f, 0xc7a7,
+    0x5056, 0xe76d, 0x6db8, 0x2226, 0x7690, 0x2bb8, 0x6db4, 0x93cf, 0xed1f, 0x28a8, 0x9f37, 0x6364, 0x49b0, 0xe23d, 0x7732, 0x9339,
+    0xe871, 0x3060, 0x7e1c, 0x44c6, 0xb3f3, 0x963d, 0x74f0, 0xa1a9, 0x2dbc, 0xd04b, 0x8d61, 0x5e72, 0xad8b, 0x3cb0, 0xbcbf, 0x1b0a,
+    0xb859, 0xd2d3, 0x72d0, 0x2080, 0x7d1c, 0x469c, 0xd479, 0x34ea, 0x73bc, 0x287a, 0x6242, 0x3964, 0x41d4, 0x1e66, 0xb9f3, 0xa697,
+    0x27b4, 0x867d, 0x3ce6, 0x802f, 0x7662, 0x9e2b, 0x86fd, 0x3ff0, 0x73c8, 0x5288, 0x88c7, 0xbafb, 0x4cec, 0x1ace, 0xa30f, 0x2d02,
+    0x4e54, 0x9961, 0x72f8, 0x5d70, 0xafbb, 0x94ad, 0x7510, 0xa939, 0xd689, 0x5ca6, 0x4826, 0xdb01, 0x85b7, 0x5444, 0xe0e7, 0x811b,
+    0xca2d, 0x5db6, 0x985f, 0x2ff6, 0xe871, 0x527c, 0x8ded, 0xc9ab, 0x44b4, 0x34e8, 0x8b4d, 0x1ae0, 0xeab7, 0x75f0, 0x9257, 0x3494,
+    0x7e16, 0x4bda, 0x4786, 0x99f3, 0x54a6, 0xde0d, 0x4026, 0xb54f, 0x63da, 0xe39b, 0xc19b, 0x4bfa, 0xd945, 0x76e6, 0xcffd, 0xaaa5,
+    0x9615, 0x1698, 0xd4c5, 0x8981, 0x612a, 0x1a64, 0xd223, 0xe2cf, 0xa41d, 0x3018, 0x5988, 0x1822, 0x792c, 0x532e, 0x2d86, 0x88c5,
+    0x5b58, 0x2194, 0x9887, 0x3fce, 0x9b45, 0xdc95, 0x8179, 0x1d5e, 0xaaf9, 0xd527, 0x76f8, 0x5bc4, 0x3bae, 0xb8c1, 0x6e80, 0x2acc,
+    0x587a, 0xd7e1, 0x7b76, 0x92c5, 0x19b6, 0x3ab4, 0xe849, 0xd2e9, 0x7f20, 0x9281, 0x3db0, 0x7cfc, 0x27da, 0x9283, 0x541a, 0x6b28,
+    0x67f8, 0x3bf6, 0x550e, 0xced3, 0xb49f, 0xda0b, 0x9e6f, 0xb9ab, 0x24ba, 0x6956, 0x93ab, 0xbc51, 0xe485, 0x2e74, 0x5574, 0xb09d,
+    0x8a25, 0xc9cf, 0x96f5, 0x832d, 0xc66b, 0x39b8, 0x6a5e, 0xbb59, 0x465a, 0x90db, 0xbbdf, 0xc891, 0x158c, 0x6738, 0x5efa, 0xd299,
+    0xe25f, 0x7f9c, 0x60c0, 0x3c5a, 0x7abe, 0xba4b, 0x6960, 0x5b02, 0x3e06, 0xd05f, 0x5338, 0x3390, 0xc75d, 0xa51d, 0xc29f, 0x9af1,
+    0xe2f5, 0x47ba, 0x96b1, 0xd895, 0x262c, 0xcd75, 0x2e48, 0x617e, 0xa25d, 0x9011, 0xe02f, 0x62c6, 0x3d22, 0x998d, 0x8629, 0xdff9,
+    0x5e52, 0x8c39, 0x23f6, 0x3a30, 0x5874, 0x7630, 0x9a4d, 0x25e2, 0xd3a3, 0xce8f, 0xa2b5, 0x5fe8, 0xd261, 0x6dae, 0x2372, 0xc593,
+    0x2766, 0x8601, 0x7c98, 0x53f6, 0xb5ef, 0xa679, 0x6484, 0x3364, 0x782c, 0x5bdc, 0xc349, 0x6a94, 0xd649, 0x81f3, 0x6230, 0xcef9,
+    0x2b4a, 0xabff, 0x3aae, 0xbd09, 0x6140, 0xc0cd, 0xa31b, 0x53b8, 0xc909, 0x582e, 0x8cf1, 0x39e2, 0x1eb0, 0xaefb, 0x5d8e, 0x38cc,
+    0xd43d, 0x882d, 0x5cbc, 0xd001, 0x4f72, 0xbf71, 0x7ede, 0x39ee, 0x50e0, 0x9ba3, 0x15f8, 0x7918, 0xe191, 0x9313, 0x5280, 0x6430,
+    0x9bd7, 0x30ea, 0x8cbb, 0xca71, 0xb569, 0x1b4e, 0x927f, 0xa957, 0xe327, 0x533a, 0xc625, 0xb587, 0x7168, 0xd387, 0x8779, 0x45fe,
+    0x5dd0, 0x54d2, 0xa2cb, 0xcf03, 0x1e6a, 0x65a2, 0x4f9e, 0xc665, 0xa347, 0x1d0e, 0x605a, 0x31c0, 0x9b67, 0x6ccc, 0xe92d, 0xb443,
+    0xcbed, 0xd76d, 0x2d54, 0x7df0, 0xdd19, 0x642e, 0x4626, 0x2c50, 0x1d3e, 0xb9e3, 0x6844, 0x9d9d, 0x1a5c, 0xb31f, 0x5f0e, 0x20a8,
+    0x9ba5, 0xd679, 0x3ecc, 0xb02f, 0x8727, 0x4096, 0x78f0, 0xb29f, 0x6cce, 0xd13b, 0x9a41, 0x5910, 0xb0ff, 0x2774, 0xd41b, 0xa86d,
+    0x663c, 0xb831, 0xd039, 0x79a8, 0x22c4, 0xbdf5, 0x4e1c, 0xce17, 0x1a5e, 0x71c0, 0x3f56, 0x8c4b, 0x2cbc, 0x7562, 0x2150, 0x4d2a,
+    0x839d, 0x5d72, 0xb357, 0xbb13, 0x3ba8, 0x9e91, 0x7490, 0x2818, 0x4b06, 0x6bf6, 0xcfc3, 0xa741, 0x7990, 0xe327, 0xcebb, 0x9ca3,
+    0xb56f, 0xd6b1, 0x8a37, 0x62be, 0xb1eb, 0x2ce8, 0x852f, 0x5434, 0x7592, 0xc09f, 0x210e, 0xa149, 0xeba1, 0x4cc6, 0x7680, 0x9c4f,
+    0xb55f, 0x6fb6, 0x485c, 0xcae9, 0xbd19, 0x5a1c, 0x6ec2, 0x2a64, 0xc0ad, 0x1988, 0x6dd6, 0xb9a5, 0x470a, 0xa347, 0xe489, 0x143e,
+    0xda33, 0xc06d, 0x23a0, 0xa60b, 0x44cc, 0x66bc, 0x5900, 0xad4f, 0x7972, 0xd60f, 0x385a, 0x8c89, 0x7474, 0xca3d, 0x97a5, 0x1f0c,
+    0x7110, 0xd549, 0x2b7a, 0xb51f, 0x244e, 0xd997, 0x9ce3, 0x3088, 0x5c30, 0x5862, 0x3616, 0x50b2, 0x7ac4, 0xa8c3, 0x32ea, 0x51d2,
+    0x42fc, 0x930f, 0xbabd, 0xd8dd, 0x1fb2, 0x5060, 0x8691, 0xeee5, 0x90e7, 0x2c6a, 0xa85b, 0x8477, 0xe6d9, 0x7b8c, 0x4e4c, 0x381e,
+    0x68ac, 0x2d24, 0xc531, 0x6880, 0xa7b7, 0x4f30, 0x8bbb, 0xe1d5, 0x70b6, 0x387c, 0x5808, 0x8105, 0xb821, 0xc9b1, 0x5514, 0x30e4,
+    0xae43, 0x83e9, 0xd979, 0xa26f, 0xe769, 0x60c6, 0xc19b, 0x9001, 0x6358, 0x5508, 0x760e, 0x9177, 0x4a28, 0x34be, 0xd935, 0xb413,
+    0x6254, 0xa2eb, 0xe267, 0x2a54, 0x39a8, 0xd777, 0xc819, 0x892b, 0xb47d, 0xd86d, 0x906b, 0x1f84, 0xbb01, 0x5a20, 0xb105, 0x742a,
+    0x3ebe, 0x80d9, 0x9467, 0x57b2, 0x86b9, 0xd525, 0x22aa, 0xabcb, 0x4504, 0x78ce, 0xd8a1, 0xc359, 0x9bbb, 0x836f, 0xc0e1, 0x71d4,
+    0xb3bb, 0x2736, 0xa91d, 0x75da, 0x1f04, 0x3346, 0xc8a7, 0x5d72, 0xe573, 0xbb47, 0x3522, 0xc5b1, 0xa5fb, 0x2326, 0x85e9, 0xe055,
+    0x4f30, 0xaa4b, 0x5998, 0x42f0, 0xe911, 0xc68f, 0x6a78, 0x3df8, 0x8a19, 0x9629, 0x21c8, 0xd861, 0x8351, 0x9301, 0x6090, 0xc9ef,
+    0xa249, 0xe83d, 0x2abc, 0x4948, 0xb68b, 0xe577, 0x34d0, 0x933f, 0x2b3a, 0xd141, 0xb309, 0x8f15, 0xd941, 0x613c, 0x81b5, 0x3fbc,
+    0x3338, 0x7dac, 0xb8f5, 0x1940, 0x3eec, 0x9bdb, 0xc9f9, 0x7388, 0x8a99, 0xcf9f, 0x7f1a, 0x3190, 0x6ba8, 0xd881, 0x365a, 0xa0af,
+    0xbf47, 0x6826, 0x4d60, 0x7b5a, 0x2832, 0xd1f3, 0xa2cd, 0x23f6, 0xdaad, 0x8ae7, 0x40d4, 0x7218, 0xc2bd, 0x8215, 0x4ccc, 0xb9af,
+    0x2452, 0x837f, 0x3c60, 0xe4e9, 0xb069, 0x9373, 0x7aa6, 0x3692, 0x8e95, 0x5b2a, 0xcd63, 0xa381, 0x61e6, 0xcb3f, 0xb2cf, 0x3c3c,
+    0xe749, 0xcd2b, 0x49b6, 0x2e86, 0xdf27, 0x5eb4, 0xc60b, 0x761a, 0x98bf, 0xdee9, 0xb80b, 0x8e1b, 0x4990, 0xb9a9, 0x2716, 0x6844,
+    0x4308, 0x2d38, 0xc441, 0x4f00, 0x3772, 0xc563, 0x4c0c, 0xa8b9, 0xe255, 0x44de, 0x4c5a, 0x6d28, 0xd30d, 0x8e69, 0x4e92, 0xd995,
+    0x3dc6, 0xa8ed, 0xe727, 0x559c, 0x7452, 0xb0fb, 0xa0d5, 0x4326, 0xae35, 0x58be, 0xa529, 0xdb83, 0x66dc, 0x79a4, 0xc9b1, 0x8d3b,
+    0x44b0, 0x8485, 0x7164, 0xdc3f, 0x82c7, 0x1ca2, 0xdeef, 0x939d, 0xc269, 0x21a4, 0x48de, 0xb41b, 0x5920, 0x4056, 0x82fb, 0xd863,
+    0x5b30, 0x3432, 0x8b27, 0x4c9e, 0x5a68, 0xaf65, 0x92f1, 0xcce3, 0x7d54, 0xc99f, 0x9f61, 0x92d3, 0xe301, 0xd87b, 0x9fff, 0xb34d,
+    0x6e74, 0x2fd2, 0xc217, 0x619a, 0x99ab, 0xd0a1, 0x35a6, 0xc853, 0xa539, 0x6e5c, 0xbba3, 0x1ddc, 0x3d7a, 0x86fd, 0x25dc, 0xcbb7,
+    0xa41f, 0x7b78, 0x8613, 0x58c0, 0xbad9, 0x750a, 0x422a, 0xb4e7, 0x2630, 0xbecf, 0xafcb, 0xd2e3, 0x1c8e, 0x29dc, 0xd423, 0x72e2,
+    0xbf11, 0x4866, 0xb41b, 0x7404, 0x8b07, 0x150c, 0x4706, 0xdfc3, 0x324c, 0xb7c5, 0x4040, 0xeabb, 0xa82f, 0x7b50, 0x9e7b, 0x52c8,
+    0x8223, 0x4552, 0xc4c3, 0x8fdf, 0x5060, 0x797a, 0x63c0, 0x3d26, 0x20be, 0x49be, 0x75ae, 0x9d77, 0x40ee, 0xe4c3, 0x8e4d, 0x1918,
+    0xd8a3, 0x6c14, 0xb91d, 0xdc9f, 0x46bc, 0x987d, 0x3386, 0x62a8, 0x8489, 0x9c4b, 0x3496, 0x6c9e, 0xe7e1, 0x4f36, 0x309e, 0x98e3,
+    0x4ac6, 0x5a48, 0xc33b, 0x9dc1, 0xe3c9, 0xa3c9, 0x89fb, 0x2084, 0xad03, 0x6e1a, 0x7e94, 0x4138, 0x5730, 0x6c90, 0xcf07, 0x3f5c,
+    0x7d92, 0xd9f5, 0x6d46, 0x819f, 0x315a, 0x7760, 0x5a78, 0x275e, 0xbc39, 0x5c7a, 0x81c7, 0x4268, 0xa35f, 0x28b4, 0xb3a1, 0x32ee,
+    0x7ac0, 0xc181, 0x6e0e, 0x94b1, 0x5ec2, 0xb0c1, 0x8d85, 0x47e6, 0x7a64, 0xe7e3, 0x526a, 0x37ae, 0x76be, 0xc059, 0x2954, 0x8fe1,
+    0x645a, 0x52ee, 0xb195, 0x9535, 0x638e, 0x315a, 0xb609, 0xe21d, 0x51ca, 0x3c50, 0xaa8f, 0xe905, 0x5c8a, 0xc509, 0x7906, 0x4af6,
+    0x85c5, 0x1838, 0xddb9, 0xc8b3, 0xa443, 0x65ec, 0xc7a1, 0x52c4, 0x30b0, 0xa74d, 0xb94b, 0xd663, 0x3216, 0x5fd0, 0x39ee, 0x75f6,
+    0xdb85, 0x5d88, 0x9a03, 0x4772, 0x62b4, 0x62de, 0xa58f, 0xc3e1, 0x7794, 0xb657, 0x8653, 0x1d84, 0xddcf, 0x8eab, 0x464a, 0x9765,
+    0x266e, 0x6e48, 0x7710, 0xa0bf, 0x935f, 0x4494, 0xb77f, 0x1fb8, 0x3944, 0x859b, 0x1f48, 0x2e0e, 0x5e06, 0x3fe4, 0xa26b, 0x5e7c,
+    0xe8a5, 0x7798, 0xa6a5, 0x915d, 0xe3a1, 0x75fa, 0x60e4, 0x9bbd, 0x32ee, 0x800f, 0xbfcd, 0x96bd, 0x27c8, 0xab1b, 0x1db8, 0xc79f,
+    0x5856, 0x1af6, 0x8ae1, 0x9e11, 0x266e, 0x35f4, 0xdb25, 0x6710, 0x8c6f, 0xdf7f, 0x2f9e, 0x43ce, 0xc699, 0x1f50, 0x353e, 0xa6ed,
+    0x27a4, 0xb681, 0x4f66, 0x3456, 0x6122, 0xbab9, 0x3fe6, 0x2b1a, 0x59f4, 0xa29f, 0x8113, 0xcabd, 0x2636, 0xa279, 0xc225, 0x5028,
+    0x9f63, 0x6850, 0xedff, 0xa987, 0x6e3c, 0x3df0, 0x4e5c, 0x1b04, 0x8079, 0xe98d, 0x2040, 0x6c56, 0x3d94, 0x2556, 0x7b98, 0x28ae,
+    0xd619, 0x8ac3, 0x47ec, 0x71d8, 0x4220, 0xae19, 0x784e, 0x15de, 0x408e, 0x6264, 0xe08d, 0x9d21, 0x58b8, 0x713c, 0xd9eb, 0xb06d,
+    0x5174, 0xb77d, 0x1c24, 0xd227, 0x2a3a, 0x933d, 0xcffb, 0x85cd, 0x5dca, 0x9d99, 0x43a8, 0x8dc3, 0x681a, 0x77bc, 0xa7eb, 0x8df7,
+    0x1f0a, 0x5cda, 0x326a, 0x4906, 0xd261, 0xa291, 0x37b4, 0xb6e5, 0x8171, 0x9df1, 0x27a4, 0xb109, 0x1c44, 0x5b7e, 0xb4ef, 0x2d54,
+    0xe09f, 0x34bc, 0x69ce, 0xb437, 0xc9cd, 0x1b04, 0xe53d, 0x95ed, 0xba59, 0xa061, 0xe015, 0x347a, 0x5c2a, 0x969b, 0x2760, 0x6a14,
+    0xcbb9, 0x9df1, 0x2690, 0x1d14, 0x71dc, 0x6e00, 0xdbf5, 0x9353, 0xe017, 0x25b2, 0xb16f, 0x4a0e, 0xa5e1, 0x19ca, 0xcc99, 0x9037,
+    0xd973, 0x20ca, 0x7892, 0x3820, 0x5394, 0x647e, 0x4726, 0xd625, 0x926f, 0x516a, 0xd203, 0x2dc2, 0xbec1, 0xa9af, 0x9045, 0x314c,
+    0xbead, 0x2d3c, 0xb55f, 0xa389, 0x53c6, 0x9d29, 0xaf79, 0xdc03, 0xd813, 0x7a88, 0x3330, 0x634a, 0xc20d, 0x4de4, 0xdd81, 0x3ea0,
+    0xa665, 0x1f1c, 0x8431, 0xc697, 0x4126, 0x7626, 0xd883, 0xbc09, 0x5c9a, 0x6fce, 0xb839, 0x9f87, 0x1a50, 0x4778, 0xb79b, 0xe3d7,
+    0xa62f, 0x222c, 0xe99f, 0xc92d, 0x5370, 0xd359, 0x8519, 0x2212, 0x9735, 0x5e48, 0x26ee, 0x897d, 0x9939, 0x3ea6, 0x9a13, 0xcccd,
+    0x616c, 0x6ca0, 0x37f4, 0x8e63, 0x4164, 0x6a94, 0x3ada, 0x9227, 0x7366, 0x4858, 0x13bc, 0x51fc, 0xa2e3, 0xe32d, 0xb599, 0x9a8d,
+    0xc64f, 0x2cac, 0x7eea, 0xc375, 0x1e7e, 0xd343, 0x24ee, 0x3ff6, 0xe6a5, 0x4bba, 0xa6c1, 0x31e0, 0x51a2, 0xb0ef, 0x68a4, 0xc283,
+    0x922b, 0xa881, 0x3cea, 0xda1b, 0x6446, 0x803f, 0xe055, 0xaaab, 0x6262, 0xbe9b, 0x55ca, 0xe4cb, 0xaa4b, 0xd32b, 0x8463, 0x8c93,
+    0xb5eb, 0x1498, 0x6698, 0x37fc, 0xac4d, 0x2106, 0xb19b, 0xca51, 0x1a4a, 0x70e2, 0xdf49, 0xabeb, 0x3508, 0x6658, 0x81af, 0xa167,
+    0x733c, 0x2d64, 0x9037, 0x67fa, 0xd3d3, 0x7f5c, 0x9937, 0xc47d, 0x261e, 0x7bb6, 0x6a76, 0x97c1, 0x8a69, 0xa969, 0x5ec6, 0x6fe2,
+    0x8f3b, 0xeeed, 0xa50b, 0xc5f9, 0x952d, 0xb837, 0x7a74, 0x9455, 0x6f08, 0xdc0b, 0x41d0, 0x978d, 0xdbd5, 0x35a0, 0x86b7, 0x2476,
+    0xafa9, 0x4664, 0xb821, 0x7fc6, 0x2f46, 0xe02f, 0xcf99, 0xb3db, 0x42e4, 0xa6e5, 0x31da, 0xb671, 0x655c, 0x491a, 0x98ef, 0xbb79,
+    0x6748, 0xa845, 0x1c80, 0xe63d, 0x8e9b, 0x69a2, 0xdc1f, 0x5746, 0xbd3f, 0x7c1c, 0x4ea0, 0xd48b, 0xb587, 0xc229, 0x8431, 0x2a96,
+    0x5dac, 0xe535, 0x3f92, 0xa127, 0x6412, 0x376a, 0xe589, 0x5174, 0x1994, 0xd8a9, 0x2b2e, 0x4fa0, 0xec21, 0xb7a7, 0x5a40, 0x3ed8,
+    0xdccd, 0xcfe9, 0x90fb, 0x2380, 0xbe07, 0x6864, 0x771e, 0xd355, 0x5678, 0x740e, 0xc669, 0x6eda, 0x8485, 0xd309, 0x44f8, 0xc1af,
+    0x8081, 0xa42d, 0x1cd0, 0x5eee, 0x9adf, 0x6e4a, 0xab8b, 0x2c52, 0x6a8c, 0x52be, 0x8331, 0xc979, 0x7692, 0x49d0, 0xa71f, 0xc153,
+    0x55d6, 0x4928, 0x8f25, 0xcdc9, 0xaeaf, 0x5a04, 0xbce7, 0x28f8, 0x50be, 0xc8c9, 0x63ca, 0x6e32, 0x3bd8, 0x8b69, 0x6994, 0xa519,
+    0x5342, 0xc4d3, 0x971f, 0xd771, 0xb0cf, 0x8cb5, 0xb673, 0x75d6, 0x281c, 0xbbef, 0x6bbc, 0x8b11, 0xea85, 0x1ac2, 0x6126, 0xaed9,
+    0x794c, 0x8a25, 0x17f0, 0x4666, 0xddfb, 0xc5f3, 0x37e2, 0x1a90, 0x49fc, 0xa50b, 0xb2a1, 0xe755, 0x7c8c, 0x1b74, 0x6b76, 0x8e05,
+    0x62c2, 0xd30b, 0x54ce, 0x33e2, 0xd80b, 0x21fe, 0x63a8, 0x1a10, 0x9a37, 0x2856, 0x89bd, 0x6a1a, 0xd497, 0x98ab, 0x5504, 0x7364,
+    0xce81, 0x82a3, 0x4866, 0x7700, 0x3872, 0xbb57, 0x58a2, 0x73fc, 0xc83f, 0xdc7f, 0xb349, 0x4ca8, 0x62f0, 0x20aa, 0xac7d, 0x2e9e,
+    0xdb85, 0xb1a3, 0xc867, 0x994d, 0x1c98, 0xe0bf, 0xb71f, 0x8bb7, 0xc8e9, 0xe6e7, 0x8091, 0x6b9c, 0x8adb, 0x3c5e, 0x7782, 0x1abe,
+    0x4e38, 0x92b9, 0xaa8f, 0x5030, 0xb2f3, 0x8a1d, 0x528e, 0x9e75, 0x8bff, 0x2462, 0x6992, 0xd595, 0x7424, 0x9ad5, 0x273c, 0x676e,
+    0xdde9, 0x5716, 0x2666, 0xc41f, 0x1786, 0x4684, 0x35a2, 0x8eeb, 0xcfa9, 0x73ae, 0x96d7, 0x81f1, 0xc165, 0x1c86, 0x48fc, 0x3422,
+    0xd021, 0x4dd8, 0xb971, 0x5a42, 0xd59f, 0x7dd8, 0x403a, 0x8c6f, 0xd3f7, 0x5b1c, 0x2d32, 0x4bec, 0x775c, 0xe2a7, 0xbdc5, 0x49c4,
+    0xdc0b, 0xcfab, 0xaf75, 0x4f3c, 0xbec7, 0x1526, 0x4d80, 0x4394, 0xad6f, 0x5236, 0xd217, 0xbd89, 0x2b5e, 0x4f48, 0xdd51, 0xc337,
+    0x11d2, 0x5a48, 0x7278, 0x2688, 0x4686, 0xdfe7, 0x2226, 0x4d86, 0xcf3d, 0xad95, 0x2504, 0x6e8c, 0x5834, 0x656e, 0xd0cf, 0x7ab8,
+    0x962d, 0xc567, 0x170c, 0x56a8, 0xc0ad, 0x8dc1, 0x6bca, 0x9c19, 0x6194, 0x511e, 0xd501, 0x8f35, 0xc8f9, 0xb275, 0xe757, 0x5a54,
+    0x3bdc, 0xcc83, 0x82eb, 0xbe99, 0x257a, 0x30e6, 0xb751, 0x973b, 0x9021, 0x2b84, 0x3290, 0x7292, 0x137e, 0x2cb0, 0x47b4, 0x917d,
+    0x714e, 0xca9b, 0x806b, 0xb471, 0x6124, 0x9f1b, 0x4d58, 0x77a4, 0xa4cb, 0xcdb1, 0x6da0, 0x84e3, 0xa363, 0x3034, 0x48e0, 0x8a85,
+    0xaddb, 0x7fd8, 0x5ce0, 0x9e05, 0xdcfb, 0x2ce4, 0x8fdf, 0x46b8, 0x1a06, 0x934b, 0x4fa2, 0xda67, 0x3370, 0x72a6, 0x8e97, 0x49a4,
+    0x6866, 0xd6d7, 0x8941, 0xd8ff, 0x4c44, 0x36c4, 0x842f, 0xd7fd, 0xc2b9, 0x3a62, 0x1bd2, 0xad19, 0x5754, 0xd337, 0x8a05, 0xd2d5,
+    0x39b4, 0x7802, 0xed1f, 0x62b6, 0x319e, 0x9e17, 0xc6bd, 0x7898, 0x3b80, 0xb3c7, 0x91d1, 0x8a67, 0xdaad, 0xc219, 0x42f2, 0xae0d,
+    0x325c, 0x7106, 0x3c6c, 0x5c00, 0x18e8, 0xc7f5, 0x3394, 0x5476, 0x9d41, 0x4192, 0xabc7, 0x995d, 0x757a, 0x4156, 0xdd3b, 0x5554,
+    0x9713, 0x5fb8, 0xd053, 0x7eb2, 0x2bcc, 0x8c99, 0x6d5e, 0x91a9, 0x66ac, 0xc613, 0x23da, 0x49be, 0xd31b, 0x9e3d, 0x87ed, 0xba73,
+    0x4f9e, 0xa2e1, 0x78fe, 0x9ec9, 0xb537, 0x4c50, 0x85bd, 0xa873, 0xe10d, 0x4346, 0xcf23, 0xbcf1, 0x371c, 0x83eb, 0xa705, 0x2620,
+    0x3b8c, 0x5baa, 0x2e74, 0xdae5, 0x8c25, 0xa24b, 0x28bc, 0x438a, 0x8eb5, 0x3760, 0x7590, 0xcc85, 0xc59d, 0xdd8b, 0x72bc, 0x4dde,
+    0x83a1, 0x38bc, 0x6384, 0x583e, 0x7eb8, 0xce4d, 0x5062, 0x1ef2, 0x6414, 0x3c5e, 0x9e8f, 0xd03b, 0x2794, 0xc087, 0x61ac, 0xcd3b,
+    0x4694, 0xe6eb, 0x6d2c, 0x381a, 0x9ae3, 0x7400, 0xbe5b, 0xd261, 0x60ae, 0x7af6, 0xc0ab, 0x9701, 0x3fe2, 0xc921, 0x1a46, 0xd149,
+    0x4ea8, 0x75ec, 0xbb07, 0x9a83, 0xa00b, 0x7b22, 0xc9cb, 0x677c, 0x166c, 0x378a, 0xb2a7, 0x3edc, 0x5ba6, 0x6d1c, 0xba6f, 0x94b3,
+    0x68dc, 0xc32f, 0x91ed, 0x9625, 0x2fb0, 0xc225, 0x6e38, 0x4a7c, 0xb157, 0x93ff, 0xa43f, 0xcdfb, 0x8859, 0x5b52, 0x2da0, 0x8d49,
+    0x515a, 0x7e9c, 0x3faa, 0xda65, 0x62f4, 0x7794, 0xa9d7, 0xe691, 0x7d0c, 0x9783, 0x370a, 0x5e90, 0xe1cb, 0x703e, 0xa233, 0x41bc,
+    0x699c, 0xcec3, 0x3e62, 0xa54d, 0x6d64, 0xd40f, 0x7838, 0xb795, 0x885b, 0x3b10, 0x7558, 0xc569, 0xb429, 0x953b, 0x4fba, 0xdf2b,
+    0x62b0, 0x3092, 0x6d3a, 0xd3ab, 0x9af7, 0x45d8, 0x1c12, 0x36d8, 0xdbb3, 0x742a, 0x9cdd, 0x53d2, 0x38c0, 0x772c, 0x14a4, 0x6e16,
+    0x9e49, 0x32da, 0x518a, 0xcdf7, 0xa0bf, 0x5c7e, 0x719e, 0x2150, 0xe7c3, 0xcb15, 0xaf0b, 0x9949, 0x9af7, 0x6ad2, 0xe9ab, 0xaa03,
+    0x1fae, 0x3294, 0x4ace, 0x8ded, 0xcdf9, 0x3384, 0xbbdd, 0x8e29, 0xb253, 0x61ec, 0x3b84, 0xace1, 0xc30d, 0x1be2, 0xde63, 0xbe33,
+    0x2b02, 0x6cd4, 0xe4bb, 0x42b8, 0x8111, 0x5db2, 0xc7ad, 0xea07, 0xae55, 0xbedb, 0x3852, 0x7f3c, 0x9d43, 0xc363, 0xaf29, 0x1a7a,
+    0x975d, 0xb7c7, 0x3eac, 0x2b22, 0xb87d, 0xd3d3, 0x4fb0, 0x30fa, 0x5e32, 0xa4fb, 0xce89, 0x8ff7, 0xb4cd, 0x2624, 0x2a3c, 0x5e82,
+    0x96ed, 0x2b7e, 0xac49, 0x4042, 0x7c4e, 0x48ea, 0x16e2, 0x6ac2, 0x9f2d, 0xd509, 0x25d0, 0xb035, 0x5c04, 0x2658, 0x751e, 0x60a4,
+    0xe54b, 0xc28f, 0x8129, 0xaae9, 0x4554, 0x71b0, 0xe5d9, 0x97cf, 0x8077, 0xcb17, 0x213c, 0x5048, 0x32ee, 0xa01b, 0xd1ff, 0x8057,
+    0x3d82, 0xc0bb, 0x77ce, 0xa407, 0x63fa, 0xc8d7, 0x5d64, 0xb7c9, 0x82f1, 0x343a, 0x6a2e, 0x8f19, 0x5958, 0xa8cd, 0xca65, 0x350e,
+    0xe05b, 0x21d2, 0x359e, 0xc37f, 0x64b2, 0x9713, 0xc36d, 0x382e, 0x5938, 0x9313, 0x787e, 0x2012, 0x54ce, 0xe7fb, 0x69f6, 0x8a11,
+    0xc875, 0xbac7, 0x9a8f, 0xafcf, 0x1b90, 0x64c8, 0xe1a5, 0xd033, 0x6bae, 0x9f33, 0x581a, 0x16f6, 0x7c66, 0x39be, 0x8ef3, 0xc37d,
+    0x9d37, 0x212a, 0xb6e1, 0xeb89, 0x7398, 0x2be2, 0xace1, 0xa02d, 0xd517, 0x5a1c, 0xbb7b, 0xb361, 0x4704, 0x7b0a, 0xa2bd, 0x914d,
+    0x6158, 0xbc25, 0x22c6, 0xcb7f, 0xdeef, 0x2fce, 0x4082, 0x1c10, 0xb315, 0xdba9, 0x24f4, 0xa38f, 0x5b0a, 0x7e74, 0xb397, 0xa4dd,
+    0x2e7e, 0x8687, 0xd151, 0x5cb2, 0x39fe, 0xe9d1, 0xc181, 0x9a31, 0x485c, 0xe12f, 0xa7ef, 0x2a2c, 0x8441, 0xd29f, 0xe573, 0x42cc,
+    0x6d3c, 0x2888, 0xe00b, 0x46e0, 0x55fa, 0x9db9, 0xe86d, 0x1fce, 0x3820, 0x665a, 0xb885, 0x45dc, 0x152c, 0xc697, 0xad2b, 0x6ad0,
+    0x199a, 0xb689, 0x6c9e, 0x25b2, 0x9751, 0xbf19, 0x653e, 0x3416, 0xbe4b, 0x1fdc, 0x8dad, 0xa6e7, 0x7a9a, 0x23d0, 0xc711, 0x7e22,
+    0xeaaf, 0xb73d, 0x8bc9, 0xc461, 0x5612, 0x39ee, 0x9ac9, 0x5300, 0x1fe8, 0xdf97, 0x6852, 0xd2f5, 0x1a6a, 0x3a76, 0x9c0b, 0x2608,
+    0xc26f, 0x83fd, 0xa09f, 0x3c42, 0x5c7e, 0xb3f9, 0x7c26, 0xc019, 0x94ed, 0x1a9c, 0xbfa3, 0x26de, 0xa44f, 0xd16b, 0x42b8, 0xb591,
+    0xe4bd, 0x8bcb, 0x65be, 0x7fbc, 0x469e, 0xc623, 0xd951, 0x4adc, 0xa8f7, 0x67f0, 0x5d22, 0xd891, 0x53dc, 0xcd51, 0x8ccf, 0x5c3a,
+    0xd665, 0x9f27, 0xc085, 0x21d0, 0x71c6, 0xdaf1, 0x6758, 0x33f6, 0x2152, 0xdf1d, 0x979b, 0x25cc, 0x6268, 0xcb85, 0x843f, 0x6a52,
+    0x472e, 0x1f74, 0xc071, 0x30ce, 0x9067, 0xad01, 0x4eb8, 0x28ec, 0x83df, 0x6492, 0xd0d7, 0x55e0, 0x24b6, 0x44a4, 0x62de, 0xd533,
+    0x356e, 0x5448, 0x9481, 0x7b26, 0x6286, 0xa569, 0x946b, 0xad83, 0x7a1a, 0xebc5, 0x6ffc, 0x31b8, 0x695a, 0xe285, 0x764e, 0x8d03,
+    0xbafb, 0x68aa, 0xcdcb, 0xbd57, 0x9905, 0xe0b1, 0xd2af, 0x5ad6, 0x8b87, 0x479e, 0x5d02, 0x36fe, 0xdf33, 0x9d1f, 0xd4cd, 0x857d,
+    0x21f2, 0x96db, 0x2a74, 0xdd19, 0x9faf, 0x376a, 0xc1cd, 0x6410, 0x3d56, 0xe297, 0x7014, 0xd8cd, 0xc06f, 0x7ed2, 0x6a2e, 0x1a16,
+    0xa597, 0x3560, 0xd9b5, 0x43e0, 0xad37, 0x246e, 0xe48b, 0x48fe, 0xa8d7, 0xe0e3, 0xc10d, 0x8b89, 0x3318, 0x179a, 0x3dde, 0x6192,
+    0xbac7, 0x8e43, 0x6dde, 0xd1a1, 0x4494, 0xe763, 0x3188, 0x7506, 0xd3db, 0xb01f, 0x4c4c, 0x66be, 0xa31f, 0xb5e1, 0x3df8, 0x1a42,
+    0xe359, 0x7dba, 0x50bc, 0x72c8, 0xc03b, 0x7cf8, 0x5416, 0xb4eb, 0x1e9e, 0x3eb8, 0xe833, 0x94b5, 0x9e8b, 0x5f46, 0xa5db, 0x3628,
+    0x686c, 0xcbcf, 0x4b56, 0xa5e5, 0x3a94, 0x6670, 0x8e27, 0x4480, 0x7c4e, 0x28d6, 0x1aa8, 0x876b, 0x40e2, 0xe46b, 0x36f2, 0xacaf,
+    0x2886, 0x82cb, 0x9ad5, 0x5628, 0x667a, 0x7bfa, 0xaa43, 0x652c, 0x9805, 0x3bee, 0x4848, 0xbca5, 0xdb4d, 0x2730, 0x7038, 0x9339,
+    0x3d8a, 0xa78b, 0x24ae, 0x6782, 0x4456, 0x88a5, 0x26b8, 0x5610, 0x7ede, 0xc80d, 0x7be6, 0xcebf, 0x23f0, 0xa439, 0x3058, 0x832d,
+    0xa1db, 0x1ab6, 0xb285, 0x7672, 0x36c6, 0xb60f, 0xa7b1, 0x5564, 0xdbcf, 0x7dcc, 0x2c5a, 0xddf9, 0x6f7c, 0xa53d, 0x3bea, 0xeab1,
+    0x8eb3, 0xa7bf, 0xce37, 0x81c9, 0x3be2, 0xdb19, 0x433c, 0x9635, 0x843f, 0x6078, 0xd1bd, 0x4738, 0x39c0, 0xb4ed, 0x94ff, 0x2d50,
+    0xa373, 0x2308, 0x4d1c, 0x7c36, 0x1884, 0xdda3, 0x94d5, 0x6444, 0xc0ff, 0x4d02, 0x9d19, 0x4fa0, 0x895b, 0xc793, 0x8581, 0x51fc,
+    0xb0e3, 0x51f4, 0xdf65, 0xa7b3, 0x2540, 0xe929, 0x5690, 0xa881, 0xd1b7, 0x472a, 0xb05f, 0x6bd2, 0xe23f, 0x946f, 0x27ae, 0x7ed4,
+    0xc481, 0x1ba4, 0x40d0, 0xe01d, 0x2cbc, 0x92d1, 0x8251, 0x3c3e, 0x774c, 0x2232, 0x3e4c, 0x848d, 0x24c8, 0xb5b7, 0x3fa0, 0x724a,
+    0xb2b1, 0x6ac2, 0xe749, 0x520e, 0x3b62, 0x88cb, 0x9bd5, 0xc9c7, 0x6bb0, 0x4dd0, 0xd217, 0x53e4, 0x72b0, 0x8bcd, 0x47a2, 0xa325,
+    0x9cf9, 0xd2b9, 0xb4b3, 0x6414, 0xd36f, 0x1682, 0x6d0c, 0x9f69, 0x74d6, 0x4282, 0xb4fb, 0x92db, 0xaff1, 0xe1af, 0x7b7a, 0x896d,
+    0xc681, 0x72f8, 0xece1, 0xc421, 0x1d00, 0x71ea, 0xc603, 0x1ab6, 0x3f4a, 0x9595, 0x28dc, 0x41bc, 0x988b, 0xa89f, 0xc371, 0x49c2,
+    0xd0c9, 0x2030, 0x4c9c, 0x6f18, 0x250c, 0x6926, 0xafa3, 0x333c, 0xe993, 0xbecb, 0x529e, 0xa517, 0x73ea, 0x44de, 0xaaed, 0x3b14,
+    0x69d4, 0xd15b, 0x5158, 0x6d00, 0xb66b, 0x8841, 0x4f38, 0xabab, 0x155c, 0x86b3, 0x4700, 0xaac9, 0x5930, 0x265e, 0xd433, 0x4906,
+    0xc1cf, 0x8bb5, 0x7872, 0x4ec4, 0x9373, 0x34b4, 0xa0d3, 0x7480, 0x154c, 0x49be, 0x626e, 0xc76f, 0xb495, 0xdf93, 0x7c3c, 0x5932,
+    0x9a75, 0xd88b, 0x55da, 0x8121, 0x143c, 0xa64b, 0x6a4e, 0xb98f, 0x5ffc, 0x1a16, 0xdb45, 0x91c9, 0xc967, 0x30d4, 0x8473, 0xd373,
+    0xa805, 0x4002, 0x232a, 0xcf71, 0x42b0, 0x3180, 0x9c63, 0xdb2f, 0x8537, 0x7ec2, 0xc957, 0x4fda, 0x2a5e, 0xcf6b, 0x4f94, 0xdc9d,
+    0x7ab4, 0x93cd, 0x268e, 0x877f, 0xc301, 0xde65, 0x5a66, 0xbb9b, 0xe75d, 0xab25, 0x6dde, 0xda93, 0x6360, 0xc05f, 0x97af, 0x3ed2,
+    0xd3c5, 0x7684, 0x471a, 0x27ea, 0xbf11, 0x91f3, 0xe853, 0x2e06, 0xcb0d, 0x872d, 0x6fbc, 0x325c, 0x864d, 0x495a, 0xc75b, 0xea7b,
+    0x588c, 0xc449, 0xe147, 0x9bcb, 0xb401, 0xd01d, 0x221a, 0xae71, 0x8da5, 0x31f0, 0x4da0, 0x676c, 0x8ffd, 0x58c2, 0x4576, 0xdd33,
+    0xc109, 0x581e, 0xdaf1, 0x91fd, 0xc833, 0x1db6, 0x7dfc, 0x78ca, 0xc5c7, 0xab57, 0x81cf, 0x654e, 0x99a7, 0x7578, 0x4b90, 0xd10d,
+    0x5f76, 0x43e4, 0x2b28, 0x560a, 0xa8a3, 0x91eb, 0x1a64, 0xd403, 0x5374, 0xae7d, 0xe617, 0x6840, 0x8c73, 0xd86f, 0x573c, 0x5bbc,
+    0x43a6, 0x724c, 0xd893, 0x9b7d, 0xb3bd, 0x4658, 0xa551, 0x2de0, 0xb721, 0x7dba, 0x926f, 0x279c, 0xa961, 0x6ffc, 0xd4dd, 0x2ece,
+    0xbb03, 0x64e2, 0x4784, 0x7522, 0x8f9b, 0xcfcf, 0x3942, 0x6ab4, 0x304c, 0x5c98, 0x7f32, 0x3f1c, 0x53fc, 0xbb8d, 0x5fce, 0x5344,
+    0x996d, 0x5936, 0xd2e1, 0xa8cb, 0xabcb, 0x6046, 0x19fa, 0xbaef, 0xa033, 0xcfaf, 0xb915, 0xe319, 0x1bc2, 0x6e12, 0xbe6d, 0x2f1c,
+    0x3e9c, 0x15ea, 0x7c0c, 0x98df, 0xaab9, 0xb69d, 0x16fc, 0x5568, 0xa9c3, 0x84b7, 0x7fac, 0xbeaf, 0x9da5, 0x2884, 0xcf8d, 0x361a,
+    0x5d62, 0x888d, 0x71de, 0x4b8a, 0x9893, 0x3956, 0xe0ed, 0xc99d, 0x332a, 0xdb5f, 0x1b18, 0x6fe8, 0xc70f, 0x28b6, 0x4bae, 0x3c22,
+    0xa3f7, 0x1d4a, 0x49c6, 0xab5b, 0x3da8, 0xdb5d, 0x5c56, 0x884f, 0xab77, 0xc22d, 0xd891, 0x60ee, 0xaf6d, 0x1a64, 0x4f4a, 0x7944,
+    0x30d4, 0xdb8d, 0xa445, 0x5708, 0xc317, 0x8fe7, 0x39e2, 0x9dc3, 0x7d02, 0x1e04, 0x98a5, 0xcc25, 0x7f1c, 0x13f0, 0x6690, 0xc16b,
+    0xa3e3, 0x4464, 0x8095, 0xc7c9, 0x1fda, 0x70ba, 0x2a6c, 0xd311, 0x9d6b, 0xb803, 0x3058, 0x8d27, 0x403e, 0xb1f7, 0x9b71, 0x7372,
+    0xe86f, 0x5942, 0x2712, 0xd0f1, 0x8b33, 0xbf97, 0x69a8, 0xdce7, 0x8d87, 0x3d66, 0x955b, 0x2bec, 0x6bce, 0x5216, 0xc14f, 0x87b9,
+    0x223c, 0x30c6, 0xa62d, 0xba85, 0x2a0a, 0x8829, 0x4ea8, 0x9abb, 0x8729, 0x278a, 0xa389, 0x3ed0, 0xd301, 0x6e66, 0x4eb6, 0x6066,
+    0x6e04, 0x306a, 0x958b, 0xe1eb, 0x8b33, 0xa845, 0x77b0, 0x50f2, 0x2f44, 0xbb53, 0x696e, 0xa6e3, 0x749a, 0x8a19, 0xb6cd, 0x1ea8,
+    0x5242, 0xb49d, 0xd41d, 0x5da2, 0x32e8, 0x9497, 0x16a2, 0x7f8e, 0x540e, 0xc8c1, 0x359c, 0x9a95, 0x774e, 0x1c16, 0x68a8, 0x4ecc,
+    0x9907, 0xcd9b, 0xe367, 0xb51d, 0x9bd9, 0x40ee, 0xc465, 0x5228, 0x62e2, 0xb197, 0xe6e5, 0xa12b, 0x5e3c, 0xa72b, 0x1dba, 0x6368,
+    0x78ca, 0x279a, 0x5ede, 0x313a, 0x50fc, 0x7af0, 0x9e6d, 0xd967, 0x64c8, 0xb875, 0xe5e9, 0x4018, 0xb829, 0xc05f, 0x7b70, 0x6454,
+    0x9441, 0x35e6, 0x707a, 0x4cb0, 0x64c2, 0xa643, 0x49a0, 0xce5b, 0x1ec6, 0x2dd4, 0x49aa, 0xc9eb, 0xb46d, 0x2380, 0x7d00, 0x3206,
+    0x70dc, 0xc107, 0xdbf1, 0x78b6, 0x4d82, 0xcb8f, 0x707e, 0xbea5, 0x3bee, 0x2960, 0x767e, 0x1812, 0xb901, 0x2f02, 0xaa7b, 0xcddb,
+    0x8473, 0xbbb9, 0x3134, 0x5e4e, 0xc6c9, 0x4faa, 0xd1df, 0x792e, 0xda7d, 0x3dcc, 0x71dc, 0xdb3f, 0x376a, 0x7220, 0x3fe2, 0x9009,
+    0x982b, 0x213a, 0xcb2b, 0x2f76, 0xb793, 0x64f6, 0x151e, 0x83f1, 0xbe85, 0xe5a3, 0x978d, 0xc867, 0x241e, 0x9a49, 0x3bbe, 0xe1ab,
+    0xae79, 0x29a0, 0x859f, 0x749a, 0x3674, 0x508a, 0xc9c3, 0xece3, 0x3384, 0x529a, 0x76e4, 0x9063, 0x9f31, 0x61f4, 0x9e55, 0xce7d,
+    0x9335, 0xa2f9, 0x5f48, 0xd5fb, 0x3060, 0x49ee, 0x7452, 0xd993, 0xbf65, 0x22d2, 0x300c, 0xe157, 0x3f8a, 0xa9c1, 0x773c, 0xc377,
+    0xeb23, 0x3bd4, 0x2496, 0xcadb, 0xa811, 0x7e3a, 0xbdcb, 0x5694, 0x65e0, 0xa139, 0x49ea, 0x8157, 0x6b70, 0xcf6d, 0x9acf, 0xbc35,
+    0x9245, 0xce29, 0x5a6c, 0x8729, 0x97e7, 0x2e30, 0x47b0, 0xd483, 0x63aa, 0x200a, 0x8687, 0xc913, 0x7b70, 0xd97f, 0x3ba4, 0xaff5,
+    0x9073, 0x67ca, 0x86d7, 0x3258, 0xead5, 0x8453, 0x3d20, 0x583a, 0xb7b9, 0x6278, 0xdb1d, 0x41be, 0xaf75, 0x967f, 0xe107, 0x5970,
+    0xb221, 0x2fce, 0xe31f, 0x9631, 0x36f2, 0xab95, 0xe639, 0x8383, 0x547a, 0x7016, 0xc857, 0x7a3a, 0xe597, 0x9149, 0x4bec, 0x344c,
+    0xa34f, 0x6802, 0x96b3, 0xb86f, 0x700a, 0x2382, 0x5096, 0xbe37, 0x87dd, 0xcd17, 0x7384, 0xd793, 0x36d2, 0x8d67, 0xa701, 0xd8a5,
+    0xc6ff, 0x4694, 0x63be, 0x7e04, 0xd58d, 0x6344, 0xcb39, 0x4232, 0xe6d5, 0xc2f1, 0x550c, 0x6012, 0x7bde, 0x24c0, 0xa99f, 0xccf3,
+    0xbc83, 0x8a35, 0xb10d, 0x6722, 0x1b8a, 0x608e, 0xbc33, 0x1cfa, 0x92d3, 0xdbf5, 0x4492, 0x25c4, 0xdcd5, 0x4156, 0x61ec, 0x9899,
+    0xc86f, 0x7408, 0x3e08, 0x7ce2, 0xadf3, 0x4ea8, 0xce3d, 0x697e, 0x22fa, 0x8b59, 0x4a52, 0xb705, 0x55fa, 0xddbf, 0xc903, 0xaebd,
+    0x78ec, 0x5cca, 0x1dec, 0x810b, 0x5122, 0x6770, 0x19b6, 0x9e89, 0x76d4, 0x4538, 0x2218, 0xcc19, 0x4142, 0xc33d, 0x9355, 0x3c5e,
+    0xb213, 0xa523, 0x8f8b, 0xdca7, 0xbd0f, 0x65bc, 0x4238, 0x3baa, 0x676e, 0x1c9a, 0x9a0f, 0x8397, 0xcbb1, 0x3858, 0x9c77, 0x1662,
+    0xce53, 0x2d78, 0xc469, 0xafed, 0x2c50, 0xe587, 0x3c46, 0x9137, 0x62bc, 0x9f81, 0xd7d7, 0x5668, 0x3ae8, 0xdc57, 0xc573, 0xaaa7,
+    0x9e2d, 0x3ab2, 0xb627, 0x915f, 0x24b6, 0xe5bf, 0x6280, 0x7d40, 0xa2f5, 0x97f1, 0xc9cf, 0x9b2f, 0x4f90, 0x6096, 0x7a7e, 0x1afa,
+    0x3bce, 0xd4dd, 0xa357, 0x359c, 0x6d3c, 0x1f54, 0x8559, 0x55f8, 0x2920, 0xc92b, 0xa8af, 0x5b2c, 0xbcf3, 0xd1b7, 0x4a64, 0xe8f7,
+    0x6b86, 0xc229, 0x8cd5, 0x55c0, 0xa0f7, 0x48f2, 0xc581, 0x9cb9, 0xac8b, 0x36d8, 0x1ba6, 0xda45, 0x75cc, 0x8839, 0xca3b, 0x496c,
+    0x6eb2, 0xc98f, 0x4c20, 0xb77f, 0xe071, 0xa845, 0x8c85, 0x6e42, 0x5d7e, 0x9115, 0xc6b7, 0x3592, 0x48e8, 0xd5e7, 0x7ca6, 0x5590,
+    0xe255, 0xb503, 0x26ce, 0xc51f, 0x6f4c, 0xde8b, 0x93fd, 0x5d08, 0x411c, 0x95b9, 0x6af2, 0xc68b, 0x5b4c, 0x5322, 0x8df9, 0x1eca,
+    0xb677, 0x7bb2, 0x5448, 0xe2cd, 0x2530, 0x56c2, 0x8d35, 0x3e24, 0xaf6b, 0xdb6f, 0xbfb5, 0x39e0, 0x9f07, 0x30be, 0x482a, 0x6b0a,
+    0x2742, 0x6586, 0x34e8, 0xc8d3, 0xe1ff, 0x7014, 0xb531, 0x82d5, 0x3122, 0x4d80, 0xa269, 0x40b6, 0x2d18, 0x88c3, 0x6aa2, 0xce35,
+    0x4dce, 0xbdb3, 0x7c0e, 0x1492, 0xd745, 0xadb5, 0x204a, 0xc79d, 0x94a1, 0x2a60, 0x8215, 0x568e, 0x301e, 0xc6b1, 0x2ace, 0x7c9a,
+    0x762e, 0x1992, 0xabad, 0x5f6c, 0x57da, 0xc2ad, 0x7284, 0x40bc, 0x3544, 0xd99b, 0xa5ff, 0x1bae, 0x6146, 0xc2ef, 0x28d6, 0xc955,
+    0x4704, 0xb953, 0x1a82, 0x39fa, 0xe5b1, 0xaba1, 0x41f2, 0x31bc, 0xab79, 0x23b8, 0xa2d5, 0x8997, 0xb8ff, 0x5efa, 0x1b96, 0x3a80,
+    0x6cce, 0xb157, 0xe83f, 0x9c89, 0x3d9c, 0xbf7f, 0xae11, 0x2c5c, 0x80d5, 0x7268, 0x92df, 0xbebf, 0x38ea, 0xe2fb, 0x9791, 0x3a2e,
+    0x1eba, 0xdf25, 0x5322, 0xbfaf, 0x7c68, 0xe78b, 0x52b0, 0xcd15, 0x6f7e, 0x3794, 0x9c35, 0x8c03, 0xba2b, 0xcf09, 0x7f32, 0xa433,
+    0x37da, 0xb4b7, 0x2170, 0xa263, 0xe129, 0x7554, 0xc2cf, 0x3f82, 0xb077, 0x69d4, 0xd319, 0xa6af, 0x1f22, 0x8887, 0x2878, 0x4388,
+    0x3102, 0x9f59, 0x36bc, 0x6e1a, 0xcedb, 0x30d6, 0xb803, 0xdb39, 0x3dbe, 0xbd9d, 0x92ab, 0x6b06, 0x7c5c, 0xdfbf, 0x7ae6, 0xd1bd,
+    0x509e, 0xc8ff, 0x4070, 0x80a5, 0x1948, 0x8f81, 0xd0c3, 0xe247, 0x8941, 0xa975, 0x4aa8, 0x554e, 0x2236, 0x6baa, 0xe7b5, 0x5572,
+    0xadbf, 0x7dd0, 0x9dbd, 0x5724, 0x9c15, 0xca39, 0x6fcc, 0x5dc8, 0xb21d, 0xc3a7, 0x6d66, 0x8777, 0x288c, 0x9743, 0x642c, 0x5570,
+    0xe0a7, 0x15fc, 0x80db, 0x5df8, 0x3e1a, 0x9f73, 0x2f98, 0x1d0c, 0x59ec, 0xe3e5, 0x34e6, 0x5cae, 0xb945, 0x91eb, 0xe8d9, 0xa159,
+    0x53f4, 0x6ce8, 0xe375, 0x9145, 0xb155, 0xd7a9, 0xa031, 0x47a0, 0xba7b, 0x9157, 0x3c78, 0x61e0, 0x854b, 0x9fc3, 0x1294, 0x7a7a,
+    0xa599, 0x3a44, 0x7372, 0xadf9, 0xe569, 0x39c8, 0xd575, 0x58a0, 0x787c, 0x4b6a, 0x5ed0, 0xa719, 0xb3cb, 0x59ce, 0x2130, 0xa50d,
+    0x78da, 0xbea5, 0x1688, 0x3950, 0x5e7c, 0x775c, 0x2130, 0x435c, 0xa6a7, 0x1edc, 0xd91f, 0x2b40, 0x6392, 0xb1f3, 0x1c26, 0x2fde,
+    0x6cf4, 0x3ef6, 0x455e, 0x8c35, 0x95d1, 0x3c82, 0xb191, 0x2ae0, 0x82b3, 0xec0f, 0xaa69, 0x1bd2, 0x77ba, 0xd843, 0x8793, 0x42b2,
+    0x6372, 0xa621, 0x8d1d, 0xc0a7, 0x6a5a, 0x3450, 0xcefd, 0x1e0c, 0x8ba7, 0x2b4c, 0x81eb, 0x555a, 0xb83b, 0x7ab0, 0xe3b7, 0xb1bb,
+    0xdbcb, 0xb985, 0x9d97, 0x4d8e, 0x8cf7, 0x254a, 0xa315, 0xc8a3, 0x980d, 0xe467, 0x7554, 0x8e1f, 0xbe13, 0xa3cf, 0xb34f, 0x2872,
+    0x6826, 0xaad3, 0xd03b, 0x3c82, 0x6f2a, 0x955d, 0x5fba, 0x7b14, 0xe3ff, 0x9c3f, 0x509a, 0xc0fd, 0x6a20, 0x49f4, 0x9a5f, 0x5e70,
+    0xd529, 0xbd93, 0x89f7, 0x4aaa, 0xd699, 0x303a, 0x984b, 0xc04b, 0x8aa3, 0x27fe, 0x51c2, 0xaaa3, 0x416a, 0xa26d, 0x6a76, 0xade1,
+    0x89ed, 0x7aba, 0xd365, 0x4e68, 0x7aaa, 0x8f1d, 0xa0ab, 0xc8ef, 0x734e, 0x471c, 0x57de, 0x40c0, 0xc9f3, 0x57c8, 0xe6f7, 0x7f68,
+    0x2b5a, 0x542e, 0x93c9, 0x2088, 0x6676, 0x825d, 0x127a, 0x6126, 0xd417, 0x443e, 0x1bc0, 0xdca7, 0x9d6f, 0x4c72, 0xb5e7, 0x6194,
+    0x9bc5, 0x75da, 0x21f6, 0xa60d, 0x39cc, 0x9045, 0xa1c5, 0xb5ff, 0x7ff2, 0x636a, 0xcb27, 0x53d6, 0x138c, 0x6888, 0x2bee, 0x5764,
+    0x4a10, 0x8aeb, 0xe795, 0x676e, 0x5584, 0x27c2, 0x91ab, 0xa739, 0xe81f, 0x7666, 0x3262, 0xbf35, 0x6afc, 0xabed, 0x6138, 0xead1,
+    0xcf27, 0x91c3, 0xbb19, 0xe49f, 0xb1cf, 0x53e2, 0x9511, 0x6d2c, 0xaa33, 0x2ef2, 0xa8b9, 0x5336, 0x21ba, 0x4d38, 0x2d74, 0x86e7,
+    0x1f96, 0x6d2a, 0x543a, 0xaf79, 0x6f60, 0x2ac0, 0xb577, 0x56c0, 0x236c, 0xc88d, 0xd333, 0x7a3e, 0xa78d, 0x8f0b, 0x4634, 0xc28b,
+    0x7526, 0x3a76, 0xdb6b, 0x41d6, 0x7b40, 0x23e8, 0x84e3, 0xdb85, 0x2c06, 0x73d8, 0x1c06, 0xa8fd, 0x74c2, 0xd39b, 0x404c, 0x1fbc,
+    0x8df1, 0x66e2, 0xc873, 0xe1bb, 0xa8db, 0xbbe5, 0x8bad, 0xd599, 0xb521, 0x7378, 0x3a24, 0x8569, 0xdeef, 0x37ae, 0x3066, 0xca55,
+    0x7db8, 0x4536, 0x1972, 0x4d82, 0x7d62, 0x4148, 0xb8a1, 0x3116, 0x6d8c, 0x9ccf, 0x1e26, 0xd697, 0x2e62, 0xb297, 0x5798, 0x3510,
+    0xbe9d, 0x4ca0, 0xd7a5, 0x20ca, 0x7d16, 0x8fb5, 0x6942, 0x2c34, 0xdbdd, 0xc673, 0x8a0f, 0x2fa2, 0x4868, 0xc169, 0x9789, 0xda73,
+    0x3196, 0x9251, 0x6280, 0x9d67, 0xc2db, 0x30a8, 0xd8bf, 0xd227, 0xb8df, 0x7534, 0x8beb, 0x9a29, 0xc209, 0xeaf7, 0x8881, 0xc6e7,
+    0xa72f, 0xb741, 0x7ce2, 0xc97d, 0x24c6, 0x4e28, 0xd3c9, 0xa109, 0xc5b3, 0x58be, 0x4cb0, 0x8b41, 0x99c3, 0x31e8, 0xa9e3, 0xc26b,
+    0x38b4, 0xceff, 0x1872, 0x4464, 0xaf65, 0x9ea1, 0xec7f, 0x7b3c, 0x5170, 0x7306, 0xdc49, 0x2474, 0xcda3, 0x8c29, 0x1458, 0x5546,
+    0x7d26, 0x45b2, 0x7728, 0x1682, 0xbcbf, 0x6262, 0x3d82, 0x58fa, 0x1782, 0xb969, 0xcf8b, 0x5de8, 0x1da2, 0x4866, 0x5eea, 0xe035,
+    0x3658, 0x2db8, 0x99f5, 0x5512, 0xb1b7, 0x2c70, 0xd53b, 0xbd41, 0x4070, 0x16e2, 0xab09, 0xd963, 0x7ef2, 0xa6b7, 0xdfab, 0x3e00,
+    0x8fc5, 0x2edc, 0x68ca, 0xa027, 0xb83f, 0x17b8, 0x848d, 0xd94f, 0x5e12, 0x79c4, 0xd7e5, 0x86cb, 0x3460, 0xe083, 0x804f, 0x2050,
+    0xdc5d, 0x54ea, 0x9737, 0xc761, 0x2be0, 0x5722, 0xd7d3, 0x3e42, 0x89eb, 0xe4e9, 0xc4e1, 0x964b, 0x316c, 0x7112, 0xaff9, 0x9fc9,
+    0xc127, 0x880b, 0xc4cb, 0x3fe2, 0xd35b, 0x9e69, 0x4d84, 0xa647, 0x93bd, 0xb759, 0x5886, 0xafef, 0x6a6e, 0x551e, 0x7c52, 0x2e24,
+    0xd765, 0x5cb2, 0x4278, 0xcf51, 0x6b66, 0x2af6, 0x4c40, 0x2454, 0x3f20, 0xe0b9, 0xb499, 0x7344, 0x489c, 0xa3a3, 0xe3f7, 0xca4b,
+    0xd09d, 0x2b36, 0x9425, 0x3910, 0xc52f, 0x8097, 0x44aa, 0x5d5a, 0x1f58, 0x5390, 0x7fca, 0x4562, 0x37ee, 0xd0ef, 0x855d, 0x9de5,
+    0x7118, 0x537e, 0x1774, 0x969d, 0x7ac2, 0x45d4, 0xe5f3, 0x8965, 0x49ee, 0x77f0, 0xdfb9, 0x90e3, 0xc8e3, 0xa265, 0xb09b, 0x642e,
+    0xe0cd, 0xbcf9, 0x38ca, 0xea75, 0xd4db, 0x47a0, 0xa731, 0x7a30, 0x6584, 0x94ed, 0x2bf4, 0x5500, 0xe12b, 0xb4e5, 0x27c0, 0x60f8,
+    0x87c1, 0xbabb, 0x1cf2, 0x6642, 0xd871, 0xb493, 0x34fe, 0xa5af, 0x4c86, 0x4206, 0xe83b, 0xc961, 0x5cee, 0xa735, 0x7c74, 0xbcb1,
+    0xce55, 0x4e3c, 0x3268, 0x736e, 0x1f4e, 0x6868, 0xc783, 0x5086, 0x95bb, 0xbbe7, 0x2908, 0xd26f, 0xab43, 0x52c6, 0x6f7e, 0xb17f,
+    0x93f7, 0xc3cd, 0xb3cb, 0x2a22, 0xca5d, 0x62f4, 0xe539, 0x93e7, 0xd281, 0x5800, 0x799c, 0xc9a1, 0x8f37, 0x7200, 0xb315, 0xd329,
+    0x868b, 0x26ae, 0xb859, 0x57ee, 0x41c4, 0xa45f, 0x2240, 0xabc9, 0x4cf4, 0x996d, 0x8027, 0xeae1, 0x6c08, 0x38f6, 0x7f4c, 0x61c6,
+    0x4a36, 0xea69, 0x87db, 0xd84d, 0xaf85, 0x71a2, 0x93f1, 0x4c94, 0x2fc4, 0x5d14, 0xc6f1, 0x4eae, 0x6bae, 0x40b2, 0x24a4, 0x560c,
+    0x93cb, 0x1c6a, 0xe1fd, 0x64ac, 0xa381, 0x7e40, 0x687c, 0x1ab2, 0x6cf4, 0x37c2, 0xb4ad, 0xd229, 0x46d4, 0xc521, 0x5a7c, 0xe59f,
+    0x6e3c, 0x9641, 0x5d28, 0xd6a5, 0x8325, 0x4df4, 0x645c, 0xb499, 0xabfb, 0xc415, 0x465a, 0x93bb, 0x5236, 0xc3a9, 0x3b56, 0x8ffb,
+    0x2d12, 0xcbbb, 0xe66f, 0x521c, 0xb31f, 0xd28f, 0x985d, 0xe67b, 0x739e, 0x29d2, 0x39fe, 0x79ae, 0xdb41, 0x9849, 0xc76b, 0x885f,
+    0x90e1, 0xdbd7, 0x6314, 0xc2b7, 0x8faf, 0x7e94, 0x50da, 0x3000, 0x79e4, 0x97cd, 0x6368, 0x3bae, 0x88b3, 0x2882, 0xb63f, 0x65bc,
+    0x525a, 0xe319, 0x3c2a, 0xc335, 0x81ff, 0x5c4a, 0x51a0, 0xaa55, 0x25ac, 0xbde9, 0x9c07, 0x7440, 0xc309, 0x627a, 0xb753, 0x46a0,
+    0x9d1d, 0x2c68, 0x5cac, 0xacd1, 0xb653, 0x1c54, 0x65ce, 0xa041, 0x7a58, 0x1f72, 0x5f2a, 0x921f, 0xd41f, 0x20f0, 0x474c, 0x6788,
+    0xdbff, 0x1c5a, 0x73bc, 0x493c, 0xb87b, 0xe955, 0x7d1c, 0xc431, 0x2bfe, 0xdbcb, 0x375c, 0x8733, 0x227a, 0xc8db, 0xe0b7, 0x86b7,
+    0xaea3, 0xc6cb, 0x93fb, 0x8667, 0xe427, 0xbbb3, 0x7e70, 0xd77b, 0x87a3, 0x215e, 0xb49b, 0x373c, 0xd909, 0x86af, 0x4050, 0x8cf9,
+    0x7ba8, 0xab2b, 0x6328, 0x7fd2, 0xccfd, 0x1f56, 0xb5ed, 0xe319, 0x9d67, 0xcc01, 0xb33d, 0xdd93, 0x9251, 0x4d6c, 0xb34f, 0x2284,
+    0x3ce2, 0xd6ff, 0x499a, 0x5c1e, 0x293c, 0xc2b3, 0x249c, 0x9669, 0x6184, 0xcaf5, 0x2174, 0xaff5, 0x38ea, 0x7492, 0xc7b9, 0x3f26,
+    0xa831, 0x8847, 0x979f, 0x251c, 0x8aed, 0x6030, 0xc495, 0x3408, 0x9bcd, 0xe7ef, 0x429e, 0xb4b9, 0x6988, 0x3b86, 0xceeb, 0x9983,
+    0x51d8, 0xdde9, 0x576a, 0x91ad, 0xaaad, 0x4a5c, 0x6038, 0x9d37, 0xcdef, 0x8399, 0xb523, 0x360a, 0x44f0, 0xddbd, 0x2bd6, 0xab91,
+    0x4744, 0xa15d, 0x95a9, 0xbac1, 0x5676, 0x8d8f, 0x3a60, 0x703e, 0x19ee, 0x6178, 0x87cf, 0x733a, 0x1e48, 0x94d1, 0xc90f, 0x2656,
+    0x2ef8, 0x7850, 0xdddb, 0x89c7, 0xa1b7, 0x2e2a, 0x6c00, 0x17aa, 0x7eb2, 0xab21, 0xe703, 0x3ac2, 0x42fc, 0x50d6, 0xdd49, 0x4300,
+    0x67f8, 0x9b77, 0x9c45, 0x776a, 0xcd95, 0xc947, 0x6092, 0x8561, 0xcde3, 0x17aa, 0x3216, 0xd219, 0xad99, 0x29fe, 0xba3f, 0x9ffb,
+    0x131e, 0xb42d, 0x437c, 0x1f9c, 0x5014, 0x3540, 0x6930, 0x87b1, 0xa047, 0xe3bf, 0x41ee, 0x1ea0, 0xa78f, 0x7cf2, 0xb78f, 0x6456,
+    0xdd8f, 0x7bb0, 0x33ea, 0x8a85, 0x4646, 0xc079, 0xe6ed, 0x46f8, 0x97c3, 0xd605, 0x7ffc, 0x2516, 0x6b94, 0x6440, 0x2fba, 0x870f,
+    0x244c, 0x4d2a, 0xa8fb, 0x742e, 0x2f2e, 0xc381, 0x12c0, 0x3b12, 0xd31d, 0x369a, 0x5cd0, 0xae4b, 0x68b2, 0xdfb5, 0x736e, 0xb6cb,
+    0x60e8, 0x9c07, 0x8f53, 0x2e92, 0x6cd6, 0x23b2, 0x7b3c, 0x524c, 0xaf67, 0x892d, 0xa151, 0x4df4, 0xad97, 0x2316, 0x72e8, 0x419c,
+    0x5f48, 0xb6ad, 0x7376, 0x204a, 0x3566, 0xab73, 0xdced, 0x5f34, 0xb461, 0xd225, 0x5340, 0xe7a7, 0xc9d5, 0x525a, 0x1c36, 0x8000,
+    0xa00d, 0xb4eb, 0x5916, 0x28e2, 0xdd85, 0x448e, 0x9b81, 0x3946, 0xe271, 0x4e16, 0x372e, 0xa089, 0x1ec8, 0x8b01, 0x3b6c, 0x654e,
+    0xd3a3, 0xb32f, 0x393e, 0x6c10, 0x8b17, 0xe0c9, 0x4100, 0x5072, 0xc7f1, 0xb5e1, 0x327c, 0x9e1f, 0x76d6, 0xb02b, 0xcaab, 0x58ac,
+    0x3080, 0xa213, 0xd7fd, 0x5fe8, 0x2f22, 0x206c, 0x5694, 0x3eb8, 0x68c4, 0x504a, 0x7f32, 0xcf29, 0x40f0, 0x942f, 0x176c, 0x4654,
+    0x372a, 0x67f6, 0x1c14, 0x2d38, 0xace7, 0x603e, 0xc901, 0x9f49, 0x6818, 0x494c, 0x6d24, 0x96e5, 0xc0d9, 0x5eb2, 0xa875, 0x19e0,
+    0x66fe, 0x43d6, 0xdc9d, 0x9f17, 0x5066, 0xa845, 0x6aa8, 0x7ab8, 0x3aa4, 0x8901, 0x265e, 0x736e, 0x57a4, 0x17d8, 0xbef5, 0x61d0,
+    0x94d5, 0xb99f, 0xc153, 0x7e6a, 0x9f47, 0xbe91, 0x673c, 0x3356, 0xc0c9, 0x45b6, 0x8f67, 0x5fc4, 0x49d2, 0xe72f, 0x92b3, 0x13dc,
+    0x764c, 0x4910, 0xc2cd, 0x5236, 0x3d74, 0x7892, 0xde0f, 0x1ce6, 0x4c4e, 0x75c0, 0xac01, 0x1c0e, 0x7ed0, 0x970d, 0x7872, 0x23c8,
+    0xac05, 0xa6df, 0x32d6, 0xc54b, 0x28f6, 0x74da, 0xe1d9, 0xc599, 0x6d28, 0x253e, 0x8eb1, 0x5eec, 0x1ad2, 0x99df, 0x6bd2, 0x58e2,
+    0xe683, 0x7d5a, 0x1b48, 0x489e, 0xd175, 0xe7bb, 0x2ee2, 0xab03, 0xe14d, 0xca05, 0x9fcb, 0x4fd6, 0xbb6f, 0x62ba, 0x4a5a, 0xe4e5,
+    0x4f68, 0xa195, 0x671a, 0x4000, 0x5220, 0xb8af, 0x5c66, 0xad97, 0x43aa, 0x2758, 0x62fe, 0x95d1, 0xc0df, 0x81a7, 0x279c, 0x8ba1,
+    0xc4ad, 0x5940, 0xdcd5, 0x2f3a, 0x49f2, 0xeb29, 0x8bb7, 0x50e0, 0xb03b, 0x6f18, 0x5880, 0x9121, 0x556a, 0xdb47, 0x7a36, 0xd0e5,
+    0x367a, 0xc6a1, 0xa40f, 0x6cbe, 0xce97, 0xb4db, 0xe24d, 0xbb1b, 0x28a4, 0x7350, 0xc2d3, 0x8c2b, 0xe2c7, 0x9c27, 0xcff9, 0x3b76,
+    0xab71, 0x4af2, 0x6a46, 0xdc55, 0x920b, 0x1e78, 0xb88b, 0x883d, 0xaab1, 0x2f02, 0x612e, 0xb8e7, 0x9789, 0xae13, 0xb52f, 0x8039,
+    0xcbe7, 0xb9a5, 0xe425, 0x3cfe, 0xba0f, 0x9b65, 0x58b6, 0x83a5, 0x7200, 0xb711, 0x967f, 0x8039, 0x1e6c, 0xa21f, 0x32e8, 0xcd25,
+    0x4c06, 0x2064, 0xbd53, 0x5d84, 0xe0a9, 0xa3c3, 0x3d52, 0xc32b, 0x6b92, 0x592c, 0xc29f, 0xe2d1, 0x6f1a, 0x321e, 0xaacb, 0xd30f,
+    0x1bfe, 0xb8d1, 0x4d92, 0xe5cb, 0x693e, 0xb9c5, 0x2dc4, 0x90df, 0x6bd2, 0x8949, 0x1f2c, 0x4452, 0x718e, 0x96eb, 0xe367, 0xcc23,
+    0x354a, 0x7056, 0xd91b, 0x81b3, 0x94dd, 0xa6b9, 0xd4f9, 0x70d6, 0x8273, 0xb69d, 0x657e, 0x529e, 0xda1b, 0xb4f1, 0x77e8, 0xa4c3,
+    0x2a04, 0x8b1d, 0xce1d, 0x4430, 0x9dd9, 0xca81, 0xb1f7, 0x8ed1, 0x2d04, 0xd663, 0x53a0, 0x48d0, 0xbfab, 0x384c, 0x8c35, 0x8ff1,
+    0x4142, 0xb747, 0x82e3, 0xb115, 0x8d67, 0x9e6b, 0xd37f, 0xbb6b, 0xab87, 0x97fb, 0xc647, 0x6908, 0xa085, 0xc145, 0x6f9c, 0xac75,
+    0x94db, 0xd617, 0xb43f, 0x4d70, 0x8981, 0x1476, 0x3f08, 0x3788, 0xc651, 0xa151, 0x2b44, 0xcf13, 0x433a, 0x1e12, 0x9d65, 0x5684,
+    0xddf7, 0x3594, 0xba3f, 0x22cc, 0x6cdc, 0xd8c9, 0x2eac, 0x539a, 0xce07, 0x4610, 0x6824, 0xbbeb, 0xa2c1, 0xe473, 0x7c28, 0x343e,
+    0xd4c1, 0x811d, 0x33be, 0xdcd5, 0x410c, 0xd343, 0x5588, 0x8085, 0xe47b, 0xa5d7, 0x7160, 0x3186, 0xbdab, 0x825b, 0x276c, 0x5aa8,
+    0xcc83, 0x2d9a, 0x6f0a, 0xb871, 0xd3fb, 0xaa77, 0x9005, 0xb847, 0xc807, 0x642a, 0xd4ad, 0x9c65, 0x5024, 0xc68d, 0x5ae2, 0xe257,
+    0x43a8, 0x6574, 0x7cec, 0xdd4f, 0x50f0, 0x9a87, 0x1664, 0x38d6, 0x5264, 0xd497, 0x7bec, 0xa9e3, 0xbd6f, 0xce55, 0x8841, 0x2fe6,
+    0x6604, 0x9043, 0xd88d, 0xb281, 0x5ff6, 0x7d4a, 0x9c95, 0x6d34, 0x52f2, 0x30c2, 0x3b6e, 0xaf9d, 0xe28f, 0x2b4c, 0x8537, 0xa4b9,
+    0xb31b, 0x228c, 0x7dde, 0xc79d, 0xe695, 0x823b, 0x9bf7, 0xdedf, 0xc9c9, 0x8b49, 0xb60b, 0x1fb6, 0x6db0, 0xd013, 0xa137, 0x7424,
+    0x1e66, 0x3ed6, 0xb3ad, 0x64c0, 0x1444, 0x9c1b, 0x3af4, 0x2af0, 0xe495, 0xbbf9, 0x5062, 0x9f61, 0x202c, 0x94a3, 0x4430, 0x85d7,
+    0x67ae, 0x5af0, 0x7922, 0x2c80, 0x93fd, 0x5f8c, 0x168a, 0x42fa, 0x909f, 0x688e, 0xacf5, 0x1940, 0x5d24, 0x2b10, 0x4f76, 0x6b2e,
+    0x280e, 0xa3a5, 0xc80f, 0xb665, 0x2a64, 0x6b56, 0x5b80, 0x3b36, 0xc855, 0x699a, 0xe5ab, 0x52d0, 0x3cfe, 0xdcb1, 0x1648, 0x4064,
+    0xa255, 0x5db6, 0x1f7e, 0x82f3, 0x721a, 0xaf59, 0xe0a1, 0xa4f5, 0x454a, 0x2e3a, 0xe27b, 0x57ce, 0x3558, 0xc077, 0x5aca, 0x8731,
+    0xe6b1, 0xa80d, 0x79ae, 0x44f2, 0x94f1, 0x8009, 0xba8f, 0x27f8, 0x9b65, 0xcee1, 0x1fc2, 0x8349, 0x5e0c, 0xbb01, 0xd531, 0x561c,
+    0x91cf, 0x3408, 0x8253, 0xd463, 0x71be, 0x9cab, 0x481e, 0xcecd, 0x1c92, 0xbcad, 0xa9cd, 0xb211, 0x2be8, 0x5e56, 0xae79, 0x472e,
+    0x85d7, 0x1d3a, 0xb83d, 0x4c50, 0x4b12, 0x17e8, 0xc695, 0x5aa4, 0x24b6, 0x9709, 0xd187, 0x239e, 0x85ff, 0x3048, 0xc373, 0xeb87,
+    0x77c6, 0x5448, 0xe251, 0x1ffa, 0x4fdc, 0x34cc, 0x78d4, 0x62c8, 0x6872, 0xa2a1, 0x8335, 0xe50f, 0x7cf4, 0x20e6, 0xdc47, 0x7be6,
+    0xc6d3, 0x50f4, 0x29e8, 0xdb6d, 0x70d6, 0x43c6, 0x8557, 0x3034, 0x5e84, 0x190c, 0xe45b, 0x26e2, 0x4fec, 0xdd65, 0x5f8a, 0x3320,
+    0xe15b, 0x7bba, 0x6698, 0xa03d, 0xee65, 0x6fcc, 0x9075, 0xb58b, 0xe503, 0x7a14, 0x5a4a, 0xed25, 0x7dc4, 0x6846, 0xdadd, 0xc98d,
+    0x889f, 0xa807, 0x918d, 0x5028, 0x3f82, 0x9e5d, 0x8779, 0xc04d, 0xb367, 0x1e5e, 0xe8e1, 0x836d, 0x3322, 0xcc27, 0x8eb1, 0x5250,
+    0xa635, 0x199c, 0x64fc, 0x5fae, 0x8305, 0x4582, 0x9421, 0xacfb, 0x26a0, 0x47c2, 0x8a69, 0xdc6f, 0xab23, 0x5562, 0xaf77, 0xdb3f,
+    0xa18b, 0xac93, 0xe569, 0x800d, 0x148a, 0x262c, 0x648c, 0x4312, 0x3384, 0x8b19, 0x7a0c, 0x270c, 0xd775, 0x71a0, 0x2f76, 0xc127,
+    0x7f02, 0x250a, 0x95fd, 0xb7db, 0x4722, 0x899b, 0x801b, 0xab05, 0x316c, 0xb4d7, 0x496a, 0xd80d, 0x5404, 0x3c46, 0xa80d, 0xd537,
+    0xc18d, 0x2506, 0x6a90, 0x87e9, 0x300e, 0x1e80, 0xc2ad, 0xb801, 0x88ad, 0xd69b, 0x7296, 0x5836, 0x8de1, 0x7a9a, 0xd93f, 0x602e,
+    0x312e, 0xd1d7, 0x96dd, 0x258a, 0x3512, 0x8c1b, 0x1d5c, 0x62ea, 0x3b08, 0x4dae, 0x799c, 0xd6f5, 0xb333, 0x2e7e, 0x56c2, 0xc0dd,
+    0xe74f, 0x80a3, 0xc60f, 0x8d23, 0xb48d, 0x77d6, 0xc901, 0x677a, 0x9201, 0x28dc, 0xd593, 0x7f78, 0xbded, 0x6ca2, 0xa573, 0x2ef2,
+    0xdd8f, 0xb901, 0x91e3, 0xe47d, 0x4d6a, 0xbe03, 0x81f5, 0xd521, 0x55b0, 0xc867, 0x80a1, 0x483a, 0xcff9, 0x860d, 0xc715, 0xa0c1,
+    0xe18d, 0x7e8c, 0x39d2, 0x5f5a, 0x4a4a, 0xa747, 0xd1b9, 0x7b56, 0x49d6, 0x18fc, 0xa0cb, 0x8265, 0xcbf9, 0x935d, 0x55b0, 0x6d40,
+    0xd3c5, 0x3fc4, 0x7ad0, 0x595e, 0xcd21, 0x432a, 0x2384, 0xc0b9, 0x84f7, 0xa9df, 0x23d2, 0xcd69, 0x7cba, 0xe345, 0x9507, 0x21c0,
+    0x6674, 0x3dae, 0xd4df, 0xad11, 0x2c6e, 0x4ec4, 0xd903, 0x5edc, 0x70f6, 0x35c2, 0x3d6c, 0x9307, 0x269c, 0x5914, 0x8b5f, 0x783a,
+    0x7140, 0xaa83, 0x5852, 0x96ad, 0x1d4e, 0x57aa, 0xc1f3, 0x7ede, 0x3930, 0x58d2, 0xd829, 0x8765, 0x99b9, 0x38d6, 0x7bbc, 0x4ea6,
+    0xc637, 0x6670, 0x9cff, 0xce79, 0x310e, 0x69ba, 0xdcf1, 0x8b21, 0x3d6c, 0xac13, 0xe80f, 0x7922, 0x9ddd, 0x4b46, 0x5d20, 0x4234,
+    0x160a, 0x687e, 0xc0ad, 0x916f, 0x77e8, 0xd445, 0x2af4, 0xe185, 0x4d38, 0xbaf9, 0x1552, 0xab4d, 0x4f2c, 0x5cc2, 0xa003, 0xa689,
+    0x22fc, 0x64ac, 0x939d, 0x3e68, 0xc2a3, 0x1e9e, 0xdf61, 0x9743, 0xd61b, 0x3f6e, 0x8f9f, 0x72c8, 0x3162, 0x8307, 0xc9c1, 0x984b,
+    0x46b0, 0x21da, 0xbab7, 0x43d0, 0xd327, 0x5630, 0x2690, 0x7e92, 0x4b56, 0x10b0, 0xa7d1, 0x953f, 0x332c, 0xb385, 0x7334, 0x46ac,
+    0x277c, 0xbdd1, 0x7f8a, 0x64da, 0xea9b, 0xc96d, 0x1ee8, 0x632e, 0x74ca, 0x91c5, 0xaf63, 0x3ce2, 0x4836, 0x242c, 0xa887, 0x432a,
+    0xe10b, 0x4f1e, 0xa90b, 0xc437, 0x9905, 0x1b0c, 0xc4ef, 0x6e1c, 0xb4cf, 0x5e2a, 0xcaa5, 0x924d, 0x1afe, 0x63aa, 0x3fda, 0x89eb,
+    0x7258, 0x2ed0, 0x43c8, 0x632e, 0x9011, 0xa143, 0x5d38, 0xb2df, 0xdf53, 0x9cc9, 0x5282, 0x392c, 0xba07, 0x62f4, 0xa1ad, 0x98bf,
+    0x50d6, 0xc97d, 0x617c, 0x36ae, 0xe1a1, 0x6ed0, 0xbd9b, 0xe473, 0x97a5, 0x655a, 0x7f3c, 0x302a, 0x6ac0, 0x7692, 0x1e86, 0x47bc,
+    0xa28f, 0x4ade, 0x3f4c, 0xce67, 0xa849, 0x8f5b, 0x4fae, 0x4108, 0x1f4a, 0x82c3, 0xc9d7, 0x1ed2, 0x37c2, 0xa467, 0xc305, 0x3c32,
+    0x8595, 0xe223, 0x5ac0, 0xa9a5, 0x6b14, 0xba69, 0x47ee, 0x81f5, 0xe805, 0xaa45, 0x9231, 0x423c, 0x8815, 0x466c, 0x36e8, 0xaeaf,
+    0x66fc, 0x22e0, 0x3a72, 0x94ab, 0x5cc8, 0x2406, 0xd909, 0x8069, 0x44c0, 0xac31, 0x8e65, 0x3862, 0x3352, 0xe6c7, 0x810b, 0x4c4e,
+    0x9c21, 0x1efa, 0x3aa4, 0xd3f1, 0x33a2, 0x6768, 0x8afd, 0xae1d, 0x35de, 0x2b14, 0x95e9, 0xb5f5, 0x3c4e, 0x6db4, 0xb085, 0x1b14,
+    0x548e, 0x887d, 0x2a08, 0xc9f5, 0x8981, 0xe201, 0x36ac, 0xaba9, 0x97e7, 0xc1e9, 0xb397, 0x3cfc, 0x244a, 0x76fc, 0xc357, 0xa93d,
+    0x3360, 0x8e6b, 0xcd75, 0xb4a1, 0x378a, 0x73a6, 0x5bc0, 0x3c18, 0xd6f5, 0x62a8, 0x91af, 0xadc5, 0x6638, 0x4a5e, 0xaee1, 0x5328,
+    0xa247, 0x7a08, 0x8e01, 0x1cac, 0xc74d, 0x6954, 0x413a, 0xae31, 0x90a3, 0xe57b, 0xb929, 0xd2d7, 0xa5e3, 0xeacd, 0x37d0, 0x216e,
+    0xc62b, 0xe2f5, 0x43cc, 0xb52f, 0x371c, 0xd6d5, 0x9087, 0xad4f, 0xe24f, 0x306e, 0x661c, 0x5014, 0xdc99, 0xbe1f, 0xd29b, 0x25da,
+    0xe7b1, 0xa4c7, 0x3b34, 0x7b24, 0xc1f3, 0xac41, 0x3cfe, 0x937f, 0x204a, 0xbbbf, 0x5888, 0x3da8, 0x7184, 0xd4ed, 0x9751, 0xc8db,
+    0x9955, 0xaf11, 0x4180, 0xa1eb, 0x6154, 0xbc8d, 0x9457, 0x40ca, 0x8ac3, 0xd0a3, 0x2e04, 0x649a, 0x9627, 0xc111, 0x2c92, 0x43b4,
+    0xe61f, 0xc29b, 0x8463, 0x5eb0, 0xb1d9, 0x777e, 0x5518, 0x6eb2, 0xadcd, 0x5aa6, 0xccb1, 0xba4b, 0xa89b, 0x3e98, 0x1cfa, 0x69ee,
+    0xa669, 0x58a2, 0x8f35, 0x7b8c, 0x3254, 0xbb5d, 0xca97, 0x6a0a, 0xd35d, 0x3c4a, 0x6e82, 0xc0c1, 0x548e, 0x9f13, 0x1e0c, 0x9121,
+    0x5e30, 0x40d8, 0xc98d, 0x1a44, 0xaa3b, 0x82cb, 0x4742, 0xd9b1, 0x35da, 0x5b92, 0xd52f, 0x645c, 0xbf87, 0x9a8b, 0x73e4, 0x5c28,
+    0xcbe7, 0x923f, 0x2468, 0xd033, 0x69c2, 0xdcb1, 0x351c, 0x740a, 0x3fb0, 0x94e9, 0x2b6c, 0x4072, 0x750a, 0xca21, 0xdf6d, 0x5378,
+    0xb595, 0x24ec, 0x853f, 0xc469, 0x533e, 0xdf99, 0xcbb9, 0x80dd, 0x23b0, 0x6556, 0xb139, 0xe237, 0x8f2f, 0x3ed0, 0x1f16, 0xdcb1,
+    0x76c2, 0xd8c9, 0xacbd, 0x1aae, 0x73a8, 0xc70b, 0x2368, 0x474e, 0x6f74, 0xccd3, 0x1ff8, 0xc167, 0xe957, 0x9767, 0xb649, 0x694a,
+    0xe1dd, 0x7980, 0xbcff, 0xe5e1, 0x594a, 0x7146, 0xd77b, 0xe87f, 0x6070, 0xaa33, 0x9a8b, 0xb75b, 0xe505, 0x578c, 0x1bf4, 0x67d8,
+    0x8dd5, 0x4af6, 0x710e, 0xc40d, 0x633c, 0xd425, 0xa53d, 0x3178, 0xc1af, 0x56d0, 0x281c, 0x64ae, 0xe549, 0x9085, 0x7dea, 0xd795,
+    0x9b93, 0x46b8, 0xd0d1, 0xab7b, 0xe195, 0x4c64, 0xb467, 0xa0b1, 0x5af2, 0x2a1c, 0xcc3b, 0x6aa0, 0x5880, 0xbf2b, 0x1cd8, 0xae77,
+    0xcb57, 0x768e, 0x5fe8, 0xafff, 0x9dff, 0x1ebc, 0x5b28, 0xdff1, 0xb0c9, 0x7622, 0xebab, 0x5a00, 0xa4b5, 0xd889, 0x47ba, 0x8f21,
+    0x623a, 0xc383, 0xda1b, 0x980d, 0x6e56, 0xb9ed, 0x1f1c, 0x6288, 0xe0a3, 0x2b74, 0x6e82, 0x5e94, 0xb183, 0x9eb5, 0x4a22, 0x3810,
+    0xdc1b, 0x75e6, 0xa47d, 0x4c02, 0xe3ff, 0xa57b, 0x8ddf, 0xa92b, 0x5596, 0x69f6, 0x4350, 0xc837, 0x2e64, 0x815f, 0x1df2, 0xc3af,
+    0xdc05, 0x3356, 0xb97d, 0x57c2, 0xed97, 0xa7f9, 0x83ad, 0xbfff, 0x15f6, 0x7d88, 0x5176, 0x6098, 0x6fca, 0xb14d, 0x49e6, 0xb673,
+    0x6186, 0x2936, 0x8993, 0xdaad, 0x7e6c, 0x178e, 0x5f6c, 0x46d0, 0x9e87, 0x6d80, 0x93ed, 0xbf13, 0x1af4, 0x57b4, 0xa44b, 0x68a8,
+    0x83ff, 0x2e2a, 0x5936, 0x93f3, 0xea9f, 0x82d3, 0x5f90, 0x5440, 0xae45, 0x6d96, 0x3290, 0xc5f9, 0xa961, 0x24ee, 0xb34f, 0x3704,
+    0x5a90, 0x863d, 0xcb9d, 0x4d0e, 0x1610, 0xc713, 0x559a, 0xbddb, 0x723a, 0x609e, 0x9c7d, 0x3fee, 0xcaa5, 0xdf4f, 0x7cae, 0x56c2,
+    0x95a5, 0x7386, 0x277e, 0xd687, 0x434c, 0xa3d5, 0xc015, 0x3580, 0x2548, 0x986d, 0x6790, 0x4e90, 0x9041, 0xd7bd, 0xbb9b, 0x8b3b,
+    0xcacd, 0xdea3, 0x20f4, 0xa641, 0x6c7c, 0x9a71, 0x7a08, 0xa3c9, 0x906b, 0xb7cd, 0x9f03, 0x2c8a, 0xca87, 0x4600, 0xe2a3, 0x9139,
+    0xdc15, 0xacc7, 0x552e, 0x99e9, 0x3148, 0x56f8, 0xb901, 0xa5a3, 0x279c, 0xc6c1, 0x8b1b, 0x2d42, 0x802d, 0xdbbf, 0xb519, 0x2cbc,
+    0x84d3, 0x7bda, 0x3256, 0x7058, 0x3a80, 0x59fe, 0xa501, 0x9007, 0xd483, 0x79da, 0xe68b, 0xb383, 0x66d8, 0xa297, 0x30e0, 0x9833,
+    0x600a, 0xda9d, 0xacb3, 0xd55b, 0x3438, 0x2d22, 0x71ca, 0x40dc, 0xd055, 0x4b98, 0xbc29, 0x254c, 0x764e, 0x9d1f, 0xc275, 0x5bd6,
+    0x353e, 0x2a1c, 0x8c23, 0x9a83, 0x5b6c, 0x943d, 0x2fa6, 0xa3a5, 0x541e, 0x8163, 0x9afb, 0xb129, 0x435e, 0x5a12, 0xcaff, 0x37d2,
+    0x8a6d, 0x14d6, 0x8fa1, 0x329c, 0x5fbc, 0x1abc, 0xade3, 0x920d, 0x36e0, 0xb9a9, 0x51e8, 0x641a, 0x480e, 0x9ab9, 0xcca9, 0xb767,
+    0x5f1e, 0x9fdf, 0x2bf6, 0x3d44, 0x8227, 0x1cec, 0xd9b9, 0x7276, 0x7a74, 0x1dee, 0xcc11, 0xb29f, 0xbf4b, 0x1a18, 0xc379, 0x2afe,
+    0x8ac3, 0x5634, 0x7218, 0x234e, 0x6252, 0x3e0e, 0x83d1, 0x3b5c, 0xe3bd, 0x77c6, 0x972b, 0xaa25, 0xd477, 0x95fb, 0x68ec, 0x6032,
+    0x4baa, 0xd44f, 0x8081, 0x5626, 0xc0eb, 0x7676, 0xc5ab, 0x499c, 0x1c24, 0x66b8, 0x9ebf, 0x13a6, 0x86bb, 0x2a7a, 0x7700, 0xd03b,
+    0x32a6, 0x9fab, 0x4a06, 0x170e, 0x3620, 0x593e, 0x97c7, 0x41d4, 0x8a9d, 0x53c4, 0xa4a5, 0xd4c3, 0x38de, 0xe4b7, 0x6072, 0x849b,
+    0xbafb, 0x1c50, 0x55ba, 0x21e8, 0x72e0, 0xc55f, 0x1b0e, 0xc0d5, 0xd157, 0x31f0, 0x85b1, 0xbfa9, 0x6222, 0xd7b3, 0xad05, 0x716c,
+    0x459c, 0x56fa, 0x9c4d, 0x4a5e, 0x7204, 0x8c6f, 0x2e14, 0x480e, 0x5732, 0xa85f, 0xc247, 0x33d0, 0x19fa, 0x7cfe, 0x9133, 0xdeb7,
+    0x9c9b, 0x76e6, 0x4d26, 0x6de4, 0xc1ad, 0x9e23, 0xb3d9, 0x2974, 0xc529, 0x24ec, 0xac3f, 0x4084, 0x6d1c, 0x2ad6, 0x92eb, 0x4b76,
+    0x44cc, 0xd74f, 0xb567, 0x1704, 0x4288, 0x22c2, 0xcb13, 0xdfed, 0x8199, 0xd229, 0x84ad, 0x9d3d, 0x2966, 0x76d2, 0x67cc, 0xa0dd,
+    0xe049, 0x7002, 0x31be, 0xdbc5, 0x86a1, 0x6bba, 0x8489, 0xa5d5, 0x2086, 0xd6a7, 0xb7cf, 0x7996, 0x1bb8, 0x6d9c, 0x38ea, 0xaeeb,
+    0xcf0d, 0x4a94, 0xa65b, 0xce9f, 0x2ad0, 0x8dcb, 0x6432, 0xba81, 0xdd49, 0x7a50, 0x305c, 0xdabb, 0x21ce, 0x70f0, 0x6464, 0x4486,
+    0x35d2, 0x7b12, 0xc85f, 0x5028, 0xd51f, 0x3e4c, 0x4704, 0x2030, 0x2f8e, 0x5cd0, 0xdd11, 0x8165, 0x6636, 0x731a, 0xc227, 0x54a0,
+    0x6f42, 0x253a, 0x94b3, 0xe249, 0x7626, 0xc91f, 0x9391, 0x6f04, 0x794a, 0xb61d, 0x4c3a, 0xdd37, 0xa42d, 0x1a5c, 0x3916, 0xcd43,
+    0x4e14, 0xeb81, 0xb171, 0x9e8b, 0x886f, 0xb3ab, 0xc627, 0x4714, 0x1d7e, 0xa6fd, 0x55c8, 0x387a, 0xd283, 0x8731, 0x214c, 0xc5c3,
+    0x65cc, 0x7980, 0x1a5c, 0x8fc3, 0x6b4c, 0xb8af, 0x644a, 0x8bd1, 0xa879, 0x317a, 0x865d, 0x594e, 0xd1c5, 0x3380, 0x808f, 0xb88d,
+    0x94f7, 0x672c, 0xc45f, 0x4ecc, 0xd231, 0xb279, 0x79fc, 0xdeff, 0xc5df, 0x1eb2, 0x38b4, 0x7736, 0x5d94, 0x97ab, 0x2818, 0xa289,
+    0xc825, 0x5d74, 0x49a8, 0xa1b1, 0xd4c5, 0x7a2c, 0x2f4e, 0x98dd, 0x5090, 0x1bca, 0xcad5, 0x2e98, 0x85ff, 0x7962, 0x2ef0, 0xc019,
+    0x2ed6, 0xd135, 0xedff, 0xb215, 0x9e77, 0x4b6a, 0x4466, 0xcb5d, 0xb705, 0x97c3, 0x4b56, 0x8079, 0x3364, 0x54c2, 0xa509, 0x6a8e,
+    0xe2ed, 0xc1af, 0xb765, 0xca59, 0x80f3, 0xbc51, 0x2218, 0xc0ad, 0x5b96, 0xb4eb, 0x1cda, 0x4602, 0x2b5e, 0x976d, 0x3f3e, 0xde0b,
+    0xa4b1, 0x334c, 0x139c, 0x97e3, 0xe739, 0x2a34, 0x8e71, 0xa553, 0x8215, 0xc181, 0xd1e3, 0x4dc2, 0xc9f7, 0x5fac, 0xac0d, 0xe877,
+    0x51de, 0x76d2, 0xac6b, 0x8279, 0xe77b, 0xad81, 0xce2b, 0x768a, 0xda27, 0xbe6f, 0x3e9c, 0x7a7e, 0x892b, 0xccf3, 0x2328, 0x98bb,
+    0x583c, 0xcf27, 0x983b, 0xb34d, 0x86cf, 0x426a, 0x4fc2, 0x8135, 0x72fc, 0xde3f, 0x20a8, 0xa051, 0x48f6, 0x3ce8, 0x912d, 0x7cfa,
+    0xcb43, 0x2b76, 0xe029, 0xb145, 0x3372, 0x20f2, 0xb5db, 0xd4ab, 0xdd1d, 0x6e26, 0x29da, 0x8a03, 0xdb41, 0xc185, 0x320a, 0x6164,
+    0x1b00, 0xd4d3, 0xa5b1, 0x2c2c, 0x5db0, 0x3d4c, 0xd0f7, 0x58b2, 0x8497, 0xb991, 0xeaa1, 0x5462, 0x8c71, 0xcf71, 0xe51f, 0xac27,
+    0xbf2b, 0x840f, 0xcbcb, 0x54ee, 0x8b41, 0x7090, 0x9c53, 0x348e, 0x8671, 0x186e, 0x47e8, 0xe705, 0x57d8, 0xcd87, 0x8d91, 0x434a,
+    0x1c48, 0x4dd2, 0xc009, 0xa1ef, 0x4180, 0x32a4, 0xdab1, 0x2e64, 0x5c36, 0x4ab0, 0x8643, 0xe4fd, 0x4ed2, 0xb505, 0xa50d, 0x6418,
+    0x18a8, 0x3092, 0x92c3, 0x593a, 0x6a14, 0xe367, 0x1c76, 0x93e9, 0x84f1, 0x41e2, 0xbfc5, 0xab0d, 0x5068, 0x9ed9, 0xea97, 0x2ae2,
+    0x99c9, 0xb6c9, 0x6514, 0x7e18, 0x30b8, 0xc3b7, 0x94f7, 0xe657, 0xcd31, 0x712a, 0x1d24, 0x46ce, 0x8f2d, 0x3026, 0xa501, 0x3770,
+    0xc2a3, 0x7e26, 0xb52b, 0x4c00, 0x5fc4, 0x2528, 0x3ef0, 0xe2a5, 0x1a00, 0x95cb, 0x33a2, 0x5ece, 0x6a7c, 0x89fb, 0x5684, 0xa2f1,
+    0x64f6, 0xbea3, 0x2f76, 0x543c, 0xd647, 0x2a48, 0x7832, 0xcd09, 0x5b5e, 0x838f, 0xc4a7, 0x9787, 0x70fc, 0x475e, 0xae1b, 0x858f,
+    0x3c7a, 0xb779, 0x4e10, 0x9b63, 0x4c28, 0xacb5, 0xe4cd, 0x211a, 0xc15b, 0x71c4, 0xcb75, 0x9809, 0xb7c9, 0x5db6, 0x4c24, 0xde11,
+    0x2166, 0x7b5e, 0xe685, 0x3d76, 0x7f4c, 0x1be6, 0x5a4c, 0x42f6, 0x8dd5, 0x58e2, 0xe5a3, 0xc9a1, 0x3224, 0xdb89, 0x7cac, 0x578e,
+    0x73a6, 0xb09f, 0xdf05, 0x82b5, 0x411e, 0xb873, 0xca69, 0x73c4, 0x834b, 0xdbf3, 0x7e12, 0x9fdb, 0xc0a1, 0x5ed8, 0xd1c1, 0x52d8,
+    0x0f66, 0x6af8, 0x78fa, 0x23fc, 0xc15f, 0x7bf6, 0x6214, 0x95c1, 0x34d2, 0x51dc, 0x8f5d, 0xee3f, 0x6c08, 0x4fe4, 0xb917, 0x4078,
+    0x349a, 0x16ec, 0x7c9c, 0x35b0, 0x9177, 0xe263, 0x70a4, 0x9a13, 0x85db, 0x64b2, 0xab19, 0xe36d, 0x7f4c, 0x532e, 0xb551, 0x298c,
+    0x8a5f, 0xbde9, 0x6fcc, 0xcf89, 0x43b6, 0x5dd4, 0x355a, 0xd7df, 0x5d56, 0x3b5a, 0x2dde, 0x70d2, 0xb6cb, 0x7d7c, 0x2088, 0x3a88,
+    0x8941, 0xcbeb, 0x32e4, 0xc2eb, 0x6b90, 0x49d2, 0x8de9, 0x1b0a, 0x3066, 0x660e, 0x9477, 0x1680, 0x44e6, 0x6da2, 0xa84d, 0x4330,
+    0x7922, 0x6d6c, 0x368c, 0xddf3, 0x6bb8, 0xd607, 0x9f15, 0x32e2, 0xb253, 0x7cbe, 0x576c, 0xcba7, 0x85af, 0xdc2f, 0x216c, 0x51fa,
+    0xa317, 0x881b, 0x6b90, 0xc6c5, 0x86ff, 0xd267, 0x6b30, 0x7a1e, 0x39ba, 0x958d, 0x9d69, 0xba2b, 0x5d7e, 0x4136, 0xa289, 0x535c,
+    0x7df0, 0xc9a1, 0x4978, 0x9295, 0xeb8b, 0x7516, 0x8f9d, 0xddd1, 0x6958, 0x34ec, 0x5dc8, 0xa2f3, 0xb171, 0x66fc, 0x3970, 0x1e44,
+    0x6c04, 0x31e4, 0x6900, 0xa22b, 0xe043, 0xbb71, 0x4652, 0xa57b, 0x5e90, 0xbf49, 0xa667, 0x74f6, 0xb14b, 0x4108, 0xddd3, 0xbeb9,
+    0xa9d9, 0x95c1, 0x79ee, 0x5f36, 0xbc25, 0xa41d, 0x5f02, 0xc89d, 0x9825, 0xc3e9, 0x285c, 0x629a, 0x92fd, 0x2a1a, 0xda39, 0x8cf1,
+    0xc5ed, 0xe555, 0x7678, 0xae17, 0x7fec, 0x4fde, 0xc177, 0x5c3c, 0x4c2e, 0xd04d, 0x60f2, 0x8771, 0x3448, 0xcb93, 0xb4ed, 0x805b,
+    0x40e0, 0x901b, 0x1e10, 0x55d6, 0xa197, 0xba1b, 0x5cb6, 0x81f7, 0x457a, 0xbde5, 0xb153, 0xa2c9, 0xcd85, 0xdb97, 0x4d58, 0x92ef,
+    0x228e, 0x58a4, 0x3b26, 0x8c8b, 0xd765, 0xaf4f, 0x797e, 0xc02d, 0x50ba, 0x75d0, 0xd05b, 0xb96d, 0x499e, 0xb1ad, 0xc7f7, 0x858f,
+    0x19cc, 0x56ba, 0x8d49, 0xc5e5, 0x20f8, 0x58ec, 0x9229, 0x3a6c, 0xa1bb, 0x6302, 0x2eea, 0xba6f, 0x1646, 0x50b2, 0xe047, 0xd17b,
+    0x2e5e, 0xe48d, 0x3666, 0x8887, 0xd4df, 0x2702, 0x8091, 0xae0f, 0x53bc, 0x6056, 0x2740, 0x3f98, 0xe55f, 0x1c58, 0x8959, 0xcbed,
+    0x5aec, 0xaaa5, 0xb81f, 0x2b24, 0x6fda, 0xe80f, 0xa10d, 0xbd55, 0xb4b9, 0x6fa6, 0xa70b, 0x4bfa, 0x8dab, 0xbe4d, 0x45f8, 0xe209,
+    0x3bfe, 0x2842, 0xbfd7, 0x4fae, 0x9097, 0x5f6e, 0x4a48, 0xc2a7, 0x3fe2, 0xb03b, 0x6012, 0x3936, 0xe133, 0x39ee, 0x76d4, 0x9b51,
+    0xb525, 0x8edd, 0x57a6, 0x46e6, 0xd99d, 0x3a2a, 0xa81f, 0xe413, 0x1fa6, 0x6a7c, 0xbb69, 0xcd37, 0x2522, 0x94cb, 0xdd59, 0x7ec2,
+    0xa619, 0x6084, 0x5566, 0x9bcb, 0x42e0, 0x6392, 0xa2f3, 0x3e3a, 0xdb5d, 0x2c7c, 0x415c, 0x8d8f, 0xc603, 0x682c, 0xd637, 0x7638,
+    0x95a9, 0x5fca, 0xad05, 0x7d70, 0x4d70, 0xb671, 0x7784, 0xdfaf, 0x57f0, 0xab67, 0x8daf, 0xe2e9, 0x4758, 0x97e1, 0xc02f, 0x6a44,
+    0xa475, 0x1bac, 0x58c2, 0x9a3f, 0x859f, 0x21e0, 0xb71f, 0xd115, 0xaafb, 0x51b4, 0xebcd, 0xb36d, 0xc27b, 0x5de2, 0x95e3, 0xe54b,
+    0xc611, 0xce31, 0x296e, 0x4f10, 0xb4ad, 0x7a12, 0x210a, 0x46b8, 0x9501, 0x3cfe, 0xa835, 0x2b76, 0x6db0, 0xb235, 0x5de2, 0xbec7,
+    0x3990, 0xb39f, 0x11f4, 0x3e38, 0xa74b, 0x5ce2, 0x977b, 0xb025, 0x20f2, 0xe5b9, 0x46e6, 0x8323, 0xca4d, 0x7382, 0xe757, 0xb4ff,
+    0x36ce, 0x60d8, 0xb717, 0x24ba, 0xad9b, 0x4db0, 0x15ca, 0xa64b, 0x43ca, 0x8fef, 0x21f0, 0xd347, 0x3462, 0x7b00, 0xb925, 0x9b6f,
+    0x53f0, 0xce0d, 0x93cd, 0x39aa, 0x2592, 0x6206, 0xc6bd, 0x51a4, 0x7cf2, 0x38f2, 0x617a, 0x24be, 0x9219, 0x563c, 0x7362, 0x2ee0,
+    0x6f4e, 0xcc5b, 0x3650, 0x1dd8, 0xd5fb, 0x9e11, 0x6a6c, 0x4188, 0xb435, 0xa4c1, 0x32b2, 0xbbbb, 0x912b, 0x5084, 0x446e, 0x733c,
+    0x6216, 0xb77d, 0x39f4, 0x2352, 0x9eff, 0xbc5f, 0x32b4, 0xa623, 0x700c, 0xafe3, 0x1c86, 0xbd6b, 0x4462, 0x74c2, 0x1748, 0xcffb,
+    0x5d42, 0xdc8b, 0xc863, 0xe6ef, 0x7c44, 0x6c7a, 0x1300, 0xac71, 0x8fab, 0x53a0, 0x7d0c, 0x37dc, 0x5382, 0x702e, 0xb179, 0x8cdd,
+    0xe849, 0xd4c1, 0xa80f, 0xbfb7, 0x1fd0, 0x95b7, 0x318a, 0x5b16, 0xd643, 0xab97, 0x861d, 0x254c, 0xe4b9, 0x77c0, 0x28e6, 0xdd83,
+    0x93f1, 0x430a, 0xa6cd, 0x7432, 0xcd8b, 0x4cfc, 0x8aff, 0xb7ad, 0xdf01, 0x44c6, 0x86db, 0xeb05, 0xa4cf, 0x3932, 0x6fba, 0x8d11,
+    0x91df, 0x684c, 0xacbb, 0xc8d1, 0x6a30, 0x5580, 0x84c3, 0x4850, 0x9b25, 0xdfc3, 0xab09, 0x7c1e, 0x5568, 0xbd01, 0x74b6, 0x36c8,
+    0x3e82, 0x940f, 0x22e2, 0x5216, 0xcabf, 0x9447, 0x4cee, 0x2074, 0x2fd8, 0xd22d, 0x7ea4, 0x1286, 0xadd9, 0x7398, 0x192e, 0xa4e1,
+    0xcbc7, 0x88b1, 0x66aa, 0x2260, 0xe959, 0xa5f5, 0x347e, 0xdf25, 0x299a, 0x9459, 0x4f22, 0xc6fb, 0x9225, 0x2024, 0xa917, 0xe653,
+    0x4128, 0xcc7b, 0xa68f, 0x904f, 0x733c, 0xc863, 0x2b58, 0x8aaf, 0xa3c3, 0xd78f, 0x2eca, 0x41e0, 0x9c75, 0x86f5, 0x318c, 0xcdf3,
+    0x9267, 0xcf87, 0xeac5, 0xbc19, 0x2a4e, 0xd13b, 0x198a, 0x4b58, 0xd383, 0x7674, 0xbdf9, 0x6068, 0x3008, 0x1410, 0xa83b, 0x3c84,
+    0x66dc, 0xd873, 0x39ca, 0x21d6, 0xa45f, 0xd211, 0x9495, 0x208c, 0xb533, 0x7cd8, 0x2382, 0xa0b1, 0x34b6, 0x5ab2, 0xdbfd, 0x50ac,
+    0x98bf, 0xd7f5, 0xb8cb, 0x4686, 0xdf69, 0x370e, 0x58ec, 0x6e88, 0x863d, 0x9bcf, 0x6424, 0x2588, 0x782c, 0xd69b, 0x30b2, 0x1f5e,
+    0x46a6, 0x8e39, 0xa57f, 0x8001, 0x2368, 0x9c79, 0xeaa3, 0xd143, 0xc069, 0x66ee, 0xe09d, 0x9b29, 0xc435, 0x40c2, 0x8f7d, 0xe877,
+    0x75b6, 0xd601, 0x4c70, 0x7b2a, 0xe72d, 0x217e, 0x4a10, 0x898b, 0x508c, 0xa983, 0x315e, 0x5b12, 0x1f3a, 0x92d1, 0x2b3a, 0x8c91,
+    0x70e6, 0xe047, 0x930b, 0x7620, 0x7094, 0xc30b, 0x31b4, 0xbc83, 0x7f76, 0xd08d, 0x4a26, 0x76b0, 0xbf03, 0x40ce, 0x5cb2, 0xe86f,
+    0x88c1, 0x1f2c, 0xae03, 0xc5f7, 0x7348, 0x8221, 0x23f0, 0x93e1, 0xe45d, 0xbeb7, 0xd629, 0xa255, 0xc29d, 0x19f2, 0x47fe, 0x99f9,
+    0xe2c5, 0x5ba8, 0xb247, 0x7f10, 0x4f60, 0xe73d, 0x1eb8, 0x73ca, 0x53a0, 0xe4c5, 0x675c, 0x76a8, 0xdc5d, 0xcd45, 0xaa31, 0x2518,
+    0x9297, 0x4f4e, 0x8fe3, 0xd449, 0x6720, 0x8837, 0x393a, 0xe1e7, 0x2cb6, 0x9869, 0x6370, 0xea9b, 0x9211, 0x6d88, 0x5050, 0xa7b7,
+    0x32d8, 0x6d9a, 0x960b, 0x4090, 0x2fd4, 0xc913, 0x49a2, 0xdc57, 0x27d4, 0x614c, 0xeec7, 0xccf1, 0x1f30, 0x7b50, 0x275e, 0x4cd0,
+    0x68de, 0x71b2, 0x2afa, 0x55aa, 0x661c, 0x89c5, 0xc8bb, 0x444e, 0x9293, 0x2d22, 0x3654, 0x6130, 0x9979, 0x4d48, 0x2d92, 0xc54d,
+    0x7638, 0xe057, 0xc041, 0x7a14, 0x3e6c, 0xafe9, 0xc0a5, 0x53bc, 0x1e70, 0xc777, 0x5182, 0x7458, 0x66f8, 0x9f93, 0xb7b3, 0x1ef4,
+    0x4d04, 0xbe39, 0x7450, 0x1b52, 0x39b4, 0xb8af, 0x3958, 0xc9d1, 0x79fa, 0x1fbc, 0x8e17, 0xb6b3, 0x2da0, 0xa4cb, 0xdb0d, 0xaf47,
+    0x83e7, 0xe03b, 0x7368, 0xa655, 0xd511, 0x3ccc, 0xa4ed, 0x762c, 0x8523, 0x4776, 0x955b, 0x3408, 0x5a92, 0xd377, 0x61b2, 0x95b5,
+    0x5e70, 0xa5a5, 0x383e, 0x9851, 0x79c8, 0x1792, 0x8689, 0x7d9a, 0xa06b, 0xbf91, 0x19ce, 0x81d9, 0x4810, 0xb0c5, 0x66ba, 0x850b,
+    0x2f52, 0xe03f, 0x1ee4, 0x3aa6, 0xaf25, 0x7a36, 0x5502, 0xc5cb, 0x4ca2, 0x7a1a, 0x62a0, 0xa9b7, 0x58e8, 0xc7b9, 0x6154, 0x4980,
+    0x2034, 0x94db, 0x3d90, 0x6b8e, 0x745c, 0xb471, 0x83bd, 0xa2f9, 0x8f9b, 0x2642, 0xa04d, 0xda7d, 0x9547, 0xb55b, 0xedab, 0x4bee,
+    0xc30d, 0x3542, 0x8de1, 0xd5a7, 0x87e1, 0x5afc, 0x258a, 0x7f6c, 0x4d6c, 0xa95d, 0x63a8, 0xc533, 0xd76b, 0x84cd, 0x3262, 0xbfd3,
+    0x7a62, 0x3528, 0x5524, 0x6e48, 0xb5e1, 0xd7cb, 0x8fc9, 0x4976, 0xd47b, 0x32b4, 0xc6b1, 0x8e43, 0x3ffc, 0xab89, 0x814f, 0x64a6,
+    0xb4b5, 0x57aa, 0x764a, 0xc9db, 0x3fb0, 0xad81, 0x5bba, 0x6b4c, 0x2d94, 0x842b, 0x14a4, 0x4814, 0x77e4, 0x2b40, 0x9cd1, 0x1dee,
+    0x466c, 0x9a6b, 0x5d74, 0x9543, 0xbd8b, 0x34d8, 0xbed5, 0xd437, 0x702a, 0x6f04, 0xd6ad, 0xc2b7, 0x7e8e, 0xaa39, 0x48ca, 0xc865,
+    0x1dc8, 0xa207, 0x2e5e, 0x4934, 0xdcb7, 0x9231, 0x9573, 0x64ae, 0xb13f, 0xe559, 0x8841, 0xa9a5, 0x9719, 0x1600, 0x64c8, 0xaf4d,
+    0xc915, 0x5b6a, 0x4cb6, 0xea83, 0x5438, 0xad1b, 0xd3e3, 0x6ac0, 0x2550, 0x70a2, 0x3edc, 0x531e, 0x8a15, 0xca07, 0xb797, 0x8053,
+    0x21b4, 0x3c44, 0xca93, 0x6e90, 0x28ae, 0xb2fb, 0xbf2d, 0x6472, 0x2102, 0xae0f, 0x44e8, 0x167a, 0xa0d1, 0x38d4, 0x7502, 0xe4d7,
+    0x3738, 0x6776, 0xbf79, 0x2fb6, 0xcdb5, 0x7664, 0x65b8, 0xbff1, 0xd513, 0x7d6e, 0x3346, 0xb143, 0x2dce, 0xd4df, 0xc6db, 0x8d8f,
+    0xb361, 0x4b7c, 0x2284, 0xa881, 0x8f39, 0x583a, 0x9d21, 0xcae9, 0x8227, 0x30c0, 0x9ca3, 0x46be, 0x8df7, 0xd921, 0xa573, 0xc5c1,
+    0x8dff, 0x4236, 0xa1cf, 0xdec1, 0x4c32, 0xb625, 0xe675, 0x6958, 0xa20b, 0xdb9b, 0x8529, 0xb653, 0xce91, 0xa247, 0x6076, 0xa97f,
+    0x47c2, 0x21f4, 0x4f34, 0x30b4, 0x9abb, 0xeaf1, 0x2748, 0x67c0, 0x7d2a, 0xa069, 0xab41, 0x29f4, 0xc4ef, 0xe0f3, 0x353c, 0x7976,
+    0xa1f9, 0x4a9a, 0x852d, 0xd10b, 0xa623, 0x9bc1, 0xda51, 0x64ea, 0xae27, 0x395a, 0xd04d, 0x4e16, 0x67e0, 0x8cd5, 0x5900, 0x2776,
+    0x4d9a, 0xbd71, 0x69b4, 0x8383, 0x1e38, 0x7776, 0x64f2, 0xe017, 0xd285, 0x68fa, 0xc1ad, 0xe271, 0xaeed, 0x8385, 0x2c42, 0xc1bf,
+    0x7696, 0x50d8, 0xd98b, 0xba97, 0xc81d, 0x6988, 0xd023, 0x5088, 0x5ed6, 0xd0bd, 0x7510, 0xe541, 0x606e, 0xc409, 0x231c, 0x5060,
+    0xa0ad, 0x6472, 0x7974, 0xd1a3, 0x56d8, 0x9705, 0x1a96, 0xb5b9, 0x3a30, 0x95ed, 0xd4e7, 0x7d50, 0x1a0c, 0xe5d7, 0x3e72, 0xb089,
+    0x5d14, 0x7a2c, 0x1dd4, 0xbdcf, 0x8c7b, 0x3834, 0xcbff, 0x6734, 0x5608, 0xb539, 0x6aee, 0x4810, 0x5460, 0x6f90, 0x8197, 0x20ac,
+    0x9e81, 0xb805, 0x75da, 0x42c0, 0x68f0, 0xc18b, 0x39b4, 0x6fe8, 0xcbdd, 0xe745, 0x5322, 0x1486, 0x7862, 0x686a, 0xacef, 0x21e6,
+    0x5acc, 0x9211, 0xc9ed, 0x24a8, 0x6542, 0x9fe1, 0x1e9a, 0xb30d, 0x3e38, 0x83ef, 0x5aee, 0xb33b, 0x7066, 0xd4bf, 0x5040, 0x9e5b,
+    0xdd87, 0x160e, 0x9b57, 0xd949, 0x6c2e, 0x8841, 0x35b0, 0x7f18, 0xa651, 0xdd63, 0x55c6, 0xcc8f, 0xbbaf, 0x68c6, 0xd615, 0x8101,
+    0xc917, 0xa9bd, 0x32ba, 0xd6f9, 0x7448, 0x9965, 0x474c, 0xd963, 0x191c, 0xb475, 0x8f4f, 0x521c, 0xe151, 0x3cee, 0x5d34, 0xbdb1,
+    0x64ce, 0xd8b7, 0x557c, 0xb071, 0x29c6, 0xcfb9, 0x573e, 0x3b32, 0x250a, 0x1d74, 0x5066, 0x3ca0, 0xd6df, 0xd953, 0x38d8, 0xb12f,
+    0x2d50, 0x3bd4, 0x7d22, 0x9fb5, 0x2c2a, 0xc2a5, 0x4abe, 0xae75, 0x8857, 0x9bc5, 0x3242, 0xe10f, 0x6762, 0x3bd4, 0xdc39, 0xa625,
+    0x612a, 0x8dbd, 0xd7b3, 0x9f77, 0x551e, 0x89dd, 0x3f28, 0xd07b, 0x8e43, 0xdef7, 0x822b, 0x9401, 0x5bda, 0x258c, 0xb75b, 0x9c81,
+    0xd191, 0xa843, 0x8837, 0x4028, 0xabbf, 0x1dbc, 0x4f96, 0x9071, 0x3de0, 0x56c4, 0x88a5, 0x4ef8, 0x9db9, 0x413c, 0x5f2a, 0x1b8e,
+    0x7bda, 0xe0fd, 0x823d, 0x67e8, 0xd727, 0xbc49, 0x7034, 0x39e6, 0x5f0a, 0xbcc1, 0xb311, 0x6e8e, 0xadf1, 0x5e98, 0x3ad8, 0xd76f,
+    0x1902, 0xaecb, 0xd623, 0x8c4f, 0x5e10, 0x352e, 0x2508, 0x723e, 0x1e02, 0x56ea, 0xbbeb, 0x4844, 0x18c6, 0xd763, 0x8329, 0x3d44,
+    0x79de, 0xb561, 0x8d8d, 0xc123, 0x6050, 0x7ad6, 0x40ce, 0x9099, 0xda8d, 0x30be, 0x5ee8, 0x8eb5, 0x435e, 0x8399, 0x559e, 0xcd1f,
+    0x71fa, 0xdd6d, 0x25bc, 0x54c4, 0xb61f, 0x69f8, 0x490e, 0x29e2, 0xc611, 0x6904, 0x60bc, 0xa5f1, 0xde3b, 0x2194, 0x7500, 0xd197,
+    0x96e9, 0x340e, 0xe217, 0x4076, 0x44fc, 0xba6f, 0xc423, 0x1a38, 0x543e, 0x9ca3, 0x2064, 0x775a, 0xc539, 0x4e0c, 0x3f9e, 0xe2f3,
+    0x2a22, 0xc5af, 0x6532, 0x3e36, 0x5152, 0x930b, 0x426e, 0xa7f7, 0x21a2, 0x43f0, 0x8a83, 0x3ab4, 0x9fdb, 0xa1a5, 0x748c, 0xd8bb,
+    0xc2cd, 0x6c3c, 0x2b1c, 0xc6ed, 0x88b3, 0x44ea, 0xe26b, 0x9a09, 0x64dc, 0x25c2, 0xdc6d, 0x4b5c, 0x8e5d, 0xbe4f, 0x7376, 0xa70b,
+    0xd84b, 0xb4b1, 0xd87f, 0x5eb6, 0x9a39, 0x4630, 0xe1d3, 0x2d86, 0x3cd4, 0xe78b, 0x1fc6, 0xa413, 0xc5ab, 0x28de, 0x8aad, 0xceed,
+    0x688c, 0x56d0, 0xa8c3, 0x1bae, 0xe5a1, 0xb561, 0x9ee5, 0xd4eb, 0x85e7, 0x346a, 0x8f2d, 0x4002, 0xb609, 0x53ae, 0xa8c9, 0x9b47,
+    0x4602, 0xe7f1, 0xa819, 0x7f96, 0x44ee, 0x9049, 0xc32f, 0x6996, 0x720e, 0xe27d, 0x9f7b, 0x17a4, 0x35aa, 0xe137, 0x23ac, 0xb8cf,
+    0x80d1, 0x33b0, 0x2d12, 0x5954, 0xdda1, 0x1e7a, 0xbb47, 0xd2a5, 0x40c6, 0x9325, 0x7122, 0x3aba, 0x8311, 0xa7fd, 0x5690, 0x255e,
+    0x6e44, 0x3d78, 0xab3d, 0x27e0, 0x52cc, 0x7d66, 0x62c6, 0x9383, 0x2e8e, 0x9c33, 0x3b96, 0x20c0, 0xa945, 0x90ed, 0xdd3f, 0x82eb,
+    0x4108, 0xa8c7, 0x74ca, 0x9295, 0x3a38, 0xa157, 0x76e8, 0xdc03, 0x9103, 0xc331, 0x6ba0, 0x764c, 0xa265, 0x4f06, 0x84b7, 0x7f04,
+    0x96c7, 0xd4fb, 0x78b0, 0xb641, 0x172a, 0x5c06, 0x7454, 0x3a3a, 0x597c, 0xbee9, 0xac11, 0x823f, 0x1c50, 0x536c, 0x9389, 0x30ec,
+    0xbee1, 0x71b4, 0x1c1a, 0xa8a5, 0x45d2, 0xb8b7, 0x79ea, 0x9d0b, 0x32be, 0xb62b, 0x3fc2, 0xcaa7, 0xe433, 0x6218, 0x48f2, 0x7d14,
+    0x4f68, 0x17b6, 0xe08b, 0x584c, 0x997d, 0xdde1, 0xc895, 0x9fef, 0x2120, 0xce69, 0xcacd, 0x6f30, 0x84df, 0xe161, 0x9b63, 0x4320,
+    0xccb1, 0xa957, 0xbccf, 0x576a, 0x2cc6, 0x7d14, 0x1b34, 0xaa41, 0xe279, 0x7c3c, 0x13c4, 0x5040, 0xc0ab, 0x310a, 0x7262, 0x4eb0,
+    0x56c8, 0x7bb4, 0x3294, 0x21dc, 0xba4d, 0xa367, 0x9437, 0xb229, 0xca53, 0x6f06, 0x3798, 0xa0fd, 0x54c8, 0x6ce2, 0x2f4c, 0xc417,
+    0xa853, 0xd677, 0x6b9c, 0x14ac, 0x94f1, 0xd1cb, 0xa481, 0x63f2, 0xc573, 0x3d42, 0xb9ad, 0xd513, 0x224c, 0x70e0, 0xa9a3, 0x1e26,
+    0xb89d, 0x9d2b, 0x3278, 0x7bba, 0xe3d5, 0x2132, 0x7f8c, 0xa165, 0x8e69, 0x1b00, 0xb821, 0x85ff, 0x3c8a, 0xbe2b, 0x483c, 0xac2d,
+    0x6e1c, 0x1da6, 0xcda5, 0xb07d, 0xa04d, 0x6b2e, 0x9819, 0x2de0, 0xae09, 0x8e27, 0x38f0, 0x5b68, 0x2902, 0x8b47, 0xb039, 0xa52f,
+    0x6e2e, 0x1cea, 0x8a8d, 0x7ec4, 0x2c1a, 0xb9bb, 0xe0ad, 0x8757, 0x9e09, 0xb643, 0xdc23, 0x688c, 0x2ab0, 0xc935, 0x4466, 0x8bbd,
+    0xad47, 0x4cee, 0x9631, 0xda27, 0x68cc, 0x2d82, 0x7e80, 0xcfb3, 0x59be, 0xb8d5, 0x39ee, 0x982f, 0x6c64, 0x2848, 0x4fcc, 0x7ea4,
+    0x38c0, 0x69d0, 0x2f20, 0xca1b, 0x65de, 0x1e86, 0x960f, 0xbcbb, 0x847b, 0xd157, 0x828f, 0x3bea, 0xd5d5, 0x5cc4, 0x4156, 0xaef9,
+    0x3032, 0x8a9f, 0xd3e1, 0x9341, 0x7a96, 0x3070, 0x4a3e, 0x1e8c, 0xb11b, 0x5f88, 0xa391, 0xd031, 0x938b, 0xe5db, 0x3db6, 0xcd83,
+    0x7258, 0xb40d, 0x1cae, 0xbd83, 0x3428, 0xe55b, 0x5768, 0xacd1, 0x20a4, 0x4e5c, 0xc0f3, 0x6ab2, 0xa7df, 0x6702, 0x7c8e, 0x49aa,
+    0xcbbb, 0x9985, 0xb191, 0xc1e9, 0x86d9, 0x45e0, 0x96af, 0x54da, 0x1ccc, 0x610a, 0xc1e3, 0xaebb, 0x222a, 0xd70d, 0x4f88, 0xba4d,
+    0xe1eb, 0x5db6, 0x8bd9, 0xc2fb, 0xd035, 0x24de, 0xa8e1, 0x7df8, 0xe129, 0x5e22, 0x8309, 0x717a, 0xc97b, 0x169e, 0x7430, 0x307e,
+    0x9055, 0x2f4e, 0xca81, 0x65a6, 0xba63, 0x1d84, 0x7d9e, 0xb8e9, 0x4ce2, 0xa641, 0xe9f9, 0x32d8, 0xbad5, 0x20ac, 0x5cee, 0xc4fb,
+    0x585e, 0x247a, 0xa873, 0x6b8e, 0xe285, 0x9789, 0xa6b1, 0xded7, 0xcfe3, 0x1982, 0x6206, 0xdf13, 0x8c73, 0xbc09, 0x6cf6, 0x4880,
+    0xdd4d, 0x51c0, 0x324a, 0xe7f3, 0x64f2, 0x27d4, 0xd83d, 0x4c42, 0x59de, 0x6aea, 0x2502, 0x7748, 0xb489, 0x8827, 0xa6a5, 0xc569,
+    0x3d78, 0x6d6e, 0xa079, 0x36ba, 0x6ad0, 0x2d58, 0x49c4, 0x7c14, 0x5d74, 0xb237, 0xe7f3, 0x1852, 0x58c4, 0xbc1f, 0x2faa, 0x8863,
+    0x58b8, 0x1540, 0x3330, 0x9355, 0xe415, 0x4606, 0x6810, 0xd289, 0x4fa0, 0x8d53, 0x3e68, 0xca8d, 0x8d05, 0xe54f, 0xa271, 0xce29,
+    0xb86b, 0x7304, 0x96db, 0xc46f, 0x7ad8, 0x5b84, 0xd3ed, 0x50bc, 0x4046, 0x8615, 0xe67d, 0x920b, 0x7e26, 0xb509, 0xe36b, 0x94fd,
+    0x4354, 0x2e6e, 0xdddb, 0x40f4, 0xb4db, 0x5426, 0x28ea, 0x1fa6, 0xe41d, 0x835d, 0x6e66, 0x5406, 0xa60f, 0xe9e3, 0x96a3, 0x3e4c,
+    0xc545, 0x60b0, 0x9107, 0xbc59, 0x4b8c, 0x62d4, 0xbac1, 0xdbe3, 0x57a4, 0xe32f, 0x4960, 0x9435, 0xb15d, 0x6abe, 0xd71f, 0x9163,
+    0xb801, 0x5d56, 0x7c98, 0x5306, 0xd00d, 0x2f9a, 0xe17d, 0x4510, 0x8271, 0x74ac, 0xb8dd, 0xea65, 0xa175, 0xcf21, 0x6a5c, 0x3a98,
+    0xb3ed, 0x9881, 0xc473, 0xe959, 0xa2bd, 0x2264, 0x6890, 0x5d2a, 0xc649, 0x3350, 0x586c, 0xbb0f, 0x7c1c, 0x561a, 0xdd0d, 0x18f4,
+    0x368e, 0xdc57, 0x5a06, 0x1d9c, 0xa1d5, 0xb233, 0x5e40, 0x26e0, 0xa1ef, 0x8c91, 0xadd7, 0x6730, 0xd653, 0x921b, 0xc71b, 0x277a,
+    0xb96b, 0x934f, 0x3b2e, 0x89c7, 0xb90f, 0xa401, 0x5f94, 0x6e60, 0xaecd, 0x4d2a, 0x64e4, 0x9153, 0x8303, 0xa2d3, 0xe381, 0xc1dd,
+    0x4a2a, 0xdb5d, 0x29fe, 0x3c26, 0x5b68, 0xbb05, 0x9149, 0x3ca8, 0x7aac, 0xdad7, 0x2902, 0x6dc2, 0x1f5a, 0x827f, 0x51ca, 0x300c,
+    0x7b0a, 0x4ed2, 0x37bc, 0xd92b, 0x5f02, 0x7af2, 0x2c16, 0x969d, 0xa797, 0xd09d, 0x849f, 0x8ea3, 0x4a2c, 0xc56f, 0xa335, 0x268a,
+    0x6d34, 0xe56d, 0x7272, 0x5de4, 0x2694, 0xa6e7, 0x7748, 0xe0d5, 0xbbfb, 0x9d7d, 0x3220, 0xe7fd, 0x8c67, 0x3fba, 0x7a26, 0x965d,
+    0x38b8, 0x93c5, 0x793a, 0x4946, 0xa739, 0xe827, 0x50ba, 0x3b18, 0xc201, 0x4882, 0xd623, 0xb8ab, 0x679c, 0x4fa0, 0xc6cd, 0xb4eb,
+    0x5482, 0xe135, 0x85f5, 0x8483, 0x534a, 0xe025, 0x67ee, 0x337c, 0xa291, 0x760e, 0x86b5, 0x507a, 0xd057, 0xaeb7, 0x42d0, 0xebf9,
+    0xce0f, 0x4ac2, 0x8ca1, 0x3582, 0xcdd1, 0x8163, 0x4e24, 0x2b84, 0x6b7c, 0x449c, 0x951d, 0xc7fb, 0x3fda, 0xa091, 0x2c32, 0xc541,
+    0x8c4f, 0xb22b, 0x807b, 0xcf77, 0x91a5, 0x8059, 0xb3d3, 0x18a4, 0xc7cf, 0xabb5, 0xe6b1, 0x54ba, 0x3138, 0x1986, 0xd525, 0x2ca2,
+    0xad99, 0x6a3e, 0xd177, 0xbcdf, 0xb16b, 0x87eb, 0xd85f, 0xb7e9, 0x3b3a, 0x6aa4, 0x2f48, 0x4108, 0x9629, 0xca79, 0x66dc, 0x843d,
+    0xe65b, 0xaba7, 0x7174, 0x4c34, 0xc60b, 0xb313, 0x96a5, 0x647e, 0x2b5e, 0xa5d5, 0xdbbd, 0x5c2c, 0x220a, 0x6544, 0x40be, 0x8677,
+    0x2f46, 0xddb5, 0x540a, 0x45ce, 0xe493, 0x7d24, 0x33b6, 0xc1f3, 0x97f5, 0x6758, 0xb653, 0x2674, 0xcc93, 0x403c, 0x1f42, 0x534e,
+    0x723c, 0x5dca, 0xa003, 0x8327, 0x7286, 0xdd37, 0x8693, 0xb131, 0x5b5a, 0x979f, 0x1ddc, 0x8907, 0xc079, 0x3b18, 0x58ae, 0x7c58,
+    0x2f72, 0x6d54, 0xd8db, 0x1eee, 0xa1f3, 0xcd6d, 0x3cb4, 0x7374, 0x2f38, 0xb067, 0x76e8, 0x2772, 0x52e2, 0x6f72, 0x1f7c, 0x43e0,
+    0x3baa, 0xa68d, 0x8d13, 0x15b2, 0x777a, 0x7e8a, 0x6994, 0xa5b7, 0xcf97, 0xd8e1, 0x3052, 0x4be6, 0x7a0e, 0x12ae, 0x5640, 0xd56d,
+    0x56de, 0x5e06, 0x3bbc, 0x4d26, 0x76c0, 0xd363, 0x438a, 0x8bbf, 0x277c, 0x7268, 0xa35b, 0x1f18, 0x91cb, 0xb1e3, 0x5fde, 0x671c,
+    0x754e, 0x90e3, 0xb84f, 0x3ab6, 0x815b, 0xd027, 0xe0c9, 0x92bb, 0x429c, 0x732a, 0x4c6e, 0xc385, 0x3c12, 0xa64d, 0x4f58, 0xdd47,
+    0x61e0, 0xa697, 0x4b9a, 0xe8b3, 0x7532, 0x3d28, 0xd8c3, 0x170e, 0x9aa3, 0x33b4, 0xd929, 0x2820, 0xb139, 0x5246, 0x1db2, 0x6a3e,
+    0x609c, 0x85ff, 0xa2bd, 0xbcbb, 0x72cc, 0xd207, 0xe841, 0x6486, 0xaf07, 0x88a5, 0x49e2, 0xbee9, 0x6476, 0xc8f5, 0x95a9, 0xc50b,
+    0xe27b, 0x8977, 0x6b86, 0xb1d3, 0x93fb, 0xbac9, 0xd753, 0x4336, 0x64dc, 0x3642, 0x526a, 0x25f2, 0xdcfd, 0x7844, 0x90b5, 0x4f32,
+    0xa925, 0x2434, 0x4174, 0x96bd, 0x81c1, 0xd0a1, 0x31a4, 0x6730, 0xcb05, 0x8067, 0x4266, 0x5dd0, 0x680e, 0x21e2, 0xc201, 0xd6f5,
+    0xa4f3, 0x1b3e, 0xd77d, 0x6612, 0x313a, 0x939f, 0x7132, 0xc6a9, 0xa927, 0x1b2a, 0x969d, 0x3526, 0xa859, 0x3e20, 0x8b61, 0xd441,
+    0x67c0, 0x20ca, 0xb771, 0x312e, 0xab69, 0xa2ff, 0xd4bb, 0x5044, 0x2a54, 0xc771, 0x1a70, 0x3f26, 0x7906, 0x92e3, 0x633c, 0x85d7,
+    0x1d98, 0x9b37, 0xbfd9, 0x5866, 0x3fc6, 0x216e, 0xc419, 0xb711, 0x87e5, 0xac51, 0x6fe4, 0x3560, 0x4a36, 0xb231, 0xe845, 0x6a8c,
+    0x1080, 0x5b68, 0x9e13, 0x29f2, 0x3cac, 0x5992, 0xe2e3, 0x97fb, 0x7dce, 0x4966, 0x90fb, 0xc1fd, 0xa007, 0x6cba, 0xb04f, 0x8065,
+    0x4e24, 0xdc89, 0x8c3b, 0x1e16, 0x4f7e, 0x5bda, 0xa38d, 0x2006, 0xd42b, 0x9b77, 0x89e3, 0xd1c9, 0xa571, 0x2578, 0x4c0a, 0xbf87,
+    0x41f6, 0x63fc, 0xd97d, 0x8aef, 0x2fd2, 0x76c8, 0x21dc, 0xca87, 0xb9d7, 0x805f, 0x6cc6, 0x9b9d, 0xb303, 0xa90b, 0x72aa, 0x1efe,
+    0x9bdd, 0x8849, 0xaf45, 0x5cce, 0x1da6, 0x8c23, 0xb1cf, 0x68a6, 0x1e62, 0xd6fd, 0x3958, 0x4cc8, 0xa2f5, 0x61a2, 0x9ba9, 0xc073,
+    0xcf19, 0xad67, 0x387e, 0xc14b, 0x229c, 0x9579, 0x3f10, 0xc985, 0x67c2, 0x4db4, 0xcb63, 0xac75, 0x2b7c, 0x6820, 0xb51f, 0xe693,
+    0x9ced, 0x5274, 0xb02f, 0x7fc2, 0x55b6, 0x9801, 0x2286, 0x883b, 0x5c56, 0xd353, 0x691e, 0xc483, 0xe383, 0xb1df, 0xa035, 0x8083,
+    0xcdff, 0xeca1, 0x4748, 0xc2a1, 0xda8b, 0x3ea0, 0xacc3, 0x4e2e, 0x198e, 0x5b14, 0x910d, 0xaca7, 0xc345, 0x4274, 0x94c3, 0x87eb,
+    0xc0c3, 0x31fc, 0xd05d, 0xab93, 0x63e4, 0x9d7d, 0x378e, 0xc517, 0xe94b, 0x89e3, 0x65a6, 0xdc81, 0x4724, 0x858b, 0x3024, 0xcded,
+    0x4868, 0x9381, 0xc761, 0x6cca, 0x2a6e, 0x4980, 0x3888, 0x6a22, 0xc175, 0xeaf7, 0x27f4, 0x7d40, 0x1a1c, 0x738c, 0xb56b, 0x6728,
+    0x7934, 0xd5d1, 0x19de, 0x98f1, 0x29d0, 0x83e9, 0xcc49, 0x44c6, 0x7d68, 0xbdad, 0x8fbf, 0x68de, 0x4b6c, 0xc85b, 0x8e9f, 0x311e,
+    0x9c1f, 0xc4a3, 0x554a, 0x37d8, 0x80e9, 0x1dbe, 0x9e0d, 0x2cea, 0xc8c3, 0x378e, 0x98fb, 0xe06f, 0xa563, 0x43ba, 0x16a6, 0x9e6b,
+    0x63d2, 0x2938, 0x96fb, 0xccbf, 0x42c0, 0x1f8e, 0x701a, 0x8c2d, 0xc9a5, 0xe7ed, 0x8c7f, 0x4d40, 0xcf81, 0x1bda, 0xaf9d, 0x3aa2,
+    0xd93b, 0x8c81, 0xc725, 0x3d5e, 0xdad5, 0xb93f, 0x4fd8, 0x1670, 0x8d09, 0x3cf4, 0x7060, 0xb809, 0xd357, 0x9e45, 0x72ae, 0x4e7c,
+    0x62ec, 0x3b9e, 0xbbaf, 0x7d3a, 0x2956, 0xbd63, 0x59bc, 0x26a2, 0x7e64, 0x6598, 0xd9e5, 0x7d82, 0xe28f, 0x2780, 0x92a7, 0x3cd0,
+    0x8b4f, 0xa3f1, 0x589a, 0x3b7c, 0x6b0a, 0x1f82, 0x764c, 0xc17b, 0x9997, 0x61d6, 0xb445, 0xe22d, 0xa3bd, 0x2a5a, 0x35c6, 0xabcb,
+    0x6afe, 0x30ea, 0x817b, 0xdcdb, 0xaead, 0x7936, 0x9c29, 0x61d6, 0x414e, 0xe2fd, 0x2198, 0xd22b, 0x860b, 0x5c3a, 0x7bba, 0x9a4d,
+    0x3808, 0xaea7, 0xe06b, 0x6d68, 0xc38d, 0xb6fb, 0x3272, 0x6f78, 0x38ba, 0xb4cb, 0x1e96, 0x5ec0, 0xdc1d, 0x42ca, 0x55b4, 0x68e0,
+    0x32f8, 0xa3bd, 0x27ec, 0x79b8, 0xe831, 0x42c6, 0x6f8c, 0x8b93, 0x5df6, 0x4a58, 0xbc2d, 0x6568, 0x3c24, 0x741c, 0xd617, 0xb911,
+    0x9369, 0x28ac, 0xc813, 0xa373, 0x5b58, 0xdac5, 0x519e, 0x86c9, 0x3ad2, 0x409e, 0x1c52, 0xc05f, 0x358e, 0x4ed6, 0xddc9, 0xc9a1,
+    0x56b4, 0x3e14, 0xc1b7, 0x3352, 0xcea5, 0xa86d, 0x3fc2, 0x513e, 0x93e9, 0xacc7, 0x6d92, 0xc3dd, 0x84a7, 0x33c8, 0xdbbd, 0x8361,
+    0x1c02, 0x8e61, 0x4986, 0xd85b, 0x6534, 0x57a4, 0xab43, 0x792a, 0x8c1b, 0xdb7b, 0x3a0e, 0x5c3a, 0x7d80, 0xd7e3, 0x4926, 0x8c8b,
+    0x2788, 0xc83b, 0x411e, 0x676e, 0x3196, 0xe5f1, 0xb199, 0xc865, 0x459a, 0xa1cd, 0x1f16, 0x8d7b, 0x3d1e, 0x3114, 0xd4f9, 0x58bc,
+    0x2774, 0x66b8, 0x2c88, 0xa8fd, 0x5fb4, 0x8a83, 0x2b78, 0x9ce1, 0x77d8, 0xc435, 0x35aa, 0x64d8, 0x74bc, 0xb4cb, 0xe1b1, 0x1f34,
+    0x74a8, 0xa5a1, 0x8a85, 0x2854, 0xc285, 0x86b1, 0xb43b, 0x536c, 0xa435, 0x4916, 0x3934, 0xca71, 0x6d86, 0xbdc9, 0xa94b, 0xe233,
+    0x1c02, 0x155c, 0x6032, 0xa923, 0xdc2b, 0x776e, 0xbaef, 0x9b65, 0x1ea0, 0x8a8d, 0x612c, 0xac85, 0xdb75, 0x5670, 0x9af3, 0x21c0,
+    0x3ad6, 0xb2e1, 0x6946, 0xc8af, 0xb6f1, 0x5700, 0x6b80, 0x8fc1, 0xcf4f, 0x5e62, 0x3d48, 0xae6b, 0xda53, 0x5df2, 0x8979, 0xd55b,
+    0xb5e7, 0x1c38, 0x428e, 0xd993, 0xb5c9, 0x4d18, 0x762c, 0x5732, 0xbafb, 0x1284, 0x6940, 0x53b2, 0x30ec, 0xb417, 0x6fb2, 0x4c04,
+    0xd239, 0xb04f, 0x216a, 0x5404, 0x3328, 0x7e84, 0xb2ad, 0x53fa, 0x12d6, 0x7df2, 0xbd03, 0x99eb, 0xa719, 0x3aa6, 0x6d54, 0xcec7,
+    0x5ec2, 0x7322, 0xbc07, 0x4c00, 0x1f82, 0x8755, 0x4570, 0xa4fd, 0xe8c5, 0xd1f5, 0x2a78, 0x9999, 0xd83f, 0x39c4, 0x82db, 0x2f42,
+    0xe233, 0x8f01, 0xc651, 0x5ee2, 0x9bfd, 0xd3bf, 0x46b4, 0xb3d3, 0xa1d5, 0x4da2, 0x411a, 0x8971, 0x5040, 0xbcbf, 0x6de8, 0xd357,
+    0x4802, 0xb8e1, 0x8a37, 0xe101, 0xc9af, 0x8bb9, 0x4368, 0x8a43, 0xde6f, 0x3988, 0x7a6c, 0x94a9, 0x5992, 0xd1c9, 0xbb87, 0xe56d,
+    0x60a8, 0xc869, 0x96f9, 0x684e, 0x227a, 0xe655, 0x5a5c, 0x31e4, 0xca4f, 0xa523, 0x5038, 0xb89f, 0xc2c3, 0x2d54, 0x3e00, 0xd647,
+    0x8de5, 0xbe87, 0x4a0e, 0x1b24, 0x65d2, 0xa2db, 0x4cc2, 0xc8dd, 0x6a1e, 0xd76f, 0x82b5, 0x2d8c, 0x7bc4, 0xb97d, 0x926b, 0xe627,
+    0xc385, 0x9dd7, 0x3e0a, 0x6d94, 0xcdaf, 0xcb3b, 0x294e, 0xb5b9, 0xe0b3, 0x2c34, 0x7f1e, 0xafd5, 0xe217, 0x8c3d, 0x2130, 0x56c6,
+    0x8657, 0x48fa, 0x2200, 0x7906, 0x41f6, 0xb853, 0xa881, 0x72a2, 0xe217, 0xb6c5, 0xd371, 0x607a, 0x8379, 0x9223, 0xbd99, 0x3128,
+    0x625c, 0xdd19, 0x95dd, 0x71e6, 0x9eb9, 0x4c40, 0xdb41, 0x84c1, 0xd0eb, 0x2bdc, 0x4314, 0x8f8d, 0xd4e5, 0xb035, 0x4b38, 0x3808,
+    0x6d4a, 0xe505, 0x2990, 0x7efa, 0xb941, 0x469e, 0xe311, 0x17c4, 0x2658, 0xb7c5, 0x9539, 0x3f2a, 0xcbd3, 0x9d8f, 0x15fc, 0xb4d9,
+    0x61e4, 0x7e30, 0xbe65, 0xdf85, 0x9ea5, 0x7b30, 0x520c, 0x6fde, 0x29ae, 0xb4d5, 0xda59, 0x87d7, 0x5b00, 0x6c0e, 0x9593, 0xc00f,
+    0xb38b, 0x8b41, 0x9ae7, 0x5200, 0x6a1e, 0xc077, 0xd461, 0xe26f, 0x6c0c, 0x8d83, 0x2238, 0xdf4d, 0x8acf, 0x30de, 0xa433, 0x5cb0,
+    0x4272, 0xeb8b, 0x6ea8, 0x5070, 0x19be, 0x8c53, 0x6a46, 0x28ae, 0x6d0e, 0xb37d, 0xd50f, 0x9cb7, 0x1c72, 0x5134, 0x4066, 0xa397,
+    0x687c, 0xe721, 0xcd75, 0x4ace, 0x8ff9, 0x1f64, 0x857f, 0x5df8, 0xcdef, 0x4728, 0xb7cb, 0xd311, 0x955d, 0x2f5e, 0xc5c1, 0x82d3,
+    0xcb8d, 0x8c23, 0x3376, 0x5dd4, 0x4594, 0xd349, 0xaef7, 0x31c0, 0x2ade, 0xe66b, 0xa3a1, 0x1c5a, 0x7590, 0x3152, 0xa905, 0x3fe2,
+    0x793c, 0xe52f, 0x9107, 0x6166, 0x9dbd, 0xcdcb, 0x41f0, 0x932d, 0xecf1, 0x8815, 0xd219, 0x8fd7, 0x7f4e, 0xe5bb, 0x90df, 0x64f4,
+    0x38c8, 0x8abd, 0xe323, 0x7966, 0xc07b, 0xd5f7, 0xe5cb, 0x9b0f, 0x3a4e, 0xa7b9, 0x6b7e, 0x307e, 0x6090, 0xc301, 0x882f, 0x9653,
+    0x45e2, 0x1534, 0xa285, 0x9605, 0x6974, 0xd849, 0xbf93, 0x94a5, 0x4fea, 0x6224, 0xa8fd, 0x535c, 0x188c, 0x3fc4, 0xbf7d, 0xafab,
+    0x8307, 0x21f8, 0x4c26, 0xdbd3, 0xacb1, 0x18fa, 0x84a7, 0xea83, 0xd15b, 0x2ea8, 0xb85b, 0xb2e5, 0x1884, 0x9ecb, 0x8085, 0x5dde,
+    0x24a0, 0x70fc, 0xd19f, 0xa15d, 0x25ec, 0x5ea6, 0xb4db, 0xa03b, 0x22d4, 0x61f6, 0x4de2, 0xc349, 0x1b6c, 0x6c34, 0x541e, 0x886b,
+    0x493e, 0xd18b, 0x3c80, 0x4e68, 0xa045, 0x92d9, 0x4754, 0xb5f1, 0x9aa9, 0x7896, 0x1f06, 0x6b5c, 0x91b3, 0xdb8b, 0x204a, 0xb84f,
+    0x5268, 0x31be, 0x71bc, 0x9995, 0xd725, 0x7d9a, 0x886b, 0x2fd6, 0xa8b9, 0x5530, 0xa7e5, 0xc179, 0x4b22, 0xcdaf, 0x19d4, 0x262c,
+    0x75b6, 0xd035, 0x6072, 0xa71b, 0x9559, 0x358a, 0x998f, 0x6710, 0x487e, 0xc2cd, 0x9fdf, 0x1a30, 0x4cce, 0x6e86, 0x9967, 0x3962,
+    0xddef, 0xacbf, 0xbe11, 0x707c, 0xe50b, 0x1968, 0x8e11, 0x24be, 0x5aae, 0x9b69, 0x7a6a, 0x2782, 0xdf3b, 0x4268, 0x687c, 0x7f34,
+    0x9f3f, 0xb39b, 0x4a78, 0x2378, 0xbf31, 0x5aae, 0x70f2, 0x25fc, 0xbdb3, 0x7b8c, 0xe76d, 0x5870, 0x1316, 0x74c2, 0x5daa, 0xab9b,
+    0xc3d9, 0x607c, 0xad35, 0xa961, 0x8d29, 0x3034, 0xc815, 0xa143, 0x4cca, 0x7904, 0xbeaf, 0x21a0, 0x8827, 0x5364, 0x6d2e, 0x3d1a,
+    0xa409, 0x965b, 0x208a, 0x44be, 0x5c98, 0x1d82, 0xba27, 0xdbcd, 0x9751, 0x3736, 0x7960, 0x4b22, 0xcd87, 0xa7bf, 0x19ca, 0x35d4,
+    0x62b8, 0x7632, 0xd085, 0xe101, 0x1bce, 0x3c3c, 0x7e72, 0x33e4, 0x4172, 0xbce1, 0x9f8d, 0x57b6, 0xd305, 0x2182, 0x4c2c, 0xcdfd,
+    0xb257, 0x96e3, 0x4d88, 0xd95d, 0xb463, 0x4304, 0xd1e1, 0xd949, 0x2148, 0x7e9e, 0x591c, 0x2fce, 0x88d9, 0x7c8a, 0xd985, 0x8577,
+    0xb17d, 0x7828, 0x3d76, 0x9531, 0xb691, 0x68fe, 0xcf69, 0xaa23, 0x333c, 0x785c, 0x6bd0, 0x4862, 0x3884, 0x6dbe, 0xe257, 0x499a,
+    0xa3cd, 0x54a2, 0xdd79, 0xab45, 0x74ce, 0x23d0, 0x98d3, 0x83bf, 0xb81b, 0x6774, 0x7e08, 0x9365, 0xcd69, 0x6758, 0xbd39, 0x2398,
+    0x4fe2, 0x6a8c, 0xa82f, 0x2286, 0x6a12, 0x3054, 0xbd99, 0x64c4, 0x4c16, 0xa8ef, 0x2680, 0x4010, 0xb8b5, 0x2544, 0xcadf, 0xad29,
+    0x2dbe, 0xc07b, 0x54ce, 0xa263, 0x8ccb, 0x2c9c, 0x46ec, 0x65b2, 0xc013, 0x4ab0, 0x23c2, 0xcfe5, 0x5ac6, 0xe817, 0x76f0, 0x2dde,
+    0xdd91, 0xc03d, 0x6c76, 0xe027, 0x2edc, 0x604e, 0x74a4, 0x248c, 0x6980, 0x30d8, 0xc0df, 0x8913, 0xe205, 0x69cc, 0x9307, 0x63cc,
+    0xcb5f, 0xa20d, 0x70ec, 0x373c, 0x65ae, 0x7440, 0x4f72, 0x31f6, 0x76fc, 0x8bad, 0x62de, 0xd7d3, 0x692c, 0x3c06, 0xc999, 0xed81,
+    0xab85, 0x1e46, 0x4cd8, 0x33ce, 0x653e, 0xe575, 0x52aa, 0x3092, 0xc4a3, 0xb487, 0xd8af, 0x9fb1, 0x3244, 0x85bf, 0xbbad, 0x1712,
+    0x9757, 0x297e, 0x8433, 0xb455, 0x34a4, 0xd481, 0x751c, 0x1de8, 0xd515, 0x4522, 0x617a, 0xa745, 0x493a, 0x9d29, 0x70ae, 0xa46d,
+    0x7030, 0xde0b, 0x8df3, 0xc65d, 0x3e42, 0x1570, 0xbd89, 0xde75, 0x9697, 0x2112, 0xe3dd, 0x72c8, 0x36bc, 0x9dfb, 0x62b6, 0xa56f,
+    0x4f18, 0x400e, 0xd661, 0x1b30, 0x8089, 0x50f8, 0xc3bf, 0x76da, 0x884f, 0x3838, 0x7066, 0xd0dd, 0x4442, 0xc313, 0xbf21, 0xcbed,
+    0x4632, 0x7726, 0xd183, 0x56e8, 0x9c23, 0x46fa, 0xbfdb, 0x6d6e, 0xcaa7, 0x4228, 0xc09f, 0x8ab1, 0x5aae, 0xa6dd, 0x25ae, 0xda13,
+    0x453a, 0x19d2, 0x67b6, 0x872d, 0xe699, 0x3b4a, 0x9bfb, 0xafd3, 0x525e, 0x5e04, 0xa8f3, 0x9b2f, 0x240c, 0xc3b3, 0x9879, 0xd3d3,
+    0x3460, 0x7f66, 0x43b4, 0xca65, 0x2516, 0x66b4, 0x85eb, 0xd6b5, 0x6658, 0xe717, 0xabfb, 0x570c, 0xe0d3, 0xb509, 0xcd61, 0xe2d5,
+    0x5b6c, 0xd2e7, 0x873d, 0xb10b, 0xcd01, 0x8d85, 0x441c, 0x7f7a, 0x663a, 0x5784, 0xe1c9, 0x23ac, 0xbc31, 0x8233, 0xe0b7, 0x4f52,
+    0xd53b, 0x211c, 0x3626, 0x843b, 0xa3c1, 0x5fce, 0x9e51, 0xab6f, 0x5a9e, 0xde6f, 0x7d46, 0x3d6a, 0xc2bb, 0x8d77, 0x6cb4, 0x7f9c,
+    0x350e, 0x1e5e, 0xb921, 0x7e88, 0x9fef, 0x352a, 0x88ef, 0x5ac2, 0xb8c3, 0x9bc3, 0x462e, 0xe6ef, 0xbe79, 0xc9b3, 0x2710, 0x41ee,
+    0x558c, 0x8fb7, 0xb5bf, 0x2c6a, 0x5326, 0xe2fd, 0x3ad4, 0x4886, 0x9751, 0xc8a7, 0x9bd1, 0x1f1c, 0x8547, 0xad69, 0x606e, 0x14d8,
+    0xd481, 0x22b8, 0x71a2, 0x9339, 0x325c, 0xdc5d, 0x6148, 0x7094, 0xc225, 0x44bc, 0x4e2a, 0x2f30, 0xe3f7, 0x4946, 0x8fa9, 0xa4f7,
+    0xc305, 0x3d40, 0xcee3, 0xb87f, 0x82f3, 0xd911, 0xa99b, 0x32b4, 0x705a, 0xc999, 0x58ae, 0x9f1b, 0x666e, 0x2e16, 0x530a, 0xdfb9,
+    0x96c7, 0x7db2, 0x5f64, 0x3b86, 0x98e7, 0x65ba, 0x20a4, 0xa06b, 0x8bc9, 0xe6b1, 0x937f, 0x87e9, 0xaa17, 0x2230, 0x41e2, 0x9b5b,
+    0xb0f9, 0x372a, 0x7a9a, 0x41f4, 0xacb7, 0xc149, 0x3a50, 0xce5d, 0xa577, 0xb16d, 0x4548, 0x8c67, 0x7c8e, 0xa7b3, 0x3560, 0xd257,
+    0x1cc6, 0x6a0e, 0x913b, 0x2a46, 0xc587, 0xa0c1, 0xba15, 0x66f2, 0xa9d3, 0x48ac, 0x2426, 0xe2eb, 0x5a4a, 0x835d, 0x2d64, 0x9e39,
+    0x64f0, 0xc1d5, 0x9c09, 0x86f5, 0xae69, 0x82b7, 0xd1e1, 0x6d6e, 0x5992, 0x8771, 0x2512, 0x5e6e, 0xbd77, 0xeb43, 0x42dc, 0x627c,
+    0xb715, 0x758c, 0xe559, 0x6600, 0x9a3b, 0xca7b, 0x6dc8, 0xa85d, 0x54d2, 0xb75f, 0xe607, 0xd303, 0x2fb2, 0xc303, 0x5e6c, 0x39f4,
+    0xc43f, 0x2d80, 0xaabd, 0x526c, 0xa805, 0x5760, 0x460c, 0x6f96, 0x7252, 0x3ac2, 0x6120, 0x8777, 0xb1cb, 0xdb17, 0x85c1, 0xcc63,
+    0x8b49, 0xb9b9, 0x7bda, 0x64f2, 0xb3fd, 0x4806, 0xd49f, 0x2148, 0xdec1, 0xab65, 0x585e, 0x97b5, 0x8117, 0x2e9c, 0x617a, 0x77c4,
+    0x1820, 0x8d7d, 0x3750, 0x2ab2, 0xb5e1, 0x825d, 0x3a5a, 0xdc8b, 0x82f7, 0x18be, 0xa445, 0x68c4, 0xccaf, 0x9f9f, 0xc11d, 0x63d4,
+    0x8795, 0xcb27, 0xd80d, 0xa8d1, 0x5d24, 0xc0ed, 0x1e9a, 0x8c6b, 0xdab3, 0x2fb6, 0x3b54, 0xbc9b, 0x6c40, 0xe2d7, 0x44be, 0x1dc6,
+    0x993f, 0x7bcc, 0x607a, 0x580e, 0xd8ab, 0x5d1a, 0x3e7e, 0x8e61, 0x4754, 0x38fe, 0x77a4, 0x19f6, 0x66a2, 0x3258, 0x8b03, 0x4076,
+    0x269c, 0x6e88, 0x4b02, 0x3634, 0x687c, 0xa869, 0xdbff, 0x28d4, 0xb91b, 0x90bf, 0xb259, 0x3f96, 0x970b, 0x2e30, 0x663e, 0xa34d,
+    0x93a7, 0xad83, 0xc323, 0x5860, 0xb6bb, 0x3288, 0xe5c5, 0x5118, 0x1664, 0xc2c9, 0x2c64, 0x6f40, 0xaad5, 0x6296, 0xc369, 0xa14b,
+    0xd6f5, 0x634c, 0x8fb7, 0x2d9e, 0x5cbe, 0xddf1, 0xb1bf, 0x6f76, 0x3ca6, 0xcf4b, 0xa53f, 0x6e5a, 0x480a, 0x6356, 0x956d, 0xc185,
+    0xa7af, 0xd11d, 0x2256, 0x7466, 0x6e3c, 0xa565, 0x1a96, 0x7126, 0xdfb3, 0x5a6c, 0x2adc, 0xe2f1, 0xdb21, 0xbecf, 0x8eff, 0x751e,
+    0xbb0b, 0x6266, 0x4792, 0xae75, 0xbc85, 0x54ba, 0xc965, 0x3a7c, 0x2392, 0xa069, 0xd929, 0x8531, 0xac01, 0x1a00, 0x628e, 0xdd41,
+    0x7f38, 0x8561, 0x3322, 0x4c4c, 0x3efe, 0x58ac, 0x92df, 0xaf17, 0x2586, 0xcccb, 0x73ec, 0xddc3, 0xb2c1, 0x96e5, 0x7df2, 0x5c7c,
+    0x208c, 0xb721, 0xc9f1, 0x1c7a, 0xe2af, 0xc38d, 0xd3eb, 0x7a7a, 0x339a, 0xc9ff, 0x6310, 0xb96d, 0x3916, 0x8d85, 0xcec7, 0x61ee,
+    0x50f4, 0x8ded, 0xcfcb, 0x4906, 0x9fbb, 0x8235, 0x579c, 0xebc7, 0x8ac1, 0x6dda, 0xd1e3, 0x4796, 0x21b4, 0xc5a5, 0x72a6, 0x4194,
+    0x4a52, 0xc6a5, 0xed6f, 0xb69b, 0x4cce, 0xd47f, 0x21c4, 0x3b74, 0xdba3, 0xc817, 0x8045, 0x7bc2, 0xa43d, 0xbca5, 0x47ca, 0x8891,
+    0x4074, 0x7ff2, 0xdbd5, 0x4a70, 0xaefd, 0x1e3c, 0x973d, 0x4154, 0x8fbb, 0xc4d9, 0x7180, 0x442e, 0xa859, 0x953d, 0x74e8, 0xac27,
+    0xc935, 0x54bc, 0x957d, 0x1e68, 0x3b5c, 0x5798, 0x334e, 0x971d, 0x2596, 0x8299, 0x3d7c, 0x6d9e, 0x17fe, 0x8659, 0xdcf7, 0x7d10,
+    0x4466, 0x8e43, 0x62cc, 0x3280, 0xeb49, 0x9bb7, 0xb5d1, 0xc85b, 0x36a8, 0xa447, 0xbdd9, 0x174a, 0x4ca8, 0x275c, 0x55d4, 0x4144,
+    0x3118, 0x9b45, 0x22d8, 0xca2b, 0xe391, 0x2c72, 0xa5bf, 0x5b90, 0x99e3, 0x4d86, 0x24b2, 0xc0f7, 0xeb41, 0xa4d3, 0x93ab, 0x5af2,
+    0xaa7d, 0xeb2d, 0x6908, 0xa053, 0xcb5b, 0x7a58, 0x5986, 0xb081, 0x98d5, 0x29f2, 0x4b9c, 0x6e36, 0x38bc, 0x25fc, 0x77b0, 0xb23f,
+    0x3998, 0x93d1, 0x3db2, 0x29d8, 0x6f4a, 0x9663, 0x42ec, 0x6a34, 0xceed, 0x9333, 0x888b, 0xd409, 0x4d92, 0x84fd, 0x8923, 0x6552,
+    0xbecb, 0xe5a1, 0x3560, 0xbf7f, 0x9e4d, 0xada3, 0xba1d, 0x20fc, 0xc53d, 0xb197, 0x9395, 0xca61, 0x51f0, 0x9ed7, 0x5c8e, 0x801d,
+    0xdb31, 0x9fed, 0xbcf5, 0xe337, 0x1708, 0x551c, 0x7652, 0x4552, 0xc5a3, 0x1e82, 0xccc1, 0x6b64, 0x8c9f, 0xbd23, 0x53b6, 0xd61f,
+    0x6c0c, 0x4104, 0x59a6, 0x92ff, 0x756a, 0xcce7, 0x8e01, 0x79b4, 0xa159, 0x9915, 0x6236, 0x9979, 0x1f7e, 0xe013, 0x2e6e, 0x44c8,
+    0xa495, 0x5664, 0xe4cd, 0xc731, 0x665c, 0x4e7c, 0x9b77, 0x2368, 0x6182, 0x8829, 0x1894, 0x76ee, 0x3434, 0xa21f, 0xd41b, 0x3082,
+    0x3c58, 0x64a6, 0xd73b, 0x8b67, 0xcbf7, 0xb43b, 0x8aa7, 0xc2f1, 0x8333, 0x378a, 0xab19, 0x7c0e, 0x5234, 0x2b20, 0x3bfa, 0x37f6,
+    0xc1d9, 0x9d09, 0xc8fb, 0x4024, 0x84e1, 0x67b6, 0xaabf, 0x8d33, 0xb26d, 0xd1f9, 0x6aac, 0x39a0, 0xb923, 0x7678, 0xccc7, 0x475e,
+    0x1d00, 0xb49f, 0xe2db, 0xa3cb, 0xc341, 0x1e10, 0xe0d1, 0x5a0c, 0x8d6b, 0x3e9e, 0x85fd, 0x49ba, 0x1800, 0xcb31, 0x7296, 0xbab1,
+    0x46e0, 0x8ae7, 0x3c46, 0xa61d, 0x5b60, 0x7866, 0x4236, 0xb025, 0x4c42, 0x1baa, 0x9709, 0x6d50, 0x47be, 0xa7d5, 0xe583, 0x705e,
+    0x1e16, 0xb91f, 0x75dc, 0x26ea, 0xd77d, 0x21dc, 0x9feb, 0x4ae8, 0x0fc0, 0x5b5e, 0xde09, 0x2b60, 0xb2d9, 0x5c9c, 0xd915, 0x9ced,
+    0x8533, 0xae47, 0x3c0c, 0x7b58, 0x5a42, 0xab43, 0x8677, 0xaafd, 0x5e12, 0xa079, 0x19d2, 0x3a9e, 0x3768, 0xe095, 0x644e, 0x192e,
+    0xd2e7, 0xbd7f, 0x31cc, 0x6592, 0x2d92, 0xb8df, 0x6624, 0xd68d, 0x3180, 0xde51, 0x596e, 0xcabb, 0x2e60, 0x553a, 0x1ee6, 0xcf57,
+    0x3020, 0x35f2, 0xd8a5, 0xc009, 0x8175, 0xe34b, 0x8929, 0xd923, 0x6248, 0xc813, 0x9d89, 0x9489, 0xbac1, 0x5344, 0xb28f, 0x9f35,
+    0x193a, 0xbe07, 0xd981, 0x6e7c, 0x8275, 0x2814, 0x8871, 0x576c, 0xdad1, 0x8a8f, 0xd397, 0x9991, 0xdde3, 0x7d4e, 0xc029, 0xafd9,
+    0xea97, 0x71c2, 0x4ce2, 0x92f3, 0x443e, 0x8a9b, 0x7018, 0x38d8, 0x8423, 0xcc5b, 0xb03f, 0x692c, 0x1cd8, 0x3618, 0x4e32, 0xd4cb,
+    0x2b8a, 0xbe87, 0x7efc, 0x4c70, 0x2d9c, 0xdd05, 0x196c, 0x537e, 0xbc75, 0x8be1, 0xedd3, 0xb78f, 0xdb49, 0x876f, 0x49a8, 0x6baa,
+    0xdc3f, 0x5606, 0x7f8c, 0xbb65, 0x60fc, 0xb67b, 0xe041, 0x7aac, 0x5480, 0x18c8, 0xab8b, 0x5bca, 0x2c24, 0xad41, 0x3d18, 0xc4a9,
+    0x501e, 0xa611, 0x1660, 0x8755, 0x2782, 0x7966, 0xe3c7, 0x6770, 0x2656, 0x9da5, 0xbe37, 0x44f0, 0xdbc7, 0x999f, 0x21e4, 0xace5,
+    0xc42d, 0x23dc, 0x5b5e, 0x7ca6, 0x9b19, 0xd315, 0xafa3, 0x34ae, 0xa5b3, 0x752a, 0x2f3a, 0x5ffe, 0xe003, 0x3c88, 0x177e, 0xb32b,
+    0x3160, 0x95e9, 0x26bc, 0xdb5f, 0x49ac, 0x36d2, 0x2136, 0xc79b, 0x4646, 0xdb1f, 0x37fe, 0xcd1f, 0x4c4c, 0x8a1f, 0x74b8, 0xb81d,
+    0x1906, 0x7ec2, 0x40c0, 0xadb1, 0x1e08, 0x7c58, 0xd707, 0xbbc5, 0xe13d, 0x534c, 0xc343, 0xde6f, 0xb077, 0x8519, 0x2236, 0x675e,
+    0x9349, 0xac27, 0x4c86, 0x33e8, 0x58ec, 0x3d26, 0x2b40, 0xd417, 0x6272, 0xa391, 0x4d2c, 0x9705, 0x646e, 0xc941, 0xa5d5, 0xe6b3,
+    0x5baa, 0x7e0e, 0x2300, 0xdc2d, 0x623e, 0x1bb0, 0xd40b, 0x316c, 0x7b58, 0x5b00, 0x15e8, 0x8f9f, 0x5942, 0xabff, 0x382e, 0x9377,
+    0x5252, 0x6ffe, 0x6172, 0x8f11, 0x7734, 0xad3f, 0x6838, 0x7e80, 0x4bb2, 0xda95, 0xad27, 0x7c2c, 0x2e42, 0xe4eb, 0x4032, 0xa547,
+    0xd691, 0x6908, 0xdc7d, 0x889f, 0x4644, 0x25ea, 0x8cf3, 0xca6f, 0x6c1c, 0x85d9, 0x30cc, 0xcee9, 0x7626, 0x18b0, 0x8627, 0xbba5,
+    0x3d32, 0xeaed, 0x9581, 0x5c7c, 0xbc83, 0x619a, 0x7d3e, 0xc5a7, 0x3492, 0xac45, 0x9c29, 0x6e18, 0xa555, 0x392e, 0xb47f, 0x76f0,
+    0x2c50, 0x645e, 0x94b1, 0x18a4, 0x52e4, 0xe0d5, 0x705c, 0x290a, 0x7984, 0xde3d, 0x68e0, 0x97f5, 0xbff1, 0xd163, 0x76bc, 0xa7af,
+    0x54e2, 0x882f, 0x5700, 0xa9cd, 0xe37d, 0x50e8, 0x7df4, 0xafdf, 0x62a8, 0x1844, 0xaef5, 0x9cb1, 0x6f28, 0xddff, 0x4db0, 0x99cb,
+    0x6230, 0x8313, 0x49d0, 0xaca1, 0x6a7a, 0xb05d, 0x233c, 0xa253, 0x7634, 0x4830, 0x2130, 0x5d5c, 0xe86d, 0x3dbc, 0x2a60, 0x65cc,
+    0xdc07, 0x8ca9, 0x9d7b, 0x220a, 0xcc47, 0x6756, 0xc1fb, 0x365e, 0x1ca8, 0x60bc, 0x4aba, 0x6a6e, 0x3912, 0xa181, 0x6b7c, 0x17c8,
+    0x8d31, 0x62b6, 0xd5eb, 0x3728, 0x7cea, 0xbfb9, 0x5944, 0xe8d1, 0xc495, 0x2d78, 0x3ed4, 0x8ba9, 0x7336, 0xd2c1, 0xbadf, 0x88b3,
+    0x6afc, 0x402e, 0x5f12, 0xd251, 0x8f0f, 0x9d7b, 0x43b0, 0xd28b, 0x795e, 0x5b2e, 0xc9ab, 0x182c, 0x5812, 0xa3ef, 0xd483, 0xaae5,
+    0x23e2, 0x6f62, 0xa27f, 0xdcd3, 0x19e0, 0xca89, 0x3bc0, 0x282c, 0xbfaf, 0x75ac, 0xe757, 0x42da, 0xc2f3, 0x7978, 0x9d3d, 0x2740,
+    0x5454, 0x83fb, 0xd285, 0xb517, 0x609c, 0x35b2, 0x4fd4, 0x86df, 0x5626, 0x7488, 0x2b4a, 0x6098, 0xb669, 0x7c9a, 0xcaa9, 0x46cc,
+    0x6772, 0x7ed0, 0xab73, 0x3dac, 0xc141, 0x30ce, 0x869f, 0x5f22, 0xefe9, 0x8f11, 0x4868, 0xb94b, 0xa935, 0x8dc7, 0x767a, 0xcdc3,
+    0x8467, 0xe8ab, 0x78a0, 0xc48f, 0xab19, 0x9c35, 0x6ebe, 0xb3df, 0x61f6, 0x8155, 0x53c8, 0xbc5d, 0xd58f, 0x644c, 0x3a9a, 0xde73,
+    0x5e8c, 0xd113, 0x716e, 0x9b8f, 0xc59b, 0x2a22, 0x4456, 0x6d7e, 0x3302, 0x5626, 0x974b, 0x26ec, 0x3e44, 0x55e2, 0xe477, 0x8403,
+    0x20e6, 0x6bac, 0x9e19, 0xe645, 0xba0b, 0x7cc0, 0x929f, 0x5496, 0x1386, 0xc1d3, 0xd3db, 0x8b09, 0x2122, 0x8343, 0x4db8, 0x6efa,
+    0x28a4, 0xa887, 0x4e00, 0x7876, 0xb60d, 0xbc85, 0x59fe, 0x462c, 0xdf7b, 0x8bf1, 0xbf07, 0xead7, 0x3f4c, 0x82c7, 0xc6cd, 0x8ac5,
+    0xae79, 0xbdff, 0x1e28, 0x424c, 0x3782, 0xd237, 0x251a, 0xa479, 0xb6d1, 0x2448, 0x5f9c, 0xc0ed, 0x9e4b, 0x5b38, 0x86f9, 0x2890,
+    0x75e4, 0x1e36, 0x9973, 0x6f86, 0xcb4b, 0xa3f7, 0x6044, 0xe665, 0x4cac, 0xdecf, 0xb553, 0x45ca, 0xc9f7, 0x9523, 0x30be, 0x50a4,
+    0x7cc4, 0xa36d, 0x1c0a, 0xc501, 0x87c5, 0x3cf2, 0xe1ed, 0x9985, 0xbb87, 0x7b5e, 0x42f6, 0x8107, 0xebcb, 0x5eee, 0x87db, 0x24ee,
+    0xdd1d, 0xc7bd, 0x4a5c, 0x73fa, 0xcec7, 0x3a9a, 0x9159, 0xc2f9, 0x4d24, 0x3adc, 0xcf67, 0xb053, 0x5c7e, 0x25d2, 0x7b7a, 0xa37d,
+    0x26e6, 0xcbed, 0x3e34, 0xc501, 0x9411, 0x72da, 0x2fb8, 0xce81, 0x8aed, 0x43e6, 0x7d62, 0x3a66, 0x8737, 0xc905, 0xabff, 0x8389,
+    0xe973, 0x71f6, 0x1840, 0xc9d3, 0x292e, 0x4da4, 0xb92d, 0x4708, 0xe4ed, 0xbc21, 0x81c7, 0xa8cd, 0x75e2, 0x8697, 0xcaa1, 0x7a6e,
+    0x4e2a, 0x307a, 0x54e2, 0x3c12, 0xa925, 0x48bc, 0xdde5, 0xa1d3, 0x8ff9, 0xb75d, 0xae9b, 0x3e78, 0xbd37, 0x9083, 0xd441, 0x44c4,
+    0x3df2, 0xb459, 0xc70d, 0xa515, 0x6a88, 0xcdaf, 0x186e, 0xa8cf, 0x6eb6, 0x5102, 0xa1a1, 0xdf6d, 0x6010, 0xa94f, 0x64be, 0x2c02,
+    0xa1bf, 0xcca3, 0xa8a3, 0x1a80, 0xb3e3, 0x7096, 0xbe1b, 0xab69, 0x330a, 0x2630, 0x9b25, 0x6b02, 0x7d30, 0x3b10, 0x23fc, 0x90a1,
+    0xbf4b, 0xcc77, 0x32fa, 0x45d2, 0x7f84, 0x5708, 0x9f9d, 0x8cff, 0xbccd, 0x66e2, 0x9c6d, 0x206e, 0x939d, 0xd8cb, 0x7ff4, 0xe4f3,
+    0x993b, 0x6f28, 0x3ebe, 0x5b54, 0xcd9b, 0xa379, 0xc3c9, 0xdba1, 0xbd01, 0xe4e1, 0x500e, 0x80c5, 0x28ac, 0x50a6, 0xea11, 0x3912,
+    0x910f, 0x31a0, 0xe01d, 0x4998, 0x8c21, 0x6bcc, 0xb8a9, 0x4054, 0xd07d, 0x71d8, 0x1ba4, 0xd75f, 0x445a, 0x232a, 0xb9a5, 0x5f2a,
+    0x4692, 0xa30f, 0x1c3e, 0x5d9c, 0x3500, 0x819f, 0xdc3f, 0x558e, 0xb6c7, 0x26da, 0x9a91, 0x7e72, 0x27de, 0x9581, 0xae2b, 0x760a,
+    0x8c61, 0xa1a3, 0x2500, 0x4c9a, 0x66de, 0x8fdb, 0xc087, 0xa7e3, 0xaad1, 0x812f, 0xd467, 0x729a, 0xbc4d, 0x69c6, 0xcdb1, 0xbb5d,
+    0xda43, 0xc189, 0x2bd0, 0x8de5, 0x2240, 0xcd23, 0x6edc, 0xe99b, 0x8351, 0x2c58, 0x7004, 0x3f46, 0xb92d, 0xe1fb, 0xb2fd, 0x8eab,
+    0xc481, 0xdd9b, 0x9a83, 0x44c8, 0x8d97, 0x2882, 0x9721, 0xadb5, 0x6708, 0x2936, 0x4ef0, 0xa13d, 0x257c, 0xd355, 0x618a, 0x3b32,
+    0xe955, 0x3328, 0xceb9, 0xa6f3, 0xc0ab, 0x7da6, 0x3bb2, 0xc919, 0x71e6, 0xd383, 0x72d0, 0x3ea2, 0xb39d, 0x6e40, 0xcabb, 0x4faa,
+    0xc6ad, 0xa74d, 0x5526, 0x33fe, 0xb9b9, 0xd52d, 0x19e2, 0x31ac, 0x937d, 0xaac3, 0x7bbe, 0x5f22, 0xe8a1, 0x5c80, 0xaf0d, 0xdd6f,
+    0x6428, 0x4754, 0x633c, 0xafe5, 0x2ca4, 0x4e26, 0xa0bd, 0x2308, 0x5cf6, 0x51e8, 0xc91d, 0x1dee, 0xc05b, 0x2d18, 0x4aba, 0xb6f9,
+    0x5938, 0x6d2a, 0xdd1f, 0x9097, 0xb14f, 0xb8e1, 0x3c46, 0x6296, 0xbb9d, 0x8a43, 0x72d2, 0x178e, 0x8647, 0x4cfc, 0x3f1c, 0xe8cf,
+    0xb0e1, 0x69e6, 0x9285, 0x1efe, 0x4f12, 0xaddd, 0x3f8a, 0xb85d, 0x5d28, 0xa7cf, 0xd819, 0xb973, 0x6388, 0x25be, 0x196c, 0x3fca,
+    0xc3b9, 0xb649, 0x9c31, 0x7dbc, 0x9451, 0x61c2, 0x31ea, 0x8719, 0x57e0, 0x189e, 0xcbcb, 0x3bae, 0xd1f3, 0x21c8, 0x9a63, 0xc02d,
+    0xb04f, 0x6cb2, 0xc817, 0x8e4b, 0xb905, 0x1776, 0x6e86, 0x5e6a, 0x7a5e, 0x288c, 0xd705, 0x5c48, 0x20f4, 0x535c, 0x9aed, 0x82af,
+    0xdcc9, 0x842b, 0x1fd4, 0x6f8e, 0x4f70, 0x2abc, 0x970f, 0x4886, 0x8e59, 0xdc89, 0x7a96, 0x208e, 0xbb0f, 0x48c8, 0x8e29, 0x24dc,
+    0xe021, 0x57e6, 0x93c1, 0x2e4e, 0x7d0a, 0x5538, 0x1ff2, 0x8d2d, 0x6b7e, 0xd4ab, 0x4702, 0x957d, 0xb8a1, 0xce91, 0x4cba, 0x736c,
+    0x45b2, 0x601e, 0xa8e1, 0x6e08, 0x9eab, 0xba89, 0x64f6, 0x411e, 0xd043, 0x4ae2, 0x36bc, 0x80df, 0xbe4b, 0x5344, 0x2226, 0x3dbc,
+    0xb3f3, 0xc1f7, 0x3326, 0xde3d, 0x777a, 0x8ce9, 0x168c, 0x329e, 0x9fc3, 0x43f0, 0x986f, 0xc903, 0xa945, 0x1630, 0x8e3f, 0x74b6,
+    0xd81d, 0x5250, 0xccc3, 0x70aa, 0x24bc, 0xd4a1, 0x544e, 0x288e, 0x9a27, 0xaf9b, 0x56fc, 0xca25, 0x8000, 0x62f8, 0x8cd1, 0xd98b,
+    0x3c0a, 0x66ae, 0xc657, 0x91ab, 0xd055, 0x59c0, 0x1d42, 0x8b5b, 0x37b8, 0xe049, 0x7798, 0xc3e9, 0x39ae, 0xa571, 0x539c, 0xb7a7,
+    0x3258, 0x46ba, 0xd599, 0xbf69, 0xed9b, 0x79f6, 0x583c, 0xd483, 0x20cc, 0x39da, 0xa4a3, 0x45be, 0xa315, 0x89c7, 0x3870, 0x474e,
+    0x8a71, 0x3f6a, 0x6ea0, 0x6236, 0x4942, 0xa9cf, 0x328c, 0xb7cb, 0xa273, 0x490e, 0xe02f, 0xa61d, 0x5a80, 0x357c, 0x5c82, 0x1b0e,
+    0x39ea, 0x6764, 0x3224, 0xdc35, 0xcd41, 0x6cce, 0x8681, 0xd1bf, 0x40a6, 0xc495, 0xb475, 0x81ff, 0x6f3c, 0x985d, 0x1994, 0x48da,
+    0xbb27, 0x72be, 0x813f, 0x6156, 0xdf59, 0x4d98, 0x89e3, 0x5d36, 0x2f3a, 0x923d, 0x4dbc, 0x24aa, 0xe1c9, 0x9375, 0x1d12, 0xb60d,
+    0x855f, 0x6128, 0xe0ef, 0x27fa, 0x764a, 0x8e7d, 0x6260, 0xa855, 0x773e, 0x4e2e, 0x157e, 0x3202, 0x9461, 0x6556, 0x26e6, 0xce03,
+    0x9713, 0xd017, 0x3b26, 0xe20f, 0x8467, 0xcec5, 0xb2c9, 0x6ffe, 0x8ce9, 0xdd81, 0xac73, 0x4e14, 0x95df, 0x6dae, 0xd0d9, 0xa99f,
+    0x91c7, 0x3e8e, 0xaee3, 0x23c0, 0x7b08, 0x68a6, 0x166a, 0xa01d, 0xeaf3, 0x2fb4, 0xa891, 0x4566, 0xe571, 0xcbed, 0x93b9, 0x3368,
+    0x49b8, 0x77b0, 0xbc01, 0xd62f, 0x6bee, 0x9f19, 0xd27f, 0x2238, 0x6fe4, 0xe9ab, 0x243a, 0x5618, 0x9a6f, 0x7a66, 0xd089, 0x921f,
+    0x4fb4, 0x2cb0, 0x37fc, 0x58f4, 0xe6d7, 0xdde9, 0x9ebb, 0x81e7, 0xb665, 0x67ec, 0x9297, 0x4cba, 0xa405, 0x44f0, 0x580c, 0x3414,
+    0xd22d, 0x23c0, 0xe5ff, 0x645c, 0xd2db, 0x9423, 0x373e, 0xe3bd, 0xcc47, 0x5130, 0x97cf, 0x8523, 0xe92d, 0xb441, 0x292a, 0xc645,
+    0x6960, 0x2bae, 0x900f, 0x4aa0, 0xcb8f, 0xb3a3, 0xe18f, 0x82cf, 0x1f62, 0xbc81, 0x5fca, 0x92f3, 0x2a20, 0x7f0a, 0xd763, 0xbbcb,
+    0x7894, 0x4762, 0xc5f3, 0x6416, 0xe92f, 0xd2b5, 0x4a82, 0x7ff8, 0xe847, 0xadab, 0x54aa, 0xbb3b, 0x3460, 0xdd47, 0x65d2, 0x9c13,
+    0xeb0d, 0x85e7, 0x277a, 0xd7f9, 0x7d68, 0x241c, 0xe601, 0x807b, 0x220a, 0x94a1, 0xdfbf, 0xb869, 0x5f4e, 0x45ac, 0x98b1, 0x6a6e,
+    0xbb63, 0x1d1c, 0x851f, 0xa419, 0x2598, 0x4694, 0x63de, 0x7d82, 0x5dfc, 0x2074, 0xd125, 0x7328, 0xda8d, 0x5ff0, 0xbd31, 0xa5ab,
+    0xb165, 0x1a20, 0x9a3d, 0x659e, 0xafb5, 0xab31, 0x8661, 0xdba3, 0x2792, 0x74f8, 0x3a30, 0x9689, 0xaf81, 0xe2ff, 0x3382, 0xb083,
+    0x95cb, 0x2b26, 0xb8c1, 0x4e78, 0x43b4, 0xad11, 0xc915, 0x7bce, 0xa825, 0x494a, 0x8d4d, 0x5aca, 0x1b7c, 0xd0ed, 0x7f10, 0x2784,
+    0xc205, 0x7d9a, 0x6ae6, 0x3a2a, 0xa217, 0x2b86, 0x3954, 0x6bc0, 0x8ad5, 0xe37d, 0x644c, 0x18bc, 0xdd97, 0x2dc4, 0xa167, 0x5416,
+    0xf15d, 0x8eab, 0xb64f, 0xdddf, 0x825f, 0xc977, 0x3af8, 0x57b8, 0x952b, 0x7b3e, 0x543e, 0x193a, 0x788e, 0xd8f7, 0x9fff, 0xd1c7,
+    0x7cd8, 0xbb9f, 0x7eb6, 0x6026, 0x49c0, 0x38bc, 0xb0f3, 0x1eee, 0x8ded, 0x7bc4, 0x5796, 0x3984, 0xdb65, 0xb1bf, 0xbc0b, 0x6d40,
+    0x90d3, 0x449a, 0x3202, 0x8dad, 0x6f1c, 0x2856, 0xb9fd, 0xe84d, 0x9eb7, 0xb851, 0xc3c1, 0x87fd, 0x60a6, 0x36f6, 0x7770, 0xd99b,
+    0x4156, 0x2d7e, 0x9b0d, 0xbc11, 0x46e0, 0xde1b, 0x56d8, 0x3f62, 0xcbb9, 0xcba1, 0x848b, 0xb983, 0xa8b9, 0x4788, 0x774a, 0xa6fd,
+    0x1b3c, 0x77d2, 0x8a65, 0x5870, 0xbaef, 0x44ca, 0x1d62, 0xcebf, 0x3c2e, 0x3092, 0xaf5f, 0x26f8, 0x798c, 0xd735, 0x8243, 0x150c,
+    0x7822, 0xc893, 0x3256, 0x53ac, 0x5020, 0xd82f, 0xcd61, 0x77fc, 0x8263, 0x5684, 0xd2cb, 0x6e02, 0xa335, 0x7ca6, 0xb731, 0x7080,
+    0xc8fb, 0x8803, 0x3038, 0x424c, 0x7ac6, 0x299c, 0xe045, 0x5fde, 0x43c0, 0x937d, 0x2cb4, 0xc3cb, 0x47c6, 0xe1f1, 0x62b0, 0xa639,
+    0x683a, 0xdd09, 0xcc9f, 0x8735, 0x445c, 0xb7ab, 0x7308, 0x3804, 0xdd77, 0xac25, 0x2be2, 0x7390, 0xccc7, 0xdf57, 0x85f7, 0x89a7,
+    0x4086, 0x9f85, 0x7f02, 0x2730, 0x5160, 0x80cf, 0xaf8d, 0x6656, 0x46e0, 0xb81f, 0x330a, 0x6692, 0xab3d, 0x47a0, 0x68ee, 0x3960,
+    0xa8cf, 0xc5b9, 0x5ebc, 0xe385, 0x8e41, 0x39ce, 0x60c6, 0x6d36, 0x313a, 0xaa17, 0x41ca, 0xd03f, 0x4f54, 0xb20d, 0x3d4a, 0x62c4,
+    0x1cb0, 0x86db, 0xb08d, 0x27a6, 0x40ca, 0xa727, 0xaf03, 0x2de8, 0xc215, 0x20aa, 0x8753, 0x6590, 0x21d2, 0x7f4c, 0xa5cd, 0x1b68,
+    0xb87b, 0x3b98, 0x4f7e, 0x95e1, 0xca37, 0x2e22, 0x6f5a, 0xadf3, 0xbf9b, 0x5804, 0x78c6, 0xceaf, 0x164e, 0xa7ef, 0xd387, 0xde57,
+    0x84ad, 0x4940, 0x5ff2, 0x7f04, 0xb54b, 0xdb8b, 0xb1e7, 0xc32d, 0xcb6f, 0x7a6c, 0x8aa5, 0x3542, 0x3036, 0x7746, 0x432e, 0x489e,
+    0x2732, 0x6530, 0x8b79, 0xe7e9, 0x35c4, 0x3e3c, 0x8ee5, 0x77d0, 0xb52b, 0x4df8, 0xd8ed, 0x2ee0, 0x6aa4, 0x4ab2, 0x0f44, 0x7508,
+    0xd02d, 0x8585, 0xeb5f, 0x7686, 0xa04b, 0x28ba, 0x89dd, 0x64d6, 0xd6d1, 0x35f0, 0xbcf9, 0xb601, 0xda1d, 0x772c, 0x6576, 0xe38d,
+    0x5952, 0x9ad3, 0xb861, 0x8571, 0x19b8, 0x7e7c, 0xbbc9, 0xcc3d, 0x4aa8, 0x7db4, 0xb76b, 0x889b, 0xceb9, 0x6edc, 0x79c4, 0x145a,
+    0xbfab, 0x355c, 0x53f8, 0x9c4f, 0x19f4, 0xe0e9, 0x6e2c, 0x29c6, 0xd5bf, 0xcfef, 0xb057, 0x92f7, 0xc5b1, 0x8971, 0x412a, 0xa787,
+    0x5112, 0x9595, 0x1e44, 0xa7ab, 0xa48b, 0xecd3, 0x6396, 0x506c, 0xab65, 0xe0f9, 0x24e0, 0xc725, 0x5ab8, 0x3e58, 0x31c8, 0xd73b,
+    0xa461, 0xcd33, 0xb3c7, 0x18c0, 0xc133, 0xaf37, 0x8411, 0x1ab6, 0x469a, 0x736c, 0x2522, 0xdd4d, 0xaddf, 0xb823, 0x554a, 0x776a,
+    0x9c4d, 0xb259, 0xd379, 0x7116, 0x14bc, 0x9e0d, 0xbfad, 0x8b09, 0x26dc, 0xe233, 0x5986, 0x2dda, 0xd431, 0xdffd, 0x877f, 0x31cc,
+    0x5a94, 0xb9dd, 0xa011, 0x26d2, 0x67a0, 0x9487, 0x7424, 0x5de2, 0xc5d9, 0x8741, 0x679c, 0xc607, 0xb003, 0x3640, 0x3cbe, 0x58b8,
+    0xeb79, 0x8b9d, 0x9f3f, 0xc551, 0x9a2f, 0x3872, 0xac9b, 0x4346, 0x2722, 0x9557, 0x40cc, 0xb9fd, 0x2ed0, 0x1e9a, 0x5a74, 0x9abf,
+    0x225a, 0x5164, 0xdd31, 0xa6a7, 0xbff1, 0x5812, 0x9653, 0x8201, 0xb91f, 0xa9f1, 0x6c40, 0x83ed, 0x8bc9, 0xb0d3, 0x36dc, 0x813d,
+    0x2132, 0x9ccb, 0x7a40, 0xa959, 0x146c, 0x28be, 0xbfb1, 0x4782, 0x242c, 0xc617, 0x62c8, 0x8569, 0xb6d9, 0x1e3e, 0xaabb, 0x6b2e,
+    0x53ec, 0xb227, 0x9501, 0x6f5a, 0xd1d5, 0x4276, 0xc151, 0x2676, 0xa235, 0x8d9b, 0xd9b3, 0x3d14, 0xd161, 0x8cdb, 0x60c8, 0xb671,
+    0x5646, 0x91b3, 0x6bf2, 0xad3b, 0x2ac6, 0x7af0, 0xc313, 0x53d4, 0xd247, 0x6fa4, 0xbc05, 0x904d, 0x6f9e, 0xeb79, 0xa82b, 0x5aa0,
+    0xd675, 0xa043, 0x7388, 0xd67f, 0x82cd, 0x95fd, 0x745e, 0x35ee, 0x5e18, 0x74ce, 0xd1dd, 0x459c, 0xde53, 0x9bcf, 0x477c, 0x68ee,
+    0x832f, 0xd4b9, 0xa595, 0x3f44, 0xb843, 0x578e, 0x48a0, 0x8a43, 0x2cae, 0x61d2, 0x2f7a, 0x8a15, 0x3910, 0x7e3c, 0x7072, 0x2b6e,
+    0x33d0, 0xa61d, 0xe68b, 0xcd7f, 0x3624, 0x539c, 0x8c09, 0x3df4, 0x1ce2, 0xb147, 0x4bea, 0xa1d3, 0xb795, 0x9eb3, 0xe283, 0xc83b,
+    0x86d5, 0xcf9b, 0x41b4, 0xbe97, 0x7898, 0x13e0, 0x5a38, 0xc77f, 0xa5b7, 0x6758, 0xd0a7, 0x8ea5, 0xbc93, 0x42f0, 0xa1a3, 0xbb1b,
+    0x527c, 0x1d04, 0x5e30, 0x36da, 0xdb27, 0x72a6, 0xb69f, 0x5030, 0x9ee3, 0x1dea, 0x6970, 0x8133, 0x4ca0, 0x3354, 0x8eb1, 0xaee3,
+    0x237a, 0x3ec0, 0xe101, 0x5f86, 0xbe53, 0x75cc, 0xe76d, 0x93db, 0x2628, 0xaa47, 0x3466, 0x51ae, 0x40b8, 0xaf5b, 0xd623, 0x99c7,
+    0x42e4, 0xc4b3, 0x6c12, 0x2c38, 0x42ba, 0x9c9d, 0x8cb9, 0xb95f, 0x2120, 0x5ede, 0x3a1a, 0x2a8a, 0x683e, 0x4b34, 0x1f5c, 0x6c42,
+    0x390a, 0xddbd, 0xc4df, 0x250c, 0x6d12, 0xd29d, 0x3000, 0xbb69, 0x8be5, 0x4ab8, 0x94db, 0x946f, 0xbd41, 0x776e, 0x89e7, 0x7148,
+    0x21a6, 0x5672, 0xe577, 0x60a4, 0x45cc, 0xd7ed, 0x7268, 0x60b8, 0xc969, 0x3c74, 0x6032, 0xa4b3, 0x41a6, 0x2fae, 0x8e61, 0xe437,
+    0x2a4c, 0x6338, 0x88c1, 0x5d92, 0xa0bd, 0x370c, 0xd845, 0x7c4e, 0x693c, 0x9ac9, 0x4844, 0xa9e7, 0x6546, 0x5226, 0x3b12, 0xc5e1,
+    0xebfb, 0x5014, 0x3e72, 0xc60d, 0xe2a5, 0x88b9, 0xa21b, 0x50ce, 0xe81b, 0xa15f, 0x6a6c, 0x48f8, 0xe38d, 0x9065, 0xb181, 0x541c,
+    0xaed9, 0x2128, 0x4464, 0x7322, 0xe577, 0x1ea0, 0x8a97, 0x6ca8, 0xdfff, 0xb5b7, 0x7a44, 0x60cc, 0x89cd, 0xd3d7, 0x4674, 0xe3cf,
+    0xc3c9, 0xac1d, 0x6086, 0x7368, 0x3984, 0xabef, 0x459a, 0x1b4e, 0xc341, 0x3dde, 0xdb25, 0xbef3, 0x4ad6, 0x16f2, 0xcb1f, 0xc4fd,
+    0x4c6e, 0xb53f, 0x5d3a, 0x52a0, 0x8b23, 0xa995, 0x6016, 0x7b0c, 0x87e9, 0x4c2c, 0xd323, 0x3db8, 0x5670, 0x2248, 0x706c, 0xd41b,
+    0xc96f, 0x241e, 0x43e0, 0xb90b, 0x2562, 0x9a3b, 0x6064, 0x89bd, 0x7244, 0x14cc, 0x5610, 0x7412, 0xb0df, 0x1c80, 0xd7b9, 0x8d53,
+    0xdfc1, 0x3ca4, 0x198a, 0xd60b, 0x64a4, 0xb519, 0x9d11, 0xe831, 0xab67, 0x50cc, 0x2bf2, 0x9bef, 0x12d8, 0x602e, 0xccab, 0x8b2d,
+    0x43bc, 0x2d7c, 0x58a4, 0xc023, 0x1b60, 0x5080, 0xe177, 0xb915, 0x9ca3, 0x5370, 0xb217, 0xa08f, 0x5ea4, 0xc50f, 0x3bde, 0xd4d1,
+    0x3070, 0xc3a9, 0x73d4, 0x171a, 0xe11d, 0x9e25, 0xd145, 0xc29f, 0xe3f3, 0xa4ed, 0xb36f, 0x58cc, 0xe871, 0x9857, 0x5828, 0xb737,
+    0x94b5, 0x6624, 0x4a3a, 0x9615, 0x1cf2, 0x66a8, 0xe8b3, 0x988f, 0x6ef4, 0xe2d1, 0x5b80, 0xdacf, 0x674e, 0x4e7e, 0x2624, 0x719a,
+    0xa869, 0x62c4, 0x96c1, 0x5190, 0xcf75, 0xb1ad, 0xda1f, 0x2edc, 0x3c9c, 0x7de0, 0x1f9e, 0x5376, 0x7778, 0xce69, 0xe6f7, 0x8077,
+    0x41e2, 0x9e57, 0xc45d, 0x8df1, 0x4d10, 0xc9f5, 0x1f9e, 0x3b90, 0xe12f, 0x7d8c, 0xcd55, 0x2d4c, 0xa16f, 0xc11f, 0x43ec, 0xbcf3,
+    0x8481, 0x7358, 0xd071, 0x2518, 0x4e50, 0x4626, 0x9f6f, 0x1ede, 0x550a, 0xd8c7, 0x9cc5, 0xca5f, 0x7dec, 0x2b4e, 0x50ac, 0x659c,
+    0x1956, 0x7e14, 0xb1ed, 0xd1b1, 0xb94f, 0x7e68, 0x4ebc, 0xa811, 0x43dc, 0x85ed, 0xe467, 0xbbdf, 0xaad5, 0xce41, 0xea71, 0xbd33,
+    0xc127, 0x5c1a, 0x7658, 0x416c, 0x84cd, 0x9d49, 0x7278, 0x4214, 0xd9ab, 0x666c, 0x274e, 0x674e, 0xa3a5, 0x18c0, 0xe347, 0x665c,
+    0xa317, 0x3c18, 0x8b95, 0x75c0, 0x9939, 0x5674, 0x2ffe, 0xa993, 0xe5fb, 0x923d, 0x59b2, 0xd005, 0x7842, 0xc6d9, 0x62ac, 0x22b6,
+    0xbadd, 0x4ba0, 0x3c16, 0xdd9d, 0x8961, 0x5eee, 0x4a50, 0x2cfe, 0xa3c9, 0x3ed4, 0x880b, 0x7864, 0x1750, 0x91ed, 0x6dca, 0xb589,
+    0x9f37, 0x8261, 0x659c, 0x260c, 0xab99, 0x330e, 0x2e92, 0xb1e7, 0x190c, 0x7a9e, 0x3b20, 0x1972, 0x5cc2, 0x9a15, 0x30fa, 0xc25b,
+    0x6d12, 0x8d35, 0xd291, 0x7d4c, 0xbb71, 0x5b4e, 0xc0fb, 0x54a2, 0xd065, 0x2086, 0x8d37, 0x5174, 0xc73b, 0xab6b, 0x51f2, 0x2e56,
+    0x7ef6, 0x8dc3, 0x1de2, 0xcfdf, 0x89c9, 0xece9, 0x6ff4, 0xcd25, 0x7d10, 0x476a, 0x5da0, 0x22b8, 0x9b0b, 0x6d18, 0x5576, 0x7ff4,
+    0xe577, 0x1f92, 0x36e8, 0xdc2b, 0x73b2, 0xd4a1, 0x9c67, 0xee69, 0xc279, 0x9c35, 0x7570, 0x9221, 0xe933, 0xa8c3, 0x498c, 0x3b68,
+    0xe4fb, 0x7e92, 0x5dd0, 0xd2bd, 0x84b1, 0x7e46, 0xe4cb, 0x4f60, 0xd25d, 0xb791, 0x9fa7, 0x4bf6, 0x5eea, 0x2670, 0x9ecf, 0x6aa8,
+    0x3024, 0x7702, 0xbba9, 0x8a9b, 0x32da, 0x4e12, 0x14cc, 0x285e, 0x89ff, 0x424c, 0x7918, 0xe16d, 0x4590, 0x2fec, 0x8099, 0x24a0,
+    0xb11d, 0xd183, 0x824b, 0xa78b, 0x34a6, 0x604e, 0xccc5, 0x1b0c, 0x866b, 0xe36b, 0x37c2, 0x6d66, 0x1b7e, 0x83fb, 0xb5cf, 0xa23f,
+    0x5238, 0x6b16, 0x8dff, 0x4404, 0x7eca, 0x634c, 0x1c3c, 0x358c, 0x79c0, 0x42a4, 0x5d40, 0xd671, 0xc3bf, 0x2250, 0x3e0e, 0xe08b,
+    0xd0e9, 0x1ff6, 0xbc1f, 0xb1e7, 0x82e1, 0xd093, 0x324e, 0x4ac6, 0x30aa, 0xa3f9, 0x2a14, 0xbd5f, 0x15b8, 0x87f1, 0xcd59, 0x91f3,
+    0x3480, 0xd87d, 0x1fc4, 0x5b56, 0x9cf5, 0x70f2, 0x88c5, 0x6232, 0xc0d5, 0x9def, 0xe829, 0xaff5, 0x2508, 0x8f65, 0x617a, 0x2c46,
+    0x69ee, 0xd549, 0xafab, 0x7756, 0x2cfc, 0x977d, 0x837b, 0xa575, 0x5e7e, 0x8fdf, 0xab17, 0x525c, 0xe7ff, 0x6f10, 0x1718, 0xd19b,
+    0x6a50, 0x2d82, 0x971f, 0xac67, 0x9c5d, 0xd86f, 0x67a8, 0xbe7f, 0x7ea0, 0x6e70, 0x4502, 0xea1b, 0x6212, 0x97cf, 0xdc29, 0xabb9,
+    0xd195, 0x5bba, 0x8dc3, 0x3f92, 0x65f0, 0xe333, 0x3480, 0x6b8a, 0xd1f3, 0x9db1, 0x74f4, 0x5602, 0x8bbf, 0x26c4, 0x6316, 0x7cee,
+    0x8c0d, 0x2d78, 0xa69d, 0xde43, 0x527e, 0xb24f, 0x17d6, 0x5472, 0xaf13, 0x34ba, 0xc835, 0xe0d1, 0x4a34, 0x33c6, 0x9d65, 0xbfff,
+    0x52ac, 0xd46b, 0xbc9b, 0x2fc2, 0x8ebd, 0xd03f, 0x238a, 0xbedb, 0x8949, 0x2d44, 0xb2c5, 0x1b7c, 0x7e02, 0x4e88, 0xa94b, 0xb339,
+    0x84ad, 0xd29d, 0x9805, 0x2f68, 0xbb85, 0xccd7, 0x9709, 0xd293, 0x5c3a, 0xe429, 0xc331, 0xcffb, 0xdb57, 0xa8ad, 0x2b82, 0x5fa8,
+    0x1d20, 0xcf1f, 0x9625, 0xb9df, 0x73a8, 0x5dc0, 0xd1dd, 0x9043, 0x539a, 0xaff1, 0xde71, 0x989f, 0xbe3b, 0x8125, 0xd14d, 0x7626,
+    0xa4af, 0x3476, 0x52ba, 0x3754, 0xa831, 0x2b70, 0x91f5, 0x442a, 0xa237, 0x3214, 0xbefb, 0xe6bd, 0x18ea, 0x7346, 0x921d, 0xa9bf,
+    0x6a36, 0x3d9a, 0xc2af, 0x4c20, 0x247a, 0xb5e7, 0x2f66, 0xa04d, 0x9085, 0x2bb0, 0xa583, 0x8691, 0xe73f, 0xb059, 0x3e38, 0x8ff9,
+    0xa90b, 0x8715, 0xce13, 0xbe41, 0x7a64, 0x2e00, 0x3bf0, 0x6402, 0x2438, 0x18ce, 0xad33, 0x3148, 0x7e44, 0xd3d1, 0x988b, 0x89fd,
+    0x78ec, 0x2f40, 0x9ad3, 0xe249, 0x3840, 0xa9d9, 0x6c88, 0xb68f, 0x3490, 0x81f3, 0xcd23, 0xdb15, 0x93eb, 0xc04b, 0x46d2, 0xcf6d,
+    0x9de7, 0xaa83, 0x4f8c, 0x5d06, 0x9e85, 0xd3fb, 0x7474, 0xb8c9, 0x84b7, 0xce4b, 0xb443, 0xcc5d, 0x9553, 0xaa0d, 0xc579, 0x7198,
+    0x52e8, 0xe08d, 0x91e7, 0x4d28, 0xe46d, 0x7a24, 0x937f, 0x3d2e, 0x65d6, 0x27a6, 0x9309, 0xc04b, 0xd437, 0x5304, 0x91b5, 0x1cd4,
+    0x4402, 0xe6fd, 0xaf8d, 0x2afa, 0xa2d9, 0xc6f7, 0x846b, 0x5168, 0xb501, 0x93d3, 0x1564, 0x828d, 0x707c, 0x9d8f, 0x6650, 0x8549,
+    0x54fa, 0x6f7c, 0x3196, 0x58f8, 0x6b00, 0xa483, 0xbb17, 0xc5db, 0x654c, 0x8725, 0x90c1, 0x45da, 0x7330, 0xb301, 0x43da, 0x5e68,
+    0x431e, 0xbf5b, 0x7b44, 0x2b76, 0xdecf, 0x4152, 0x237c, 0xb119, 0x55e4, 0x31f0, 0x69d4, 0x4ab0, 0x9f6b, 0x3a70, 0x839d, 0xb2fb,
+    0xdedb, 0x3cf6, 0x1536, 0x597e, 0xc2a7, 0x66da, 0xdcf3, 0xb6a1, 0x309a, 0xc3e1, 0x4020, 0x20bc, 0xb4f7, 0x80b9, 0x91c7, 0x628c,
+    0xdfcb, 0x4b78, 0xbc51, 0x720a, 0x3412, 0x7dde, 0x2fb2, 0xae17, 0x41e0, 0xa2ab, 0x2164, 0x73bc, 0x1760, 0xba65, 0x3acc, 0x850f,
+    0xbc4b, 0x764e, 0x2d04, 0xd1cb, 0x86a3, 0x200a, 0xc02b, 0x93db, 0xdaed, 0x1848, 0x433a, 0x3374, 0xd4a1, 0x4010, 0x99db, 0x194c,
+    0x45ce, 0xa96d, 0xd0cf, 0x63a6, 0x326c, 0xc365, 0xd2df, 0x71e2, 0x9fb7, 0x86c9, 0xb64b, 0x771c, 0x5902, 0xd0ff, 0xb371, 0x2ac0,
+    0x78e6, 0x6e1a, 0x1e4c, 0xa3ed, 0x4e4a, 0xb23b, 0x5f56, 0x77a6, 0x4bc6, 0x6e26, 0xe5c3, 0x8e0b, 0xc007, 0x390a, 0xde9d, 0x957f,
+    0x2f8a, 0x764e, 0x56c6, 0xa3b3, 0x46ba, 0x6574, 0x1b82, 0xb779, 0x6d44, 0x2306, 0x5a92, 0x2ea2, 0x3ef0, 0x85dd, 0xc907, 0xe139,
+    0x41be, 0x33aa, 0x5818, 0xe585, 0x490a, 0x9ce3, 0xe3d5, 0x6ad0, 0xbb2d, 0x3706, 0xa617, 0xd147, 0x69e2, 0x483e, 0x372c, 0x1f38,
+    0xe13f, 0xba73, 0x8437, 0x18b4, 0xdcc5, 0x66bc, 0x8915, 0xdd5f, 0x7d54, 0x52a6, 0x6ffa, 0x9d05, 0x3a02, 0xb475, 0xde5d, 0x3922,
+    0xd0f5, 0x78ea, 0xaa3f, 0x5d06, 0x93bb, 0x68e4, 0x3cec, 0x5aba, 0xe0bf, 0xc1e7, 0xd6ff, 0x4594, 0x3286, 0x65ca, 0xd477, 0x276e,
+    0x685e, 0x3f82, 0x55d0, 0x9b5f, 0x22e0, 0x4798, 0xcadd, 0xa7d9, 0x5506, 0x83eb, 0xd56d, 0x4a30, 0x5a20, 0xbced, 0x157a, 0x638e,
+    0xb8bb, 0xa5a5, 0x448c, 0x69b2, 0x4d72, 0x1a38, 0x965d, 0x28a8, 0x49b2, 0x67ae, 0x392a, 0x1dae, 0xa6e3, 0x8237, 0x32a8, 0x568a,
+    0xb2b1, 0x2b82, 0xe07f, 0xc9eb, 0x815f, 0xb207, 0xde31, 0x6062, 0x36b6, 0x659e, 0x184e, 0x521e, 0x6cb0, 0x3fba, 0xe585, 0x9bcd,
+    0x612e, 0x3a48, 0x1374, 0x6a70, 0xb4f7, 0x2af8, 0xc34f, 0xab2d, 0xd92d, 0x5bba, 0xc9a9, 0x4986, 0x6040, 0x77f4, 0xe4d5, 0x6e0a,
+    0xc05d, 0x8cc9, 0x3ba6, 0xd259, 0xbb89, 0x337c, 0xa9ed, 0x7006, 0xdd45, 0xcbcf, 0x2bea, 0xac39, 0x4ba8, 0x35d0, 0xbd15, 0x2f4c,
+    0xab4f, 0xa151, 0x9319, 0xe433, 0x149c, 0x46c6, 0x8d7b, 0x79d4, 0xce17, 0xb235, 0xe6b1, 0x6d58, 0x32a6, 0xce8f, 0xedcd, 0xa6c5,
+    0x77ce, 0xca39, 0x92ef, 0xab6f, 0x5926, 0xbe63, 0xa311, 0x7e34, 0xdbab, 0xa7f9, 0x80d7, 0xd749, 0x60ec, 0xcd2d, 0x4ee8, 0x2584,
+    0x9a55, 0x6ffc, 0x86f7, 0xe4c3, 0xb989, 0x3eee, 0x7188, 0x1484, 0x496c, 0x96a1, 0x784c, 0xd357, 0x6918, 0x8747, 0x38bc, 0xc0cf,
+    0xa6a7, 0x17ca, 0x836f, 0xe719, 0x219e, 0xc98d, 0x8d53, 0x542c, 0xe40d, 0xd1c9, 0x89d9, 0xb81b, 0xac03, 0x5822, 0x6c66, 0x3cb0,
+    0x2248, 0xe311, 0xaa4f, 0x48b0, 0x9aa5, 0x5922, 0xab21, 0x3cd6, 0x5e98, 0x7910, 0xbc15, 0xc659, 0x9b95, 0x751e, 0xbc3f, 0xdf0b,
+    0x6c2e, 0x3c28, 0x838f, 0x1a50, 0x8f65, 0xa7a9, 0x4930, 0x2b1a, 0xdf11, 0x5316, 0x3acc, 0x1e48, 0x7fca, 0xa773, 0x64ee, 0x3f98,
+    0x91c3, 0xa375, 0x53a4, 0xdea9, 0xc9f9, 0x7076, 0xe377, 0x1bdc, 0xa0d9, 0xaf9d, 0x34a4, 0x5738, 0x9e83, 0x243c, 0x67de, 0x42a0,
+    0x5b74, 0xde0d, 0x8eff, 0x2518, 0xd19d, 0x7996, 0x852f, 0xa84f, 0x42de, 0x7e44, 0xa481, 0x9273, 0x4d2e, 0xb127, 0x5b32, 0x91a3,
+    0x7b44, 0xc223, 0xa60f, 0x87f5, 0x16b0, 0x3af8, 0x7b68, 0x2106, 0x43c0, 0x7212, 0x5c00, 0x1c92, 0x2d66, 0xa4eb, 0x8d3d, 0x9725,
+    0x62cc, 0x463a, 0xd1e1, 0x9ae7, 0xc239, 0x4b38, 0xc939, 0x2186, 0xaa15, 0x2e5e, 0xd325, 0x88e3, 0x4c90, 0x2694, 0x626e, 0x4784,
+    0xbd1b, 0x2b10, 0xdbef, 0xb6e7, 0x799a, 0xc183, 0xda2b, 0x81e9, 0x1cd0, 0x6686, 0x7362, 0x927d, 0xc595, 0x8701, 0xb68b, 0x511e,
+    0xce37, 0xab55, 0x2dc4, 0x76b6, 0xe5d3, 0xbef1, 0x88ef, 0x78a2, 0xb713, 0xe103, 0x73ea, 0xc307, 0x2718, 0x7f44, 0x4612, 0xccbd,
+    0x51bc, 0x2364, 0xbf65, 0x9477, 0xd535, 0x7ea0, 0xdcd3, 0x9059, 0xa989, 0xe9cb, 0x920d, 0x57d6, 0x7132, 0xe9d1, 0xc0b7, 0x81d1,
+    0x644a, 0x6aa2, 0x8e53, 0x1cce, 0x3868, 0x2d1e, 0x4786, 0x8caf, 0xac79, 0xe241, 0x2a4a, 0x8895, 0xd78d, 0x2a2e, 0x58d0, 0x1fb8,
+    0x8be9, 0xc3d3, 0xa469, 0xd275, 0x8a87, 0x5d06, 0x9a8f, 0x4948, 0x7a4a, 0xac3b, 0x80b3, 0x9fd3, 0x2b14, 0x3ad0, 0xa961, 0x2810,
+    0xcc89, 0x9ef9, 0x4acc, 0x79ca, 0x5db8, 0x43e4, 0xe53b, 0x2376, 0x34cc, 0x64f6, 0x88e3, 0xe90d, 0xd331, 0x9913, 0x84b7, 0xe117,
+    0x3f18, 0x5da4, 0xd639, 0xc2d5, 0x39c0, 0xd6db, 0x5da4, 0x1dc0, 0x3e5a, 0x19f4, 0x541e, 0xbd5f, 0x9dcb, 0x5c82, 0x9697, 0x1b08,
+    0x4ad6, 0x2eb8, 0x6812, 0xd667, 0x3558, 0x8337, 0xd075, 0x4498, 0x1a4c, 0x8c97, 0x29d6, 0xbe7b, 0x70b0, 0xa92f, 0xbb3b, 0x7886,
+    0xc803, 0xa511, 0x4f16, 0x294c, 0x9b2d, 0x374e, 0xcecb, 0x8eab, 0xe557, 0x6f84, 0xb9e5, 0x395e, 0xcbed, 0x4b7e, 0x20f6, 0x7294,
+    0xb4c3, 0x38e4, 0x61d8, 0xa86d, 0x4690, 0xd8b7, 0x74be, 0x1324, 0x9a0d, 0x5c5a, 0x47f6, 0x35e8, 0xd411, 0x9411, 0xdfa1, 0xa367,
+    0x5944, 0x54a2, 0xbd0b, 0x6402, 0x8335, 0xc62f, 0x2cbe, 0x7216, 0xa2cd, 0x2d06, 0xe75d, 0x7002, 0x5c9c, 0x2242, 0xcec5, 0x5ab6,
+    0xc4e3, 0x9a35, 0xdbeb, 0x5988, 0xe379, 0x6afc, 0x82cf, 0xbd9b, 0x6908, 0xa0d7, 0xd51d, 0xbec9, 0x962f, 0xda39, 0x2510, 0xc6a3,
+    0xeddd, 0xb7c5, 0x600c, 0x3d06, 0x7b04, 0x3140, 0x98f9, 0x3bcc, 0xd3e1, 0xc921, 0x3e14, 0x63fa, 0xdee5, 0xae6f, 0x7920, 0xccd7,
+    0xb72f, 0x3066, 0xc197, 0xa4f1, 0x6466, 0x435e, 0x37d0, 0xc52f, 0xdc5d, 0x6b4a, 0xd909, 0xcb6d, 0x6c38, 0x23ea, 0x3530, 0x9eb9,
+    0x68ca, 0xcd2f, 0x2cc4, 0x62c6, 0xc755, 0xb1c1, 0x948f, 0xc9df, 0xa0ad, 0xe33d, 0x8687, 0xb995, 0xc9e5, 0x5d04, 0xecdb, 0xc609,
+    0x7a32, 0x2cee, 0xad1b, 0x5c5e, 0x6e6e, 0x3656, 0xa257, 0x5e6e, 0x8b29, 0xc62b, 0x519e, 0xa5b3, 0x7fd6, 0xc177, 0xa603, 0x81dd,
+    0x9785, 0x5352, 0x40ea, 0x87e1, 0x34c0, 0x184a, 0x9283, 0xa4ab, 0x4bc4, 0xb01f, 0x380a, 0x211c, 0x5c86, 0xa047, 0x1ba2, 0x89f5,
+    0xe6f7, 0x8303, 0xbc93, 0x6baa, 0x924d, 0x53a6, 0x1714, 0x9217, 0x314c, 0x3cb0, 0x8909, 0xa3b5, 0xa5fb, 0x3fd4, 0xe241, 0x779a,
+    0xa069, 0xd9f3, 0x7bb4, 0x2912, 0xa963, 0x4a20, 0x3f20, 0xc7ed, 0x785a, 0xbaff, 0x29da, 0xb077, 0x4b64, 0x2fa0, 0x8dd3, 0x17a0,
+    0xd33b, 0x408c, 0xa245, 0x6a78, 0x99db, 0xc395, 0x7736, 0x1750, 0xb1a1, 0x5902, 0x95cf, 0xbce1, 0xa97b, 0x7c38, 0xce35, 0xae43,
+    0xd821, 0x7ac4, 0x2762, 0x5030, 0x3e42, 0xd8a1, 0x328a, 0x1d3a, 0xc4a9, 0x3718, 0x1442, 0x8f91, 0xd037, 0xbbc1, 0x9729, 0x5a4c,
+    0x35ca, 0x7606, 0x190c, 0xdcef, 0x9423, 0x66e2, 0x974d, 0xbb63, 0x9c3d, 0x7bd8, 0x5070, 0x3b5a, 0x57ac, 0x16d2, 0x8b33, 0xce61,
+    0x6e34, 0x1f64, 0x4a10, 0x819d, 0x62f0, 0xada7, 0xb1a3, 0x8101, 0xdf95, 0x97ed, 0x3844, 0xd2f1, 0x4b8c, 0x241c, 0x7122, 0x8077,
+    0xc5e7, 0xdef1, 0x409a, 0x9c5b, 0x706e, 0x215e, 0x5998, 0x693e, 0xc4a1, 0xb7af, 0x5e80, 0x3a2e, 0x1e1c, 0xd7ad, 0x68d8, 0x1afc,
+    0x4020, 0x5c20, 0xd213, 0x830f, 0x64c2, 0x9113, 0x5c1c, 0xa83f, 0x2a7a, 0x9cfd, 0x8681, 0x153a, 0x9fdd, 0xb45b, 0xdadb, 0x8be7,
+    0xd0c7, 0x32e4, 0xc6a9, 0x8ef7, 0x52a8, 0xb9e9, 0x670a, 0x412a, 0xd6e3, 0x28d4, 0x9d85, 0x7e48, 0x626a, 0x4416, 0x2dba, 0x7f82,
+    0xc62f, 0x8e23, 0x3722, 0x1c30, 0xb415, 0x550c, 0xdc51, 0x9e81, 0xc063, 0x52a0, 0x8b3d, 0x34f6, 0xa64b, 0x4918, 0x8597, 0x3072,
+    0x70b6, 0x2224, 0xb4ab, 0x7968, 0x3f8c, 0x25b6, 0xcc01, 0x3b66, 0x879d, 0x184a, 0x6c46, 0x44dc, 0x2c50, 0x5ebe, 0x4cf8, 0x716e,
+    0x3688, 0x1650, 0x98bd, 0x71f6, 0x284a, 0x8809, 0xb961, 0x5708, 0x75bc, 0x8dbb, 0x1eb2, 0x7f7e, 0xc7eb, 0x4f72, 0x1a28, 0x8863,
+    0x9f17, 0x4c08, 0x6af4, 0x82ff, 0xeb6f, 0x9589, 0xce6d, 0x5ab6, 0x2c60, 0x41ae, 0x1abe, 0x782a, 0xabbd, 0xd65b, 0xe9e7, 0xb277,
+    0x12a2, 0x430a, 0x9505, 0x79d0, 0xd5f5, 0x367a, 0x6d26, 0x5692, 0xac79, 0x3800, 0x4ce2, 0x9243, 0x6c66, 0x4096, 0xb2af, 0x19b0,
+    0x4f8a, 0xd1bf, 0x73a4, 0x879d, 0x237e, 0xe7cb, 0xba85, 0x4a92, 0x3f3a, 0x987b, 0xb431, 0x227a, 0xe00f, 0x4164, 0xd243, 0x1a8c,
+    0x748a, 0xe913, 0x220c, 0x6cb0, 0xcdb1, 0xe21d, 0x5452, 0x2e5a, 0xc74d, 0xa763, 0x7b34, 0xbd93, 0xdf75, 0x504c, 0x6c7a, 0x367c,
+    0x5f30, 0x1ace, 0x4aa0, 0xd5f1, 0x394c, 0xab1b, 0xcf03, 0x6b3a, 0xbf1d, 0x4c42, 0x1e28, 0x752a, 0x54b2, 0xb803, 0x9b39, 0x77da,
+    0x3150, 0x5c02, 0x84cd, 0x6326, 0xb5fd, 0xc313, 0x67b4, 0x57de, 0x1c00, 0x4780, 0x814d, 0xd39d, 0xa64d, 0xc349, 0x6b7e, 0x43e2,
+    0xa2ed, 0xcda9, 0x53c4, 0xe96b, 0xbac3, 0x5c8a, 0xdb91, 0x809d, 0x71bc, 0xd0b9, 0x7306, 0x3c04, 0x607e, 0x4416, 0x95a5, 0x349e,
+    0x482c, 0x5b2a, 0xb871, 0x9dcd, 0x6ece, 0xba1d, 0x8379, 0x8ccb, 0xe771, 0x6048, 0x965b, 0xeaab, 0x5660, 0x68f4, 0x4fe0, 0xdae9,
+    0xaf61, 0x66ec, 0xbef5, 0xab2d, 0x266e, 0x3d70, 0xd065, 0x594e, 0x4b52, 0xc40d, 0xbc99, 0x92f3, 0x7958, 0xb7e5, 0x44ea, 0x517c,
+    0xaafd, 0xb7a7, 0x93c5, 0xca11, 0x29de, 0x9753, 0x356c, 0x4bda, 0xc21f, 0x650a, 0x6cc4, 0x8abf, 0x8bfd, 0xc5e7, 0xdcd7, 0x3c40,
+    0xb003, 0x9725, 0x5e26, 0x4806, 0xbb5d, 0xec37, 0x98fb, 0xaec5, 0x34fe, 0x784a, 0xe4e7, 0xa0df, 0x7dca, 0x4e20, 0x9081, 0xe68d,
+    0xad9d, 0x2d9e, 0xc04b, 0xdf09, 0x1e70, 0xb531, 0xc2a3, 0x8151, 0x535c, 0x495e, 0xc89d, 0x5020, 0x7aa8, 0x8f21, 0x2b98, 0x6260,
+    0x516e, 0x976f, 0xdbcb, 0x6fb4, 0x23b4, 0x9f85, 0xaa57, 0xbf07, 0x8dbd, 0x6a7e, 0xc3c7, 0xe261, 0x228a, 0xc677, 0xb4b5, 0x70e2,
+    0x1518, 0x9bcf, 0xdf4d, 0x746e, 0xd461, 0x8ac3, 0x3178, 0x69f0, 0x40b6, 0xb0eb, 0xcbf1, 0x1d70, 0x9ed3, 0xdfa5, 0xbebf, 0x8ed3,
+    0xad39, 0x5626, 0x5148, 0xc2cd, 0x9e6f, 0xafb1, 0x9659, 0x5b0c, 0xb62b, 0x7942, 0xe895, 0xb529, 0x78e0, 0xac8f, 0xbf45, 0x8b93,
+    0xd693, 0x4dd2, 0xd359, 0xc577, 0xe273, 0xa7b5, 0x6dc2, 0xd33f, 0x29a2, 0x6d28, 0xdcd9, 0xacd9, 0x30de, 0x9467, 0xe2ab, 0x6344,
+    0x2446, 0xd80d, 0x3c3e, 0x2ca8, 0xb979, 0x1e08, 0xacc7, 0x6e3a, 0x98dd, 0xb45f, 0xb83b, 0x3a0a, 0x57a2, 0x87c1, 0x476a, 0x73f4,
+    0x50b8, 0xdd0f, 0xbd91, 0x5bf0, 0x49dc, 0xa1f5, 0xe5e9, 0x2b16, 0xbb5d, 0x19b0, 0xa35b, 0xe0af, 0x24fc, 0x98dd, 0x7bac, 0x5e18,
+    0x92ab, 0x4124, 0x9e9f, 0xc63b, 0x4448, 0x91c5, 0x7d04, 0x2d2e, 0xde17, 0x724a, 0x3260, 0x5596, 0x9129, 0x67ae, 0xa683, 0x5a22,
+    0xbbbb, 0xcf7b, 0xad65, 0x9b29, 0x5e82, 0x8489, 0xac0d, 0x6d94, 0x616a, 0xeb1f, 0x3406, 0x8ccb, 0x6bf0, 0xd055, 0xa5a1, 0xbe19,
+    0xd8ff, 0x96b1, 0xa6b1, 0x854f, 0x27c8, 0x6c8c, 0x491a, 0xd7f5, 0x87fd, 0xa8d1, 0xe57f, 0xcfaf, 0x3178, 0xd6eb, 0x6722, 0x1df2,
+    0xb06b, 0xc8d3, 0x3e4e, 0xe33d, 0x1cfa, 0x9683, 0x3180, 0x92f5, 0xb14f, 0xd62b, 0x6262, 0x33dc, 0x7038, 0x3f3c, 0xdd6f, 0xacd3,
+    0x7c70, 0xbccd, 0x3004, 0x8197, 0x201c, 0x5dcc, 0xa6cd, 0x2bb6, 0xc74d, 0x436c, 0x2106, 0xc4c5, 0xe043, 0x1a68, 0xaf4d, 0x769e,
+    0xe1f3, 0x3178, 0x839d, 0xe2a1, 0x1cc6, 0x6470, 0xcf49, 0x51e2, 0xbddf, 0x6c5c, 0x44f2, 0xb1f7, 0x2472, 0x7d1a, 0xbcd5, 0x219c,
+    0x8aef, 0x3e22, 0x500a, 0x886b, 0xc8cd, 0xb091, 0x80ed, 0x1cb4, 0x9ff3, 0x3208, 0xdab7, 0x2410, 0xd36b, 0xb099, 0x699e, 0x2f9a,
+    0xd67f, 0x83c3, 0x1d76, 0x569a, 0x70a8, 0xc85d, 0xe8f5, 0x6ad8, 0x99e7, 0xa3ff, 0x330c, 0xdf6b, 0x190e, 0x6518, 0xa8d7, 0x4f38,
+    0x24cc, 0x7c6e, 0xc7cd, 0x1c32, 0xc499, 0x8d1f, 0x2d8a, 0xd47d, 0x4496, 0x816d, 0x587a, 0xcac9, 0x332a, 0xadbf, 0x57be, 0x3aec,
+    0xca21, 0x6954, 0x8def, 0x3b7a, 0x6dd2, 0x491e, 0x2f68, 0xd90d, 0x3eac, 0xd687, 0xb4f5, 0x69c8, 0xe515, 0x4200, 0x590e, 0xb8d3,
+    0x824f, 0xa557, 0x1572, 0x3878, 0x8159, 0xe16b, 0x354c, 0x2cfc, 0xce27, 0x56b8, 0xa941, 0x4072, 0x8f15, 0x5dca, 0xa749, 0xdb39,
+    0x44b8, 0x7f7e, 0xade5, 0x574a, 0x3f78, 0x9e33, 0x61f2, 0xd40f, 0x2520, 0x8e5b, 0x68cc, 0xcfd1, 0x81d1, 0x56b2, 0x1df8, 0x43f4,
+    0xe6cb, 0x2ece, 0xd259, 0x8911, 0x1d06, 0x6a36, 0x4bfe, 0xdad7, 0x35b0, 0x92db, 0x54a0, 0xc721, 0x1f1e, 0xde8f, 0x98af, 0x40d6,
+    0xaa91, 0x7caa, 0x8f93, 0x5a60, 0x3ef6, 0x18cc, 0xc44d, 0x4ee2, 0xaf8d, 0x9931, 0x4546, 0xb68b, 0x5510, 0x6ef2, 0x407a, 0xb74d,
+    0x7fe0, 0xd49b, 0x91cb, 0x63ba, 0x9e3d, 0x4e18, 0x28c4, 0x7676, 0x9059, 0xe4d9, 0x59e0, 0x8b8f, 0x2f82, 0x96fd, 0x1e40, 0xc8f7,
+    0x85c5, 0x8d1f, 0x3a6e, 0xa853, 0x225a, 0x8079, 0x4494, 0x5f08, 0xd641, 0x7666, 0x607e, 0xc4d9, 0x377c, 0xd401, 0xa7bb, 0x3664,
+    0xe1f3, 0xb917, 0x2232, 0x4f8e, 0xcd13, 0x66d0, 0xbcbb, 0xab1f, 0xd9ad, 0x65fc, 0xa437, 0xcc11, 0x841d, 0x4a42, 0x2ba4, 0x3f30,
+    0x8d1b, 0x35c2, 0x7b8e, 0x2ca8, 0x4984, 0xb64b, 0x4374, 0x857b, 0x20c8, 0xcf5b, 0x5390, 0xa9e5, 0x1e48, 0x3bb4, 0x8471, 0x3058,
+    0x689e, 0x3e52, 0xb87f, 0x5bb0, 0xce37, 0xbfc7, 0x8593, 0x2896, 0x9205, 0x370e, 0x59d2, 0x7004, 0x83d5, 0x41ca, 0xbf71, 0x4f0a,
+    0xd817, 0x9ab5, 0x465a, 0x7590, 0x8267, 0x52ac, 0xccbf, 0xe847, 0x7e8a, 0x3b52, 0x9901, 0xc2df, 0x8895, 0x5316, 0x826b, 0x282c,
+    0x552c, 0x1b8a, 0x6a2e, 0xb03d, 0x3a62, 0x9307, 0xbddb, 0x3442, 0xa069, 0x5bda, 0x8acb, 0xa9d3, 0x744c, 0x7f8a, 0x5414, 0xc43f,
+    0x9257, 0x9d57, 0x4e08, 0xd007, 0xa6dd, 0x43c6, 0xa3fd, 0x2ade, 0x780e, 0xa807, 0x3220, 0x787a, 0xd2df, 0x3d44, 0x9e57, 0x729e,
+    0xd871, 0xb729, 0xe6e9, 0x72d4, 0x511e, 0x3202, 0x9b7b, 0xe155, 0x7b86, 0x8059, 0x68f0, 0x3f4a, 0x7be8, 0x2dd6, 0xe5e9, 0x9811,
+    0x6288, 0x3890, 0xe00d, 0xad8b, 0x4884, 0x3d9c, 0x85e1, 0x1788, 0xc8bd, 0x490a, 0xc5eb, 0xb705, 0x38e4, 0x7d94, 0xb547, 0x4ac4,
+    0xe28d, 0xad01, 0x335e, 0x9e8d, 0x6630, 0x3984, 0x4aec, 0x83c3, 0x9f0b, 0x2512, 0xb6d7, 0x689c, 0x7ff4, 0xc5c1, 0xa09d, 0x77c8,
+    0x80c1, 0x4f78, 0x9c8f, 0x5472, 0xaffb, 0xcd13, 0x8835, 0x6be8, 0x9c0f, 0x8dc7, 0x1eb8, 0x2fee, 0xbbad, 0xaa3b, 0xcbe9, 0x283a,
+    0xdec9, 0x4a82, 0x637c, 0xd0df, 0xc3d1, 0x5020, 0x5bc0, 0x78c4, 0x911f, 0x43fc, 0x22f0, 0x748e, 0xc3f7, 0x8479, 0x30ea, 0x39d2,
+    0xc257, 0x5ff0, 0x2c82, 0xc26d, 0x90cb, 0x18d8, 0xb805, 0x89df, 0xc00f, 0x76ca, 0x302c, 0x4bcc, 0xb4db, 0x6fa4, 0xc6f7, 0x9fd3,
+    0x87a3, 0x6956, 0x94ad, 0x3ce4, 0xdcd3, 0x64ec, 0xc359, 0xad39, 0x8399, 0x1ef4, 0x60fe, 0x8ae9, 0x3590, 0x54d6, 0x2a34, 0x6322,
+    0x2276, 0x59b2, 0x3116, 0xa933, 0x711a, 0x9881, 0x7da0, 0x365c, 0x80a5, 0x63a0, 0xc9c1, 0x4db2, 0x8cc9, 0xa507, 0xd0f5, 0x4b4e,
+    0x926f, 0x5a7a, 0xaba5, 0xc47d, 0x7b5e, 0xd887, 0xdf5f, 0x485c, 0xc10d, 0x2578, 0x73ee, 0xd825, 0xb90d, 0xe787, 0x621c, 0xa979,
+    0xb47d, 0x292a, 0x6752, 0xcc67, 0xe079, 0x9999, 0xbb43, 0x7566, 0x906d, 0x4040, 0x948b, 0x68be, 0x7ee6, 0x4cfe, 0x5cec, 0xc771,
+    0x8af1, 0x7608, 0xb24f, 0x7c00, 0x3524, 0x95f3, 0x14dc, 0x5028, 0x869d, 0x1fec, 0xb2ef, 0x47c0, 0xe381, 0xb2c9, 0xc603, 0xdb19,
+    0x7d56, 0x44c8, 0x6802, 0xd60f, 0xdea3, 0x2898, 0x9dbb, 0xcf11, 0x944d, 0x493e, 0x73ae, 0xc4cb, 0x988d, 0x5b88, 0xc855, 0xb197,
+    0x539c, 0x7700, 0xe623, 0x2056, 0x77ba, 0x99b1, 0x51a2, 0x5ecc, 0xc3e1, 0xb4df, 0x43c4, 0xa1b9, 0x7c44, 0x1a2e, 0xa4e1, 0x8be3,
+    0x6c16, 0x2b8c, 0xb78d, 0xad83, 0xd1bd, 0x3634, 0x6522, 0xa597, 0x18ea, 0x497a, 0x712e, 0xe0ed, 0x1e96, 0xd31f, 0xbcbd, 0x9617,
+    0xe34f, 0x904f, 0xd68d, 0xa007, 0x7b4e, 0xdc5b, 0x4ec6, 0x6d1a, 0xebb1, 0xb20d, 0x7d78, 0x319e, 0xd37b, 0x9f07, 0x2a1a, 0xc9e5,
+    0x2114, 0x6096, 0x3a7a, 0x919f, 0x2348, 0x5b26, 0xe887, 0x936d, 0x1c3a, 0xdaaf, 0xcdbb, 0x5b1c, 0x982d, 0xc1c7, 0x491c, 0x51fe,
+    0x96cf, 0x27d0, 0x1ef8, 0x9a53, 0x3aac, 0xd579, 0x69c4, 0x5186, 0xca19, 0x36cc, 0x94f3, 0xa2f5, 0x5720, 0xc301, 0x8f9f, 0x3e82,
+    0xb987, 0x7dba, 0xa177, 0x6cf6, 0xd1bd, 0xbb19, 0x638c, 0x749e, 0x27c6, 0x52f6, 0x6c4c, 0x9aad, 0x5494, 0xcd83, 0x2d80, 0x975b,
+    0x6f08, 0x8bd5, 0x5150, 0xdca9, 0x88a7, 0xb76d, 0x739a, 0xe15b, 0xc71d, 0x5598, 0xa977, 0x1dae, 0xdb59, 0x4148, 0x29e6, 0xd0e5,
+    0x1b48, 0xdf97, 0xc029, 0x252c, 0xdadf, 0x6606, 0x9cdd, 0x23de, 0xb907, 0x50ec, 0x7a08, 0xcfbf, 0x4b8c, 0x7cbc, 0x8c5f, 0x3190,
+    0xa251, 0xb205, 0x5926, 0x99f1, 0x9fc3, 0x1d12, 0xb3cb, 0xe049, 0xa9c7, 0xc969, 0x9c9b, 0xdcbb, 0x6296, 0x5358, 0xe609, 0x705c,
+    0xd7a9, 0xa907, 0xdbcf, 0x4b5c, 0x6726, 0x75d8, 0xeb41, 0x4682, 0x5a58, 0x9d53, 0xe109, 0x3f9c, 0x9385, 0x29ce, 0x5fe2, 0x3d42,
+    0xcf27, 0xab8d, 0x56ae, 0xb775, 0x833f, 0x2a0a, 0x5012, 0x7a7e, 0xd773, 0x4036, 0xc1df, 0xa771, 0xcef5, 0x7c70, 0xb863, 0xc5cd,
+    0xcf61, 0xa6a7, 0xdb7f, 0x4380, 0xd151, 0x51ee, 0x99f7, 0xe8c3, 0x3288, 0xbfe5, 0x25c0, 0x7932, 0xdccd, 0x2fa0, 0x69ca, 0xaa87,
+    0x2b70, 0x69a4, 0x16da, 0x35c4, 0x448e, 0x8751, 0x6f68, 0xa2c1, 0x3540, 0x5d34, 0xa271, 0x43ae, 0x6e0c, 0xc10d, 0x3c62, 0x53b4,
+    0x3798, 0xe05b, 0x47fa, 0x61fe, 0x79d2, 0x51e2, 0x1982, 0xac2b, 0xd935, 0x3106, 0xb495, 0x2522, 0xe9f9, 0xbc7b, 0x8eb1, 0x2676,
+    0x40e8, 0x56f4, 0xe32f, 0x68c8, 0xaaef, 0xe049, 0x680c, 0x3968, 0xc655, 0x4b82, 0x7324, 0x29c0, 0x9339, 0x16f8, 0x83f5, 0xa1f7,
+    0xe27d, 0x2008, 0xb4bd, 0x9add, 0x89c3, 0x65b8, 0x37b4, 0xd997, 0x65a6, 0xb177, 0x2e3c, 0x6bc6, 0xe729, 0x4a3e, 0x1be8, 0xde1b,
+    0x91d1, 0x2490, 0x4bec, 0xbfd7, 0xa563, 0x354e, 0xe0d7, 0x1d12, 0x77b8, 0xd739, 0x2308, 0xcac1, 0xbdbf, 0xe365, 0x6262, 0x32d8,
+    0x8713, 0xda4b, 0x59a8, 0x7754, 0x2d16, 0x8819, 0x4938, 0xb5ff, 0x7484, 0xca2b, 0xac47, 0x265e, 0x5780, 0xa3dd, 0x4332, 0x3342,
+    0x6352, 0xaa55, 0x462a, 0x5730, 0xbeaf, 0x1eec, 0xa36f, 0x55be, 0x7e2e, 0x1f0e, 0xc723, 0x45b0, 0x3eea, 0xb6ff, 0x5f12, 0x4528,
+    0xa801, 0x7a6e, 0xc727, 0xda43, 0x6e28, 0x84d9, 0x3f42, 0xc2d3, 0x5538, 0x43b0, 0x98db, 0x2744, 0xa67b, 0x6aac, 0xe041, 0x3440,
+    0xc8fb, 0x7b9a, 0x6292, 0xbc4b, 0x7a7e, 0x8c15, 0xbccf, 0x3eba, 0xaf03, 0x5b00, 0xdec1, 0xb91f, 0x2834, 0x7658, 0xa3c3, 0x14fc,
+    0x51fe, 0xc571, 0x31d2, 0x828d, 0x1fa8, 0x9d7f, 0xdb7d, 0xa859, 0xb4e1, 0xe325, 0x86b9, 0x3096, 0xc277, 0x95a9, 0x5ca0, 0xd033,
+    0x3d2e, 0xc3c1, 0x6f80, 0x46e4, 0xafb9, 0x27e8, 0x953b, 0x2156, 0x6018, 0x3bec, 0xd789, 0x8b31, 0x7108, 0x6024, 0xb5f1, 0x957f,
+    0x5e10, 0xb03d, 0x430c, 0x7bc2, 0x92e9, 0x2e74, 0x3fd2, 0xe179, 0x612c, 0xa789, 0x783e, 0x9873, 0x5be0, 0x18c6, 0x6968, 0x569c,
+    0xc4d1, 0x767e, 0x3400, 0xe3c9, 0x4c7c, 0x8503, 0x6f60, 0x3e62, 0x1b86, 0x67b0, 0x3616, 0x7c24, 0x190c, 0xa793, 0xa0e7, 0x7836,
+    0x1eb0, 0x854d, 0x33ba, 0x8505, 0xb081, 0x2e8e, 0xcf25, 0x39a6, 0xa2ed, 0x22e2, 0xbb51, 0x80a1, 0xb1fb, 0xe38b, 0x8bc1, 0xbc93,
+    0x47d2, 0x23e0, 0x7086, 0xcb23, 0x4512, 0xd15b, 0xa8a1, 0x1c7e, 0xb24d, 0x5f3a, 0xdc4f, 0x6d66, 0x4cb0, 0x8f99, 0xe8f1, 0x5550,
+    0x81c1, 0x421e, 0x76b2, 0xc5eb, 0x83d5, 0x1db0, 0xbe99, 0xb259, 0x7398, 0xa3ad, 0x667e, 0x8bd9, 0x1f24, 0xb9bb, 0x8491, 0x514c,
+    0xe495, 0xce57, 0x8a1b, 0xdcd1, 0xb6e5, 0x2d0e, 0xba4d, 0x97e1, 0x526a, 0xb94b, 0xd17d, 0x1ad0, 0x78a0, 0x2b10, 0x7a52, 0x93db,
+    0xd1fb, 0xa7f5, 0x858f, 0xa907, 0x2e92, 0xcde7, 0x96ab, 0x3ad2, 0x4eb2, 0xa24d, 0xcf7d, 0x545e, 0x9bbb, 0x19f4, 0xab6f, 0x6814,
+    0xc489, 0x9cad, 0x1dda, 0x3876, 0xc925, 0x8a8d, 0x479a, 0xb239, 0xebd9, 0x9f9b, 0x8fb3, 0xd61f, 0x6672, 0x496a, 0x6a98, 0x2822,
+    0x5872, 0xa439, 0xcc4f, 0x3f76, 0x5142, 0xb989, 0x77e8, 0x4ccc, 0x1544, 0x86d5, 0xd213, 0x3c24, 0xaaa7, 0x7e44, 0xb3ff, 0x6ad0,
+    0xa3e1, 0xd065, 0x87eb, 0x6a4e, 0x3c0a, 0x5320, 0xd309, 0xad75, 0x3d08, 0x8a53, 0x50a4, 0x8f0d, 0x2a2e, 0x54a2, 0xcb0d, 0x75f4,
+    0xb51b, 0x20f6, 0x397c, 0x6408, 0xb0e9, 0xcc8f, 0xe663, 0x5ee8, 0x2e22, 0xd747, 0x9457, 0x46de, 0xb409, 0x6e3e, 0x7fa8, 0xc0ef,
+    0x2200, 0xcbaf, 0x3a58, 0xb527, 0x2e16, 0x579e, 0x9375, 0xcd99, 0x2620, 0x61e4, 0xe19f, 0x5c2c, 0x8871, 0x7d74, 0xe6cb, 0x87b5,
+    0xd465, 0x5d34, 0xad63, 0x349e, 0x50e8, 0xbeb7, 0xac5d, 0x6b94, 0xafbb, 0x86e3, 0x6e12, 0xb853, 0x4fc0, 0x124e, 0x8ba9, 0xa0d1,
+    0x71ac, 0x53cc, 0xdf8b, 0xb0b9, 0xc3af, 0x18c4, 0x948f, 0x260c, 0x8089, 0x1ed0, 0xc0ff, 0x4c84, 0x3920, 0xdef9, 0x6a26, 0x943b,
+    0xd58b, 0x75e2, 0xb0a7, 0x40be, 0x4e1e, 0x718c, 0x2fee, 0x45a6, 0x3c58, 0x990b, 0x73b0, 0x1d0e, 0xeb4b, 0x7292, 0x8000, 0x18fc,
+    0xb64d, 0x66ba, 0x1e06, 0x8dbb, 0xd18f, 0x4aa4, 0x8c6f, 0xcfed, 0xb3e3, 0x8081, 0x9ead, 0x3126, 0x4ca0, 0xcd5d, 0xa237, 0x5378,
+    0x33da, 0x6f42, 0x28ba, 0xd215, 0x55be, 0xb5c5, 0x77b6, 0x84b9, 0xc573, 0x3b9a, 0xd74b, 0x2f90, 0xc485, 0xe6a1, 0xba2d, 0xd305,
+    0x24ae, 0x82e1, 0xb615, 0x2de8, 0x7690, 0xc917, 0xdc97, 0x940f, 0x5302, 0xea1b, 0xbc8d, 0x4c48, 0xc9cb, 0x306c, 0xb3e1, 0x3448,
+    0xaa6b, 0x5446, 0x684c, 0xdbc9, 0xc14b, 0x50da, 0x9b97, 0x8509, 0x7578, 0xd335, 0x62ae, 0x2cec, 0xc1fd, 0x5486, 0x1a60, 0x9873,
+    0x61be, 0xd8a5, 0x346c, 0xa5f9, 0x5530, 0x91c5, 0x69d0, 0x3780, 0x75d4, 0x9105, 0x2ff6, 0x24d2, 0xa44d, 0x15e0, 0x5eb6, 0x3414,
+    0x961b, 0x1df4, 0x8b35, 0xb635, 0x2ad0, 0x6208, 0x5786, 0x40e2, 0xcee1, 0x5572, 0xb7d5, 0x47c8, 0xc551, 0x5f30, 0xaa97, 0x332e,
+    0x9491, 0x6238, 0x9e21, 0x51d4, 0x99f1, 0x57ac, 0x1638, 0x706a, 0xd747, 0x352a, 0x8cdb, 0x9a7f, 0x50fc, 0xae2f, 0xe051, 0x497a,
+    0x63c4, 0x72f6, 0x2332, 0xd349, 0x3f1c, 0xb82d, 0x6fb8, 0xe0a5, 0x8709, 0x5df2, 0x7ae0, 0x8207, 0x41d6, 0x6ada, 0x7f64, 0xda11,
+    0x3970, 0x92b1, 0xbe9d, 0x730e, 0x5c3e, 0x2984, 0x92e9, 0x7868, 0x2140, 0x594e, 0x3b36, 0xcb87, 0xaaf5, 0x3c68, 0xbcdf, 0xca13,
+    0x3e0c, 0x8747, 0x765e, 0x2afe, 0x1af2, 0xb115, 0xea7b, 0x9029, 0x9ae7, 0xb373, 0x5d5e, 0x885b, 0xc3a1, 0x2c78, 0x7446, 0x3b1a,
+    0x3574, 0xb9ff, 0x63ce, 0x948f, 0xd84d, 0x7dc4, 0x93c5, 0x9f1f, 0x5de2, 0xe321, 0x72bc, 0x38c4, 0x62fe, 0x9e25, 0xac81, 0x474e,
+    0xd057, 0xa36d, 0xc2a5, 0xdeff, 0x9745, 0x2492, 0x6e42, 0x993f, 0x87f1, 0x4250, 0x5e3c, 0x8491, 0xcec9, 0x2d34, 0xe855, 0xa34d,
+    0x5604, 0x74e8, 0x8153, 0xe339, 0x99dd, 0x7b62, 0xd96d, 0xb923, 0x3bb8, 0x93c9, 0xaa1d, 0xbacb, 0x2566, 0xa5fd, 0x2a6a, 0x9b9b,
+    0x361a, 0x8955, 0x1ae4, 0xdf07, 0x9cf9, 0x7b1c, 0xd233, 0x4842, 0x2a5a, 0xdec7, 0x3f9a, 0x8f13, 0xda0b, 0x80fb, 0xb10b, 0x3b92,
+    0xc0ab, 0x938b, 0x4220, 0x3218, 0x4772, 0x5574, 0xd271, 0x7a36, 0xe2a9, 0x9811, 0x6f50, 0x7cd6, 0x8cb9, 0xd38d, 0xb0b5, 0x7c62,
+    0x23ea, 0x5b14, 0xe7d5, 0x8377, 0xbcad, 0xd385, 0x889f, 0x64f8, 0xc9d3, 0xbcc7, 0x6224, 0x467e, 0xad21, 0x39b4, 0xb3af, 0x4bbe,
+    0xa33b, 0xe8c9, 0xa963, 0x3226, 0xd963, 0x5b82, 0x358a, 0x7400, 0x4894, 0x2b0a, 0xe631, 0x7f36, 0xaafd, 0x20d4, 0x7f28, 0xcd17,
+    0xe873, 0xa9b9, 0x881b, 0xc733, 0x6b48, 0xb2f7, 0xd281, 0x183c, 0x90c7, 0x5d24, 0x4884, 0x86ad, 0xa303, 0x407a, 0x8c73, 0x5048,
+    0x9e7f, 0x4412, 0x6738, 0xa527, 0x58aa, 0x363c, 0xad35, 0x2e70, 0x838b, 0xacad, 0x7abc, 0x5440, 0xa7d9, 0x8b97, 0x6754, 0x592a,
+    0xd225, 0xbc31, 0x3c76, 0x9f83, 0x1a14, 0x5bde, 0x74b0, 0x295c, 0xc0f5, 0x5744, 0x8871, 0x7626, 0x4712, 0x691e, 0xd303, 0x81c3,
+    0xb3e5, 0x6f4c, 0x8421, 0xdaf9, 0x1768, 0x9807, 0xc577, 0xed27, 0xceff, 0x8bd5, 0x5522, 0xb711, 0xcbd5, 0x8439, 0x43c8, 0xcfe9,
+    0xb593, 0xe117, 0x5b96, 0x52d0, 0xa873, 0xe057, 0x7f14, 0x8b1b, 0x1a30, 0x7fea, 0xe1ab, 0x9f49, 0x766e, 0x2d80, 0xd7f1, 0x7d64,
+    0xb783, 0x3ee2, 0x1dba, 0x685a, 0x7b42, 0xd7b9, 0xa80f, 0x4098, 0x82c5, 0xac1f, 0x6a96, 0xe921, 0x3d0e, 0xce87, 0xbd7d, 0x1224,
+    0x353e, 0xb509, 0xbe23, 0x5184, 0x9063, 0x7bb2, 0x5190, 0x2d6c, 0xc34d, 0x211a, 0xd85d, 0x3ab0, 0xd70d, 0xc22f, 0x4e5a, 0xa701,
+    0x1f16, 0x6dc0, 0xaaf1, 0x5094, 0xe421, 0xb77d, 0xd069, 0x6606, 0xa7f7, 0xd933, 0x30a2, 0x6e94, 0x89c9, 0xde67, 0x7bf4, 0x4e3a,
+    0xac37, 0x62a0, 0xe67f, 0xc025, 0x7efc, 0xd229, 0x5f02, 0x25a0, 0x3baa, 0xd1b1, 0x6dc0, 0x4568, 0x2426, 0x9787, 0xd7c7, 0x5724,
+    0x7e64, 0x3374, 0xdaaf, 0x1b68, 0xb1cb, 0x2576, 0x6a82, 0x44b6, 0x278a, 0xc015, 0xac4b, 0xce69, 0x89b1, 0xdad3, 0x260e, 0x588e,
+    0x353e, 0x8fed, 0x671a, 0x4928, 0x343e, 0x7c28, 0x4c38, 0x2080, 0xccc1, 0xa515, 0x38a2, 0xd8dd, 0x99e9, 0x3b68, 0x889d, 0x4c82,
+    0xb44b, 0x9393, 0x223e, 0x6d10, 0xa2bb, 0x3418, 0x3f60, 0x6f68, 0xbc15, 0x7bb4, 0x4228, 0x86b1, 0xc741, 0x6e9c, 0x4dc4, 0xbc17,
+    0x6eb6, 0x4bf6, 0x8043, 0x68b0, 0x4090, 0x1904, 0x346c, 0x8f37, 0x9c17, 0x78b2, 0xcf73, 0x5536, 0x2e82, 0xc945, 0x48c8, 0x5c92,
+    0xd685, 0x2172, 0x81ed, 0xd7eb, 0x8e91, 0x6f3a, 0xa5db, 0xb2e5, 0x59ba, 0x3020, 0xacb7, 0xe50d, 0x282a, 0x4f4a, 0x33de, 0x454a,
+    0xb341, 0xa0e7, 0x3ae0, 0x8e49, 0x2490, 0xaafd, 0xe08b, 0x2adc, 0xa669, 0x1ec0, 0xd265, 0xa5fd, 0xcaf3, 0x2964, 0xdd95, 0x7cf0,
+    0x4444, 0x8891, 0x55a4, 0x6a0c, 0x9f6d, 0x841b, 0xe1bd, 0xb043, 0xc84f, 0x6bce, 0x5504, 0xbde5, 0xc747, 0x3bde, 0x28ca, 0x68a4,
+    0x4a50, 0xb62f, 0x5d2e, 0x362a, 0x1b46, 0x9aff, 0x4542, 0x5938, 0xa019, 0x2b38, 0xca1b, 0xba75, 0x57ce, 0x725e, 0x2e5a, 0x63ec,
+    0x8367, 0xdf49, 0xcc47, 0x9cdf, 0xd4af, 0x1904, 0x7094, 0x5f3e, 0xbdb9, 0x24f6, 0x89af, 0x3ec6, 0xd9e9, 0xca5b, 0x45a6, 0xe479,
+    0x254a, 0x905d, 0x7a1a, 0xe449, 0x4510, 0xae49, 0xe0fb, 0xb381, 0x43e4, 0xa033, 0x28d0, 0xd01b, 0xb193, 0x3888, 0x9f57, 0x3eb8,
+    0x22ce, 0x8cef, 0x4cd2, 0xb94d, 0x678e, 0x294c, 0x7a14, 0x4ca0, 0x2c54, 0x9fc1, 0xe0cf, 0x81a3, 0x6024, 0xd8cf, 0xa509, 0x6e56,
+    0x2cf0, 0x7baa, 0x3b76, 0xd677, 0x97d7, 0x47fc, 0xced5, 0xba53, 0x292c, 0x5eea, 0x3654, 0x5054, 0xb715, 0x864f, 0x4b6c, 0x9acb,
+    0x29ea, 0xcd71, 0xb6af, 0xe8af, 0x3294, 0xc505, 0x952b, 0xe003, 0x5c70, 0x44c6, 0x1d10, 0x79b8, 0x5714, 0xa29b, 0x6cfe, 0x83db,
+    0xd1c5, 0x9b8b, 0x5be4, 0x28b8, 0xe1b9, 0xa0d9, 0x4a08, 0xbb6d, 0xae77, 0x8a31, 0x4e48, 0x962f, 0xb48f, 0x2ca0, 0x5b0e, 0xe2ed,
+    0x8bad, 0xcc9f, 0x2fa2, 0x8027, 0x9d5b, 0x2632, 0x3108, 0x4cc0, 0xc2c9, 0x8585, 0xb3b5, 0x4cfa, 0x285a, 0x9ae7, 0x2092, 0x9015,
+    0xd971, 0x2cf6, 0x9b83, 0x4fc0, 0x9505, 0x9117, 0x4256, 0xbed7, 0x6cd2, 0xe625, 0x308e, 0xbaab, 0xdee3, 0x64b0, 0xb801, 0x945b,
+    0xdef3, 0xaa9d, 0x7724, 0x3daa, 0xbebd, 0x54be, 0xdea9, 0xcb09, 0x1cf2, 0x8d5d, 0x466c, 0x1992, 0xb9f7, 0x425c, 0x84a7, 0x5300,
+    0xe85b, 0x80ed, 0x1810, 0x76c2, 0xc211, 0xb19d, 0xdf09, 0xb7e5, 0x56b6, 0x7fcc, 0xb831, 0x1b48, 0x549e, 0xb8e3, 0x681c, 0x17ce,
+    0xdd23, 0xc4d3, 0x3dba, 0xc205, 0x6258, 0xe691, 0x4d8e, 0x98bd, 0x1da4, 0xd9b1, 0x2fd8, 0x5b58, 0x3c4c, 0xd6c3, 0x877d, 0x44ce,
+    0xde5f, 0xc8ff, 0xab9f, 0xd0e5, 0xb8d5, 0x8497, 0xe111, 0xccd9, 0x60d2, 0x144e, 0xb245, 0xa1c9, 0x64aa, 0x9849, 0x7910, 0x8b99,
+    0x2c9e, 0xc96f, 0x7598, 0xb09d, 0x2fbe, 0xdc51, 0x24e8, 0x3c7c, 0xcfdf, 0x48d4, 0x845f, 0x1d52, 0x98e9, 0x6b90, 0xc0e9, 0x8935,
+    0x2fee, 0xd06f, 0x6d54, 0xbfdf, 0x48b2, 0x584c, 0x402e, 0x8c0f, 0x5656, 0x6ec4, 0x3df8, 0x8bc9, 0x6b36, 0x4faa, 0x9b73, 0x6602,
+    0xced5, 0x2922, 0x7252, 0xc26b, 0x4630, 0xb431, 0x221a, 0x3c7c, 0x9477, 0xd505, 0x1872, 0x99f9, 0x6a50, 0xde8d, 0x8ccd, 0xae2d,
+    0x6e90, 0x1ed0, 0xdb35, 0x8d93, 0x6826, 0xe277, 0x2fe2, 0xbf65, 0xbc6d, 0xd8c5, 0x7436, 0x4c48, 0x1b04, 0xdadb, 0xd05b, 0xb779,
+    0x9b61, 0x3720, 0x1ca4, 0x687c, 0x4ec4, 0xb8bb, 0x91a7, 0xcee1, 0x48ea, 0xdaef, 0x700e, 0xae1f, 0x34b2, 0x77f8, 0x17ec, 0x72ca,
+    0x9d1f, 0x4c58, 0x598a, 0x2da4, 0x8c0f, 0xd03f, 0x347a, 0x7b54, 0x587e, 0xef03, 0xbc79, 0x6a74, 0x9b95, 0xd787, 0x5f80, 0xc3cd,
+    0xe72b, 0xad61, 0x3bde, 0xc42d, 0x49b2, 0xda9d, 0x592e, 0xac65, 0x608e, 0x1802, 0x43aa, 0x9715, 0x313a, 0x2156, 0x8af7, 0x5486,
+    0xba07, 0xc64b, 0x65cc, 0x8b79, 0x1cec, 0x2a7c, 0xa281, 0x514a, 0xab43, 0xce25, 0x947b, 0x21a8, 0xe8d9, 0x3f86, 0x6080, 0xc3ef,
+    0x7010, 0x584a, 0x8baf, 0x8869, 0x3ce8, 0x4f18, 0x21da, 0x6d02, 0xcbe1, 0xa5b9, 0xdb11, 0xc133, 0x33bc, 0x8d2d, 0x1e4e, 0x5702,
+    0xe5ef, 0x4278, 0x8375, 0xaaeb, 0x7406, 0x2042, 0xcba1, 0x81c7, 0x37ea, 0x6f7c, 0xb1b7, 0x5c3a, 0x7ba2, 0x672c, 0x8f6f, 0x3d80,
+    0xb3d5, 0x58b4, 0x43ba, 0xbe6f, 0x6fd4, 0xd663, 0x7088, 0x4100, 0x927b, 0x1744, 0x656c, 0xb44b, 0xe32f, 0x5c5a, 0xbf15, 0x6b00,
+    0xb73b, 0x7a50, 0x1992, 0x6712, 0x39fa, 0xd42f, 0x1cc0, 0xb467, 0x80b7, 0xa9eb, 0x48fa, 0x9045, 0x7fbc, 0x3b3e, 0xbf0f, 0x1c72,
+    0x6496, 0x4ee0, 0x9d5f, 0x76d6, 0x69ce, 0x9c75, 0x8983, 0xbb9b, 0x7640, 0xe3e7, 0x685a, 0x9b3f, 0x56c6, 0x799c, 0xbdcb, 0xa8d1,
+    0xca39, 0x59a6, 0xd545, 0xa3f7, 0x61f4, 0x406e, 0x9657, 0x6210, 0x28c6, 0xe47d, 0x526c, 0xa821, 0x7270, 0xad53, 0xc4ff, 0x2ecc,
+    0x7a0a, 0xaf8d, 0x4448, 0x1a1a, 0x8125, 0xbc61, 0x23ba, 0xafdf, 0x8999, 0x5ca4, 0xd1dd, 0xb613, 0x9829, 0x7b0a, 0x1dd4, 0xa121,
+    0x5f58, 0x238c, 0x6bae, 0x3b76, 0x5c42, 0x9177, 0x70dc, 0x51f4, 0xba49, 0x3610, 0x7bd4, 0x492e, 0xbaaf, 0x2304, 0xe7df, 0xadc1,
+    0x5352, 0xa5cf, 0x5e24, 0x7d6e, 0x4c24, 0xc531, 0x8931, 0x5cbe, 0x840f, 0xc5fb, 0x6060, 0xba39, 0x7a1e, 0xd0b1, 0x9e53, 0xe93d,
+    0x7464, 0x5000, 0xa721, 0x1f46, 0xd8a7, 0x76ac, 0x9d6d, 0xd54d, 0x8a51, 0xe14d, 0x31c4, 0xba91, 0x76ec, 0x1f38, 0xc2a9, 0x32e0,
+    0xa77f, 0xc855, 0x3d14, 0xe011, 0x1c0a, 0x834b, 0x53e8, 0xa045, 0x5d36, 0x2dae, 0x7e5c, 0x4712, 0x6c96, 0x925d, 0x5e8e, 0xd291,
+    0x2c00, 0x9285, 0xb703, 0x4eb0, 0xce07, 0x8d2b, 0x6f22, 0x585e, 0x87c3, 0x375e, 0x803d, 0x9cab, 0xa763, 0x8b03, 0x46d8, 0x2058,
+    0x5f04, 0xba3b, 0x5254, 0x83c3, 0xa22f, 0xe74d, 0x6712, 0x9b3d, 0x4a66, 0xa62f, 0x2946, 0x5ec2, 0x97c5, 0x5582, 0xa921, 0x8d1d,
+    0x6bea, 0xd269, 0xb3cf, 0xbfa9, 0x8679, 0x689c, 0x4bce, 0x9509, 0x1da8, 0x838f, 0x3844, 0x483e, 0x756a, 0x2c48, 0x8787, 0x6ff2,
+    0x2a08, 0x7c80, 0xcf11, 0x632c, 0x968b, 0xae2b, 0x3370, 0x9327, 0xc9f9, 0xb9cf, 0x6f88, 0xcead, 0x75d4, 0xb60f, 0xc4bd, 0x4562,
+    0x958b, 0x1c98, 0xa56d, 0xd0dd, 0x7f20, 0x6d5e, 0xe761, 0x708e, 0x8a97, 0xde7b, 0x7dac, 0x6c78, 0xd2a5, 0xa827, 0x7fc0, 0x1e40,
+    0xdc0b, 0xa371, 0x3ae2, 0xbdd3, 0x6180, 0xa12d, 0xb511, 0x365c, 0x845f, 0x2bce, 0x9285, 0x4546, 0xb3ff, 0xe301, 0x4702, 0xa81b,
+    0x7cb8, 0x2a42, 0xd4ad, 0x69a4, 0xc12f, 0x8317, 0x36ea, 0x96c7, 0x5da8, 0xd6f9, 0x2c40, 0xcad5, 0x1a96, 0xad37, 0xc725, 0x1c02,
+    0x9d4f, 0x7ada, 0xdb05, 0x1d60, 0x8c3f, 0xae7f, 0x8957, 0xd0ab, 0xeaf5, 0x96cf, 0x4844, 0xccab, 0x9203, 0x3dc2, 0x75f6, 0x2e68,
+    0x43e8, 0x53de, 0xcaa3, 0xe2cd, 0x6198, 0xaf0d, 0x53e4, 0x759a, 0x3606, 0x90ef, 0x1726, 0x6716, 0xa819, 0x2df2, 0x550c, 0x832b,
+    0x2790, 0xb483, 0xd16b, 0x374e, 0xe66f, 0x224a, 0x36aa, 0x9535, 0x556c, 0x325a, 0xaf51, 0xce4d, 0x2be0, 0xd521, 0x9841, 0x1cac,
+    0x7086, 0x3a3a, 0xae27, 0x2d88, 0xdda3, 0x77aa, 0xc3a1, 0x3af0, 0x7e20, 0xa21f, 0x68d2, 0x8df3, 0x2622, 0xd23f, 0x4e5e, 0x81e5,
+    0x5da4, 0xe451, 0x6df6, 0x9dc9, 0xd4e9, 0x8b9f, 0x6d9c, 0xcd75, 0x63f2, 0x7a88, 0xad97, 0x201c, 0x49e4, 0xc531, 0xe0d3, 0x8621,
+    0xb743, 0x9029, 0x3052, 0xae0b, 0xd759, 0x21f2, 0xa221, 0x3a9c, 0x8f0d, 0xe8e9, 0x9b29, 0xd3bd, 0x70ee, 0x2e5a, 0xbb35, 0x3b8c,
+    0x46dc, 0xc4eb, 0x227c, 0xb02f, 0x3d10, 0xa017, 0xcb69, 0x1b30, 0x9b37, 0xb07b, 0x2d94, 0xd9a3, 0x4de6, 0x3e12, 0x2796, 0xa459,
+    0x605c, 0x39bc, 0x8eb3, 0x94e9, 0x7f72, 0xbbdd, 0x31c4, 0x6330, 0xb30f, 0x4990, 0x970b, 0xd4e7, 0x5056, 0xaf67, 0xeabf, 0x70b6,
+    0x49a8, 0xb72f, 0x5b88, 0x941b, 0xaaa3, 0x6a22, 0xd3b9, 0xc92b, 0x7836, 0xb3fd, 0xb179, 0xcf1f, 0x37ac, 0x1d46, 0xb8b1, 0x57aa,
+    0xbffb, 0x6822, 0x79f6, 0x2f50, 0xa839, 0xbdcf, 0x3f1c, 0xd4f7, 0x6a80, 0x1b84, 0xe8ab, 0x6138, 0x30bc, 0xc753, 0x9565, 0x6f9c,
+    0xe979, 0x930d, 0xd257, 0xb29b, 0x2a1e, 0x3a80, 0x2088, 0x77a8, 0x3134, 0xbe61, 0xcda1, 0x7980, 0xee97, 0xc3ab, 0x4338, 0xdbbd,
+    0xc769, 0x3730, 0x118a, 0x57ea, 0xa247, 0x367a, 0xba67, 0xe5e1, 0xc3b5, 0x7118, 0xa0e3, 0xa847, 0x1c6a, 0xc39d, 0xbabd, 0x5e94,
+    0x451e, 0x9cdd, 0x5450, 0x1b0e, 0x7fba, 0xc26f, 0x7586, 0xd407, 0x44de, 0x808d, 0xab3b, 0x25b4, 0x4d70, 0xe0ef, 0x667e, 0x3248,
+    0xe9a9, 0x6e38, 0x3890, 0x5414, 0xb649, 0xc029, 0x5ebc, 0x1530, 0x33ac, 0x4512, 0x5552, 0xbae9, 0x2c0a, 0x4cb6, 0xb705, 0x93d5,
+    0x5944, 0x2a16, 0x76d4, 0xcb2d, 0x2106, 0xda25, 0xb1b5, 0x7d8a, 0x5d40, 0xbb35, 0x52f2, 0x7d58, 0x7314, 0xce9d, 0x64bc, 0x9853,
+    0xbe39, 0x19a8, 0xa373, 0x4b1c, 0x3934, 0x5772, 0xb58d, 0xe185, 0x535c, 0x9f87, 0x7866, 0xc173, 0x44b8, 0xe74f, 0x79a8, 0x458c,
+    0xd821, 0x62fe, 0xa665, 0x34dc, 0x5c10, 0x4bf4, 0x1ec4, 0xabb7, 0x5b6a, 0x33fa, 0x7306, 0x2552, 0x5e76, 0xa5cf, 0xde89, 0x9da7,
+    0xe8e3, 0x92c5, 0xa991, 0xbcc9, 0x2b70, 0x87ed, 0x9d0b, 0xe215, 0xc81f, 0x6386, 0xd60f, 0xd689, 0xc511, 0x6fae, 0xeacb, 0xd275,
+    0xa21d, 0x3f38, 0x5796, 0x87ad, 0xcea7, 0x4ca8, 0xa099, 0x6f12, 0xd121, 0x43f0, 0x7dee, 0x98a5, 0x6570, 0x48d8, 0x5b00, 0x334a,
+    0xcae9, 0x85c3, 0x4c72, 0x9175, 0x37c2, 0x80a1, 0x215c, 0x9ccb, 0xba41, 0xd0c3, 0x4310, 0xe1c1, 0x5ba0, 0x3a12, 0x961d, 0xd1e3,
+    0x2474, 0x89cb, 0x3a06, 0xac1b, 0x671c, 0x361e, 0x2e96, 0xd899, 0x4772, 0x3510, 0xe79f, 0x7312, 0x8bdd, 0x585a, 0x32f6, 0x5fb8,
+    0x437c, 0xd4bb, 0xa2fb, 0x68c2, 0x4c28, 0xbfcf, 0x7cd6, 0x2a2a, 0xb20f, 0x6d90, 0x2364, 0x4a96, 0x5b1a, 0x8649, 0xd24d, 0x7b4a,
+    0x6bcc, 0xdfe9, 0x96cd, 0x4ab2, 0xe593, 0x5cac, 0x727c, 0x49e6, 0xe105, 0x71ee, 0x326e, 0x970d, 0x81f3, 0xb5e3, 0x67fa, 0x1e2a,
+    0xcae9, 0xb957, 0xdb75, 0x5468, 0x2a58, 0xcab5, 0x4a32, 0x1e50, 0xbd4b, 0x2346, 0x5df0, 0xdc85, 0x337a, 0x8fab, 0x4698, 0x8393,
+    0x22e8, 0x989d, 0x7da4, 0x2f6e, 0xd8d1, 0x73e0, 0x276c, 0x9405, 0x353a, 0x4df2, 0xc56b, 0x6570, 0xe41b, 0xaf0d, 0x7eaa, 0x9b29,
+    0x4238, 0xe0a1, 0x45ec, 0x6988, 0x1e7e, 0x9f11, 0x23d6, 0x9abf, 0xaa3d, 0x4b7c, 0xc667, 0x9031, 0x3d9e, 0xe0df, 0x64ca, 0x3676,
+    0xab9d, 0x1ad4, 0x3d72, 0x7a00, 0x57e0, 0xc0eb, 0xd9d9, 0xb311, 0x5aa2, 0x86d3, 0x1696, 0x45ac, 0x8cd7, 0xa50d, 0x5224, 0x28f8,
+    0x8287, 0x99d3, 0x6eee, 0xe6dd, 0xcf77, 0x1df4, 0x629e, 0xa77b, 0x28f6, 0x42b8, 0xd5d7, 0x63dc, 0xded1, 0x565a, 0xa52f, 0x3acc,
+    0xcc09, 0xbdf7, 0x9029, 0xdc71, 0x3380, 0x65f2, 0x1eaa, 0x5356, 0x935f, 0x2ea8, 0xe83d, 0x56fe, 0x9315, 0xa84d, 0x1efa, 0x8571,
+    0xa80d, 0x5e22, 0xcea1, 0x9b27, 0x4470, 0x2578, 0x9177, 0xd061, 0xb693, 0xa66b, 0x1dde, 0x8e51, 0x9b7d, 0x7390, 0x3900, 0xd483,
+    0x48d0, 0x9aa9, 0xe661, 0x522e, 0x872f, 0x75bc, 0x4192, 0xe155, 0x1a3a, 0xd445, 0x6726, 0xaedf, 0x2790, 0x161a, 0x8147, 0x3e24,
+    0xc7bf, 0x6b8a, 0x8cb5, 0xe4b7, 0x9f39, 0xc993, 0x7256, 0x1a68, 0xaa1f, 0x2cc2, 0x8733, 0x638c, 0x9495, 0x53e6, 0x89a1, 0x34d8,
+    0xbad3, 0x2746, 0x89df, 0xb85b, 0xeef5, 0xc71b, 0x74e8, 0x2d9c, 0x689c, 0xbd35, 0xe145, 0xc239, 0x81a7, 0x2e42, 0xb3c3, 0x1bd8,
+    0x5fe2, 0x7286, 0x24be, 0x6c62, 0x4032, 0xc5a1, 0x24f8, 0x4aca, 0x3fe8, 0x8275, 0x2a74, 0x4628, 0x7df6, 0x1ef6, 0x9529, 0x5fe4,
+    0x84cb, 0xd975, 0x669c, 0x92cf, 0xb9f7, 0x6a34, 0x1d00, 0xbdf7, 0x7f72, 0xbdcf, 0x265e, 0xd655, 0x3b6c, 0xb3f1, 0xa6c1, 0xdd77,
+    0x6dc8, 0x99db, 0xb4eb, 0x67bc, 0xcf81, 0x58e2, 0xdad9, 0x4c58, 0x5d64, 0x1f0c, 0x2b50, 0xc4c3, 0xb771, 0x76e0, 0x714a, 0xbad1,
+    0x9fc7, 0x55bc, 0xbeb3, 0x32ec, 0xe04b, 0x575c, 0x8aad, 0xc913, 0x9e59, 0x201c, 0x8d5f, 0xc8cf, 0x46b4, 0x9ded, 0xb685, 0x87a3,
+    0x1aa2, 0x57a0, 0xe9fd, 0x816b, 0x251e, 0x8f45, 0xdb1d, 0x9d23, 0x5b4a, 0xcddb, 0xa88f, 0x9457, 0xdfad, 0xa681, 0x1a40, 0x9d37,
+    0x863d, 0x2c4c, 0xc939, 0x855d, 0xa447, 0x3138, 0x92d7, 0xb4b9, 0x2f2a, 0xa40d, 0x5808, 0xc43f, 0x26f4, 0xdb81, 0x5c2a, 0x982b,
+    0x8729, 0x3216, 0x6c50, 0x3d68, 0xae0d, 0x8941, 0x92c3, 0xdf39, 0x7d06, 0xa611, 0x70bc, 0x8161, 0x1792, 0x9f11, 0x64ea, 0xbf3b,
+    0xdda3, 0x7156, 0xc821, 0x3bc6, 0x555c, 0xc33b, 0x40ec, 0x89db, 0xe287, 0x6c3c, 0x1faa, 0x77e6, 0x9f1b, 0x45c6, 0x2e1a, 0x6962,
+    0x8211, 0xb9d3, 0x99c1, 0xd883, 0x57d6, 0xe691, 0x6010, 0xc917, 0x35a8, 0x9e3f, 0xd105, 0x7708, 0x25b2, 0xb417, 0x5086, 0x805d,
+    0xcdb7, 0x93ab, 0x61aa, 0xe171, 0x9d5f, 0x8bdf, 0x7282, 0xcce3, 0x95e9, 0xe307, 0x6c2a, 0xc657, 0x34ca, 0x20f4, 0x6a34, 0x91eb,
+    0x4aa2, 0xad99, 0x3cc6, 0x81f3, 0x937f, 0x4536, 0x8a53, 0x7352, 0x56a2, 0xb1d3, 0x9339, 0x30e2, 0x7772, 0x3cc8, 0x9683, 0xdba3,
+    0x82b1, 0x26a4, 0x6a16, 0x4454, 0xb20f, 0xd163, 0x9705, 0xdb6d, 0x6598, 0x6eb0, 0xc08d, 0x3e18, 0xc90b, 0x7d8c, 0x4120, 0xd777,
+    0xc1e9, 0x7cdc, 0x256c, 0xb429, 0xe2fb, 0x7400, 0xa16f, 0x5954, 0x669a, 0xcc4b, 0x96db, 0xdf6b, 0x4734, 0xd357, 0xab81, 0x6ed8,
+    0xc30b, 0x7f7c, 0xac6f, 0x5d98, 0x27a0, 0xc529, 0x5544, 0x9bcd, 0x4846, 0x8b53, 0x3a80, 0xdf4b, 0x9bc1, 0x5df0, 0xe6db, 0xb14f,
+    0x53d0, 0x533e, 0x2c50, 0xb771, 0x76dc, 0x2436, 0x6654, 0x8c5b, 0xc7dd, 0x4064, 0xdd9b, 0x37e4, 0xa4c7, 0x2a80, 0xdb1b, 0xb199,
+    0x6cb8, 0x92dd, 0xce6b, 0x482a, 0x6f20, 0xa179, 0x4050, 0xd167, 0x872b, 0xa603, 0x5002, 0x3e7e, 0x98fb, 0x6c7c, 0x4a16, 0x8655,
+    0xc0bf, 0x3cfa, 0xce9f, 0x5404, 0x94f1, 0xea1b, 0x6e0e, 0xb7f5, 0xa999, 0x81ff, 0xb51f, 0x9a2d, 0x5c6a, 0xaf2d, 0x402e, 0x2bf6,
+    0xbc31, 0x4bc2, 0x0dbc, 0x29be, 0xda5f, 0x4446, 0x8d3f, 0xe487, 0x25d0, 0x5e08, 0x9fe7, 0x5484, 0x8b65, 0xc009, 0x7c0e, 0x1c42,
+    0x4e4a, 0xd7f1, 0x2444, 0x7de4, 0xc101, 0x6ef8, 0xaddb, 0x7a92, 0xcbcb, 0x93db, 0x8329, 0x550e, 0x9f23, 0x1b1e, 0xe3ab, 0x2f0e,
+    0x4174, 0x73cc, 0xcdc7, 0x947f, 0x817f, 0xa4c5, 0x1d90, 0xdf0d, 0x79ea, 0x4a52, 0xb0bd, 0x6c0a, 0xd5af, 0x2eac, 0xd02f, 0x75e8,
+    0xbff1, 0xcbfd, 0x7fc6, 0x3c82, 0xb6a1, 0x635a, 0xe121, 0x39c6, 0x41d8, 0x75c4, 0x1b86, 0xc07b, 0x416a, 0x6330, 0x3fae, 0xc397,
+    0x5658, 0x3206, 0x75b4, 0x5c4a, 0x1aea, 0xadfb, 0xd551, 0x5686, 0x8365, 0xd9e5, 0x46da, 0x7d8e, 0xa1ff, 0x6b88, 0xbc75, 0x4d38,
+    0xde45, 0x92f7, 0xc63f, 0x20c0, 0xe9bf, 0x6328, 0x360a, 0xa625, 0x3f50, 0x8bf9, 0xc9c1, 0x574e, 0xb597, 0x7a84, 0xd4bb, 0x2f44,
+    0x52e2, 0xa261, 0x1c52, 0x8ae9, 0xb0cf, 0x9dad, 0x1e6c, 0xc9b5, 0x468c, 0xac19, 0x8e85, 0x2814, 0xb43f, 0x736c, 0xdad3, 0xd195,
+    0x2582, 0x13de, 0xa993, 0xc67f, 0x6a92, 0x8a03, 0x43f8, 0x7744, 0x8189, 0x52f8, 0x17f4, 0x6a36, 0x8651, 0xd68d, 0x22cc, 0xb767,
+    0x4e82, 0x2602, 0x6b4e, 0xc2b7, 0x1654, 0x48ae, 0x2b06, 0x4066, 0x1adc, 0x5326, 0x9af7, 0xb059, 0x7da2, 0xd409, 0xbd55, 0xe71d,
+    0x6366, 0xbc99, 0x2ee6, 0xd1cd, 0x61f4, 0xb439, 0xd0df, 0x203e, 0xe2b1, 0x83e3, 0x693a, 0xcaeb, 0xc3ff, 0x8215, 0x6ac4, 0x1e86,
+    0x5558, 0xa95d, 0xdeb1, 0xa0f1, 0x4c14, 0x5998, 0x9f13, 0x20a0, 0xb0e9, 0x4bca, 0x869f, 0x9843, 0x1bb8, 0x620e, 0xb289, 0x535a,
+    0x2d34, 0x6844, 0x4774, 0x8607, 0x65e4, 0x2f6c, 0x824d, 0xd731, 0x2a0e, 0x7e42, 0x3240, 0x556e, 0x5f12, 0x7e5e, 0x211e, 0x50f0,
+    0x85fb, 0x17d2, 0x32e0, 0xb67b, 0x8545, 0xa929, 0x302e, 0xc151, 0xa5d7, 0x7c7a, 0xc2ed, 0x4af6, 0xa50b, 0xc009, 0x36a2, 0x7934,
+    0xcfbb, 0x9af1, 0xd73d, 0x4598, 0x341e, 0xa6a9, 0xebc9, 0x4990, 0x82bb, 0x5bca, 0xbf1d, 0x6c38, 0xd1c5, 0x8327, 0x5ef6, 0xc9ad,
+    0x40cc, 0x4d9c, 0x7fec, 0x29e6, 0x149e, 0x91bb, 0x6744, 0xdf9d, 0x503a, 0x89f5, 0x1736, 0xacdb, 0xdc21, 0xe43b, 0x57a4, 0xcf8d,
+    0xb1c7, 0x64c0, 0xa91d, 0xaff9, 0x57b0, 0x848f, 0x8835, 0x205e, 0x5fa8, 0xeda9, 0x6df6, 0x38fc, 0xc4bd, 0xe5e5, 0x79a0, 0x8991,
+    0xd509, 0xaebb, 0x9f2f, 0x77c6, 0xc3bd, 0x63f8, 0x9d27, 0x8435, 0x3b52, 0xb4e3, 0x9e07, 0x6718, 0xe343, 0x2a76, 0x5752, 0xabd1,
+    0xc0e7, 0x7828, 0x3350, 0xa79d, 0x415e, 0x8d79, 0x2604, 0x33ac, 0xded5, 0x7344, 0xa61d, 0x6d32, 0xc8d7, 0x4c16, 0x9119, 0x5d2e,
+    0xd8e1, 0x81a1, 0x1714, 0x4734, 0x66c0, 0xb95b, 0x3e9e, 0x6a40, 0x92c1, 0x35bc, 0xb7d1, 0x18f4, 0x5bf0, 0x7c1c, 0x521e, 0x36f8,
+    0xa4fd, 0x6334, 0x8f53, 0x35ca, 0xae89, 0x6adc, 0x234e, 0x8eaf, 0x8979, 0xdcc7, 0x2ef0, 0x9a7f, 0x80c1, 0xb3a7, 0x2816, 0xe8c1,
+    0xb24b, 0xd16f, 0xb28f, 0x54de, 0xd8c9, 0x7e60, 0x653c, 0x3c6c, 0xbbad, 0x1efc, 0x9b31, 0xcd05, 0x272e, 0x8b09, 0x3c08, 0x7212,
+    0x2afa, 0x58ca, 0xa96d, 0x70fa, 0xa089, 0xb58b, 0x70d4, 0xd43b, 0x4ee4, 0x3236, 0xe527, 0x28ec, 0xcd19, 0x439e, 0x9343, 0x7d02,
+    0x3a2a, 0x71d8, 0xb999, 0xedc3, 0x7974, 0x5802, 0xb805, 0x6b24, 0xa009, 0x5708, 0xda31, 0x5f4e, 0x4342, 0x892d, 0x54d0, 0xa7dd,
+    0x5a74, 0x72d6, 0x4ffa, 0x2fd8, 0x7242, 0x2090, 0xb21d, 0xc5c7, 0xdf6b, 0x3fc8, 0xb895, 0xe089, 0x50da, 0x9dcd, 0x9fdb, 0x796c,
+    0xe19b, 0x8c0b, 0xb6ab, 0x3a48, 0x7dda, 0xeb21, 0xab11, 0xbc2f, 0x7b00, 0xb135, 0x3eec, 0x2932, 0x5a46, 0x9b3d, 0x42a6, 0x18ee,
+    0xd0ab, 0x955f, 0x6250, 0x22ec, 0xa4d1, 0x36c4, 0x7250, 0x9923, 0xc18d, 0x3ad2, 0x4498, 0x21b0, 0x9e67, 0x297a, 0xc83b, 0xd4f7,
+    0x4812, 0x3840, 0x952f, 0x7cd8, 0xbfa3, 0x7476, 0x39f8, 0x7b22, 0xcf0d, 0xdb4f, 0x2f6c, 0x6e5a, 0xc3bb, 0xe85d, 0x7864, 0x93b9,
+    0xaad5, 0xce35, 0xda83, 0x1a58, 0xc00b, 0xad8f, 0x430a, 0xbb1f, 0x4976, 0xe49d, 0x76d4, 0xc00d, 0xba85, 0x3002, 0x9b53, 0xeb93,
+    0x4264, 0xb949, 0x7332, 0xd471, 0x47be, 0xe0e7, 0x7c9e, 0x6d0c, 0x2744, 0xb5b7, 0x2036, 0x760e, 0x52ca, 0x67b0, 0x87c7, 0x3db8,
+    0x1cfe, 0xa09f, 0x6a36, 0x835d, 0xbdef, 0x654a, 0xa011, 0x283a, 0xd781, 0xaab1, 0x93f7, 0x2320, 0x47e2, 0xaf8d, 0x1a1a, 0x6ee2,
+    0x9f3f, 0x272e, 0xdd7d, 0xadc1, 0xd64d, 0x5bbc, 0xac41, 0x3e08, 0xc06f, 0x28c4, 0x6ed2, 0x6034, 0x797a, 0x211e, 0x2f20, 0x9157,
+    0x46a0, 0x2688, 0xdff5, 0x3598, 0x10b6, 0xc9af, 0x42e4, 0x973b, 0x34e2, 0xd267, 0x4bca, 0x883d, 0x288c, 0x6afe, 0x993f, 0x21ae,
+    0x4dba, 0x7036, 0xe373, 0x3fbc, 0x533c, 0xca51, 0x2e8a, 0x50d8, 0xd33d, 0x789c, 0xc3e1, 0x1706, 0x4474, 0x74c6, 0xca4f, 0x8f2b,
+    0x3566, 0x9639, 0x5fc4, 0xe891, 0x17c4, 0xc255, 0xa15f, 0x57b8, 0xb87d, 0x1d20, 0x41ac, 0xd995, 0x3060, 0xa7e1, 0x762c, 0xc10d,
+    0xacf7, 0x685a, 0xb835, 0xdbb7, 0x2a4a, 0xd52b, 0x85d3, 0xbe63, 0x6024, 0xd847, 0x93b3, 0xc197, 0x7c30, 0x9add, 0xea25, 0x8a59,
+    0x2e80, 0x664a, 0x1716, 0xdc71, 0xa797, 0x523e, 0xc1b7, 0x6540, 0xc32f, 0xb767, 0x6790, 0x56a4, 0xc887, 0x9721, 0x72e4, 0x5d1e,
+    0x8e27, 0x3dde, 0x23a8, 0x9965, 0xc3a7, 0x4510, 0x247a, 0xa16f, 0x8e65, 0x5768, 0xb6e1, 0x69e4, 0x4c34, 0xe809, 0xbe1b, 0xa12f,
+    0xcefb, 0x527e, 0xbfe1, 0x3a2a, 0x48ca, 0x2d1e, 0xc54f, 0x1b90, 0x7e84, 0xafbb, 0x9ad7, 0x48e8, 0x6cc4, 0xa477, 0x26f6, 0xcb67,
+    0xe081, 0x9ef5, 0x4cb6, 0x5fb4, 0x268a, 0x35b0, 0xe24d, 0x8b75, 0x782a, 0x3158, 0xc0f9, 0xa11b, 0xe6cd, 0xc949, 0x2094, 0xc189,
+    0x94bb, 0xedc5, 0xd53d, 0x9bfd, 0x3f4e, 0xd64d, 0xa94d, 0x2502, 0x5028, 0x9a1b, 0xa8cd, 0x2ebe, 0x5e46, 0xc565, 0x3c7a, 0x2e1c,
+    0x5e80, 0xa12f, 0xd425, 0x54a0, 0xab71, 0x9afd, 0x63f6, 0x5b1e, 0xd5c9, 0x88d3, 0xe0a1, 0xc501, 0x59c2, 0xd827, 0x76be, 0x9cdf,
+    0x4004, 0xe515, 0x57f2, 0x9a27, 0xca51, 0x83d1, 0xdad5, 0x511e, 0x2ac0, 0xab25, 0xdb93, 0x99c5, 0x551c, 0x6188, 0xb13f, 0xa085,
+    0x7718, 0xbfb3, 0x6078, 0x141c, 0x2be8, 0xea1d, 0xb077, 0x6756, 0x2c16, 0x9361, 0x53be, 0xac3b, 0x4b9a, 0x8f11, 0x309a, 0x1c0e,
+    0x5b5c, 0x3f18, 0x92f7, 0x6e18, 0x5230, 0xe049, 0x9793, 0x6e9e, 0x2344, 0x8e13, 0xa825, 0x1b84, 0xd797, 0x9131, 0x752a, 0xcb21,
+    0x62a4, 0xdbc5, 0x95fb, 0x5540, 0x1a94, 0x62de, 0x3a10, 0xd145, 0x5496, 0xea8f, 0x6272, 0x947b, 0xd809, 0x2ae6, 0xae39, 0xb92d,
+    0x626c, 0xc9a1, 0x230c, 0xab1d, 0x57fc, 0xcc17, 0x89af, 0x3a08, 0x75d4, 0x1700, 0x51d4, 0xe505, 0x7a7c, 0xa0ed, 0xbc2b, 0x372e,
+    0xe727, 0xba21, 0x8b97, 0x6934, 0xc927, 0x71cc, 0x271a, 0x8717, 0xa8cd, 0x6c3e, 0xe27b, 0xba0f, 0x48c2, 0xa7c5, 0x9ebd, 0x7a52,
+    0xd4ab, 0x7bde, 0x8fc1, 0xc2a7, 0x644a, 0xb1a7, 0xd8ef, 0x5906, 0xbe65, 0x9781, 0x178e, 0x7e0a, 0xabbd, 0xd15b, 0x4112, 0xbf5d,
+    0x5cf2, 0x2ef6, 0x8e71, 0xb2c9, 0x1ebe, 0xa7fd, 0x7228, 0xac2d, 0x92f1, 0x4870, 0x3384, 0xa87b, 0xd4f1, 0x9e45, 0x37d0, 0x6738,
+    0xd2ab, 0x4718, 0xb52d, 0x8f13, 0x73be, 0x4fbe, 0xe2a1, 0x6556, 0x93e7, 0xcd63, 0x3274, 0x7dac, 0x91e9, 0x4316, 0x83f9, 0x1c22,
+    0x301a, 0x992f, 0x4078, 0x8a5f, 0x5840, 0x9f35, 0x35fe, 0x1c84, 0x7eea, 0xa85b, 0x3b7a, 0x4cfa, 0x9c85, 0x20ba, 0xbacd, 0x474c,
+    0xda6f, 0xc363, 0x4928, 0x8afb, 0xcb6d, 0x4458, 0x7f2e, 0x27f4, 0xa507, 0x3cd0, 0x5bd6, 0xe0bf, 0x227c, 0x365a, 0xd6c1, 0x31d2,
+    0x78ca, 0x6bee, 0xe2d1, 0x8765, 0x33f8, 0x958d, 0xe273, 0xcdb3, 0x703a, 0x30bc, 0xd399, 0x3fa6, 0x80b3, 0x333e, 0x6e42, 0xa7eb,
+    0x1e7c, 0x63f4, 0xb12b, 0x903d, 0xd0c1, 0x7a82, 0x5e3e, 0x8a67, 0xc1f5, 0x62ba, 0x3d48, 0xdad9, 0x8689, 0x60d4, 0xbaa1, 0x5610,
+    0x8725, 0x337c, 0xc309, 0x844b, 0xd431, 0x972d, 0x727c, 0x1e60, 0x4a90, 0xc8a5, 0x710a, 0x14b6, 0x4cf2, 0x750a, 0x30e2, 0xaacf,
+    0x3af4, 0x47ee, 0x618c, 0x8bdb, 0xb5e7, 0x517a, 0x9561, 0x5c16, 0x6ebe, 0xc93b, 0x808d, 0x42f4, 0xac65, 0x8b13, 0x6a4a, 0xce2b,
+    0x8bfd, 0x1e8a, 0x439e, 0x6c5e, 0x2cba, 0xd83d, 0x1d24, 0x3240, 0x9753, 0x227a, 0x6e70, 0x8cff, 0xa2ed, 0x3876, 0x82bd, 0x2258,
+    0xb49b, 0x82e5, 0xbd7d, 0x483a, 0x646a, 0x223c, 0x3f58, 0x8fa9, 0x5db8, 0x771e, 0x8aa1, 0xbaa9, 0x7dd8, 0xe39d, 0x2daa, 0x3d4c,
+    0x8c25, 0xead1, 0x55b0, 0xcd7d, 0x8671, 0x9e01, 0x53a0, 0x8b5b, 0xbb37, 0x4492, 0x7ad4, 0xd553, 0x2978, 0xae8b, 0x81cb, 0xc58b,
+    0xe597, 0xa0e5, 0x7d8c, 0xba13, 0x366e, 0x57ca, 0x1dde, 0xccdf, 0xae11, 0x6312, 0x9b4f, 0x3f36, 0x3d7e, 0x790c, 0xab4d, 0x4b4e,
+    0xa16d, 0x2848, 0x7592, 0xa4a9, 0xcd99, 0xc0ff, 0x9271, 0x99b1, 0x42ce, 0x8991, 0xaf65, 0x3a5c, 0xc923, 0x7928, 0xde3b, 0x52c6,
+    0x838d, 0xe6b7, 0x3b88, 0x7746, 0x8cc1, 0x21a4, 0x6dba, 0xbe2f, 0xcccd, 0x63ec, 0x8caf, 0xc7d9, 0x3b3e, 0x64d0, 0x50da, 0x8be7,
+    0x7fb0, 0x5650, 0x36c0, 0x4a2e, 0x8cc7, 0x4782, 0xe00d, 0x835d, 0x50c2, 0xcbb3, 0xa119, 0x3166, 0xc4c5, 0x8a6f, 0x69be, 0xb6a9,
+    0x20a8, 0x5684, 0x4e3c, 0x9a2d, 0x77ec, 0x435a, 0x8bc5, 0x6902, 0x83fd, 0x4166, 0xb459, 0xdfd7, 0x5846, 0x47fe, 0x8653, 0xea1b,
+    0xba1f, 0x99e7, 0xd11f, 0x6880, 0x91ef, 0x810f, 0xe1fb, 0x2a1c, 0x63da, 0xd973, 0x7ef4, 0x85e7, 0x61ae, 0xbe05, 0x4ab2, 0xa261,
+    0x8557, 0x1d3c, 0xc685, 0x6b04, 0xd4b5, 0x3080, 0x805d, 0x403a, 0xa8fd, 0x5a16, 0x8573, 0xbaff, 0x62cc, 0xe663, 0xd701, 0x5090,
+    0x7f9a, 0xeaf3, 0xadeb, 0x5310, 0x6f36, 0xb547, 0xcac9, 0x4dd4, 0xe6eb, 0x2e68, 0x6c62, 0xd0d5, 0x3242, 0x5770, 0xce2b, 0x65a0,
+    0xa24b, 0x8073, 0xb1e3, 0x5870, 0x23b4, 0xb341, 0xe239, 0x923b, 0xd031, 0x14ac, 0x8a5b, 0xaba9, 0x82f7, 0x647c, 0xb199, 0xc3b7,
+    0x498e, 0xa80d, 0xbb5f, 0x55a2, 0x7112, 0xa967, 0x646a, 0x4d7c, 0x37cc, 0xe2ef, 0x832d, 0x9199, 0xc569, 0xa90f, 0x51e2, 0x42e2,
+    0xcb49, 0x8035, 0x3406, 0xd84f, 0x2918, 0x957d, 0xa7b3, 0x4cb2, 0xc6c9, 0x71b4, 0x9f99, 0x8181, 0x1cd0, 0x9587, 0x7602, 0xad21,
+    0x281a, 0x5336, 0x951d, 0x1d8c, 0xaa03, 0x4360, 0xc05d, 0xb41f, 0xd9ad, 0x9855, 0x3a28, 0x8057, 0xb4a7, 0x6c72, 0x902f, 0x861d,
+    0x70a2, 0xaa17, 0x25b4, 0xc6c1, 0x5ac4, 0x7936, 0xcf2f, 0x388e, 0x85ed, 0x255e, 0xd4d3, 0x8f09, 0x1f0c, 0xe413, 0x27e0, 0xad43,
+    0x520e, 0xdd25, 0xc5bd, 0x98bf, 0x62a4, 0xcd13, 0x88bd, 0xa10b, 0xc7f9, 0x4874, 0x5d4a, 0x15bc, 0x4422, 0xba7d, 0xcc7f, 0x5574,
+    0x9bf1, 0x1986, 0x6ce6, 0x9253, 0xdd09, 0xb099, 0x7986, 0xd3a1, 0xaa55, 0xe4d7, 0x1aac, 0x3b6c, 0x357a, 0xd14f, 0x509c, 0x7eb6,
+    0x1e42, 0xb4d3, 0x312e, 0xa353, 0x4372, 0x642e, 0xccdd, 0x22fe, 0x5fa0, 0xe2af, 0xa141, 0x68c2, 0xc53b, 0x43dc, 0x583e, 0xcee9,
+    0x6dc2, 0x4436, 0x2434, 0xd5e3, 0xab83, 0x8335, 0x9511, 0x7926, 0x485c, 0xc14d, 0x827d, 0x6e46, 0xcc1d, 0x5842, 0x1d1e, 0x2f86,
+    0x8729, 0x63c2, 0x3438, 0xad81, 0x4fd2, 0x722a, 0xa807, 0x2092, 0xbee3, 0x6f5e, 0xa3d1, 0x1f2c, 0x56fc, 0xb01f, 0x1acc, 0x95e5,
+    0x31a4, 0x58f8, 0xaa69, 0xd4b1, 0x348a, 0xdcf3, 0xb47b, 0x4d34, 0x33da, 0x9dd5, 0xabcb, 0x2e40, 0xb49d, 0xe163, 0x8167, 0x48b6,
+    0xc849, 0x1eda, 0xaffd, 0xd14f, 0x2fd6, 0xb68f, 0x64ba, 0xaae7, 0x1a4e, 0x3ca2, 0x8125, 0x4a3c, 0x68b8, 0x277e, 0xd8b5, 0x45b6,
+    0xc7b1, 0xad97, 0xb3e9, 0x3af0, 0xdba5, 0x2d8a, 0xb2cd, 0x2a3a, 0xe00f, 0x5fcc, 0xcb51, 0x8c3b, 0x2bc2, 0x6ba8, 0xa689, 0x1bee,
+    0x78d4, 0x401c, 0x21d0, 0x49a0, 0xd859, 0x390e, 0x4568, 0xb86b, 0x9ea3, 0x21a4, 0xb3e7, 0x54e6, 0x2d0a, 0xe035, 0x7020, 0x28fe,
+    0xde8b, 0x97ab, 0x5110, 0x348e, 0xa3ff, 0xba43, 0x9893, 0xc99f, 0x28aa, 0xa0df, 0xcd03, 0x4ade, 0x19ca, 0xb561, 0xa3bd, 0x44c6,
+    0xc7eb, 0x70e8, 0x28fa, 0xb5d5, 0x3320, 0xe18f, 0x924d, 0x69a2, 0xb8d3, 0x9ee5, 0x6096, 0xe567, 0x8771, 0xae77, 0x7414, 0x340c,
+    0x4d94, 0x2a50, 0xd4ef, 0x948d, 0x746e, 0x3350, 0x6aec, 0x48d8, 0x3afe, 0x770a, 0xc299, 0x4aec, 0xd37d, 0xb667, 0x550a, 0x9605,
+    0x2066, 0xc9e7, 0x2828, 0x39f4, 0xd389, 0x1d5a, 0x7aa6, 0xbaf5, 0x9835, 0xacc3, 0x527e, 0x0f20, 0x66e6, 0xdacf, 0x235c, 0x8b1d,
+    0xe801, 0x9381, 0x40aa, 0x6530, 0xc0df, 0x6c6e, 0x39e4, 0xe1af, 0x29c0, 0x47a4, 0x2aa2, 0xd4b3, 0xc4e7, 0x3860, 0x3d02, 0x6c9c,
+    0xe3ef, 0x7c5e, 0xbb89, 0x6ada, 0xdc51, 0x55ec, 0x8011, 0x57de, 0x289e, 0x6bae, 0xa981, 0x5a06, 0xd401, 0xe0ff, 0x20ae, 0xc89d,
+    0xda1b, 0x32fc, 0x8bdb, 0xde7f, 0x1b8c, 0xa68f, 0x462a, 0xe681, 0xc2df, 0x5466, 0x3e36, 0xbe83, 0x6844, 0x9dbd, 0x52fc, 0xbe75,
+    0x7a7c, 0x66c8, 0x803f, 0x36f8, 0xb8cb, 0x4afe, 0x7582, 0x411c, 0xe7c3, 0xb167, 0xd2a1, 0xa219, 0xead5, 0x7ac4, 0x6c24, 0x477a,
+    0x914d, 0xcd7d, 0x2a3a, 0x3982, 0xe6b5, 0x5bc6, 0x1a28, 0xb4ab, 0x34a0, 0x5b22, 0xbcc1, 0x6a22, 0x90e1, 0x76d4, 0xa7cf, 0xcf89,
+    0x6760, 0xdaad, 0x7fee, 0x703a, 0xc5f5, 0xbe89, 0x3820, 0x6fcc, 0xa745, 0x8afd, 0x17ba, 0x2f2c, 0x967f, 0x7250, 0x94e5, 0x3544,
+    0x8797, 0xa93b, 0x1d1c, 0x6752, 0xc32d, 0x324e, 0xe41d, 0x5d3a, 0xcf1f, 0x20e0, 0x32a2, 0xe3bd, 0xaa23, 0xbe4f, 0xde03, 0x9e3b,
+    0xd67f, 0xc73f, 0xe32b, 0x45d8, 0x830b, 0x2284, 0x5b24, 0xdd81, 0x52d6, 0x2da0, 0xdd23, 0x8ea7, 0x49b6, 0x82a5, 0x61a6, 0xd20d,
+    0x9525, 0x7d64, 0xb6b1, 0x4b26, 0x5f7c, 0x8f71, 0x58ca, 0x9e3f, 0x88d9, 0xe093, 0x5e62, 0x40b4, 0x71ac, 0x9e3d, 0x2890, 0xd623,
+    0xac21, 0x6758, 0x9eb1, 0x85a1, 0x9ba9, 0x7524, 0x3470, 0x9a9d, 0xda5b, 0xb77d, 0x5cbc, 0xe9ff, 0x9841, 0xb057, 0x5b68, 0x79a4,
+    0x2ffe, 0x9101, 0x7106, 0x19fc, 0xd13b, 0x9123, 0x5f90, 0xa23f, 0x9c4d, 0x1fa8, 0x6d7c, 0x3aea, 0xb905, 0x9855, 0xd4bf, 0x49be,
+    0x6aa6, 0xc7af, 0xb113, 0x702a, 0xab87, 0xbd29, 0x5a58, 0x878f, 0xccbf, 0x3df2, 0xc5f1, 0xa623, 0x9327, 0x1fa2, 0xc533, 0x8cc9,
+    0x5d78, 0xbb01, 0x780a, 0xa66f, 0x2116, 0x5db8, 0x48bc, 0x714e, 0x1746, 0x6938, 0xdda3, 0x932b, 0x7004, 0x3720, 0x67d0, 0x28c6,
+    0x923b, 0x5cac, 0xd07b, 0x4a8c, 0x7874, 0x61ca, 0x155a, 0x370a, 0x5776, 0x9181, 0x1c62, 0xb6f7, 0x510c, 0x94f3, 0x2242, 0xe195,
+    0x90ad, 0xc1a7, 0x40e8, 0x6200, 0xea03, 0xb103, 0x9797, 0x60d4, 0xb20f, 0xdcbb, 0x9b51, 0x2a20, 0x7210, 0x24b6, 0x3dd0, 0x8ac5,
+    0xdad9, 0x7e58, 0x5cbc, 0xa33d, 0xc93f, 0x8a15, 0x411c, 0xd085, 0x21a0, 0x6d48, 0xba19, 0x3fb8, 0xc96b, 0xa481, 0x74b8, 0xb7ad,
+    0x5718, 0x2820, 0x720e, 0xa199, 0xbdb5, 0x50d6, 0x7e3a, 0xa7bb, 0xdab5, 0xb8f3, 0x8c77, 0x5b70, 0xb1f5, 0xe0fd, 0x9495, 0xcfe3,
+    0xa383, 0x3c9e, 0xd1cf, 0x4582, 0x2fb6, 0xc703, 0x8b27, 0x3802, 0x9f93, 0xec07, 0xc4ad, 0x3eaa, 0x2cd6, 0xa487, 0x5660, 0x47d0,
+    0x5a68, 0x9e23, 0x7514, 0x36e4, 0x6770, 0x9a91, 0x25c0, 0x82c5, 0x9bc1, 0x4f6a, 0xa515, 0x78b8, 0xd2b5, 0x4bac, 0x32be, 0xdda1,
+    0x947f, 0x25da, 0x3f4e, 0xa465, 0xe301, 0x1b52, 0xafdd, 0x5788, 0x63c8, 0x2cc2, 0x8141, 0x5084, 0x94f1, 0x1fe0, 0xaa23, 0xdd01,
+    0x5596, 0xbf4d, 0x5ebc, 0xa795, 0x8edf, 0x9ba9, 0x6770, 0x4ac0, 0x801f, 0x9c8f, 0x2696, 0xb391, 0xe03d, 0x973d, 0x2bc6, 0xba1d,
+    0x57a2, 0x39b8, 0x9623, 0x470c, 0x22d2, 0xe0a5, 0x80bf, 0xaecd, 0x5184, 0xce03, 0x514a, 0xb9a3, 0xf0ff, 0xa85d, 0x1a74, 0xd423,
+    0x7ad4, 0x549e, 0xe467, 0x9d9b, 0x4d12, 0x6a28, 0x4172, 0xaf1b, 0x6cd6, 0x8aa9, 0xbe1b, 0x52a2, 0x2090, 0x8657, 0x602e, 0x7384,
+    0x4e42, 0x1558, 0x5b40, 0x9be7, 0xda73, 0xc175, 0x34f8, 0x86cb, 0xb99f, 0x73c6, 0x6958, 0xc02f, 0xd75f, 0xa529, 0x2c70, 0x452e,
+    0xc1e7, 0x65a2, 0x2e2c, 0x9d39, 0xc3bd, 0x7e2a, 0x3af8, 0x28c2, 0xcf71, 0x2594, 0x75e6, 0xcff7, 0x9175, 0x19e2, 0x5736, 0xbcad,
+    0x55b0, 0x3066, 0xe173, 0x4e8a, 0x1bd4, 0xdec3, 0xc669, 0x4688, 0x6e88, 0x7a80, 0x2c88, 0xa5d7, 0x3a00, 0x723a, 0xd1ed, 0xa16d,
+    0x4596, 0xc5eb, 0xeaf1, 0x50fe, 0x653c, 0x7cbc, 0xc869, 0x3466, 0x4d02, 0xd01b, 0x553a, 0xa235, 0x654e, 0x2608, 0xdc5d, 0x379c,
+    0x8be1, 0x5b38, 0xe233, 0x30e6, 0x8425, 0x1cbe, 0x90ef, 0x6cbe, 0x2c52, 0x7190, 0x4d46, 0x6798, 0xd92d, 0x4188, 0x7920, 0xb503,
+    0x345e, 0x2ab8, 0xd055, 0x46d2, 0x7b58, 0xe0a3, 0xc46f, 0xa291, 0xe5fb, 0x7d4c, 0x573c, 0x2f9e, 0xae6b, 0x8b03, 0xdb65, 0xbf31,
+    0xa3d3, 0x1c7e, 0x89ef, 0x99c3, 0xc83d, 0xa5eb, 0xbd13, 0x8b3b, 0xd42f, 0xc853, 0x7d1c, 0x39c4, 0x65aa, 0xcb45, 0x4576, 0xb7bf,
+    0x986f, 0x7262, 0xa33f, 0x17fe, 0x49b2, 0xc041, 0x2fae, 0xcc0d, 0x80c9, 0x24fc, 0x5f6a, 0x580e, 0xea03, 0xa35d, 0xc765, 0x6d2c,
+    0x38ae, 0xae93, 0x8715, 0xe763, 0x5766, 0x627c, 0x2b5e, 0xe19b, 0x5864, 0x853b, 0xd543, 0x2d44, 0x7f72, 0x4ad2, 0x33f0, 0x6476,
+    0xc7f3, 0x9c43, 0xcef1, 0x2ab8, 0xe08f, 0x3f12, 0x16ee, 0x6526, 0x764c, 0x3296, 0x9479, 0x6854, 0x4276, 0x7730, 0x2874, 0x7afc,
+    0x1830, 0x52e8, 0xae6d, 0x82ef, 0x6116, 0x9cc7, 0x2012, 0xc779, 0x52ec, 0x7646, 0x1ea2, 0x7d36, 0x8f35, 0xb7c3, 0x3a7c, 0x8835,
+    0xbd71, 0xd96b, 0xaa97, 0x4be8, 0xbf65, 0xce21, 0x559c, 0xb017, 0x1ca6, 0xd899, 0x8a25, 0x2992, 0x939d, 0xcb33, 0x6da2, 0x867d,
+    0x1aa6, 0xc105, 0xd6ab, 0x5de6, 0x6a62, 0x7db6, 0x98c7, 0xd66b, 0x23c0, 0x72f8, 0xbba3, 0x3598, 0xd761, 0x5cda, 0x3af8, 0x218a,
+    0xa605, 0xe3f1, 0x442a, 0x7000, 0x4c22, 0x2d2c, 0xc425, 0xd303, 0x7c50, 0xdd91, 0x4c2c, 0x7f94, 0x592e, 0x1a14, 0x41d6, 0x7b7e,
+    0xa139, 0x2566, 0xc933, 0xae43, 0x8497, 0x5882, 0x8f99, 0x181c, 0xda05, 0x9d75, 0x6ce8, 0x3c0c, 0x7fdc, 0x5870, 0x4ba6, 0xbf09,
+    0x967f, 0x380c, 0xcd69, 0x81d9, 0x8b09, 0xc191, 0xaa53, 0x2a84, 0x9819, 0x4f64, 0xacb1, 0x70c8, 0x7b16, 0x3e76, 0x2a76, 0xbfef,
+    0x90e1, 0xa7bf, 0x8251, 0x6ea6, 0x2b9c, 0x9851, 0x6436, 0xa937, 0xd0bf, 0x3fb6, 0x9291, 0x1cbe, 0x32ec, 0x79a6, 0xddbb, 0xb0dd,
+    0x5138, 0x23a6, 0xccc3, 0x84f7, 0x1d8c, 0xe521, 0xc2fb, 0x8ff9, 0x6b44, 0xb455, 0x34f6, 0x57e6, 0xc315, 0xe6ed, 0x3f92, 0x76f8,
+    0x8a97, 0xc68f, 0x3c58, 0x637c, 0xac8f, 0x8ee9, 0x5826, 0x1e4c, 0x8ee5, 0xc8e7, 0xd1e7, 0x8721, 0xb815, 0x195c, 0x5ec4, 0xaaa1,
+    0x65c0, 0x217a, 0x848b, 0xa525, 0xac35, 0x46b8, 0xe1a1, 0x6e9a, 0xb70b, 0x910d, 0x7a98, 0xf115, 0xacad, 0x425a, 0x7ccc, 0xb0cf,
+    0xa3a9, 0x266e, 0xba95, 0x762a, 0x6880, 0xc8f9, 0x5596, 0xd85d, 0xb39b, 0xe865, 0x8c07, 0x3622, 0x87c3, 0xa7f3, 0x4db0, 0xa4d3,
+    0x69bc, 0x80c3, 0xe415, 0x9c1d, 0x895f, 0x6f14, 0x27c6, 0x508e, 0xb867, 0x33ee, 0x4048, 0xbff1, 0xe8ef, 0x5032, 0x554c, 0x81cb,
+    0x41e2, 0xdc05, 0xb231, 0x55e2, 0x3432, 0x28b0, 0xdadd, 0x752e, 0x2ce0, 0x4884, 0xe475, 0x9aef, 0x2aa8, 0xd7cd, 0x7764, 0x5f64,
+    0x1da8, 0x4ad2, 0xd1f9, 0xbd65, 0x7bb8, 0x54c0, 0x87f7, 0xe03d, 0x4b80, 0x9927, 0x3c12, 0xb3d1, 0x93b7, 0x782a, 0x1d9e, 0xbc2d,
+    0x555a, 0x96df, 0x4124, 0x1d12, 0xb79b, 0x8125, 0x947d, 0xb49f, 0x46be, 0x3372, 0x9519, 0xdedf, 0x7476, 0xb72b, 0xe2ef, 0x1f18,
+    0xa933, 0x3f56, 0x5d78, 0x769c, 0x9317, 0xc3c7, 0xae21, 0xcc45, 0x5f80, 0x7f9c, 0x41e8, 0xcb4d, 0x2062, 0xba87, 0x5e7c, 0x4ec4,
+    0xbfd1, 0xd993, 0x7298, 0x2634, 0xb4a7, 0x81f7, 0xdbd5, 0x7228, 0xb4f7, 0x976f, 0x63d6, 0xd47d, 0x5712, 0x76b2, 0xe2e9, 0x7d6a,
+    0x1aec, 0x4070, 0x7c8c, 0x6204, 0xe45f, 0x8a13, 0x47c4, 0xd25b, 0x6920, 0x6972, 0xb4a9, 0x50cc, 0x1ea4, 0xaecf, 0x433e, 0x619c,
+    0x9903, 0x55c2, 0xb811, 0x86bb, 0x2bda, 0xcc79, 0x3894, 0xa563, 0x892f, 0xcf87, 0x9cf1, 0x4224, 0xb769, 0x8dcd, 0xc92f, 0x76ee,
+    0x68ac, 0x8c29, 0xbc83, 0x1fea, 0xb273, 0xdc31, 0x9a8b, 0x3ac2, 0x8897, 0x3494, 0xab9b, 0xceef, 0x39d8, 0xbfd9, 0xea9f, 0x91f1,
+    0xcfe1, 0x7046, 0xe767, 0x62e0, 0x26fe, 0x6a60, 0xa4bd, 0x3c24, 0x626a, 0x2cf8, 0xc5bd, 0x8b7b, 0xb613, 0x2ab0, 0xd783, 0x453a,
+    0x6df6, 0xaec5, 0x62e6, 0x3d38, 0x1ebc, 0x59f0, 0xdbfb, 0x85c9, 0x763c, 0xdb47, 0x4014, 0x9555, 0xdeb9, 0xcb55, 0xa939, 0xe5c9,
+    0x3456, 0x4518, 0xd24f, 0xb681, 0x537a, 0xe105, 0x4d5c, 0x86e5, 0x247a, 0x5646, 0xafcf, 0xcadd, 0x5116, 0xb933, 0x5fc0, 0x9bd3,
+    0x7d26, 0xe011, 0xb6ef, 0x4c60, 0x67aa, 0x38e8, 0xa883, 0x51fc, 0x6e76, 0xcc8d, 0x9c0f, 0xa547, 0x49a2, 0x87df, 0xad11, 0x9b9d,
+    0x4794, 0xddb1, 0x7dfe, 0xbdd1, 0x43d8, 0x7332, 0xd19d, 0xa629, 0x3f14, 0x5e7a, 0x1f04, 0x4b8c, 0x4618, 0xdeab, 0x8d5f, 0x29b6,
+    0xd8b3, 0x74b0, 0x3748, 0xbf71, 0x3140, 0x8d3b, 0x1de8, 0x8191, 0xc051, 0x3dfe, 0x2b54, 0xcb2d, 0x1afa, 0x80dd, 0xbf77, 0x63f4,
+    0xd6c9, 0x8831, 0x38e0, 0x494c, 0xe9c9, 0xb63b, 0x3d0c, 0x3262, 0x8a17, 0x5de6, 0x1b94, 0xb427, 0xd097, 0x624a, 0x3270, 0xe5e5,
+    0xcfb9, 0x4888, 0xa9e3, 0x5086, 0x1b22, 0xb555, 0x3838, 0x871f, 0xd36f, 0x927d, 0xa717, 0x6d1e, 0x1cf6, 0x9379, 0x248c, 0xccc9,
+    0x63dc, 0x3122, 0x79da, 0xc983, 0x6ee2, 0x8ebb, 0x5d32, 0xa72d, 0x1dc2, 0x6250, 0xb52b, 0x5478, 0x8819, 0xaf57, 0x3c52, 0xc2b3,
+    0xda29, 0x83b3, 0x346e, 0x9419, 0x9a61, 0x3efa, 0x6a9e, 0x1fbe, 0xb64f, 0x79f6, 0xd75b, 0xc7b1, 0x486a, 0x60bc, 0xa1d1, 0xdd91,
+    0x2df4, 0xca59, 0x7060, 0x2d24, 0xa9cf, 0xd111, 0x3a6c, 0x6e6a, 0xa901, 0xc47f, 0x6474, 0xa8f3, 0x3962, 0x99a1, 0x659c, 0x86bd,
+    0x8793, 0xdd21, 0xbb23, 0x4eda, 0x61a6, 0x315e, 0x8f9d, 0x4a20, 0xaf63, 0xe67b, 0xc549, 0xad87, 0x874b, 0xeab5, 0x9fe3, 0xb533,
+    0x8e83, 0x33f4, 0x99d1, 0xe78b, 0x3e8c, 0xa53d, 0x55d4, 0x3f54, 0x885b, 0x2d86, 0xb82f, 0x433c, 0xc289, 0xa82d, 0x2b56, 0x9aaf,
+    0x6b86, 0xc479, 0x2a68, 0x92a5, 0x33a0, 0x180a, 0x7720, 0x97af, 0x3246, 0xbfbd, 0x45e0, 0xe4e1, 0xa55d, 0x8149, 0xe0c9, 0xbfdb,
+    0x31de, 0x7244, 0xe605, 0x4904, 0x961b, 0xc467, 0x5146, 0x5fd8, 0x4024, 0xe297, 0x5850, 0x122a, 0x6b4a, 0xad55, 0xe4c5, 0x2faa,
+    0x1c32, 0x94bd, 0x4c7e, 0xc81b, 0x6b7a, 0x7be4, 0x5632, 0x1962, 0x61da, 0xb893, 0x711c, 0x9f43, 0x5474, 0x852d, 0x66b4, 0x2fc4,
+    0x4e94, 0x14d0, 0x82c1, 0xb68d, 0x3d2a, 0xd935, 0xc731, 0xc8e1, 0x847b, 0x5ac4, 0xa16f, 0x236a, 0xcfaf, 0x66f4, 0x8c41, 0xc29f,
+    0x8c87, 0x2220, 0xa1d9, 0xdb47, 0xb553, 0x6b62, 0x3602, 0xc3d5, 0x1416, 0x62d4, 0xbdc5, 0x2c40, 0x5260, 0x6cec, 0x4c8c, 0x8477,
+    0x1dbc, 0x63de, 0xa4c1, 0x1d48, 0x366e, 0xb28b, 0xc503, 0x737e, 0x1fa2, 0xe595, 0x809b, 0x6eec, 0x809d, 0x9739, 0x17de, 0x3362,
+    0x8953, 0x3dec, 0x59e2, 0x93db, 0xd693, 0x5a0c, 0x8747, 0xd9dd, 0x1f5e, 0x3e3a, 0x8917, 0x64d8, 0x2a3a, 0xc7a5, 0x33f8, 0x61ba,
+    0x1d5a, 0xa67d, 0x2348, 0x8f65, 0x9fab, 0x2d54, 0x606a, 0xb8b5, 0xe539, 0x8d13, 0xab2d, 0xa405, 0x6ac6, 0x9ce1, 0xcaf9, 0x4a58,
+    0xbcff, 0x923b, 0x5cc2, 0xdc67, 0x70f4, 0x513a, 0xc8e5, 0x606e, 0x2582, 0x9ed9, 0x6b8c, 0x913b, 0x5a7a, 0x9c6d, 0x3ade, 0x1ca4,
+    0x4df4, 0xc765, 0x68c8, 0xa6dd, 0x9813, 0x2268, 0x9c99, 0x7dd0, 0xbda5, 0xa7e9, 0xc72b, 0x7078, 0x2cf6, 0x984d, 0xb92b, 0x1ecc,
+    0x8d65, 0x21da, 0x5f94, 0x3374, 0xe81b, 0xd1d1, 0x5d0c, 0xa943, 0x1e54, 0x6094, 0xc777, 0x86f9, 0xd0d5, 0xb55d, 0x7632, 0xc1ef,
+    0x9b3b, 0x4b1c, 0xb08b, 0x2780, 0xe4fd, 0x886f, 0x48a6, 0xce8b, 0x7d9c, 0x98a9, 0xbcb1, 0x16bc, 0x62b6, 0xe819, 0x2d44, 0xa093,
+    0x5cbc, 0xabed, 0x6244, 0xdff7, 0x2d92, 0xd2bf, 0xb06b, 0x9525, 0x5e92, 0x52ce, 0x862d, 0x1ece, 0x2c8e, 0xda83, 0x43e4, 0x8031,
+    0x4d7c, 0xb76d, 0xd8f1, 0x8879, 0x5794, 0xdb0f, 0x5db2, 0x1da4, 0xe41b, 0x7d78, 0x1c8e, 0x5200, 0x21e4, 0xc335, 0xd259, 0x311a,
+    0x4068, 0x6e40, 0x223c, 0xa9b5, 0x3cf4, 0xcd97, 0x59da, 0x6e2e, 0x27c8, 0x14ea, 0x494e, 0x6bd2, 0x2ed2, 0x52a2, 0x38d2, 0xda77,
+    0x6728, 0x406a, 0x7e68, 0xc3f1, 0x4ad6, 0x9037, 0x270a, 0xc58f, 0xd917, 0x495a, 0xaaf1, 0x85bd, 0x1a74, 0x5f26, 0x445a, 0xdc21,
+    0xb941, 0x5d0e, 0xac5f, 0xde0f, 0xc1a9, 0x65ce, 0xa70b, 0xda6d, 0x2792, 0x9967, 0x7b3e, 0x8ef7, 0x6314, 0x231e, 0x5c16, 0xd05f,
+    0x8d3f, 0x8243, 0x3c8e, 0x5cf6, 0x1a7a, 0x7480, 0xe2af, 0xba33, 0x1ede, 0xa7b7, 0x6b76, 0xcee1, 0x2e0e, 0x921b, 0x541a, 0x5758,
+    0xafbd, 0xd7e5, 0x2a08, 0xa91f, 0x8847, 0x3424, 0xea35, 0xb293, 0xcdb9, 0x469c, 0x8853, 0x27c8, 0xd1b1, 0x9b93, 0xb47d, 0xade5,
+    0xd7cb, 0x94d5, 0x4538, 0xa2ed, 0xcb2f, 0x54ba, 0x71de, 0x2584, 0xb1e5, 0xd5c3, 0x520e, 0x6ef6, 0x45e8, 0x9a6b, 0xa91d, 0x3188,
+    0x5bbc, 0xde31, 0x2e72, 0x79ea, 0xa27b, 0xcb99, 0x454c, 0x9775, 0x5536, 0xa067, 0x915f, 0xb06b, 0x1e72, 0xce7d, 0xa0db, 0xb357,
+    0x7c9e, 0xc3db, 0xed9f, 0x89fd, 0x7b60, 0x606e, 0x351a, 0xd743, 0xc0d7, 0xa25f, 0x4564, 0xc107, 0x2834, 0xe45f, 0x70b6, 0xda9f,
+    0xc6bb, 0x612e, 0xa3d7, 0x311c, 0xb4b5, 0x2a14, 0x9c5d, 0xc715, 0x53e8, 0xb021, 0xe0cd, 0x209e, 0xd157, 0x6374, 0x8feb, 0xc87d,
+    0xe0b5, 0x7634, 0x52fa, 0x4e8e, 0xcd59, 0xde0b, 0x7f06, 0x24dc, 0x479c, 0x719c, 0x33ec, 0xdf2b, 0xb7e1, 0x3b18, 0x7782, 0x3124,
+    0xa1ad, 0x43b2, 0xce03, 0x2276, 0xa4cd, 0x912b, 0x7c54, 0xd7b5, 0x9d89, 0x594a, 0xdf5f, 0x4af0, 0xb8d3, 0xd151, 0x7122, 0xe3ed,
+    0x7e86, 0x9acd, 0x1bb0, 0x5858, 0xd58f, 0x7184, 0xc633, 0x66ec, 0x1fbc, 0x44e2, 0x53ce, 0x3bfc, 0xdd97, 0x89b7, 0x584c, 0x688c,
+    0x7a22, 0xbbad, 0xc685, 0x72c4, 0xa4f7, 0x94b1, 0x7da2, 0xdfc1, 0x4976, 0x71b0, 0x28d0, 0x4d90, 0x3b34, 0x5c18, 0x3db2, 0x2df2,
+    0xdd19, 0x8111, 0x6378, 0x9c2b, 0x46da, 0xbbcf, 0x37e2, 0xb5bb, 0xe687, 0x866b, 0x435e, 0xcbad, 0x72b4, 0x8747, 0x49ca, 0x8d1d,
+    0x6d64, 0x2928, 0x3d02, 0x7caa, 0xb15d, 0x5b68, 0x38e6, 0xc83f, 0x31c8, 0xdf8f, 0xadd1, 0x9a17, 0xb7d3, 0x6f3c, 0xaf1d, 0x711e,
+    0x96ef, 0x1e8c, 0x6898, 0x9e55, 0x3e46, 0x27cc, 0x8c17, 0xbd13, 0x545e, 0x950b, 0xb9cb, 0xcd89, 0x830b, 0x6e38, 0x4d9a, 0xa54b,
+    0x7fe4, 0xca91, 0xa0d5, 0x96b9, 0xe855, 0x8cf7, 0x9bc5, 0xdd6b, 0xbfff, 0x9fbd, 0x661e, 0x9343, 0xd607, 0x7ba6, 0x2184, 0xc623,
+    0x1f88, 0xa3d5, 0x59c6, 0x2aa0, 0x64c2, 0xd923, 0xaed1, 0x802d, 0x1dd8, 0x70e6, 0xe3f9, 0x61be, 0xd035, 0x8559, 0xc115, 0x5366,
+    0x86d3, 0x3594, 0x77c2, 0x44aa, 0x6f8e, 0xb421, 0x41fc, 0x52ac, 0xa9e3, 0x6430, 0xd141, 0x4a5e, 0x3380, 0xc37f, 0x992f, 0x4846,
+    0x2074, 0xd56b, 0xb9a7, 0xcdbb, 0xaac5, 0x93a7, 0x2fb2, 0x8561, 0x75c8, 0x3a72, 0x8db1, 0xc9ff, 0x7e74, 0x3e58, 0xce9b, 0xc427,
+    0x3226, 0x7326, 0x5802, 0xdfa5, 0x4192, 0x6906, 0xa1c7, 0xba0d, 0x517e, 0x7652, 0xe3b1, 0x1604, 0x6ec8, 0x41c4, 0x2684, 0x68a4,
+    0x3fb4, 0xc1b9, 0x6024, 0x770a, 0x2fd0, 0x834d, 0x946f, 0x45a6, 0x8c9b, 0x3976, 0xbc1f, 0xea01, 0x922b, 0x1a4a, 0x4e6c, 0x78c4,
+    0xcc47, 0x4e60, 0x8499, 0x5f20, 0x4da2, 0x2246, 0x88b3, 0xb6bf, 0xe39d, 0x4536, 0xcbef, 0x79e0, 0x8fcf, 0x4120, 0x5cca, 0x37c2,
+    0xd297, 0x5ec8, 0x4c0c, 0x296e, 0xd5c7, 0x9ba9, 0x7a6a, 0x5590, 0x8f29, 0x5b60, 0x2f30, 0xaf8f, 0x3b02, 0xa8d3, 0x4bac, 0xb343,
+    0x8297, 0x18bc, 0xcf41, 0x70c6, 0x8edf, 0xded5, 0x42ca, 0x75e2, 0x30d6, 0x91d7, 0x648c, 0x9e6f, 0x7d90, 0xb4b9, 0x521a, 0x7f96,
+    0x4432, 0xb351, 0x9a07, 0xcf15, 0x7036, 0x359c, 0x4eee, 0x9a7b, 0xc281, 0xcaf5, 0x58ec, 0x8cd5, 0x26f2, 0x6a5a, 0x613e, 0xe079,
+    0x86bd, 0x6f46, 0xc31d, 0x5de6, 0x48ce, 0xbd25, 0x33ac, 0x2d6e, 0xacaf, 0x827f, 0xbd49, 0x35ec, 0x841d, 0x2aba, 0x5494, 0xacef,
+    0x3288, 0xbb21, 0xdbf5, 0x35f8, 0x82cb, 0x2794, 0x50f8, 0xdec5, 0x7574, 0xd82f, 0x9c03, 0x7f7c, 0xaab7, 0x4524, 0xd64f, 0xae25,
+    0x405a, 0xddd5, 0x8b7f, 0x4dec, 0x3e3a, 0x24c0, 0x638a, 0x3360, 0xbf91, 0xdc7d, 0x9a9f, 0xbc05, 0xdf95, 0xa707, 0x9033, 0x70a6,
+    0xa837, 0x2410, 0xd48f, 0x9091, 0x2b92, 0x750a, 0x9417, 0x1ff2, 0x58ba, 0x296e, 0x4ef6, 0xdb01, 0x3676, 0xab73, 0xc6b5, 0x2152,
+    0xdce9, 0xd373, 0x9f05, 0xc4a3, 0x4f5e, 0x6bc2, 0x9ca7, 0x83b7, 0xaea7, 0x431e, 0x6652, 0x769c, 0x4858, 0x870f, 0xce43, 0x2c8c,
+    0x8cf9, 0x38f8, 0xe6e5, 0x7b5e, 0xc389, 0xb27d, 0x8405, 0xd563, 0x2eea, 0x3aba, 0x8aaf, 0x4ff8, 0xdf83, 0x9c07, 0x194c, 0xb563,
+    0xe39d, 0x2b6e, 0x5450, 0x3cb8, 0x6158, 0xb693, 0x209c, 0x3ba4, 0x8d0b, 0x7f5e, 0xdb71, 0x43a6, 0xbd35, 0xa9df, 0x5d58, 0x8b91,
+    0x72ee, 0xe3dd, 0xbc2d, 0xcae5, 0xa0af, 0x71bc, 0x3624, 0x5e40, 0x912b, 0xaac7, 0x3de2, 0x728a, 0x9ca5, 0x356c, 0xad87, 0x6fb2,
+    0x1f84, 0xe0cf, 0xa585, 0x4fd0, 0x22c0, 0x936f, 0xe3f5, 0x7088, 0x854f, 0xc59d, 0x22e4, 0xa963, 0xbc65, 0x8e97, 0x395c, 0x6ada,
+    0xa691, 0x5dea, 0x234a, 0x7798, 0x5ab0, 0xd615, 0x48dc, 0xb301, 0xd77b, 0xa165, 0x54ba, 0xe429, 0x7932, 0x18da, 0x6534, 0x931b,
+    0x40f8, 0x7ab6, 0xabdd, 0x6b18, 0xb47d, 0x47b2, 0x1b9e, 0x807d, 0x6394, 0x2a80, 0xab49, 0xba73, 0x6052, 0xc7f5, 0xe289, 0x7cde,
+    0x5880, 0xa767, 0x21b2, 0xadf1, 0xdfe1, 0x59ce, 0x1d0e, 0xe639, 0x6a04, 0x7122, 0x261e, 0x88b3, 0x5d02, 0xb4af, 0xe45b, 0x71f2,
+    0xb4e7, 0x9aef, 0xc0bb, 0x35b6, 0xe375, 0xc329, 0x7cf4, 0x7016, 0x27fe, 0x5eb4, 0x4af2, 0x31c0, 0xe56d, 0xaecf, 0x8c61, 0xc345,
+    0x1b90, 0x9247, 0xa73f, 0x75e8, 0xbaff, 0x4300, 0x1908, 0xa9e3, 0x3dda, 0x7814, 0xd93b, 0x9221, 0x6510, 0xc9e1, 0x5134, 0x2c38,
+    0x9135, 0x4404, 0xe93d, 0x393c, 0x536c, 0xc603, 0x15da, 0x6704, 0xb889, 0xcebd, 0x47e2, 0xc417, 0x3488, 0x72e2, 0x9c21, 0x2bc6,
+    0xd053, 0x7cda, 0x2d94, 0x1b16, 0xb38f, 0x7f42, 0xa94b, 0x92c5, 0x62b8, 0x198e, 0x7b20, 0x50f8, 0xcbd1, 0xab55, 0xbc07, 0x1e20,
+    0x52c0, 0xa751, 0x3076, 0x8699, 0x9de1, 0xe7eb, 0x6b32, 0xc5c5, 0x41b2, 0x6d2a, 0x224e, 0xcda5, 0x79b2, 0xa421, 0xd85b, 0x9217,
+    0x62d0, 0x73b2, 0xa1e1, 0x5516, 0xc267, 0xadbd, 0x9299, 0x3e02, 0xb341, 0x92e5, 0x2e06, 0xc589, 0x6750, 0x1d52, 0x95cf, 0x3210,
+    0x591e, 0x997d, 0x2e26, 0xcbb3, 0xb007, 0xd5f9, 0xb67f, 0x5486, 0xa0b3, 0x3ce2, 0x88e5, 0x63d2, 0x25ac, 0x7d86, 0xceb1, 0xe5a7,
+    0x5a26, 0x3960, 0xc74d, 0x7df8, 0xaf2d, 0xdd9d, 0x5b12, 0xcf35, 0x6d28, 0xa749, 0xbca7, 0x9c97, 0x1f9e, 0x5f00, 0xbc57, 0x740e,
+    0x3c94, 0x8d93, 0xa7c7, 0x17b4, 0x8007, 0xe631, 0x23b0, 0x88fd, 0x4dbe, 0xccb3, 0x18ce, 0x59a0, 0xc955, 0x357e, 0x53aa, 0xd6ef,
+    0xbd4d, 0x601a, 0xc847, 0x1708, 0x9029, 0x6d52, 0x40c2, 0x5f26, 0x9f4d, 0x6c44, 0xd4df, 0xaa99, 0x36ca, 0x6074, 0x8617, 0x3e92,
+    0x654c, 0x97b9, 0xbf07, 0x738e, 0x1c88, 0xc82b, 0x4d5c, 0x65c6, 0xd163, 0x594a, 0x347e, 0x1b18, 0xc7f3, 0x4ba2, 0x9d23, 0xbdf3,
+    0x4f2e, 0x317e, 0x8cdb, 0x14fa, 0x7c78, 0x4940, 0xe483, 0xb989, 0x5564, 0x68c0, 0xc8e9, 0x26f2, 0x56b6, 0xdbd3, 0x448c, 0x931b,
+    0xc7f5, 0x6d12, 0x8839, 0xc663, 0xd469, 0x9c57, 0x19d6, 0xbd0f, 0x4510, 0x2fb0, 0x6e84, 0x92b1, 0x6356, 0xec59, 0x75b4, 0xb573,
+    0xe161, 0x99db, 0x3d74, 0x8bfd, 0x9aef, 0x4130, 0x663c, 0x59fe, 0x27fc, 0xc55b, 0x41b8, 0x31c2, 0xafb3, 0xb62b, 0x9d23, 0xeff5,
+    0xc39d, 0x1892, 0xd41d, 0x91ed, 0x2984, 0xc80b, 0xd7ab, 0x9a3d, 0xbf61, 0x3a5e, 0x93bf, 0xdf7f, 0x4a16, 0x9e19, 0x9019, 0x1b96,
+    0xc8c3, 0xedbb, 0x899b, 0x3856, 0xc9f3, 0x6ea4, 0xa515, 0xd583, 0xbe8d, 0x55d2, 0xa89b, 0xce9d, 0x64ae, 0x3cb4, 0xd12d, 0x2896,
+    0x57a0, 0x3dfc, 0xd50d, 0x73ec, 0xa64f, 0x5fd2, 0x38c4, 0xd4c5, 0xa3a7, 0xb739, 0x877d, 0xa79d, 0x6c10, 0x240a, 0x5086, 0x7dc8,
+    0x4030, 0x6988, 0x3ab2, 0xbe29, 0x5f08, 0xa2ef, 0xe46d, 0x7096, 0xd267, 0xa517, 0x201a, 0xd3bb, 0x9aa7, 0x7f1c, 0x358c, 0xcc51,
+    0xa991, 0x6a88, 0xbc8d, 0x7f86, 0xa453, 0x6b00, 0x948b, 0x8f61, 0xe69d, 0x22d8, 0x4ccc, 0x81d3, 0x2d8a, 0xe207, 0x4c30, 0xc0bb,
+    0x67a8, 0x54f8, 0xa82d, 0x82ed, 0x693e, 0xe49d, 0x2998, 0xd1c1, 0x437c, 0x9fa9, 0xe92f, 0xb41d, 0x2ca2, 0x426c, 0x8ee5, 0x9c51,
+    0xc749, 0x3f22, 0xdb2b, 0x7e58, 0x2110, 0x4d72, 0x8341, 0x912f, 0x5e16, 0xe5db, 0x98e9, 0x64ee, 0x3856, 0xadb3, 0x1cc4, 0x43c4,
+    0xc4bd, 0x2802, 0x4012, 0xcced, 0x8cfb, 0x630c, 0x4402, 0xc64d, 0x8c39, 0x54d2, 0x1598, 0xec07, 0xb915, 0x7426, 0xcb03, 0x8b85,
+    0xe4c1, 0x1ea8, 0x6460, 0x84bd, 0x5dfa, 0x1aa2, 0x8ef5, 0x8159, 0xcd63, 0x19c8, 0xace1, 0x45fc, 0xbcb1, 0x4fec, 0x30ca, 0x19d2,
+    0xb703, 0x9d29, 0x65e2, 0x4696, 0x1554, 0x6470, 0x8dcd, 0x8897, 0x370a, 0xcc81, 0x7f3e, 0x89cf, 0x6ba4, 0xe117, 0x9f51, 0x5280,
+    0x5f66, 0xbd31, 0x5650, 0x2de0, 0x90a5, 0xc68f, 0x3f56, 0xdd67, 0x60d8, 0x95f1, 0xbf8b, 0xae35, 0xed63, 0x9f0f, 0x1ad0, 0x75a0,
+    0x4f26, 0xa089, 0x871b, 0x4a20, 0x3a7a, 0xde8b, 0x2c7e, 0xaf11, 0xc613, 0x17c2, 0x64c6, 0x29a8, 0x7232, 0xcc6d, 0xc24d, 0xd575,
+    0x523c, 0x8731, 0x3b42, 0xde71, 0xa581, 0x80c3, 0xa9cd, 0x345a, 0x9639, 0xb2a9, 0xc2d3, 0x8daf, 0x7680, 0x28f6, 0xe6a7, 0x41d0,
+    0xa0d7, 0x6626, 0xd901, 0x3932, 0x516e, 0xc229, 0xa427, 0x3082, 0xcf13, 0x4744, 0xbebf, 0x9139, 0xb4b9, 0x7002, 0xa5e5, 0x5666,
+    0x2ae0, 0xb42f, 0x3b0e, 0x2a6c, 0x7ff8, 0x5c02, 0x2d3c, 0x8f75, 0xa2c3, 0xbac5, 0xdccd, 0x5196, 0x276a, 0xcbc1, 0x1828, 0x4d4a,
+    0x31fa, 0xc2c3, 0x6996, 0xe3fb, 0x22e6, 0xcbcb, 0xc57f, 0x992d, 0x17b0, 0x8a2d, 0x7140, 0x5bb4, 0xcea7, 0x56e4, 0x2094, 0x7268,
+    0xa2af, 0x29c0, 0xb78d, 0x4ff8, 0x7256, 0x8b99, 0x5bb4, 0x2250, 0x54ec, 0xd173, 0x7088, 0x82a1, 0x2036, 0x31ee, 0xb0c1, 0x5a0c,
+    0x2b42, 0x717c, 0x4226, 0x4d9e, 0xbb97, 0x7b4a, 0x356a, 0x29d2, 0x9f6d, 0x6b06, 0x3ee2, 0xdef1, 0x2cbc, 0x88bf, 0x8511, 0x9be1,
+    0x1868, 0x88f5, 0x5308, 0x7ad6, 0x15f8, 0xb28f, 0x43c8, 0x2df8, 0xc857, 0x1d96, 0xe0ff, 0x9bb3, 0x46b4, 0xd7ab, 0xc3d3, 0xa3e3,
+    0xec47, 0xd9df, 0x82e5, 0x23c8, 0xdd13, 0x67f8, 0x8a55, 0x25e8, 0xbe11, 0x562c, 0x3dc0, 0x6ce8, 0x203c, 0xb8d7, 0x8c6d, 0x66c0,
+    0xe181, 0x4abc, 0x1d12, 0x89a1, 0x28d2, 0xd429, 0x4ee6, 0xbf31, 0x3b54, 0x6e10, 0xac3b, 0xc38f, 0x9bcd, 0x9231, 0xabc3, 0x1588,
+    0x8ffb, 0xc7f9, 0xe2fd, 0x438c, 0xc47b, 0x4c32, 0x8eb5, 0x5bd2, 0xc0e5, 0x32ac, 0x6fd4, 0x98af, 0x5eb2, 0xcabf, 0xe799, 0x69b8,
+    0x46ce, 0x9073, 0x6242, 0xbc51, 0xd3cb, 0x316c, 0xa7bf, 0x1820, 0xb461, 0x4fa0, 0xadf3, 0xcc1f, 0x4cde, 0x6ba6, 0xc2fb, 0x83c7,
+    0x5e16, 0xeb61, 0x8039, 0x65a6, 0x1344, 0xe1af, 0x76ae, 0x1fdc, 0xa4e3, 0x6642, 0x413a, 0x809f, 0x334e, 0x477e, 0x5ff8, 0xab1d,
+    0xc6c9, 0x4634, 0xb8f3, 0xe8fd, 0x9959, 0x369a, 0xc7cf, 0x4a4a, 0x6c7c, 0x5a72, 0xdfb3, 0x2a32, 0x719c, 0xb5d5, 0x9477, 0x5c4a,
+    0x77fe, 0x8859, 0x2ea4, 0xe5c3, 0xaa85, 0xce3f, 0x4250, 0xab35, 0x1f80, 0xeaef, 0x441e, 0x16e2, 0xac05, 0x4144, 0x2d92, 0xd027,
+    0x2340, 0xa0e9, 0x4708, 0xd89b, 0x6838, 0xa075, 0x503c, 0xb219, 0x71c2, 0x2b8e, 0x7f4e, 0x1fee, 0x4a6a, 0x9339, 0xb25f, 0x6ccc,
+    0xdf0d, 0x2e90, 0x6c6c, 0xb341, 0xd0b1, 0xa699, 0x73fa, 0xe0d3, 0x98e7, 0x8507, 0xf0c5, 0xa647, 0x5676, 0x9399, 0x3f0c, 0x26fe,
+    0x7cc6, 0xd591, 0xb14b, 0x4bd2, 0x8d25, 0x5c7e, 0xc6d5, 0xddef, 0x179e, 0x5ebe, 0x4c3c, 0xa48d, 0xe02f, 0x65f8, 0x7f80, 0x15ea,
+    0xd777, 0xc18f, 0x81ff, 0xab85, 0x69c2, 0x902d, 0x1cc0, 0x736c, 0x8dad, 0x98af, 0x1d88, 0x7a58, 0x4418, 0x161c, 0xc96b, 0x841b,
+    0xda67, 0x4fda, 0xa775, 0x6b46, 0xe629, 0xb467, 0x4be6, 0xd715, 0x6510, 0x79d8, 0x3cac, 0x9a1b, 0x7d1a, 0x4554, 0x9f4d, 0x8e6b,
+    0x7ede, 0xd2cd, 0x4f78, 0xb11d, 0x2cc2, 0x81e7, 0x7db2, 0xf155, 0xae39, 0xc6a1, 0xdd87, 0x1fba, 0xa553, 0x8311, 0x47b2, 0xe1bd,
+};
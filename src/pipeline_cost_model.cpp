@@ -0,0 +1,164 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipeline_cost_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "gls_logging.h"
+
+static const char* TAG = "DEMOSAIC";
+
+// Weight of the last measurement in the cost coefficients
+static const constexpr float kCostSmoothing = 0.3;
+
+// Bilateral grid pass on a pyramid level relative to a 5x5 denoiseImage pass of the same level
+static const constexpr float kBilateralGridWorkload = 0.5;
+
+/*static*/ const char* PipelineCostModel::stageName(Stage stage) {
+    static const char* names[kStages] = {"demosaic",         "rawDespeckle", "despeckle", "pyramidDenoise",
+                                         "localToneMapping", "postProcess"};
+    return names[stage];
+}
+
+/*static*/ float PipelineCostModel::workload(Stage stage, int width, int height,
+                                             const DemosaicParameters& demosaicParameters) {
+    const float megapixels = width * height / 1e6f;
+    const auto& processingParameters = demosaicParameters.processingParameters;
+
+    switch (stage) {
+        case PyramidDenoise: {
+            // Each level has a quarter of the pixels of the previous one, the cost grows with the window area
+            float levelsWorkload = 0;
+            const int levels = std::clamp(processingParameters.pyramidLevels, 1, 5);
+            for (int i = 0; i < levels; i++) {
+                const bool wideWindow = demosaicParameters.denoiseParameters[i].gradientBoost > 0;
+                const int radius = wideWindow ? std::min(processingParameters.maxDenoiseRadius, 4) : 2;
+                levelsWorkload += std::pow(0.25f, i) * (2 * radius + 1) * (2 * radius + 1) / 25.0f;
+            }
+            // The bilateral grid splat and slice read each pixel of the level once, on top of denoiseImage
+            const int gridLevels = std::clamp(processingParameters.bilateralGridLevels, 0, levels);
+            for (int i = 0; i < gridLevels; i++) {
+                levelsWorkload += std::pow(0.25f, i) * kBilateralGridWorkload;
+            }
+            return megapixels * levelsWorkload;
+        }
+        case LocalToneMapping: {
+            const int maskScale = demosaicParameters.ltmParameters.maskScale;
+            return megapixels / (maskScale * maskScale);
+        }
+        default:
+            return megapixels;
+    }
+}
+
+void PipelineCostModel::record(Stage stage, float milliseconds, float workload) {
+    if (workload <= 0) {
+        return;
+    }
+    const float cost = milliseconds / workload;
+    msPerWorkload[stage] = msPerWorkload[stage] == 0 ? cost : std::lerp(msPerWorkload[stage], cost, kCostSmoothing);
+}
+
+bool PipelineCostModel::calibrated() const {
+    for (auto stage : {Demosaic, PyramidDenoise, PostProcess}) {
+        if (msPerWorkload[stage] == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float PipelineCostModel::predict(int width, int height, bool highNoise,
+                                 const DemosaicParameters& demosaicParameters) const {
+    const bool despeckle = demosaicParameters.processingParameters.despeckle;
+    const bool ltm = demosaicParameters.rgbConversionParameters.localToneMapping;
+
+    float milliseconds = 0;
+    for (int s = 0; s < kStages; s++) {
+        const auto stage = (Stage)s;
+        if ((stage == RawDespeckle && !(highNoise && despeckle)) || (stage == Despeckle && !despeckle) ||
+            (stage == LocalToneMapping && !ltm)) {
+            continue;
+        }
+        // Stages not measured yet count as free, they get measured the first time they run
+        milliseconds += msPerWorkload[stage] * workload(stage, width, height, demosaicParameters);
+    }
+    return milliseconds;
+}
+
+void PipelineCostModel::plan(float budgetMs, int width, int height, bool highNoise,
+                             DemosaicParameters* demosaicParameters) const {
+    if (!calibrated()) {
+        LOG_INFO(TAG) << "PipelineCostModel - not calibrated yet, keeping the current processing parameters"
+                      << std::endl;
+        return;
+    }
+
+    const bool ltm = demosaicParameters->rgbConversionParameters.localToneMapping;
+    const std::array<int, 3> maskScales = {1, 2, 4};
+
+    DemosaicParameters candidate = *demosaicParameters;
+    DemosaicParameters best = *demosaicParameters;
+    float bestQuality = -1, bestTime = 0;
+    DemosaicParameters cheapest = *demosaicParameters;
+    float cheapestTime = std::numeric_limits<float>::max();
+
+    for (int levels = 1; levels <= 5; levels++) {
+        for (int radius : {2, 4}) {
+            for (bool despeckle : {false, true}) {
+                for (int maskScale : ltm ? maskScales : std::array<int, 3>{candidate.ltmParameters.maskScale}) {
+                    if (maskScale == 0) {
+                        continue;
+                    }
+                    // The kernel choices and the bilateral grid are the caller's, only their cost is predicted
+                    candidate.processingParameters.pyramidLevels = levels;
+                    candidate.processingParameters.maxDenoiseRadius = radius;
+                    candidate.processingParameters.despeckle = despeckle;
+                    candidate.ltmParameters.maskScale = maskScale;
+
+                    const float time = predict(width, height, highNoise, candidate);
+
+                    // Denoising depth dominates the perceived quality, the mask resolution matters least
+                    const float quality = 8 * levels + 4 * despeckle + 2 * (radius == 4) - std::log2(maskScale);
+
+                    if (time <= budgetMs && (quality > bestQuality || (quality == bestQuality && time < bestTime))) {
+                        best = candidate;
+                        bestQuality = quality;
+                        bestTime = time;
+                    }
+                    if (time < cheapestTime) {
+                        cheapest = candidate;
+                        cheapestTime = time;
+                    }
+                }
+            }
+        }
+    }
+
+    const auto& selected = bestQuality >= 0 ? best : cheapest;
+    demosaicParameters->processingParameters.pyramidLevels = selected.processingParameters.pyramidLevels;
+    demosaicParameters->processingParameters.maxDenoiseRadius = selected.processingParameters.maxDenoiseRadius;
+    demosaicParameters->processingParameters.despeckle = selected.processingParameters.despeckle;
+    demosaicParameters->ltmParameters.maskScale = selected.ltmParameters.maskScale;
+
+    const auto& p = selected.processingParameters;
+    LOG_INFO(TAG) << "PipelineCostModel - budget " << budgetMs << "ms, predicted "
+                  << (int)predict(width, height, highNoise, selected) << "ms with " << p.pyramidLevels
+                  << " pyramid levels, denoise radius " << p.maxDenoiseRadius << ", despeckle " << p.despeckle
+                  << ", LTM mask scale " << selected.ltmParameters.maskScale << std::endl;
+}
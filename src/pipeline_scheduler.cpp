@@ -0,0 +1,170 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pipeline_scheduler.hpp"
+
+#include <cmath>
+
+#include "gls_logging.h"
+
+static const char* TAG = "DEMOSAIC";
+
+// Weight of the last measurement in the throughput estimate
+static const constexpr double kThroughputSmoothing = 0.3;
+
+// Rescheduling interval for workers waiting on a faster device whose job is overdue
+static const constexpr auto kRescheduleInterval = std::chrono::milliseconds(10);
+
+PipelineScheduler::PipelineScheduler(const std::vector<gls::OpenCLContext*>& glsContexts) {
+    for (auto glsContext : glsContexts) {
+        auto worker = std::make_unique<Worker>();
+        worker->index = (int)workers.size();
+        worker->glsContext = glsContext;
+        worker->rawConverter = std::make_unique<RawConverter>(glsContext);
+        worker->deviceName = glsContext->clContext().getInfo<CL_CONTEXT_DEVICES>()[0].getInfo<CL_DEVICE_NAME>();
+        workers.push_back(std::move(worker));
+    }
+    for (auto& worker : workers) {
+        worker->thread = std::thread([this, worker = worker.get()]() { run(worker); });
+    }
+}
+
+PipelineScheduler::~PipelineScheduler() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+    logStatistics();
+}
+
+/*static*/ std::vector<cl::Device> PipelineScheduler::devices() {
+    std::vector<cl::Platform> platforms;
+    cl::Platform::get(&platforms);
+
+    std::vector<cl::Device> allDevices;
+    for (const auto& platform : platforms) {
+        std::vector<cl::Device> platformDevices;
+        platform.getDevices(CL_DEVICE_TYPE_ALL, &platformDevices);
+        allDevices.insert(allDevices.end(), platformDevices.begin(), platformDevices.end());
+    }
+    return allDevices;
+}
+
+void PipelineScheduler::enqueueJob(Job&& job) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    condition.notify_all();
+}
+
+void PipelineScheduler::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idleCondition.wait(lock, [this] { return jobs.empty() && runningJobs == 0; });
+}
+
+PipelineScheduler::clock::time_point PipelineScheduler::expectedCompletion(const Worker& worker, size_t pixels,
+                                                                           clock::time_point now) const {
+    const auto start = worker.busy ? std::max(now, worker.busyUntil) : now;
+    return start + std::chrono::duration_cast<clock::duration>(
+                       std::chrono::duration<double, std::milli>(pixels / worker.throughput));
+}
+
+bool PipelineScheduler::shouldTake(const Worker& worker) const {
+    // Devices without measurements take work eagerly, the first job calibrates them
+    if (worker.throughput == 0) {
+        return true;
+    }
+
+    // List schedule the queue over the measured workers, each job to the earliest completion
+    const auto now = clock::now();
+    std::vector<clock::time_point> available(workers.size());
+    for (const auto& other : workers) {
+        available[other->index] = other->busy ? std::max(now, other->busyUntil) : now;
+    }
+    for (const auto& job : jobs) {
+        const Worker* best = nullptr;
+        clock::time_point bestCompletion;
+        for (const auto& other : workers) {
+            if (other->throughput == 0) {
+                continue;
+            }
+            const auto duration = std::chrono::duration<double, std::milli>(job.pixels / other->throughput);
+            const auto completion = available[other->index] + std::chrono::duration_cast<clock::duration>(duration);
+            // Ties go to the first worker
+            if (!best || completion < bestCompletion) {
+                best = other.get();
+                bestCompletion = completion;
+            }
+        }
+        if (best->index == worker.index) {
+            return true;
+        }
+        available[best->index] = bestCompletion;
+    }
+    return false;
+}
+
+void PipelineScheduler::run(Worker* worker) {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!(stop && jobs.empty()) && !(!jobs.empty() && shouldTake(*worker))) {
+                condition.wait_for(lock, kRescheduleInterval);
+            }
+            if (jobs.empty()) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+
+            worker->busy = true;
+            if (worker->throughput > 0) {
+                worker->busyUntil = expectedCompletion(*worker, job.pixels, clock::now());
+            }
+            runningJobs++;
+        }
+
+        const auto t_start = clock::now();
+        job.task(worker->rawConverter.get());
+        const double elapsed_time_ms = std::chrono::duration<double, std::milli>(clock::now() - t_start).count();
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            const double throughput = job.pixels / std::max(elapsed_time_ms, 1.0);
+            worker->throughput = worker->throughput == 0 ? throughput
+                                                         : std::lerp(worker->throughput, throughput,
+                                                                     kThroughputSmoothing);
+            worker->busy = false;
+            worker->completedJobs++;
+            runningJobs--;
+        }
+        condition.notify_all();
+        idleCondition.notify_all();
+    }
+}
+
+void PipelineScheduler::logStatistics() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (const auto& worker : workers) {
+        LOG_INFO(TAG) << "PipelineScheduler - " << worker->deviceName << ": " << worker->completedJobs
+                      << " jobs, throughput: " << (int)(worker->throughput / 1000) << " MPixel/s" << std::endl;
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2021-2022 Glass Imaging Inc.
+// Author: Fabio Riccardi <fabio@glass-imaging.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "priority_scheduler.hpp"
+
+#include "gls_logging.h"
+
+static const char* TAG = "DEMOSAIC";
+
+PriorityScheduler::PriorityScheduler(gls::OpenCLContext* glsContext) {
+    for (int jobClass = 0; jobClass < kJobClasses; jobClass++) {
+        auto& lane = lanes[jobClass];
+        lane.rawConverter = std::make_unique<RawConverter>(glsContext);
+        if (jobClass > 0) {
+            lane.rawConverter->setStageBoundaryHook([this, jobClass]() { yield(jobClass); });
+        }
+    }
+    for (int jobClass = 0; jobClass < kJobClasses; jobClass++) {
+        lanes[jobClass].thread = std::thread([this, jobClass]() { run(jobClass); });
+    }
+}
+
+PriorityScheduler::~PriorityScheduler() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& lane : lanes) {
+        lane.thread.join();
+    }
+}
+
+void PriorityScheduler::enqueueJob(JobClass jobClass, std::function<void(RawConverter*)>&& job) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        lanes[jobClass].jobs.push_back(std::move(job));
+        lanes[jobClass].pendingJobs++;
+    }
+    condition.notify_all();
+}
+
+void PriorityScheduler::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this]() {
+        for (const auto& lane : lanes) {
+            if (lane.pendingJobs > 0) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+bool PriorityScheduler::higherPriorityPending(int jobClass) const {
+    for (int i = 0; i < jobClass; i++) {
+        if (lanes[i].pendingJobs > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Stage boundary of a lower priority job: hold back until the higher priority classes drain. The converter's queue
+// is already finished, nothing of this job runs on the device while it waits.
+void PriorityScheduler::yield(int jobClass) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (higherPriorityPending(jobClass)) {
+        LOG_INFO(TAG) << "PriorityScheduler - class " << jobClass << " yielding at stage boundary" << std::endl;
+        condition.wait(lock, [this, jobClass]() { return !higherPriorityPending(jobClass); });
+    }
+}
+
+void PriorityScheduler::run(int jobClass) {
+    auto& lane = lanes[jobClass];
+    for (;;) {
+        std::function<void(RawConverter*)> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            // Don't start new work while higher priority jobs are pending either
+            condition.wait(lock, [this, &lane, jobClass]() {
+                return (stop && lane.jobs.empty()) || (!lane.jobs.empty() && !higherPriorityPending(jobClass));
+            });
+            if (lane.jobs.empty()) {
+                return;
+            }
+            job = std::move(lane.jobs.front());
+            lane.jobs.pop_front();
+        }
+
+        job(lane.rawConverter.get());
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            lane.pendingJobs--;
+        }
+        condition.notify_all();
+    }
+}
@@ -13,24 +13,36 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
+#include "command_queue.hpp"
 #include "gls_logging.h"
 #include "pyramid_processor.hpp"
 
 static const char* TAG = "DEMOSAIC";
 
 template <size_t levels>
-PyramidProcessor<levels>::PyramidProcessor(gls::OpenCLContext* glsContext, int _width, int _height)
+PyramidProcessor<levels>::PyramidProcessor(gls::OpenCLContext* glsContext, int _width, int _height,
+                                           TexturePlanner* texturePlanner)
     : width(_width), height(_height), fusedFrames(0) {
-    for (int i = 0, scale = 2; i < levels - 1; i++, scale *= 2) {
-        imagePyramid[i] = std::make_unique<imageType>(glsContext->clContext(), width / scale, height / scale);
-        gradientPyramid[i] = std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(
-            glsContext->clContext(), width / scale, height / scale);
+    allocateTextures(glsContext, texturePlanner);
+}
+
+template <size_t levels>
+void PyramidProcessor<levels>::allocateTextures(gls::OpenCLContext* glsContext, TexturePlanner* texturePlanner) {
+    for (int i = 0; i < levels - 1; i++) {
+        imagePyramid[i] =
+            texturePlanner->texture<gls::rgba_pixel_float>(glsContext, TexturePlanner::name("imagePyramid", i));
+        gradientPyramid[i] = texturePlanner->texture<gls::luma_alpha_pixel_float>(
+            glsContext, TexturePlanner::name("gradientPyramid", i));
     }
-    for (int i = 0, scale = 1; i < levels; i++, scale *= 2) {
-        denoisedImagePyramid[i] = std::make_unique<imageType>(glsContext->clContext(), width / scale, height / scale);
-        subtractedImagePyramid[i] = std::make_unique<imageType>(glsContext->clContext(), width / scale, height / scale);
+    for (int i = 0; i < levels; i++) {
+        denoisedImagePyramid[i] = texturePlanner->texture<gls::rgba_pixel_float>(
+            glsContext, TexturePlanner::name("denoisedImagePyramid", i));
+        subtractedImagePyramid[i] = texturePlanner->texture<gls::rgba_pixel_float>(
+            glsContext, TexturePlanner::name("subtractedImagePyramid", i));
     }
 }
 
@@ -65,23 +77,58 @@ void dumpGradientImage(const gls::cl_image_2d<gls::luma_alpha_pixel_float>& imag
 // TODO: Make this a tunable
 static const constexpr float lumaDenoiseWeight[4] = {1, 1, 1, 1};
 
+// Noise below a 10 bit code value of the sRGB output is not visible
+static const constexpr float kVisibleNoiseSigma = 1.0 / 1024;
+
+// Output linear level of the shadows, where the sRGB gamma amplifies the noise of the skipped levels the most
+static const constexpr float kShadowLevel = 0.05;
+
+// Slope of the sRGB transfer function at a linear value above its linear segment
+static float sRGBSlope(float x) { return 1.055f / 2.4f * std::pow(x, 1.0f / 2.4f - 1.0f); }
+
+// The denoiser's threshold on a level is its noise sigma scaled by the level's multipliers. The sigma is taken at the
+// input level that exposure_multiplier maps to the shadows and referred to the output through the exposure and the
+// sRGB slope there. When it stays below visibility in all channels denoiseImage can't change the level noticeably.
+static bool noiseIsVisible(const YCbCrNLF& nlf, const gls::Vector<3>& thresholdMultipliers, float exposure_multiplier) {
+    const float inputLevel = kShadowLevel / exposure_multiplier;
+    const float outputGain = exposure_multiplier * sRGBSlope(kShadowLevel);
+    for (int c = 0; c < 3; c++) {
+        const float sigma = outputGain * std::sqrt(nlf.first[c] + nlf.second[c] * inputLevel);
+        if (thresholdMultipliers[c] * sigma > kVisibleNoiseSigma) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <size_t levels>
 typename PyramidProcessor<levels>::imageType* PyramidProcessor<levels>::denoise(
     gls::OpenCLContext* glsContext, std::array<DenoiseParameters, levels>* denoiseParameters, const imageType& image,
     const gls::cl_image_2d<gls::luma_alpha_pixel_float>& gradientImage, std::array<YCbCrNLF, levels>* nlfParameters,
-    float exposure_multiplier, bool calibrateFromImage) {
+    float exposure_multiplier, bool calibrateFromImage, const ProcessingParameters& processingParameters) {
     std::array<gls::Vector<3>, levels> thresholdMultipliers;
 
-    // Create gaussian image pyramid an setup noise model
-    for (int i = 0; i < levels; i++) {
+    // Create gaussian image pyramid, two levels at a time when they halve the size exactly
+    for (int i = 0; i < levels - 1;) {
         const auto currentLayer = i > 0 ? imagePyramid[i - 1].get() : &image;
         const auto currentGradientLayer = i > 0 ? gradientPyramid[i - 1].get() : &gradientImage;
 
-        if (i < levels - 1) {
-            // Generate next layer in the pyramid
+        if (i < levels - 2 && currentLayer->width == 4 * imagePyramid[i + 1]->width &&
+            currentLayer->height == 4 * imagePyramid[i + 1]->height) {
+            downsampleImagePyramid2(glsContext, *currentLayer, *currentGradientLayer, imagePyramid[i].get(),
+                                    gradientPyramid[i].get(), imagePyramid[i + 1].get(), gradientPyramid[i + 1].get());
+            i += 2;
+        } else {
             resampleImage(glsContext, "downsampleImageXYZ", *currentLayer, imagePyramid[i].get());
             resampleImage(glsContext, "downsampleImageXY", *currentGradientLayer, gradientPyramid[i].get());
+            i += 1;
         }
+    }
+
+    // Setup noise model
+    for (int i = 0; i < levels; i++) {
+        const auto currentLayer = i > 0 ? imagePyramid[i - 1].get() : &image;
+        const auto currentGradientLayer = i > 0 ? gradientPyramid[i - 1].get() : &gradientImage;
 
         if (calibrateFromImage) {
             (*nlfParameters)[i] =
@@ -91,31 +138,103 @@ typename PyramidProcessor<levels>::imageType* PyramidProcessor<levels>::denoise(
         thresholdMultipliers[i] = nflMultiplier((*denoiseParameters)[i]);
     }
 
+    // Decide which levels to denoise, trailing levels with invisible noise are passed through like the inactive ones
+    std::array<bool, levels> denoiseLevel;
+    for (int i = 0; i < levels; i++) {
+        denoiseLevel[i] =
+            !processingParameters.adaptiveLevels ||
+            noiseIsVisible((*nlfParameters)[i], thresholdMultipliers[i], exposure_multiplier);
+    }
+    int activeLevels = std::clamp(processingParameters.pyramidLevels, 1, (int)levels);
+    while (activeLevels > 1 && !denoiseLevel[activeLevels - 1]) {
+        activeLevels--;
+    }
+    if (processingParameters.adaptiveLevels) {
+        int denoisedLevels = 0;
+        for (int i = 0; i < activeLevels; i++) {
+            denoisedLevels += denoiseLevel[i];
+        }
+        LOG_INFO(TAG) << "PyramidProcessor - denoising " << denoisedLevels << " of " << activeLevels
+                      << " active pyramid levels" << std::endl;
+    }
+
+    // Levels past the active ones are passed through undenoised, the LTM mask still reads them
+    auto commandQueue = currentCommandQueue();
+    for (int i = activeLevels; i < levels; i++) {
+        commandQueue.enqueueCopyImage(imagePyramid[i - 1]->getImage2D(), denoisedImagePyramid[i]->getImage2D(),
+                                      {0, 0, 0}, {0, 0, 0},
+                                      {(size_t)imagePyramid[i - 1]->width, (size_t)imagePyramid[i - 1]->height, 1});
+    }
+    // Passed through levels are delivered like the denoised ones, from the coarsest one
+    if (levelDenoised) {
+        for (int i = levels - 1; i >= activeLevels; i--) {
+            levelDenoised(i);
+        }
+    }
+
+    if (processingParameters.bilateralGridLevels > 0 && bilateralGrid[0] == nullptr) {
+        LOG_INFO(TAG) << "Allocating bilateralGrid" << std::endl;
+        const auto gridSize = bilateralGridImageSize(width, height);
+        for (auto& grid : bilateralGrid) {
+            grid = std::make_unique<imageType>(glsContext->clContext(), gridSize.width, gridSize.height);
+        }
+    }
+
     // Denoise pyramid layers from the bottom to the top, subtracting the noise of the previous layer from the next
-    for (int i = levels - 1; i >= 0; i--) {
+    for (int i = activeLevels - 1; i >= 0; i--) {
         const auto denoiseInput = i > 0 ? imagePyramid[i - 1].get() : &image;
         const auto gradientInput = i > 0 ? gradientPyramid[i - 1].get() : &gradientImage;
 
-        if (i < levels - 1) {
+        // With the bilateral grid the subtracted and denoised levels swap roles, the grid writes the denoised level
+        const bool gridChroma = denoiseLevel[i] && i < processingParameters.bilateralGridLevels;
+        const auto subtracted =
+            denoiseLevel[i] && !gridChroma ? subtractedImagePyramid[i].get() : denoisedImagePyramid[i].get();
+        const auto denoised = gridChroma ? subtractedImagePyramid[i].get() : denoisedImagePyramid[i].get();
+
+        if (i < activeLevels - 1) {
             // Subtract the previous layer's noise from the current one
             // LOG_INFO(TAG) << "Reassembling layer " << i + 1 << " with sharpening: " <<
             // (*denoiseParameters)[i].sharpening << std::endl;
 
             const auto np = YCbCrNLF{(*nlfParameters)[i].first * thresholdMultipliers[i],
                                      (*nlfParameters)[i].second * thresholdMultipliers[i]};
+            // Levels that are not denoised are just reconstructed
             subtractNoiseImage(glsContext, *denoiseInput, *(imagePyramid[i]), *(denoisedImagePyramid[i + 1]),
                                *gradientInput, lumaDenoiseWeight[i], (*denoiseParameters)[i].sharpening,
-                               {np.first[0], np.second[0]}, subtractedImagePyramid[i].get());
+                               {np.first[0], np.second[0]}, subtracted);
+        } else if (!denoiseLevel[i]) {
+            // Only the full resolution level of a noiseless image gets here
+            commandQueue.enqueueCopyImage(denoiseInput->getImage2D(), denoisedImagePyramid[i]->getImage2D(),
+                                          {0, 0, 0}, {0, 0, 0},
+                                          {(size_t)denoiseInput->width, (size_t)denoiseInput->height, 1});
         }
 
         // LOG_INFO(TAG) << "Denoising image level " << i << " with multipliers " << thresholdMultipliers[i] <<
         // std::endl;
 
         // Denoise current layer
-        denoiseImage(glsContext, i < levels - 1 ? *(subtractedImagePyramid[i]) : *denoiseInput, *gradientInput,
-                     (*nlfParameters)[i].first, (*nlfParameters)[i].second, thresholdMultipliers[i],
-                     (*denoiseParameters)[i].chromaBoost, (*denoiseParameters)[i].gradientBoost,
-                     (*denoiseParameters)[i].gradientThreshold, denoisedImagePyramid[i].get());
+        if (denoiseLevel[i]) {
+            denoiseImage(glsContext, i < activeLevels - 1 ? *subtracted : *denoiseInput, *gradientInput,
+                         (*nlfParameters)[i].first, (*nlfParameters)[i].second, thresholdMultipliers[i],
+                         (*denoiseParameters)[i].chromaBoost, (*denoiseParameters)[i].gradientBoost,
+                         (*denoiseParameters)[i].gradientThreshold, denoised, processingParameters.maxDenoiseRadius);
+        }
+
+        // Large support chroma denoising, for the low frequency chroma noise of high ISO images
+        if (gridChroma) {
+            // Chroma noise of the level at denoiseImage's chroma threshold: chromaBoost times the scaled sigma
+            const auto& nlf = (*nlfParameters)[i];
+            const float chromaScale = (*denoiseParameters)[i].chromaBoost * thresholdMultipliers[i][1];
+            const gls::Vector<2> chromaNlf = {chromaScale * chromaScale * (nlf.first[1] + nlf.first[2]) / 2,
+                                              chromaScale * chromaScale * (nlf.second[1] + nlf.second[2]) / 2};
+
+            bilateralGridChromaDenoise(glsContext, *denoised, bilateralGrid[0].get(), bilateralGrid[1].get(),
+                                       chromaNlf, denoisedImagePyramid[i].get());
+        }
+
+        if (levelDenoised) {
+            levelDenoised(i);
+        }
     }
 
     return denoisedImagePyramid[0].get();
@@ -152,6 +271,8 @@ void PyramidProcessor<levels>::fuseFrame(gls::OpenCLContext* glsContext,
     auto& newFusedImagePyramid = *fusionBuffer[(fusedFrames & 1) == 0];
     auto& previousFusedImagePyramid = *fusionBuffer[(fusedFrames & 1) == 1];
 
+    auto commandQueue = currentCommandQueue();
+
     // Create gaussian image pyramid
     for (int i = 0; i < levels; i++) {
         const auto currentLayer =
@@ -159,15 +280,17 @@ void PyramidProcessor<levels>::fuseFrame(gls::OpenCLContext* glsContext,
         const auto currentGradientLayer = i > 0 ? gradientPyramid[i - 1].get() : &gradientImage;
 
         if (fusedFrames == 0 && i == 0) {
-            cl::enqueueCopyImage(currentLayer->getImage2D(), newFusedImagePyramid[i]->getImage2D(), {0, 0, 0},
-                                 {0, 0, 0}, {(size_t)currentLayer->width, (size_t)currentLayer->height, 1});
+            commandQueue.enqueueCopyImage(currentLayer->getImage2D(), newFusedImagePyramid[i]->getImage2D(),
+                                          {0, 0, 0}, {0, 0, 0},
+                                          {(size_t)currentLayer->width, (size_t)currentLayer->height, 1});
 
-            cl::enqueueCopyImage(currentLayer->getImage2D(), fusionReferenceImagePyramid[i]->getImage2D(), {0, 0, 0},
-                                 {0, 0, 0}, {(size_t)currentLayer->width, (size_t)currentLayer->height, 1});
+            commandQueue.enqueueCopyImage(currentLayer->getImage2D(), fusionReferenceImagePyramid[i]->getImage2D(),
+                                          {0, 0, 0}, {0, 0, 0},
+                                          {(size_t)currentLayer->width, (size_t)currentLayer->height, 1});
 
-            cl::enqueueCopyImage(currentGradientLayer->getImage2D(), fusionReferenceGradientPyramid[i]->getImage2D(),
-                                 {0, 0, 0}, {0, 0, 0},
-                                 {(size_t)currentGradientLayer->width, (size_t)currentGradientLayer->height, 1});
+            commandQueue.enqueueCopyImage(
+                currentGradientLayer->getImage2D(), fusionReferenceGradientPyramid[i]->getImage2D(), {0, 0, 0},
+                {0, 0, 0}, {(size_t)currentGradientLayer->width, (size_t)currentGradientLayer->height, 1});
         }
 
         if (i < levels - 1) {
@@ -179,7 +302,7 @@ void PyramidProcessor<levels>::fuseFrame(gls::OpenCLContext* glsContext,
                 resampleImage(glsContext, "downsampleImageXY", *fusionReferenceGradientPyramid[i],
                               fusionReferenceGradientPyramid[i + 1].get());
 
-                cl::enqueueCopyImage(
+                commandQueue.enqueueCopyImage(
                     newFusedImagePyramid[i + 1]->getImage2D(), fusionReferenceImagePyramid[i + 1]->getImage2D(),
                     {0, 0, 0}, {0, 0, 0},
                     {(size_t)newFusedImagePyramid[i + 1]->width, (size_t)newFusedImagePyramid[i + 1]->height, 1});
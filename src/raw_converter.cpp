@@ -18,53 +18,236 @@
 
 #include "demosaic.hpp"
 #include "gls_logging.h"
+#include "pipeline_assets.hpp"
 #include "raw_converter.hpp"
 
 static const char* TAG = "DEMOSAIC";
 
 #define PRINT_EXECUTION_TIME true
 
-void RawConverter::allocateTextures(gls::OpenCLContext* glsContext, int width, int height) {
-    auto clContext = glsContext->clContext();
+/*static*/ void RawConverter::describePipeline(TexturePlanner* texturePlanner, int width, int height, bool highNoise,
+                                               const LTMParameters* ltmParameters, bool fusion, bool incremental) {
+    // demosaic()
+    texturePlanner->addStage("uploadRawImage");
+    texturePlanner->addStage("rawImageSobel");
+    if (highNoise) {
+        texturePlanner->addStage("despeckleRawImage");
+    }
+    texturePlanner->addStage("gaussianBlurSobelImage");
+    texturePlanner->addStage("interpolateGreen");
+    texturePlanner->addStage("interpolateRedBlue");
+    // fuseFrame()
+    if (fusion) {
+        texturePlanner->addStage("fuseFrame");
+    }
+    // denoise()
+    texturePlanner->addStage("despeckleImage");
+    texturePlanner->addStage("pyramidDenoise");
+    if (ltmParameters) {
+        texturePlanner->addStage("localToneMappingMask");
+    }
+    texturePlanner->addStage("blueNoiseImage");
+    // postProcess()
+    texturePlanner->addStage("convertTosRGB");
+
+    // Textures handed from one API call to the next are persistent, the caller decides what runs in between
+    texturePlanner->addPersistentTexture<gls::luma_alpha_pixel_float>("clRawGradientImage", width, height);
+    texturePlanner->addPersistentTexture<gls::rgba_pixel_float>("clLinearRGBImageA", width, height);
+    texturePlanner->addPersistentTexture<gls::rgba_pixel_float>("clLinearRGBImageB", width, height);
+    texturePlanner->addPersistentTexture<gls::rgba_pixel_float>("clsRGBImage", width, height);
+    if (incremental) {
+        texturePlanner->addPersistentTexture<gls::rgba_pixel_float>("clYCbCrImage", width, height);
+    }
+
+    texturePlanner->addTexture<gls::luma_pixel_16>("clRawImage", width, height, "uploadRawImage", "uploadRawImage");
+    texturePlanner->addTexture<gls::luma_pixel_float>("clScaledRawImage", width, height, "uploadRawImage",
+                                                      "interpolateRedBlue");
+    texturePlanner->addTexture<gls::rgba_pixel_float>("clRawSobelImage", width, height, "rawImageSobel",
+                                                      "gaussianBlurSobelImage");
+    if (highNoise) {
+        texturePlanner->addTexture<gls::luma_pixel_float>("clDespeckledRawImage", width, height, "despeckleRawImage",
+                                                          "interpolateRedBlue");
+    }
+    texturePlanner->addTexture<gls::luma_pixel_float>("clGreenImage", width, height, "interpolateGreen",
+                                                      "interpolateRedBlue");
+
+    // PyramidProcessor, the LTM mask is computed from the denoised pyramid and upsampled with one of its levels
+    const auto pyramidStage = fusion ? "fuseFrame" : "pyramidDenoise";
+    const int maskLevel = ltmParameters ? LocalToneMapping::maskLevel(*ltmParameters) : 0;
+    for (int i = 0, scale = 1; i < 5; i++, scale *= 2) {
+        if (i < 4) {
+            texturePlanner->addTexture<gls::rgba_pixel_float>(TexturePlanner::name("imagePyramid", i),
+                                                              width / (2 * scale), height / (2 * scale),
+                                                              pyramidStage, "pyramidDenoise");
+            texturePlanner->addTexture<gls::luma_alpha_pixel_float>(TexturePlanner::name("gradientPyramid", i),
+                                                                    width / (2 * scale), height / (2 * scale),
+                                                                    pyramidStage, "pyramidDenoise");
+        }
+        texturePlanner->addTexture<gls::rgba_pixel_float>(TexturePlanner::name("subtractedImagePyramid", i),
+                                                          width / scale, height / scale, pyramidStage,
+                                                          "pyramidDenoise");
+
+        const auto denoisedName = TexturePlanner::name("denoisedImagePyramid", i);
+        const bool ltmGuideLevel = i == 4 || i == std::max(maskLevel, 2) || i == maskLevel;
+        if (ltmParameters && ((i > 0 && i == maskLevel) || (incremental && ltmGuideLevel))) {
+            texturePlanner->addPersistentTexture<gls::rgba_pixel_float>(denoisedName, width / scale, height / scale);
+        } else {
+            // Without blue noise level 0 is the denoised result, read by postProcess()
+            const auto lastStage =
+                i == 0 ? "convertTosRGB" : ltmParameters ? "localToneMappingMask" : "pyramidDenoise";
+            texturePlanner->addTexture<gls::rgba_pixel_float>(denoisedName, width / scale, height / scale,
+                                                              "pyramidDenoise", lastStage);
+        }
 
-    if (!clRawImage || clRawImage->width != width || clRawImage->height != height) {
-        clRawImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_16>>(clContext, width, height);
-        clScaledRawImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, width, height);
-        clRawSobelImage = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width, height);
-        clRawGradientImage = std::make_unique<gls::cl_image_2d<gls::luma_alpha_pixel_float>>(clContext, width, height);
-        clGreenImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, width, height);
-        clLinearRGBImageA = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width, height);
-        clLinearRGBImageB = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width, height);
-        clsRGBImage = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width, height);
+        if (fusion) {
+            texturePlanner->addPersistentTexture<gls::rgba_pixel_float>(
+                TexturePlanner::name("fusionImagePyramidA", i), width / scale, height / scale);
+            texturePlanner->addPersistentTexture<gls::rgba_pixel_float>(
+                TexturePlanner::name("fusionImagePyramidB", i), width / scale, height / scale);
+            texturePlanner->addPersistentTexture<gls::rgba_pixel_float>(
+                TexturePlanner::name("fusionReferenceImagePyramid", i), width / scale, height / scale);
+            texturePlanner->addPersistentTexture<gls::luma_alpha_pixel_float>(
+                TexturePlanner::name("fusionReferenceGradientPyramid", i), width / scale, height / scale);
+        }
+    }
 
-        pyramidProcessor = std::make_unique<PyramidProcessor<5>>(glsContext, width, height);
+    // LocalToneMapping
+    if (ltmParameters) {
+        const int maskWidth = width >> maskLevel;
+        const int maskHeight = height >> maskLevel;
+        const auto ltmStage = "localToneMappingMask";
+
+        texturePlanner->addPersistentTexture<gls::luma_pixel_float>("ltmMaskImage", maskWidth, maskHeight);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("lfAbGfImage", width / 16, height / 16, ltmStage,
+                                                                ltmStage);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("lfAbGfMeanImage", width / 16, height / 16,
+                                                                ltmStage, ltmStage);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("mfAbGfImage", width / 4, height / 4, ltmStage,
+                                                                ltmStage);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("mfAbGfMeanImage", width / 4, height / 4, ltmStage,
+                                                                ltmStage);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("hfAbGfImage", maskWidth, maskHeight, ltmStage,
+                                                                ltmStage);
+        texturePlanner->addTexture<gls::luma_alpha_pixel_float>("hfAbGfMeanImage", maskWidth, maskHeight, ltmStage,
+                                                                ltmStage);
+        if (ltmParameters->guidedFilterRadius != 2) {
+            texturePlanner->addTexture<gls::rgba_pixel_float>("rowSumImage", maskWidth + 1, maskHeight + 1, ltmStage,
+                                                              ltmStage);
+            texturePlanner->addTexture<gls::rgba_pixel_float>("sumImage", maskWidth + 1, maskHeight + 1, ltmStage,
+                                                              ltmStage);
+        }
+    }
+}
 
-        const auto blueNoise = gls::image<gls::luma_pixel_16>::read_png_file("Assets/HDR_L_0b.png");
-        clBlueNoise = std::make_unique<gls::cl_image_2d<gls::luma_pixel_16>>(_glsContext->clContext(), *blueNoise);
+/*static*/ void RawConverter::logTextureMemory(int width, int height, const LTMParameters& ltmParameters) {
+    const std::array<std::string, 4> modes = {"normal", "high noise", "LTM", "fusion"};
+    for (size_t mode = 0; mode < modes.size(); mode++) {
+        TexturePlanner texturePlanner;
+        describePipeline(&texturePlanner, width, height, /*highNoise=*/mode == 1,
+                         /*ltmParameters=*/mode == 2 ? &ltmParameters : nullptr, /*fusion=*/mode == 3);
+        texturePlanner.plan();
+
+        const float MB = 1024 * 1024;
+        LOG_INFO(TAG) << "Texture memory (" << modes[mode] << "): unaliased "
+                      << (int)(texturePlanner.unaliasedSize() / MB) << "MB, theoretical peak "
+                      << (int)(texturePlanner.theoreticalPeak() / MB) << "MB, achieved peak "
+                      << (int)(texturePlanner.achievedPeak() / MB) << "MB" << std::endl;
     }
 }
 
-void RawConverter::allocateHighNoiseTextures(gls::OpenCLContext* glsContext, int width, int height) {
-    auto clContext = glsContext->clContext();
+void RawConverter::allocateTextures(gls::OpenCLContext* glsContext, int width, int height,
+                                    const DemosaicParameters& demosaicParameters) {
+    const bool localToneMapping = demosaicParameters.rgbConversionParameters.localToneMapping;
+    const auto& ltmParameters = demosaicParameters.ltmParameters;
+    const std::array<int, 6> planKey = {width, height, localToneMapping,
+                                        localToneMapping ? LocalToneMapping::maskLevel(ltmParameters) : 0,
+                                        localToneMapping && ltmParameters.guidedFilterRadius != 2,
+                                        incrementalRendering};
+
+    // The resident result is about to be overwritten
+    renderedParameters.reset();
+
+    if (planKey != texturePlanKey) {
+        // The high noise textures are always planned, they alias the denoising pyramid
+        texturePlanner = TexturePlanner(texturePool);
+        describePipeline(&texturePlanner, width, height, /*highNoise=*/true,
+                         localToneMapping ? &ltmParameters : nullptr, /*fusion=*/false, incrementalRendering);
+        texturePlanner.plan();
+        texturePlanKey = planKey;
+
+#if DEBUG_TEXTURE_PLANNER
+        // Plans four more pipelines, only for tuning describePipeline()
+        logTextureMemory(width, height, ltmParameters);
+#endif
+
+        if (!pyramidProcessor || pyramidProcessor->width != width || pyramidProcessor->height != height) {
+            pyramidProcessor = std::make_unique<PyramidProcessor<5>>(glsContext, width, height, &texturePlanner);
+            pyramidProcessor->levelDenoised = [this](int level) {
+                if (progressiveCallback && level > 0 && level <= kProgressiveLevels) {
+                    renderProgressiveLevel(level);
+                }
+                if (level > 0) {
+                    stageBoundary();
+                }
+            };
+        } else {
+            // Keep the fusion state
+            pyramidProcessor->allocateTextures(glsContext, &texturePlanner);
+        }
 
-    if (!rgbaRawImage || rgbaRawImage->width != width / 2 || rgbaRawImage->height != height / 2) {
-        rgbaRawImage = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width / 2, height / 2);
-        denoisedRgbaRawImage =
-            std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width / 2, height / 2);
+        if (localToneMapping) {
+            localToneMapping->allocateTextures(glsContext, &texturePlanner, ltmParameters);
+        }
     }
+
+    // Also restores the textures replaced by the fast pipeline
+    clRawImage = texturePlanner.texture<gls::luma_pixel_16>(glsContext, "clRawImage");
+    clScaledRawImage = texturePlanner.texture<gls::luma_pixel_float>(glsContext, "clScaledRawImage");
+    clRawSobelImage = texturePlanner.texture<gls::rgba_pixel_float>(glsContext, "clRawSobelImage");
+    clRawGradientImage = texturePlanner.texture<gls::luma_alpha_pixel_float>(glsContext, "clRawGradientImage");
+    clGreenImage = texturePlanner.texture<gls::luma_pixel_float>(glsContext, "clGreenImage");
+    clLinearRGBImageA = texturePlanner.texture<gls::rgba_pixel_float>(glsContext, "clLinearRGBImageA");
+    clLinearRGBImageB = texturePlanner.texture<gls::rgba_pixel_float>(glsContext, "clLinearRGBImageB");
+    clsRGBImage = texturePlanner.texture<gls::rgba_pixel_float>(glsContext, "clsRGBImage");
+    clYCbCrImage = incrementalRendering ? texturePlanner.texture<gls::rgba_pixel_float>(glsContext, "clYCbCrImage")
+                                        : nullptr;
+    clDespeckledRawImage = texturePlanner.texture<gls::luma_pixel_float>(glsContext, "clDespeckledRawImage");
+
+    clBlueNoise = blueNoiseTexture(glsContext, texturePool.get());
 }
 
 void RawConverter::allocateFastDemosaicTextures(gls::OpenCLContext* glsContext, int width, int height) {
-    auto clContext = glsContext->clContext();
-
     if (!clFastLinearRGBImage || clFastLinearRGBImage->width != width / 2 ||
         clFastLinearRGBImage->height != height / 2) {
-        clRawImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_16>>(clContext, width, height);
-        clScaledRawImage = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, width, height);
-        clFastLinearRGBImage =
-            std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width / 2, height / 2);
-        clsFastRGBImage = std::make_unique<gls::cl_image_2d<gls::rgba_pixel_float>>(clContext, width / 2, height / 2);
+        clRawImage = texturePool->image<gls::luma_pixel_16>(glsContext, width, height);
+        clScaledRawImage = texturePool->image<gls::luma_pixel_float>(glsContext, width, height);
+        clFastLinearRGBImage = texturePool->image<gls::rgba_pixel_float>(glsContext, width / 2, height / 2);
+        clsFastRGBImage = texturePool->image<gls::rgba_pixel_float>(glsContext, width / 2, height / 2);
+    }
+}
+
+void RawConverter::allocateBinnedRawTextures(gls::OpenCLContext* glsContext, int width, int height) {
+    if (!clBinnedGreenImage || clBinnedGreenImage->width != width / 2 || clBinnedGreenImage->height != height / 2) {
+        clBinnedGreenImage = texturePool->image<gls::luma_pixel_float>(glsContext, width / 2, height / 2);
+    }
+    // Replaces the planned half resolution raw textures, restored by allocateTextures
+    clRawImage = texturePool->image<gls::luma_pixel_16>(glsContext, width, height);
+    clScaledRawImage = texturePool->image<gls::luma_pixel_float>(glsContext, width, height);
+}
+
+const gls::cl_image_2d<gls::luma_pixel_float>& RawConverter::toneCurveLut(
+    const RGBConversionParameters& rgbConversionParameters) {
+    const std::array<float, 2> parameters = {rgbConversionParameters.toneCurveSlope, rgbConversionParameters.blacks};
+
+    if (!clToneCurveLut || parameters != toneCurveLutParameters) {
+        if (!clToneCurveLut) {
+            auto clContext = _glsContext->clContext();
+            clToneCurveLut = std::make_unique<gls::cl_image_2d<gls::luma_pixel_float>>(clContext, kToneCurveLutSize, 1);
+        }
+        bakeToneCurveLut(_glsContext, rgbConversionParameters, clToneCurveLut.get());
+        toneCurveLutParameters = parameters;
     }
+    return *clToneCurveLut;
 }
 
 template <typename T>
@@ -117,6 +300,26 @@ std::array<gls::Vector<2>, 3> getRawVariance(const RawNLF& rawNLF) {
     return {redVariance, greenVariance, blueVariance};
 }
 
+// Noise model of the image binned by averaging the Bayer quads: the variance of the two averaged greens halves, each
+// pyramid level of the binned image matches the next level of the full resolution one
+static NoiseModel<5> binnedNoiseModel(const NoiseModel<5>& noiseModel) {
+    NoiseModel<5> result = noiseModel;
+
+    const auto& rawNlf = noiseModel.rawNlf;
+    for (int c : {1, 3}) {
+        result.rawNlf.first[c] = (rawNlf.first[1] + rawNlf.first[3]) / 4;
+        result.rawNlf.second[c] = (rawNlf.second[1] + rawNlf.second[3]) / 4;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        result.pyramidNlf[i] = noiseModel.pyramidNlf[i + 1];
+    }
+    // Downsampling averages four pixels
+    result.pyramidNlf[4] = {noiseModel.pyramidNlf[4].first * 0.25f, noiseModel.pyramidNlf[4].second * 0.25f};
+
+    return result;
+}
+
 template <typename T>
 void dumpGradientImage(const gls::cl_image_2d<T>& image) {
     gls::image<gls::rgb_pixel> out(image.width, image.height);
@@ -142,22 +345,110 @@ void dumpGradientImage(const gls::cl_image_2d<T>& image) {
     out.write_png_file("/Users/fabio/raw_gradient_sgn_5_fine_" + std::to_string(count++) + ".png");
 }
 
-gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::demosaic(const gls::image<gls::luma_pixel_16>& rawImage,
-                                                                DemosaicParameters* demosaicParameters,
-                                                                bool calibrateFromImage) {
-    LOG_INFO(TAG) << "Begin Demosaicing..." << std::endl;
+void RawConverter::uploadRawImage(const gls::image<gls::luma_pixel_16>& rawImage,
+                                  const DemosaicParameters& demosaicParameters) {
+    // Copy input data to the OpenCL input buffer
+    copyPixelsFrom(&commandQueue, rawImage, clRawImage.get());
 
-    allocateTextures(_glsContext, rawImage.width, rawImage.height);
+    scaleRawData(_glsContext, *clRawImage, clScaledRawImage.get(), demosaicParameters.bayerPattern,
+                 demosaicParameters.scale_mul, demosaicParameters.black_level / 0xffff);
+}
 
-    if (demosaicParameters->rgbConversionParameters.localToneMapping) {
-        localToneMapping->allocateTextures(_glsContext, rawImage.width, rawImage.height);
+void RawConverter::uploadRawImage(const DeviceRawImage& rawImage, const DemosaicParameters& demosaicParameters) {
+    // The raw data is already in clRawImage
+    scaleRawData(_glsContext, *clRawImage, clScaledRawImage.get(), demosaicParameters.bayerPattern,
+                 demosaicParameters.scale_mul, demosaicParameters.black_level / 0xffff);
+}
+
+void RawConverter::allocatePackedRawBuffer(size_t size) {
+    if (!clPackedRawBuffer || clPackedRawBuffer->getInfo<CL_MEM_SIZE>() < size) {
+        // Host visible allocation, mapping it is zero-copy on CPU devices and integrated GPUs
+        clPackedRawBuffer = texturePool->buffer(_glsContext, CL_MEM_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, size);
     }
+}
 
-    // Copy input data to the OpenCL input buffer
-    clRawImage->copyPixelsFrom(rawImage);
+void RawConverter::allocateOutputBuffer(size_t size) {
+    if (!clOutputBuffer || clOutputBuffer->getInfo<CL_MEM_SIZE>() < size) {
+        // Host visible allocation, the readback is zero-copy on CPU devices and integrated GPUs
+        clOutputBuffer = texturePool->buffer(_glsContext, CL_MEM_WRITE_ONLY | CL_MEM_ALLOC_HOST_PTR, size);
+    }
+}
+
+std::span<uint8_t> RawConverter::mapPackedRawBuffer(size_t size) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    if (mappedPackedRawData != nullptr) {
+        // Mapped by a previous call whose data never reached the pipeline, e.g. its decoder failed
+        commandQueue.enqueueUnmapMemObject(*clPackedRawBuffer, (void*)mappedPackedRawData);
+        mappedPackedRawData = nullptr;
+    }
+
+    allocatePackedRawBuffer(size);
+    mappedPackedRawData = (uint8_t*)commandQueue.enqueueMapBuffer(*clPackedRawBuffer, true,
+                                                                  CL_MAP_WRITE_INVALIDATE_REGION, 0, size);
+    return std::span<uint8_t>(mappedPackedRawData, size);
+}
+
+void RawConverter::uploadRawImage(const PackedRawImage& rawImage, const DemosaicParameters& demosaicParameters) {
+    assert(rawImage.data.size() >= (size_t)rawImage.rowStride * rawImage.height);
+
+    if (mappedPackedRawData != nullptr) {
+        // Data decoded in place, just hand the buffer back to the device
+        commandQueue.enqueueUnmapMemObject(*clPackedRawBuffer, (void*)mappedPackedRawData);
+        const bool inPlace = rawImage.data.data() == mappedPackedRawData;
+        mappedPackedRawData = nullptr;
+        if (!inPlace) {
+            allocatePackedRawBuffer(rawImage.data.size());
+            commandQueue.enqueueWriteBuffer(*clPackedRawBuffer, CL_TRUE, 0, rawImage.data.size(), rawImage.data.data());
+        }
+    } else {
+        // Upload the packed data as is, unpacking happens on the device
+        allocatePackedRawBuffer(rawImage.data.size());
+        commandQueue.enqueueWriteBuffer(*clPackedRawBuffer, CL_TRUE, 0, rawImage.data.size(), rawImage.data.data());
+    }
+
+    scaleRawData(_glsContext, *clPackedRawBuffer, rawImage, clScaledRawImage.get(), demosaicParameters.bayerPattern,
+                 demosaicParameters.scale_mul, demosaicParameters.black_level / 0xffff);
+}
+
+void RawConverter::markStage(PipelineCostModel::Stage stage) {
+    if (!timingStages) {
+        return;
+    }
+    // Serializes the stages, only in the time budget mode
+    commandQueue.finish();
+    const auto now = std::chrono::high_resolution_clock::now();
+    stageTimes[stage] += std::chrono::duration<float, std::milli>(now - stageStart).count();
+    stageStart = now;
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::blendHighlights(const DemosaicParameters* demosaicParameters,
+                                                                      bool toYCbCr) {
+    if (!toYCbCr) {
+        blendHighlightsImage(_glsContext, *clLinearRGBImageA, /*clip=*/1.0, clLinearRGBImageA.get());
+        return clLinearRGBImageA.get();
+    }
+
+    // Convert linear image to YCbCr for denoising
+    const auto cam_to_ycbcr = cam_ycbcr(demosaicParameters->rgb_cam);
+
+    LOG_INFO(TAG) << "cam_to_ycbcr: " << std::setprecision(4) << std::scientific << cam_to_ycbcr.span() << std::endl;
+
+    // With incremental rendering the YCbCr image stays resident for rerender()
+    const auto ycbcrImage = clYCbCrImage ? clYCbCrImage.get() : clLinearRGBImageA.get();
+    blendHighlightsImage(_glsContext, *clLinearRGBImageA, /*clip=*/1.0, ycbcrImage, cam_to_ycbcr);
+    return ycbcrImage;
+}
 
-    scaleRawData(_glsContext, *clRawImage, clScaledRawImage.get(), demosaicParameters->bayerPattern,
-                 demosaicParameters->scale_mul, demosaicParameters->black_level / 0xffff);
+template <typename RawImage>
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::demosaicImage(const RawImage& rawImage,
+                                                                     DemosaicParameters* demosaicParameters,
+                                                                     bool calibrateFromImage, bool toYCbCr) {
+    LOG_INFO(TAG) << "Begin Demosaicing..." << std::endl;
+
+    allocateTextures(_glsContext, rawImage.width, rawImage.height, *demosaicParameters);
+
+    uploadRawImage(rawImage, *demosaicParameters);
 
     rawImageSobel(_glsContext, *clScaledRawImage, clRawSobelImage.get());
     // dumpGradientImage(*clRawSobelImage);
@@ -178,63 +469,120 @@ gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::demosaic(const gls::image
     LOG_INFO(TAG) << "Green Channel RAW Variance: " << std::scientific << rawVariance[1][1]
                   << ", high_noise_image: " << high_noise_image << std::endl;
 
-    if (high_noise_image) {
-        LOG_INFO(TAG) << "Despeckeling RAW Image" << std::endl;
-
-        allocateHighNoiseTextures(_glsContext, rawImage.width, rawImage.height);
+    markStage(PipelineCostModel::Demosaic);
 
-        bayerToRawRGBA(_glsContext, *clScaledRawImage, rgbaRawImage.get(), demosaicParameters->bayerPattern);
+    // The rest of the demosaicing reads the despeckled mosaic of high noise images
+    const gls::cl_image_2d<gls::luma_pixel_float>* mosaicImage = clScaledRawImage.get();
 
-        despeckleRawRGBAImage(_glsContext, *rgbaRawImage, noiseModel->rawNlf.second, denoisedRgbaRawImage.get());
+    if (high_noise_image && demosaicParameters->processingParameters.despeckle) {
+        LOG_INFO(TAG) << "Despeckeling RAW Image" << std::endl;
 
-        // denoiseRawRGBAImage(_glsContext, *denoisedRgbaRawImage, noiseModel->rawNlf.second, rgbaRawImage.get());
+        despeckleRawImage(_glsContext, *clScaledRawImage, noiseModel->rawNlf.second, demosaicParameters->bayerPattern,
+                          clDespeckledRawImage.get());
+        mosaicImage = clDespeckledRawImage.get();
 
-        rawRGBAToBayer(_glsContext, *denoisedRgbaRawImage, clScaledRawImage.get(), demosaicParameters->bayerPattern);
+        markStage(PipelineCostModel::RawDespeckle);
     }
 
-    gaussianBlurSobelImage(_glsContext, *clScaledRawImage, *clRawSobelImage, rawVariance[1], 1.5, 4.5,
+    gaussianBlurSobelImage(_glsContext, *mosaicImage, *clRawSobelImage, rawVariance[1], 1.5, 4.5,
                            clRawGradientImage.get());
     // dumpGradientImage(*clRawGradientImage);
 
-    //    malvar(_glsContext, *clScaledRawImage, *clRawGradientImage, clLinearRGBImageA.get(),
+    //    malvar(_glsContext, *mosaicImage, *clRawGradientImage, clLinearRGBImageA.get(),
     //    demosaicParameters->bayerPattern,
     //           rawVariance[0], rawVariance[1], rawVariance[2]);
 
-    interpolateGreen(_glsContext, *clScaledRawImage, *clRawGradientImage, clGreenImage.get(),
+    interpolateGreen(_glsContext, *mosaicImage, *clRawGradientImage, clGreenImage.get(),
                      demosaicParameters->bayerPattern, rawVariance[1]);
 
-    interpolateRedBlue(_glsContext, *clScaledRawImage, *clGreenImage, *clRawGradientImage, clLinearRGBImageA.get(),
+    interpolateRedBlue(_glsContext, *mosaicImage, *clGreenImage, *clRawGradientImage, clLinearRGBImageA.get(),
                        demosaicParameters->bayerPattern, rawVariance[0], rawVariance[2]);
 
     interpolateRedBlueAtGreen(_glsContext, *clLinearRGBImageA, *clRawGradientImage, clLinearRGBImageA.get(),
                               demosaicParameters->bayerPattern, rawVariance[0], rawVariance[2]);
 
     // Recover clipped highlights
-    blendHighlightsImage(_glsContext, *clLinearRGBImageA, /*clip=*/1.0, clLinearRGBImageA.get());
+    const auto outputImage = blendHighlights(demosaicParameters, toYCbCr);
 
-    return clLinearRGBImageA.get();
+    markStage(PipelineCostModel::Demosaic);
+
+    return outputImage;
+}
+
+template <typename RawImage>
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::binImage(const RawImage& rawImage,
+                                                                DemosaicParameters* demosaicParameters, bool toYCbCr) {
+    LOG_INFO(TAG) << "Begin Binning..." << std::endl;
+
+    allocateTextures(_glsContext, rawImage.width / 2, rawImage.height / 2, *demosaicParameters);
+    allocateBinnedRawTextures(_glsContext, rawImage.width, rawImage.height);
+
+    uploadRawImage(rawImage, *demosaicParameters);
+
+    NoiseModel<5>* noiseModel = &demosaicParameters->noiseModel;
+
+    const bool high_noise_image = getRawVariance(noiseModel->rawNlf)[1][1] > kHighNoiseVariance;
+
+    LOG_INFO(TAG) << "NoiseLevel: " << demosaicParameters->noiseLevel << ", high_noise_image: " << high_noise_image
+                  << std::endl;
+
+    if (high_noise_image && demosaicParameters->processingParameters.despeckle) {
+        LOG_INFO(TAG) << "Despeckeling RAW Image" << std::endl;
+
+        // The linear RGB images have the size of the raw RGBA image
+        bayerToRawRGBA(_glsContext, *clScaledRawImage, clLinearRGBImageA.get(), demosaicParameters->bayerPattern);
+
+        despeckleRawRGBAImage(_glsContext, *clLinearRGBImageA, noiseModel->rawNlf.second, clLinearRGBImageB.get());
+
+        rawRGBAToBayer(_glsContext, *clLinearRGBImageB, clScaledRawImage.get(), demosaicParameters->bayerPattern);
+    }
+
+    binBayerQuads(_glsContext, *clScaledRawImage, clLinearRGBImageA.get(), clBinnedGreenImage.get(),
+                  demosaicParameters->bayerPattern);
+
+    *noiseModel = binnedNoiseModel(*noiseModel);
+
+    const auto rawVariance = getRawVariance(noiseModel->rawNlf);
+
+    // Gradients of the binned green for the denoiser's level 0
+    rawImageSobel(_glsContext, *clBinnedGreenImage, clRawSobelImage.get());
+
+    gaussianBlurSobelImage(_glsContext, *clBinnedGreenImage, *clRawSobelImage, rawVariance[1], 1.5, 4.5,
+                           clRawGradientImage.get());
+
+    // Recover clipped highlights
+    return blendHighlights(demosaicParameters, toYCbCr);
 }
 
 gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::denoise(
     const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage, DemosaicParameters* demosaicParameters,
     bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    renderedParameters.reset();
+
     NoiseModel<5>* noiseModel = &demosaicParameters->noiseModel;
 
     // Luma and Chroma Despeckling
     const auto& np = noiseModel->pyramidNlf[0];
-    despeckleImage(_glsContext, inputImage,
-                   /*var_a=*/np.first,
-                   /*var_b=*/np.second, clLinearRGBImageB.get());
+    const auto& processingParameters = demosaicParameters->processingParameters;
+    if (processingParameters.despeckle) {
+        despeckleImage(_glsContext, inputImage,
+                       /*var_a=*/np.first,
+                       /*var_b=*/np.second, clLinearRGBImageB.get());
+        markStage(PipelineCostModel::Despeckle);
+    }
+    const auto& pyramidInput = processingParameters.despeckle ? *clLinearRGBImageB : inputImage;
 
     gls::cl_image_2d<gls::rgba_pixel_float>* clDenoisedImage = pyramidProcessor->denoise(
-        _glsContext, &(demosaicParameters->denoiseParameters), *clLinearRGBImageB, *clRawGradientImage,
-        &(noiseModel->pyramidNlf), demosaicParameters->exposure_multiplier, calibrateFromImage);
+        _glsContext, &(demosaicParameters->denoiseParameters), pyramidInput, *clRawGradientImage,
+        &(noiseModel->pyramidNlf), demosaicParameters->exposure_multiplier, calibrateFromImage, processingParameters);
+    markStage(PipelineCostModel::PyramidDenoise);
 
     if (demosaicParameters->rgbConversionParameters.localToneMapping) {
-        const std::array<const gls::cl_image_2d<gls::rgba_pixel_float>*, 3>& guideImage = {
-            pyramidProcessor->denoisedImagePyramid[4].get(), pyramidProcessor->denoisedImagePyramid[2].get(),
-            pyramidProcessor->denoisedImagePyramid[0].get()};
-        localToneMapping->createMask(_glsContext, *clDenoisedImage, guideImage, *noiseModel, *demosaicParameters);
+        localToneMapping->createMask(_glsContext, pyramidProcessor->denoisedImagePyramid, *noiseModel,
+                                     *demosaicParameters);
+        markStage(PipelineCostModel::LocalToneMapping);
     }
 
     // High ISO noise texture replacement
@@ -246,16 +594,21 @@ gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::denoise(
         const auto grainAmount = 1 + 3 * smoothstep(4e-4, 6e-4, lumaVariance[1]);
 
         blueNoiseImage(_glsContext, *clDenoisedImage, *clBlueNoise, 2 * grainAmount * lumaVariance,
-                       clLinearRGBImageB.get());
+                       clLinearRGBImageB.get(), blueNoiseOrigin);
         clDenoisedImage = clLinearRGBImageB.get();
     }
 
+    clDenoisedResult = clDenoisedImage;
     return clDenoisedImage;
 }
 
 void RawConverter::fuseFrame(const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage,
                              const gls::Matrix<3, 3>& homography, DemosaicParameters* demosaicParameters,
                              bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    renderedParameters.reset();
+
     NoiseModel<5>* noiseModel = &demosaicParameters->noiseModel;
     pyramidProcessor->fuseFrame(_glsContext, &(demosaicParameters->denoiseParameters), inputImage, homography,
                                 *clRawGradientImage, &(noiseModel->pyramidNlf), demosaicParameters->exposure_multiplier,
@@ -263,57 +616,364 @@ void RawConverter::fuseFrame(const gls::cl_image_2d<gls::rgba_pixel_float>& inpu
 }
 
 gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::getFusedImage() {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
     return pyramidProcessor->getFusedImage(_glsContext);
 }
 
 gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::postProcess(
-    const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage, const DemosaicParameters& demosaicParameters) {
-    convertTosRGB(_glsContext, inputImage, localToneMapping->getMask(), clsRGBImage.get(), demosaicParameters);
+    const gls::cl_image_2d<gls::rgba_pixel_float>& inputImage, const DemosaicParameters& demosaicParameters,
+    bool ycbcrInput) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    // Back to camera RGB within convertTosRGB
+    const auto inputTransform =
+        ycbcrInput ? inverse(cam_ycbcr(demosaicParameters.rgb_cam)) * demosaicParameters.exposure_multiplier
+                   : gls::Matrix<3, 3>::identity();
+
+    convertTosRGB(_glsContext, inputImage, localToneMapping->getMask(), localToneMapping->getMaskGuide(),
+                  toneCurveLut(demosaicParameters.rgbConversionParameters), clsRGBImage.get(), demosaicParameters,
+                  inputTransform);
 
     return clsRGBImage.get();
 }
 
-gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
-                                                                   DemosaicParameters* demosaicParameters,
-                                                                   bool calibrateFromImage) {
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::demosaic(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                                DemosaicParameters* demosaicParameters,
+                                                                bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return demosaicImage(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::demosaic(const PackedRawImage& rawImage,
+                                                                DemosaicParameters* demosaicParameters,
+                                                                bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return demosaicImage(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+template <typename RawImage>
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipelineImpl(const RawImage& rawImage,
+                                                                       DemosaicParameters* demosaicParameters,
+                                                                       bool calibrateFromImage, bool binned) {
     auto t_start = std::chrono::high_resolution_clock::now();
 
-    // --- Image Demosaicing ---
+    // The cost model is calibrated on full resolution runs
+    timingStages = timeBudgetMs > 0 && !binned;
 
-    const auto demosaicedImage = demosaic(rawImage, demosaicParameters, calibrateFromImage);
+    if (timingStages) {
+        const bool highNoise = getRawVariance(demosaicParameters->noiseModel.rawNlf)[1][1] > kHighNoiseVariance;
+        costModel.plan(timeBudgetMs, rawImage.width, rawImage.height, highNoise, demosaicParameters);
 
-    // --- Image Denoising ---
+        stageTimes = {};
+        stageStart = t_start;
+    }
 
-    // Convert linear image to YCbCr for denoising
-    const auto cam_to_ycbcr = cam_ycbcr(demosaicParameters->rgb_cam);
+    // --- Image Demosaicing ---
 
-    LOG_INFO(TAG) << "cam_to_ycbcr: " << std::setprecision(4) << std::scientific << cam_to_ycbcr.span() << std::endl;
+    // The highlights blending outputs YCbCr for denoising
+    const auto ycbcrImage = binned ? binImage(rawImage, demosaicParameters, /*toYCbCr=*/true)
+                                   : demosaicImage(rawImage, demosaicParameters, calibrateFromImage, /*toYCbCr=*/true);
 
-    transformImage(_glsContext, *demosaicedImage, clLinearRGBImageA.get(), cam_to_ycbcr);
+    stageBoundary();
 
-    const auto clDenoisedImage = denoise(*clLinearRGBImageA, demosaicParameters, calibrateFromImage);
+    // --- Image Denoising ---
+
+    const auto clDenoisedImage = denoise(*ycbcrImage, demosaicParameters, calibrateFromImage);
 
-    // Convert result back to camera RGB
-    const auto normalized_ycbcr_to_cam = inverse(cam_to_ycbcr) * demosaicParameters->exposure_multiplier;
-    transformImage(_glsContext, *clDenoisedImage, clLinearRGBImageA.get(), normalized_ycbcr_to_cam);
+    stageBoundary();
 
     // --- Image Post Processing ---
 
-    const auto sRGBImage = postProcess(*clLinearRGBImageA, *demosaicParameters);
+    const auto sRGBImage = postProcess(*clDenoisedImage, *demosaicParameters, /*ycbcrInput=*/true);
 
-    cl::CommandQueue queue = cl::CommandQueue::getDefault();
-    queue.finish();
+    commandQueue.finish();
     auto t_end = std::chrono::high_resolution_clock::now();
     double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
 
     LOG_INFO(TAG) << "OpenCL Pipeline Execution Time: " << (int)elapsed_time_ms
                   << "ms for image of size: " << rawImage.width << " x " << rawImage.height << std::endl;
 
+    renderedParameters = *demosaicParameters;
+
+    if (timingStages) {
+        markStage(PipelineCostModel::PostProcess);
+
+        // Stages that didn't run are not recorded
+        for (int s = 0; s < PipelineCostModel::kStages; s++) {
+            const auto stage = (PipelineCostModel::Stage)s;
+            if (stageTimes[stage] > 0) {
+                costModel.record(stage, stageTimes[stage],
+                                 PipelineCostModel::workload(stage, rawImage.width, rawImage.height,
+                                                             *demosaicParameters));
+            }
+        }
+    }
+
     return sRGBImage;
 }
 
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                                   DemosaicParameters* demosaicParameters,
+                                                                   bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return runPipelineImpl(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+// Parameters of the demosaicing front end, up to the YCbCr image
+static bool sameDemosaicInputs(const DemosaicParameters& a, const DemosaicParameters& b) {
+    return a.bayerPattern == b.bayerPattern && a.black_level == b.black_level && a.white_level == b.white_level &&
+           a.scale_mul == b.scale_mul && a.rgb_cam == b.rgb_cam && a.noiseModel.rawNlf == b.noiseModel.rawNlf &&
+           a.processingParameters.despeckle == b.processingParameters.despeckle;
+}
+
+// Parameters of denoise(), with the ones of the front end
+static bool sameDenoiseInputs(const DemosaicParameters& a, const DemosaicParameters& b) {
+    return a.exposure_multiplier == b.exposure_multiplier && a.noiseModel.pyramidNlf == b.noiseModel.pyramidNlf &&
+           a.denoiseParameters == b.denoiseParameters && a.processingParameters == b.processingParameters;
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::rerender(const DemosaicParameters& demosaicParameters) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    if (!renderedParameters || !sameDemosaicInputs(demosaicParameters, *renderedParameters)) {
+        return nullptr;
+    }
+    // Reset by denoise()
+    const DemosaicParameters rendered = *renderedParameters;
+
+    const auto& rgbConversionParameters = demosaicParameters.rgbConversionParameters;
+    const auto& ltmParameters = demosaicParameters.ltmParameters;
+    const bool ltmEnabled = rgbConversionParameters.localToneMapping;
+    const bool renderedLtmEnabled = rendered.rgbConversionParameters.localToneMapping;
+
+    // The LTM mask has to keep the resolution and filter of the texture plan
+    const bool ltmPlanned =
+        renderedLtmEnabled &&
+        LocalToneMapping::maskLevel(ltmParameters) == LocalToneMapping::maskLevel(rendered.ltmParameters) &&
+        (ltmParameters.guidedFilterRadius != 2) == (rendered.ltmParameters.guidedFilterRadius != 2);
+    if (ltmEnabled && !ltmPlanned) {
+        return nullptr;
+    }
+
+    if (!sameDenoiseInputs(demosaicParameters, rendered)) {
+        // Rerun from the resident YCbCr image
+        if (!clYCbCrImage) {
+            return nullptr;
+        }
+        LOG_INFO(TAG) << "Rerender: denoise and postProcess" << std::endl;
+
+        DemosaicParameters denoiseParameters = demosaicParameters;
+        denoise(*clYCbCrImage, &denoiseParameters, /*calibrateFromImage=*/false);
+    } else if (ltmEnabled && (!renderedLtmEnabled || ltmParameters != rendered.ltmParameters)) {
+        // Recompute the LTM mask from the resident guide levels
+        if (!incrementalRendering) {
+            return nullptr;
+        }
+        LOG_INFO(TAG) << "Rerender: LTM mask and postProcess" << std::endl;
+
+        localToneMapping->createMask(_glsContext, pyramidProcessor->denoisedImagePyramid, rendered.noiseModel,
+                                     demosaicParameters);
+    } else if (rgbConversionParameters == rendered.rgbConversionParameters) {
+        return clsRGBImage.get();
+    } else {
+        LOG_INFO(TAG) << "Rerender: postProcess" << std::endl;
+    }
+
+    // The denoised YCbCr image of the last run is still resident
+    const auto sRGBImage = postProcess(*clDenoisedResult, demosaicParameters, /*ycbcrInput=*/true);
+
+    renderedParameters = demosaicParameters;
+
+    return sRGBImage;
+}
+
+void RawConverter::renderProgressiveLevel(int level) {
+    const auto& demosaicParameters = *progressiveParameters;
+    const auto& denoisedImage = *pyramidProcessor->denoisedImagePyramid[level];
+
+    clsProgressiveRGBImage =
+        texturePool->image<gls::rgba_pixel_float>(_glsContext, denoisedImage.width, denoisedImage.height);
+
+    // Back to camera RGB within convertTosRGB, as the full resolution image in runPipelineImpl
+    const auto normalized_ycbcr_to_cam =
+        inverse(cam_ycbcr(demosaicParameters.rgb_cam)) * demosaicParameters.exposure_multiplier;
+
+    DemosaicParameters previewParameters = demosaicParameters;
+    previewParameters.rgbConversionParameters.localToneMapping = false;
+
+    convertTosRGB(_glsContext, denoisedImage, localToneMapping->getMask(), /*ltmGuideImage=*/nullptr,
+                  toneCurveLut(previewParameters.rgbConversionParameters), clsProgressiveRGBImage.get(),
+                  previewParameters, normalized_ycbcr_to_cam);
+
+    LOG_INFO(TAG) << "Progressive rendering of level " << level << ": " << denoisedImage.width << " x "
+                  << denoisedImage.height << std::endl;
+
+    // The callback may read the image through the default queue, the preview has to be complete
+    commandQueue.finish();
+
+    progressiveCallback(level, *clsProgressiveRGBImage);
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runProgressivePipeline(
+    const gls::image<gls::luma_pixel_16>& rawImage, DemosaicParameters* demosaicParameters, bool calibrateFromImage,
+    const std::function<void(int level, const gls::cl_image_2d<gls::rgba_pixel_float>& image)>& callback) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    progressiveCallback = callback;
+    progressiveParameters = demosaicParameters;
+
+    const auto sRGBImage = runPipelineImpl(rawImage, demosaicParameters, calibrateFromImage);
+
+    progressiveCallback = nullptr;
+    progressiveParameters = nullptr;
+
+    callback(0, *sRGBImage);
+
+    return sRGBImage;
+}
+
+/*static*/ int RawConverter::roiHalo(const DemosaicParameters& demosaicParameters) {
+    const auto& processingParameters = demosaicParameters.processingParameters;
+
+    // Sobel, gradient blur, raw despeckling (5x5 on the quads) and color interpolation
+    int halo = 1 + 5 + 4 + 4;
+
+    // YCbCr despeckling
+    halo += 2;
+
+    // Each denoised level: downsampling, denoise window and reconstruction, at the scale of the level
+    const int levels = std::clamp(processingParameters.pyramidLevels, 1, 5);
+    const int denoiseRadius = std::max(std::min(processingParameters.maxDenoiseRadius, 4), 2);
+    for (int i = 0, scale = 1; i < levels; i++, scale *= 2) {
+        halo += (2 + denoiseRadius + 1) * scale;
+    }
+
+    // LTM guided filters (box mean of the image, then of the coefficients) on the guide levels
+    if (demosaicParameters.rgbConversionParameters.localToneMapping) {
+        const auto& ltmParameters = demosaicParameters.ltmParameters;
+        const int maskLevel = LocalToneMapping::maskLevel(ltmParameters);
+        for (int level : {4, std::max(maskLevel, 2), maskLevel}) {
+            halo += 2 * ltmParameters.guidedFilterRadius * (1 << level);
+        }
+    }
+
+    // Mask upsampling in postProcess
+    return halo + 1;
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
+                                                                   const gls::rectangle& roi,
+                                                                   DemosaicParameters* demosaicParameters) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    assert(roi.x >= 0 && roi.y >= 0 && roi.x + roi.width <= rawImage.width && roi.y + roi.height <= rawImage.height);
+
+    // Align the crop to the coarsest pyramid level, so that the Bayer pattern and all pyramid levels sample the
+    // same pixels as for the full image
+    static const constexpr int kCropAlignment = 32;
+    const int halo = roiHalo(*demosaicParameters);
+    const int x0 = std::max(roi.x - halo, 0) / kCropAlignment * kCropAlignment;
+    const int y0 = std::max(roi.y - halo, 0) / kCropAlignment * kCropAlignment;
+    const int x1 = std::min((roi.x + roi.width + halo + kCropAlignment - 1) / kCropAlignment * kCropAlignment,
+                            rawImage.width);
+    const int y1 = std::min((roi.y + roi.height + halo + kCropAlignment - 1) / kCropAlignment * kCropAlignment,
+                            rawImage.height);
+    const gls::rectangle crop = {x0, y0, x1 - x0, y1 - y0};
+
+    LOG_INFO(TAG) << "ROI " << roi.width << " x " << roi.height << " @ (" << roi.x << ", " << roi.y
+                  << "), processing " << crop.width << " x " << crop.height << " @ (" << crop.x << ", " << crop.y
+                  << ") with a halo of " << halo << " pixels" << std::endl;
+
+    const gls::image<gls::luma_pixel_16> rawCrop(rawImage, crop);
+
+    // The grain is indexed in frame coordinates, so it matches the full render and follows the crop when panning
+    blueNoiseOrigin = {crop.x, crop.y};
+    const auto clsRGBCrop = runPipelineImpl(rawCrop, demosaicParameters, /*calibrateFromImage=*/false);
+    blueNoiseOrigin = {0, 0};
+
+    // Not the region, rerender() would return the whole crop
+    renderedParameters.reset();
+
+    if (!clsROIImage || clsROIImage->width != roi.width || clsROIImage->height != roi.height) {
+        clsROIImage = texturePool->image<gls::rgba_pixel_float>(_glsContext, roi.width, roi.height);
+    }
+    commandQueue.enqueueCopyImage(clsRGBCrop->getImage2D(), clsROIImage->getImage2D(),
+                                  {(size_t)(roi.x - crop.x), (size_t)(roi.y - crop.y), 0}, {0, 0, 0},
+                                  {(size_t)roi.width, (size_t)roi.height, 1});
+
+    return clsROIImage.get();
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipeline(const PackedRawImage& rawImage,
+                                                                   DemosaicParameters* demosaicParameters,
+                                                                   bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return runPipelineImpl(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+template <typename RawImage>
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runBinnedPipelineImpl(const RawImage& rawImage,
+                                                                             DemosaicParameters* demosaicParameters,
+                                                                             bool calibrateFromImage) {
+    // binImage converts the noise model to the binned image's, the caller's full resolution one is left unchanged
+    DemosaicParameters binnedParameters = *demosaicParameters;
+
+    const auto sRGBImage = runPipelineImpl(rawImage, &binnedParameters, calibrateFromImage, /*binned=*/true);
+
+    binnedParameters.noiseModel = demosaicParameters->noiseModel;
+    *demosaicParameters = binnedParameters;
+
+    return sRGBImage;
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runBinnedPipeline(
+    const gls::image<gls::luma_pixel_16>& rawImage, DemosaicParameters* demosaicParameters, bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return runBinnedPipelineImpl(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runBinnedPipeline(const PackedRawImage& rawImage,
+                                                                         DemosaicParameters* demosaicParameters,
+                                                                         bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    return runBinnedPipelineImpl(rawImage, demosaicParameters, calibrateFromImage);
+}
+
+gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runPipeline(
+    int width, int height, const std::function<void(gls::image<gls::luma_pixel_16>*)>& decodeRawImage,
+    DemosaicParameters* demosaicParameters, bool calibrateFromImage) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
+    allocateTextures(_glsContext, width, height, *demosaicParameters);
+
+    // Let the decoder write straight into the device raw image, no staging copy
+    auto rawImage = clRawImage->mapImage(CL_MAP_WRITE_INVALIDATE_REGION);
+    try {
+        decodeRawImage(&rawImage);
+    } catch (...) {
+        // Don't leave the raw image mapped for the next run
+        clRawImage->unmapImage(rawImage);
+        throw;
+    }
+    clRawImage->unmapImage(rawImage);
+
+    // The image is mapped through the default queue, the upload must land before the pipeline reads it
+    cl::CommandQueue::getDefault().finish();
+
+    return runPipelineImpl(DeviceRawImage{width, height}, demosaicParameters, calibrateFromImage);
+}
+
 gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runFastPipeline(const gls::image<gls::luma_pixel_16>& rawImage,
                                                                        const DemosaicParameters& demosaicParameters) {
+    CommandQueueScope commandQueueScope(&commandQueue);
+
     allocateFastDemosaicTextures(_glsContext, rawImage.width, rawImage.height);
 
     LOG_INFO(TAG) << "Begin Fast Demosaicing (GPU)..." << std::endl;
@@ -321,7 +981,7 @@ gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runFastPipeline(const gls
     auto t_start = std::chrono::high_resolution_clock::now();
 
     // Copy input data to the OpenCL input buffer
-    clRawImage->copyPixelsFrom(rawImage);
+    copyPixelsFrom(&commandQueue, rawImage, clRawImage.get());
 
     // --- Image Demosaicing ---
 
@@ -335,11 +995,10 @@ gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runFastPipeline(const gls
 
     // --- Image Post Processing ---
 
-    convertTosRGB(_glsContext, *clFastLinearRGBImage, localToneMapping->getMask(), clsFastRGBImage.get(),
-                  demosaicParameters);
+    convertTosRGB(_glsContext, *clFastLinearRGBImage, localToneMapping->getMask(), /*ltmGuideImage=*/nullptr,
+                  toneCurveLut(demosaicParameters.rgbConversionParameters), clsFastRGBImage.get(), demosaicParameters);
 
-    cl::CommandQueue queue = cl::CommandQueue::getDefault();
-    queue.finish();
+    commandQueue.finish();
     auto t_end = std::chrono::high_resolution_clock::now();
     double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
 
@@ -350,25 +1009,23 @@ gls::cl_image_2d<gls::rgba_pixel_float>* RawConverter::runFastPipeline(const gls
 }
 
 template <typename T>
-/*static*/ typename gls::image<T>::unique_ptr RawConverter::convertToRGBImage(
-    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage) {
-    const constexpr auto scale = std::numeric_limits<typename T::value_type>::max();
+typename gls::image<T>::unique_ptr RawConverter::convertToRGBImage(
+    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage, bool dither) {
+    CommandQueueScope commandQueueScope(&commandQueue);
 
     auto rgbImage = std::make_unique<gls::image<T>>(clRGBAImage.width, clRGBAImage.height);
-    auto rgbaImage = clRGBAImage.mapImage();
-    for (int y = 0; y < clRGBAImage.height; y++) {
-        for (int x = 0; x < clRGBAImage.width; x++) {
-            const auto& p = rgbaImage[y][x];
-            (*rgbImage)[y][x] = {(typename T::value_type)(scale * p.red), (typename T::value_type)(scale * p.green),
-                                 (typename T::value_type)(scale * p.blue)};
-        }
-    }
-    clRGBAImage.unmapImage(rgbaImage);
+
+    // Pack on the device with the host image layout, the readback is just a copy
+    const size_t size = (size_t)rgbImage->stride * rgbImage->height * sizeof(T);
+    allocateOutputBuffer(size);
+    packRGBImage(_glsContext, clRGBAImage, 8 * sizeof(typename T::value_type), dither, rgbImage->stride,
+                 clOutputBuffer.get());
+    commandQueue.enqueueReadBuffer(*clOutputBuffer, CL_TRUE, 0, size, rgbImage->pixels().data());
     return rgbImage;
 }
 
 template gls::image<gls::rgb_pixel>::unique_ptr RawConverter::convertToRGBImage(
-    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage);
+    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage, bool dither);
 
 template gls::image<gls::rgb_pixel_16>::unique_ptr RawConverter::convertToRGBImage<gls::rgb_pixel_16>(
-    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage);
+    const gls::cl_image_2d<gls::rgba_pixel_float>& clRGBAImage, bool dither);